@@ -585,6 +585,9 @@ __define(GC_CMD_INFO,     0)
 __define(GC_CMD_COLLECT,  1)
 __define(GC_CMD_DISABLE,  2)
 __define(GC_CMD_ENABLE,   3)
+__define(GC_CMD_STEP,     4)
+__define(GC_CMD_PAUSES,   5)
+__define(GC_CMD_FREEMAP,  6)
 
 
 __define(VM_CMD_VERSION,  0)
@@ -683,6 +686,10 @@ def analogWrite(pin,period,pulse,time_unit=MILLIS,npulses=0):
     __default_pwm.__ctl__(DRV_CMD_WRITE,pin,period,pulse,time_unit,npulses)
 
 
+@native_c("__seqop",["csrc/misc/zseqop.c","csrc/misc/zgilprio.c"])
+def __seqop(op,x,start):
+    pass
+
 @builtin
 def abs(x):
     """
@@ -710,7 +717,12 @@ def all(x):
                   return False
           return True
 
+   Lists and tuples of numbers, None and sequences, bytes and shorts are scanned natively.
+
     """
+    res = __seqop(4,x,None)
+    if res is not None:
+        return res
     for element in x:
         if not element:
             return False
@@ -729,7 +741,12 @@ def any(x):
               if element:
                   return True
           return False
+
+   Lists and tuples of numbers, None and sequences, bytes and shorts are scanned natively.
     """
+    res = __seqop(3,x,None)
+    if res is not None:
+        return res
     for element in x:
         if element:
             return True
@@ -743,7 +760,12 @@ def sum(x,start=0):
    Sums *start* and the items of an *iterable* from left to right and returns the
    total.  *start* defaults to ``0``. 
 
+   Lists and tuples of numbers, bytes and shorts are summed natively.
+
     """
+    res = __seqop(0,x,start)
+    if res is not None:
+        return res
     for element in x:
         start+=element
     return start
@@ -771,13 +793,17 @@ def max(*args):
     """
 .. function:: max(*args)
 
-   Return the largest item in args.
+   Return the largest item in args, or in args[0] if it is the only one.
+   Lists and tuples of numbers, bytes and shorts are scanned natively.
 
     """
     if len(args)==1:
         args=args[0]
         if len(args)==0:
             raise ValueError
+    res = __seqop(2,args,None)
+    if res is not None:
+        return res
     tmp = args[0]
     for element in args:
         if element>tmp:
@@ -789,13 +815,17 @@ def min(*args):
     """
 .. function:: min(*args)
 
-   Return the smallest item in args.
+   Return the smallest item in args, or in args[0] if it is the only one.
+   Lists and tuples of numbers, bytes and shorts are scanned natively.
 
     """
     if len(args)==1:
         args=args[0]
         if len(args)==0:
             raise ValueError
+    res = __seqop(1,args,None)
+    if res is not None:
+        return res
     tmp = args[0]
     for element in args:
         if element<tmp:
@@ -45,6 +45,19 @@
 #endif
 
 #include "zerynth_debug.h"
+#include "zerynth_args.h"
+
+#if defined(ZERYNTH_GIL_PROFILE)
+#include "zerynth_gilprof.h"
+#endif
+
+#if defined(ZERYNTH_NATIVE_PROFILE)
+#include "zerynth_natprof.h"
+#endif
+
+#if defined(ZERYNTH_GIL_HANDOFF)
+#include "zerynth_gilprio.h"
+#endif
 
 
 /* VOS LAYER */
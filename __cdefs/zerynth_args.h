@@ -0,0 +1,72 @@
+#ifndef __ZERYNTH_ARGS__
+#define __ZERYNTH_ARGS__
+
+/*
+ * Typed argument unpackers for natives called often, in place of parse_py_args: each macro checks and converts one
+ * argument inline, so no format string is interpreted and no varargs are walked at each call. The spec of a native is
+ * a chain of them, in the order of the format characters they replace:
+ *
+ *     // parse_py_args("iss", nargs, args, &hashtype, &pctx, &ctx_len, &data, &data_len) != 3
+ *     if (nargs < 3 || !PYARG_INT(0, hashtype) || !PYARG_BYTES(1, pctx, ctx_len) || !PYARG_BYTES(2, data, data_len))
+ *         return ERR_TYPE_EXC;
+ *
+ * Optional arguments, the uppercase characters, take their default when missing:
+ *
+ *     // parse_py_args("isI", nargs, args, &sock, &buf, &len, 0, &flags) != 3
+ *     if (nargs < 2 || !PYARG_INT(0, sock) || !PYARG_BYTES(1, buf, len) || !PYARG_INT_OPT(2, 0, flags))
+ *         return ERR_TYPE_EXC;
+ *
+ * Targets are 32 bit integers, signed or not, 64 bit integers for PYARG_INT64, doubles for PYARG_FLOAT and uint8_t*
+ * with a 32 bit length for PYARG_BYTES.
+ */
+
+// "i": PSMALLINT or PINTEGER, truncated to 32 bits
+static inline int pyarg_int(PObject *o, int32_t *v) {
+    if (IS_PSMALLINT(o)) {
+        *v = PSMALLINT_VALUE(o);
+        return 1;
+    }
+    if (PTYPE(o) != PINTEGER)
+        return 0;
+    *v = (int32_t)INTEGER_VALUE(o);
+    return 1;
+}
+
+// "l": PSMALLINT or PINTEGER
+static inline int pyarg_int64(PObject *o, int64_t *v) {
+    if (IS_PSMALLINT(o)) {
+        *v = PSMALLINT_VALUE(o);
+        return 1;
+    }
+    if (PTYPE(o) != PINTEGER)
+        return 0;
+    *v = INTEGER_VALUE(o);
+    return 1;
+}
+
+// "s": PSTRING, PBYTES or PBYTEARRAY
+static inline int pyarg_bytes(PObject *o, uint8_t **p, int32_t *len) {
+    int t = PTYPE(o);
+
+    if (!IS_BYTE_PSEQUENCE_TYPE(t))
+        return 0;
+    *p = PSEQUENCE_BYTES(o);
+    *len = PSEQUENCE_ELEMENTS(o);
+    return 1;
+}
+
+// "f": PFLOAT
+static inline int pyarg_float(PObject *o, double *v) {
+    if (PTYPE(o) != PFLOAT)
+        return 0;
+    *v = FLOAT_VALUE(o);
+    return 1;
+}
+
+#define PYARG_INT(n, v)             pyarg_int(args[n], (int32_t*)&(v))
+#define PYARG_INT64(n, v)           pyarg_int64(args[n], (int64_t*)&(v))
+#define PYARG_BYTES(n, p, len)      pyarg_bytes(args[n], (uint8_t**)&(p), (int32_t*)&(len))
+#define PYARG_FLOAT(n, v)           pyarg_float(args[n], &(v))
+#define PYARG_INT_OPT(n, def, v)    ((nargs > (n)) ? PYARG_INT(n, v) : ((v) = (def), 1))
+
+#endif
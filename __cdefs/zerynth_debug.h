@@ -1,7 +1,21 @@
 
 #if defined(ZERYNTH_DEBUG)
 
-#if ZERYNTH_DEBUG>=0
+#if ZERYNTH_DEBUG>=0 && defined(ZERYNTH_DEBUG_LOG)
+#include "zerynth_log.h"
+
+// records go to the log ring, formatted later by the log module
+#define ZDEBUG(tag,lvl,maxlvl,fmt,...) do { \
+    if ((lvl)<=(maxlvl) &&(lvl)>=0) { \
+        zlog_c(lvl,tag,fmt __VA_OPT__(,) __VA_ARGS__); \
+    } else { \
+    }} while(0)
+
+#define ZERROR(tag,fmt,...) do { \
+        zlog_c(ZLOG_ERROR,tag,fmt __VA_OPT__(,) __VA_ARGS__); \
+    } while(0)
+
+#elif ZERYNTH_DEBUG>=0
 #define ZDEBUG(tag,lvl,maxlvl,fmt,...) do { \
     if ((lvl)<=(maxlvl) &&(lvl)>=0) { \
         vbl_printf_stdout("[DBG]:%i:" tag " @%s:%i | " fmt "\n",lvl,__func__,__LINE__ __VA_OPT__(,) __VA_ARGS__); \
@@ -1,9 +1,44 @@
+/*
+ * Levels are filtered by the preprocessor: a message above DEBUG_MAX_LEVEL, or above ZERYNTH_DEBUG_LEVEL when defined
+ * for the whole build, expands to nothing, format string included, at any optimization level.
+ * For this the level of DEBUG must be written as LVL0..LVL3 or 0..3.
+ */
+#undef DEBUG_LEVEL_
+#if defined(ZERYNTH_DEBUG_LEVEL) && ZERYNTH_DEBUG_LEVEL < DEBUG_MAX_LEVEL
+#define DEBUG_LEVEL_ ZERYNTH_DEBUG_LEVEL
+#else
+#define DEBUG_LEVEL_ DEBUG_MAX_LEVEL
+#endif
+
+#undef DEBUG
+#undef DEBUG0
+#undef DEBUG1
+#undef DEBUG2
+#undef DEBUG3
+#undef ERROR
+
 #if defined(ZERYNTH_DEBUG)
-#define DEBUG(lvl,fmt,...) ZDEBUG(DEBUG_TAG,lvl,DEBUG_MAX_LEVEL,fmt,__VA_ARGS__)
+#define DEBUG(lvl,fmt,...) DEBUG_##lvl(fmt,__VA_ARGS__)
+#if DEBUG_LEVEL_ >= 0
 #define DEBUG0(fmt,...) ZDEBUG(DEBUG_TAG,0,DEBUG_MAX_LEVEL,fmt,__VA_ARGS__)
+#else
+#define DEBUG0(fmt,...) do {} while(0)
+#endif
+#if DEBUG_LEVEL_ >= 1
 #define DEBUG1(fmt,...) ZDEBUG(DEBUG_TAG,1,DEBUG_MAX_LEVEL,fmt,__VA_ARGS__)
+#else
+#define DEBUG1(fmt,...) do {} while(0)
+#endif
+#if DEBUG_LEVEL_ >= 2
 #define DEBUG2(fmt,...) ZDEBUG(DEBUG_TAG,2,DEBUG_MAX_LEVEL,fmt,__VA_ARGS__)
+#else
+#define DEBUG2(fmt,...) do {} while(0)
+#endif
+#if DEBUG_LEVEL_ >= 3
 #define DEBUG3(fmt,...) ZDEBUG(DEBUG_TAG,3,DEBUG_MAX_LEVEL,fmt,__VA_ARGS__)
+#else
+#define DEBUG3(fmt,...) do {} while(0)
+#endif
 #define ERROR(fmt,...) ZERROR(DEBUG_TAG,fmt,__VA_ARGS__)
 #else
 #define DEBUG(lvl,fmt,...) do {} while(0)
@@ -13,3 +48,15 @@
 #define DEBUG3(fmt,...) do {} while(0)
 #define ERROR(fmt,...) do{} while(0)
 #endif
+
+// DEBUG(LVLn,...) and DEBUG(n,...) select DEBUGn
+#ifndef DEBUG_LVL0
+#define DEBUG_LVL0 DEBUG0
+#define DEBUG_LVL1 DEBUG1
+#define DEBUG_LVL2 DEBUG2
+#define DEBUG_LVL3 DEBUG3
+#define DEBUG_0 DEBUG0
+#define DEBUG_1 DEBUG1
+#define DEBUG_2 DEBUG2
+#define DEBUG_3 DEBUG3
+#endif
@@ -0,0 +1,34 @@
+#ifndef __ZERYNTH_GILPRIO__
+#define __ZERYNTH_GILPRIO__
+
+/*
+ * GIL handoff to threads of higher priority, compiled in when ZERYNTH_GIL_HANDOFF is defined.
+ *
+ * Natives waiting in ACQUIRE_GIL are counted by priority. A native holding the GIL for long calls GIL_CHECKPOINT
+ * between chunks of work: if a thread of higher priority waits for the GIL, the GIL is released, the scheduler
+ * runs the waiting thread, and the GIL is taken back. Without ZERYNTH_GIL_HANDOFF, GIL_CHECKPOINT costs nothing.
+ * Python objects may change while the GIL is released: after a checkpoint, natives must take again the buffers
+ * of their arguments.
+ *
+ * Only threads waiting from a native (socket reads, queues, hardware timers, ...) are seen: the VM takes the GIL
+ * for the bytecode without these hooks.
+ * Tables and hooks are defined in csrc/misc/zgilprio.c.
+ */
+
+#include <stdint.h>
+#include "vosal.h"
+
+#define GILPRIO_LEVELS  (VOS_PRIO_HIGHEST + 1)
+
+// threads waiting for the GIL by priority, and a bit for every priority with waiters
+extern volatile uint8_t gilprio_waiting[GILPRIO_LEVELS];
+extern volatile uint32_t gilprio_mask;
+extern uint32_t gilprio_handoffs;
+
+// with the GIL held: 1 if a thread of higher priority than the current one waits for it
+static inline int gilprio_wanted(void)
+{
+    return (gilprio_mask >> (vosThGetPriority() + 1)) != 0;
+}
+
+#endif
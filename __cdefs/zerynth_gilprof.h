@@ -0,0 +1,210 @@
+#ifndef __ZERYNTH_GILPROF__
+#define __ZERYNTH_GILPROF__
+
+/*
+ * GIL hold time profiler, compiled in when ZERYNTH_GIL_PROFILE is defined.
+ *
+ * Every C_NATIVE is wrapped: the GIL is held from the start of the call to its return, except between
+ * RELEASE_GIL and ACQUIRE_GIL. Each hold is accounted to the native (count, total, max, histogram),
+ * kept among the longest ones if in the top, and appended to a ring of the latest holds.
+ * Since only the GIL holder records, the GIL itself protects the tables.
+ *
+ * Timings use the cycle counter on Cortex-M3/M4/M7, milliseconds elsewhere.
+ * Tables are defined weak in this header, so that no source file has to be linked on purpose.
+ */
+
+#include <stdint.h>
+#include "vosal.h"
+
+#define GILPROF_NATIVES  32
+#define GILPROF_BUCKETS  12     // hold < 16us << bucket, last bucket unbounded
+#define GILPROF_TOP      8
+#define GILPROF_RING     32
+#define GILPROF_THREADS  16
+
+typedef struct _gilprof_frame {
+    const char *name;
+    uint32_t since;
+    struct _gilprof_frame *prev;
+} GilProfFrame;
+
+typedef struct _gilprof_stats {
+    const char *name;
+    uint32_t count;
+    uint32_t total;         // us
+    uint32_t max;           // us
+    uint16_t hist[GILPROF_BUCKETS];
+} GilProfStats;
+
+typedef struct _gilprof_hold {
+    const char *name;
+    uint32_t thread;
+    uint32_t at;            // millis
+    uint32_t us;
+} GilProfHold;
+
+typedef struct _gilprof_thread {
+    VThread th;
+    GilProfFrame *frame;
+} GilProfThread;
+
+#define GILPROF_WEAK __attribute__((weak))
+
+GILPROF_WEAK GilProfFrame *gilprof_cur;
+GILPROF_WEAK GilProfStats gilprof_stats[GILPROF_NATIVES];
+GILPROF_WEAK GilProfHold gilprof_top[GILPROF_TOP];
+GILPROF_WEAK GilProfHold gilprof_ring[GILPROF_RING];
+GILPROF_WEAK uint32_t gilprof_ring_pos;
+GILPROF_WEAK GilProfThread gilprof_threads[GILPROF_THREADS];
+GILPROF_WEAK uint32_t gilprof_clock_on;
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define GILPROF_DEMCR   (*(volatile uint32_t *)0xE000EDFC)
+#define GILPROF_DWTCTRL (*(volatile uint32_t *)0xE0001000)
+#define GILPROF_CYCCNT  (*(volatile uint32_t *)0xE0001004)
+
+static inline uint32_t gilprof_now(void)
+{
+    if (!gilprof_clock_on) {
+        GILPROF_DEMCR |= (1 << 24);
+        GILPROF_CYCCNT = 0;
+        GILPROF_DWTCTRL |= 1;
+        gilprof_clock_on = 1;
+    }
+    return GILPROF_CYCCNT;
+}
+
+static inline uint32_t gilprof_us(uint32_t elapsed)
+{
+    uint32_t mhz = _system_frequency / 1000000;
+    return mhz ? elapsed / mhz : elapsed;
+}
+#else
+static inline uint32_t gilprof_now(void)
+{
+    return (uint32_t)vosMillis();
+}
+
+static inline uint32_t gilprof_us(uint32_t elapsed)
+{
+    return elapsed * 1000;
+}
+#endif
+
+GILPROF_WEAK void gilprof_record(const char *name, uint32_t since)
+{
+    uint32_t us = gilprof_us(gilprof_now() - since);
+    uint32_t th = vosThGetId(vosThCurrent());
+    GilProfStats *st = NULL;
+    GilProfHold *h;
+    int i, b;
+
+    // natives are few and their names are literals: compare pointers
+    for (i = 0; i < GILPROF_NATIVES; i++) {
+        if (gilprof_stats[i].name == name || !gilprof_stats[i].name) {
+            st = &gilprof_stats[i];
+            break;
+        }
+    }
+    if (st) {
+        st->name = name;
+        st->count++;
+        st->total += us;
+        if (us > st->max)
+            st->max = us;
+        for (b = 0; b < GILPROF_BUCKETS - 1 && us >= (16u << b); b++);
+        if (st->hist[b] < 0xffff)
+            st->hist[b]++;
+    }
+
+    // replace the shortest of the longest holds
+    h = &gilprof_top[0];
+    for (i = 1; i < GILPROF_TOP; i++) {
+        if (gilprof_top[i].us < h->us)
+            h = &gilprof_top[i];
+    }
+    if (us > h->us || !h->name) {
+        h->name = name;
+        h->thread = th;
+        h->at = (uint32_t)vosMillis();
+        h->us = us;
+    }
+
+    h = &gilprof_ring[gilprof_ring_pos % GILPROF_RING];
+    gilprof_ring_pos++;
+    h->name = name;
+    h->thread = th;
+    h->at = (uint32_t)vosMillis();
+    h->us = us;
+}
+
+static inline void gilprof_enter(GilProfFrame *fr, const char *name)
+{
+    fr->name = name;
+    fr->prev = gilprof_cur;
+    fr->since = gilprof_now();
+    gilprof_cur = fr;
+}
+
+static inline void gilprof_exit(GilProfFrame *fr)
+{
+    gilprof_record(fr->name, fr->since);
+    gilprof_cur = fr->prev;
+}
+
+// before RELEASE_GIL: closes the hold and remembers the native of the thread
+GILPROF_WEAK void gilprof_released(void)
+{
+    VThread th = vosThCurrent();
+    GilProfThread *free_slot = NULL;
+    int i;
+
+    if (!gilprof_cur)
+        return;
+    gilprof_record(gilprof_cur->name, gilprof_cur->since);
+    for (i = 0; i < GILPROF_THREADS; i++) {
+        if (gilprof_threads[i].th == th) {
+            free_slot = &gilprof_threads[i];
+            break;
+        }
+        if (!free_slot && !gilprof_threads[i].th)
+            free_slot = &gilprof_threads[i];
+    }
+    if (free_slot) {
+        free_slot->th = th;
+        free_slot->frame = gilprof_cur;
+    }
+    gilprof_cur = NULL;
+}
+
+// after ACQUIRE_GIL: a new hold starts for the native of the thread
+GILPROF_WEAK void gilprof_acquired(void)
+{
+    VThread th = vosThCurrent();
+    int i;
+
+    gilprof_cur = NULL;
+    for (i = 0; i < GILPROF_THREADS; i++) {
+        if (gilprof_threads[i].th == th) {
+            gilprof_cur = gilprof_threads[i].frame;
+            gilprof_threads[i].th = NULL;
+            gilprof_cur->since = gilprof_now();
+            break;
+        }
+    }
+}
+
+#undef C_NATIVE
+#define C_NATIVE(name) \
+    static err_t name##__gilprof(int nargs, PObject *self, PObject **args, PObject **res); \
+    err_t name(int nargs, PObject *self, PObject **args, PObject **res) { \
+        GilProfFrame _gilprof_fr; \
+        err_t _gilprof_err; \
+        gilprof_enter(&_gilprof_fr, #name); \
+        _gilprof_err = name##__gilprof(nargs, self, args, res); \
+        gilprof_exit(&_gilprof_fr); \
+        return _gilprof_err; \
+    } \
+    static err_t name##__gilprof(int nargs, PObject *self, PObject **args, PObject **res)
+
+#endif
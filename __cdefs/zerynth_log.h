@@ -0,0 +1,246 @@
+#ifndef __ZERYNTH_LOG__
+#define __ZERYNTH_LOG__
+
+/*
+ * RAM ring of log records, written by the log module and, when ZERYNTH_DEBUG_LOG is defined together with
+ * ZERYNTH_DEBUG, by the DEBUG and ERROR macros of zerynth_debug_macros.h.
+ *
+ * A record holds the millis at which it was written, a level, the source of its format and its arguments
+ * copied raw: no formatting happens when logging. The source is a template id for records of the log module,
+ * the pointers to the literal tag and format for C records. Formatting is left to the consumer, usually the
+ * low priority thread started by log.start.
+ *
+ * Producers serialize on the system lock, only to copy the packed record in; the single consumer owns head.
+ * Records that do not fit are dropped and counted. The ring is defined weak in this header, so that C debug
+ * records can be written even if the log module is not used.
+ */
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include "vosal.h"
+
+#ifndef ZLOG_SIZE
+#define ZLOG_SIZE       2048    // power of two
+#endif
+#define ZLOG_RECORD_MAX 192
+#define ZLOG_STR_MAX    48      // longer string arguments are truncated
+#define ZLOG_ERROR      (-1)
+
+#define ZLOG_PY         0
+#define ZLOG_C          1
+
+// argument tags
+#define ZLOG_INT        'i'     // int64
+#define ZLOG_LONG       'l'     // int64, C long
+#define ZLOG_LLONG      'q'     // int64, C long long
+#define ZLOG_PTR        'p'     // int64, C pointer
+#define ZLOG_FLOAT      'f'     // double
+#define ZLOG_STR        's'     // length byte and chars
+#define ZLOG_NONE       'n'
+#define ZLOG_TRUE       'T'
+#define ZLOG_FALSE      'F'
+
+typedef struct _zlog_header {
+    uint16_t len;       // header included
+    int8_t level;
+    uint8_t kind;
+    uint32_t at;        // millis
+    uint8_t nargs;
+    uint8_t truncated;
+    uint16_t id;        // template id of ZLOG_PY records
+} ZLogHeader;
+
+// ZLOG_C records continue with the tag and format pointers
+typedef struct _zlog_csrc {
+    const char *tag;
+    const char *fmt;
+} ZLogCSource;
+
+#define ZLOG_WEAK __attribute__((weak))
+
+ZLOG_WEAK uint8_t zlog_ring[ZLOG_SIZE];
+ZLOG_WEAK volatile uint32_t zlog_head;
+ZLOG_WEAK volatile uint32_t zlog_tail;
+ZLOG_WEAK uint32_t zlog_dropped;
+ZLOG_WEAK int32_t zlog_level = 3;
+ZLOG_WEAK VSemaphore zlog_sem;
+
+static inline int zlog_enabled(int level)
+{
+    return level <= zlog_level;
+}
+
+/*
+ * Appends the len bytes of the packed record rec, whose header len is already set.
+ * Returns 0 if the record was dropped.
+ */
+ZLOG_WEAK int zlog_write(const uint8_t *rec, int len)
+{
+    uint32_t tail, pos, n;
+    int wake;
+
+    vosSysLock();
+    tail = zlog_tail;
+    if ((uint32_t)len > ZLOG_SIZE - (tail - zlog_head)) {
+        zlog_dropped++;
+        vosSysUnlock();
+        return 0;
+    }
+    pos = tail & (ZLOG_SIZE - 1);
+    n = ZLOG_SIZE - pos;
+    if (n > (uint32_t)len)
+        n = len;
+    memcpy(zlog_ring + pos, rec, n);
+    memcpy(zlog_ring, rec + n, len - n);
+    // record in place before the consumer sees the new tail
+    __sync_synchronize();
+    wake = (tail == zlog_head);
+    zlog_tail = tail + len;
+    vosSysUnlock();
+    if (wake && zlog_sem)
+        vosSemSignalCap(zlog_sem, 1);
+    return 1;
+}
+
+/*
+ * Appends an argument of type tag to the record rec of len bytes, writing its value from v or, for strings, from s.
+ * Returns the new length, or len if the argument does not fit: the record is then marked truncated.
+ */
+static inline int zlog_pack(uint8_t *rec, int len, int tag, int64_t v, double f, const char *s, int slen)
+{
+    ZLogHeader *h = (ZLogHeader*)rec;
+    int need = 1;
+
+    // arguments after a missing one would be misread
+    if (h->truncated)
+        return len;
+    if (tag == ZLOG_STR) {
+        if (slen > ZLOG_STR_MAX)
+            slen = ZLOG_STR_MAX;
+        need += 1 + slen;
+    } else if (tag != ZLOG_NONE && tag != ZLOG_TRUE && tag != ZLOG_FALSE)
+        need += 8;
+    if (len + need > ZLOG_RECORD_MAX || h->nargs == 0xff) {
+        h->truncated = 1;
+        return len;
+    }
+    rec[len++] = tag;
+    if (tag == ZLOG_STR) {
+        rec[len++] = slen;
+        memcpy(rec + len, s, slen);
+        len += slen;
+    } else if (tag == ZLOG_FLOAT) {
+        memcpy(rec + len, &f, 8);
+        len += 8;
+    } else if (need > 1) {
+        memcpy(rec + len, &v, 8);
+        len += 8;
+    }
+    h->nargs++;
+    return len;
+}
+
+static inline int zlog_begin(uint8_t *rec, int level, int kind)
+{
+    ZLogHeader *h = (ZLogHeader*)rec;
+
+    h->len = 0;
+    h->level = level;
+    h->kind = kind;
+    h->at = (uint32_t)vosMillis();
+    h->nargs = 0;
+    h->truncated = 0;
+    h->id = 0;
+    return sizeof(ZLogHeader);
+}
+
+/*
+ * Records a C message: the arguments are copied following the conversions of fmt, that must be a literal
+ * (as tag), since only its pointer is stored.
+ */
+ZLOG_WEAK void zlog_c(int level, const char *tag, const char *fmt, ...)
+{
+    uint32_t recbuf[ZLOG_RECORD_MAX / 4];   // aligned for the header
+    uint8_t *rec = (uint8_t*)recbuf;
+    ZLogCSource src;
+    const char *p, *s;
+    int len, longs, slen;
+    va_list va;
+
+    if (!zlog_enabled(level))
+        return;
+    len = zlog_begin(rec, level, ZLOG_C);
+    src.tag = tag;
+    src.fmt = fmt;
+    memcpy(rec + len, &src, sizeof(src));
+    len += sizeof(src);
+
+    va_start(va, fmt);
+    for (p = fmt; *p; p++) {
+        if (*p != '%')
+            continue;
+        p++;
+        while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0')
+            p++;
+        // '*' width and precision are int arguments of their own
+        while ((*p >= '0' && *p <= '9') || *p == '.' || *p == '*') {
+            if (*p == '*')
+                len = zlog_pack(rec, len, ZLOG_INT, va_arg(va, int), 0, NULL, 0);
+            p++;
+        }
+        longs = 0;
+        while (*p == 'l' || *p == 'h' || *p == 'z' || *p == 'j' || *p == 't') {
+            if (*p == 'l')
+                longs++;
+            else if (*p != 'h')
+                longs = (sizeof(size_t) == sizeof(long)) ? 1 : 2;
+            p++;
+        }
+        switch (*p) {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+            case 'b':
+            case 'c':
+                if (longs == 2)
+                    len = zlog_pack(rec, len, ZLOG_LLONG, va_arg(va, long long), 0, NULL, 0);
+                else if (longs == 1)
+                    len = zlog_pack(rec, len, ZLOG_LONG, va_arg(va, long), 0, NULL, 0);
+                else
+                    len = zlog_pack(rec, len, ZLOG_INT, va_arg(va, int), 0, NULL, 0);
+                break;
+            case 'p':
+                len = zlog_pack(rec, len, ZLOG_PTR, (int64_t)(uintptr_t)va_arg(va, void*), 0, NULL, 0);
+                break;
+            case 'f':
+            case 'F':
+            case 'g':
+            case 'G':
+            case 'e':
+            case 'E':
+                len = zlog_pack(rec, len, ZLOG_FLOAT, 0, va_arg(va, double), NULL, 0);
+                break;
+            case 's':
+                s = va_arg(va, const char*);
+                if (!s)
+                    s = "(null)";
+                for (slen = 0; slen < ZLOG_STR_MAX && s[slen]; slen++);
+                len = zlog_pack(rec, len, ZLOG_STR, 0, 0, s, slen);
+                break;
+            case 0:
+                p--;
+                break;
+            default:
+                break;
+        }
+    }
+    va_end(va);
+    ((ZLogHeader*)rec)->len = len;
+    zlog_write(rec, len);
+}
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef __ZERYNTH_NATPROF__
+#define __ZERYNTH_NATPROF__
+
+/*
+ * Native call latency profiler, compiled in when ZERYNTH_NATIVE_PROFILE is defined.
+ *
+ * Every C_NATIVE is wrapped: the whole call is timed, from entry to return, waits with the GIL released included,
+ * and accounted to the native (calls, calls raising, total, max, histogram). Natives return holding the GIL,
+ * so the GIL protects the table. With ZERYNTH_GIL_PROFILE too, the wrapper also opens the frame of the GIL profiler.
+ *
+ * Timings use the cycle counter on Cortex-M3/M4/M7, milliseconds elsewhere.
+ * The table is defined weak in this header, so that no source file has to be linked on purpose.
+ */
+
+#include <stdint.h>
+#include "vosal.h"
+
+#define NATPROF_NATIVES  48
+#define NATPROF_BUCKETS  16     // call < 16us << bucket, last bucket unbounded
+
+typedef struct _natprof_stats {
+    const char *name;
+    uint32_t count;
+    uint32_t errors;
+    uint32_t max;           // us
+    uint64_t total;         // us
+    uint16_t hist[NATPROF_BUCKETS];
+} NatProfStats;
+
+#define NATPROF_WEAK __attribute__((weak))
+
+NATPROF_WEAK NatProfStats natprof_stats[NATPROF_NATIVES];
+NATPROF_WEAK uint32_t natprof_lost;
+NATPROF_WEAK uint32_t natprof_clock_on;
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define NATPROF_DEMCR   (*(volatile uint32_t *)0xE000EDFC)
+#define NATPROF_DWTCTRL (*(volatile uint32_t *)0xE0001000)
+#define NATPROF_CYCCNT  (*(volatile uint32_t *)0xE0001004)
+
+static inline uint32_t natprof_now(void)
+{
+    if (!natprof_clock_on) {
+        NATPROF_DEMCR |= (1 << 24);
+        NATPROF_DWTCTRL |= 1;
+        natprof_clock_on = 1;
+    }
+    return NATPROF_CYCCNT;
+}
+
+// the cycle counter wraps in seconds: longer calls are measured in millis
+static inline uint32_t natprof_us(uint32_t cycles, uint32_t ms)
+{
+    uint32_t mhz = _system_frequency / 1000000;
+    if (!mhz)
+        return cycles;
+    return (ms > 1000) ? ms * 1000 : cycles / mhz;
+}
+#else
+static inline uint32_t natprof_now(void)
+{
+    return (uint32_t)vosMillis();
+}
+
+static inline uint32_t natprof_us(uint32_t elapsed, uint32_t ms)
+{
+    (void)ms;
+    return elapsed * 1000;
+}
+#endif
+
+NATPROF_WEAK void natprof_record(const char *name, uint32_t since, uint32_t since_ms, err_t err)
+{
+    uint32_t us = natprof_us(natprof_now() - since, (uint32_t)vosMillis() - since_ms);
+    NatProfStats *st = NULL;
+    int i, b;
+
+    // natives are few and their names are literals: compare pointers
+    for (i = 0; i < NATPROF_NATIVES; i++) {
+        if (natprof_stats[i].name == name || !natprof_stats[i].name) {
+            st = &natprof_stats[i];
+            break;
+        }
+    }
+    if (!st) {
+        natprof_lost++;
+        return;
+    }
+    st->name = name;
+    st->count++;
+    if (err != ERR_OK)
+        st->errors++;
+    st->total += us;
+    if (us > st->max)
+        st->max = us;
+    for (b = 0; b < NATPROF_BUCKETS - 1 && us >= (16u << b); b++);
+    if (st->hist[b] < 0xffff)
+        st->hist[b]++;
+}
+
+#if defined(ZERYNTH_GIL_PROFILE)
+#define NATPROF_GIL_ENTER(name) GilProfFrame _gilprof_fr; gilprof_enter(&_gilprof_fr, name)
+#define NATPROF_GIL_EXIT() gilprof_exit(&_gilprof_fr)
+#else
+#define NATPROF_GIL_ENTER(name)
+#define NATPROF_GIL_EXIT()
+#endif
+
+#undef C_NATIVE
+#define C_NATIVE(name) \
+    static err_t name##__natprof(int nargs, PObject *self, PObject **args, PObject **res); \
+    err_t name(int nargs, PObject *self, PObject **args, PObject **res) { \
+        uint32_t _natprof_since, _natprof_ms; \
+        err_t _natprof_err; \
+        NATPROF_GIL_ENTER(#name); \
+        _natprof_ms = (uint32_t)vosMillis(); \
+        _natprof_since = natprof_now(); \
+        _natprof_err = name##__natprof(nargs, self, args, res); \
+        natprof_record(#name, _natprof_since, _natprof_ms, _natprof_err); \
+        NATPROF_GIL_EXIT(); \
+        return _natprof_err; \
+    } \
+    static err_t name##__natprof(int nargs, PObject *self, PObject **args, PObject **res)
+
+#endif
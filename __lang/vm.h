@@ -72,13 +72,58 @@ typedef struct _vm {
 #define VM_EXCEPTION_MSG_FROM_IDX(e) ((VM_ETABLE_END()+PEXCEPTION_MSG(VM_ETABLE_ENTRY(e)))+2)
 #endif
 
+#if defined(ZERYNTH_GIL_HANDOFF)
+//GIL handoff to threads of higher priority, see zerynth_gilprio.h
+void gilprio_wait(void);
+void gilprio_got(void);
+#define GILPRIO_WAIT() gilprio_wait()
+#define GILPRIO_GOT() gilprio_got()
+#else
+#define GILPRIO_WAIT()
+#define GILPRIO_GOT()
+#endif
+
+#if defined(ZERYNTH_GIL_PROFILE)
+//GIL hold time profiler, see zerynth_gilprof.h
+void gilprof_released(void);
+void gilprof_acquired(void);
+
 #define ACQUIRE_GIL() do {\
+        GILPRIO_WAIT(); \
         vosSemWait(_gillock); \
+        GILPRIO_GOT(); \
+        gilprof_acquired(); \
     }while(0)
 
 #define RELEASE_GIL() do {\
+        gilprof_released(); \
         vosSemSignal(_gillock); \
     }while(0)
+#else
+#define ACQUIRE_GIL() do {\
+        GILPRIO_WAIT(); \
+        vosSemWait(_gillock); \
+        GILPRIO_GOT(); \
+    }while(0)
+
+#define RELEASE_GIL() do {\
+        vosSemSignal(_gillock); \
+    }while(0)
+#endif
+
+//in natives holding the GIL for long: lets a waiting thread of higher priority run
+#if defined(ZERYNTH_GIL_HANDOFF)
+#define GIL_CHECKPOINT() do {\
+        if (gilprio_wanted()) { \
+            gilprio_handoffs++; \
+            RELEASE_GIL(); \
+            vosThYield(); \
+            ACQUIRE_GIL(); \
+        } \
+    }while(0)
+#else
+#define GIL_CHECKPOINT() do {} while(0)
+#endif
 
 PThread *vm_init(VM *vm);
 int vm_upload(VM *vm);
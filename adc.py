@@ -12,9 +12,16 @@ When imported, automatically sets the system adc driver to  the default one.
 
     """
 
+import gc
 
 _adc_drv = 0
 
+TRIGGER_SOFTWARE = 0
+TRIGGER_TIMER = 1
+TRIGGER_RISING = 2
+TRIGGER_FALLING = 3
+TRIGGER_BOTH = 4
+
 @native_c("_vbl_adc_init",["csrc/vbl/vbl_adc.c"],["VHAL_ADC"])
 def _vbl_adc_init():
     pass
@@ -77,4 +84,156 @@ def read(pin,samples=1):
         return None
     return _adc_drv.__ctl__(DRV_CMD_READ,0,pin,samples)
 
+@native_c("_adc_set_trigger",["csrc/vbl/vbl_adc.c"],["VHAL_ADC"])
+def _adc_set_trigger(mode,vpin):
+    pass
+
+def set_trigger(mode,pin=0):
+    """
+.. function:: set_trigger(mode, pin=0)
+
+    Select what starts each conversion of the following captures (:func:`read`, :func:`read_into` and :class:`Stream`):
+
+    * :samp:`TRIGGER_SOFTWARE`: conversions run back to back once the capture is started (the default)
+    * :samp:`TRIGGER_TIMER`: a hardware timer starts a conversion at the *samples_per_second* rate given to :func:`init`
+    * :samp:`TRIGGER_RISING`, :samp:`TRIGGER_FALLING`, :samp:`TRIGGER_BOTH`: each edge of *pin* starts a conversion
+
+    With the hardware triggers samples are taken at exact times without CPU work per sample.
+    Captures raise :samp:`UnsupportedError` if the adc driver of the board does not support the selected trigger.
+
+    """
+    _adc_set_trigger(mode,pin)
+
+@native_c("_adc_read_into",["csrc/vbl/vbl_adc.c"],["VHAL_ADC"])
+def _adc_read_into(drvid,pins,buf,ofs,samples):
+    pass
+
+def read_into(pin,buf,offset=0,samples=-1):
+    """
+.. function:: read_into(pin, buf, offset=0, samples=-1)
+
+    Capture *samples* samples from *pin* (or from each pin of a list or tuple) straight into the :class:`shortarray` *buf*,
+    starting at *offset*. With several pins the samples are interleaved: ``buf[offset+i*npins+j]`` is the i-th sample of
+    the j-th pin. If *samples* is negative, the space left in *buf* after *offset* is filled.
+
+    Nothing is allocated, so reading in a loop into the same *buf* puts no load on the garbage collector::
+
+        import adc
+
+        buf = shortarray(200)
+        while True:
+            adc.read_into([A4,A3],buf)   # 100 samples per pin
+            process(buf)
+
+    Return the number of samples captured per pin. Raise :samp:`UnsupportedError` if the adc does not produce 16 bits samples.
+
+    """
+    npins = 1 if type(pin)==PSMALLINT else len(pin)
+    if samples<0:
+        samples = (len(buf)-offset)//npins
+    return _adc_read_into(0,pin,buf,offset,samples)
+
  
+@native_c("_adc_stream_start",["csrc/vbl/vbl_adc.c"],["VHAL_ADC"])
+def _adc_stream_start(drvid,pins,samples):
+    pass
+
+@native_c("_adc_stream_read",["csrc/vbl/vbl_adc.c"],["VHAL_ADC"])
+def _adc_stream_read(buf,timeout):
+    pass
+
+@native_c("_adc_stream_stop",["csrc/vbl/vbl_adc.c"],["VHAL_ADC"])
+def _adc_stream_stop(drvid):
+    pass
+
+@native_c("_adc_stream_pipe",["csrc/vbl/vbl_adc.c"],["VHAL_ADC"])
+def _adc_stream_pipe(sink,decimation):
+    pass
+
+@native_c("_adc_stream_pipe_stats",["csrc/vbl/vbl_adc.c"],["VHAL_ADC"])
+def _adc_stream_pipe_stats():
+    pass
+
+
+class Stream():
+    """
+.. class:: Stream(pin, samples, drvname=ADC0)
+
+    Create a continuous capture from *pin* (or a list or tuple of pins), without gaps between samples.
+    The adc fills a circular buffer by DMA in two halves of *samples* samples per pin: while one half is being filled,
+    the other one can be read with :meth:`read_into`. Samples of several pins are interleaved, and each sample takes
+    :attr:`sample_size` bytes in native byte order. The rate is the one given to :func:`init`.
+
+    Only one stream can run at a time, and :func:`read` must not be used meanwhile.
+    Raise :samp:`UnsupportedError` if the adc driver of the board has no continuous mode.
+
+    """
+    def __init__(self,pin,samples,drvname=ADC0):
+        self.drvid = drvname&0xff
+        self.npins = 1 if type(pin)==PSMALLINT else len(pin)
+        self.half = _adc_stream_start(self.drvid,pin,samples)
+        self.sample_size = self.half//(self.npins*samples)
+        self.lost = 0
+
+    def buffer(self):
+        """
+.. method:: buffer()
+
+    Return a new bytearray as big as one half of the circular buffer, allocated with :func:`gc.buffer`.
+
+        """
+        return gc.buffer(self.half)
+
+    def read_into(self,buf,timeout=-1):
+        """
+.. method:: read_into(buf,timeout=-1)
+
+    Wait at most *timeout* milliseconds (forever if negative) for the next filled half and copy it into the bytearray *buf*.
+    Return False on timeout, True otherwise.
+
+    Halves are given in order. If the reader falls behind by more than a whole buffer, the oldest halves are overwritten
+    and skipped: their number is added to :attr:`lost`.
+
+        """
+        r = _adc_stream_read(buf,timeout)
+        if r<0:
+            return False
+        self.lost+=r
+        return True
+
+    def pipe(self,sink,decimation=1):
+        """
+.. method:: pipe(sink,decimation=1)
+
+    Send every filled half to *sink* from a native thread, until :meth:`stop`: samples flow from the adc to the sink without Python,
+    so the sample rate is only limited by the sink. *sink* can be:
+
+        * a connected :class:`socket.socket` (or a secure one): the samples are sent as with :meth:`socket.socket.sendall`
+        * a file opened with :func:`os.open` for writing: the samples are written from its current position
+        * a :class:`flashlog.FlashLog`: the samples are appended as records as large as a sector allows, stamped with the milliseconds since boot
+          (or the timestamp of the previous record, if greater). With a :class:`spiflash.SpiFlash` the bus must not be used by others meanwhile
+
+    With *decimation* greater than 1 each group of *decimation* consecutive samples of a pin is averaged into one, reducing both the data and
+    the noise; it needs samples of 2 bytes. :meth:`read_into` can't be used while piping. Progress and errors are given by :meth:`pipe_stats`.
+
+        """
+        _adc_stream_pipe(sink._as_sink(),decimation)
+
+    def pipe_stats(self):
+        """
+.. method:: pipe_stats()
+
+    Return a tuple *(halves, bytes, lost, error)* for the current :meth:`pipe`: the halves and bytes written to the sink, the halves lost because the
+    sink was too slow (or failed), and the error of the sink, 0 if none. After an error the halves are discarded until :meth:`stop`.
+
+        """
+        return _adc_stream_pipe_stats()
+
+    def stop(self):
+        """
+.. method:: stop()
+
+    Stop the capture, and its :meth:`pipe` if any. The adc returns available to :func:`read`.
+
+        """
+        _adc_stream_stop(self.drvid)
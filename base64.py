@@ -36,4 +36,160 @@ def standard_b64decode(s):
     Decode *s* (either bytes, bytearray or string) using the standard Base64 alphabet and return the decoded object as bytes. 
 
     """
-    pass
\ No newline at end of file
+    pass
+
+@native_c("__b64_urlsafe_encode",["csrc/base64/*"])
+def urlsafe_b64encode(s, padding=True):
+    """
+.. function:: urlsafe_b64encode(s, padding=True)
+
+    Encode *s* (either bytes, bytearray or string) using the URL and filesystem safe alphabet, which substitutes ``-`` for ``+`` and ``_`` for ``/``, and return the encoded object as bytes.
+    If *padding* is False, the trailing ``=`` are omitted, as required by the base64url encoding of JSON Web Tokens.
+
+    """
+    pass
+
+
+@native_c("__b64_decode",["csrc/base64/*"])
+def urlsafe_b64decode(s):
+    """
+.. function:: urlsafe_b64decode(s)
+
+    Decode *s* (either bytes, bytearray or string) using the URL and filesystem safe alphabet and return the decoded object as bytes. Padding is optional.
+
+    .. note:: The decoding functions of this module accept both the standard and the URL safe alphabets.
+
+    """
+    pass
+
+
+@native_c("__b64_encode_into",["csrc/base64/*"])
+def encode_into(s, buffer, offset=0):
+    """
+.. function:: encode_into(s, buffer, offset=0)
+
+    Encode *s* (either bytes, bytearray or string) using the standard Base64 alphabet, writing the result in the bytearray *buffer* starting at *offset*.
+    Returns the number of bytes written. No new object is allocated, so the same *buffer* can be reused for many encodings.
+
+    Raises ``IndexError`` if the encoded data does not fit in *buffer*.
+
+    """
+    pass
+
+
+@native_c("__b64_decode_into",["csrc/base64/*"])
+def decode_into(s, buffer, offset=0):
+    """
+.. function:: decode_into(s, buffer, offset=0)
+
+    Decode *s* (either bytes, bytearray or string) using the standard Base64 alphabet, writing the result in the bytearray *buffer* starting at *offset*.
+    Returns the number of bytes written. *buffer* can also be *s* itself with *offset* 0, to decode a bytearray in place: ::
+
+        n = base64.decode_into(data, data)
+        payload = data[:n]
+
+    Raises ``IndexError`` if the decoded data does not fit in *buffer*.
+
+    """
+    pass
+
+
+class Encoder():
+    """
+=============
+Encoder class
+=============
+
+.. class:: Encoder()
+
+    Create a Base64 encoder for data given in chunks of any size, as read from a :class:`streams.FileStream` or a socket.
+    Only the 0 to 2 bytes that do not complete a group of 3 are kept between chunks, so the whole data is never needed in memory: ::
+
+        enc = base64.Encoder()
+        while True:
+            chunk = f.read(512)
+            if not chunk:
+                break
+            sock.send(enc.update(chunk))
+        sock.send(enc.finish())
+
+    """
+    def __init__(self):
+        self._rest = None
+
+    def update(self, data):
+        """
+.. method:: update(data)
+
+    Encode the chunk *data* (either bytes, bytearray or string). Returns the encoded bytes completed by *data*.
+
+        """
+        if self._rest is not None:
+            data = self._rest+data
+        n = len(data)-len(data)%3
+        if n<len(data):
+            self._rest = data[n:]
+            data = data[:n]
+        else:
+            self._rest = None
+        return standard_b64encode(data)
+
+    def finish(self):
+        """
+.. method:: finish()
+
+    Signal the end of the data. Returns the encoding of the bytes still pending, padding included.
+
+        """
+        if self._rest is None:
+            return b""
+        data = self._rest
+        self._rest = None
+        return standard_b64encode(data)
+
+
+class Decoder():
+    """
+=============
+Decoder class
+=============
+
+.. class:: Decoder()
+
+    Create a Base64 decoder for encoded data given in chunks of any size.
+    Only the 0 to 3 characters that do not complete a group of 4 are kept between chunks.
+    The encoded data must not contain whitespace or line breaks.
+
+    """
+    def __init__(self):
+        self._rest = None
+
+    def update(self, data):
+        """
+.. method:: update(data)
+
+    Decode the chunk *data* (either bytes, bytearray or string). Returns the decoded bytes completed by *data*.
+
+        """
+        if self._rest is not None:
+            data = self._rest+data
+        n = len(data)-len(data)%4
+        if n<len(data):
+            self._rest = data[n:]
+            data = data[:n]
+        else:
+            self._rest = None
+        return standard_b64decode(data)
+
+    def finish(self):
+        """
+.. method:: finish()
+
+    Signal the end of the encoded data. Returns the bytes decoded from the characters still pending, if any.
+
+        """
+        if self._rest is None:
+            return b""
+        data = self._rest
+        self._rest = None
+        return standard_b64decode(data)
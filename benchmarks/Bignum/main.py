@@ -0,0 +1,58 @@
+################################################################################
+# Bignum Benchmark
+#
+# Created by Zerynth Team 2024 CC
+# Authors: G. Baldi
+################################################################################
+
+# Results are CSV lines: bench,case,iterations,total_us,us_per_op
+# preceded by a comment line with target and VM version.
+
+import streams
+import timers
+import vm
+from bignum import bignum as bg
+
+N = 20
+NEXP = 2
+
+streams.serial()
+
+def report(case, n, t0):
+    dt = timers.monotonic_us()-t0
+    print("bignum",case,n,dt,dt//n,sep=",")
+
+sleep(1000)
+info = vm.info()
+print("#",info[1],info[2],sep=",")
+print("bench,case,iterations,total_us,us_per_op")
+
+for bits in (512,1024,2048,4096):
+    a = bg.BigNum("0x"+"E7"*(bits//8))
+    b = bg.BigNum("0x"+"9D"*(bits//8))
+    t = timers.monotonic_us()
+    for i in range(N):
+        a.mul(b)
+    report("mul_"+str(bits),N,t)
+    t = timers.monotonic_us()
+    for i in range(N):
+        a.mul(a)
+    report("sqr_"+str(bits),N,t)
+
+for bits in (1024,2048):
+    # odd modulus, full size exponent: the cost of an rsa private operation
+    m = bg.BigNum("0x"+"C5"*(bits//8-1)+"AB")
+    e = bg.BigNum("0x"+"B3"*(bits//8))
+    x = bg.BigNum("0x"+"5A"*(bits//8))
+    t = timers.monotonic_us()
+    for i in range(NEXP):
+        x.exptmod(e,m)
+    report("exptmod_"+str(bits),NEXP,t)
+    # public exponent
+    e = bg.BigNum(65537)
+    t = timers.monotonic_us()
+    for i in range(N):
+        x.exptmod(e,m)
+    report("exptmod_65537_"+str(bits),N,t)
+
+print("# done")
@@ -0,0 +1,79 @@
+################################################################################
+# Crypto Benchmark
+#
+# Created by Zerynth Team 2024 CC
+# Authors: G. Baldi
+################################################################################
+
+# Results are CSV lines: bench,case,iterations,total_us,us_per_op
+# preceded by a comment line with target and VM version.
+
+import streams
+import timers
+import vm
+from crypto.hash import sha2 as sha2
+from crypto.hash import hmac as hmac
+from crypto.ecc import ecc as ec
+
+N = 100
+NECC = 10
+
+streams.serial()
+
+def report(case, n, t0):
+    dt = timers.monotonic_us()-t0
+    print("crypto",case,n,dt,dt//n,sep=",")
+
+data = bytes([i&0xff for i in range(1024)])
+key = b"0123456789abcdef0123456789abcdef"
+
+# the keys of the Crypto_ECC example
+pb = ec.hex_to_bin("7A181C7D3AD54EC3817CBAF86EA4E003AD492D8569102392A6EFE0C27E471A65553918EA1BAC86A68C78A30E9FE725EA499E14BEA96C3FE85E2267B74385E56B")
+pv = ec.hex_to_bin("6D5BE10E67D479FF99421A8DE030E2B4C5323EE477DA4C17420936CAC49C261E")
+
+sleep(1000)
+info = vm.info()
+print("#",info[1],info[2],sep=",")
+print("bench,case,iterations,total_us,us_per_op")
+
+t = timers.monotonic_us()
+for i in range(N):
+    ss = sha2.SHA2(sha2.SHA256)
+    ss.update(data)
+    ss.digest()
+report("sha256_1k",N,t)
+
+t = timers.monotonic_us()
+for i in range(N):
+    ss = sha2.SHA2(sha2.SHA512)
+    ss.update(data)
+    ss.digest()
+report("sha512_1k",N,t)
+
+t = timers.monotonic_us()
+for i in range(N):
+    hh = hmac.HMAC(key,sha2.SHA2(sha2.SHA256))
+    hh.update(data)
+    hh.digest()
+report("hmac_sha256_1k",N,t)
+
+ss = sha2.SHA2(sha2.SHA256)
+ss.update(data)
+digest = ss.digest()
+
+t = timers.monotonic_us()
+for i in range(NECC):
+    sig = ec.sign(ec.SECP256R1,digest,pv)
+report("ecdsa_p256_sign",NECC,t)
+
+t = timers.monotonic_us()
+for i in range(NECC):
+    ec.sign(ec.SECP256R1,digest,pv,deterministic=sha2.SHA2(sha2.SHA256))
+report("ecdsa_p256_sign_det",NECC,t)
+
+t = timers.monotonic_us()
+for i in range(NECC):
+    ec.verify(ec.SECP256R1,digest,sig,pb)
+report("ecdsa_p256_verify",NECC,t)
+
+print("# done")
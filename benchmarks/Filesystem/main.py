@@ -0,0 +1,72 @@
+################################################################################
+# Filesystem Benchmark
+#
+# Created by Zerynth Team 2024 CC
+# Authors: G. Baldi
+################################################################################
+
+# Results are CSV lines: bench,case,iterations,total_us,us_per_op
+# preceded by a comment line with target and VM version.
+# Throughputs are in the comment lines following each case.
+
+import streams
+import timers
+import vm
+import fatfs
+import os
+
+FILE_SIZE = 256*1024
+CHUNK = 4096
+NRAND = 200
+
+streams.serial()
+
+def report(case, n, t0):
+    dt = timers.monotonic_us()-t0
+    print("fatfs",case,n,dt,dt//n,sep=",")
+    return dt
+
+# mount the SD card as volume 0 through SPI: change driver and pins as needed
+fatfs.mount('0:', {"drv": SPI0, "cs": D25, "clock": 1000000} )
+
+sleep(1000)
+info = vm.info()
+print("#",info[1],info[2],sep=",")
+print("bench,case,iterations,total_us,us_per_op")
+
+buf = bytearray(CHUNK)
+for i in range(CHUNK):
+    buf[i] = i&0xff
+n = FILE_SIZE//CHUNK
+
+ff = os.open("0:bench.bin","wb")
+t = timers.monotonic_us()
+for i in range(n):
+    ff.write(buf)
+ff.close()
+dt = report("seq_write_"+str(CHUNK),n,t)
+print("# seq_write KB/s",FILE_SIZE*1000//dt,sep=",")
+
+ff = os.open("0:bench.bin","rb")
+t = timers.monotonic_us()
+for i in range(n):
+    ff.read(CHUNK)
+dt = report("seq_read_"+str(CHUNK),n,t)
+print("# seq_read KB/s",FILE_SIZE*1000//dt,sep=",")
+
+# random 512 bytes reads, one sector each
+t = timers.monotonic_us()
+for i in range(NRAND):
+    ff.seek(random(0,FILE_SIZE//512-1)*512)
+    ff.read(512)
+report("rand_read_512",NRAND,t)
+ff.close()
+
+t = timers.monotonic_us()
+for i in range(NRAND):
+    ff = os.open("0:bench.bin","rb")
+    ff.close()
+report("open_close",NRAND,t)
+
+os.remove("0:bench.bin")
+print("# done")
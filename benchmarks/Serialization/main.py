@@ -0,0 +1,103 @@
+################################################################################
+# Serialization Benchmark
+#
+# Created by Zerynth Team 2024 CC
+# Authors: G. Baldi
+################################################################################
+
+# Results are CSV lines: bench,case,iterations,total_us,us_per_op
+# preceded by a comment line with target and VM version, so that runs
+# on different boards and releases can be collected and compared.
+
+import streams
+import timers
+import vm
+import json
+import cbor
+import msgpack
+import struct
+import base64
+
+N = 200
+
+streams.serial()
+
+def report(case, n, t0):
+    dt = timers.monotonic_us()-t0
+    print("serialization",case,n,dt,dt//n,sep=",")
+
+# a typical telemetry payload
+obj = {
+    "device":"zerynth-bench",
+    "ts":1700000000,
+    "seq":12345,
+    "ok":True,
+    "temp":23.5,
+    "tags":["a","bb","ccc"],
+    "samples":[i*7 for i in range(16)],
+    "pos":{"lat":43.7167,"lon":10.4,"alt":4}
+}
+raw = bytes([i&0xff for i in range(256)])
+
+sleep(1000)
+info = vm.info()
+print("#",info[1],info[2],sep=",")
+print("bench,case,iterations,total_us,us_per_op")
+
+js = json.dumps(obj)
+t = timers.monotonic_us()
+for i in range(N):
+    json.dumps(obj)
+report("json_dumps",N,t)
+
+t = timers.monotonic_us()
+for i in range(N):
+    json.loads(js)
+report("json_loads",N,t)
+
+cb = cbor.dumps(obj)
+t = timers.monotonic_us()
+for i in range(N):
+    cbor.dumps(obj)
+report("cbor_dumps",N,t)
+
+t = timers.monotonic_us()
+for i in range(N):
+    cbor.loads(cb)
+report("cbor_loads",N,t)
+
+mp = msgpack.pack(obj)
+t = timers.monotonic_us()
+for i in range(N):
+    msgpack.pack(obj)
+report("msgpack_pack",N,t)
+
+t = timers.monotonic_us()
+for i in range(N):
+    msgpack.unpack(mp)
+report("msgpack_unpack",N,t)
+
+st = struct.pack("<IhBf8s",1700000000,-2,255,23.5,b"zerynth!")
+t = timers.monotonic_us()
+for i in range(N):
+    struct.pack("<IhBf8s",1700000000,-2,255,23.5,b"zerynth!")
+report("struct_pack",N,t)
+
+t = timers.monotonic_us()
+for i in range(N):
+    struct.unpack("<IhBf8s",st)
+report("struct_unpack",N,t)
+
+b64 = base64.standard_b64encode(raw)
+t = timers.monotonic_us()
+for i in range(N):
+    base64.standard_b64encode(raw)
+report("base64_encode_256",N,t)
+
+t = timers.monotonic_us()
+for i in range(N):
+    base64.standard_b64decode(b64)
+report("base64_decode_256",N,t)
+
+print("# sizes json",len(js),"cbor",len(cb),"msgpack",len(mp),sep=",")
+print("# done")
@@ -0,0 +1,83 @@
+################################################################################
+# Socket Throughput Benchmark
+#
+# Created by Zerynth Team 2024 CC
+# Authors: G. Baldi
+################################################################################
+
+# Results are CSV lines: bench,case,iterations,total_us,us_per_op
+# preceded by a comment line with target and VM version.
+# Throughputs are in the comment lines following each case.
+#
+# On the host run a TCP server on port PORT that, for each connection, discards
+# what it receives up to a 0x00 byte, then sends back SEND_SIZE bytes and closes.
+
+import streams
+import socket
+import timers
+import vm
+
+# import the wifi interface
+from wireless import wifi
+
+# the wifi module needs a networking driver to be loaded
+# FOR THIS BENCHMARK TO WORK, A NETWORK DRIVER MUST BE SELECTED BELOW
+
+# uncomment the following line to use the espressif esp32 wifi driver
+# from espressif.esp32net import esp32wifi as wifi_driver
+
+# uncomment the following line to use the BCM43362 driver (Particle Photon)
+# from broadcom.bcm43362 import bcm43362 as wifi_driver
+
+HOST = "192.168.1.2"
+PORT = 9999
+SEND_SIZE = 256*1024
+CHUNK = 1024
+
+streams.serial()
+
+def report(case, n, t0):
+    dt = timers.monotonic_us()-t0
+    print("socket",case,n,dt,dt//n,sep=",")
+    return dt
+
+wifi_driver.auto_init()
+# FOR THIS BENCHMARK TO WORK, "Network-Name" AND "Wifi-Password" MUST BE SET
+wifi.link("Network-Name",wifi.WIFI_WPA2,"Wifi-Password")
+
+sleep(1000)
+info = vm.info()
+print("#",info[1],info[2],sep=",")
+print("bench,case,iterations,total_us,us_per_op")
+
+buf = bytearray(CHUNK)
+for i in range(CHUNK):
+    buf[i] = 0x55
+n = SEND_SIZE//CHUNK
+
+t = timers.monotonic_us()
+sock = socket.socket()
+sock.connect((HOST,PORT))
+report("tcp_connect",1,t)
+
+t = timers.monotonic_us()
+for i in range(n):
+    sock.sendall(buf)
+sock.sendall(b"\x00")
+dt = report("tcp_send_"+str(CHUNK),n,t)
+print("# tcp_send KB/s",SEND_SIZE*1000//dt,sep=",")
+
+t = timers.monotonic_us()
+rcv = 0
+k = 0
+while rcv<SEND_SIZE:
+    r = sock.recv_into(buf,CHUNK)
+    if r<=0:
+        break
+    rcv+=r
+    k+=1
+dt = report("tcp_recv_"+str(CHUNK),k,t)
+print("# tcp_recv KB/s",rcv*1000//dt,sep=",")
+sock.close()
+
+print("# done")
@@ -0,0 +1,255 @@
+################################################################################
+# Storage Benchmark
+#
+# Created by Zerynth Team 2024 CC
+# Authors: G. Baldi
+################################################################################
+
+# Results are CSV lines:
+#   bench,case,block,ops,total_us,MB_s,p50_us,p90_us,p99_us,max_us
+# preceded by a comment line with target and VM version. Latency percentiles are
+# per operation (a write, a read, a seek and a read...). Block sizes that don't
+# fit in RAM are skipped with a comment line.
+#
+# fatfs cases go through files; raw cases time fatfs.disk_bench, the driver
+# alone (spi_disk_read/spi_disk_write for SD cards on SPI). Raw writes write
+# back the sectors just read, so the card content does not change.
+# The qspi cases ERASE the flash from QSPI_ADDR to QSPI_ADDR+QSPI_SIZE.
+
+import streams
+import timers
+import vm
+import gc
+import fatfs
+import os
+
+SIZES = [512,1024,2048,4096,8192,16384,32768,65536]
+FILE_SIZE = 1024*1024
+NRAND = 32
+NSYNC = 16
+NDIR = 16
+RAW_FIRST = 8192            # sectors sampled by the raw cases
+RAW_SECTORS = 16384
+QSPI = False                # set to True on boards with a qspi flash
+QSPI_ADDR = 0
+QSPI_SIZE = 256*1024
+
+streams.serial()
+
+samples = [0]*(FILE_SIZE//512)
+
+def sort(a, n):
+    # shell sort: lists have no sort method
+    gap = n//2
+    while gap>0:
+        for i in range(gap,n):
+            x = a[i]
+            j = i
+            while j>=gap and a[j-gap]>x:
+                a[j] = a[j-gap]
+                j-=gap
+            a[j] = x
+        gap//=2
+
+def report(bench, case, block, n, total, nbytes):
+    sort(samples,n)
+    mbs = nbytes/total if total>0 else 0
+    print(bench,case,block,n,total,mbs,samples[(n-1)*50//100],samples[(n-1)*90//100],samples[(n-1)*99//100],samples[n-1],sep=",")
+
+def alloc(size):
+    gc.collect()
+    try:
+        return bytearray(size)
+    except Exception:
+        print("# skipped block",size,sep=",")
+        return None
+
+def bench_files(size, buf):
+    n = FILE_SIZE//size
+    # sequential write, the close (and its sync) included in the total
+    ff = os.open("0:bench.bin","wb")
+    t = timers.monotonic_us()
+    for i in range(n):
+        t0 = timers.monotonic_us()
+        ff.write(buf)
+        samples[i] = timers.monotonic_us()-t0
+    ff.close()
+    report("fatfs","seq_write",size,n,timers.monotonic_us()-t,FILE_SIZE)
+
+    ff = os.open("0:bench.bin","rb")
+    t = timers.monotonic_us()
+    for i in range(n):
+        t0 = timers.monotonic_us()
+        ff.readinto(buf)
+        samples[i] = timers.monotonic_us()-t0
+    report("fatfs","seq_read",size,n,timers.monotonic_us()-t,FILE_SIZE)
+
+    t = timers.monotonic_us()
+    for i in range(NRAND):
+        t0 = timers.monotonic_us()
+        ff.seek(random(0,n-1)*size)
+        ff.readinto(buf)
+        samples[i] = timers.monotonic_us()-t0
+    report("fatfs","rand_read",size,NRAND,timers.monotonic_us()-t,NRAND*size)
+    ff.close()
+
+    # the file is already allocated: random writes don't touch the FAT
+    ff = os.open("0:bench.bin","r+b")
+    t = timers.monotonic_us()
+    for i in range(NRAND):
+        t0 = timers.monotonic_us()
+        ff.seek(random(0,n-1)*size)
+        ff.write(buf)
+        samples[i] = timers.monotonic_us()-t0
+    ff.close()
+    report("fatfs","rand_write",size,NRAND,timers.monotonic_us()-t,NRAND*size)
+
+def bench_raw(size, buf):
+    k = size//512
+    n = RAW_SECTORS//k
+    if n>len(samples):
+        n = len(samples)
+    t = 0
+    for i in range(n):
+        samples[i] = fatfs.disk_bench("0:",RAW_FIRST+i*k,buf)
+        t+=samples[i]
+    report("raw","seq_read",size,n,t,n*size)
+
+    t = 0
+    for i in range(NRAND):
+        samples[i] = fatfs.disk_bench("0:",RAW_FIRST+random(0,RAW_SECTORS//k-1)*k,buf)
+        t+=samples[i]
+    report("raw","rand_read",size,NRAND,t,NRAND*size)
+
+    t = 0
+    for i in range(NRAND):
+        samples[i] = fatfs.disk_bench("0:",RAW_FIRST+random(0,RAW_SECTORS//k-1)*k,buf,True)
+        t+=samples[i]
+    report("raw","rand_rewrite",size,NRAND,t,NRAND*size)
+
+def bench_sync():
+    small = bytearray(16)
+    ff = os.open("0:bench.log","wb")
+    for sync in (False,True):
+        t = timers.monotonic_us()
+        for i in range(NSYNC):
+            t0 = timers.monotonic_us()
+            ff.write(small,sync)
+            samples[i] = timers.monotonic_us()-t0
+        report("fatfs","append16_sync" if sync else "append16",16,NSYNC,timers.monotonic_us()-t,NSYNC*16)
+    ff.close()
+    os.remove("0:bench.log")
+
+def bench_dirs():
+    t = timers.monotonic_us()
+    os.mkdir("0:benchdir")
+    samples[0] = timers.monotonic_us()-t
+    report("dir","mkdir",0,1,samples[0],0)
+
+    t = timers.monotonic_us()
+    for i in range(NDIR):
+        t0 = timers.monotonic_us()
+        os.open("0:benchdir/f"+str(i),"wb").close()
+        samples[i] = timers.monotonic_us()-t0
+    report("dir","create",0,NDIR,timers.monotonic_us()-t,0)
+
+    t = timers.monotonic_us()
+    for i in range(NDIR):
+        t0 = timers.monotonic_us()
+        os.exists("0:benchdir/f"+str(i))
+        samples[i] = timers.monotonic_us()-t0
+    report("dir","exists",0,NDIR,timers.monotonic_us()-t,0)
+
+    t = timers.monotonic_us()
+    os.listdir("0:benchdir")
+    samples[0] = timers.monotonic_us()-t
+    report("dir","listdir_"+str(NDIR),0,1,samples[0],0)
+
+    t = timers.monotonic_us()
+    for i in range(NDIR):
+        t0 = timers.monotonic_us()
+        os.rename("0:benchdir/f"+str(i),"0:benchdir/g"+str(i))
+        samples[i] = timers.monotonic_us()-t0
+    report("dir","rename",0,NDIR,timers.monotonic_us()-t,0)
+
+    t = timers.monotonic_us()
+    for i in range(NDIR):
+        t0 = timers.monotonic_us()
+        os.remove("0:benchdir/g"+str(i))
+        samples[i] = timers.monotonic_us()-t0
+    report("dir","remove",0,NDIR,timers.monotonic_us()-t,0)
+
+    t = timers.monotonic_us()
+    os.rmdir("0:benchdir")
+    samples[0] = timers.monotonic_us()-t
+    report("dir","rmdir",0,1,samples[0],0)
+
+def bench_qspi(flash, size, buf):
+    geo = flash.get_geometry()
+    sector = geo[3]
+    page = geo[4]
+    n = QSPI_SIZE//size
+
+    t = timers.monotonic_us()
+    for i in range(QSPI_SIZE//sector):
+        t0 = timers.monotonic_us()
+        flash.erase_sector(QSPI_ADDR+i*sector)
+        samples[i] = timers.monotonic_us()-t0
+    report("qspi","erase_sector",sector,QSPI_SIZE//sector,timers.monotonic_us()-t,QSPI_SIZE)
+
+    # writes are split in pages by the driver
+    t = timers.monotonic_us()
+    for i in range(n):
+        t0 = timers.monotonic_us()
+        flash.write_data(QSPI_ADDR+i*size,buf)
+        samples[i] = timers.monotonic_us()-t0
+    report("qspi","seq_write",size,n,timers.monotonic_us()-t,QSPI_SIZE)
+
+    t = timers.monotonic_us()
+    for i in range(n):
+        t0 = timers.monotonic_us()
+        flash.read_into(QSPI_ADDR+i*size,buf)
+        samples[i] = timers.monotonic_us()-t0
+    report("qspi","seq_read",size,n,timers.monotonic_us()-t,QSPI_SIZE)
+
+    t = timers.monotonic_us()
+    for i in range(NRAND):
+        t0 = timers.monotonic_us()
+        flash.read_into(QSPI_ADDR+random(0,n-1)*size,buf)
+        samples[i] = timers.monotonic_us()-t0
+    report("qspi","rand_read",size,NRAND,timers.monotonic_us()-t,NRAND*size)
+
+
+# mount the SD card as volume 0 through SPI: change driver, pins and clock as needed
+fatfs.mount('0:', {"drv": SPI0, "cs": D25, "clock": 20000000} )
+
+sleep(1000)
+info = vm.info()
+print("#",info[1],info[2],sep=",")
+print("bench,case,block,ops,total_us,MB_s,p50_us,p90_us,p99_us,max_us")
+
+for size in SIZES:
+    buf = None
+    buf = alloc(size)
+    if buf is None:
+        continue
+    for i in range(size):
+        buf[i] = i&0xff
+    bench_files(size,buf)
+    bench_raw(size,buf)
+os.remove("0:bench.bin")
+
+bench_sync()
+bench_dirs()
+
+if QSPI:
+    import qspiflash
+    flash = qspiflash.QSpiFlash()
+    for size in SIZES:
+        buf = None
+        buf = alloc(size)
+        if buf is None:
+            continue
+        bench_qspi(flash,size,buf)
+
+print("# done")
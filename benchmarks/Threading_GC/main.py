@@ -0,0 +1,85 @@
+################################################################################
+# Threading and GC Benchmark
+#
+# Created by Zerynth Team 2024 CC
+# Authors: G. Baldi
+################################################################################
+
+# Results are CSV lines: bench,case,iterations,total_us,us_per_op
+# preceded by a comment line with target and VM version.
+# GC pauses are reported with iterations set to the number of collections,
+# total_us to the longest pause and us_per_op to the last one.
+
+import streams
+import timers
+import vm
+import gc
+import threading
+import queue
+
+N = 1000
+
+streams.serial()
+
+def report(case, n, t0):
+    dt = timers.monotonic_us()-t0
+    print("threading",case,n,dt,dt//n,sep=",")
+
+sleep(1000)
+info = vm.info()
+print("#",info[1],info[2],sep=",")
+print("bench,case,iterations,total_us,us_per_op")
+
+# uncontended primitives, no thread switch
+q = queue.Queue(N)
+t = timers.monotonic_us()
+for i in range(N):
+    q.put(i)
+report("queue_put",N,t)
+
+t = timers.monotonic_us()
+for i in range(N):
+    q.get()
+report("queue_get",N,t)
+
+lock = threading.Lock()
+t = timers.monotonic_us()
+for i in range(N):
+    lock.acquire()
+    lock.release()
+report("lock_acquire_release",N,t)
+
+# handoff between two threads: each item is a put, a switch and a get
+qin = queue.Queue(1)
+qout = queue.Queue(1)
+
+def echo():
+    while True:
+        x = qin.get()
+        qout.put(x)
+        if x<0:
+            break
+
+thread(echo)
+sleep(10)
+t = timers.monotonic_us()
+for i in range(N):
+    qin.put(i)
+    qout.get()
+report("queue_pingpong",N,t)
+qin.put(-1)
+qout.get()
+
+# gc pauses under allocation load: keep half of the objects alive
+gc.collect()
+keep = [None]*64
+t = timers.monotonic_us()
+for i in range(N):
+    keep[i%64] = [i]*(i%32) if i%2 else bytearray(i%256)
+    if i%100==99:
+        gc.collect()
+report("alloc_mix",N,t)
+p = gc.pauses()
+print("gc","collect_pauses",p[3],p[1],p[0],sep=",")
+
+print("# done")
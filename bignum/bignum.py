@@ -27,6 +27,8 @@ modified to be compatible with Zerynth memory manager.
     "csrc/bn_mp_add_d.c",
     "csrc/bn_mp_sub_d.c",
     "csrc/bn_mp_read_radix_n.c",
+    "csrc/bn_mp_set_long_long.c",
+    "csrc/bn_mp_import.c",
     "csrc/zbn_ifc.c",
     ],[],[])
 def _bn_new(val):
@@ -61,7 +63,7 @@ def _bn_tobase(num,base):
     "csrc/bn_s_mp_add.c",
     "csrc/bn_s_mp_sub.c"
     ],[],[])
-def _bn_add(a,b):
+def _bn_add(a,b,dst):
     pass
 
 @c_native("_zbn_sub",[
@@ -72,7 +74,7 @@ def _bn_add(a,b):
     "csrc/bn_s_mp_add.c",
     "csrc/bn_s_mp_sub.c"
     ],[],[])
-def _bn_sub(a,b):
+def _bn_sub(a,b,dst):
     pass
 
 @c_native("_zbn_mul",[
@@ -92,7 +94,7 @@ def _bn_sub(a,b):
     "csrc/bn_s_mp_add.c",
     "csrc/bn_s_mp_sub.c"
     ],[],[])
-def _bn_mul(a,b):
+def _bn_mul(a,b,dst):
     pass
 
 @c_native("_zbn_div",[
@@ -123,6 +125,276 @@ def _bn_div(a,b):
 def _bn_cmp(a,b):
     pass
 
+@c_native("_zbn_mod",[
+    "csrc/bn_mp_mod.c",
+    "csrc/bn_mp_div.c",
+    "csrc/bn_mp_init_size.c",
+    "csrc/bn_mp_clear.c",
+    "csrc/bn_mp_exch.c",
+    "csrc/bn_mp_add.c",
+    "csrc/bn_s_mp_mul_digs.c",
+    "csrc/bn_fast_s_mp_mul_digs.c",
+    "csrc/bn_mp_count_bits.c",
+    "csrc/bn_mp_init_multi.c",
+    "csrc/bn_mp_mul_d.c",
+    "csrc/bn_mp_clear_multi.c",
+    "csrc/bn_mp_div_2.c",
+    "csrc/bn_mp_mul_2.c",
+    "csrc/bn_mp_clamp.c",
+    "csrc/bn_mp_cmp.c",
+    "csrc/bn_mp_cmp_mag.c",
+    "csrc/bn_mp_grow.c",
+    "csrc/bn_s_mp_add.c",
+    "csrc/bn_s_mp_sub.c"
+    ],[],[])
+def _bn_mod(a,b,dst):
+    pass
+
+@c_native("_zbn_exptmod",[
+    "csrc/bn_mp_exptmod.c",
+    "csrc/bn_mp_exptmod_fast.c",
+    "csrc/bn_s_mp_exptmod.c",
+    "csrc/bn_mp_abs.c",
+    "csrc/bn_mp_mulmod.c",
+    "csrc/bn_mp_sqr.c",
+    "csrc/bn_mp_karatsuba_sqr.c",
+    "csrc/bn_mp_toom_sqr.c",
+    "csrc/bn_fast_s_mp_sqr.c",
+    "csrc/bn_s_mp_sqr.c",
+    "csrc/bn_mp_montgomery_setup.c",
+    "csrc/bn_mp_montgomery_reduce.c",
+    "csrc/bn_fast_mp_montgomery_reduce.c",
+    "csrc/bn_mp_montgomery_calc_normalization.c",
+    "csrc/bn_mp_dr_is_modulus.c",
+    "csrc/bn_mp_dr_setup.c",
+    "csrc/bn_mp_dr_reduce.c",
+    "csrc/bn_mp_reduce.c",
+    "csrc/bn_mp_reduce_setup.c",
+    "csrc/bn_mp_reduce_is_2k.c",
+    "csrc/bn_mp_reduce_is_2k_l.c",
+    "csrc/bn_mp_reduce_2k.c",
+    "csrc/bn_mp_reduce_2k_l.c",
+    "csrc/bn_mp_reduce_2k_setup.c",
+    "csrc/bn_mp_reduce_2k_setup_l.c",
+    "csrc/bn_s_mp_mul_high_digs.c",
+    "csrc/bn_fast_s_mp_mul_high_digs.c",
+    "csrc/bn_mp_2expt.c",
+    "csrc/bn_mp_mod_2d.c",
+    "csrc/bn_mp_div_2d.c",
+    "csrc/bn_mp_lshd.c",
+    "csrc/bn_mp_rshd.c",
+    "csrc/bn_mp_set.c",
+    "csrc/bn_mp_zero.c",
+    "csrc/bn_mp_copy.c",
+    "csrc/bn_mp_init.c",
+    "csrc/bn_mp_init_copy.c",
+    "csrc/bn_mp_cmp_d.c",
+    "csrc/bn_mp_sub.c",
+    "csrc/bn_mp_mul.c",
+    "csrc/bn_mp_karatsuba_mul.c",
+    "csrc/bn_mp_toom_mul.c",
+    "csrc/bn_mp_div_3.c",
+    "csrc/bn_mp_mul_2d.c"
+    ],[],[])
+def _bn_exptmod(a,e,m,dst):
+    pass
+
+@c_native("_zbn_invmod",[
+    "csrc/bn_mp_invmod.c",
+    "csrc/bn_fast_mp_invmod.c",
+    "csrc/bn_mp_invmod_slow.c",
+    "csrc/bn_mp_cmp_d.c",
+    "csrc/bn_mp_set.c",
+    "csrc/bn_mp_sub.c",
+    "csrc/bn_mp_copy.c",
+    "csrc/bn_mp_zero.c",
+    "csrc/bn_mp_div.c",
+    "csrc/bn_mp_init_size.c",
+    "csrc/bn_mp_clear.c",
+    "csrc/bn_mp_exch.c",
+    "csrc/bn_mp_add.c",
+    "csrc/bn_s_mp_mul_digs.c",
+    "csrc/bn_fast_s_mp_mul_digs.c",
+    "csrc/bn_mp_count_bits.c",
+    "csrc/bn_mp_init_multi.c",
+    "csrc/bn_mp_mul_d.c",
+    "csrc/bn_mp_clear_multi.c",
+    "csrc/bn_mp_div_2.c",
+    "csrc/bn_mp_mul_2.c",
+    "csrc/bn_mp_clamp.c",
+    "csrc/bn_mp_cmp.c",
+    "csrc/bn_mp_cmp_mag.c",
+    "csrc/bn_mp_grow.c",
+    "csrc/bn_s_mp_add.c",
+    "csrc/bn_s_mp_sub.c"
+    ],[],[])
+def _bn_invmod(a,m,dst):
+    pass
+
+@c_native("_zbn_gcd",[
+    "csrc/bn_mp_gcd.c",
+    "csrc/bn_mp_abs.c",
+    "csrc/bn_mp_init_copy.c",
+    "csrc/bn_mp_cnt_lsb.c",
+    "csrc/bn_mp_div_2d.c",
+    "csrc/bn_mp_mul_2d.c",
+    "csrc/bn_mp_exch.c",
+    "csrc/bn_mp_clear.c",
+    "csrc/bn_mp_mod_2d.c",
+    "csrc/bn_mp_rshd.c",
+    "csrc/bn_mp_lshd.c",
+    "csrc/bn_mp_copy.c",
+    "csrc/bn_mp_zero.c",
+    "csrc/bn_mp_cmp_mag.c",
+    "csrc/bn_s_mp_sub.c",
+    "csrc/bn_mp_grow.c",
+    "csrc/bn_mp_clamp.c"
+    ],[],[])
+def _bn_gcd(a,b,dst):
+    pass
+
+@c_native("_zbn_tobytes",[
+    "csrc/bn_mp_export.c",
+    "csrc/bn_mp_init_copy.c",
+    "csrc/bn_mp_count_bits.c",
+    "csrc/bn_mp_div_2d.c",
+    "csrc/bn_mp_mod_2d.c",
+    "csrc/bn_mp_rshd.c",
+    "csrc/bn_mp_copy.c",
+    "csrc/bn_mp_zero.c",
+    "csrc/bn_mp_clear.c",
+    "csrc/bn_mp_grow.c",
+    "csrc/bn_mp_clamp.c"
+    ],[],[])
+def _bn_tobytes(num,size):
+    pass
+
+@c_native("_zbn_mont_new",[
+    "csrc/bn_mp_montgomery_setup.c",
+    "csrc/bn_mp_montgomery_reduce.c",
+    "csrc/bn_fast_mp_montgomery_reduce.c",
+    "csrc/bn_mp_montgomery_calc_normalization.c",
+    "csrc/bn_mp_sqrmod.c",
+    "csrc/bn_mp_sqr.c",
+    "csrc/bn_mp_karatsuba_sqr.c",
+    "csrc/bn_mp_toom_sqr.c",
+    "csrc/bn_fast_s_mp_sqr.c",
+    "csrc/bn_s_mp_sqr.c",
+    "csrc/bn_mp_mul.c",
+    "csrc/bn_mp_karatsuba_mul.c",
+    "csrc/bn_mp_toom_mul.c",
+    "csrc/bn_mp_mod.c",
+    "csrc/bn_mp_2expt.c",
+    "csrc/bn_mp_mul_2.c",
+    "csrc/bn_mp_cmp_d.c",
+    "csrc/bn_mp_count_bits.c",
+    "csrc/bn_mp_copy.c",
+    "csrc/bn_mp_exch.c",
+    "csrc/bn_mp_init.c",
+    "csrc/bn_mp_clear.c",
+    "csrc/bn_mp_rshd.c",
+    "csrc/bn_mp_grow.c",
+    "csrc/bn_mp_clamp.c",
+    "csrc/bn_mp_cmp_mag.c",
+    "csrc/bn_s_mp_sub.c"
+    ],[],[])
+def _bn_mont_new(n):
+    pass
+
+@c_native("_zbn_mont_exptmod",[
+    "csrc/bn_mp_montgomery_setup.c",
+    "csrc/bn_mp_montgomery_reduce.c",
+    "csrc/bn_fast_mp_montgomery_reduce.c"
+    ],[],[])
+def _bn_mont_exptmod(ctx,a,e,dst):
+    pass
+
+@c_native("_zbn_mont_mulmod",[
+    "csrc/bn_mp_montgomery_setup.c",
+    "csrc/bn_mp_montgomery_reduce.c",
+    "csrc/bn_fast_mp_montgomery_reduce.c"
+    ],[],[])
+def _bn_mont_mulmod(ctx,a,b,dst):
+    pass
+
+
+@c_native("_zbn_cutoffs",[],[],[])
+def _bn_cutoffs(cutoffs):
+    pass
+
+@c_native("_zbn_bench",[
+    "csrc/bn_mp_init_size.c",
+    "csrc/bn_mp_mul.c",
+    "csrc/bn_mp_sqr.c",
+    "csrc/bn_mp_karatsuba_mul.c",
+    "csrc/bn_mp_karatsuba_sqr.c",
+    "csrc/bn_mp_toom_mul.c",
+    "csrc/bn_mp_toom_sqr.c",
+    "csrc/bn_s_mp_mul_digs.c",
+    "csrc/bn_fast_s_mp_mul_digs.c",
+    "csrc/bn_s_mp_sqr.c",
+    "csrc/bn_fast_s_mp_sqr.c"
+    ],[],[])
+def _bn_bench(digits,reps,sqr):
+    pass
+
+
+def get_cutoffs():
+    """
+.. function:: get_cutoffs()
+
+    Return a tuple with the current multiplication cutoffs (*karatsuba_mul*, *karatsuba_sqr*, *toom_mul*, *toom_sqr*), expressed in digits:
+    numbers with at least as many digits are multiplied (or squared) with the Karatsuba or Toom-Cook algorithms instead of the schoolbook one.
+    Defaults are 80, 120, 350 and 400, and can be changed at build time with the ``ZERYNTH_BIGNUM_KARATSUBA_MUL_CUTOFF``,
+    ``ZERYNTH_BIGNUM_KARATSUBA_SQR_CUTOFF``, ``ZERYNTH_BIGNUM_TOOM_MUL_CUTOFF`` and ``ZERYNTH_BIGNUM_TOOM_SQR_CUTOFF`` options.
+    """
+    return _bn_cutoffs(None)
+
+def set_cutoffs(karatsuba_mul,karatsuba_sqr,toom_mul,toom_sqr):
+    """
+.. function:: set_cutoffs(karatsuba_mul,karatsuba_sqr,toom_mul,toom_sqr)
+
+    Set the multiplication cutoffs described in :func:`get_cutoffs` and return the previous ones.
+    """
+    return _bn_cutoffs((karatsuba_mul,karatsuba_sqr,toom_mul,toom_sqr))
+
+_CUTOFF_OFF = 0x7fff
+
+def _crossover(cut,slot,sqr,start,max_digits,step,reps):
+    digits = start
+    while digits<=max_digits:
+        cut[slot] = _CUTOFF_OFF
+        _bn_cutoffs(tuple(cut))
+        t_off = _bn_bench(digits,reps,sqr)
+        cut[slot] = digits
+        _bn_cutoffs(tuple(cut))
+        t_on = _bn_bench(digits,reps,sqr)
+        if t_on<t_off:
+            return digits
+        digits+=step
+    return _CUTOFF_OFF
+
+def calibrate(reps=50,max_digits=512,step=8):
+    """
+.. function:: calibrate(reps=50,max_digits=512,step=8)
+
+    Measure on the running target the smallest sizes, in digits, at which the Karatsuba and Toom-Cook algorithms are faster,
+    timing *reps* operations for every size from *step* to *max_digits* in increments of *step*.
+    The measured cutoffs are applied as in :func:`set_cutoffs` and returned in the format of :func:`get_cutoffs`:
+    they can be fixed at build time with the ``ZERYNTH_BIGNUM_*_CUTOFF`` options to skip the calibration, which can take minutes.
+
+    An algorithm never faster up to *max_digits* gets a cutoff of 32767.
+    """
+    cut = [_CUTOFF_OFF]*4
+    # Karatsuba against schoolbook, then Toom-Cook against Karatsuba
+    cut[0] = _crossover(cut,0,0,step,max_digits,step,reps)
+    cut[1] = _crossover(cut,1,1,step,max_digits,step,reps)
+    cut[2] = _crossover(cut,2,0,min(cut[0],max_digits),max_digits,step,reps)
+    cut[3] = _crossover(cut,3,1,min(cut[1],max_digits),max_digits,step,reps)
+    _bn_cutoffs(tuple(cut))
+    return tuple(cut)
+
+
 
 class BigNum():
     """
@@ -133,8 +405,8 @@ The Bignum class
 .. class:: BigNum(val=0)
 
        This class represents a big integer number with arbitrary precision. A big number instance can be initialized with
-       a value *val*. *val* can be a standard integer or a string representing the number. The string is accepted if it is in base 16
-       prefixed with  '0x' or in base 10. Signed number are accepted. At the moment, bytearray or bytes representation are not supported.
+       a value *val*. *val* can be a standard integer, a string representing the number or a bytes/bytearray. The string is accepted if it is in base 16
+       prefixed with  '0x' or in base 10. Signed number are accepted. Bytes and bytearrays are interpreted as unsigned big endian numbers.
 
        BigNum instances are compatible with streams and, if printed, are automatically converted to the base 10 string format.
 
@@ -153,6 +425,9 @@ The Bignum class
                 big.iadd(one)
                 sleep(1000)
 
+       Methods starting with :samp:`i` store the result in the current instance reusing its memory, instead of allocating a new big number:
+       they should be preferred in loops and in modular arithmetic, where temporaries are frequent.
+
 
 
 
@@ -168,7 +443,7 @@ The Bignum class
         Return a new big number instance equal to the addition of the current instance and *b*.
         """
         bg = BigNum(None)
-        bg.num = _bn_add(self.num,b.num)
+        bg.num = _bn_add(self.num,b.num,None)
         return bg
     
     def iadd(self,b):
@@ -177,7 +452,7 @@ The Bignum class
 
         Add to the current instance the big number *b*. Return :samp:`None`
         """
-        self.num = _bn_add(self.num,b.num)
+        _bn_add(self.num,b.num,self.num)
 
     def sub(self,b):
         """
@@ -186,7 +461,7 @@ The Bignum class
         Return a new big number instance equal to the difference of the current instance and *b*.
         """
         bg = BigNum(None)
-        bg.num = _bn_sub(self.num,b.num)
+        bg.num = _bn_sub(self.num,b.num,None)
         return bg
     
     def isub(self,b):
@@ -195,7 +470,7 @@ The Bignum class
 
         Subtracts to the current instance the big number *b*. Return :samp:`None`
         """
-        self.num = _bn_sub(self.num,b.num)
+        _bn_sub(self.num,b.num,self.num)
 
     def mul(self,b):
         """
@@ -204,7 +479,7 @@ The Bignum class
         Return a new big number instance equal to the multiplication of the current instance and *b*.
         """
         bg = BigNum(None)
-        bg.num = _bn_mul(self.num,b.num)
+        bg.num = _bn_mul(self.num,b.num,None)
         return bg
     
     def imul(self,b):
@@ -213,7 +488,7 @@ The Bignum class
 
         Multiply the current instance for the big number *b*. Return :samp:`None`
         """
-        self.num = _bn_mul(self.num,b.num)
+        _bn_mul(self.num,b.num,self.num)
 
     def div(self,b):
         """
@@ -238,9 +513,10 @@ The Bignum class
 .. method:: mod(b)
 
         Return a new big number instance equal to the remainder of the division of the current instance by *b*.
+        The remainder has the same sign of *b*.
         """
         bg = BigNum(None)
-        q, bg.num = _bn_div(self.num,b.num)
+        bg.num = _bn_mod(self.num,b.num,None)
         return bg
     
     def imod(self,b):
@@ -249,7 +525,56 @@ The Bignum class
 
         Set the current instance to the remainder of the division by *b*. Return :samp:`None`
         """
-        q, self.num = _bn_div(self.num,b.num)
+        _bn_mod(self.num,b.num,self.num)
+
+    def exptmod(self,e,m):
+        """
+.. method:: exptmod(e,m)
+
+        Return a new big number instance equal to the current instance raised to the big number *e*, modulo the big number *m*.
+        If *e* is negative, the modular inverse of the current instance is raised to -*e*.
+        Raise :samp:`ValueError` if *m* is not positive or if the inverse does not exist.
+        """
+        bg = BigNum(None)
+        bg.num = _bn_exptmod(self.num,e.num,m.num,None)
+        return bg
+
+    def iexptmod(self,e,m):
+        """
+.. method:: iexptmod(e,m)
+
+        Raise the current instance to the big number *e*, modulo the big number *m*. Return :samp:`None`
+        """
+        _bn_exptmod(self.num,e.num,m.num,self.num)
+
+    def invmod(self,m):
+        """
+.. method:: invmod(m)
+
+        Return a new big number instance equal to the inverse of the current instance modulo the big number *m*.
+        Raise :samp:`ValueError` if the current instance and *m* are not coprime.
+        """
+        bg = BigNum(None)
+        bg.num = _bn_invmod(self.num,m.num,None)
+        return bg
+
+    def iinvmod(self,m):
+        """
+.. method:: iinvmod(m)
+
+        Set the current instance to its inverse modulo the big number *m*. Return :samp:`None`
+        """
+        _bn_invmod(self.num,m.num,self.num)
+
+    def gcd(self,b):
+        """
+.. method:: gcd(b)
+
+        Return a new big number instance equal to the greatest common divisor of the current instance and *b*.
+        """
+        bg = BigNum(None)
+        bg.num = _bn_gcd(self.num,b.num,None)
+        return bg
 
     def divmod(self,b):
         """
@@ -346,8 +671,75 @@ The Bignum class
         """
         return _bn_tobase(self.num,base)
 
+    def to_bytes(self,size=0):
+        """
+.. method:: to_bytes(size=0)
+
+        Return the absolute value of the big number as unsigned big endian bytes. If *size* is given, the result is left padded with zeros
+        to *size* bytes and :samp:`OverflowError` is raised if the number does not fit; otherwise the minimum number of bytes is used.
+        """
+        return _bn_tobytes(self.num,size)
+
     def __str__(self):
         return self.to_base(10)
 
 
 
+class ModContext():
+    """
+=====================
+The ModContext class
+=====================
+
+.. class:: ModContext(n)
+
+       This class caches the Montgomery parameters of the odd big number modulus *n* (the digit inverse rho, R mod *n* and R^2 mod *n*),
+       so that repeated modular operations with the same modulus, as in RSA verification or Diffie-Hellman, do not recompute them.
+       Raise :samp:`ValueError` if *n* is even or less than 2.
+
+       Every method accepts an optional big number *dst*: if given, the result is stored in *dst* and *dst* is returned,
+       otherwise a new big number instance is returned. ::
+
+            ctx = bg.ModContext(bg.BigNum(modulus_bytes))
+            e = bg.BigNum(65537)
+            for sig in signatures:
+                m = ctx.exptmod(bg.BigNum(sig),e)
+
+    """
+    def __init__(self,n):
+        self.n = n
+        self.ctx = _bn_mont_new(n.num)
+
+    def exptmod(self,a,e,dst=None):
+        """
+.. method:: exptmod(a,e,dst=None)
+
+        Return *a* raised to the non negative big number *e*, modulo *n*.
+        """
+        if dst is None:
+            dst = BigNum(None)
+            dst.num = _bn_mont_exptmod(self.ctx,a.num,e.num,None)
+        else:
+            _bn_mont_exptmod(self.ctx,a.num,e.num,dst.num)
+        return dst
+
+    def mulmod(self,a,b,dst=None):
+        """
+.. method:: mulmod(a,b,dst=None)
+
+        Return the product of *a* and *b*, modulo *n*.
+        """
+        if dst is None:
+            dst = BigNum(None)
+            dst.num = _bn_mont_mulmod(self.ctx,a.num,b.num,None)
+        else:
+            _bn_mont_mulmod(self.ctx,a.num,b.num,dst.num)
+        return dst
+
+    def sqrmod(self,a,dst=None):
+        """
+.. method:: sqrmod(a,dst=None)
+
+        Return the square of *a*, modulo *n*.
+        """
+        return self.mulmod(a,a,dst)
@@ -23,6 +23,12 @@ int mp_grow (mp_int * a, int size)
 
   /* if the alloc size is smaller alloc more ram */
   if (a->alloc < size) {
+    /* grow geometrically: chains of operations on the same number would
+     * otherwise reallocate and copy the digits at every small growth */
+    if (size < (a->alloc + (a->alloc >> 1))) {
+      size = a->alloc + (a->alloc >> 1);
+    }
+
     /* ensure there are always at least MP_PREC digits extra on top */
     size += (MP_PREC * 2) - (size % MP_PREC);
 
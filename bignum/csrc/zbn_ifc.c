@@ -5,11 +5,26 @@
 char mp_s_rmap[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz+/";
 
 
-int     KARATSUBA_MUL_CUTOFF = 80,      /* Min. number of digits before Karatsuba multiplication is used. */
-        KARATSUBA_SQR_CUTOFF = 120,     /* Min. number of digits before Karatsuba squaring is used. */
+//defaults for the multiplication cutoffs: bignum.calibrate() measures the best values
+//for a target, that can be fixed at build time or applied with bignum.set_cutoffs()
+#ifndef ZERYNTH_BIGNUM_KARATSUBA_MUL_CUTOFF
+#define ZERYNTH_BIGNUM_KARATSUBA_MUL_CUTOFF 80
+#endif
+#ifndef ZERYNTH_BIGNUM_KARATSUBA_SQR_CUTOFF
+#define ZERYNTH_BIGNUM_KARATSUBA_SQR_CUTOFF 120
+#endif
+#ifndef ZERYNTH_BIGNUM_TOOM_MUL_CUTOFF
+#define ZERYNTH_BIGNUM_TOOM_MUL_CUTOFF 350
+#endif
+#ifndef ZERYNTH_BIGNUM_TOOM_SQR_CUTOFF
+#define ZERYNTH_BIGNUM_TOOM_SQR_CUTOFF 400
+#endif
 
-        TOOM_MUL_CUTOFF      = 350,      /* no optimal values of these are known yet so set em high */
-        TOOM_SQR_CUTOFF      = 400;
+int     KARATSUBA_MUL_CUTOFF = ZERYNTH_BIGNUM_KARATSUBA_MUL_CUTOFF,      /* Min. number of digits before Karatsuba multiplication is used. */
+        KARATSUBA_SQR_CUTOFF = ZERYNTH_BIGNUM_KARATSUBA_SQR_CUTOFF,      /* Min. number of digits before Karatsuba squaring is used. */
+
+        TOOM_MUL_CUTOFF      = ZERYNTH_BIGNUM_TOOM_MUL_CUTOFF,           /* no optimal values of these are known yet so set em high */
+        TOOM_SQR_CUTOFF      = ZERYNTH_BIGNUM_TOOM_SQR_CUTOFF;
 
 
 //wrapper for mp_int: enable garbage collection compatibilty
@@ -80,7 +95,10 @@ C_NATIVE(_zbn_new){
     if (tt==PSMALLINT){
         mp_init_set_int(&zbn,PSMALLINT_VALUE(obj));
     } else if (tt==PINTEGER){
-        //
+        int64_t v = INTEGER_VALUE(obj);
+        mp_init(&zbn);
+        mp_set_long_long(&zbn,(v<0) ? -(uint64_t)v:(uint64_t)v);
+        if (v<0) zbn.sign = MP_NEG;
     } else if (tt==PSTRING){
         uint8_t *ss = PSEQUENCE_BYTES(obj);
         uint32_t sl = PSEQUENCE_ELEMENTS(obj);
@@ -95,7 +113,9 @@ C_NATIVE(_zbn_new){
         }
 
     } else if (tt==PBYTES || tt==PBYTEARRAY){
-        //
+        //unsigned big endian
+        mp_init(&zbn);
+        if (mp_import(&zbn,PSEQUENCE_ELEMENTS(obj),1,1,1,0,PSEQUENCE_BYTES(obj))!=MP_OKAY) return ERR_VALUE_EXC;
     } else {
         return ERR_VALUE_EXC; 
     }
@@ -105,7 +125,20 @@ C_NATIVE(_zbn_new){
 }
 
 #define GET_ZBN(o) ((mp_int*)_PIS_BYTES((PTUPLE_ITEM((o),0))))
-#define DIGIT_SIZE 2
+#define DIGIT_SIZE sizeof(mp_digit)
+
+//operations accept a destination number as last argument:
+//if None, the result is stored in a new number, otherwise dst is overwritten
+//and its abuf slot refreshed, avoiding the allocation of a new tuple
+#define GET_DST(o,tmp) (((o)==MAKE_NONE()) ? (tmp):GET_ZBN(o))
+#define INIT_DST(o,tmp) if((o)==MAKE_NONE()) mp_init(tmp)
+#define DST_RES(o,c) zbn_to_res(((o)==MAKE_NONE()) ? NULL:(PTuple*)(o),(c))
+
+int zbn_err(int err){
+    if (err==MP_OKAY) return ERR_OK;
+    if (err==MP_VAL) return ERR_VALUE_EXC;
+    return ERR_RUNTIME_EXC;
+}
 C_NATIVE(_zbn_tobase){
     NATIVE_UNWARN();
     PObject *num = args[0];
@@ -141,16 +174,18 @@ C_NATIVE(_zbn_add){
     NATIVE_UNWARN();
     PObject *pa = args[0];
     PObject *pb = args[1];
+    PObject *pc = args[2];
     mp_int *a = GET_ZBN(pa);
     mp_int *b = GET_ZBN(pb);
-    mp_int c;
+    mp_int t;
+    mp_int *c = GET_DST(pc,&t);
 
     RELEASE_GIL();
-    mp_init(&c);
-    mp_add(a,b,&c);
+    INIT_DST(pc,c);
+    mp_add(a,b,c);
     ACQUIRE_GIL();
     
-    *res = zbn_to_res(NULL,&c);
+    *res = DST_RES(pc,c);
     return ERR_OK;
 }
 
@@ -158,16 +193,18 @@ C_NATIVE(_zbn_sub){
     NATIVE_UNWARN();
     PObject *pa = args[0];
     PObject *pb = args[1];
+    PObject *pc = args[2];
     mp_int *a = GET_ZBN(pa);
     mp_int *b = GET_ZBN(pb);
-    mp_int c;
+    mp_int t;
+    mp_int *c = GET_DST(pc,&t);
 
     RELEASE_GIL();
-    mp_init(&c);
-    mp_sub(a,b,&c);
+    INIT_DST(pc,c);
+    mp_sub(a,b,c);
     ACQUIRE_GIL();
     
-    *res = zbn_to_res(NULL,&c);
+    *res = DST_RES(pc,c);
     return ERR_OK;
 }
 
@@ -175,16 +212,18 @@ C_NATIVE(_zbn_mul){
     NATIVE_UNWARN();
     PObject *pa = args[0];
     PObject *pb = args[1];
+    PObject *pc = args[2];
     mp_int *a = GET_ZBN(pa);
     mp_int *b = GET_ZBN(pb);
-    mp_int c;
+    mp_int t;
+    mp_int *c = GET_DST(pc,&t);
 
     RELEASE_GIL();
-    mp_init(&c);
-    mp_mul(a,b,&c);
+    INIT_DST(pc,c);
+    mp_mul(a,b,c);
     ACQUIRE_GIL();
     
-    *res = zbn_to_res(NULL,&c);
+    *res = DST_RES(pc,c);
     return ERR_OK;
 }
 
@@ -232,4 +271,347 @@ C_NATIVE(_zbn_cmp){
     return ERR_OK;
 }
 
+C_NATIVE(_zbn_mod){
+    NATIVE_UNWARN();
+    PObject *pa = args[0];
+    PObject *pb = args[1];
+    PObject *pc = args[2];
+    mp_int *a = GET_ZBN(pa);
+    mp_int *b = GET_ZBN(pb);
+    mp_int t;
+    mp_int *c = GET_DST(pc,&t);
+    int err;
+
+    RELEASE_GIL();
+    INIT_DST(pc,c);
+    err = mp_mod(a,b,c);
+    if (err==MP_VAL) err = ERR_ZERODIV_EXC;
+    else err = zbn_err(err);
+    ACQUIRE_GIL();
+
+    if(err!=ERR_OK) return err;
+    *res = DST_RES(pc,c);
+    return ERR_OK;
+}
+
+C_NATIVE(_zbn_exptmod){
+    NATIVE_UNWARN();
+    PObject *pa = args[0];
+    PObject *pe = args[1];
+    PObject *pm = args[2];
+    PObject *pc = args[3];
+    mp_int *a = GET_ZBN(pa);
+    mp_int *e = GET_ZBN(pe);
+    mp_int *m = GET_ZBN(pm);
+    mp_int t;
+    mp_int *c = GET_DST(pc,&t);
+    int err;
+
+    RELEASE_GIL();
+    INIT_DST(pc,c);
+    //fails with MP_VAL for non positive moduli or non invertible base with negative exponent
+    err = zbn_err(mp_exptmod(a,e,m,c));
+    ACQUIRE_GIL();
+
+    if(err!=ERR_OK) return err;
+    *res = DST_RES(pc,c);
+    return ERR_OK;
+}
+
+C_NATIVE(_zbn_invmod){
+    NATIVE_UNWARN();
+    PObject *pa = args[0];
+    PObject *pm = args[1];
+    PObject *pc = args[2];
+    mp_int *a = GET_ZBN(pa);
+    mp_int *m = GET_ZBN(pm);
+    mp_int t;
+    mp_int *c = GET_DST(pc,&t);
+    int err;
+
+    RELEASE_GIL();
+    INIT_DST(pc,c);
+    //fails with MP_VAL if a and m are not coprime
+    err = zbn_err(mp_invmod(a,m,c));
+    ACQUIRE_GIL();
+
+    if(err!=ERR_OK) return err;
+    *res = DST_RES(pc,c);
+    return ERR_OK;
+}
+
+C_NATIVE(_zbn_gcd){
+    NATIVE_UNWARN();
+    PObject *pa = args[0];
+    PObject *pb = args[1];
+    PObject *pc = args[2];
+    mp_int *a = GET_ZBN(pa);
+    mp_int *b = GET_ZBN(pb);
+    mp_int t;
+    mp_int *c = GET_DST(pc,&t);
+    int err;
+
+    RELEASE_GIL();
+    INIT_DST(pc,c);
+    err = zbn_err(mp_gcd(a,b,c));
+    ACQUIRE_GIL();
+
+    if(err!=ERR_OK) return err;
+    *res = DST_RES(pc,c);
+    return ERR_OK;
+}
+
+C_NATIVE(_zbn_tobytes){
+    NATIVE_UNWARN();
+    PObject *num = args[0];
+    CHECK_ARG(args[1],PSMALLINT);
+    int size = PSMALLINT_VALUE(args[1]);
+    mp_int *zbn = GET_ZBN(num);
+    size_t count;
+    //magnitude only, unsigned big endian
+    int nbytes = (mp_count_bits(zbn)+7)/8;
+
+    if(size<=0) size = nbytes;
+    if(size<nbytes) return ERR_OVERFLOW_EXC;
+    PBytes *bb = pbytes_new(size,NULL);
+    uint8_t *buf = PSEQUENCE_BYTES(bb);
+    memset(buf,0,size);
+    if(nbytes) {
+        if (mp_export(buf+size-nbytes,&count,1,1,1,0,zbn)!=MP_OKAY) return ERR_RUNTIME_EXC;
+    }
+    *res = bb;
+    return ERR_OK;
+}
+
+//Montgomery context: tuple (n, rho, R^2 mod n, R mod n)
+//R = b^n->used, computed once per modulus and reused by every operation
+#define MONT_N(ctx) GET_ZBN(PTUPLE_ITEM((ctx),0))
+#define MONT_RHO(ctx) ((mp_digit)PSMALLINT_VALUE(PTUPLE_ITEM((ctx),1)))
+#define MONT_RR(ctx) GET_ZBN(PTUPLE_ITEM((ctx),2))
+#define MONT_ONE(ctx) GET_ZBN(PTUPLE_ITEM((ctx),3))
 
+C_NATIVE(_zbn_mont_new){
+    NATIVE_UNWARN();
+    PObject *pn = args[0];
+    mp_int *n = GET_ZBN(pn);
+    mp_digit rho;
+    mp_int one, rr;
+    int err;
+
+    if (n->sign==MP_NEG || mp_cmp_d(n,1)!=MP_GT) return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    //fails with MP_VAL for even moduli
+    err = mp_montgomery_setup(n,&rho);
+    if (err==MP_OKAY) {
+        mp_init(&one);
+        mp_init(&rr);
+        err = mp_montgomery_calc_normalization(&one,n);
+        if (err==MP_OKAY) err = mp_sqrmod(&one,n,&rr);
+    }
+    err = zbn_err(err);
+    ACQUIRE_GIL();
+
+    if(err!=ERR_OK) return err;
+    PTuple *tpl = ptuple_new(4,NULL);
+    PTUPLE_SET_ITEM(tpl,0,pn);
+    PTUPLE_SET_ITEM(tpl,1,PSMALLINT_NEW(rho));
+    PTUPLE_SET_ITEM(tpl,2,zbn_to_res(NULL,&rr));
+    PTUPLE_SET_ITEM(tpl,3,zbn_to_res(NULL,&one));
+    *res = tpl;
+    return ERR_OK;
+}
+
+//c = a*b*R^-1 mod n
+int zbn_mont_mul(PObject *ctx, mp_int *a, mp_int *b, mp_int *c){
+    int err;
+    if (a==b) err = mp_sqr(a,c);
+    else err = mp_mul(a,b,c);
+    if (err!=MP_OKAY) return err;
+    return mp_montgomery_reduce(c,MONT_N(ctx),MONT_RHO(ctx));
+}
+
+//bring a into [0,n) if needed, using t as storage
+int zbn_mont_fit(PObject *ctx, mp_int **a, mp_int *t){
+    int err;
+    mp_int *n = MONT_N(ctx);
+    if ((*a)->sign==MP_NEG || mp_cmp_mag(*a,n)!=MP_LT) {
+        if ((err = mp_mod(*a,n,t))!=MP_OKAY) return err;
+        *a = t;
+    }
+    return MP_OKAY;
+}
+
+//t = a*R mod n
+int zbn_mont_enter(PObject *ctx, mp_int *a, mp_int *t){
+    int err = zbn_mont_fit(ctx,&a,t);
+    if (err!=MP_OKAY) return err;
+    return zbn_mont_mul(ctx,a,MONT_RR(ctx),t);
+}
+
+#define ZBN_MONT_MAX_WINSIZE 6
+#define EXP_BIT(e,k) (((e)->dp[(k)/DIGIT_BIT]>>((k)%DIGIT_BIT))&1)
+
+//left to right sliding window over the odd powers a^1,a^3,...,a^(2^w-1)
+int zbn_mont_exptmod(PObject *ctx, mp_int *a, mp_int *e, mp_int *c){
+    mp_int tbl[1<<(ZBN_MONT_MAX_WINSIZE-1)];
+    mp_int acc;
+    int err, i, j, l, w, bits, win, started=0, ntbl;
+
+    bits = mp_count_bits(e);
+    //window sizes as in mp_exptmod_fast
+    w = (bits<=7) ? 2:((bits<=36) ? 3:((bits<=140) ? 4:((bits<=450) ? 5:ZBN_MONT_MAX_WINSIZE)));
+    ntbl = 1<<(w-1);
+    for(i=0;i<ntbl;i++) mp_init(&tbl[i]);
+    mp_init(&acc);
+    err = zbn_mont_enter(ctx,a,&tbl[0]);
+    if (err==MP_OKAY && ntbl>1) err = zbn_mont_mul(ctx,&tbl[0],&tbl[0],&acc);
+    for(i=1;i<ntbl && err==MP_OKAY;i++) err = zbn_mont_mul(ctx,&tbl[i-1],&acc,&tbl[i]);
+    if (err==MP_OKAY) err = mp_copy(MONT_ONE(ctx),&acc);
+
+    i = bits-1;
+    while(i>=0 && err==MP_OKAY){
+        if (!EXP_BIT(e,i)) {
+            if (started) err = zbn_mont_mul(ctx,&acc,&acc,&acc);
+            i--;
+            continue;
+        }
+        //longest window starting at i and ending with a set bit
+        l = (i>=w-1) ? i-w+1:0;
+        while(!EXP_BIT(e,l)) l++;
+        win = 0;
+        for(j=i;j>=l;j--) win = (win<<1)|EXP_BIT(e,j);
+        if (started) {
+            for(j=i;j>=l && err==MP_OKAY;j--) err = zbn_mont_mul(ctx,&acc,&acc,&acc);
+            if (err==MP_OKAY) err = zbn_mont_mul(ctx,&acc,&tbl[win>>1],&acc);
+        } else {
+            err = mp_copy(&tbl[win>>1],&acc);
+            started = 1;
+        }
+        i = l-1;
+    }
+    //leave Montgomery form
+    if (err==MP_OKAY) err = mp_montgomery_reduce(&acc,MONT_N(ctx),MONT_RHO(ctx));
+    if (err==MP_OKAY) mp_exch(&acc,c);
+    for(i=0;i<ntbl;i++) mp_clear(&tbl[i]);
+    mp_clear(&acc);
+    return err;
+}
+
+C_NATIVE(_zbn_mont_exptmod){
+    NATIVE_UNWARN();
+    PObject *ctx = args[0];
+    PObject *pc = args[3];
+    mp_int *a = GET_ZBN(args[1]);
+    mp_int *e = GET_ZBN(args[2]);
+    mp_int t;
+    mp_int *c = GET_DST(pc,&t);
+    int err;
+
+    if (e->sign==MP_NEG) return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    INIT_DST(pc,c);
+    err = zbn_err(zbn_mont_exptmod(ctx,a,e,c));
+    ACQUIRE_GIL();
+
+    if(err!=ERR_OK) return err;
+    *res = DST_RES(pc,c);
+    return ERR_OK;
+}
+
+//a*b mod n as ((a*b)R^-1 * R^2)R^-1: two reductions instead of a division
+int zbn_mont_mulmod(PObject *ctx, mp_int *a, mp_int *b, mp_int *c){
+    mp_int ta, tb;
+    int err, sqr = (a==b);
+
+    mp_init(&ta);
+    mp_init(&tb);
+    err = zbn_mont_fit(ctx,&a,&ta);
+    if (err==MP_OKAY) {
+        if (sqr) b = a;
+        else err = zbn_mont_fit(ctx,&b,&tb);
+    }
+    if (err==MP_OKAY) err = zbn_mont_mul(ctx,a,b,&tb);
+    if (err==MP_OKAY) err = zbn_mont_mul(ctx,&tb,MONT_RR(ctx),&ta);
+    if (err==MP_OKAY) mp_exch(&ta,c);
+    mp_clear(&ta);
+    mp_clear(&tb);
+    return err;
+}
+
+C_NATIVE(_zbn_mont_mulmod){
+    NATIVE_UNWARN();
+    PObject *ctx = args[0];
+    PObject *pc = args[3];
+    mp_int *a = GET_ZBN(args[1]);
+    mp_int *b = GET_ZBN(args[2]);
+    mp_int t;
+    mp_int *c = GET_DST(pc,&t);
+    int err;
+
+    RELEASE_GIL();
+    INIT_DST(pc,c);
+    err = zbn_err(zbn_mont_mulmod(ctx,a,b,c));
+    ACQUIRE_GIL();
+
+    if(err!=ERR_OK) return err;
+    *res = DST_RES(pc,c);
+    return ERR_OK;
+}
+
+C_NATIVE(_zbn_cutoffs){
+    NATIVE_UNWARN();
+    PObject *cut = args[0];
+    int *cutoffs[4] = {&KARATSUBA_MUL_CUTOFF,&KARATSUBA_SQR_CUTOFF,&TOOM_MUL_CUTOFF,&TOOM_SQR_CUTOFF};
+    int i;
+
+    PTuple *tpl = ptuple_new(4,NULL);
+    for(i=0;i<4;i++) PTUPLE_SET_ITEM(tpl,i,PSMALLINT_NEW(*cutoffs[i]));
+    if (cut!=MAKE_NONE()) {
+        if (PTYPE(cut)!=PTUPLE || PSEQUENCE_ELEMENTS(cut)!=4) return ERR_TYPE_EXC;
+        for(i=0;i<4;i++) {
+            PObject *v = PTUPLE_ITEM(cut,i);
+            if (PTYPE(v)!=PSMALLINT || PSMALLINT_VALUE(v)<2) return ERR_VALUE_EXC;
+        }
+        for(i=0;i<4;i++) *cutoffs[i] = PSMALLINT_VALUE(PTUPLE_ITEM(cut,i));
+    }
+    //previous values
+    *res = tpl;
+    return ERR_OK;
+}
+
+//milliseconds taken by reps multiplications (or squarings) of digits sized numbers
+C_NATIVE(_zbn_bench){
+    NATIVE_UNWARN();
+    int32_t digits, reps, sqr;
+    mp_int a, b, c;
+    uint32_t seed = 0x2545f491;
+    uint64_t t0;
+    int i;
+
+    if (parse_py_args("iii",nargs,args,&digits,&reps,&sqr)!=3) return ERR_TYPE_EXC;
+    if (digits<1 || reps<1) return ERR_VALUE_EXC;
+    mp_init_size(&a,digits);
+    mp_init_size(&b,digits);
+    mp_init_size(&c,2*digits);
+    for(i=0;i<digits;i++){
+        //xorshift, enough to fill the operands
+        seed ^= seed<<13; seed ^= seed>>17; seed ^= seed<<5;
+        a.dp[i] = seed&MP_MASK;
+        b.dp[i] = (seed>>16)&MP_MASK;
+    }
+    a.dp[digits-1]|=1;
+    b.dp[digits-1]|=1;
+    a.used = b.used = digits;
+
+    RELEASE_GIL();
+    t0 = vosMillis();
+    for(i=0;i<reps;i++){
+        if (sqr) mp_sqr(&a,&c);
+        else mp_mul(&a,&b,&c);
+    }
+    t0 = vosMillis()-t0;
+    ACQUIRE_GIL();
+
+    *res = PSMALLINT_NEW((int32_t)t0);
+    return ERR_OK;
+}
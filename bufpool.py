@@ -0,0 +1,86 @@
+"""
+.. module:: bufpool
+
+***********
+Buffer Pool
+***********
+
+This module keeps free bytearrays of a few size classes, to be reused instead of allocating a new buffer for each read
+or request. Modules like :mod:`requests`, :mod:`streams` and :mod:`socket` take their temporary buffers from here,
+so a program repeating the same operations reaches a steady state where buffers are recycled, not allocated.
+
+A buffer obtained with :func:`acquire` can be given back with :func:`release` when no longer needed: its owner
+must not use it afterwards, since it will be handed out again. Buffers never released are simply collected as usual,
+so releasing is an optimization, never a requirement. Buffers are not reference counted: when a buffer is shared, only the
+last user may release it.
+
+At most :data:`MAX_FREE` buffers per class are kept. Sizes smaller than the first class or larger than the last one
+are allocated and collected as usual.
+
+    """
+
+@native_c("_bufpool_capacity",["csrc/bufpool/*"])
+def _bufpool_capacity(buf):
+    pass
+
+@native_c("_bufpool_restore",["csrc/bufpool/*"])
+def _bufpool_restore(buf):
+    pass
+
+CLASSES = (64,256,1024,2048,4096)
+MAX_FREE = 4
+
+_free = [[] for c in CLASSES]
+
+def _class(size):
+    for i in range(len(CLASSES)):
+        if size<=CLASSES[i]:
+            return i
+    return -1
+
+def acquire(size):
+    """
+.. function:: acquire(size)
+
+    Returns a bytearray of *size* bytes, recycled from the smallest class that fits if possible. Its content is not cleared.
+
+    """
+    c = _class(size)
+    if size<CLASSES[0]//2 or c<0:
+        return bytearray(size)
+    try:
+        buf = _free[c].pop()
+    except IndexError:
+        buf = bytearray(CLASSES[c])
+    __elements_set(buf,size)
+    return buf
+
+def release(buf):
+    """
+.. function:: release(buf)
+
+    Gives back *buf*, a bytearray returned by :func:`acquire` or by a function documented to return a pooled buffer.
+    Buffers of other capacities are ignored.
+
+    """
+    cap = _bufpool_capacity(buf)
+    c = _class(cap)
+    if c<0 or CLASSES[c]!=cap:
+        return
+    free = _free[c]
+    if len(free)>=MAX_FREE:
+        return
+    for b in free:
+        if b is buf:
+            return
+    _bufpool_restore(buf)
+    free.append(buf)
+
+def stats():
+    """
+.. function:: stats()
+
+    Returns a list with the number of free buffers of each class of :data:`CLASSES`.
+
+    """
+    return [len(f) for f in _free]
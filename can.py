@@ -27,6 +27,17 @@ __define(_CANDRIVER_STOPRX, 8)
 __define(_CANDRIVER_STOPTX, 9)
 __define(_CANDRIVER_RESUMERX, 10)
 __define(_CANDRIVER_RESUMETX, 11)
+__define(_CANDRIVER_RXSTART, 12)
+__define(_CANDRIVER_RXBATCH, 13)
+__define(_CANDRIVER_RXSTOP, 14)
+__define(_CANDRIVER_TXSTART, 15)
+__define(_CANDRIVER_TXBATCH, 16)
+__define(_CANDRIVER_TXPERIODIC, 17)
+__define(_CANDRIVER_TXSTOP, 18)
+__define(_CANDRIVER_FILTERS, 19)
+
+# size in bytes of a record of Can.rx_batch
+RECORD_SIZE = 20
 
 # special address description flags for the CAN_ID
 FRAME_EXT_FLAG = 0x80000000  # EFF/SFF is set in the MSB
@@ -58,7 +69,7 @@ OPTION_LISTEN_ONLY  = 0x08
 OPTION_LOOPBACK     = 0x10
 
 
-@native_c("_vbl_can_init", ["csrc/vbl/vbl_can.c"], ["VHAL_CAN"])
+@native_c("_vbl_can_init", ["csrc/vbl/vbl_can.c","csrc/gc/gc_pool.c"], ["VHAL_CAN"])
 def _vbl_can_init():
     pass
 
@@ -140,6 +151,31 @@ The Can class
         """
         self.drv.__ctl__(_CANDRIVER_DELFILTER, self.drvid, filter)
 
+    def set_filters(self, ids, max_filters=-1, traffic=None):
+        """
+.. method:: set_filters(ids, max_filters=-1, traffic=None)
+
+        Compute and add the acceptance filters for the list of message identifiers *ids* (up to 256, with ``FRAME_EXT_FLAG``
+        for extended frames). Each identifier first gets its own exact filter. While there are more than *max_filters*
+        of them, or more than the hardware filter banks can hold, the two filters that let through the fewest unwanted frames
+        are merged into one, with the bits they differ in cleared from the mask. Standard and extended identifiers are never
+        merged together.
+
+        Unwanted frames are counted on *traffic*, a sample of the bus: a list of identifiers, or a buffer filled by
+        :meth:`rx_batch` (up to 1024 frames of it are used). Without *traffic*, or on a tie, the filters accepting the fewest
+        identifiers outside *ids* are chosen. ::
+
+            buf = bytearray(512*can.RECORD_SIZE)
+            bus.rx_start(512)
+            n = bus.rx_batch(buf)       # sample with no filters
+            bus.rx_stop()
+            filters = bus.set_filters([0x100, 0x101, 0x180, 0x18FF5015|can.FRAME_EXT_FLAG], 2, buf[:n*can.RECORD_SIZE])
+
+        Return a tuple of filters `(id, mask, index)`, as for :meth:`add_filter`: *index* can be passed to :meth:`del_filter`.
+
+        """
+        return self.drv.__ctl__(_CANDRIVER_FILTERS, self.drvid, ids, max_filters, traffic)
+
     def transmit(self, id, dlc, data=None, timeout=-1):
         """
 .. method:: transmit(id, dlc, data=None, timeout=-1)
@@ -157,16 +193,18 @@ The Can class
         """
         self.drv.__ctl__(_CANDRIVER_TX, self.drvid, id, dlc, data, timeout)
 
-    def receive(self, data=None, timeout=-1):
+    def receive(self, data=None, timeout=-1, pool=None):
         """
-.. method:: receive(data=None, timeout=-1)
+.. method:: receive(data=None, timeout=-1, pool=None)
 
         Receive a message from the CAN bus input mailboxes.
 
         If a *data* bytearray is provided it is used to store received data, otherwise a new buffer is created.
+        If a *pool* of tuples of 3 items (see :class:`gc.Pool`) is provided, the result tuple is taken from it instead of being allocated.
 
         :param data: a bytes or bytearray object to receive message data or *None*
         :param timeout: the maximum time to wait for a message or -1 to wait indefinitely
+        :param pool: a :class:`gc.Pool` of ``gc.POOL_TUPLE`` objects of size 3 or *None*
 
         :returns: a tuple of the form `(id,dlc,data)`, where:
 
@@ -180,7 +218,107 @@ The Can class
         """
         if data is None:
             data = bytearray(64)
-        return self.drv.__ctl__(_CANDRIVER_RX, self.drvid, data, timeout)
+        return self.drv.__ctl__(_CANDRIVER_RX, self.drvid, data, timeout, pool.pool if pool is not None else None)
+
+    def rx_start(self, frames=64):
+        """
+.. method:: rx_start(frames=64)
+
+        Start receiving in background: a native thread takes every frame from the input mailboxes as soon as it arrives
+        and stores it, with a timestamp, in a ring of at least *frames* frames (up to 1024). Frames are then read many at
+        a time with :meth:`rx_batch`, so the mailboxes do not overflow when the bus is busy. While the ring is active,
+        :meth:`receive` must not be used.
+
+        """
+        self.drv.__ctl__(_CANDRIVER_RXSTART, self.drvid, frames)
+
+    def rx_batch(self, buffer, max_frames=-1, timeout=-1):
+        """
+.. method:: rx_batch(buffer, max_frames=-1, timeout=-1)
+
+        Move up to *max_frames* frames (as many as fit in *buffer* if negative) from the ring started by :meth:`rx_start`
+        into the bytearray *buffer*, waiting at most *timeout* milliseconds (forever if -1) for the first one.
+        Return the number of frames moved, 0 on timeout.
+
+        Each frame is a record of ``RECORD_SIZE`` (20) bytes, with little endian fields:
+
+            * bytes 0-3: the `id` of the frame, with flags, as returned by :meth:`receive`
+            * bytes 4-7: the microseconds from :meth:`rx_start` to the reception of the frame, wrapping around at 2^32
+            * byte 8: the `dlc`
+            * bytes 12-19: the data bytes, zero padded (frames longer than 8 bytes are truncated)
+
+        Decode records with :func:`record` or straight from the buffer::
+
+            buf = bytearray(32*can.RECORD_SIZE)
+            bus.rx_start(256)
+            while True:
+                n = bus.rx_batch(buf)
+                for i in range(n):
+                    id, dlc, ts, data = can.record(buf, i)
+
+        """
+        return self.drv.__ctl__(_CANDRIVER_RXBATCH, self.drvid, buffer, max_frames, timeout)
+
+    def rx_stop(self):
+        """
+.. method:: rx_stop()
+
+        Stop the ring started by :meth:`rx_start`; frames not yet read are discarded and :meth:`receive` can be used again.
+        Return the number of frames lost because the ring was full.
+
+        """
+        return self.drv.__ctl__(_CANDRIVER_RXSTOP, self.drvid)
+
+    def tx_start(self, frames=64):
+        """
+.. method:: tx_start(frames=64)
+
+        Start transmitting in background: a native thread sends the frames queued by :meth:`tx_batch`, from a queue of at least
+        *frames* frames (up to 1024), and the periodic frames set by :meth:`tx_periodic`. While it is active, :meth:`transmit`
+        should not be used, since it competes for the same mailboxes.
+
+        """
+        self.drv.__ctl__(_CANDRIVER_TXSTART, self.drvid, frames)
+
+    def tx_batch(self, buffer, nframes=-1):
+        """
+.. method:: tx_batch(buffer, nframes=-1)
+
+        Queue the first *nframes* records of *buffer* (all of them if negative) for transmission and return immediately.
+        Records have the layout described in :meth:`rx_batch` (the timestamp is ignored) and can be written with :func:`pack`.
+        Return the number of frames queued, less than *nframes* if the queue is full.
+
+        """
+        return self.drv.__ctl__(_CANDRIVER_TXBATCH, self.drvid, buffer, nframes)
+
+    def tx_periodic(self, buffer, nframes=-1):
+        """
+.. method:: tx_periodic(buffer, nframes=-1)
+
+        Replace the table of periodic frames with the first *nframes* records of *buffer* (all of them if negative): the
+        timestamp field of each record is its period in milliseconds, and must not be zero. Each frame is sent at once and then
+        every period, by the background thread, with no Python code running. An empty table stops the periodic frames. ::
+
+            table = bytearray(2*can.RECORD_SIZE)
+            can.pack(table, 0, 0x100, 8, engine_data, 10)   # every 10 ms
+            can.pack(table, 1, 0x200, 2, b'\x01\x02', 100)   # every 100 ms
+            bus.tx_start()
+            bus.tx_periodic(table)
+
+        The table is copied: to change the data of a periodic frame, update *buffer* and call :meth:`tx_periodic` again.
+
+        """
+        self.drv.__ctl__(_CANDRIVER_TXPERIODIC, self.drvid, buffer, nframes)
+
+    def tx_stop(self):
+        """
+.. method:: tx_stop()
+
+        Stop the background transmission; queued frames not yet sent are discarded and the periodic table is cleared.
+        Return the number of frames that could not be sent (no mailbox freed up in time, or a bus error).
+
+        """
+        return self.drv.__ctl__(_CANDRIVER_TXSTOP, self.drvid)
 
     def get_errors(self):
         """
@@ -257,4 +395,38 @@ The Can class
         will raise an *IOError* exception.
 
         """
+        self.rx_stop()
+        self.tx_stop()
         self.drv.__ctl__(_CANDRIVER_DONE, self.drvid)
+
+
+def record(buffer, i):
+    """
+.. function:: record(buffer, i)
+
+    Decode the *i*-th record of a *buffer* filled by :meth:`Can.rx_batch`. Return a tuple `(id, dlc, ts, data)`, with
+    *data* a new bytes object of the data bytes (empty for Remote Frames).
+
+    """
+    o = i*RECORD_SIZE
+    id = buffer[o]|(buffer[o+1]<<8)|(buffer[o+2]<<16)|(buffer[o+3]<<24)
+    ts = buffer[o+4]|(buffer[o+5]<<8)|(buffer[o+6]<<16)|(buffer[o+7]<<24)
+    dlc = buffer[o+8]
+    n = 0 if id&FRAME_RTR_FLAG else min(dlc,8)
+    return (id, dlc, ts, bytes(buffer[o+12:o+12+n]))
+
+def pack(buffer, i, id, dlc, data=None, ts=0):
+    """
+.. function:: pack(buffer, i, id, dlc, data=None, ts=0)
+
+    Write in the *i*-th record of the bytearray *buffer* a frame with identifier *id* (with flags), *dlc* and up to
+    8 bytes of *data*, for :meth:`Can.tx_batch` or :meth:`Can.tx_periodic` (*ts* being the period).
+
+    """
+    o = i*RECORD_SIZE
+    for k in range(4):
+        buffer[o+k] = (id>>(8*k))&0xff
+        buffer[o+4+k] = (ts>>(8*k))&0xff
+    buffer[o+8] = dlc
+    for k in range(8):
+        buffer[o+12+k] = data[k] if data is not None and k<len(data) else 0
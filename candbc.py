@@ -0,0 +1,204 @@
+"""
+.. module:: candbc
+
+*******************
+CAN Signal Decoding
+*******************
+
+This module decodes the signals of CAN frames natively, as described by a DBC file: each signal is a bit field of the data
+of a message, with a start bit, a length, a byte order (Intel or Motorola), a sign, a scale and an offset.
+
+Messages and their signals are added to a :class:`Db`, that compiles them into per identifier layout tables. Then a frame
+from :meth:`can.Can.receive`, or a whole buffer of frames from :meth:`can.Can.rx_batch`, is decoded with a single call into
+a preallocated bytearray of values: every signal has a slot of 4 bytes holding a 32 bits float (its physical value)
+or, for raw signals, a signed 32 bits integer. Decoding allocates nothing. ::
+
+    import can
+    import candbc
+
+    db = candbc.Db()
+    # BO_ 256 ENGINE: 8 ...
+    #  SG_ rpm : 0|16@1+ (0.25,0) ...
+    #  SG_ temp : 16|8@1- (1,-40) ...
+    engine = db.message(256, [candbc.signal(0,16,scale=0.25), candbc.signal(16,8,signed=True,offset=-40)])
+    # BO_ 2566834709 BMS: 8 ... (an extended frame)
+    #  SG_ current : 7|16@0- (0.1,0) ...
+    bms = db.message(0x18FF5015|can.FRAME_EXT_FLAG, [candbc.signal(7,16,candbc.BIG_ENDIAN,True,0.1)])
+
+    values = db.values()
+    stamps = db.stamps()
+    buf = bytearray(32*can.RECORD_SIZE)
+    bus.rx_start(256)
+    while True:
+        n = bus.rx_batch(buf)
+        db.decode_batch(buf, n, values, stamps)
+        rpm = db.value(values, engine)
+        current = db.value(values, bms)
+
+Multiplexed signals are not supported: describe each multiplexed layout as a separate database, or decode the multiplexer
+and the signals it selects from :func:`can.record`.
+
+    """
+
+LITTLE_ENDIAN = 0   # Intel byte order, @1 in DBC files
+BIG_ENDIAN = 1      # Motorola byte order, @0 in DBC files
+
+_SIGNED = 2
+_RAW = 4
+
+@native_c("__dbc_compile",["csrc/candbc/candbc.c"])
+def _compile(msgs):
+    pass
+
+@native_c("__dbc_decode",["csrc/candbc/candbc.c"])
+def _decode(layout,id,dlc,data,values):
+    pass
+
+@native_c("__dbc_decode_batch",["csrc/candbc/candbc.c"])
+def _decode_batch(layout,buffer,nframes,values,stamps):
+    pass
+
+@native_c("__dbc_value",["csrc/candbc/candbc.c"])
+def _value(layout,values,i):
+    pass
+
+
+def signal(start, length, order=LITTLE_ENDIAN, signed=False, scale=1, offset=0, raw=False):
+    """
+.. function:: signal(start, length, order=LITTLE_ENDIAN, signed=False, scale=1, offset=0, raw=False)
+
+    Return the definition of a signal for :meth:`Db.message`, with the fields of a ``SG_`` line of a DBC file:
+
+        * *start* is the start bit: for ``LITTLE_ENDIAN`` (Intel, ``@1``) signals the position of the least significant bit,
+          for ``BIG_ENDIAN`` (Motorola, ``@0``) ones the position of the most significant bit. Bit 0 is the least significant
+          bit of the first data byte, bit 63 the most significant of the eighth.
+        * *length* is the number of bits, from 1 to 64.
+        * *signed* is True for ``-`` signals, in two's complement.
+        * the value of the signal is *raw* * *scale* + *offset*, as a float. With *raw* set, the signal (of 32 bits at most) is
+          stored as the integer *raw* instead, and *scale* and *offset* are ignored.
+
+    """
+    return (start, length, order|(_SIGNED if signed else 0)|(_RAW if raw else 0), scale, offset)
+
+
+class Db():
+    """
+========
+Db class
+========
+
+.. class:: Db()
+
+    Creates an empty database of messages.
+
+    """
+    def __init__(self):
+        self._msgs = []
+        self._nsigs = 0
+        self._layout = None
+
+    def message(self, id, signals):
+        """
+.. method:: message(id, signals)
+
+        Add the message with identifier *id* and the list of *signals* built with :func:`signal`. Extended identifiers
+        must have the flag ``can.FRAME_EXT_FLAG`` set (in DBC files it is the most significant bit of the message id).
+
+        Return the slot of the first signal in the values: the signals of the message take the following slots, in order.
+
+        """
+        slot = self._nsigs
+        self._msgs.append((id, list(signals)))
+        self._nsigs += len(signals)
+        self._layout = None
+        return slot
+
+    def compile(self):
+        """
+.. method:: compile()
+
+        Compile the messages added so far into the layout tables. A :exc:`ValueError` is raised for invalid signals or duplicated
+        identifiers. The decoding methods compile the database on first use, if needed.
+
+        """
+        self._layout = _compile(self._msgs)
+        return self
+
+    def size(self):
+        """
+.. method:: size()
+
+        Return the number of signals of the database.
+
+        """
+        return self._nsigs
+
+    def values(self):
+        """
+.. method:: values()
+
+        Return a new bytearray of values, with a 4 bytes slot for each signal.
+
+        """
+        return bytearray(4*self._nsigs)
+
+    def stamps(self):
+        """
+.. method:: stamps()
+
+        Return a new bytearray of timestamps for :meth:`decode_batch`, with 4 bytes for each message.
+
+        """
+        return bytearray(4*len(self._msgs))
+
+    def decode(self, id, dlc, data, values):
+        """
+.. method:: decode(id, dlc, data, values)
+
+        Decode the frame *id*, *dlc*, *data* as returned by :meth:`can.Can.receive` into the bytearray *values*.
+        Signals lying beyond the *dlc* data bytes keep their previous value.
+
+        Return the index of the message of the frame, in the order of :meth:`message`, or -1 if the frame is not in
+        the database (*values* is untouched).
+
+        """
+        if self._layout is None:
+            self.compile()
+        return _decode(self._layout, id, dlc, data, values)
+
+    def decode_batch(self, buffer, nframes, values, stamps=None):
+        """
+.. method:: decode_batch(buffer, nframes, values, stamps=None)
+
+        Decode the first *nframes* records (all of them if negative) of a *buffer* filled by :meth:`can.Can.rx_batch` into the
+        bytearray *values*. When more frames of the same message are in the buffer, the last one wins.
+        If a bytearray *stamps* (see :meth:`stamps`) is given, the timestamp of the last frame of each message is stored in it, as a
+        little endian 32 bits integer at 4 times the index of the message.
+
+        Return the number of frames that are in the database.
+
+        """
+        if self._layout is None:
+            self.compile()
+        return _decode_batch(self._layout, buffer, nframes, values, stamps)
+
+    def value(self, values, i):
+        """
+.. method:: value(values, i)
+
+        Return the value of the signal in slot *i* of *values*: a float, or an integer for raw signals.
+
+        """
+        if self._layout is None:
+            self.compile()
+        return _value(self._layout, values, i)
+
+    def stamp(self, stamps, msg):
+        """
+.. method:: stamp(stamps, msg)
+
+        Return the timestamp of message *msg* stored in *stamps* by :meth:`decode_batch`.
+
+        """
+        o = 4*msg
+        return stamps[o]|(stamps[o+1]<<8)|(stamps[o+2]<<16)|(stamps[o+3]<<24)
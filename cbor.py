@@ -8,8 +8,11 @@ CBOR
 This module define functions to serialize and deserialize objects to and from `CBOR <http://cbor.io>`_ format.
 The serialization and deserialization of objects is performed using a wrapped version of the awesome and lighting fast `libcbor  <http://libcbor.org/>`_
 
+The library is set up by the first call of the module, so importing it does not slow down the boot.
+
     """
 
+_ready = False
 
 @native_c("_cbor_init",[
     "csrc/cbor/cbor_ifc.c",
@@ -30,26 +33,38 @@ def init(tagclass,undefclass,tagname,valuename):
 
 
 @native_c("_cbor_loads",[])
-def _cbor_loads(buf):
+def _cbor_loads(buf,intern_keys,bin_slices):
     pass
 
 @native_c("_cbor_dumps",[])
 def _cbor_dumps(obj):
     pass
 
+@native_c("_cbor_stream_feed",[])
+def _cbor_stream_feed(stack,data,out,keys):
+    pass
+
 
-def loads(buf):
+def loads(buf,intern_keys=False,bin_slices=False):
     """
-.. function:: loads(data)
+.. function:: loads(data,intern_keys=False,bin_slices=False)
 
     Returns a Python object represented by the byte sequence *data*.
     For CBOR specific structures such as *tags* and *undefined* values, 
     the function returns instances of the :class:`Tag` and :class:`Undefined` classes.
 
+    If *intern_keys* is True, maps with the same string keys share the key strings instead of holding a copy each.
+
+    If *bin_slices* is True, byte strings are not copied out of *data*: each one is returned as a slice selecting it inside *data*,
+    so that ``data[s]`` gives the payload. Large payloads, such as firmware chunks, can then be written where needed
+    without an intermediate copy, as long as *data* is kept. Indefinite length byte strings are still returned as bytes.
+
     Raises ``ValueError`` when *data* contains bad or unsupported CBOR.
 
     """
-    return _cbor_loads(buf)
+    if not _ready:
+        init_lib()
+    return _cbor_loads(buf,intern_keys,bin_slices)
 
 
 def dumps(obj):
@@ -65,9 +80,71 @@ def dumps(obj):
     Raises ``RuntimeError`` when *obj* can't be serialized.
 
     """ 
+    if not _ready:
+        init_lib()
     return _cbor_dumps(obj)
 
 
+class CBORStream():
+    """
+================
+CBORStream class
+================
+
+.. class:: CBORStream(callback=None,intern_keys=False)
+
+    Create a resumable CBOR decoder. Data can be given in chunks of any size with :meth:`feed`, for example as CBOR frames arrive from a socket,
+    and each top level item is returned as soon as it is complete. Items are decoded straight into Python objects as their bytes arrive.
+
+    If *callback* is given, it is called with each decoded item instead of returning the items from :meth:`feed`.
+    *intern_keys* has the same meaning as in :func:`loads`, the key strings being shared by all the items decoded by the stream.
+
+    """
+    def __init__(self,callback=None,intern_keys=False):
+        if not _ready:
+            init_lib()
+        self._stack = []
+        self._keys = [] if intern_keys else None
+        self._pending = None
+        self.callback = callback
+
+    def feed(self,data):
+        """
+.. method:: feed(data)
+
+    Decode the byte sequence *data*, the next chunk of the stream. Returns a list of the items completed by *data*.
+
+    Raises ``ValueError`` when *data* contains bad or unsupported CBOR.
+
+        """
+        if self._pending is not None:
+            data = self._pending+data
+        out = []
+        n = _cbor_stream_feed(self._stack,data,out,self._keys)
+        # the last item may be cut by the end of the chunk: keep it for the next one
+        if n<len(data):
+            self._pending = data[n:]
+        else:
+            self._pending = None
+        if self.callback is not None:
+            for v in out:
+                self.callback(v)
+            return []
+        return out
+
+    def close(self):
+        """
+.. method:: close()
+
+    Signal the end of the stream.
+
+    Raises ``ValueError`` when the last item is incomplete.
+
+        """
+        if self._pending is not None or self._stack:
+            raise ValueError
+
+
 class Tag():
     """
 =========
@@ -104,9 +181,9 @@ Undefined class
         return "undefined"
 
 def init_lib():
+    global _ready
     atag = Tag(0,0)
     tagname, valuename = atag._get_names()
     init(Tag,Undefined,tagname,valuename)
-
-init_lib()
+    _ready = True
 
@@ -0,0 +1,822 @@
+"""
+.. module:: coap
+
+****
+CoAP
+****
+
+This module implements the Constrained Application Protocol (`RFC 7252 <https://tools.ietf.org/html/rfc7252>`_) over UDP,
+a lighter alternative to :mod:`requests` for battery powered nodes and narrowband links: a request and its response are
+usually a single datagram each, with a 4 bytes binary header and compact options instead of text headers and a TCP connection.
+
+The module supports:
+
+    * confirmable requests, retransmitted with exponential backoff until acknowledged, piggybacked and separate responses;
+    * CBOR payloads through :mod:`cbor` (content format 60);
+    * observation of resources (`RFC 7641 <https://tools.ietf.org/html/rfc7641>`_);
+    * block-wise transfers (`RFC 7959 <https://tools.ietf.org/html/rfc7959>`_) in both directions, so that payloads larger than
+      a datagram, as firmware images, are moved a block at a time and can be consumed as they arrive (for example by :class:`fota.SlotWriter`).
+
+Messages are encoded and decoded natively into a transmit and a receive buffer allocated once per :class:`Client` or :class:`Server`:
+an exchange does not allocate message buffers, and the blocks of a download are handed to the callback in the receive buffer itself.
+
+Every :class:`Client` and :class:`Server` uses the default net driver, that must have been properly configured and started.
+
+Exceptions raised:
+
+    * :exc:`TimeoutError` when a confirmable message is not acknowledged after all the retransmissions, or a response does not arrive in time;
+    * :exc:`CoapResetError` when the peer rejects a message with a reset;
+    * :exc:`CoapError` for malformed or unexpected messages during a block-wise transfer.
+
+    """
+
+import socket
+import timers
+import cbor
+import threading
+
+new_exception(CoapError,Exception)
+new_exception(CoapResetError,CoapError)
+
+# message types
+CON = 0
+NON = 1
+ACK = 2
+RST = 3
+
+# method codes
+EMPTY = 0
+GET = 1
+POST = 2
+PUT = 3
+DELETE = 4
+
+# response codes, class.detail as (class<<5)|detail
+CREATED = 0x41
+DELETED = 0x42
+VALID = 0x43
+CHANGED = 0x44
+CONTENT = 0x45
+CONTINUE = 0x5f
+BAD_REQUEST = 0x80
+UNAUTHORIZED = 0x81
+FORBIDDEN = 0x83
+NOT_FOUND = 0x84
+METHOD_NOT_ALLOWED = 0x85
+REQUEST_ENTITY_INCOMPLETE = 0x88
+REQUEST_ENTITY_TOO_LARGE = 0x8d
+INTERNAL_SERVER_ERROR = 0xa0
+SERVICE_UNAVAILABLE = 0xa3
+
+# option numbers
+IF_MATCH = 1
+URI_HOST = 3
+ETAG = 4
+OBSERVE = 6
+URI_PORT = 7
+URI_PATH = 11
+CONTENT_FORMAT = 12
+MAX_AGE = 14
+URI_QUERY = 15
+ACCEPT = 17
+BLOCK2 = 23
+BLOCK1 = 27
+SIZE2 = 28
+SIZE1 = 60
+
+# content formats
+TEXT = 0
+LINK_FORMAT = 40
+OCTET_STREAM = 42
+JSON = 50
+CBOR = 60
+
+PORT = 5683
+
+# transmission parameters of RFC 7252, milliseconds
+ACK_TIMEOUT = 2000
+MAX_RETRANSMIT = 4
+# how long a separate response is waited for, once the request is acknowledged
+RESPONSE_TIMEOUT = 30000
+
+@native_c("_coap_encode",["csrc/coap/coap.c"])
+def _coap_encode(buf,type,code,mid,token,options,payload,ofs,size):
+    pass
+
+@native_c("_coap_decode",["csrc/coap/coap.c"])
+def _coap_decode(buf,n):
+    pass
+
+@native_c("_coap_option",["csrc/coap/coap.c"])
+def _coap_option(buf,n,number,index):
+    pass
+
+@native_c("_coap_join",["csrc/coap/coap.c"])
+def _coap_join(buf,n,number,sep):
+    pass
+
+@native_c("_coap_shift",["csrc/coap/coap.c"])
+def _coap_shift(buf,ofs,n):
+    pass
+
+def _szx(block):
+    szx = 0
+    while (16<<szx)<block and szx<6:
+        szx+=1
+    if (16<<szx)!=block:
+        raise ValueError
+    return szx
+
+def _path_options(opts,path):
+    q = path.find("?")
+    if q>=0:
+        query = path[q+1:]
+        path = path[:q]
+    else:
+        query = ""
+    for seg in path.split("/"):
+        if seg:
+            opts.append((URI_PATH,seg))
+    if query:
+        for seg in query.split("&"):
+            opts.append((URI_QUERY,seg))
+
+def _to_payload(payload,format):
+    # objects other than byte sequences are sent as CBOR
+    if payload is None:
+        return (None,format)
+    t = type(payload)
+    if t==PBYTES or t==PBYTEARRAY or t==PSTRING:
+        return (payload,format)
+    return (cbor.dumps(payload),CBOR)
+
+
+class Message():
+    """
+=============
+Message class
+=============
+
+.. class:: Message()
+
+    A request received by a :class:`Server` or a response received by a :class:`Client`. It has the attributes:
+
+    * :attr:`code`, the method of a request or the code of a response;
+    * :attr:`path` and :attr:`query`, the Uri-Path joined by ``/`` and the Uri-Query joined by ``&`` of a request;
+    * :attr:`payload`, a bytearray or None;
+    * :attr:`format`, the content format of the payload, None if not given;
+    * :attr:`observe`, the value of the Observe option, None if missing;
+    * :attr:`source`, the address of the sender.
+
+    """
+    def __init__(self,code,payload,format,observe,source):
+        self.code = code
+        self.payload = payload
+        self.format = format
+        self.observe = observe
+        self.source = source
+        self.path = ""
+        self.query = ""
+
+    def data(self):
+        """
+.. method:: data()
+
+    Return the payload decoded from CBOR if its content format is :const:`CBOR`, the payload itself otherwise.
+
+        """
+        if self.format==CBOR and self.payload is not None:
+            return cbor.loads(self.payload)
+        return self.payload
+
+    def ok(self):
+        """
+.. method:: ok()
+
+    Return True if :attr:`code` is a success response code (class 2).
+
+        """
+        return (self.code>>5)==2
+
+
+class _Endpoint():
+    # a UDP socket with its preallocated transmit and receive buffers
+
+    def __init__(self,bufsize,block):
+        self._szx = _szx(block)
+        self.block = block
+        if bufsize<block+64:
+            bufsize = block+64
+        self._bufsize = bufsize
+        self._tx = bytearray(bufsize)
+        self._rx = bytearray(bufsize)
+        self._empty = bytearray(4)
+        self._sock = socket.socket(type=socket.SOCK_DGRAM)
+        self._mid = random(0,0xffff)
+        self._src = None
+
+    def _next_mid(self):
+        self._mid = (self._mid+1)&0xffff
+        return self._mid
+
+    def _send(self,n,addr):
+        __elements_set(self._tx,n)
+        try:
+            self._sock.sendto(self._tx,addr)
+        finally:
+            __elements_set(self._tx,self._bufsize)
+
+    def _send_empty(self,type,mid,addr):
+        # empty ACK or RST, in a buffer of its own: the others may hold a message to retransmit or being handled
+        _coap_encode(self._empty,type,EMPTY,mid,b"",(),None,0,0)
+        self._sock.sendto(self._empty,addr)
+
+    def _recv(self,timeout):
+        # length of the datagram received in the receive buffer, -1 on timeout
+        if timeout<=0:
+            return -1
+        self._sock.settimeout(timeout)
+        try:
+            r = self._sock.recvfrom_into(self._rx,self._bufsize)
+        except TimeoutError:
+            return -1
+        self._src = r[1]
+        return r[0]
+
+    def _message(self,n,pofs,copy=True):
+        rx = self._rx
+        fmt = _coap_option(rx,n,CONTENT_FORMAT,0)
+        obs = _coap_option(rx,n,OBSERVE,0)
+        payload = None
+        if pofs<n and copy:
+            payload = rx[pofs:n]
+        return Message(rx[1],payload,fmt,obs,self._src)
+
+    def close(self):
+        """
+.. method:: close()
+
+    Close the socket.
+
+        """
+        self._sock.close()
+
+
+class Client(_Endpoint):
+    """
+============
+Client class
+============
+
+.. class:: Client(host, port=5683, conn_ifc=None, bufsize=0, block=512)
+
+    Create a client of the CoAP server at *host* (a name or an ip address) and *port*, reached through the net driver *conn_ifc*
+    (the default one if None).
+
+    *block* is the size of the blocks of block-wise transfers, a power of two from 16 to 1024: payloads larger than *block* are sent
+    in blocks, and downloads are asked in blocks of at most this size. *bufsize* is the size of each of the two message buffers,
+    at least *block* plus room for the header and the options.
+
+    A client is meant to be used by one thread at a time.
+
+    """
+    def __init__(self,host,port=PORT,conn_ifc=None,bufsize=0,block=512):
+        _Endpoint.__init__(self,bufsize,block)
+        conn = conn_ifc if conn_ifc is not None else __builtins__.__default_net["sock"][0]
+        ip = socket.ip_to_tuple(conn.gethostbyname(host))
+        self._addr = (ip[0],ip[1],ip[2],ip[3],port)
+        self._tid = random(0,0x7fffffff)
+        self._token = b""
+        self._obs_token = None
+        self._obs_opts = None
+        self.timeout = RESPONSE_TIMEOUT
+
+    def _new_token(self):
+        self._tid = (self._tid+1)&0x7fffffff
+        t = self._tid
+        self._token = bytes(((t>>24)&0xff,(t>>16)&0xff,(t>>8)&0xff,t&0xff))
+        return self._token
+
+    def _match(self,n,mid,token):
+        # 1 for the response, 0 for an empty ACK of mid, -1 for anything else
+        try:
+            h = _coap_decode(self._rx,n)
+        except ValueError:
+            return (-1,None)
+        if h[0]==RST and h[2]==mid:
+            raise CoapResetError
+        if h[0]==ACK:
+            if h[2]!=mid:
+                return (-1,h)
+            if h[1]==EMPTY:
+                return (0,h)
+            return (1,h) if h[3]==token else (-1,h)
+        if h[1]==EMPTY or h[3]!=token:
+            if h[0]==CON:
+                # not ours: reject it, so that the peer does not retransmit
+                self._send_empty(RST,h[2],self._src)
+            return (-1,h)
+        if h[0]==CON:
+            self._send_empty(ACK,h[2],self._src)
+        return (1,h)
+
+    def _wait_token(self,token,timeout):
+        # a separate response or a notification for token, as (n, header), (-1,None) on timeout
+        deadline = timers.monotonic_ms()+timeout
+        while True:
+            n = self._recv(deadline-timers.monotonic_ms())
+            if n<0:
+                return (-1,None)
+            r = self._match(n,-1,token)
+            if r[0]>0:
+                return (n,r[1])
+
+    def _exchange(self,type,code,opts,payload,ofs,size):
+        # sends a request and returns (n, header) of its response in the receive buffer
+        mid = self._next_mid()
+        token = self._token
+        n = _coap_encode(self._tx,type,code,mid,token,opts,payload,ofs,size)
+        if type==NON:
+            self._send(n,self._addr)
+            r = self._wait_token(token,self.timeout)
+            if r[0]<0:
+                raise TimeoutError
+            return r
+        timeout = ACK_TIMEOUT+random(0,ACK_TIMEOUT//2)
+        for i in range(MAX_RETRANSMIT+1):
+            self._send(n,self._addr)
+            deadline = timers.monotonic_ms()+timeout
+            while True:
+                rn = self._recv(deadline-timers.monotonic_ms())
+                if rn<0:
+                    break
+                r = self._match(rn,mid,token)
+                if r[0]>0:
+                    return (rn,r[1])
+                if r[0]==0:
+                    # acknowledged, the response comes separately
+                    r = self._wait_token(token,self.timeout)
+                    if r[0]<0:
+                        raise TimeoutError
+                    return r
+            timeout*=2
+        raise TimeoutError
+
+    def _options(self,path,format,accept,extra):
+        opts = []
+        _path_options(opts,path)
+        if format is not None:
+            opts.append((CONTENT_FORMAT,format))
+        if accept is not None:
+            opts.append((ACCEPT,accept))
+        if extra:
+            for opt in extra:
+                opts.append(opt)
+        return opts
+
+    def _download(self,n,h,opts,callback,confirmable):
+        # the response, fetching the following blocks if it is the first of a block-wise transfer
+        rx = self._rx
+        pofs = h[4]
+        b2 = _coap_option(rx,n,BLOCK2,0)
+        msg = self._message(n,pofs,callback is None)
+        if callback is not None and pofs<n:
+            __elements_set(rx,_coap_shift(rx,pofs,n))
+            try:
+                callback(rx)
+            finally:
+                __elements_set(rx,self._bufsize)
+        if b2 is None or not (b2&8) or not msg.ok():
+            return msg
+        num = b2>>4
+        szx = b2&7
+        opts.append((BLOCK2,0))
+        last = len(opts)-1
+        while b2&8:
+            num+=1
+            opts[last] = (BLOCK2,(num<<4)|szx)
+            r = self._exchange(CON if confirmable else NON,GET,opts,None,0,0)
+            n = r[0]
+            pofs = r[1][4]
+            b2 = _coap_option(rx,n,BLOCK2,0)
+            if rx[1]!=CONTENT or b2 is None or (b2>>4)!=num:
+                raise CoapError
+            if callback is not None:
+                __elements_set(rx,_coap_shift(rx,pofs,n))
+                try:
+                    callback(rx)
+                finally:
+                    __elements_set(rx,self._bufsize)
+            elif pofs<n:
+                if msg.payload is None:
+                    msg.payload = bytearray()
+                msg.payload.extend(rx[pofs:n])
+        return msg
+
+    def request(self,method,path,payload=None,format=None,accept=None,callback=None,confirmable=True,options=None):
+        """
+.. method:: request(method, path, payload=None, format=None, accept=None, callback=None, confirmable=True, options=None)
+
+    Send a request with *method* (:const:`GET`, :const:`POST`, :const:`PUT` or :const:`DELETE`) for the resource at *path*
+    (as ``"sensors/temp?unit=C"``) and return the response as a :class:`Message`.
+
+    *payload* can be a byte sequence, sent with content format *format*, or any other object, sent encoded in CBOR.
+    A payload larger than the block size is sent with a block-wise transfer. *accept* is the content format asked for the response.
+
+    If the response is split in blocks, the following blocks are fetched too: if *callback* is given, it is called with each block
+    as a bytearray (the receive buffer, valid only during the call) and the payload of the returned message is None;
+    otherwise the blocks are joined in the payload.
+
+    A *confirmable* request is retransmitted until acknowledged; a non confirmable one is sent once and the response waited for
+    :attr:`timeout` milliseconds. *options* is a list of further (number, value) options.
+
+        """
+        pv = _to_payload(payload,format)
+        payload = pv[0]
+        opts = self._options(path,pv[1],accept,options)
+        type = CON if confirmable else NON
+        self._new_token()
+        size = len(payload) if payload is not None else 0
+        if size<=self.block:
+            r = self._exchange(type,method,opts,payload,0,-1)
+            return self._download(r[0],r[1],self._options(path,None,accept,options),callback,confirmable)
+        # block-wise upload: the server may ask for smaller blocks in its answers
+        szx = self._szx
+        opts.append((SIZE1,size))
+        opts.append((BLOCK1,0))
+        last = len(opts)-1
+        ofs = 0
+        while True:
+            bs = 16<<szx
+            more = 1 if ofs+bs<size else 0
+            opts[last] = (BLOCK1,((ofs//bs)<<4)|(more<<3)|szx)
+            r = self._exchange(type,method,opts,payload,ofs,bs)
+            n = r[0]
+            code = self._rx[1]
+            if not more or (code>>5)!=2:
+                break
+            if code!=CONTINUE:
+                raise CoapError
+            b1 = _coap_option(self._rx,n,BLOCK1,0)
+            if b1 is not None and (b1&7)<szx:
+                szx = b1&7
+            ofs+=bs
+        return self._download(n,r[1],self._options(path,None,accept,options),callback,confirmable)
+
+    def get(self,path,accept=None,callback=None,confirmable=True):
+        """
+.. method:: get(path, accept=None, callback=None, confirmable=True)
+
+    Send a GET request, see :meth:`request`. To download a firmware image into a slot, a block at a time::
+
+        writer = fota.SlotWriter(addr)
+        client.get("fw/image",callback=writer.write)
+        writer.close()
+
+        """
+        return self.request(GET,path,None,None,accept,callback,confirmable)
+
+    def post(self,path,payload=None,format=None,confirmable=True):
+        """
+.. method:: post(path, payload=None, format=None, confirmable=True)
+
+    Send a POST request, see :meth:`request`.
+
+        """
+        return self.request(POST,path,payload,format,None,None,confirmable)
+
+    def put(self,path,payload=None,format=None,confirmable=True):
+        """
+.. method:: put(path, payload=None, format=None, confirmable=True)
+
+    Send a PUT request, see :meth:`request`.
+
+        """
+        return self.request(PUT,path,payload,format,None,None,confirmable)
+
+    def delete(self,path,confirmable=True):
+        """
+.. method:: delete(path, confirmable=True)
+
+    Send a DELETE request, see :meth:`request`.
+
+        """
+        return self.request(DELETE,path,None,None,None,None,confirmable)
+
+    def observe(self,path,accept=None):
+        """
+.. method:: observe(path, accept=None)
+
+    Start observing the resource at *path*, replacing the observation in progress if any, and return the first response.
+    If the server accepted the observation, its :attr:`~Message.observe` is not None and the following notifications are received with :meth:`notification`.
+
+        """
+        if self._obs_token is not None:
+            self.cancel()
+        opts = self._options(path,None,accept,((OBSERVE,0),))
+        self._new_token()
+        r = self._exchange(CON,GET,opts,None,0,-1)
+        msg = self._download(r[0],r[1],self._options(path,None,accept,None),None,True)
+        if msg.observe is not None:
+            self._obs_token = self._token
+            self._obs_opts = opts
+        return msg
+
+    def notification(self,timeout=-1):
+        """
+.. method:: notification(timeout=-1)
+
+    Wait at most *timeout* milliseconds (:attr:`timeout` if negative) for the next notification of the observed resource and return it
+    as a :class:`Message`, or None if none arrived. Confirmable notifications are acknowledged. If the notification is the first block
+    of a larger representation, the other blocks are fetched.
+
+        """
+        if self._obs_token is None:
+            raise CoapError
+        r = self._wait_token(self._obs_token,self.timeout if timeout<0 else timeout)
+        if r[0]<0:
+            return None
+        opts = []
+        for opt in self._obs_opts:
+            if opt[0]!=OBSERVE:
+                opts.append(opt)
+        self._token = self._obs_token
+        return self._download(r[0],r[1],opts,None,True)
+
+    def cancel(self):
+        """
+.. method:: cancel()
+
+    Stop the observation in progress, telling the server.
+
+        """
+        if self._obs_token is None:
+            return
+        opts = []
+        for opt in self._obs_opts:
+            opts.append((OBSERVE,1) if opt[0]==OBSERVE else opt)
+        self._token = self._obs_token
+        self._obs_token = None
+        try:
+            self._exchange(CON,GET,opts,None,0,-1)
+        except TimeoutError:
+            pass
+
+
+class Server(_Endpoint):
+    """
+============
+Server class
+============
+
+.. class:: Server(port=5683, bufsize=0, block=512)
+
+    Create a CoAP server listening on UDP *port*. *block* and *bufsize* are as in :class:`Client`: representations larger than
+    *block* are served block-wise.
+
+    Resources are added with :meth:`add` and requests are served by :meth:`serve` (or :meth:`serve_once`) in a thread.
+
+    """
+    def __init__(self,port=PORT,bufsize=0,block=512):
+        _Endpoint.__init__(self,bufsize,block)
+        self._sock.bind(port)
+        # serializes the use of the transmit buffer by serve and notify
+        self._lock = threading.Lock()
+        self._resources = {}
+        # observers as [address, token, path, sequence, message id]
+        self._observers = []
+        # the last response sent, resent as is to a duplicate request
+        self._last_src = None
+        self._last_mid = -1
+        self._last_n = 0
+        # representation being served block-wise, and payload being received block-wise
+        self._out = None
+        self._in = None
+
+    def add(self,path,handler,observable=False):
+        """
+.. method:: add(path, handler, observable=False)
+
+    Serve the resource at *path* (as ``"sensors/temp"``) with *handler*, called with the request :class:`Message`.
+    The handler returns a response code, or a tuple ``(code, payload)`` or ``(code, payload, format)`` where *payload* is a byte sequence or
+    an object to send encoded in CBOR. Duplicated confirmable requests are answered again with the last response only if it was
+    theirs: handlers should be idempotent.
+
+    An *observable* resource accepts observers, that are notified by calling :meth:`notify`.
+
+        """
+        while path.startswith("/"):
+            path = path[1:]
+        self._resources[path] = (handler,observable)
+
+    def remove(self,path):
+        """
+.. method:: remove(path)
+
+    Stop serving the resource at *path* and drop its observers.
+
+        """
+        while path.startswith("/"):
+            path = path[1:]
+        if path in self._resources:
+            del self._resources[path]
+        self._drop(None,path)
+
+    def _drop(self,token,path):
+        obs = []
+        for o in self._observers:
+            if (token is not None and o[1]!=token) or (path is not None and o[2]!=path):
+                obs.append(o)
+        self._observers = obs
+
+    def _call(self,handler,msg):
+        try:
+            res = handler(msg)
+        except Exception:
+            return (INTERNAL_SERVER_ERROR,None,None)
+        if type(res)==PSMALLINT:
+            return (res,None,None)
+        pv = _to_payload(res[1],res[2] if len(res)>2 else None)
+        return (res[0],pv[0],pv[1])
+
+    def _respond(self,type,mid,token,code,opts,payload,ofs,size,addr):
+        if type==CON:
+            type = ACK
+        else:
+            type = NON
+            mid = self._next_mid()
+        n = _coap_encode(self._tx,type,code,mid,token,opts,payload,ofs,size)
+        self._send(n,addr)
+        return (mid,n)
+
+    def _block_options(self,opts,res,num,szx):
+        # options and window of block num of the representation res
+        bs = 16<<szx
+        size = len(res[1]) if res[1] is not None else 0
+        if res[2] is not None:
+            opts.append((CONTENT_FORMAT,res[2]))
+        if size>bs or num>0:
+            opts.append((BLOCK2,(num<<4)|((1 if (num+1)*bs<size else 0)<<3)|szx))
+            if num==0:
+                opts.append((SIZE2,size))
+        return (num*bs,bs)
+
+    def serve_once(self,timeout=-1):
+        """
+.. method:: serve_once(timeout=-1)
+
+    Wait at most *timeout* milliseconds (forever if negative) for a message and handle it. Return False on timeout.
+
+        """
+        if timeout<0:
+            timeout = 0x3fffffff
+        n = self._recv(timeout)
+        if n<0:
+            return False
+        self._lock.acquire()
+        try:
+            self._handle(n)
+        finally:
+            self._lock.release()
+        return True
+
+    def _handle(self,n):
+        rx = self._rx
+        src = self._src
+        try:
+            h = _coap_decode(rx,n)
+        except ValueError:
+            return
+        type = h[0]
+        code = h[1]
+        mid = h[2]
+        token = h[3]
+        if type==RST:
+            # an observer rejected a notification
+            obs = []
+            for o in self._observers:
+                if o[4]!=mid or o[0]!=src:
+                    obs.append(o)
+            self._observers = obs
+            return
+        if type==ACK or (code>>5)!=0:
+            return
+        if code==EMPTY:
+            if type==CON:
+                self._send_empty(RST,mid,src)
+            return
+        if type==CON and mid==self._last_mid and src==self._last_src:
+            self._send(self._last_n,src)
+            return
+
+        msg = self._message(n,h[4])
+        msg.path = _coap_join(rx,n,URI_PATH,"/")
+        msg.query = _coap_join(rx,n,URI_QUERY,"&")
+        b1 = _coap_option(rx,n,BLOCK1,0)
+        b2 = _coap_option(rx,n,BLOCK2,0)
+        szx = self._szx
+        opts = []
+        payload = None
+        ofs = 0
+        size = -1
+        res = self._resources.get(msg.path)
+        if res is None:
+            rcode = NOT_FOUND
+        elif b1 is not None:
+            # a block of an upload: collected until the last one
+            num = b1>>4
+            bs = 16<<(b1&7)
+            if num==0:
+                self._in = [src,msg.path,bytearray()]
+            if self._in is None or self._in[0]!=src or self._in[1]!=msg.path or len(self._in[2])!=num*bs:
+                rcode = REQUEST_ENTITY_INCOMPLETE
+            else:
+                if msg.payload is not None:
+                    self._in[2].extend(msg.payload)
+                if b1&8:
+                    rcode = CONTINUE
+                    opts.append((BLOCK1,b1))
+                else:
+                    msg.payload = self._in[2]
+                    self._in = None
+                    opts.append((BLOCK1,b1))
+                    b1 = None
+        if res is not None and b1 is None:
+            num = 0
+            if b2 is not None:
+                num = b2>>4
+                if (b2&7)<szx:
+                    szx = b2&7
+            out = self._out
+            if num>0 and out is not None and out[0]==src and out[1]==msg.path:
+                # next block of the representation computed for the first one
+                r = out[2]
+            else:
+                r = self._call(res[0],msg)
+                self._out = [src,msg.path,r] if r[1] is not None and len(r[1])>(16<<szx) else None
+            rcode = r[0]
+            payload = r[1]
+            if (rcode>>5)==2:
+                if msg.observe is not None and code==GET:
+                    self._drop(token,None)
+                    if msg.observe==0 and res[1]:
+                        self._observers.append([src,token,msg.path,0,-1])
+                        opts.append((OBSERVE,0))
+                w = self._block_options(opts,r,num,szx)
+                ofs = w[0]
+                size = w[1]
+                if payload is not None and ofs>=len(payload) and ofs>0:
+                    rcode = BAD_REQUEST
+                    payload = None
+                    opts = []
+        r = self._respond(type,mid,token,rcode,opts,payload,ofs,size,src)
+        if type==CON:
+            self._last_src = src
+            self._last_mid = mid
+            self._last_n = r[1]
+
+    def serve(self):
+        """
+.. method:: serve()
+
+    Serve requests forever.
+
+        """
+        while True:
+            self.serve_once()
+
+    def notify(self,path):
+        """
+.. method:: notify(path)
+
+    Send the current representation of the resource at *path* to its observers, as non confirmable notifications. The handler of the
+    resource is called once per observer with a GET :class:`Message` having the observer as :attr:`~Message.source`.
+    Observers answering with a reset are dropped. Representations larger than a block are notified with their first block,
+    the observers fetch the others. It can be called from any thread.
+
+        """
+        while path.startswith("/"):
+            path = path[1:]
+        res = self._resources.get(path)
+        if res is None:
+            return
+        self._lock.acquire()
+        try:
+            self._notify(path,res)
+        finally:
+            self._lock.release()
+
+    def _notify(self,path,res):
+        # the transmit buffer no longer holds the last response
+        self._last_mid = -1
+        for o in self._observers:
+            if o[2]!=path:
+                continue
+            msg = Message(GET,None,None,None,o[0])
+            msg.path = path
+            r = self._call(res[0],msg)
+            o[3] = (o[3]+1)&0xffffff
+            opts = [(OBSERVE,o[3])]
+            w = self._block_options(opts,r,0,self._szx)
+            self._out = [o[0],path,r] if r[1] is not None and len(r[1])>self.block else None
+            o[4] = self._respond(NON,0,o[1],r[0],opts,r[1],w[0],w[1],o[0])[0]
@@ -0,0 +1,174 @@
+"""
+.. module:: collections
+
+***********
+Collections
+***********
+
+This module implements :class:`deque`, a native double ended queue as the one of the :samp:`collections` module of Python.
+
+    """
+
+@native_c("_deque_new",["csrc/collections/deque.c"])
+def _deque_new(maxlen,bytes):
+    pass
+
+@native_c("_deque_push",["csrc/collections/deque.c"])
+def _deque_push(d,obj,left,discard):
+    pass
+
+@native_c("_deque_pop",["csrc/collections/deque.c"])
+def _deque_pop(d,left,remove):
+    pass
+
+@native_c("_deque_get",["csrc/collections/deque.c"])
+def _deque_get(d,index):
+    pass
+
+@native_c("_deque_set",["csrc/collections/deque.c"])
+def _deque_set(d,index,obj):
+    pass
+
+@native_c("_deque_size",["csrc/collections/deque.c"])
+def _deque_size(d):
+    pass
+
+@native_c("_deque_clear",["csrc/collections/deque.c"])
+def _deque_clear(d):
+    pass
+
+@native_c("_deque_rotate",["csrc/collections/deque.c"])
+def _deque_rotate(d,n):
+    pass
+
+
+class _DequeIterator():
+    def __init__(self,d):
+        self._d = d
+        self._i = 0
+
+    def __iter__(self):
+        return self
+
+    def __next__(self):
+        if self._i>=_deque_size(self._d):
+            raise StopIteration
+        self._i+=1
+        return _deque_get(self._d,self._i-1)
+
+
+class deque():
+    """
+===========
+deque class
+===========
+
+.. class:: deque(iterable=(), maxlen=None)
+
+    Create a deque with the items of *iterable*. Items are appended and popped at both ends in O(1), with a single call
+    each: the deque is a ring that doubles when full (up to 65535 items), while a list pays O(n) for ``pop(0)`` and ``insert(0,x)``.
+
+    If *maxlen* is given, the deque is bounded: its ring is allocated once, and when it is full each item appended at an
+    end discards an item from the other end, so the deque keeps the last *maxlen* items.
+
+    Deques can be indexed (``d[0]``, ``d[-1]``), measured with :func:`len` and iterated. They are not thread safe: use
+    :class:`queue.Queue` to pass items between threads.
+
+    """
+    def __init__(self, iterable=(), maxlen=None):
+        self.maxlen = maxlen
+        self._d = _deque_new(0 if maxlen is None else maxlen,False)
+        for x in iterable:
+            _deque_push(self._d,x,False,True)
+
+    def append(self, x):
+        """
+.. method:: append(x)
+
+    Add *x* to the right end.
+
+        """
+        _deque_push(self._d,x,False,True)
+
+    def appendleft(self, x):
+        """
+.. method:: appendleft(x)
+
+    Add *x* to the left end.
+
+        """
+        _deque_push(self._d,x,True,True)
+
+    def extend(self, iterable):
+        """
+.. method:: extend(iterable)
+
+    Append the items of *iterable* to the right end.
+
+        """
+        for x in iterable:
+            _deque_push(self._d,x,False,True)
+
+    def extendleft(self, iterable):
+        """
+.. method:: extendleft(iterable)
+
+    Append the items of *iterable* to the left end, one by one: their order is reversed.
+
+        """
+        for x in iterable:
+            _deque_push(self._d,x,True,True)
+
+    def pop(self):
+        """
+.. method:: pop()
+
+    Remove and return the item at the right end. Raise :samp:`IndexError` if the deque is empty.
+
+        """
+        x = _deque_pop(self._d,False,True)
+        if x is self._d:
+            raise IndexError
+        return x
+
+    def popleft(self):
+        """
+.. method:: popleft()
+
+    Remove and return the item at the left end. Raise :samp:`IndexError` if the deque is empty.
+
+        """
+        x = _deque_pop(self._d,True,True)
+        if x is self._d:
+            raise IndexError
+        return x
+
+    def rotate(self, n=1):
+        """
+.. method:: rotate(n=1)
+
+    Rotate the deque *n* steps to the right, or to the left if *n* is negative: ``rotate(1)`` moves the last item to the left end.
+
+        """
+        _deque_rotate(self._d,n)
+
+    def clear(self):
+        """
+.. method:: clear()
+
+    Remove all the items.
+
+        """
+        _deque_clear(self._d)
+
+    def __len__(self):
+        return _deque_size(self._d)
+
+    def __getitem__(self, i):
+        return _deque_get(self._d,i)
+
+    def __setitem__(self, i, x):
+        _deque_set(self._d,i,x)
+
+    def __iter__(self):
+        return _DequeIterator(self._d)
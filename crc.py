@@ -0,0 +1,149 @@
+"""
+.. module:: crc
+
+****
+CRC
+****
+
+This module computes Cyclic Redundancy Checks natively, with lookup tables, over bytes, bytearrays, strings, shorts and shortarrays.
+Any CRC of 1 to 32 bits can be described by a model, a tuple *(width, poly, init, refin, refout, xorout)* as in the
+`catalogue of parametrised CRC algorithms <https://reveng.sourceforge.io/crc-catalogue/>`_. The most common are predefined:
+
+    * :samp:`CRC7_MMC`, the CRC of the commands of SD cards
+    * :samp:`CRC8`, CRC-8/SMBUS
+    * :samp:`CRC8_MAXIM`, of 1-Wire devices
+    * :samp:`CRC16_MODBUS`, of Modbus RTU frames
+    * :samp:`CRC16_CCITT_FALSE`
+    * :samp:`CRC16_XMODEM`, also the CRC of the data blocks of SD cards
+    * :samp:`CRC16_KERMIT`
+    * :samp:`CRC32`, of zlib, Ethernet and PNG
+    * :samp:`CRC32C`, Castagnoli
+
+::
+
+    import crc
+
+    c = crc.CRC(crc.CRC16_MODBUS)
+    c.update(frame,0,len(frame)-2)
+    ok = c.value() == frame[-2] | (frame[-1]<<8)
+
+    # one shot
+    check = crc.crc(crc.CRC32,data)
+
+The tables of a model are computed the first time it is used and shared by all the :class:`CRC` objects using it.
+On ports with a CRC unit, models it supports are computed by the hardware.
+
+    """
+
+CRC7_MMC = (7,0x09,0,False,False,0)
+CRC8 = (8,0x07,0,False,False,0)
+CRC8_MAXIM = (8,0x31,0,True,True,0)
+CRC16_MODBUS = (16,0x8005,0xffff,True,True,0)
+CRC16_CCITT_FALSE = (16,0x1021,0xffff,False,False,0)
+CRC16_XMODEM = (16,0x1021,0,False,False,0)
+CRC16_KERMIT = (16,0x1021,0,True,True,0)
+CRC32 = (32,0x04C11DB7,0xFFFFFFFF,True,True,0xFFFFFFFF)
+CRC32C = (32,0x1EDC6F41,0xFFFFFFFF,True,True,0xFFFFFFFF)
+
+@native_c("__crc_model",["csrc/crc/crc.c"])
+def _model(width,poly,init,refin,refout,xorout,slices):
+    pass
+
+@native_c("__crc_reset",["csrc/crc/crc.c"])
+def _reset(model,reg):
+    pass
+
+@native_c("__crc_update",["csrc/crc/crc.c"])
+def _update(model,reg,data,start,stop):
+    pass
+
+@native_c("__crc_value",["csrc/crc/crc.c"])
+def _value(model,reg):
+    pass
+
+# [model tuple, slices, tables] of the models in use
+_models = []
+
+def _same(a,b):
+    for i in range(6):
+        if a[i]!=b[i]:
+            return False
+    return True
+
+def _tables_of(model,fast):
+    slices = 4 if fast else 1
+    for m in _models:
+        if m[1]==slices and _same(m[0],model):
+            return m[2]
+    t = _model(model[0],model[1],model[2],1 if model[3] else 0,1 if model[4] else 0,model[5],slices)
+    _models.append([model,slices,t])
+    return t
+
+
+class CRC():
+    """
+=========
+CRC class
+=========
+
+.. class:: CRC(model=CRC32,fast=False)
+
+    Creates a CRC computation for *model*. With *fast* set, the model uses four tables instead of one (4 KB of RAM instead of 1 KB) and
+    consumes 4 bytes per step (slice-by-4), about twice as fast on long buffers.
+
+    """
+    def __init__(self,model=CRC32,fast=False,_model=None):
+        self._model = _model if _model is not None else _tables_of(model,fast)
+        self._reg = bytearray(4)
+        _reset(self._model,self._reg)
+
+    def update(self,data,start=0,stop=-1):
+        """
+.. method:: update(data,start=0,stop=-1)
+
+        Feeds the elements of *data* from *start* to *stop* (the end if negative) to the CRC, and returns the object.
+        Shorts and shortarrays are fed as they are in memory (low byte first), and *start* and *stop* count shorts.
+        Buffers of 256 bytes or more are processed with the GIL released.
+
+        """
+        _update(self._model,self._reg,data,start,stop)
+        return self
+
+    def value(self):
+        """
+.. method:: value()
+
+        Returns the CRC of the data fed so far. The object can still be updated afterwards.
+
+        """
+        return _value(self._model,self._reg)
+
+    def reset(self):
+        """
+.. method:: reset()
+
+        Starts a new computation.
+
+        """
+        _reset(self._model,self._reg)
+
+    def copy(self):
+        """
+.. method:: copy()
+
+        Returns a new object with the same state, to compute the CRC of a common prefix followed by different data.
+
+        """
+        c = CRC(None,False,self._model)
+        c._reg = bytearray(self._reg)
+        return c
+
+
+def crc(model,data,start=0,stop=-1):
+    """
+.. function:: crc(model,data,start=0,stop=-1)
+
+    Returns the CRC with *model* of the elements of *data* from *start* to *stop*, as :samp:`CRC(model).update(data,start,stop).value()`.
+
+    """
+    return CRC(model).update(data,start,stop).value()
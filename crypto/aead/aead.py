@@ -0,0 +1,110 @@
+"""
+.. module: aead
+
+**************************************
+Authenticated Encryption with Data
+**************************************
+
+This module implements authenticated encryption with associated data (AEAD): a message is encrypted and tagged, so that
+any change to the ciphertext or to the associated data (headers sent in clear) is detected on decryption.
+
+The following modes are supported, selectable in the :class:`AEAD` constructor with one of these constants:
+
+    * :samp:`AES_GCM`, AES in Galois/Counter mode, with keys of 16, 24 or 32 bytes, nonces usually of 12 bytes and tags up to 16 bytes
+    * :samp:`AES_CCM`, AES in counter mode with CBC-MAC, with nonces of 7 to 13 bytes and even tags of 4 to 16 bytes
+    * :samp:`CHACHA20_POLY1305`, as in RFC 7539, with keys of 32 bytes, nonces of 12 bytes and tags of 16 bytes
+
+Encryption and decryption run natively into buffers given by the caller, without allocating memory per message: the key
+schedule is computed once by the constructor. A nonce must never be reused with the same key.
+
+The module is based on the C library `cifra <https://github.com/ctz/cifra>`_.
+
+"""
+
+@c_native("zs_aead_init",[
+    "csrc/aead_ifc.c",
+    "#crypto/hash/csrc/cifra/src/aes.c",
+    "#crypto/hash/csrc/cifra/src/blockwise.c",
+    "#crypto/hash/csrc/cifra/src/modes.c",
+    "#crypto/hash/csrc/cifra/src/gf128.c",
+    "#crypto/hash/csrc/cifra/src/gcm.c",
+    "#crypto/hash/csrc/cifra/src/cbcmac.c",
+    "#crypto/hash/csrc/cifra/src/ccm.c",
+    "#crypto/hash/csrc/cifra/src/chacha20.c",
+    "#crypto/hash/csrc/cifra/src/poly1305.c",
+    "#crypto/hash/csrc/cifra/src/chacha20poly1305.c",
+    ],[],["-I.../../hash/csrc/cifra/src","-I.../../hash/csrc/cifra/src/ext"])
+def __aead_init(mode,key):
+    pass
+
+@c_native("zs_aead_crypt",[])
+def __aead_crypt(mode,ctx,nonce,aad,src,dst,ofs,tag,decrypt):
+    pass
+
+
+AES_GCM = 0
+AES_CCM = 1
+CHACHA20_POLY1305 = 2
+
+_TAG_SIZE = 16
+
+
+class AEAD():
+    """
+==============
+The AEAD class
+==============
+
+.. class:: AEAD(mode,key)
+
+       Create an AEAD cipher for *mode* with *key* (bytes or bytearray).
+       The same instance can encrypt and decrypt any number of messages, each with its own nonce.
+
+    """
+    def __init__(self,mode,key):
+        self.mode = mode
+        self.ctx = __aead_init(mode,key)
+
+    def encrypt_into(self,nonce,src,dst,tag,aad=b'',ofs=0):
+        """
+.. method:: encrypt_into(nonce,src,dst,tag,aad=b'',ofs=0)
+
+        Encrypt *src* into the bytearray *dst* starting at *ofs*, authenticating *src* and *aad*. *dst* can be *src* itself,
+        to encrypt in place. The tag is written into the bytearray *tag*, whose length selects the tag size.
+
+        """
+        __aead_crypt(self.mode,self.ctx,nonce,aad,src,dst,ofs,tag,False)
+
+    def decrypt_into(self,nonce,src,tag,dst,aad=b'',ofs=0):
+        """
+.. method:: decrypt_into(nonce,src,tag,dst,aad=b'',ofs=0)
+
+        Decrypt *src* into the bytearray *dst* starting at *ofs*, checking *tag* against *src* and *aad*. *dst* can be *src* itself.
+        Return True if the message is authentic; otherwise return False and leave the plaintext area of *dst* cleared.
+
+        """
+        return __aead_crypt(self.mode,self.ctx,nonce,aad,src,dst,ofs,tag,True)
+
+    def encrypt(self,nonce,data,aad=b'',tag_size=_TAG_SIZE):
+        """
+.. method:: encrypt(nonce,data,aad=b'',tag_size=16)
+
+        Return a tuple with the ciphertext of *data* and its tag, both new bytearrays.
+
+        """
+        dst = bytearray(len(data))
+        tag = bytearray(tag_size)
+        __aead_crypt(self.mode,self.ctx,nonce,aad,data,dst,0,tag,False)
+        return dst,tag
+
+    def decrypt(self,nonce,data,tag,aad=b''):
+        """
+.. method:: decrypt(nonce,data,tag,aad=b'')
+
+        Return the plaintext of *data* as a new bytearray, or None if *data*, *tag* or *aad* are not authentic.
+
+        """
+        dst = bytearray(len(data))
+        if __aead_crypt(self.mode,self.ctx,nonce,aad,data,dst,0,tag,True):
+            return dst
+        return None
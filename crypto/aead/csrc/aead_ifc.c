@@ -0,0 +1,116 @@
+#include "zerynth.h"
+#include "aes.h"
+#include "modes.h"
+#include "chacha20poly1305.h"
+
+//#define printf(...) vbl_printf_stdout(__VA_ARGS__)
+
+#define AES_GCM 0
+#define AES_CCM 1
+#define CHACHA20_POLY1305 2
+
+/*
+ * A key context is a bytes object with the AES key schedule, computed once per key, or the 32 bytes ChaCha20 key.
+ * Encryption and decryption read and write caller buffers only: nothing is allocated per message.
+ */
+
+C_NATIVE(zs_aead_init){
+    NATIVE_UNWARN();
+    uint32_t mode;
+    uint8_t *key;
+    uint32_t key_len;
+
+    if (parse_py_args("is", nargs, args, &mode, &key, &key_len) != 2) {
+        return ERR_TYPE_EXC;
+    }
+    if (mode == CHACHA20_POLY1305) {
+        if (key_len != 32) return ERR_VALUE_EXC;
+        *res = pbytes_new(32, key);
+    } else if (mode == AES_GCM || mode == AES_CCM) {
+        if (key_len != 16 && key_len != 24 && key_len != 32) return ERR_VALUE_EXC;
+        PBytes *bres = pbytes_new(sizeof(cf_aes_context), NULL);
+        cf_aes_init((cf_aes_context*)PSEQUENCE_BYTES(bres), key, key_len);
+        *res = bres;
+    } else {
+        return ERR_VALUE_EXC;
+    }
+    return ERR_OK;
+}
+
+/* checks nonce and tag lengths of mode, as cifra asserts them */
+static int aead_check(uint32_t mode, uint32_t nonce_len, uint32_t tag_len){
+    switch (mode) {
+        case AES_GCM:
+            return nonce_len > 0 && tag_len > 0 && tag_len <= 16;
+        case AES_CCM:
+            return nonce_len >= 7 && nonce_len <= 13 && tag_len >= 4 && tag_len <= 16 && !(tag_len & 1);
+        case CHACHA20_POLY1305:
+            return nonce_len == 12 && tag_len == 16;
+    }
+    return 0;
+}
+
+/*
+ * args: mode, ctx, nonce, aad, src, dst, ofs, tag, decrypt
+ * encrypts (or decrypts) src into the bytearray dst from ofs, that can be src itself. On encryption the tag is written
+ * into the bytearray tag (its length is the tag length), on decryption it is checked. Returns False if the tag is wrong,
+ * leaving dst cleared
+ */
+C_NATIVE(zs_aead_crypt){
+    NATIVE_UNWARN();
+    uint32_t mode;
+    uint8_t *pctx, *nonce, *aad, *src, *dst, *tag;
+    uint32_t ctx_len, nonce_len, aad_len, src_len, tag_len;
+    int32_t ofs, err = 0, decrypt;
+
+    if (parse_py_args("issss", nargs, args, &mode, &pctx, &ctx_len, &nonce, &nonce_len, &aad, &aad_len, &src, &src_len) != 5 || nargs != 9) {
+        return ERR_TYPE_EXC;
+    }
+    if (PTYPE(args[5]) != PBYTEARRAY || !IS_PSMALLINT(args[6]) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[7]))) {
+        return ERR_TYPE_EXC;
+    }
+    decrypt = (args[8] == PBOOL_TRUE());
+    if (!decrypt && PTYPE(args[7]) != PBYTEARRAY) {
+        return ERR_TYPE_EXC;
+    }
+    ofs = PSMALLINT_VALUE(args[6]);
+    if (ofs < 0 || ofs + src_len > PSEQUENCE_ELEMENTS(args[5])) {
+        return ERR_INDEX_EXC;
+    }
+    tag = PSEQUENCE_BYTES(args[7]);
+    tag_len = PSEQUENCE_ELEMENTS(args[7]);
+    if (!aead_check(mode, nonce_len, tag_len)) {
+        return ERR_VALUE_EXC;
+    }
+    if (ctx_len != ((mode == CHACHA20_POLY1305) ? 32 : sizeof(cf_aes_context))) {
+        return ERR_VALUE_EXC;
+    }
+    dst = PSEQUENCE_BYTES(args[5]) + ofs;
+
+    RELEASE_GIL();
+    switch (mode) {
+        case AES_GCM:
+            if (decrypt)
+                err = cf_gcm_decrypt(&cf_aes, pctx, src, src_len, aad, aad_len, nonce, nonce_len, tag, tag_len, dst);
+            else
+                cf_gcm_encrypt(&cf_aes, pctx, src, src_len, aad, aad_len, nonce, nonce_len, dst, tag, tag_len);
+            break;
+        case AES_CCM:
+            if (decrypt)
+                err = cf_ccm_decrypt(&cf_aes, pctx, src, src_len, 15 - nonce_len, aad, aad_len, nonce, nonce_len, tag, tag_len, dst);
+            else
+                cf_ccm_encrypt(&cf_aes, pctx, src, src_len, 15 - nonce_len, aad, aad_len, nonce, nonce_len, dst, tag, tag_len);
+            break;
+        case CHACHA20_POLY1305:
+            if (decrypt)
+                err = cf_chacha20poly1305_decrypt(pctx, nonce, aad, aad_len, src, src_len, tag, dst);
+            else
+                cf_chacha20poly1305_encrypt(pctx, nonce, aad, aad_len, src, src_len, dst, tag);
+            break;
+    }
+    ACQUIRE_GIL();
+    if (err)
+        memset(dst, 0, src_len);
+    *res = err ? PBOOL_FALSE() : PBOOL_TRUE();
+    return ERR_OK;
+}
@@ -0,0 +1,450 @@
+/*
+ * Ed25519 after tweetnacl (public domain), with the field arithmetic of cifra's curve25519.tweetnacl.c.
+ * Hashing is streamed through cifra's SHA-512, so messages are never copied, and verification rejects
+ * non canonical S as RFC 8032 requires.
+ */
+
+#include "ed25519.h"
+#include "sha2.h"
+
+typedef int64_t gf[16];
+
+static const gf gf0,
+                gf1 = {1},
+                D = {0x78a3, 0x1359, 0x4dca, 0x75eb,
+                     0xd8ab, 0x4141, 0x0a4d, 0x0070,
+                     0xe898, 0x7779, 0x4079, 0x8cc7,
+                     0xfe73, 0x2b6f, 0x6cee, 0x5203},
+                D2 = {0xf159, 0x26b2, 0x9b94, 0xebd6,
+                      0xb156, 0x8283, 0x149a, 0x00e0,
+                      0xd130, 0xeef3, 0x80f2, 0x198e,
+                      0xfce7, 0x56df, 0xd9dc, 0x2406},
+                X = {0xd51a, 0x8f25, 0x2d60, 0xc956,
+                     0xa7b2, 0x9525, 0xc760, 0x692c,
+                     0xdc5c, 0xfdd6, 0xe231, 0xc0a4,
+                     0x53fe, 0xcd6e, 0x36d3, 0x2169},
+                Y = {0x6658, 0x6666, 0x6666, 0x6666,
+                     0x6666, 0x6666, 0x6666, 0x6666,
+                     0x6666, 0x6666, 0x6666, 0x6666,
+                     0x6666, 0x6666, 0x6666, 0x6666},
+                I = {0xa0b0, 0x4a0e, 0x1b27, 0xc4ee,
+                     0xe478, 0xad2f, 0x1806, 0x2f43,
+                     0xd7a7, 0x3dfb, 0x0099, 0x2b4d,
+                     0xdf0b, 0x4fc1, 0x2480, 0x2b83};
+
+/* the group order, little endian */
+static const int64_t L[32] = {0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+                              0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+                              0, 0, 0, 0, 0, 0, 0, 0,
+                              0, 0, 0, 0, 0, 0, 0, 0x10};
+
+/* ---------- field arithmetic mod 2^255 - 19, 16 limbs of 16 bits ---------- */
+
+static void set25519(gf r, const gf a)
+{
+  for (size_t i = 0; i < 16; i++)
+    r[i] = a[i];
+}
+
+static void car25519(gf o)
+{
+  int64_t c;
+
+  for (size_t i = 0; i < 16; i++)
+  {
+    o[i] += (1LL << 16);
+    c = o[i] >> 16;
+    o[(i + 1) * (i < 15)] += c - 1 + 37 * (c - 1) * (i == 15);
+    o[i] -= c << 16;
+  }
+}
+
+static void sel25519(gf p, gf q, int b)
+{
+  int64_t tmp, mask = ~(b-1);
+  for (size_t i = 0; i < 16; i++)
+  {
+    tmp = mask & (p[i] ^ q[i]);
+    p[i] ^= tmp;
+    q[i] ^= tmp;
+  }
+}
+
+static void pack25519(uint8_t out[32], const gf n)
+{
+  int b;
+  gf m, t;
+  set25519(t, n);
+  car25519(t);
+  car25519(t);
+  car25519(t);
+
+  for(size_t j = 0; j < 2; j++)
+  {
+    m[0] = t[0] - 0xffed;
+    for (size_t i = 1; i < 15; i++)
+    {
+      m[i] = t[i] - 0xffff - ((m[i - 1] >> 16) & 1);
+      m[i - 1] &= 0xffff;
+    }
+    m[15] = t[15] - 0x7fff - ((m[14] >> 16) & 1);
+    b = (m[15] >> 16) & 1;
+    m[14] &= 0xffff;
+    sel25519(t, m, 1 - b);
+  }
+
+  for (size_t i = 0; i < 16; i++)
+  {
+    out[2 * i] = t[i] & 0xff;
+    out[2 * i + 1] = t[i] >> 8;
+  }
+}
+
+static void unpack25519(gf o, const uint8_t *n)
+{
+  for (size_t i = 0; i < 16; i++)
+    o[i] = n[2 * i] + ((int64_t) n[2 * i + 1] << 8);
+  o[15] &= 0x7fff;
+}
+
+/* 0 if a == b, -1 otherwise */
+static int verify32(const uint8_t *x, const uint8_t *y)
+{
+  uint32_t d = 0;
+  for (size_t i = 0; i < 32; i++)
+    d |= x[i] ^ y[i];
+  return (1 & ((d - 1) >> 8)) - 1;
+}
+
+static int neq25519(const gf a, const gf b)
+{
+  uint8_t c[32], d[32];
+  pack25519(c, a);
+  pack25519(d, b);
+  return verify32(c, d);
+}
+
+static uint8_t par25519(const gf a)
+{
+  uint8_t d[32];
+  pack25519(d, a);
+  return d[0] & 1;
+}
+
+static void add(gf o, const gf a, const gf b)
+{
+  for (size_t i = 0; i < 16; i++)
+    o[i] = a[i] + b[i];
+}
+
+static void sub(gf o, const gf a, const gf b)
+{
+  for (size_t i = 0; i < 16; i++)
+    o[i] = a[i] - b[i];
+}
+
+static void mul(gf o, const gf a, const gf b)
+{
+  int64_t t[31];
+
+  for (size_t i = 0; i < 31; i++)
+    t[i] = 0;
+
+  for (size_t i = 0; i < 16; i++)
+    for (size_t j = 0; j < 16; j++)
+      t[i + j] += a[i] * b[j];
+
+  for (size_t i = 0; i < 15; i++)
+    t[i] += 38 * t[i + 16];
+
+  for (size_t i = 0; i < 16; i++)
+    o[i] = t[i];
+
+  car25519(o);
+  car25519(o);
+}
+
+static void sqr(gf o, const gf a)
+{
+  mul(o, a, a);
+}
+
+static void inv25519(gf o, const gf i)
+{
+  gf c;
+  set25519(c, i);
+  for (int a = 253; a >= 0; a--)
+  {
+    sqr(c, c);
+    if (a != 2 && a != 4)
+      mul(c, c, i);
+  }
+  set25519(o, c);
+}
+
+/* o = i^((p - 5) / 8) */
+static void pow2523(gf o, const gf i)
+{
+  gf c;
+  set25519(c, i);
+  for (int a = 250; a >= 0; a--)
+  {
+    sqr(c, c);
+    if (a != 1)
+      mul(c, c, i);
+  }
+  set25519(o, c);
+}
+
+/* ---------- points in extended coordinates (X, Y, Z, T) ---------- */
+
+static void padd(gf p[4], gf q[4])
+{
+  gf a, b, c, d, t, e, f, g, h;
+
+  sub(a, p[1], p[0]);
+  sub(t, q[1], q[0]);
+  mul(a, a, t);
+  add(b, p[0], p[1]);
+  add(t, q[0], q[1]);
+  mul(b, b, t);
+  mul(c, p[3], q[3]);
+  mul(c, c, D2);
+  mul(d, p[2], q[2]);
+  add(d, d, d);
+  sub(e, b, a);
+  sub(f, d, c);
+  add(g, d, c);
+  add(h, b, a);
+
+  mul(p[0], e, f);
+  mul(p[1], h, g);
+  mul(p[2], g, f);
+  mul(p[3], e, h);
+}
+
+static void cswap(gf p[4], gf q[4], uint8_t b)
+{
+  for (size_t i = 0; i < 4; i++)
+    sel25519(p[i], q[i], b);
+}
+
+static void pack(uint8_t *r, gf p[4])
+{
+  gf tx, ty, zi;
+  inv25519(zi, p[2]);
+  mul(tx, p[0], zi);
+  mul(ty, p[1], zi);
+  pack25519(r, ty);
+  r[31] ^= par25519(tx) << 7;
+}
+
+/* p = s * q, constant time; q is destroyed */
+static void scalarmult(gf p[4], gf q[4], const uint8_t *s)
+{
+  set25519(p[0], gf0);
+  set25519(p[1], gf1);
+  set25519(p[2], gf1);
+  set25519(p[3], gf0);
+  for (int i = 255; i >= 0; --i)
+  {
+    uint8_t b = (s[i / 8] >> (i & 7)) & 1;
+    cswap(p, q, b);
+    padd(q, p);
+    padd(p, p);
+    cswap(p, q, b);
+  }
+}
+
+static void scalarbase(gf p[4], const uint8_t *s)
+{
+  gf q[4];
+  set25519(q[0], X);
+  set25519(q[1], Y);
+  set25519(q[2], gf1);
+  mul(q[3], X, Y);
+  scalarmult(p, q, s);
+}
+
+/* r = -point of p; returns -1 if p is not a valid encoding */
+static int unpackneg(gf r[4], const uint8_t p[32])
+{
+  gf t, chk, num, den, den2, den4, den6;
+  set25519(r[2], gf1);
+  unpack25519(r[1], p);
+  sqr(num, r[1]);
+  mul(den, num, D);
+  sub(num, num, r[2]);
+  add(den, r[2], den);
+
+  sqr(den2, den);
+  sqr(den4, den2);
+  mul(den6, den4, den2);
+  mul(t, den6, num);
+  mul(t, t, den);
+
+  pow2523(t, t);
+  mul(t, t, num);
+  mul(t, t, den);
+  mul(t, t, den);
+  mul(r[0], t, den);
+
+  sqr(chk, r[0]);
+  mul(chk, chk, den);
+  if (neq25519(chk, num))
+    mul(r[0], r[0], I);
+
+  sqr(chk, r[0]);
+  mul(chk, chk, den);
+  if (neq25519(chk, num))
+    return -1;
+
+  if (par25519(r[0]) == (p[31] >> 7))
+    sub(r[0], gf0, r[0]);
+
+  mul(r[3], r[0], r[1]);
+  return 0;
+}
+
+/* ---------- scalars mod L ---------- */
+
+static void modL(uint8_t *r, int64_t x[64])
+{
+  int64_t carry;
+  int i, j;
+
+  for (i = 63; i >= 32; --i)
+  {
+    carry = 0;
+    for (j = i - 32; j < i - 12; ++j)
+    {
+      x[j] += carry - 16 * x[i] * L[j - (i - 32)];
+      carry = (x[j] + 128) >> 8;
+      x[j] -= carry << 8;
+    }
+    x[j] += carry;
+    x[i] = 0;
+  }
+  carry = 0;
+  for (j = 0; j < 32; j++)
+  {
+    x[j] += carry - (x[31] >> 4) * L[j];
+    carry = x[j] >> 8;
+    x[j] &= 255;
+  }
+  for (j = 0; j < 32; j++)
+    x[j] -= carry * L[j];
+  for (i = 0; i < 32; i++)
+  {
+    x[i + 1] += x[i] >> 8;
+    r[i] = x[i] & 255;
+  }
+}
+
+/* r (64 bytes) = r mod L, in the first 32 bytes */
+static void reduce(uint8_t *r)
+{
+  int64_t x[64];
+  for (size_t i = 0; i < 64; i++)
+  {
+    x[i] = r[i];
+    r[i] = 0;
+  }
+  modL(r, x);
+}
+
+/* 1 if the little endian s is below L */
+static int scalar_canonical(const uint8_t *s)
+{
+  for (int i = 31; i >= 0; i--)
+  {
+    if (s[i] != L[i])
+      return s[i] < L[i];
+  }
+  return 0;
+}
+
+/* h = SHA-512(a || b || m) mod L */
+static void hash_reduce(uint8_t h[64], const uint8_t *a, const uint8_t *b, size_t b_len,
+                        const uint8_t *m, size_t m_len)
+{
+  cf_sha512_context ctx;
+  cf_sha512_init(&ctx);
+  cf_sha512_update(&ctx, a, 32);
+  if (b_len)
+    cf_sha512_update(&ctx, b, b_len);
+  cf_sha512_update(&ctx, m, m_len);
+  cf_sha512_digest_final(&ctx, h);
+  reduce(h);
+}
+
+/* d = clamped secret scalar of seed, followed by the nonce prefix */
+static void expand_seed(uint8_t d[64], const uint8_t seed[32])
+{
+  cf_sha512_context ctx;
+  cf_sha512_init(&ctx);
+  cf_sha512_update(&ctx, seed, 32);
+  cf_sha512_digest_final(&ctx, d);
+  d[0] &= 248;
+  d[31] &= 127;
+  d[31] |= 64;
+}
+
+/* ---------- API ---------- */
+
+void ed25519_public_key(uint8_t public[32], const uint8_t seed[32])
+{
+  uint8_t d[64];
+  gf p[4];
+
+  expand_seed(d, seed);
+  scalarbase(p, d);
+  pack(public, p);
+}
+
+void ed25519_sign(uint8_t signature[64], const uint8_t *message, size_t message_len,
+                  const uint8_t seed[32], const uint8_t public[32])
+{
+  uint8_t d[64], h[64], r[64];
+  int64_t x[64];
+  gf p[4];
+
+  expand_seed(d, seed);
+
+  /* r = H(prefix || M), R = rB */
+  hash_reduce(r, d + 32, NULL, 0, message, message_len);
+  scalarbase(p, r);
+  pack(signature, p);
+
+  /* S = r + H(R || A || M) a */
+  hash_reduce(h, signature, public, 32, message, message_len);
+  for (size_t i = 0; i < 64; i++)
+    x[i] = 0;
+  for (size_t i = 0; i < 32; i++)
+    x[i] = r[i];
+  for (size_t i = 0; i < 32; i++)
+    for (size_t j = 0; j < 32; j++)
+      x[i + j] += h[i] * (int64_t) d[j];
+  modL(signature + 32, x);
+}
+
+int ed25519_verify(const uint8_t signature[64], const uint8_t *message, size_t message_len,
+                   const uint8_t public[32])
+{
+  uint8_t t[32], h[64];
+  gf p[4], q[4];
+
+  if (!scalar_canonical(signature + 32))
+    return 0;
+  if (unpackneg(q, public))
+    return 0;
+
+  /* R == SB - hA */
+  hash_reduce(h, signature, public, 32, message, message_len);
+  scalarmult(p, q, h);
+  scalarbase(q, signature + 32);
+  padd(p, q);
+  pack(t, p);
+
+  return verify32(signature, t) == 0;
+}
@@ -0,0 +1,23 @@
+#ifndef _ED25519_H_
+#define _ED25519_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Ed25519 signatures (RFC 8032) on top of the cifra SHA-512. Private keys are the 32 bytes seeds of the RFC,
+ * public keys are 32 bytes and signatures 64 bytes.
+ */
+
+/* public = public key of seed */
+void ed25519_public_key(uint8_t public[32], const uint8_t seed[32]);
+
+/* signature of message with seed and its public key */
+void ed25519_sign(uint8_t signature[64], const uint8_t *message, size_t message_len,
+                  const uint8_t seed[32], const uint8_t public[32]);
+
+/* returns 1 if signature is a valid signature of message for public, 0 otherwise */
+int ed25519_verify(const uint8_t signature[64], const uint8_t *message, size_t message_len,
+                   const uint8_t public[32]);
+
+#endif
@@ -0,0 +1,98 @@
+#include "ed25519.h"
+#include "zerynth.h"
+#include "zerynth_drbg.h"
+
+//#define printf(...) vbl_printf_stdout(__VA_ARGS__)
+
+C_NATIVE(zc_ed25519_make_keys)
+{
+    NATIVE_UNWARN();
+    uint8_t seed[32];
+    uint8_t public[32];
+
+    RELEASE_GIL();
+    zdrbg_fill(seed,32);
+    ed25519_public_key(public,seed);
+    ACQUIRE_GIL();
+    PTuple *tpl = ptuple_new(2,NULL);
+    PTUPLE_SET_ITEM(tpl,0,pbytes_new(32,public));
+    PTUPLE_SET_ITEM(tpl,1,pbytes_new(32,seed));
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(zc_ed25519_public_key)
+{
+    NATIVE_UNWARN();
+    uint8_t *seed;
+    uint32_t seed_len;
+    uint8_t public[32];
+
+    if (parse_py_args("s", nargs, args, &seed, &seed_len) != 1) {
+        return ERR_TYPE_EXC;
+    }
+    if (seed_len != 32) {
+        return ERR_VALUE_EXC;
+    }
+    RELEASE_GIL();
+    ed25519_public_key(public,seed);
+    ACQUIRE_GIL();
+    *res = pbytes_new(32,public);
+    return ERR_OK;
+}
+
+/*
+ * args: message, seed, public
+ * public can be empty, it is then derived from seed (one more scalar multiplication)
+ */
+C_NATIVE(zc_ed25519_sign)
+{
+    NATIVE_UNWARN();
+    uint8_t *message;
+    uint32_t message_len;
+    uint8_t *seed;
+    uint32_t seed_len;
+    uint8_t *pbkey;
+    uint32_t pbkey_len;
+    uint8_t public[32];
+
+    if (parse_py_args("sss", nargs, args, &message, &message_len, &seed, &seed_len, &pbkey, &pbkey_len) != 3) {
+        return ERR_TYPE_EXC;
+    }
+    if (seed_len != 32 || (pbkey_len && pbkey_len != 32)) {
+        return ERR_VALUE_EXC;
+    }
+    PBytes *signature = pbytes_new(64,NULL);
+    RELEASE_GIL();
+    if (!pbkey_len) {
+        ed25519_public_key(public,seed);
+        pbkey = public;
+    }
+    ed25519_sign(PSEQUENCE_BYTES(signature),message,message_len,seed,pbkey);
+    ACQUIRE_GIL();
+    *res = signature;
+    return ERR_OK;
+}
+
+C_NATIVE(zc_ed25519_verify)
+{
+    NATIVE_UNWARN();
+    uint8_t *message;
+    uint32_t message_len;
+    uint8_t *signature;
+    uint32_t signature_len;
+    uint8_t *pbkey;
+    uint32_t pbkey_len;
+    int valid = 0;
+
+    if (parse_py_args("sss", nargs, args, &message, &message_len, &signature, &signature_len, &pbkey, &pbkey_len) != 3) {
+        return ERR_TYPE_EXC;
+    }
+    if (signature_len == 64 && pbkey_len == 32) {
+        RELEASE_GIL();
+        valid = ed25519_verify(signature,message,message_len,pbkey);
+        ACQUIRE_GIL();
+    }
+    *res = valid ? PBOOL_TRUE() : PBOOL_FALSE();
+    return ERR_OK;
+}
@@ -0,0 +1,67 @@
+#include "curve25519.h"
+#include "zerynth.h"
+#include "zerynth_drbg.h"
+
+//#define printf(...) vbl_printf_stdout(__VA_ARGS__)
+
+/*
+ * X25519 over cifra's curve25519-donna: 64 bit limbs products, that Cortex-M3 and up do with one UMULL/SMLAL,
+ * several times faster than the tweetnacl backend cifra selects by default.
+ */
+
+C_NATIVE(zc_x25519_make_keys)
+{
+    NATIVE_UNWARN();
+    uint8_t private[32];
+    uint8_t public[32];
+
+    RELEASE_GIL();
+    zdrbg_fill(private,32);
+    cf_curve25519_mul_base(public,private);
+    ACQUIRE_GIL();
+    PTuple *tpl = ptuple_new(2,NULL);
+    PTUPLE_SET_ITEM(tpl,0,pbytes_new(32,public));
+    PTUPLE_SET_ITEM(tpl,1,pbytes_new(32,private));
+    *res = tpl;
+    return ERR_OK;
+}
+
+/*
+ * args: scalar, point
+ * returns scalar * point, or scalar * base point if point is empty. A result of all zeros (point of small order)
+ * raises ValueError
+ */
+C_NATIVE(zc_x25519_mul)
+{
+    NATIVE_UNWARN();
+    uint8_t *scalar;
+    uint32_t scalar_len;
+    uint8_t *point;
+    uint32_t point_len;
+    uint8_t out[32];
+    uint8_t acc = 0;
+    int i;
+
+    if (parse_py_args("ss", nargs, args, &scalar, &scalar_len, &point, &point_len) != 2) {
+        return ERR_TYPE_EXC;
+    }
+    if (scalar_len != 32 || (point_len && point_len != 32)) {
+        return ERR_VALUE_EXC;
+    }
+
+    RELEASE_GIL();
+    if (point_len) {
+        cf_curve25519_mul(out,scalar,point);
+    } else {
+        cf_curve25519_mul_base(out,scalar);
+    }
+    ACQUIRE_GIL();
+    for (i = 0; i < 32; i++) {
+        acc |= out[i];
+    }
+    if (!acc) {
+        return ERR_VALUE_EXC;
+    }
+    *res = pbytes_new(32,out);
+    return ERR_OK;
+}
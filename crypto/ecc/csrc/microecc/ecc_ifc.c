@@ -1,6 +1,7 @@
 #include "uECC.h"
 #include "hash_common.h"
 #include "zerynth.h"
+#include "zerynth_drbg.h"
 
 //#define printf(...) vbl_printf_stdout(__VA_ARGS__)
 
@@ -15,14 +16,6 @@ const struct uECC_Curve_t* curves[5];
 #define ECC_SECP256K1 4
 #define ECC_MAX_CURVE 5
 
-int _zc_rng(uint8_t *dest, unsigned size){
-    int i;
-    for(i=0;i<size;i++){
-        dest[i] = vhalRngGenerate()%256;
-    }
-    return 1;
-}
-
 void init_curves()
 {
 
@@ -42,7 +35,7 @@ void init_curves()
 #if uECC_SUPPORTS_secp256k1
         curves[ECC_SECP256K1] = uECC_secp256k1();
 #endif
-        uECC_set_rng(_zc_rng);
+        uECC_set_rng(zdrbg_rng);
         curves_initialized = 1;
     }
 }
@@ -278,3 +271,99 @@ C_NATIVE(zc_curve_sign){
     *res = tpl;
     return ERR_OK;
 }
+
+/*
+ * args: curve, pbkey
+ * returns the verification table of pbkey (uncompressed, or compressed if 33 bytes long), or of the generator if
+ * pbkey is empty
+ */
+C_NATIVE(zc_curve_verify_table){
+    NATIVE_UNWARN();
+    uint32_t thecurve;
+    uint32_t pblen;
+    uint8_t* pbkey;
+    uint8_t public[64];
+
+    if (parse_py_args("is", nargs, args, &thecurve,&pbkey,&pblen) != 2) {
+        return ERR_TYPE_EXC;
+    }
+
+    CHECK_CURVE();
+    const struct uECC_Curve_t* curve = curves[thecurve];
+
+    if (pblen && pblen == uECC_curve_public_key_size(curve)/2+1) {
+        uECC_decompress(pbkey,public,curve);
+        pbkey = public;
+    } else if (pblen && pblen != uECC_curve_public_key_size(curve)) {
+        return ERR_VALUE_EXC;
+    }
+    PBytes *table = pbytes_new(uECC_verify_table_size(curve),NULL);
+    RELEASE_GIL();
+    if (!uECC_verify_table(pblen ? pbkey : NULL,PSEQUENCE_BYTES(table),curve)) {
+        ACQUIRE_GIL();
+        return ERR_VALUE_EXC;
+    }
+    ACQUIRE_GIL();
+    *res = table;
+    return ERR_OK;
+}
+
+/*
+ * args: curve, gtable, tables, messages, signatures
+ * the last three are lists (or tuples) of the same length; returns the list of the verification results
+ */
+C_NATIVE(zc_curve_verify_batch){
+    NATIVE_UNWARN();
+    uint32_t thecurve;
+    uint8_t* gtable;
+    uint32_t gtable_len;
+    PObject **tables, **messages, **signatures;
+    uECC_VerifyItem *items;
+    int32_t i, n;
+
+    if (nargs != 5 || parse_py_args("is", 2, args, &thecurve, &gtable, &gtable_len) != 2) {
+        return ERR_TYPE_EXC;
+    }
+    for (i = 2; i < 5; i++) {
+        if (PTYPE(args[i]) != PLIST && PTYPE(args[i]) != PTUPLE)
+            return ERR_TYPE_EXC;
+    }
+    n = PSEQUENCE_ELEMENTS(args[2]);
+    if (PSEQUENCE_ELEMENTS(args[3]) != n || PSEQUENCE_ELEMENTS(args[4]) != n)
+        return ERR_VALUE_EXC;
+
+    CHECK_CURVE();
+    const struct uECC_Curve_t* curve = curves[thecurve];
+
+    if (gtable_len != uECC_verify_table_size(curve))
+        return ERR_VALUE_EXC;
+    tables = PSEQUENCE_OBJECTS(args[2]);
+    messages = PSEQUENCE_OBJECTS(args[3]);
+    signatures = PSEQUENCE_OBJECTS(args[4]);
+    for (i = 0; i < n; i++) {
+        if (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(tables[i])) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(messages[i]))
+            || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(signatures[i])))
+            return ERR_TYPE_EXC;
+        if (PSEQUENCE_ELEMENTS(tables[i]) != gtable_len
+            || PSEQUENCE_ELEMENTS(signatures[i]) != uECC_curve_public_key_size(curve))
+            return ERR_VALUE_EXC;
+    }
+
+    items = gc_malloc(n ? n*sizeof(uECC_VerifyItem) : 1);
+    for (i = 0; i < n; i++) {
+        items[i].table = PSEQUENCE_BYTES(tables[i]);
+        items[i].message_hash = PSEQUENCE_BYTES(messages[i]);
+        items[i].hash_size = PSEQUENCE_ELEMENTS(messages[i]);
+        items[i].signature = PSEQUENCE_BYTES(signatures[i]);
+    }
+    RELEASE_GIL();
+    uECC_verify_batch(items,n,gtable,curve);
+    ACQUIRE_GIL();
+    PList *lst = plist_new(n,NULL);
+    for (i = 0; i < n; i++) {
+        PLIST_SET_ITEM(lst,i,items[i].valid ? PBOOL_TRUE() : PBOOL_FALSE());
+    }
+    gc_free(items);
+    *res = lst;
+    return ERR_OK;
+}
@@ -0,0 +1,62 @@
+#!/usr/bin/env python
+
+# Generates fixed-base.inc, the comb table of the secp256r1 generator used by EccPoint_mult_base:
+# entry i is (1 + sum of bit j of i * 2^(j*D)) * G, for the bits j of i from 1 to W-1.
+
+import sys
+
+P = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff
+GX = 0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296
+GY = 0x4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5
+BITS = 256
+
+W = int(sys.argv[1]) if len(sys.argv) > 1 else 4
+D = (BITS + W - 1) // W
+
+
+def add(a, b):
+    if a is None:
+        return b
+    if b is None:
+        return a
+    if a[0] == b[0]:
+        if (a[1] + b[1]) % P == 0:
+            return None
+        l = 3 * (a[0] * a[0] - 1) * pow(2 * a[1], P - 2, P)
+    else:
+        l = (b[1] - a[1]) * pow(b[0] - a[0], P - 2, P)
+    x = (l * l - a[0] - b[0]) % P
+    return (x, (l * (a[0] - x) - a[1]) % P)
+
+
+def mult(k, pt):
+    r = None
+    while k:
+        if k & 1:
+            r = add(r, pt)
+        pt = add(pt, pt)
+        k >>= 1
+    return r
+
+
+def words(v):
+    b = ["%02X" % ((v >> (8 * i)) & 0xff) for i in range(32)]
+    return ["BYTES_TO_WORDS_8(" + ", ".join(b[i:i + 8]) + ")" for i in range(0, 32, 8)]
+
+
+G = (GX, GY)
+print("/* Generated by scripts/fixed_base.py %d, do not edit */" % W)
+print("")
+print("#define uECC_COMB_W %d" % W)
+print("#define uECC_COMB_D %d" % D)
+print("")
+print("static const uECC_word_t comb_secp256r1[%d][num_words_secp256r1 * 2] = {" % (1 << (W - 1)))
+for i in range(1 << (W - 1)):
+    k = 1
+    for j in range(1, W):
+        if (i >> (j - 1)) & 1:
+            k += 1 << (j * D)
+    pt = mult(k, G)
+    w = words(pt[0]) + words(pt[1])
+    print("    { " + ",\n        ".join(w) + " },")
+print("};")
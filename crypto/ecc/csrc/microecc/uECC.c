@@ -912,6 +912,140 @@ static uECC_word_t regularize_k(const uECC_word_t * const k,
     return carry;
 }
 
+#if (uECC_FIXED_BASE && uECC_SUPPORTS_secp256r1) || uECC_BATCH_VERIFY
+
+/* Jacobian (X1, Y1, Z1) => (X1, Y1, Z1) + Q, with Q affine.
+   The exceptional cases (the two points equal or opposite) are not handled, they leave Z1 = 0:
+   the return value is 0 normally, 1 if the points were equal and 2 if they were opposite.
+   For the comb they only happen with negligible probability and the value is ignored. */
+static uECC_word_t add_mixed(uECC_word_t * X1,
+                      uECC_word_t * Y1,
+                      uECC_word_t * Z1,
+                      const uECC_word_t * const Q,
+                      uECC_Curve curve) {
+    uECC_word_t t1[uECC_MAX_WORDS];
+    uECC_word_t t2[uECC_MAX_WORDS];
+    uECC_word_t t3[uECC_MAX_WORDS];
+    uECC_word_t t4[uECC_MAX_WORDS];
+    uECC_word_t exceptional;
+    wordcount_t num_words = curve->num_words;
+
+    uECC_vli_modSquare_fast(t1, Z1, curve);                  /* t1 = z1^2 */
+    uECC_vli_modMult_fast(t2, t1, Z1, curve);                /* t2 = z1^3 */
+    uECC_vli_modMult_fast(t1, t1, Q, curve);                 /* t1 = x2*z1^2 = U */
+    uECC_vli_modMult_fast(t2, t2, Q + num_words, curve);     /* t2 = y2*z1^3 = S */
+    uECC_vli_modSub(t1, t1, X1, curve->p, num_words); /* t1 = U - x1 = H */
+    uECC_vli_modSub(t2, t2, Y1, curve->p, num_words); /* t2 = S - y1 = R */
+    uECC_vli_modMult_fast(Z1, Z1, t1, curve);                /* z3 = z1*H */
+    exceptional = uECC_vli_isZero(t1, num_words) * (2 - uECC_vli_isZero(t2, num_words));
+
+    uECC_vli_modSquare_fast(t3, t1, curve);                  /* t3 = H^2 */
+    uECC_vli_modMult_fast(t4, t3, t1, curve);                /* t4 = H^3 */
+    uECC_vli_modMult_fast(t3, t3, X1, curve);                /* t3 = x1*H^2 */
+    uECC_vli_modSquare_fast(X1, t2, curve);                  /* t1 = R^2 */
+    uECC_vli_modSub(X1, X1, t4, curve->p, num_words); /* t1 = R^2 - H^3 */
+    uECC_vli_modSub(X1, X1, t3, curve->p, num_words);
+    uECC_vli_modSub(X1, X1, t3, curve->p, num_words); /* t1 = R^2 - H^3 - 2*x1*H^2 = x3 */
+    uECC_vli_modSub(t3, t3, X1, curve->p, num_words); /* t3 = x1*H^2 - x3 */
+    uECC_vli_modMult_fast(t3, t3, t2, curve);                /* t3 = R*(x1*H^2 - x3) */
+    uECC_vli_modMult_fast(Y1, Y1, t4, curve);                /* t2 = y1*H^3 */
+    uECC_vli_modSub(Y1, t3, Y1, curve->p, num_words); /* t2 = R*(x1*H^2 - x3) - y1*H^3 = y3 */
+    return exceptional;
+}
+
+#endif /* (uECC_FIXED_BASE && uECC_SUPPORTS_secp256r1) || uECC_BATCH_VERIFY */
+
+#if (uECC_FIXED_BASE && uECC_SUPPORTS_secp256r1)
+
+#include "fixed-base.inc"
+
+/* point = the comb entry of digit, negated if the digit is; reads the whole table */
+static void comb_select(uECC_word_t *point, uint8_t digit, uECC_Curve curve) {
+    uECC_word_t neg[uECC_MAX_WORDS];
+    uECC_word_t mask;
+    wordcount_t num_words = curve->num_words;
+    wordcount_t i;
+    uint8_t j;
+
+    uECC_vli_clear(point, num_words * 2);
+    for (j = 0; j < (1 << (uECC_COMB_W - 1)); ++j) {
+        mask = (uECC_word_t)0 - (uECC_word_t)(j == ((digit & 0x7F) >> 1));
+        for (i = 0; i < num_words * 2; ++i) {
+            point[i] |= comb_secp256r1[j][i] & mask;
+        }
+    }
+    uECC_vli_sub(neg, curve->p, point + num_words, num_words);
+    mask = (uECC_word_t)0 - (uECC_word_t)(digit >> 7);
+    for (i = 0; i < num_words; ++i) {
+        point[num_words + i] = (point[num_words + i] & ~mask) | (neg[i] & mask);
+    }
+}
+
+/* Recodes the odd scalar k into uECC_COMB_D + 1 odd comb digits, bit 7 set for negative ones
+   (the recoding of Hedabou, Pinel and Beneteau used by mbedTLS). */
+static void comb_recode(uint8_t *digits, const uECC_word_t *k, uECC_Curve curve) {
+    bitcount_t i, j, bit;
+    uint8_t carry = 0, c, adjust;
+
+    for (i = 0; i < uECC_COMB_D; ++i) {
+        digits[i] = 0;
+        for (j = 0; j < uECC_COMB_W; ++j) {
+            bit = i + uECC_COMB_D * j;
+            if (bit < curve->num_n_bits) {
+                digits[i] |= (uint8_t)(!!uECC_vli_testBit(k, bit) << j);
+            }
+        }
+    }
+    digits[uECC_COMB_D] = 0;
+    for (i = 1; i <= uECC_COMB_D; ++i) {
+        c = digits[i] & carry;
+        digits[i] ^= carry;
+        carry = c;
+        adjust = 1 - (digits[i] & 1);
+        carry |= digits[i] & (digits[i - 1] * adjust);
+        digits[i] ^= digits[i - 1] * adjust;
+        digits[i - 1] |= adjust << 7;
+    }
+}
+
+/* result = k * G for secp256r1, with 0 < k < n. Constant time. */
+static void EccPoint_mult_base(uECC_word_t *result, const uECC_word_t *k, uECC_Curve curve) {
+    uECC_word_t m[uECC_MAX_WORDS];
+    uECC_word_t z[uECC_MAX_WORDS];
+    uECC_word_t q[uECC_MAX_WORDS * 2];
+    uint8_t digits[uECC_COMB_D + 1];
+    uECC_word_t mask;
+    wordcount_t num_words = curve->num_words;
+    wordcount_t i;
+    int d;
+
+    /* the recoding needs an odd scalar: for an even k use n - k, and negate the result */
+    mask = (uECC_word_t)0 - (uECC_word_t)!uECC_vli_testBit(k, 0);
+    uECC_vli_sub(m, curve->n, k, num_words);
+    for (i = 0; i < num_words; ++i) {
+        m[i] = (m[i] & mask) | (k[i] & ~mask);
+    }
+    comb_recode(digits, m, curve);
+
+    comb_select(result, digits[uECC_COMB_D], curve);
+    uECC_vli_clear(z, num_words);
+    z[0] = 1;
+    for (d = uECC_COMB_D - 1; d >= 0; --d) {
+        curve->double_jacobian(result, result + num_words, z, curve);
+        comb_select(q, digits[d], curve);
+        add_mixed(result, result + num_words, z, q, curve);
+    }
+
+    uECC_vli_modInv(z, z, curve->p, num_words);
+    apply_z(result, result + num_words, z, curve);
+    uECC_vli_sub(q, curve->p, result + num_words, num_words);
+    for (i = 0; i < num_words; ++i) {
+        result[num_words + i] = (result[num_words + i] & ~mask) | (q[i] & mask);
+    }
+}
+
+#endif /* (uECC_FIXED_BASE && uECC_SUPPORTS_secp256r1) */
+
 static uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
                                                uECC_word_t *private,
                                                uECC_Curve curve) {
@@ -922,9 +1056,15 @@ static uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
 
     /* Regularize the bitcount for the private key so that attackers cannot use a side channel
        attack to learn the number of leading zeros. */
-    carry = regularize_k(private, tmp1, tmp2, curve);
-
-    EccPoint_mult(result, curve->G, p2[!carry], 0, curve->num_n_bits + 1, curve);
+#if (uECC_FIXED_BASE && uECC_SUPPORTS_secp256r1)
+    if (curve == &curve_secp256r1) {
+        EccPoint_mult_base(result, private, curve);
+    } else
+#endif
+    {
+        carry = regularize_k(private, tmp1, tmp2, curve);
+        EccPoint_mult(result, curve->G, p2[!carry], 0, curve->num_n_bits + 1, curve);
+    }
 
     if (EccPoint_isZero(result, curve)) {
         return 0;
@@ -1255,8 +1395,15 @@ static int uECC_sign_with_k(const uint8_t *private_key,
         return 0;
     }
 
-    carry = regularize_k(k, tmp, s, curve);
-    EccPoint_mult(p, curve->G, k2[!carry], 0, num_n_bits + 1, curve);
+#if (uECC_FIXED_BASE && uECC_SUPPORTS_secp256r1)
+    if (curve == &curve_secp256r1) {
+        EccPoint_mult_base(p, k, curve);
+    } else
+#endif
+    {
+        carry = regularize_k(k, tmp, s, curve);
+        EccPoint_mult(p, curve->G, k2[!carry], 0, num_n_bits + 1, curve);
+    }
     if (uECC_vli_isZero(p, num_words)) {
         return 0;
     }
@@ -1608,6 +1755,257 @@ int uECC_verify(const uint8_t *public_key,
     return (int)(uECC_vli_equal(rx, r, num_words));
 }
 
+#if uECC_BATCH_VERIFY
+
+/* Verification with precomputed tables: the odd multiples P, 3P, ..., (2^(w-1) - 1)P of G and
+   of each public key, affine, so that u1*G + u2*Q is a single loop of doublings with a mixed
+   addition per nonzero digit of the width-w NAF of u1 and u2 (about 2*256/(w+1) additions
+   instead of 3*256/4 co-Z ones). x(R) is compared with r in Jacobian coordinates, without
+   inverting Z, and the inverses of s are computed with one inversion per uECC_VERIFY_CHUNK
+   signatures (Montgomery's trick). */
+
+#define uECC_VERIFY_POINTS (1 << (uECC_VERIFY_WINDOW - 2))
+#define uECC_VERIFY_CHUNK 4
+
+unsigned uECC_verify_table_size(uECC_Curve curve) {
+    return uECC_VERIFY_POINTS * 2 * curve->num_words * uECC_WORD_SIZE;
+}
+
+int uECC_verify_table(const uint8_t *public_key, void *table, uECC_Curve curve) {
+    uECC_word_t *points = (uECC_word_t *)table;
+    uECC_word_t twice[uECC_MAX_WORDS * 2];
+    uECC_word_t z[uECC_MAX_WORDS];
+    wordcount_t num_words = curve->num_words;
+    uint8_t i;
+
+    if (public_key) {
+#if uECC_VLI_NATIVE_LITTLE_ENDIAN
+        bcopy((uint8_t *) points, public_key, curve->num_bytes*2);
+#else
+        uECC_vli_bytesToNative(points, public_key, curve->num_bytes);
+        uECC_vli_bytesToNative(points + num_words, public_key + curve->num_bytes, curve->num_bytes);
+#endif
+        if (!uECC_valid_point(points, curve)) {
+            return 0;
+        }
+    } else {
+        uECC_vli_set(points, curve->G, num_words * 2);
+    }
+
+    /* twice = 2P, affine */
+    uECC_vli_set(twice, points, num_words * 2);
+    uECC_vli_clear(z, num_words);
+    z[0] = 1;
+    curve->double_jacobian(twice, twice + num_words, z, curve);
+    uECC_vli_modInv(z, z, curve->p, num_words);
+    apply_z(twice, twice + num_words, z, curve);
+
+    for (i = 1; i < uECC_VERIFY_POINTS; ++i) {
+        uECC_word_t *point = points + i * 2 * num_words;
+        uECC_vli_set(point, point - 2 * num_words, num_words * 2);
+        uECC_vli_clear(z, num_words);
+        z[0] = 1;
+        if (add_mixed(point, point + num_words, z, twice, curve)) {
+            return 0;
+        }
+        uECC_vli_modInv(z, z, curve->p, num_words);
+        apply_z(point, point + num_words, z, curve);
+    }
+    return 1;
+}
+
+/* Width-w NAF of k (destroyed), least significant digit first. Returns the number of digits. */
+static bitcount_t wnaf_recode(int8_t *digits, uECC_word_t *k, uECC_Curve curve) {
+    uECC_word_t d[uECC_MAX_WORDS];
+    wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+    bitcount_t len = 0;
+    int8_t digit;
+
+    uECC_vli_clear(d, num_n_words);
+    while (!uECC_vli_isZero(k, num_n_words)) {
+        digit = 0;
+        if (k[0] & 1) {
+            digit = k[0] & ((1 << uECC_VERIFY_WINDOW) - 1);
+            if (digit >= (1 << (uECC_VERIFY_WINDOW - 1))) {
+                digit -= (1 << uECC_VERIFY_WINDOW);
+                d[0] = -digit;
+                uECC_vli_add(k, k, d, num_n_words);
+            } else {
+                d[0] = digit;
+                uECC_vli_sub(k, k, d, num_n_words);
+            }
+        }
+        digits[len++] = digit;
+        uECC_vli_rshift1(k, num_n_words);
+    }
+    return len;
+}
+
+/* (X1, Y1, Z1) += digit * P from table, tracking the point at infinity */
+static void wnaf_add(uECC_word_t *X1,
+                     uECC_word_t *Y1,
+                     uECC_word_t *Z1,
+                     uint8_t *infinity,
+                     const uECC_word_t *table,
+                     int8_t digit,
+                     uECC_Curve curve) {
+    uECC_word_t point[uECC_MAX_WORDS * 2];
+    wordcount_t num_words = curve->num_words;
+    const uECC_word_t *entry = table + ((digit < 0 ? -digit : digit) >> 1) * 2 * num_words;
+
+    uECC_vli_set(point, entry, num_words);
+    if (digit < 0) {
+        uECC_vli_sub(point + num_words, curve->p, entry + num_words, num_words);
+    } else {
+        uECC_vli_set(point + num_words, entry + num_words, num_words);
+    }
+
+    if (!*infinity) {
+        switch (add_mixed(X1, Y1, Z1, point, curve)) {
+            case 0:
+                return;
+            case 2:
+                *infinity = 1;
+                return;
+        }
+    }
+    /* from infinity, or adding P to itself */
+    uECC_vli_set(X1, point, num_words);
+    uECC_vli_set(Y1, point + num_words, num_words);
+    uECC_vli_clear(Z1, num_words);
+    Z1[0] = 1;
+    if (!*infinity) {
+        curve->double_jacobian(X1, Y1, Z1, curve);
+    }
+    *infinity = 0;
+}
+
+/* Returns 1 if x(u1*G + u2*Q) = r (mod n). u1 and u2 are destroyed. */
+static int verify_tables(uECC_word_t *u1,
+                         uECC_word_t *u2,
+                         const uECC_word_t *r,
+                         const uECC_word_t *g_table,
+                         const uECC_word_t *table,
+                         uECC_Curve curve) {
+    int8_t digits1[uECC_MAX_WORDS * uECC_WORD_SIZE * 8 + 1];
+    int8_t digits2[uECC_MAX_WORDS * uECC_WORD_SIZE * 8 + 1];
+    uECC_word_t X[uECC_MAX_WORDS];
+    uECC_word_t Y[uECC_MAX_WORDS];
+    uECC_word_t Z[uECC_MAX_WORDS];
+    uECC_word_t v[uECC_MAX_WORDS];
+    uECC_word_t t[uECC_MAX_WORDS];
+    wordcount_t num_words = curve->num_words;
+    wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+    bitcount_t len1 = wnaf_recode(digits1, u1, curve);
+    bitcount_t len2 = wnaf_recode(digits2, u2, curve);
+    bitcount_t i;
+    uint8_t infinity = 1;
+
+    for (i = smax(len1, len2) - 1; i >= 0; --i) {
+        if (!infinity) {
+            curve->double_jacobian(X, Y, Z, curve);
+        }
+        if (i < len1 && digits1[i]) {
+            wnaf_add(X, Y, Z, &infinity, g_table, digits1[i], curve);
+        }
+        if (i < len2 && digits2[i]) {
+            wnaf_add(X, Y, Z, &infinity, table, digits2[i], curve);
+        }
+    }
+    if (infinity) {
+        return 0;
+    }
+
+    /* x(R) = X/Z^2 and r < n: x(R) mod n == r iff X == v*Z^2 with v = r or v = r + n < p */
+    uECC_vli_modSquare_fast(Z, Z, curve);
+    uECC_vli_clear(v, uECC_MAX_WORDS);
+    uECC_vli_set(v, r, num_n_words);
+    for (i = 0; i < 2; ++i) {
+        if (uECC_vli_numBits(v, uECC_MAX_WORDS) > (bitcount_t)num_words * uECC_WORD_BITS ||
+                uECC_vli_cmp_unsafe(curve->p, v, num_words) != 1) {
+            return 0;
+        }
+        uECC_vli_modMult_fast(t, v, Z, curve);
+        if (uECC_vli_equal(t, X, num_words)) {
+            return 1;
+        }
+        if (uECC_vli_add(v, v, curve->n, num_n_words)) {
+            return 0;
+        }
+    }
+    return 0;
+}
+
+/* Reads r and s of signature, returns 1 if both are in [1, n-1]. */
+static int verify_read_rs(uECC_word_t *r, uECC_word_t *s, const uint8_t *signature, uECC_Curve curve) {
+    wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+    r[num_n_words - 1] = 0;
+    s[num_n_words - 1] = 0;
+#if uECC_VLI_NATIVE_LITTLE_ENDIAN
+    bcopy((uint8_t *) r, signature, curve->num_bytes);
+    bcopy((uint8_t *) s, signature + curve->num_bytes, curve->num_bytes);
+#else
+    uECC_vli_bytesToNative(r, signature, curve->num_bytes);
+    uECC_vli_bytesToNative(s, signature + curve->num_bytes, curve->num_bytes);
+#endif
+    return !uECC_vli_isZero(r, num_n_words) && !uECC_vli_isZero(s, num_n_words) &&
+        uECC_vli_cmp_unsafe(curve->n, r, num_n_words) == 1 &&
+        uECC_vli_cmp_unsafe(curve->n, s, num_n_words) == 1;
+}
+
+void uECC_verify_batch(uECC_VerifyItem *items,
+                       unsigned count,
+                       const void *g_table,
+                       uECC_Curve curve) {
+    /* prefix[i] = product of the valid s of the chunk up to item i */
+    uECC_word_t prefix[uECC_VERIFY_CHUNK][uECC_MAX_WORDS];
+    uECC_word_t inv[uECC_MAX_WORDS];
+    uECC_word_t r[uECC_MAX_WORDS], s[uECC_MAX_WORDS];
+    uECC_word_t u1[uECC_MAX_WORDS], u2[uECC_MAX_WORDS];
+    wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+    unsigned base, n, i;
+
+    for (base = 0; base < count; base += n) {
+        uECC_VerifyItem *chunk = items + base;
+        n = count - base < uECC_VERIFY_CHUNK ? count - base : uECC_VERIFY_CHUNK;
+
+        uECC_vli_clear(inv, num_n_words);
+        inv[0] = 1;
+        for (i = 0; i < n; ++i) {
+            chunk[i].valid = verify_read_rs(r, s, chunk[i].signature, curve);
+            if (chunk[i].valid) {
+                uECC_vli_modMult(inv, inv, s, curve->n, num_n_words);
+            }
+            uECC_vli_set(prefix[i], inv, num_n_words);
+        }
+
+        uECC_vli_modInv(inv, inv, curve->n, num_n_words);
+        for (i = n; i-- > 0;) {
+            if (!chunk[i].valid) {
+                continue;
+            }
+            verify_read_rs(r, s, chunk[i].signature, curve);
+            /* u2 = 1/s, inv = 1/(s_0 ... s_(i-1)) */
+            if (i) {
+                uECC_vli_modMult(u2, inv, prefix[i - 1], curve->n, num_n_words);
+            } else {
+                uECC_vli_set(u2, inv, num_n_words);
+            }
+            uECC_vli_modMult(inv, inv, s, curve->n, num_n_words);
+
+            u1[num_n_words - 1] = 0;
+            bits2int(u1, chunk[i].message_hash, chunk[i].hash_size, curve);
+            uECC_vli_modMult(u1, u1, u2, curve->n, num_n_words); /* u1 = e/s */
+            uECC_vli_modMult(u2, r, u2, curve->n, num_n_words);  /* u2 = r/s */
+            chunk[i].valid = verify_tables(u1, u2, r, (const uECC_word_t *)g_table,
+                                           (const uECC_word_t *)chunk[i].table, curve);
+        }
+    }
+}
+
+#endif /* uECC_BATCH_VERIFY */
+
 #if uECC_ENABLE_VLI_API
 
 unsigned uECC_curve_num_words(uECC_Curve curve) {
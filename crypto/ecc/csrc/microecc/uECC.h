@@ -27,14 +27,40 @@ platform. */
    Optimization level 4 currently only has an effect ARM platforms where more than one
    curve is enabled. */
 #ifndef uECC_OPTIMIZATION_LEVEL
-    #define uECC_OPTIMIZATION_LEVEL 2
+    #if defined(__thumb2__)
+        /* level 3 enables the assembly multiplication (UMAAL based where available) of asm_arm.inc */
+        #define uECC_OPTIMIZATION_LEVEL 3
+    #else
+        #define uECC_OPTIMIZATION_LEVEL 2
+    #endif
 #endif
 
 /* uECC_SQUARE_FUNC - If enabled (defined as nonzero), this will cause a specific function to be
 used for (scalar) squaring instead of the generic multiplication function. This can make things
 faster somewhat faster, but increases the code size. */
 #ifndef uECC_SQUARE_FUNC
-    #define uECC_SQUARE_FUNC 0
+    #if defined(__thumb2__)
+        #define uECC_SQUARE_FUNC 1
+    #else
+        #define uECC_SQUARE_FUNC 0
+    #endif
+#endif
+
+/* uECC_FIXED_BASE - If enabled (defined as nonzero), multiplications of the secp256r1 generator
+(key generation and signing) use a signed comb over a precomputed table in flash (fixed-base.inc,
+1KB) instead of the Montgomery ladder, about three times faster. */
+#ifndef uECC_FIXED_BASE
+    #define uECC_FIXED_BASE 0
+#endif
+
+/* uECC_BATCH_VERIFY - If enabled (defined as nonzero), uECC_verify_table() and uECC_verify_batch()
+are compiled: signatures are verified with per-key tables of 2^(uECC_VERIFY_WINDOW - 2) precomputed
+points (256 bytes per key for secp256r1 with the default window of 4). */
+#ifndef uECC_BATCH_VERIFY
+    #define uECC_BATCH_VERIFY 0
+#endif
+#ifndef uECC_VERIFY_WINDOW
+    #define uECC_VERIFY_WINDOW 4
 #endif
 
 /* uECC_VLI_NATIVE_LITTLE_ENDIAN - If enabled (defined as nonzero), this will switch to native
@@ -415,6 +441,50 @@ int uECC_verify(const uint8_t *public_key,
                 const uint8_t *signature,
                 uECC_Curve curve);
 
+#if uECC_BATCH_VERIFY
+/* uECC_verify_table_size() function.
+Returns the size in bytes of the tables filled by uECC_verify_table().
+*/
+unsigned uECC_verify_table_size(uECC_Curve curve);
+
+/* uECC_verify_table() function.
+Precompute the verification table of a public key, to be reused by uECC_verify_batch() for all
+the signatures of that key.
+
+Inputs:
+    public_key - The public key, or NULL for the table of the curve generator.
+
+Outputs:
+    table - Will be filled in with the table. Must be uECC_verify_table_size() bytes long and
+            word aligned.
+
+Returns 1 if the public key is valid, 0 if it is invalid.
+*/
+int uECC_verify_table(const uint8_t *public_key, void *table, uECC_Curve curve);
+
+typedef struct uECC_VerifyItem {
+    const void *table;          /* table of the signer's public key */
+    const uint8_t *message_hash;
+    unsigned hash_size;
+    const uint8_t *signature;
+    int valid;                  /* set to 1 if the signature is valid, 0 if it is invalid */
+} uECC_VerifyItem;
+
+/* uECC_verify_batch() function.
+Verify count ECDSA signatures, as uECC_verify() would, setting the valid field of each item.
+Faster than uECC_verify() also for a single signature.
+
+Inputs:
+    items   - The signatures to verify, with their keys and message hashes.
+    count   - The number of items.
+    g_table - The table of the curve generator, from uECC_verify_table(NULL, ...).
+*/
+void uECC_verify_batch(uECC_VerifyItem *items,
+                       unsigned count,
+                       const void *g_table,
+                       uECC_Curve curve);
+#endif /* uECC_BATCH_VERIFY */
+
 #ifdef __cplusplus
 } /* end of extern "C" */
 #endif
@@ -38,7 +38,13 @@ SECP256K1=4
 @c_native("zc_curve_generate_keys",[
     "csrc/microecc/uECC.c",
     "csrc/microecc/ecc_ifc.c",
-    ],["uECC_SUPPORTS_secp160r1","uECC_SUPPORTS_secp192r1","uECC_SUPPORTS_secp224r1","uECC_SUPPORTS_secp256r1","uECC_SUPPORTS_secp256k1"],["-I.../../hash/csrc"])
+    "#csrc/drbg/zdrbg.c",
+    "#crypto/hash/csrc/cifra/src/drbg.c",
+    "#crypto/hash/csrc/cifra/src/sha256.c",
+    "#crypto/hash/csrc/cifra/src/hmac.c",
+    "#crypto/hash/csrc/cifra/src/chash.c",
+    "#crypto/hash/csrc/cifra/src/blockwise.c",
+    ],["uECC_SUPPORTS_secp160r1","uECC_SUPPORTS_secp192r1","uECC_SUPPORTS_secp224r1","uECC_SUPPORTS_secp256r1","uECC_SUPPORTS_secp256k1","uECC_FIXED_BASE","uECC_BATCH_VERIFY"],["-I.../../hash/csrc","-I#csrc/drbg","-I.../../hash/csrc/cifra/src/ext"])
 def make_keys(curve):
     """
 .. function:: make_keys(curve)
@@ -48,9 +54,10 @@ def make_keys(curve):
     second element is a byte object containing the representation of the
     generated public key. *curve* specifies the curve to use
 
-    This function uses the random number generator provided by the
-    VM. For real world usage and enhanced security the random number generator
-    must be of cryptographic quality (generally implemented in hardware).
+    This function uses the system random generator, a DRBG seeded from the
+    random number generator provided by the VM. For real world usage and
+    enhanced security the latter must be of cryptographic quality (generally
+    implemented in hardware).
 
     """
     pass
@@ -113,6 +120,76 @@ def verify(curve,message,signature, pbkey):
 
     pass
 
+@c_native("zc_curve_verify_table",[])
+def _verify_table(curve,pbkey):
+    pass
+
+@c_native("zc_curve_verify_batch",[])
+def _verify_batch(curve,gtable,tables,messages,signatures):
+    pass
+
+class Verifier():
+    """
+==================
+The Verifier class
+==================
+
+.. class:: Verifier(curve)
+
+    Create a signature verifier for *curve*, for applications checking many signatures of a known set of public keys.
+
+    Public keys are registered once with :meth:`add_key`: they are decompressed and validated there, and a table of
+    precomputed points is kept for each of them (256 bytes for :samp:`SECP256R1`). Verifications with a
+    :class:`Verifier` are faster than with :func:`verify`, and :meth:`verify_batch` amortizes part of the work over
+    several signatures.
+
+    """
+    def __init__(self,curve):
+        self.curve = curve
+        self.gtable = _verify_table(curve,b'')
+        self.keys = {}
+
+    def add_key(self,kid,pbkey):
+        """
+.. method:: add_key(kid,pbkey)
+
+        Register the public key *pbkey* (uncompressed, or compressed as returned by :func:`compress_key`) under the
+        identifier *kid*, replacing the key already registered with it, if any.
+
+        Raise :samp:`ValueError` if *pbkey* is not a valid public key for the curve.
+
+        """
+        self.keys[kid] = _verify_table(self.curve,pbkey)
+
+    def remove_key(self,kid):
+        """
+.. method:: remove_key(kid)
+
+        Forget the public key registered under *kid*.
+
+        """
+        del self.keys[kid]
+
+    def verify(self,kid,message,signature):
+        """
+.. method:: verify(kid,message,signature)
+
+        Return :samp:`True` if *signature* is a valid signature for *message* given the public key registered under *kid*.
+
+        """
+        return _verify_batch(self.curve,self.gtable,(self.keys[kid],),(message,),(signature,))[0]
+
+    def verify_batch(self,kids,messages,signatures):
+        """
+.. method:: verify_batch(kids,messages,signatures)
+
+        Verify several signatures at once: *kids*, *messages* and *signatures* are lists of the same length, the
+        *i*-th signature being checked against the *i*-th message and the public key registered under the *i*-th kid.
+        Return a list with the result, :samp:`True` or :samp:`False`, of each verification.
+
+        """
+        return _verify_batch(self.curve,self.gtable,[self.keys[kid] for kid in kids],messages,signatures)
+
 @c_native("zc_curve_sign",[])
 def _csign(curve,message,pvkey,deterministic):
     pass
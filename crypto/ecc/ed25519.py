@@ -0,0 +1,75 @@
+"""
+.. module:: ed25519
+
+*******
+Ed25519
+*******
+
+This module implements the Ed25519 signatures of `RFC 8032 <https://tools.ietf.org/html/rfc8032>`_. Private keys are
+32 random bytes, public keys are 32 bytes and signatures 64 bytes. Signatures are deterministic: they do not need a
+random number generator.
+
+Differently from the ECDSA signatures of module :mod:`ecc`, the whole message is signed, not a hash of it: Ed25519
+hashes it internally with SHA-512.
+
+The module is based on `TweetNaCl <https://tweetnacl.cr.yp.to/>`_ and on the SHA-512 of `cifra <https://github.com/ctz/cifra>`_.
+
+    """
+
+@c_native("zc_ed25519_make_keys",[
+    "csrc/curve25519/ed25519_ifc.c",
+    "csrc/curve25519/ed25519.c",
+    "#crypto/hash/csrc/cifra/src/sha512.c",
+    "#csrc/drbg/zdrbg.c",
+    "#crypto/hash/csrc/cifra/src/drbg.c",
+    "#crypto/hash/csrc/cifra/src/sha256.c",
+    "#crypto/hash/csrc/cifra/src/hmac.c",
+    "#crypto/hash/csrc/cifra/src/chash.c",
+    "#crypto/hash/csrc/cifra/src/blockwise.c",
+    ],[],["-I.../../hash/csrc/cifra/src","-I.../../hash/csrc/cifra/src/ext","-I#csrc/drbg"])
+def make_keys():
+    """
+.. function:: make_keys()
+
+    Return a tuple of two elements: the public key and the private key, both byte objects of 32 bytes.
+
+    This function uses the system random generator, a DRBG seeded from the random number generator provided by the VM.
+    For real world usage and enhanced security the latter must be of cryptographic quality (generally implemented in
+    hardware).
+
+    """
+    pass
+
+@c_native("zc_ed25519_public_key",[])
+def public_key(pvkey):
+    """
+.. function:: public_key(pvkey)
+
+    Return the 32 bytes public key matching the private key *pvkey*.
+
+    """
+    pass
+
+@c_native("zc_ed25519_sign",[])
+def _sign(message,pvkey,pbkey):
+    pass
+
+def sign(message,pvkey,pbkey=b''):
+    """
+.. function:: sign(message,pvkey,pbkey=b'')
+
+    Return the 64 bytes signature of *message* with the private key *pvkey*. If the public key *pbkey* matching *pvkey*
+    is given, it is not recomputed, halving the time.
+
+    """
+    return _sign(message,pvkey,pbkey)
+
+@c_native("zc_ed25519_verify",[])
+def verify(message,signature,pbkey):
+    """
+.. function:: verify(message,signature,pbkey)
+
+    Return :samp:`True` if *signature* is a valid signature of *message* for the public key *pbkey*.
+
+    """
+    pass
@@ -0,0 +1,64 @@
+"""
+.. module:: x25519
+
+******
+X25519
+******
+
+This module implements the X25519 Diffie-Hellman key exchange of `RFC 7748 <https://tools.ietf.org/html/rfc7748>`_.
+Both parties generate a key pair with :func:`make_keys`, exchange their public keys and obtain the same 32 bytes secret
+with :func:`shared_secret`. The secret should be hashed (or passed through a key derivation function) before being
+used as a symmetric key.
+
+X25519 is several times cheaper than ECDH on :samp:`SECP256R1` with module :mod:`ecc`, and its keys are 32 bytes long.
+
+The module is based on the curve25519-donna implementation shipped with `cifra <https://github.com/ctz/cifra>`_.
+
+    """
+
+@c_native("zc_x25519_make_keys",[
+    "csrc/curve25519/x25519_ifc.c",
+    "#crypto/hash/csrc/cifra/src/curve25519.donna.c",
+    "#csrc/drbg/zdrbg.c",
+    "#crypto/hash/csrc/cifra/src/drbg.c",
+    "#crypto/hash/csrc/cifra/src/sha256.c",
+    "#crypto/hash/csrc/cifra/src/hmac.c",
+    "#crypto/hash/csrc/cifra/src/chash.c",
+    "#crypto/hash/csrc/cifra/src/blockwise.c",
+    ],[],["-I.../../hash/csrc/cifra/src","-I.../../hash/csrc/cifra/src/ext","-I#csrc/drbg"])
+def make_keys():
+    """
+.. function:: make_keys()
+
+    Return a tuple of two elements: the public key and the private key, both byte objects of 32 bytes.
+
+    This function uses the system random generator, a DRBG seeded from the random number generator provided by the VM.
+    For real world usage and enhanced security the latter must be of cryptographic quality (generally implemented in
+    hardware).
+
+    """
+    pass
+
+@c_native("zc_x25519_mul",[])
+def _mul(scalar,point):
+    pass
+
+def public_key(pvkey):
+    """
+.. function:: public_key(pvkey)
+
+    Return the 32 bytes public key matching the private key *pvkey*.
+
+    """
+    return _mul(pvkey,b'')
+
+def shared_secret(pvkey,pbkey):
+    """
+.. function:: shared_secret(pvkey,pbkey)
+
+    Return the 32 bytes secret shared by the owner of the private key *pvkey* and the owner of the public key *pbkey*.
+
+    Raise :samp:`ValueError` if *pbkey* is a point of small order, for which the secret would be all zeros.
+
+    """
+    return _mul(pvkey,pbkey)
@@ -15,6 +15,8 @@
 #ifndef CF_CONFIG_H
 #define CF_CONFIG_H
 
+#include <stdint.h>
+
 /**
  * Library configuration
  * =====================
@@ -56,4 +58,37 @@
 # define CF_CACHE_SIDE_CHANNEL_PROTECTION CF_SIDE_CHANNEL_PROTECTION
 #endif
 
+/* .. c:macro:: CF_SHA256_UNROLLED
+ * Define this as 1 to compile the SHA256 block function unrolled by
+ * 16 rounds, with the working variables renamed instead of shifted
+ * and the message schedule indexed by constants.
+ *
+ * This is about twice as large, and noticeably faster on cores with
+ * enough registers and a barrel shifter.  The default is on for
+ * ARMv7-M and ARMv8-M mainline (Cortex-M3/M4/M7/M33), off elsewhere.
+ */
+#ifndef CF_SHA256_UNROLLED
+# if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#  define CF_SHA256_UNROLLED 1
+# else
+#  define CF_SHA256_UNROLLED 0
+# endif
+#endif
+
+/* .. c:macro:: CF_SHA3_UNROLLED
+ * Define this as 1 to compile the Keccak-f[1600] permutation of SHA3
+ * with each round unrolled, on the 32-bit bit-interleaved lanes the
+ * state is kept in: rotations become constant 32-bit rotations and
+ * the index tables go away.
+ *
+ * The default is on for 32-bit targets, off elsewhere.
+ */
+#ifndef CF_SHA3_UNROLLED
+# if UINTPTR_MAX == 0xffffffffu
+#  define CF_SHA3_UNROLLED 1
+# else
+#  define CF_SHA3_UNROLLED 0
+# endif
+#endif
+
 #endif
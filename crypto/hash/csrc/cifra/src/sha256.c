@@ -14,6 +14,7 @@
 
 #include <string.h>
 
+#include "cf_config.h"
 #include "sha2.h"
 #include "blockwise.h"
 #include "bitops.h"
@@ -72,6 +73,87 @@ void cf_sha224_init(cf_sha256_context *ctx)
   ctx->H[7] = 0xbefa4fa4;
 }
 
+#if CF_SHA256_UNROLLED
+
+/* Equivalent forms of CH and MAJ with one operation less. */
+# define CH1(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+# define MAJ1(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
+
+/* Round t of 16, the names of the working variables rotated instead of the values. */
+# define ROUND(a, b, c, d, e, f, g, h, j) \
+  do { \
+    uint32_t T1 = h + BSIG1(e) + CH1(e, f, g) + k[j] + W[j]; \
+    d += T1; \
+    h = T1 + BSIG0(a) + MAJ1(a, b, c); \
+  } while (0)
+
+# define ROUNDS16 \
+  do { \
+    ROUND(a, b, c, d, e, f, g, h, 0); \
+    ROUND(h, a, b, c, d, e, f, g, 1); \
+    ROUND(g, h, a, b, c, d, e, f, 2); \
+    ROUND(f, g, h, a, b, c, d, e, 3); \
+    ROUND(e, f, g, h, a, b, c, d, 4); \
+    ROUND(d, e, f, g, h, a, b, c, 5); \
+    ROUND(c, d, e, f, g, h, a, b, 6); \
+    ROUND(b, c, d, e, f, g, h, a, 7); \
+    ROUND(a, b, c, d, e, f, g, h, 8); \
+    ROUND(h, a, b, c, d, e, f, g, 9); \
+    ROUND(g, h, a, b, c, d, e, f, 10); \
+    ROUND(f, g, h, a, b, c, d, e, 11); \
+    ROUND(e, f, g, h, a, b, c, d, 12); \
+    ROUND(d, e, f, g, h, a, b, c, 13); \
+    ROUND(c, d, e, f, g, h, a, b, 14); \
+    ROUND(b, c, d, e, f, g, h, a, 15); \
+  } while (0)
+
+/* The next 16 words of the schedule, in place over the previous 16. */
+# define SCHED(j) \
+  W[j] += SSIG1(W[((j) + 14) & 15]) + W[((j) + 9) & 15] + SSIG0(W[((j) + 1) & 15])
+
+static void sha256_update_block(void *vctx, const uint8_t *inp)
+{
+  cf_sha256_context *ctx = vctx;
+  uint32_t W[16];
+  const uint32_t *k = K;
+
+  uint32_t a = ctx->H[0],
+           b = ctx->H[1],
+           c = ctx->H[2],
+           d = ctx->H[3],
+           e = ctx->H[4],
+           f = ctx->H[5],
+           g = ctx->H[6],
+           h = ctx->H[7];
+
+  for (size_t j = 0; j < 16; j++)
+    W[j] = read32_be(inp + 4 * j);
+
+  ROUNDS16;
+  for (int i = 0; i < 3; i++)
+  {
+    k += 16;
+    SCHED(0); SCHED(1); SCHED(2); SCHED(3);
+    SCHED(4); SCHED(5); SCHED(6); SCHED(7);
+    SCHED(8); SCHED(9); SCHED(10); SCHED(11);
+    SCHED(12); SCHED(13); SCHED(14); SCHED(15);
+    ROUNDS16;
+  }
+
+  ctx->H[0] += a;
+  ctx->H[1] += b;
+  ctx->H[2] += c;
+  ctx->H[3] += d;
+  ctx->H[4] += e;
+  ctx->H[5] += f;
+  ctx->H[6] += g;
+  ctx->H[7] += h;
+
+  ctx->blocks++;
+}
+
+#else
+
 static void sha256_update_block(void *vctx, const uint8_t *inp)
 {
   cf_sha256_context *ctx = vctx;
@@ -134,6 +216,8 @@ static void sha256_update_block(void *vctx, const uint8_t *inp)
   ctx->blocks++;
 }
 
+#endif
+
 void cf_sha256_update(cf_sha256_context *ctx, const void *data, size_t nbytes)
 {
   cf_blockwise_accumulate(ctx->partial, &ctx->npartial, sizeof ctx->partial,
@@ -14,6 +14,7 @@
 
 #include <string.h>
 
+#include "cf_config.h"
 #include "sha3.h"
 #include "blockwise.h"
 #include "handy.h"
@@ -36,6 +37,7 @@ static const cf_sha3_bi round_constants[24] = {
   { 0x00000001, 0x00008000 }, { 0x00000000, 0x80008082 }
 };
 
+#if !CF_SHA3_UNROLLED
 static const uint8_t rotation_constants[5][5] = {
   {  0,  1, 62, 28, 27, },
   { 36, 44,  6, 55, 20, },
@@ -43,6 +45,7 @@ static const uint8_t rotation_constants[5][5] = {
   { 41, 45, 15, 21,  8, },
   { 18,  2, 61, 56, 14, }
 };
+#endif
 
 /* --- Bit interleaving and uninterleaving --- */
 /* See bitinter.py for models of these bit twiddles.  The originals
@@ -155,6 +158,79 @@ static void absorb(cf_sha3_context *ctx, const uint8_t *data, uint16_t sz)
   }
 }
 
+#if CF_SHA3_UNROLLED
+
+/* Rotation by a constant n, 0 included. */
+# define ROL32(v, n) ((n) ? rotl32((v), (n)) : (v))
+
+# define THETA_C(x) \
+  do { \
+    C[x].odd = A[x][0].odd ^ A[x][1].odd ^ A[x][2].odd ^ A[x][3].odd ^ A[x][4].odd; \
+    C[x].evn = A[x][0].evn ^ A[x][1].evn ^ A[x][2].evn ^ A[x][3].evn ^ A[x][4].evn; \
+  } while (0)
+
+/* D[x] = C[x - 1] ^ rotl(C[x + 1], 1), as in rotl_bi_1. */
+# define THETA_D(x, xm, xp) \
+  do { \
+    D[x].odd = C[xm].odd ^ rotl32(C[xp].evn, 1); \
+    D[x].evn = C[xm].evn ^ C[xp].odd; \
+  } while (0)
+
+/* Lane (x, y) with theta applied, rotated by rot and moved by pi, as in rotl_bi_n. */
+# define RHO_PI(x, y, rot) \
+  do { \
+    uint32_t o = A[x][y].odd ^ D[x].odd, e = A[x][y].evn ^ D[x].evn; \
+    cf_sha3_bi *b = &B[y][(2 * (x) + 3 * (y)) % 5]; \
+    if ((rot) & 1) \
+    { \
+      b->odd = ROL32(e, ((rot) >> 1) + 1); \
+      b->evn = ROL32(o, (rot) >> 1); \
+    } else { \
+      b->odd = ROL32(o, (rot) >> 1); \
+      b->evn = ROL32(e, (rot) >> 1); \
+    } \
+  } while (0)
+
+# define CHI(x, y, x1, x2) \
+  do { \
+    A[x][y].odd = B[x][y].odd ^ (~B[x1][y].odd & B[x2][y].odd); \
+    A[x][y].evn = B[x][y].evn ^ (~B[x1][y].evn & B[x2][y].evn); \
+  } while (0)
+
+# define CHI_ROW(y) \
+  do { \
+    CHI(0, y, 1, 2); CHI(1, y, 2, 3); CHI(2, y, 3, 4); CHI(3, y, 4, 0); CHI(4, y, 0, 1); \
+  } while (0)
+
+/* Keccak-f[1600] on the bit-interleaved state, each round unrolled: all indices and
+ * rotation counts are constants, so the 32-bit rotations are immediates and there
+ * are no table lookups. */
+static void permute(cf_sha3_context *ctx)
+{
+  cf_sha3_bi (*A)[5] = ctx->A;
+  cf_sha3_bi B[5][5], C[5], D[5];
+
+  for (int r = 0; r < 24; r++)
+  {
+    THETA_C(0); THETA_C(1); THETA_C(2); THETA_C(3); THETA_C(4);
+    THETA_D(0, 4, 1); THETA_D(1, 0, 2); THETA_D(2, 1, 3); THETA_D(3, 2, 4); THETA_D(4, 3, 0);
+
+    RHO_PI(0, 0,  0); RHO_PI(0, 1, 36); RHO_PI(0, 2,  3); RHO_PI(0, 3, 41); RHO_PI(0, 4, 18);
+    RHO_PI(1, 0,  1); RHO_PI(1, 1, 44); RHO_PI(1, 2, 10); RHO_PI(1, 3, 45); RHO_PI(1, 4,  2);
+    RHO_PI(2, 0, 62); RHO_PI(2, 1,  6); RHO_PI(2, 2, 43); RHO_PI(2, 3, 15); RHO_PI(2, 4, 61);
+    RHO_PI(3, 0, 28); RHO_PI(3, 1, 55); RHO_PI(3, 2, 25); RHO_PI(3, 3, 21); RHO_PI(3, 4, 56);
+    RHO_PI(4, 0, 27); RHO_PI(4, 1, 20); RHO_PI(4, 2, 39); RHO_PI(4, 3,  8); RHO_PI(4, 4, 14);
+
+    CHI_ROW(0); CHI_ROW(1); CHI_ROW(2); CHI_ROW(3); CHI_ROW(4);
+
+    /* iota */
+    A[0][0].odd ^= round_constants[r].odd;
+    A[0][0].evn ^= round_constants[r].evn;
+  }
+}
+
+#else
+
 /* Integers [-1,20] mod 5. To avoid a divmod.  Indices
  * are constants; not data-dependant. */
 static const uint8_t mod5_table[] = {
@@ -225,6 +301,8 @@ static void permute(cf_sha3_context *ctx)
   }
 }
 
+#endif
+
 static void extract(cf_sha3_context *ctx, uint8_t *out, size_t nbytes)
 {
   uint16_t lanes = (nbytes + 7) / 8;
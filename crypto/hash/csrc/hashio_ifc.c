@@ -0,0 +1,53 @@
+#include "zerynth.h"
+#include "hash_common.h"
+
+/*
+ * Copies of hash contexts, and hashing of memory mapped regions in one call. The context of a hash object is updated in place through the
+ * update function of its common context (the _cctx of the hash classes), like the update natives of each module do.
+ */
+
+C_NATIVE(zs_hash_update_flash){
+    NATIVE_UNWARN();
+
+    uint8_t *hash_ctx;
+    uint32_t hash_ctx_len;
+    uint8_t *pctx;
+    uint32_t ctx_len;
+    uint8_t *addr;
+    int32_t size;
+
+    if (nargs != 4 || !PYARG_BYTES(0, hash_ctx, hash_ctx_len) || !PYARG_BYTES(1, pctx, ctx_len)) {
+        return ERR_TYPE_EXC;
+    }
+    if (!IS_INTEGER(args[2]) || !IS_PSMALLINT(args[3])) {
+        return ERR_TYPE_EXC;
+    }
+    addr = (uint8_t*)INTEGER_VALUE(args[2]);
+    size = PSMALLINT_VALUE(args[3]);
+    if (size < 0 || hash_ctx_len < sizeof(HashCommonContext)) {
+        return ERR_VALUE_EXC;
+    }
+
+    HashCommonContext *hcc = (HashCommonContext*)hash_ctx;
+    RELEASE_GIL();
+    hcc->update_hash(pctx, addr, size);
+    ACQUIRE_GIL();
+    *res = args[1];
+
+    return ERR_OK;
+}
+
+
+C_NATIVE(zs_hash_copy){
+    NATIVE_UNWARN();
+
+    uint8_t *pctx;
+    uint32_t ctx_len;
+
+    if (nargs < 1 || !PYARG_BYTES(0, pctx, ctx_len)) {
+        return ERR_TYPE_EXC;
+    }
+    *res = pbytes_new(ctx_len, pctx);
+
+    return ERR_OK;
+}
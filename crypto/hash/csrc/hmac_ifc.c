@@ -5,6 +5,14 @@
 
 //#define printf(...) vbl_printf_stdout(__VA_ARGS__)
 
+/* the context bytes hold the cf_chash followed by the cf_hmac_ctx pointing to it: the pointer is set again
+   at each use, since the bytes can be moved by the gc or copied by HMAC.copy */
+static cf_hmac_ctx *hmac_ctx_of(uint8_t *pctx){
+    cf_hmac_ctx *hmac_ctx = (cf_hmac_ctx*) (pctx+sizeof(cf_chash));
+    hmac_ctx->hash = (cf_chash*) pctx;
+    return hmac_ctx;
+}
+
 C_NATIVE(zs_hmac_init){
     NATIVE_UNWARN();
 
@@ -13,7 +21,7 @@ C_NATIVE(zs_hmac_init){
     uint8_t *key;
     uint32_t key_len;
 
-    if (parse_py_args("ss", nargs, args, &key, &key_len,&hash_ctx, &hash_ctx_len)!= 2) {
+    if (nargs < 2 || !PYARG_BYTES(0, key, key_len) || !PYARG_BYTES(1, hash_ctx, hash_ctx_len)) {
         return ERR_TYPE_EXC;
     }
 
@@ -45,12 +53,12 @@ C_NATIVE(zs_hmac_update){
     uint8_t *data;
     uint32_t data_len;
 
-    if (parse_py_args("ss", nargs, args, &pctx, &ctx_len, &data, &data_len)!= 2) {
+    if (nargs < 2 || !PYARG_BYTES(0, pctx, ctx_len) || !PYARG_BYTES(1, data, data_len)) {
         return ERR_TYPE_EXC;
     }
 
     RELEASE_GIL();
-    cf_hmac_ctx *hmac_ctx = (cf_hmac_ctx*) (pctx+sizeof(cf_chash));
+    cf_hmac_ctx *hmac_ctx = hmac_ctx_of(pctx);
     cf_hmac_update(hmac_ctx,data,data_len);
     ACQUIRE_GIL();
     *res = args[0];
@@ -68,16 +76,20 @@ C_NATIVE(zs_hmac_digest){
     uint32_t data_len;
     
 
-    if (parse_py_args("s", nargs, args, &pctx, &ctx_len)!= 1) {
+    if (nargs < 1 || !PYARG_BYTES(0, pctx, ctx_len)) {
         return ERR_TYPE_EXC;
     }
 
     RELEASE_GIL();
-    cf_hmac_ctx *hmac_ctx = (cf_hmac_ctx*) (pctx+sizeof(cf_chash));
+    cf_hmac_ctx *hmac_ctx = hmac_ctx_of(pctx);
     cf_chash     *hash_ifc = (cf_chash*) pctx;
     PBytes *bres = pbytes_new(hash_ifc->hashsz,NULL);
-   
-    cf_hmac_finish(hmac_ctx, PSEQUENCE_BYTES(bres));
+
+    //cf_hmac_finish wipes the context: finish a copy, so that the object can be updated further
+    cf_hmac_ctx *fin = gc_malloc(sizeof(cf_hmac_ctx));
+    memcpy(fin,hmac_ctx,sizeof(cf_hmac_ctx));
+    cf_hmac_finish(fin, PSEQUENCE_BYTES(bres));
+    gc_free(fin);
     ACQUIRE_GIL();
     *res = bres;
     return ERR_OK;
@@ -86,3 +98,47 @@ C_NATIVE(zs_hmac_digest){
 
 
 
+/*
+ * args: ctx, data, out
+ * the mac of data with the key of ctx, a context just initialized by zs_hmac_init and left untouched: the inner and outer
+ * hashes already absorbed the padded key, so only data is hashed on a copy. The digest is written at the start of the
+ * bytearray out, returning its size, or returned as bytes if out is None
+ */
+C_NATIVE(zs_hmac_mac){
+    NATIVE_UNWARN();
+
+    uint8_t* pctx;
+    uint32_t ctx_len;
+    uint8_t *data;
+    uint32_t data_len;
+    uint8_t *out;
+    PBytes *bres = NULL;
+
+    if (nargs != 3 || parse_py_args("ss", 2, args, &pctx, &ctx_len, &data, &data_len)!= 2) {
+        return ERR_TYPE_EXC;
+    }
+    if (ctx_len != sizeof(cf_chash)+sizeof(cf_hmac_ctx)) {
+        return ERR_VALUE_EXC;
+    }
+    cf_chash *hash_ifc = (cf_chash*) pctx;
+    if (args[2] == MAKE_NONE()) {
+        bres = pbytes_new(hash_ifc->hashsz,NULL);
+        out = PSEQUENCE_BYTES(bres);
+    } else if (PTYPE(args[2]) == PBYTEARRAY) {
+        if (PSEQUENCE_ELEMENTS(args[2]) < hash_ifc->hashsz)
+            return ERR_INDEX_EXC;
+        out = PSEQUENCE_BYTES(args[2]);
+    } else {
+        return ERR_TYPE_EXC;
+    }
+
+    RELEASE_GIL();
+    cf_hmac_ctx *fin = gc_malloc(sizeof(cf_hmac_ctx));
+    memcpy(fin,hmac_ctx_of(pctx),sizeof(cf_hmac_ctx));
+    cf_hmac_update(fin,data,data_len);
+    cf_hmac_finish(fin,out);
+    gc_free(fin);
+    ACQUIRE_GIL();
+    *res = (bres) ? (PObject*)bres : PSMALLINT_NEW(hash_ifc->hashsz);
+    return ERR_OK;
+}
@@ -38,7 +38,7 @@ C_NATIVE(zs_md5_update){
     uint8_t *data;
     uint32_t data_len;
 
-    if (parse_py_args("ss", nargs, args, &pctx, &ctx_len, &data, &data_len)!= 2) {
+    if (nargs < 2 || !PYARG_BYTES(0, pctx, ctx_len) || !PYARG_BYTES(1, data, data_len)) {
         return ERR_TYPE_EXC;
     }
 
@@ -60,11 +60,14 @@ C_NATIVE(zs_md5_digest){
     uint32_t data_len;
     uint8_t hash[16];
 
-    if (parse_py_args("s", nargs, args, &pctx, &ctx_len)!= 1) {
+    if (nargs < 1 || !PYARG_BYTES(0, pctx, ctx_len)) {
         return ERR_TYPE_EXC;
     }
     RELEASE_GIL();
-    MD5_Final(hash, pctx);
+    //MD5_Final consumes the context: finish a copy, like the cifra digests do
+    MD5_CTX ours;
+    memcpy(&ours,pctx,sizeof(MD5_CTX));
+    MD5_Final(hash, &ours);
     ACQUIRE_GIL();
     *res = pbytes_new(16,hash);
     return ERR_OK;
@@ -77,7 +80,7 @@ C_NATIVE(zs_md5_context){
     uint8_t *pctx;
     uint32_t ctx_len;
 
-    if (parse_py_args("s", nargs, args, &pctx, &ctx_len)!= 1) {
+    if (nargs < 1 || !PYARG_BYTES(0, pctx, ctx_len)) {
         return ERR_TYPE_EXC;
     }
 
@@ -26,7 +26,7 @@ C_NATIVE(zs_sha1_update){
     uint8_t *data;
     uint32_t data_len;
 
-    if (parse_py_args("ss", nargs, args, &pctx, &ctx_len, &data, &data_len)!= 2) {
+    if (nargs < 2 || !PYARG_BYTES(0, pctx, ctx_len) || !PYARG_BYTES(1, data, data_len)) {
         return ERR_TYPE_EXC;
     }
     RELEASE_GIL();
@@ -47,7 +47,7 @@ C_NATIVE(zs_sha1_digest){
     uint8_t *data;
     uint32_t data_len;
 
-    if (parse_py_args("s", nargs, args, &pctx, &ctx_len)!= 1) {
+    if (nargs < 1 || !PYARG_BYTES(0, pctx, ctx_len)) {
         return ERR_TYPE_EXC;
     }
     RELEASE_GIL();
@@ -65,7 +65,7 @@ C_NATIVE(zs_sha1_context){
     uint8_t *pctx;
     uint32_t ctx_len;
 
-    if (parse_py_args("s", nargs, args, &pctx, &ctx_len)!= 1) {
+    if (nargs < 1 || !PYARG_BYTES(0, pctx, ctx_len)) {
         return ERR_TYPE_EXC;
     }
 
@@ -13,7 +13,7 @@
 C_NATIVE(zs_sha2_init){
     NATIVE_UNWARN();
     uint32_t hashtype;
-    if (parse_py_args("i", nargs, args, &hashtype)!= 1) {
+    if (nargs < 1 || !PYARG_INT(0, hashtype)) {
         return ERR_TYPE_EXC;
     }
 
@@ -44,7 +44,7 @@ C_NATIVE(zs_sha2_update){
     uint32_t data_len;
     uint32_t hashtype;
 
-    if (parse_py_args("iss", nargs, args, &hashtype, &pctx, &ctx_len, &data, &data_len)!= 3) {
+    if (nargs < 3 || !PYARG_INT(0, hashtype) || !PYARG_BYTES(1, pctx, ctx_len) || !PYARG_BYTES(2, data, data_len)) {
         return ERR_TYPE_EXC;
     }
 
@@ -73,7 +73,7 @@ C_NATIVE(zs_sha2_digest){
     uint32_t data_len;
     uint32_t hashtype;
 
-    if (parse_py_args("is", nargs, args, &hashtype, &pctx, &ctx_len)!= 2) {
+    if (nargs < 2 || !PYARG_INT(0, hashtype) || !PYARG_BYTES(1, pctx, ctx_len)) {
         return ERR_TYPE_EXC;
     }
 
@@ -110,7 +110,7 @@ C_NATIVE(zs_sha2_context){
     uint8_t *pctx;
     uint32_t ctx_len;
 
-    if (parse_py_args("is", nargs, args, &hashtype, &pctx, &ctx_len)!= 2) {
+    if (nargs < 2 || !PYARG_INT(0, hashtype) || !PYARG_BYTES(1, pctx, ctx_len)) {
         return ERR_TYPE_EXC;
     }
 
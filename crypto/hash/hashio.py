@@ -0,0 +1,68 @@
+"""
+.. module:: hashio
+
+************
+Bulk hashing
+************
+
+This module feeds the hash objects of :samp:`crypto.hash` from files, streams and flash regions, without a Python call for
+every small piece. It is used by the :samp:`update_from` and :samp:`update_from_flash` methods of the hash classes,
+and works with any object having an :samp:`update` method, such as :class:`hmac.HMAC`.
+
+    """
+
+@c_native("zs_hash_update_flash",["csrc/hashio_ifc.c"],[])
+def __hash_update_flash(cctx,ctx,addr,size):
+    pass
+
+# a new context with the state of ctx, for the copy methods of the hash classes
+@c_native("zs_hash_copy",["csrc/hashio_ifc.c"],[])
+def _copy_ctx(ctx):
+    pass
+
+
+def update_from(h,stream,chunk=4096,size=-1):
+    """
+.. function:: update_from(h,stream,chunk=4096,size=-1)
+
+    Updates the hash object *h* with *size* bytes read from *stream*, or up to its end if *size* is negative, and returns
+    the number of bytes hashed.
+
+    Files opened with :func:`os.open` are read and hashed natively in a single call, with *chunk* ignored. Other objects must have
+    a :samp:`readinto(buffer,size)` method (files, :class:`streams.FileStream`) or a :samp:`read(size)` method, and are read *chunk* bytes at a time.
+
+    """
+    if hasattr(stream,"_hash_into") and hasattr(h,"_cctx"):
+        return stream._hash_into(h._cctx(),h.ctx,size)
+    total = 0
+    if hasattr(stream,"readinto"):
+        buf = bytearray(chunk)
+        while size<0 or total<size:
+            want = chunk if size<0 or size-total>chunk else size-total
+            __elements_set(buf,chunk)
+            n = stream.readinto(buf,want)
+            if n<=0:
+                break
+            __elements_set(buf,n)
+            h.update(buf)
+            total+=n
+        return total
+    while size<0 or total<size:
+        data = stream.read(chunk if size<0 or size-total>chunk else size-total)
+        if not data:
+            break
+        h.update(data)
+        total+=len(data)
+    return total
+
+def update_from_flash(h,addr,size):
+    """
+.. function:: update_from_flash(h,addr,size)
+
+    Updates the hash object *h* with the *size* bytes of memory mapped flash at *addr*, for example a firmware slot,
+    in a single native call. *h* must be an instance of a hash class of :samp:`crypto.hash` (not :class:`hmac.HMAC`).
+
+    """
+    if not hasattr(h,"_cctx"):
+        raise TypeError
+    h.ctx = __hash_update_flash(h._cctx(),h.ctx,addr,size)
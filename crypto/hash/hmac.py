@@ -11,6 +11,8 @@ The module is based on the C library `cifra <https://github.com/ctz/cifra>`_.
 
     """
 
+from crypto.hash import hashio
+
 @c_native("zs_hmac_init",["csrc/hmac_ifc.c","csrc/cifra/src/hmac.c","csrc/cifra/src/blockwise.c","csrc/cifra/src/chash.c"],[],["-I.../csrc/cifra/src","-I.../csrc/cifra/src/ext"])
 def __hmac_init(key,hashfn):
     pass
@@ -23,6 +25,10 @@ def __hmac_update(ctx,data):
 def __hmac_digest(ctx):
     pass
 
+@c_native("zs_hmac_mac",[])
+def __hmac_mac(ctx,data,out):
+    pass
+
 
 class HMAC():
     """
@@ -31,8 +37,11 @@ class HMAC():
     Return a new hmac object. *key* is a bytes or bytearray or string object giving the secret key. *hashfn* is an
     instance of a hash function to use in hmac generation. It supports any class in the :samp:`crypto.hash` module.
     """
-    def __init__(self,key,hashfn):
-        self.ctx = __hmac_init(key,hashfn._cctx())
+    def __init__(self,key,hashfn,_ctx=None):
+        if _ctx is not None:
+            self.ctx = _ctx
+        else:
+            self.ctx = __hmac_init(key,hashfn._cctx())
 
     def update(self,data):
         """
@@ -41,16 +50,25 @@ class HMAC():
     Update the hmac object with the string *data*. Repeated calls are equivalent to a single call with the concatenation of all
     the arguments: m.update(a); m.update(b) is equivalent to m.update(a+b).
         """
-        self.ctx = __hmac_update(self.ctx,data)
+        __hmac_update(self.ctx,data)
 
     def digest(self):
         """
 .. method:: digest()
 
     Return the digest of the strings passed to the update method so far. The size depends on *hashfn*.
+    The object can still be updated afterwards.
         """
         return __hmac_digest(self.ctx)
 
+    def copy(self):
+        """
+.. method:: copy()
+
+    Return a new object with the same state, to compute the digest of a common prefix followed by different data.
+        """
+        return HMAC(None,None,hashio._copy_ctx(self.ctx))
+
     def hexdigest(self):
         """
 .. method:: hexdigest()
@@ -59,3 +77,47 @@ class HMAC():
         """
         return "".join([hex(x,"") for x in self.digest()])
 
+
+class HMACKey():
+    """
+.. class:: HMACKey(key,hashfn)
+
+    A key ready to authenticate many messages: the padded key is hashed once, here, instead of once per :class:`HMAC` object.
+    *key* and *hashfn* are as in :class:`HMAC`. ::
+
+        from crypto.hash import hmac
+        from crypto.hash import sha2
+
+        k = hmac.HMACKey(secret,sha2.SHA2())
+        tag = bytearray(32)
+        for msg in messages:
+            k.mac_into(msg,tag)
+
+    """
+    def __init__(self,key,hashfn):
+        self.ctx = __hmac_init(key,hashfn._cctx())
+
+    def mac(self,data):
+        """
+.. method:: mac(data)
+
+    Returns the digest of *data*, as :samp:`HMAC(key,hashfn)` updated with *data* would.
+        """
+        return __hmac_mac(self.ctx,data,None)
+
+    def mac_into(self,data,out):
+        """
+.. method:: mac_into(data,out)
+
+    Like :meth:`mac`, but writes the digest at the start of the bytearray *out* and returns its size, without allocating memory.
+    Raises :samp:`IndexError` if *out* is shorter than the digest.
+        """
+        return __hmac_mac(self.ctx,data,out)
+
+    def hmac(self):
+        """
+.. method:: hmac()
+
+    Returns a new :class:`HMAC` object for this key, to authenticate a message fed in pieces.
+        """
+        return HMAC(None,None,hashio._copy_ctx(self.ctx))
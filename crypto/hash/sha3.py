@@ -22,6 +22,8 @@ The module is based on the C library `cifra <https://github.com/ctz/cifra>`_.
 
 """
 
+from crypto.hash import hashio
+
 @c_native("zs_sha3_init",["csrc/sha3_ifc.c","csrc/cifra/src/sha3.c","csrc/cifra/src/blockwise.c"],[],["-I.../csrc/cifra/src","-I.../csrc/cifra/src/ext"])
 def __hash_init(hashtype):
     pass
@@ -68,7 +70,7 @@ The SHA3 class
     Update the sha object with the string *data*. Repeated calls are equivalent to a single call with the concatenation of all
     the arguments: m.update(a); m.update(b) is equivalent to m.update(a+b).
         """
-        self.ctx = __hash_update(self.hashtype,self.ctx,data)
+        __hash_update(self.hashtype,self.ctx,data)
 
     def digest(self):
         """
@@ -87,6 +89,33 @@ The SHA3 class
         """
         return "".join([hex(x,"") for x in self.digest()])
 
+    def copy(self):
+        """
+.. method:: copy()
+
+    Return a new object with the same state, to compute the digest of a common prefix followed by different data.
+        """
+        h = SHA3(self.hashtype)
+        h.ctx = hashio._copy_ctx(self.ctx)
+        return h
+
+    def update_from(self,stream,chunk=4096,size=-1):
+        """
+.. method:: update_from(stream,chunk=4096,size=-1)
+
+    Update the object with *size* bytes read from *stream* (a file or a stream), or up to its end if *size* is -1, and return the
+    number of bytes hashed. Files are read and hashed natively in a single call. See :func:`hashio.update_from`.
+        """
+        return hashio.update_from(self,stream,chunk,size)
+
+    def update_from_flash(self,addr,size):
+        """
+.. method:: update_from_flash(addr,size)
+
+    Update the object with *size* bytes of memory mapped flash starting at *addr*, in a single native call.
+        """
+        hashio.update_from_flash(self,addr,size)
+
     def _cctx(self):
         return __make_context(self.hashtype,self.ctx)
     
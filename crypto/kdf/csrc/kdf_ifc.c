@@ -0,0 +1,154 @@
+#include "zerynth.h"
+#include "hash_common.h"
+#include "hmac.h"
+#include "chash.h"
+#include "bitops.h"
+
+//#define printf(...) vbl_printf_stdout(__VA_ARGS__)
+
+/*
+ * PBKDF2-HMAC (RFC 8018) and HKDF (RFC 5869) over the hash functions of crypto.hash, given by their common context.
+ * The key is padded and hashed into an HMAC context once: each HMAC of the derivation then starts from a copy of it.
+ * HMAC contexts are large (two hash contexts each), so they are allocated instead of taking the Python thread stack.
+ */
+
+typedef struct _kdf_ctx {
+    cf_chash hash;
+    cf_hmac_ctx key;    // padded key absorbed
+    cf_hmac_ctx work;
+    uint8_t u[CF_MAXHASH];
+    uint8_t t[CF_MAXHASH];
+} KdfContext;
+
+// checks the common context and the output length, then allocates the result and the context, with the GIL held
+static err_t kdf_start(PObject *cctx, int32_t dklen, int32_t maxlen, KdfContext **kdf, PBytes **bres)
+{
+    HashCommonContext *hcc;
+
+    if (PTYPE(cctx) != PBYTES || PSEQUENCE_ELEMENTS(cctx) < sizeof(HashCommonContext))
+        return ERR_TYPE_EXC;
+    hcc = (HashCommonContext*)PSEQUENCE_BYTES(cctx);
+    if (hcc->result_size > CF_MAXHASH)
+        return ERR_UNSUPPORTED_EXC;
+    if (dklen <= 0 || (maxlen && dklen > maxlen))
+        return ERR_VALUE_EXC;
+    *kdf = gc_malloc(sizeof(KdfContext));
+    (*kdf)->hash.hashsz = hcc->result_size;
+    (*kdf)->hash.blocksz = hcc->block_size;
+    (*kdf)->hash.init = hcc->init_hash;
+    (*kdf)->hash.update = hcc->update_hash;
+    (*kdf)->hash.digest = hcc->finish_hash;
+    *bres = pbytes_new(dklen, NULL);
+    return ERR_OK;
+}
+
+static void kdf_end(KdfContext *kdf)
+{
+    memset(kdf, 0, sizeof(KdfContext));
+    gc_free(kdf);
+}
+
+/*
+ * args: cctx, password, salt, iterations, dklen
+ * returns the dklen bytes of PBKDF2-HMAC with the hash function of cctx
+ */
+C_NATIVE(zs_kdf_pbkdf2){
+    NATIVE_UNWARN();
+    uint8_t *pw, *salt, *out;
+    uint32_t pw_len, salt_len, i, block, n;
+    int32_t iterations, dklen;
+    uint8_t countbuf[4];
+    KdfContext *kdf;
+    PBytes *bres;
+    err_t err;
+
+    if (nargs != 5 || parse_py_args("ssii", 4, args + 1, &pw, &pw_len, &salt, &salt_len, &iterations, &dklen) != 4)
+        return ERR_TYPE_EXC;
+    if (iterations <= 0)
+        return ERR_VALUE_EXC;
+    if ((err = kdf_start(args[0], dklen, 0, &kdf, &bres)) != ERR_OK)
+        return err;
+    out = PSEQUENCE_BYTES(bres);
+
+    RELEASE_GIL();
+    cf_hmac_init(&kdf->key, &kdf->hash, pw, pw_len);
+    for (block = 1; dklen > 0; block++) {
+        // U_1 = PRF(P, S || INT_32_BE(block)), then U_c = PRF(P, U_{c-1}), T = U_1 ^ ... ^ U_iterations
+        write32_be(block, countbuf);
+        memcpy(&kdf->work, &kdf->key, sizeof(cf_hmac_ctx));
+        cf_hmac_update(&kdf->work, salt, salt_len);
+        cf_hmac_update(&kdf->work, countbuf, 4);
+        cf_hmac_finish(&kdf->work, kdf->u);
+        memcpy(kdf->t, kdf->u, kdf->hash.hashsz);
+        for (i = 1; i < (uint32_t)iterations; i++) {
+            memcpy(&kdf->work, &kdf->key, sizeof(cf_hmac_ctx));
+            cf_hmac_update(&kdf->work, kdf->u, kdf->hash.hashsz);
+            cf_hmac_finish(&kdf->work, kdf->u);
+            xor_bb(kdf->t, kdf->t, kdf->u, kdf->hash.hashsz);
+        }
+        n = ((uint32_t)dklen < kdf->hash.hashsz) ? (uint32_t)dklen : kdf->hash.hashsz;
+        memcpy(out, kdf->t, n);
+        out += n;
+        dklen -= n;
+    }
+    kdf_end(kdf);
+    ACQUIRE_GIL();
+    *res = bres;
+    return ERR_OK;
+}
+
+/*
+ * args: cctx, ikm, salt, info, dklen
+ * returns the dklen bytes of HKDF with the hash function of cctx: PRK = HMAC(salt, ikm) (a zero filled salt if empty),
+ * T(i) = HMAC(PRK, T(i-1) || info || i)
+ */
+C_NATIVE(zs_kdf_hkdf){
+    NATIVE_UNWARN();
+    uint8_t *ikm, *salt, *info, *out;
+    uint32_t ikm_len, salt_len, info_len, n, hashsz;
+    int32_t dklen;
+    uint8_t counter;
+    KdfContext *kdf;
+    PBytes *bres;
+    HashCommonContext *hcc;
+    err_t err;
+
+    if (nargs != 5 || parse_py_args("sssi", 4, args + 1, &ikm, &ikm_len, &salt, &salt_len, &info, &info_len, &dklen) != 4)
+        return ERR_TYPE_EXC;
+    if (PTYPE(args[0]) != PBYTES || PSEQUENCE_ELEMENTS(args[0]) < sizeof(HashCommonContext))
+        return ERR_TYPE_EXC;
+    hcc = (HashCommonContext*)PSEQUENCE_BYTES(args[0]);
+    if ((err = kdf_start(args[0], dklen, 255 * hcc->result_size, &kdf, &bres)) != ERR_OK)
+        return err;
+    out = PSEQUENCE_BYTES(bres);
+    hashsz = kdf->hash.hashsz;
+
+    RELEASE_GIL();
+    // extract
+    if (!salt_len) {
+        memset(kdf->t, 0, hashsz);
+        salt = kdf->t;
+        salt_len = hashsz;
+    }
+    cf_hmac_init(&kdf->work, &kdf->hash, salt, salt_len);
+    cf_hmac_update(&kdf->work, ikm, ikm_len);
+    cf_hmac_finish(&kdf->work, kdf->u);
+    // expand
+    cf_hmac_init(&kdf->key, &kdf->hash, kdf->u, hashsz);
+    for (counter = 1; dklen > 0; counter++) {
+        memcpy(&kdf->work, &kdf->key, sizeof(cf_hmac_ctx));
+        if (counter > 1)
+            cf_hmac_update(&kdf->work, kdf->t, hashsz);
+        cf_hmac_update(&kdf->work, info, info_len);
+        cf_hmac_update(&kdf->work, &counter, 1);
+        cf_hmac_finish(&kdf->work, kdf->t);
+        n = ((uint32_t)dklen < hashsz) ? (uint32_t)dklen : hashsz;
+        memcpy(out, kdf->t, n);
+        out += n;
+        dklen -= n;
+    }
+    kdf_end(kdf);
+    ACQUIRE_GIL();
+    *res = bres;
+    return ERR_OK;
+}
@@ -0,0 +1,62 @@
+"""
+.. module: kdf
+
+***************
+Key derivation
+***************
+
+This module derives keys from passwords or from other keys, natively and with the GIL released:
+
+    * :func:`pbkdf2_hmac`, PBKDF2 with HMAC as in `RFC 8018 <https://tools.ietf.org/html/rfc8018>`_, for keys derived from passwords
+    * :func:`hkdf`, HKDF as in `RFC 5869 <https://tools.ietf.org/html/rfc5869>`_, for keys derived from secrets with enough entropy, such as shared secrets of key agreements
+
+Both work with any hash class of the :samp:`crypto.hash` modules, passed as an instance as for :class:`hmac.HMAC`. The key is padded and hashed once,
+and each HMAC of the derivation starts from a copy of that state. ::
+
+    from crypto.kdf import kdf
+    from crypto.hash import sha2
+
+    key = kdf.pbkdf2_hmac(sha2.SHA2(),"password","salt",10000,32)
+
+The module is based on the C library `cifra <https://github.com/ctz/cifra>`_.
+
+"""
+
+@c_native("zs_kdf_pbkdf2",[
+    "csrc/kdf_ifc.c",
+    "#crypto/hash/csrc/cifra/src/hmac.c",
+    "#crypto/hash/csrc/cifra/src/chash.c",
+    "#crypto/hash/csrc/cifra/src/blockwise.c",
+    ],[],["-I.../../hash/csrc","-I.../../hash/csrc/cifra/src","-I.../../hash/csrc/cifra/src/ext"])
+def __pbkdf2(cctx,password,salt,iterations,dklen):
+    pass
+
+@c_native("zs_kdf_hkdf",[])
+def __hkdf(cctx,ikm,salt,info,dklen):
+    pass
+
+
+def pbkdf2_hmac(hashfn,password,salt,iterations,dklen=None):
+    """
+.. function:: pbkdf2_hmac(hashfn,password,salt,iterations,dklen=None)
+
+    Returns *dklen* bytes derived from *password* and *salt* (bytes, bytearray or strings) with *iterations* rounds of PBKDF2 using HMAC with
+    *hashfn*, an instance of a hash class. If *dklen* is None, the digest size of *hashfn* is used.
+
+    """
+    if dklen is None:
+        dklen = len(hashfn.digest())
+    return __pbkdf2(hashfn._cctx(),password,salt,iterations,dklen)
+
+def hkdf(hashfn,ikm,salt="",info="",dklen=None):
+    """
+.. function:: hkdf(hashfn,ikm,salt="",info="",dklen=None)
+
+    Returns *dklen* bytes derived by HKDF with *hashfn*, an instance of a hash class, from the input key material *ikm*, the optional *salt* and the
+    context and application specific *info*. If *dklen* is None, the digest size of *hashfn* is used. :samp:`ValueError` is raised if *dklen* is
+    greater than 255 times the digest size.
+
+    """
+    if dklen is None:
+        dklen = len(hashfn.digest())
+    return __hkdf(hashfn._cctx(),ikm,salt,info,dklen)
@@ -95,7 +95,8 @@ int Base64encode(char * coded_dst, const char *plain_src,int len_plain_src);
 int Base64decode_len(const char * coded_src, int coded_len);
 int Base64decode(char * plain_dst, const char *coded_src, int coded_len);
 
-/* aaaack but it's fast and const should make it shared text page. */
+/* aaaack but it's fast and const should make it shared text page.
+ * Both the standard (+/) and the url safe (-_) alphabets are decoded */
 #if defined(BYTECODE_ACCESS_ALIGNED_4)
 unsigned char pr2six[256] __attribute__ ((section (".data"))) =
 #else
@@ -105,10 +106,10 @@ static const unsigned char const pr2six[256] =
     /* ASCII table */
     64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
     64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 62, 64, 64, 64, 63,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 62, 64, 62, 64, 63,
     52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 64, 64, 64, 64, 64, 64,
     64,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
-    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 64, 64, 64, 64, 64,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 64, 64, 64, 64, 63,
     64, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
     41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 64, 64, 64, 64, 64,
     64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
@@ -121,64 +122,57 @@ static const unsigned char const pr2six[256] =
     64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64
 };
 
-int Base64decode_len(const char *bufcoded, int coded_len)
+/* number of leading chars of bufcoded belonging to the alphabet (padding excluded) */
+static int Base64decode_chars(const char *bufcoded, int coded_len)
 {
-    int nbytesdecoded;
-    register const unsigned char *bufin;
-    register int nprbytes;
+    register const unsigned char *bufin = (const unsigned char *) bufcoded;
+    register int nprbytes = 0;
 
-    bufin = (const unsigned char *) bufcoded;
-    while (pr2six[*(bufin++)] <= 63 && ( coded_len-- >= 0));
+    while (nprbytes < coded_len && pr2six[bufin[nprbytes]] <= 63) nprbytes++;
+    return nprbytes;
+}
 
-    nprbytes = (bufin - (const unsigned char *) bufcoded) - 1;
-    nbytesdecoded = ((nprbytes + 3) / 4) * 3;
+int Base64decode_len(const char *bufcoded, int coded_len)
+{
+    int nprbytes = Base64decode_chars(bufcoded, coded_len);
 
-    return nbytesdecoded;// + 1;
+    /* a single trailing char carries no byte */
+    return (nprbytes / 4) * 3 + ((nprbytes & 3) ? (nprbytes & 3) - 1 : 0);
 }
 
+/* decodes 4 chars at a time through a 24 bit word. bufplain can be bufcoded itself:
+ * each group of 3 bytes is written after its 4 chars have been read */
 int Base64decode(char *bufplain, const char *bufcoded, int coded_len)
 {
-    int nbytesdecoded;
     register const unsigned char *bufin;
     register unsigned char *bufout;
     register int nprbytes;
+    register uint32_t w;
 
-    bufin = (const unsigned char *) bufcoded;
-    while (pr2six[*(bufin++)] <= 63 && (coded_len-- >= 0));
-    nprbytes = (bufin - (const unsigned char *) bufcoded) - 1;
-    nbytesdecoded = ((nprbytes + 3) / 4) * 3;
-
+    nprbytes = Base64decode_chars(bufcoded, coded_len);
     bufout = (unsigned char *) bufplain;
     bufin = (const unsigned char *) bufcoded;
 
-    while (nprbytes > 4) {
-    *(bufout++) =
-        (unsigned char) (pr2six[*bufin] << 2 | pr2six[bufin[1]] >> 4);
-    *(bufout++) =
-        (unsigned char) (pr2six[bufin[1]] << 4 | pr2six[bufin[2]] >> 2);
-    *(bufout++) =
-        (unsigned char) (pr2six[bufin[2]] << 6 | pr2six[bufin[3]]);
-    bufin += 4;
-    nprbytes -= 4;
+    while (nprbytes >= 4) {
+        w = ((uint32_t)pr2six[bufin[0]] << 18) | ((uint32_t)pr2six[bufin[1]] << 12) |
+            ((uint32_t)pr2six[bufin[2]] << 6) | pr2six[bufin[3]];
+        bufout[0] = (unsigned char) (w >> 16);
+        bufout[1] = (unsigned char) (w >> 8);
+        bufout[2] = (unsigned char) w;
+        bufin += 4;
+        bufout += 3;
+        nprbytes -= 4;
     }
 
     /* Note: (nprbytes == 1) would be an error, so just ingore that case */
     if (nprbytes > 1) {
-    *(bufout++) =
-        (unsigned char) (pr2six[*bufin] << 2 | pr2six[bufin[1]] >> 4);
-    }
-    if (nprbytes > 2) {
-    *(bufout++) =
-        (unsigned char) (pr2six[bufin[1]] << 4 | pr2six[bufin[2]] >> 2);
-    }
-    if (nprbytes > 3) {
-    *(bufout++) =
-        (unsigned char) (pr2six[bufin[2]] << 6 | pr2six[bufin[3]]);
+        w = ((uint32_t)pr2six[bufin[0]] << 18) | ((uint32_t)pr2six[bufin[1]] << 12);
+        if (nprbytes > 2) w |= ((uint32_t)pr2six[bufin[2]] << 6);
+        *(bufout++) = (unsigned char) (w >> 16);
+        if (nprbytes > 2) *(bufout++) = (unsigned char) (w >> 8);
     }
 
-    //*(bufout++) = '\0';
-    nbytesdecoded -= (4 - nprbytes) & 3;
-    return nbytesdecoded;
+    return bufout - (unsigned char *) bufplain;
 }
 
 #if defined(BYTECODE_ACCESS_ALIGNED_4)
@@ -188,37 +182,56 @@ static const char const basis_64[] =
 #endif
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
+#if defined(BYTECODE_ACCESS_ALIGNED_4)
+char basis_64url[] __attribute__ ((section (".data"))) =
+#else
+static const char const basis_64url[] =
+#endif
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
 int Base64encode_len(int len)
 {
     return ((len + 2) / 3 * 4);// + 1;
 }
 
+/* length of the encoding without padding */
+int Base64encode_nopad_len(int len)
+{
+    return (len / 3) * 4 + ((len % 3) ? (len % 3) + 1 : 0);
+}
+
+static int Base64encode_alphabet(char *encoded, const char *string, int len, const char *basis_64, int pad);
+
 int Base64encode(char *encoded, const char *string, int len)
+{
+    return Base64encode_alphabet(encoded, string, len, basis_64, 1);
+}
+
+/* encodes 3 bytes at a time through a 24 bit word */
+static int Base64encode_alphabet(char *encoded, const char *string, int len, const char *basis_64, int pad)
 {
     int i;
     char *p;
+    const unsigned char *in = (const unsigned char *) string;
+    uint32_t w;
 
     p = encoded;
     for (i = 0; i < len - 2; i += 3) {
-    *p++ = basis_64[(string[i] >> 2) & 0x3F];
-    *p++ = basis_64[((string[i] & 0x3) << 4) |
-                    ((int) (string[i + 1] & 0xF0) >> 4)];
-    *p++ = basis_64[((string[i + 1] & 0xF) << 2) |
-                    ((int) (string[i + 2] & 0xC0) >> 6)];
-    *p++ = basis_64[string[i + 2] & 0x3F];
+        w = ((uint32_t)in[i] << 16) | ((uint32_t)in[i + 1] << 8) | in[i + 2];
+        p[0] = basis_64[w >> 18];
+        p[1] = basis_64[(w >> 12) & 0x3F];
+        p[2] = basis_64[(w >> 6) & 0x3F];
+        p[3] = basis_64[w & 0x3F];
+        p += 4;
     }
     if (i < len) {
-    *p++ = basis_64[(string[i] >> 2) & 0x3F];
-    if (i == (len - 1)) {
-        *p++ = basis_64[((string[i] & 0x3) << 4)];
-        *p++ = '=';
-    }
-    else {
-        *p++ = basis_64[((string[i] & 0x3) << 4) |
-                        ((int) (string[i + 1] & 0xF0) >> 4)];
-        *p++ = basis_64[((string[i + 1] & 0xF) << 2)];
-    }
-    *p++ = '=';
+        w = (uint32_t)in[i] << 16;
+        if (i < len - 1) w |= (uint32_t)in[i + 1] << 8;
+        *p++ = basis_64[w >> 18];
+        *p++ = basis_64[(w >> 12) & 0x3F];
+        if (i < len - 1) *p++ = basis_64[(w >> 6) & 0x3F];
+        else if (pad) *p++ = '=';
+        if (pad) *p++ = '=';
     }
 
     //*p++ = '\0';
@@ -254,11 +267,97 @@ C_NATIVE(__b64_decode) {
     if (parse_py_args("s", nargs, args, &seq, &len) != 1) 
         return ERR_TYPE_EXC;
 
-    blen = Base64decode_len(seq,len); //padding included :(
+    blen = Base64decode_len(seq,len);
     PBytes *b64 = pbytes_new(blen,NULL);
     uint8_t *bseq = PSEQUENCE_BYTES(b64);
-    int tlen = Base64decode(bseq,seq,len);
-    PSEQUENCE_ELEMENTS_SET(b64,tlen); 
+    Base64decode(bseq,seq,len);
     *res = b64;
     return ERR_OK;
+}
+
+/*
+ * args: s, padding
+ * encodes with the url safe alphabet, with '=' padding only if requested
+ */
+C_NATIVE(__b64_urlsafe_encode) {
+    NATIVE_UNWARN();
+    uint8_t *seq;
+    uint32_t len;
+    uint32_t blen;
+    int pad;
+    *res = MAKE_NONE();
+    if (nargs!=2 || parse_py_args("s", 1, args, &seq, &len) != 1) 
+        return ERR_TYPE_EXC;
+
+    pad = (args[1]==PBOOL_TRUE());
+    blen = (pad) ? Base64encode_len(len):Base64encode_nopad_len(len);
+    PBytes *b64 = pbytes_new(blen,NULL);
+    Base64encode_alphabet(PSEQUENCE_BYTES(b64),seq,len,basis_64url,pad);
+    *res = b64;
+    return ERR_OK;
+}
+
+/*
+ * checks that the bytearray args[1] has room for blen bytes from offset args[2],
+ * setting out to the first one
+ */
+static err_t b64_into_args(int nargs, PObject **args, uint32_t blen, uint8_t **out){
+    int32_t offset;
+    if (nargs!=3 || PTYPE(args[1])!=PBYTEARRAY || PTYPE(args[2])!=PSMALLINT)
+        return ERR_TYPE_EXC;
+    offset = PSMALLINT_VALUE(args[2]);
+    if (offset<0 || offset+blen>PSEQUENCE_ELEMENTS(args[1]))
+        return ERR_INDEX_EXC;
+    *out = PSEQUENCE_BYTES(args[1])+offset;
+    return ERR_OK;
+}
+
+/*
+ * args: s, buffer, offset
+ * returns the number of encoded bytes written in buffer
+ */
+C_NATIVE(__b64_encode_into) {
+    NATIVE_UNWARN();
+    uint8_t *seq;
+    uint32_t len;
+    uint32_t blen;
+    uint8_t *out;
+    err_t err;
+    *res = MAKE_NONE();
+    if (parse_py_args("s", 1, args, &seq, &len) != 1) 
+        return ERR_TYPE_EXC;
+
+    blen = Base64encode_len(len);
+    if ((err=b64_into_args(nargs,args,blen,&out))!=ERR_OK)
+        return err;
+    //encoding grows data: overlapping buffers would be overwritten before being read
+    if (out<seq+len && seq<out+blen)
+        return ERR_VALUE_EXC;
+    *res = PSMALLINT_NEW(Base64encode(out,seq,len));
+    return ERR_OK;
+}
+
+/*
+ * args: s, buffer, offset
+ * returns the number of decoded bytes written in buffer. buffer can be s itself, with offset 0
+ */
+C_NATIVE(__b64_decode_into) {
+    NATIVE_UNWARN();
+    uint8_t *seq;
+    uint32_t len;
+    uint32_t blen;
+    uint8_t *out;
+    err_t err;
+    *res = MAKE_NONE();
+    if (parse_py_args("s", 1, args, &seq, &len) != 1) 
+        return ERR_TYPE_EXC;
+
+    blen = Base64decode_len(seq,len);
+    if ((err=b64_into_args(nargs,args,blen,&out))!=ERR_OK)
+        return err;
+    //decoding shrinks data: in place is fine as long as output does not run ahead of input
+    if (out>seq && out<seq+len)
+        return ERR_VALUE_EXC;
+    *res = PSMALLINT_NEW(Base64decode(out,seq,len));
+    return ERR_OK;
 }
\ No newline at end of file
@@ -0,0 +1,296 @@
+#include "zerynth.h"
+#include "blenotify.h"
+
+/*
+ * Notification queues of Characteristic.stream (see blenotify.h).
+ *
+ * Each queue is a byte ring bound to one characteristic: writers append under the system lock and wait, with the GIL released,
+ * while the ring is full; the driver (or the Python drainer of the ble module) takes one notification at a time, at most chunk
+ * bytes, so a full ring is sent in MTU sized notifications with no Python in between. The consumer is one thread only.
+ */
+
+#ifndef BLENOTIFY_RING
+#define BLENOTIFY_RING  4096    // power of 2
+#endif
+
+typedef struct _blenotify_queue {
+    uint16_t service;
+    uint16_t uuid;
+    uint16_t chunk;             // 0: as large as the driver allows
+    uint16_t used;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint32_t queued;            // bytes
+    uint32_t sent;              // notifications
+    VSemaphore space;
+    uint8_t ring[BLENOTIFY_RING];
+} BleNotifyQueue;
+
+void (*ble_notify_kick)(void);
+
+static BleNotifyQueue bn_queues[BLENOTIFY_QUEUES];
+static uint32_t bn_next;
+static VSemaphore bn_data;      // wakes the Python drainer
+
+int ble_notify_next(uint16_t *service, uint16_t *uuid, uint8_t *buf, int max)
+{
+    BleNotifyQueue *q;
+    uint32_t i, k, pos, n;
+
+    SYSLOCK();
+    for (i = 0; i < BLENOTIFY_QUEUES; i++) {
+        q = &bn_queues[(bn_next + i) % BLENOTIFY_QUEUES];
+        if (!q->used || q->head == q->tail)
+            continue;
+        k = q->tail - q->head;
+        if (q->chunk && k > q->chunk)
+            k = q->chunk;
+        if (k > (uint32_t)max)
+            k = max;
+        pos = q->head & (BLENOTIFY_RING - 1);
+        n = BLENOTIFY_RING - pos;
+        if (n > k)
+            n = k;
+        memcpy(buf, q->ring + pos, n);
+        memcpy(buf + n, q->ring, k - n);
+        q->head += k;
+        q->sent++;
+        *service = q->service;
+        *uuid = q->uuid;
+        bn_next = (bn_next + i + 1) % BLENOTIFY_QUEUES;
+        SYSUNLOCK();
+        vosSemSignalCap(q->space, 1);
+        return k;
+    }
+    SYSUNLOCK();
+    return 0;
+}
+
+static BleNotifyQueue *bn_queue(PObject *o)
+{
+    int32_t i;
+
+    if (!IS_PSMALLINT(o))
+        return NULL;
+    i = PSMALLINT_VALUE(o);
+    if (i < 0 || i >= BLENOTIFY_QUEUES || !bn_queues[i].used)
+        return NULL;
+    return &bn_queues[i];
+}
+
+// waits on sem with the GIL released, at most until timeout milliseconds after since
+static int32_t bn_wait(VSemaphore sem, int32_t timeout, uint32_t since)
+{
+    int32_t left = -1;
+    int32_t r;
+
+    if (timeout >= 0) {
+        left = timeout - (int32_t)((uint32_t)vosMillis() - since);
+        if (left <= 0)
+            return VRES_TIMEOUT;
+    }
+    RELEASE_GIL();
+    r = vosSemWaitTimeout(sem, (left < 0) ? VTIME_INFINITE : TIME_U(left, MILLIS));
+    ACQUIRE_GIL();
+    return r;
+}
+
+/*
+ * args: service, uuid, chunk
+ * returns the index of the queue of the characteristic, binding a free one to it the first time.
+ * chunk is the largest notification to send, 0 for the largest the link allows
+ */
+C_NATIVE(__blenotify_open) {
+    NATIVE_UNWARN();
+    int32_t service, uuid, chunk, i, free = -1;
+    BleNotifyQueue *q;
+
+    if (parse_py_args("iii", nargs, args, &service, &uuid, &chunk) != 3)
+        return ERR_TYPE_EXC;
+    if (chunk < 0 || chunk > 0xffff)
+        return ERR_VALUE_EXC;
+    for (i = 0; i < BLENOTIFY_QUEUES; i++) {
+        q = &bn_queues[i];
+        if (q->used && q->service == (uint16_t)service && q->uuid == (uint16_t)uuid)
+            break;
+        if (!q->used && free < 0)
+            free = i;
+    }
+    if (i == BLENOTIFY_QUEUES) {
+        if (free < 0)
+            return ERR_RUNTIME_EXC;
+        i = free;
+        q = &bn_queues[i];
+        if (!q->space)
+            q->space = vosSemCreate(0);
+        q->service = service;
+        q->uuid = uuid;
+        q->head = q->tail = 0;
+        q->queued = q->sent = 0;
+    }
+    if (!bn_data)
+        bn_data = vosSemCreate(0);
+    SYSLOCK();
+    q->chunk = chunk;
+    q->used = 1;
+    SYSUNLOCK();
+    *res = PSMALLINT_NEW(i);
+    return ERR_OK;
+}
+
+/*
+ * returns True if the driver drains the queues itself
+ */
+C_NATIVE(__blenotify_native) {
+    NATIVE_UNWARN();
+    *res = ble_notify_kick ? PBOOL_TRUE() : PBOOL_FALSE();
+    return ERR_OK;
+}
+
+/*
+ * args: q, data, timeout
+ * appends the bytes of data to queue q, waiting at most timeout milliseconds (forever if negative) for room.
+ * Returns the number of bytes appended
+ */
+C_NATIVE(__blenotify_write) {
+    NATIVE_UNWARN();
+    BleNotifyQueue *q = (nargs == 3) ? bn_queue(args[0]) : NULL;
+    int32_t timeout, len, n = 0;
+    uint32_t since = (uint32_t)vosMillis(), k, pos, c;
+    int empty;
+    uint8_t *data;
+
+    if (!q || !IS_PSMALLINT(args[2]))
+        return ERR_TYPE_EXC;
+    if (PTYPE(args[1]) != PBYTES && PTYPE(args[1]) != PBYTEARRAY)
+        return ERR_TYPE_EXC;
+    timeout = PSMALLINT_VALUE(args[2]);
+    len = PSEQUENCE_ELEMENTS(args[1]);
+
+    while (n < len) {
+        data = PSEQUENCE_BYTES(args[1]) + n;
+        SYSLOCK();
+        k = BLENOTIFY_RING - (q->tail - q->head);
+        if (k > (uint32_t)(len - n))
+            k = len - n;
+        empty = q->tail == q->head;
+        if (k) {
+            pos = q->tail & (BLENOTIFY_RING - 1);
+            c = BLENOTIFY_RING - pos;
+            if (c > k)
+                c = k;
+            memcpy(q->ring + pos, data, c);
+            memcpy(q->ring, data + c, k - c);
+            q->tail += k;
+            q->queued += k;
+        }
+        SYSUNLOCK();
+        if (k) {
+            n += k;
+            // the consumer sleeps only on empty queues
+            if (empty) {
+                if (ble_notify_kick)
+                    ble_notify_kick();
+                else
+                    vosSemSignalCap(bn_data, 1);
+            }
+            continue;
+        }
+        if (!timeout || bn_wait(q->space, timeout, since) != VRES_OK)
+            break;
+    }
+    *res = PSMALLINT_NEW(n);
+    return ERR_OK;
+}
+
+/*
+ * args: q, timeout
+ * waits at most timeout milliseconds (forever if negative) for queue q to be sent. Returns True if it is empty
+ */
+C_NATIVE(__blenotify_flush) {
+    NATIVE_UNWARN();
+    BleNotifyQueue *q = (nargs == 2) ? bn_queue(args[0]) : NULL;
+    int32_t timeout;
+    uint32_t since = (uint32_t)vosMillis();
+
+    if (!q || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    timeout = PSMALLINT_VALUE(args[1]);
+    while (q->head != q->tail) {
+        if (!timeout || bn_wait(q->space, timeout, since) != VRES_OK)
+            break;
+    }
+    *res = (q->head == q->tail) ? PBOOL_TRUE() : PBOOL_FALSE();
+    return ERR_OK;
+}
+
+/*
+ * args: q
+ * discards the bytes not sent yet, e.g. after a disconnection. Returns how many
+ */
+C_NATIVE(__blenotify_clear) {
+    NATIVE_UNWARN();
+    BleNotifyQueue *q = (nargs == 1) ? bn_queue(args[0]) : NULL;
+    uint32_t n;
+
+    if (!q)
+        return ERR_TYPE_EXC;
+    SYSLOCK();
+    n = q->tail - q->head;
+    q->head = q->tail;
+    SYSUNLOCK();
+    vosSemSignalCap(q->space, 1);
+    *res = PSMALLINT_NEW(n);
+    return ERR_OK;
+}
+
+/*
+ * args: buffer, timeout
+ * the Python drainer: moves the next notification into the bytearray buffer, waiting at most timeout milliseconds
+ * (forever if negative) for one. Returns (service, uuid, length), None on timeout
+ */
+C_NATIVE(__blenotify_pull) {
+    NATIVE_UNWARN();
+    int32_t timeout, n;
+    uint32_t since = (uint32_t)vosMillis();
+    uint16_t service, uuid;
+    PTuple *tpl;
+
+    if (nargs != 2 || PTYPE(args[0]) != PBYTEARRAY || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    if (!PSEQUENCE_ELEMENTS(args[0]))
+        return ERR_VALUE_EXC;
+    timeout = PSMALLINT_VALUE(args[1]);
+    if (!bn_data)
+        bn_data = vosSemCreate(0);
+    *res = MAKE_NONE();
+    while (!(n = ble_notify_next(&service, &uuid, PSEQUENCE_BYTES(args[0]), PSEQUENCE_ELEMENTS(args[0])))) {
+        if (!timeout || bn_wait(bn_data, timeout, since) != VRES_OK)
+            return ERR_OK;
+    }
+    tpl = ptuple_new(3, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(service));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(uuid));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(n));
+    *res = (PObject*)tpl;
+    return ERR_OK;
+}
+
+/*
+ * args: q
+ * returns (queued, sent, pending): bytes appended, notifications sent and bytes still in queue q
+ */
+C_NATIVE(__blenotify_stats) {
+    NATIVE_UNWARN();
+    BleNotifyQueue *q = (nargs == 1) ? bn_queue(args[0]) : NULL;
+    PTuple *tpl;
+
+    if (!q)
+        return ERR_TYPE_EXC;
+    tpl = ptuple_new(3, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, pinteger_new(q->queued));
+    PTUPLE_SET_ITEM(tpl, 1, pinteger_new(q->sent));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(q->tail - q->head));
+    *res = (PObject*)tpl;
+    return ERR_OK;
+}
@@ -0,0 +1,29 @@
+#ifndef ZERYNTH_BLENOTIFY_H_
+#define ZERYNTH_BLENOTIFY_H_
+
+#include <stdint.h>
+
+/*
+ * Native notification queues, for Characteristic.stream.
+ *
+ * Python appends bytes to the queue of a characteristic and returns; the driver takes them out as notifications, from its
+ * own thread, as fast as the link accepts them. Drivers supporting it set ble_notify_kick at init: it is called when bytes
+ * enter an empty queue, with the GIL held, and must only wake the driver thread. The driver thread then calls ble_notify_next
+ * while the stack has transmit buffers free (ideally several per connection event) and again on each transmit complete event,
+ * until it returns 0.
+ *
+ * Without ble_notify_kick, the ble module drains the queues from a Python thread, one set_value per notification.
+ */
+
+#define BLENOTIFY_QUEUES    2
+
+extern void (*ble_notify_kick)(void);
+
+/*
+ * Moves the next notification, at most max bytes (the negotiated MTU minus 3), into buf, and returns its length.
+ * service and uuid are set to the ones of its characteristic. Returns 0 if all queues are empty.
+ * Queues are served round robin, one notification each.
+ */
+int ble_notify_next(uint16_t *service, uint16_t *uuid, uint8_t *buf, int max);
+
+#endif
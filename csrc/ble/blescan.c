@@ -0,0 +1,364 @@
+#include "zerynth.h"
+#include "blescan.h"
+
+/*
+ * Filter, deduplication and ring of the native scan report path (see blescan.h).
+ *
+ * A report passes if its rssi reaches the threshold and, when address, UUID or manufacturer lists are set,
+ * it matches any of them. A report equal to one passed from the same address within the dedup window is dropped;
+ * reports whose data changed pass. The ring is written under the system lock by the drivers (or by __blescan_feed
+ * for drivers calling Python) and read by __blescan_read only, whole records at a time.
+ */
+
+#ifndef BLESCAN_RING
+#define BLESCAN_RING    2048    // power of 2
+#endif
+#define BLESCAN_ADDRS   8
+#define BLESCAN_UUIDS   8
+#define BLESCAN_MFRS    8
+#define BLESCAN_DEDUP   32
+
+typedef struct _blescan_uuid {
+    uint8_t len;                // 2 or 16
+    uint8_t uuid[16];           // little endian, as in the packets
+} BleScanUuid;
+
+typedef struct _blescan_seen {
+    uint32_t addr;
+    uint32_t data;
+    uint32_t at;
+} BleScanSeen;
+
+volatile uint8_t ble_scan_batching;
+
+static int8_t bs_rssi = -128;
+static uint8_t bs_addrs[BLESCAN_ADDRS][6];
+static uint8_t bs_naddrs;
+static BleScanUuid bs_uuids[BLESCAN_UUIDS];
+static uint8_t bs_nuuids;
+static uint16_t bs_mfrs[BLESCAN_MFRS];
+static uint8_t bs_nmfrs;
+static uint32_t bs_dedup_ms;
+static BleScanSeen bs_seen[BLESCAN_DEDUP];
+
+static uint8_t bs_ring[BLESCAN_RING];
+static volatile uint32_t bs_head, bs_tail;
+static VSemaphore bs_sem;
+static uint32_t bs_stats[4];    // seen, passed, duplicates, dropped
+
+static uint32_t bs_hash(uint32_t h, const uint8_t *p, uint32_t len)
+{
+    while (len--)
+        h = (h ^ *p++) * 16777619u;
+    return h;
+}
+
+static int bs_match_uuid(const uint8_t *data, uint32_t len)
+{
+    uint32_t pos = 0, n, t, w, i, j;
+    const uint8_t *f;
+
+    // walks the AD structures: length, type, payload
+    while (pos + 1 < len) {
+        n = data[pos];
+        if (!n || pos + 1 + n > len)
+            break;
+        t = data[pos + 1];
+        f = data + pos + 2;
+        n--;
+        w = 0;
+        if (t == 0x02 || t == 0x03)
+            w = 2;                  // lists of 16 bits UUIDs
+        else if (t == 0x06 || t == 0x07)
+            w = 16;                 // lists of 128 bits UUIDs
+        else if (t == 0x16 && n >= 2)
+            n = w = 2;              // service data, 16 bits UUID first
+        else if (t == 0x21 && n >= 16)
+            n = w = 16;             // service data, 128 bits UUID first
+        for (i = 0; w && i + w <= n; i += w) {
+            for (j = 0; j < bs_nuuids; j++) {
+                if (bs_uuids[j].len == w && !memcmp(bs_uuids[j].uuid, f + i, w))
+                    return 1;
+            }
+        }
+        pos += 1 + data[pos];
+    }
+    return 0;
+}
+
+static int bs_match_mfr(const uint8_t *data, uint32_t len)
+{
+    uint32_t pos = 0, n, i;
+    uint16_t id;
+
+    while (pos + 1 < len) {
+        n = data[pos];
+        if (!n || pos + 1 + n > len)
+            break;
+        if (data[pos + 1] == 0xff && n >= 3) {
+            id = data[pos + 2] | (data[pos + 3] << 8);
+            for (i = 0; i < bs_nmfrs; i++) {
+                if (bs_mfrs[i] == id)
+                    return 1;
+            }
+        }
+        pos += 1 + n;
+    }
+    return 0;
+}
+
+static int bs_match(const uint8_t *addr, const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+
+    if (!bs_naddrs && !bs_nuuids && !bs_nmfrs)
+        return 1;
+    for (i = 0; i < bs_naddrs; i++) {
+        if (!memcmp(bs_addrs[i], addr, 6))
+            return 1;
+    }
+    return (bs_nuuids && bs_match_uuid(data, len)) || (bs_nmfrs && bs_match_mfr(data, len));
+}
+
+// 1 if the same data came from addr within the window, else remembers it replacing the oldest entry
+static int bs_duplicate(uint8_t type, const uint8_t *addr, const uint8_t *data, uint32_t len)
+{
+    uint32_t ha = bs_hash(2166136261u ^ type, addr, 6), hd = bs_hash(2166136261u, data, len);
+    uint32_t now = (uint32_t)vosMillis();
+    int i, old = 0;
+
+    for (i = 0; i < BLESCAN_DEDUP; i++) {
+        if (bs_seen[i].addr == ha && bs_seen[i].at) {
+            if (bs_seen[i].data == hd && now - bs_seen[i].at < bs_dedup_ms)
+                return 1;
+            old = i;
+            break;
+        }
+        if (bs_seen[i].at < bs_seen[old].at || !bs_seen[i].at)
+            old = i;
+    }
+    bs_seen[old].addr = ha;
+    bs_seen[old].data = hd;
+    bs_seen[old].at = now ? now : 1;
+    return 0;
+}
+
+static void bs_put(const uint8_t *p, uint32_t len)
+{
+    uint32_t pos = bs_tail & (BLESCAN_RING - 1), n = BLESCAN_RING - pos;
+
+    if (n > len)
+        n = len;
+    memcpy(bs_ring + pos, p, n);
+    memcpy(bs_ring, p + n, len - n);
+    bs_tail += len;
+}
+
+int ble_scan_report(uint8_t type, uint8_t addr_type, int8_t rssi, const uint8_t *addr, const uint8_t *data, uint32_t len)
+{
+    uint8_t hdr[10];
+    int empty, r = 0;
+
+    if (len > BLESCAN_DATA_MAX)
+        len = BLESCAN_DATA_MAX;
+    hdr[0] = 10 + len;
+    hdr[1] = type;
+    hdr[2] = addr_type;
+    hdr[3] = (uint8_t)rssi;
+    memcpy(hdr + 4, addr, 6);
+
+    SYSLOCK();
+    bs_stats[0]++;
+    if (rssi < bs_rssi || !bs_match(addr, data, len))
+        goto out;
+    if (bs_dedup_ms && bs_duplicate(type, addr, data, len)) {
+        bs_stats[2]++;
+        goto out;
+    }
+    if (bs_tail - bs_head + hdr[0] > BLESCAN_RING) {
+        bs_stats[3]++;
+        goto out;
+    }
+    empty = bs_tail == bs_head;
+    bs_put(hdr, 10);
+    bs_put(data, len);
+    bs_stats[1]++;
+    r = 1;
+    // the reader waits only on an empty ring
+    if (empty && bs_sem)
+        vosSemSignal(bs_sem);
+out:
+    SYSUNLOCK();
+    return r;
+}
+
+static int bs_seq_item(PObject *seq, int i, PObject **o)
+{
+    if (PTYPE(seq) == PLIST)
+        *o = PLIST_ITEM(seq, i);
+    else if (PTYPE(seq) == PTUPLE)
+        *o = PTUPLE_ITEM(seq, i);
+    else
+        return 0;
+    return 1;
+}
+
+#define IS_BYTES_OBJ(o) (PTYPE(o) == PBYTES || PTYPE(o) == PBYTEARRAY)
+
+/*
+ * args: rssi, addrs, uuids, mfrs, dedup_ms, enable
+ * sets the filter and empties the ring. addrs are 6 bytes each, uuids integers (16 bits) or 16 bytes (big endian, as written),
+ * mfrs integers. Native batching is on while enable is true
+ */
+C_NATIVE(__blescan_config) {
+    NATIVE_UNWARN();
+    int32_t rssi, dedup, naddrs, nuuids, nmfrs, i, j;
+    PObject *o;
+    uint8_t addrs[BLESCAN_ADDRS][6];
+    BleScanUuid uuids[BLESCAN_UUIDS];
+    uint16_t mfrs[BLESCAN_MFRS];
+
+    if (nargs != 6 || !IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    rssi = PSMALLINT_VALUE(args[0]);
+    dedup = PSMALLINT_VALUE(args[4]);
+    naddrs = PSEQUENCE_ELEMENTS(args[1]);
+    nuuids = PSEQUENCE_ELEMENTS(args[2]);
+    nmfrs = PSEQUENCE_ELEMENTS(args[3]);
+    if (naddrs > BLESCAN_ADDRS || nuuids > BLESCAN_UUIDS || nmfrs > BLESCAN_MFRS || dedup < 0 || rssi < -128 || rssi > 127)
+        return ERR_VALUE_EXC;
+    for (i = 0; i < naddrs; i++) {
+        if (!bs_seq_item(args[1], i, &o))
+            return ERR_TYPE_EXC;
+        if (!IS_BYTES_OBJ(o) || PSEQUENCE_ELEMENTS(o) != 6)
+            return ERR_VALUE_EXC;
+        memcpy(addrs[i], PSEQUENCE_BYTES(o), 6);
+    }
+    for (i = 0; i < nuuids; i++) {
+        if (!bs_seq_item(args[2], i, &o))
+            return ERR_TYPE_EXC;
+        if (IS_PSMALLINT(o)) {
+            uuids[i].len = 2;
+            uuids[i].uuid[0] = PSMALLINT_VALUE(o) & 0xff;
+            uuids[i].uuid[1] = (PSMALLINT_VALUE(o) >> 8) & 0xff;
+        } else if (IS_BYTES_OBJ(o) && PSEQUENCE_ELEMENTS(o) == 16) {
+            uuids[i].len = 16;
+            for (j = 0; j < 16; j++)
+                uuids[i].uuid[j] = PSEQUENCE_BYTES(o)[15 - j];
+        } else {
+            return ERR_VALUE_EXC;
+        }
+    }
+    for (i = 0; i < nmfrs; i++) {
+        if (!bs_seq_item(args[3], i, &o))
+            return ERR_TYPE_EXC;
+        if (!IS_PSMALLINT(o))
+            return ERR_TYPE_EXC;
+        mfrs[i] = PSMALLINT_VALUE(o);
+    }
+    if (!bs_sem)
+        bs_sem = vosSemCreate(0);
+
+    SYSLOCK();
+    bs_rssi = rssi;
+    bs_dedup_ms = dedup;
+    bs_naddrs = naddrs;
+    bs_nuuids = nuuids;
+    bs_nmfrs = nmfrs;
+    memcpy(bs_addrs, addrs, sizeof(addrs));
+    memcpy(bs_uuids, uuids, sizeof(uuids));
+    memcpy(bs_mfrs, mfrs, sizeof(mfrs));
+    memset(bs_seen, 0, sizeof(bs_seen));
+    memset(bs_stats, 0, sizeof(bs_stats));
+    bs_head = bs_tail;
+    ble_scan_batching = (args[5] == PBOOL_TRUE());
+    SYSUNLOCK();
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: type, addr_type, rssi, packet, addr
+ * the report of a driver calling Python: queued as by ble_scan_report. Returns True if queued
+ */
+C_NATIVE(__blescan_feed) {
+    NATIVE_UNWARN();
+
+    if (nargs != 5 || !IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[1]) || !IS_PSMALLINT(args[2]) ||
+        !IS_BYTES_OBJ(args[3]) || !IS_BYTES_OBJ(args[4]) || PSEQUENCE_ELEMENTS(args[4]) < 6)
+        return ERR_TYPE_EXC;
+    *res = ble_scan_report(PSMALLINT_VALUE(args[0]), PSMALLINT_VALUE(args[1]), PSMALLINT_VALUE(args[2]), PSEQUENCE_BYTES(args[4]),
+                           PSEQUENCE_BYTES(args[3]), PSEQUENCE_ELEMENTS(args[3])) ? PBOOL_TRUE() : PBOOL_FALSE();
+    return ERR_OK;
+}
+
+/*
+ * args: buffer, timeout
+ * moves the queued reports that fit in the bytearray buffer into it, waiting at most timeout milliseconds (forever if negative)
+ * for the first one. Returns the number of bytes moved, 0 on timeout
+ */
+C_NATIVE(__blescan_read) {
+    NATIVE_UNWARN();
+    int32_t timeout, size, n = 0, pos, k, r;
+    uint32_t head;
+    uint8_t *buf;
+
+    if (nargs != 2 || PTYPE(args[0]) != PBYTEARRAY || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    timeout = PSMALLINT_VALUE(args[1]);
+    size = PSEQUENCE_ELEMENTS(args[0]);
+    buf = PSEQUENCE_BYTES(args[0]);
+    if (size < BLESCAN_RECORD_MAX)
+        return ERR_VALUE_EXC;
+    if (!bs_sem)
+        bs_sem = vosSemCreate(0);
+
+    while (bs_head == bs_tail) {
+        if (!timeout) {
+            *res = PSMALLINT_NEW(0);
+            return ERR_OK;
+        }
+        RELEASE_GIL();
+        r = vosSemWaitTimeout(bs_sem, (timeout < 0) ? VTIME_INFINITE : TIME_U(timeout, MILLIS));
+        ACQUIRE_GIL();
+        if (r != VRES_OK) {
+            *res = PSMALLINT_NEW(0);
+            return ERR_OK;
+        }
+    }
+
+    // only this reader moves head: records up to tail are complete
+    SYSLOCK();
+    head = bs_head;
+    while (head != bs_tail) {
+        k = bs_ring[head & (BLESCAN_RING - 1)];
+        if (n + k > size)
+            break;
+        pos = head & (BLESCAN_RING - 1);
+        r = BLESCAN_RING - pos;
+        if (r > k)
+            r = k;
+        memcpy(buf + n, bs_ring + pos, r);
+        memcpy(buf + n + r, bs_ring, k - r);
+        head += k;
+        n += k;
+    }
+    bs_head = head;
+    SYSUNLOCK();
+    *res = PSMALLINT_NEW(n);
+    return ERR_OK;
+}
+
+/*
+ * returns (seen, passed, duplicates, dropped): reports received, queued, dropped as duplicates and dropped with the ring full
+ */
+C_NATIVE(__blescan_stats) {
+    NATIVE_UNWARN();
+    PTuple *tpl = ptuple_new(4, NULL);
+    int i;
+
+    for (i = 0; i < 4; i++)
+        PTUPLE_SET_ITEM(tpl, i, pinteger_new(bs_stats[i]));
+    *res = (PObject*)tpl;
+    return ERR_OK;
+}
@@ -0,0 +1,23 @@
+#ifndef ZERYNTH_BLESCAN_H_
+#define ZERYNTH_BLESCAN_H_
+
+#include <stdint.h>
+
+/*
+ * Native path of BLE scan reports, for ble.scan_filter.
+ *
+ * While ble_scan_batching is set, drivers pass each advertising report to ble_scan_report from their C event handler,
+ * instead of building the EVT_SCAN_REPORT tuple and calling Python. Reports are filtered, deduplicated and packed in a ring,
+ * read in batches by ble.scan_read. Packed reports are:
+ *     size (10 + data length), type, address type, rssi (signed), address (6 bytes, as received), data
+ */
+
+#define BLESCAN_DATA_MAX    31
+#define BLESCAN_RECORD_MAX  (10 + BLESCAN_DATA_MAX)
+
+extern volatile uint8_t ble_scan_batching;
+
+// returns 1 if the report was queued, 0 if it was filtered out or the ring is full
+int ble_scan_report(uint8_t type, uint8_t addr_type, int8_t rssi, const uint8_t *addr, const uint8_t *data, uint32_t len);
+
+#endif
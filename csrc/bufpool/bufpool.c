@@ -0,0 +1,30 @@
+#include "zerynth.h"
+
+/*
+ * args: buf
+ * returns the capacity of the bytearray buf: the bytes it holds when its length is set back to the maximum
+ */
+C_NATIVE(_bufpool_capacity)
+{
+    C_NATIVE_UNWARN();
+
+    if (nargs != 1 || PTYPE(args[0]) != PBYTEARRAY)
+        return ERR_TYPE_EXC;
+    *res = PSMALLINT_NEW(PSEQUENCE_SIZE(args[0]));
+    return ERR_OK;
+}
+
+/*
+ * args: buf
+ * sets the length of the bytearray buf to its capacity, and returns it
+ */
+C_NATIVE(_bufpool_restore)
+{
+    C_NATIVE_UNWARN();
+
+    if (nargs != 1 || PTYPE(args[0]) != PBYTEARRAY)
+        return ERR_TYPE_EXC;
+    PSEQUENCE_ELEMENTS_SET(args[0], PSEQUENCE_SIZE(args[0]));
+    *res = PSMALLINT_NEW(PSEQUENCE_ELEMENTS(args[0]));
+    return ERR_OK;
+}
@@ -0,0 +1,341 @@
+#include "zerynth.h"
+
+/*
+ * Signal decoder of the candbc module.
+ *
+ * A database is compiled once into a layout, a bytes object: a DbcHeader, the DbcMessage table in definition order,
+ * the indexes of the messages sorted by id (for the binary search of each frame) and the DbcSignal table. The signals
+ * of a message are consecutive, and signal k of the database is decoded in the k-th 4 bytes slot of the values
+ * bytearray, as a native order float or, for raw signals, int32: a decode allocates nothing.
+ *
+ * The data of a frame is read as a 64 bits integer, little endian for Intel signals and big endian for Motorola ones,
+ * so that every signal is a shift and a mask of it, precomputed at compile time.
+ */
+
+#define DBC_EXT_FLAG    0x80000000
+#define DBC_RTR_FLAG    0x40000000
+#define DBC_EXT_MASK    0x1FFFFFFF
+#define DBC_STD_MASK    0x7FF
+
+// signal flags
+#define DBC_BIG_ENDIAN  1
+#define DBC_SIGNED      2
+#define DBC_RAW         4
+
+#define DBC_RECORD_SIZE 20
+// batches of at least this many frames are decoded with the GIL released
+#define DBC_GIL_FRAMES  16
+
+typedef struct _dbc_header {
+    uint16_t nmsgs;
+    uint16_t nsigs;
+} DbcHeader;
+
+typedef struct _dbc_message {
+    uint32_t id;        // 11 or 29 bits, with DBC_EXT_FLAG for extended frames
+    uint16_t first;     // first signal, and value slot, of the message
+    uint16_t count;
+} DbcMessage;
+
+typedef struct _dbc_signal {
+    uint8_t shift;      // position of the lsb in the data read as a 64 bits integer
+    uint8_t length;
+    uint8_t flags;
+    uint8_t need;       // data bytes the signal spans: shorter frames leave its value untouched
+    float scale;
+    float offset;
+} DbcSignal;
+
+#define DBC_ORDER_SIZE(n) (((n) * 2 + 3) & ~3)
+
+static inline DbcMessage *dbc_messages(uint8_t *layout)
+{
+    return (DbcMessage*)(layout + sizeof(DbcHeader));
+}
+
+static inline uint16_t *dbc_order(uint8_t *layout)
+{
+    return (uint16_t*)(dbc_messages(layout) + ((DbcHeader*)layout)->nmsgs);
+}
+
+static inline DbcSignal *dbc_signals(uint8_t *layout)
+{
+    return (DbcSignal*)((uint8_t*)dbc_order(layout) + DBC_ORDER_SIZE(((DbcHeader*)layout)->nmsgs));
+}
+
+static DbcHeader *dbc_layout_of(PObject *o)
+{
+    DbcHeader *h;
+
+    if (PTYPE(o) != PBYTES || PSEQUENCE_ELEMENTS(o) < sizeof(DbcHeader))
+        return NULL;
+    h = (DbcHeader*)PSEQUENCE_BYTES(o);
+    if (PSEQUENCE_ELEMENTS(o) != sizeof(DbcHeader) + h->nmsgs * sizeof(DbcMessage) + DBC_ORDER_SIZE(h->nmsgs) + h->nsigs * sizeof(DbcSignal))
+        return NULL;
+    return h;
+}
+
+static int dbc_int(PObject *o, int32_t *v)
+{
+    if (!IS_INTEGER(o))
+        return -1;
+    *v = (int32_t)INTEGER_VALUE(o);
+    return 0;
+}
+
+static int dbc_num(PObject *o, float *v)
+{
+    if (PTYPE(o) == PFLOAT)
+        *v = FLOAT_VALUE(o);
+    else if (IS_INTEGER(o))
+        *v = (float)INTEGER_VALUE(o);
+    else
+        return -1;
+    return 0;
+}
+
+// the key of a frame id, or -1 for remote frames
+static inline int64_t dbc_key(uint32_t id)
+{
+    if (id & DBC_RTR_FLAG)
+        return -1;
+    return (id & DBC_EXT_FLAG) ? (id & (DBC_EXT_FLAG | DBC_EXT_MASK)) : (id & DBC_STD_MASK);
+}
+
+static int32_t dbc_find(uint8_t *layout, uint32_t key)
+{
+    DbcMessage *msgs = dbc_messages(layout);
+    uint16_t *order = dbc_order(layout);
+    int32_t lo = 0, hi = ((DbcHeader*)layout)->nmsgs - 1, mid;
+
+    while (lo <= hi) {
+        mid = (lo + hi) / 2;
+        if (msgs[order[mid]].id == key)
+            return order[mid];
+        if (msgs[order[mid]].id < key)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return -1;
+}
+
+static void dbc_decode_frame(uint8_t *layout, DbcMessage *m, const uint8_t *data, int32_t dlc, uint8_t *values)
+{
+    DbcSignal *s = dbc_signals(layout) + m->first;
+    uint64_t le = 0, be = 0, raw, mask;
+    int32_t i, iv;
+    float fv;
+
+    if (dlc > 8)
+        dlc = 8;
+    for (i = 0; i < dlc; i++) {
+        le |= (uint64_t)data[i] << (8 * i);
+        be |= (uint64_t)data[i] << (56 - 8 * i);
+    }
+    for (i = 0; i < m->count; i++, s++) {
+        if (s->need > dlc)
+            continue;
+        raw = ((s->flags & DBC_BIG_ENDIAN) ? be : le) >> s->shift;
+        if (s->length < 64) {
+            mask = ((uint64_t)1 << s->length) - 1;
+            raw &= mask;
+            if ((s->flags & DBC_SIGNED) && (raw >> (s->length - 1)))
+                raw |= ~mask;
+        }
+        if (s->flags & DBC_RAW) {
+            iv = (int32_t)raw;
+            memcpy(values + 4 * (m->first + i), &iv, 4);
+        } else {
+            if (s->flags & DBC_SIGNED)
+                fv = (float)(int64_t)raw * s->scale + s->offset;
+            else
+                fv = (float)raw * s->scale + s->offset;
+            memcpy(values + 4 * (m->first + i), &fv, 4);
+        }
+    }
+}
+
+/*
+ * args: a list of (id, signals) tuples, signals being a list of (start, length, flags, scale, offset) tuples,
+ * with start and length as in DBC files
+ * returns the layout
+ */
+C_NATIVE(__dbc_compile) {
+    NATIVE_UNWARN();
+    PObject *msgs, *msg, *sigs, *sig;
+    int32_t nmsgs, nsigs, i, j, k, id, start, length, flags, pos;
+    uint32_t size;
+    PBytes *bres;
+    uint8_t *layout;
+    DbcHeader *h;
+    DbcMessage *m;
+    DbcSignal *s;
+    uint16_t *order;
+
+    if (nargs != 1 || PTYPE(args[0]) != PLIST)
+        return ERR_TYPE_EXC;
+    msgs = args[0];
+    nmsgs = PSEQUENCE_ELEMENTS(msgs);
+    nsigs = 0;
+    for (i = 0; i < nmsgs; i++) {
+        msg = PLIST_ITEM(msgs, i);
+        if (PTYPE(msg) != PTUPLE || PSEQUENCE_ELEMENTS(msg) != 2 || PTYPE(PTUPLE_ITEM(msg, 1)) != PLIST)
+            return ERR_TYPE_EXC;
+        nsigs += PSEQUENCE_ELEMENTS(PTUPLE_ITEM(msg, 1));
+    }
+    size = sizeof(DbcHeader) + nmsgs * sizeof(DbcMessage) + DBC_ORDER_SIZE(nmsgs) + nsigs * sizeof(DbcSignal);
+    if (size > 0xffff || nsigs > 0xffff / 4)
+        return ERR_VALUE_EXC;
+
+    bres = pbytes_new(size, NULL);
+    layout = PSEQUENCE_BYTES(bres);
+    memset(layout, 0, size);
+    h = (DbcHeader*)layout;
+    h->nmsgs = nmsgs;
+    h->nsigs = nsigs;
+    order = dbc_order(layout);
+    s = dbc_signals(layout);
+    for (i = 0, k = 0; i < nmsgs; i++) {
+        msg = PLIST_ITEM(msgs, i);
+        sigs = PTUPLE_ITEM(msg, 1);
+        m = dbc_messages(layout) + i;
+        if (dbc_int(PTUPLE_ITEM(msg, 0), &id))
+            return ERR_TYPE_EXC;
+        if (dbc_key(id) != (int64_t)(uint32_t)id)
+            return ERR_VALUE_EXC;
+        m->id = id;
+        m->first = k;
+        m->count = PSEQUENCE_ELEMENTS(sigs);
+        for (j = 0; j < m->count; j++, k++, s++) {
+            sig = PLIST_ITEM(sigs, j);
+            if (PTYPE(sig) != PTUPLE || PSEQUENCE_ELEMENTS(sig) != 5 ||
+                dbc_int(PTUPLE_ITEM(sig, 0), &start) || dbc_int(PTUPLE_ITEM(sig, 1), &length) ||
+                dbc_int(PTUPLE_ITEM(sig, 2), &flags) || dbc_num(PTUPLE_ITEM(sig, 3), &s->scale) ||
+                dbc_num(PTUPLE_ITEM(sig, 4), &s->offset))
+                return ERR_TYPE_EXC;
+            if (start < 0 || start > 63 || length < 1 || length > 64 || (flags & ~(DBC_BIG_ENDIAN | DBC_SIGNED | DBC_RAW)) ||
+                ((flags & DBC_RAW) && length > 32))
+                return ERR_VALUE_EXC;
+            if (flags & DBC_BIG_ENDIAN) {
+                // start is the msb, numbered from the lsb of byte 0 up to the msb of byte 7
+                pos = (7 - start / 8) * 8 + start % 8 - length + 1;
+                if (pos < 0)
+                    return ERR_VALUE_EXC;
+                s->need = 8 - pos / 8;
+            } else {
+                pos = start;
+                if (pos + length > 64)
+                    return ERR_VALUE_EXC;
+                s->need = (pos + length - 1) / 8 + 1;
+            }
+            s->shift = pos;
+            s->length = length;
+            s->flags = flags;
+        }
+        // insertion sort of the ids, rejecting duplicates
+        for (j = i; j > 0 && dbc_messages(layout)[order[j - 1]].id > m->id; j--)
+            order[j] = order[j - 1];
+        if (j > 0 && dbc_messages(layout)[order[j - 1]].id == m->id)
+            return ERR_VALUE_EXC;
+        order[j] = i;
+    }
+    *res = bres;
+    return ERR_OK;
+}
+
+/*
+ * args: layout, id, dlc, data, values
+ * decodes a frame, returns the index of its message or -1 if the layout doesn't have it
+ */
+C_NATIVE(__dbc_decode) {
+    NATIVE_UNWARN();
+    DbcHeader *h;
+    int32_t id, dlc, msg;
+    int64_t key;
+
+    if (nargs != 5 || !(h = dbc_layout_of(args[0])) || dbc_int(args[1], &id) || dbc_int(args[2], &dlc) ||
+        !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[3])) || PTYPE(args[4]) != PBYTEARRAY)
+        return ERR_TYPE_EXC;
+    if (PSEQUENCE_ELEMENTS(args[4]) < 4 * h->nsigs)
+        return ERR_VALUE_EXC;
+    if (dlc > PSEQUENCE_ELEMENTS(args[3]))
+        dlc = PSEQUENCE_ELEMENTS(args[3]);
+    key = dbc_key(id);
+    msg = (key < 0) ? -1 : dbc_find((uint8_t*)h, key);
+    if (msg >= 0)
+        dbc_decode_frame((uint8_t*)h, dbc_messages((uint8_t*)h) + msg, PSEQUENCE_BYTES(args[3]), dlc, PSEQUENCE_BYTES(args[4]));
+    *res = PSMALLINT_NEW(msg);
+    return ERR_OK;
+}
+
+/*
+ * args: layout, buffer, nframes, values, stamps
+ * decodes the first nframes records of an rx_batch buffer; stamps is None or a bytearray receiving the timestamp
+ * of the last frame of each message. Returns the number of frames of messages in the layout
+ */
+C_NATIVE(__dbc_decode_batch) {
+    NATIVE_UNWARN();
+    DbcHeader *h;
+    int32_t nframes, i, msg, done = 0;
+    int64_t key;
+    uint32_t id, ts;
+    uint8_t *rec, *values, *stamps = NULL;
+
+    if (nargs != 5 || !(h = dbc_layout_of(args[0])) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1])) || dbc_int(args[2], &nframes) ||
+        PTYPE(args[3]) != PBYTEARRAY || (args[4] != MAKE_NONE() && PTYPE(args[4]) != PBYTEARRAY))
+        return ERR_TYPE_EXC;
+    if (nframes < 0 || nframes > PSEQUENCE_ELEMENTS(args[1]) / DBC_RECORD_SIZE)
+        nframes = PSEQUENCE_ELEMENTS(args[1]) / DBC_RECORD_SIZE;
+    if (PSEQUENCE_ELEMENTS(args[3]) < 4 * h->nsigs)
+        return ERR_VALUE_EXC;
+    if (args[4] != MAKE_NONE()) {
+        if (PSEQUENCE_ELEMENTS(args[4]) < 4 * h->nmsgs)
+            return ERR_VALUE_EXC;
+        stamps = PSEQUENCE_BYTES(args[4]);
+    }
+    values = PSEQUENCE_BYTES(args[3]);
+
+    if (nframes >= DBC_GIL_FRAMES)
+        RELEASE_GIL();
+    for (i = 0, rec = PSEQUENCE_BYTES(args[1]); i < nframes; i++, rec += DBC_RECORD_SIZE) {
+        id = rec[0] | (rec[1] << 8) | (rec[2] << 16) | ((uint32_t)rec[3] << 24);
+        key = dbc_key(id);
+        if (key < 0 || (msg = dbc_find((uint8_t*)h, key)) < 0)
+            continue;
+        dbc_decode_frame((uint8_t*)h, dbc_messages((uint8_t*)h) + msg, rec + 12, rec[8], values);
+        if (stamps) {
+            ts = rec[4] | (rec[5] << 8) | (rec[6] << 16) | ((uint32_t)rec[7] << 24);
+            memcpy(stamps + 4 * msg, &ts, 4);
+        }
+        done++;
+    }
+    if (nframes >= DBC_GIL_FRAMES)
+        ACQUIRE_GIL();
+    *res = PSMALLINT_NEW(done);
+    return ERR_OK;
+}
+
+/*
+ * args: layout, values, i
+ * returns the value of signal i, a float or an int for raw signals
+ */
+C_NATIVE(__dbc_value) {
+    NATIVE_UNWARN();
+    DbcHeader *h;
+    int32_t i, iv;
+    float fv;
+
+    if (nargs != 3 || !(h = dbc_layout_of(args[0])) || PTYPE(args[1]) != PBYTEARRAY || dbc_int(args[2], &i))
+        return ERR_TYPE_EXC;
+    if (i < 0 || i >= h->nsigs || PSEQUENCE_ELEMENTS(args[1]) < 4 * h->nsigs)
+        return ERR_INDEX_EXC;
+    if (dbc_signals((uint8_t*)h)[i].flags & DBC_RAW) {
+        memcpy(&iv, PSEQUENCE_BYTES(args[1]) + 4 * i, 4);
+        *res = (PObject*)pinteger_new(iv);
+    } else {
+        memcpy(&fv, PSEQUENCE_BYTES(args[1]) + 4 * i, 4);
+        *res = (PObject*)pfloat_new(fv);
+    }
+    return ERR_OK;
+}
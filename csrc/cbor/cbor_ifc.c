@@ -1,7 +1,15 @@
-// #define ZERYNTH_PRINTF 1
 #include "zerynth.h"
 #include "cbor.h"
 
+// logging costs a synchronous console write: it is compiled in only with CBOR_DEBUG
+//#define CBOR_DEBUG 1
+#undef printf
+#if defined(CBOR_DEBUG)
+#define printf(...) vbl_printf_stdout(__VA_ARGS__)
+#else
+#define printf(...)
+#endif
+
 /** Sets the memory management routines to use.
  *
  * Only available when CBOR_CUSTOM_ALLOC is truthy
@@ -17,18 +25,25 @@
  */
 // void cbor_set_allocs(_cbor_malloc_t custom_malloc, _cbor_realloc_t custom_realloc, _cbor_free_t custom_free);
 
+#if defined(CBOR_DEBUG)
+// blocks allocated by libcbor and not yet freed
 int nm=0;
+#define CBOR_COUNT_ALLOC(n) (nm+=(n))
+#else
+#define CBOR_COUNT_ALLOC(n)
+#endif
+
 void *cbor_malloc(size_t n){
-    nm++;
+    CBOR_COUNT_ALLOC(1);
     return gc_malloc(n);
 }
 
 void * cbor_realloc(void *pnt, size_t n){
-    if(!pnt) nm++;
+    if(!pnt) CBOR_COUNT_ALLOC(1);
     return gc_realloc(pnt,n);
 }
 void cbor_free(void *pnt){
-    if(pnt) nm--;
+    if(pnt) CBOR_COUNT_ALLOC(-1);
     return gc_free(pnt);;
 }
 
@@ -65,310 +80,476 @@ C_NATIVE(_cbor_init)
 //     return sz;
 // }
 
-PObject *_cbor_to_py(cbor_item_t *cbo){
-    PObject *o = MAKE_NONE();
-    switch (cbor_typeof(cbo)) {
-        case 0: {
-            //positive integers
-            switch (cbor_int_get_width(cbo)) {
-                case CBOR_INT_8:  o=PSMALLINT_NEW(cbor_get_uint8(cbo)); break;
-                case CBOR_INT_16: o=PSMALLINT_NEW(cbor_get_uint16(cbo)); break;
-                case CBOR_INT_32: o=pinteger_new(cbor_get_uint32(cbo)); break;
-                case CBOR_INT_64: o=pinteger_new(cbor_get_uint64(cbo)); break;
-            }
-        }
-        break;
-        case 1: {
-            //negative integers
-            switch (cbor_int_get_width(cbo)) {
-                case CBOR_INT_8:  o=PSMALLINT_NEW(-(cbor_get_uint8(cbo)+1)); break;
-                case CBOR_INT_16: o=PSMALLINT_NEW(-(cbor_get_uint16(cbo)+1)); break;
-                case CBOR_INT_32: o=pinteger_new(-(cbor_get_uint32(cbo)+1)); break;
-                case CBOR_INT_64: o=pinteger_new(-(cbor_get_uint64(cbo)+1)); break;
-            }
-        }
-        break;
-        case 2: {
-            //byte strings
-            if (cbor_bytestring_is_definite(cbo)){
-                //definite
-                int sz = cbor_bytestring_length(cbo);
-                o = pbytes_new(sz,cbor_bytestring_handle(cbo));
+// nesting of arrays, maps and tags accepted by loads and dumps
+#ifndef CBOR_MAX_DEPTH
+#define CBOR_MAX_DEPTH 32
+#endif
 
-            } else {
-                //indefinite
-                int ns = cbor_bytestring_chunk_count(cbo);
-                int sz = 0;
-                int i;
-                cbor_item_t **strs = cbor_bytestring_chunks_handle(cbo);
-                for(i=0;i<ns;i++){
-                    sz+=cbor_bytestring_length(strs[i]); //TODO: this may not be definite
-                }
-                o = pbytes_new(sz,NULL);
-                uint8_t *buf = PSEQUENCE_BYTES(o);
-                for(i=0;i<ns;i++){
-                    sz=cbor_bytestring_length(strs[i]);
-                    memcpy(buf,cbor_bytestring_handle(strs[i]),sz);
-                    buf+=sz;
-                }
-            }
+// size of the map keys interning table of a loads call (a power of 2)
+#ifndef CBOR_KEYS_SIZE
+#define CBOR_KEYS_SIZE 64
+#endif
 
-        }
-        break;
-        case 3: {
-            //strings
-            if (cbor_string_is_definite(cbo)){
-                //definite
-                int sz = cbor_string_length(cbo);
-                o = pstring_new(sz,cbor_string_handle(cbo));
+// returns the PSTRING for a definite string map key, reusing a previous one
+// with the same bytes if it is still in the keys table (a list of CBOR_KEYS_SIZE slots)
+PObject *_cbor_intern(PObject *keys, uint8_t *str, int len){
+    PObject **slots = PSEQUENCE_OBJECTS(keys);
+    PObject *obj;
+    uint32_t h=2166136261u;
+    int i,p;
 
-            } else {
-                //indefinite
-                int ns = cbor_string_chunk_count(cbo);
-                int sz = 0;
-                int i;
-                cbor_item_t **strs = cbor_string_chunks_handle(cbo);
-                for(i=0;i<ns;i++){
-                    sz+=cbor_string_length(strs[i]);  //this is definite by definition in rfc7049
+    for(i=0;i<len;i++) h=(h^str[i])*16777619u;
+    for(i=0;i<4;i++){
+        p = (h+i)&(CBOR_KEYS_SIZE-1);
+        obj = slots[p];
+        if (obj==MAKE_NONE()) break;
+        if (PSEQUENCE_ELEMENTS(obj)==len && memcmp(PSEQUENCE_BYTES(obj),str,len)==0) return obj;
+    }
+    //table full around h: replace the first slot
+    if (i==4) p = h&(CBOR_KEYS_SIZE-1);
+    obj = pstring_new(len,str);
+    slots[p] = obj;
+    return obj;
+}
+
+// kinds of open containers
+#define CBOR_LEVEL_ARRAY    0
+#define CBOR_LEVEL_MAP      1
+#define CBOR_LEVEL_TAG      2
+#define CBOR_LEVEL_STRING   3   // indefinite string: the container is the list of chunks
+#define CBOR_LEVEL_BYTES    4   // indefinite byte string
+
+// decoder context. Open containers are kept in stack, a list owned by the caller
+// with 4 slots per container: the container, its kind, the number of items
+// still expected (-1 if indefinite) and the pending map key (stack itself if none)
+typedef struct _cbor_stream {
+    PObject *stack;
+    PObject *out;
+    PObject *keys;
+    uint8_t *base;  // if set, definite byte strings are returned as slices of the buffer starting here
+    int err;
+} CborStream;
+
+#define CBOR_LEVEL_SLOTS 4
+#define CBOR_TOP(cs) (PSEQUENCE_OBJECTS((cs)->stack)+PSEQUENCE_ELEMENTS((cs)->stack)-CBOR_LEVEL_SLOTS)
+#define CBOR_KIND(lv) PSMALLINT_VALUE((lv)[1])
+
+// attaches a complete value to the open container, closing the containers it completes;
+// root values go to out
+void _cbor_value(CborStream *cs, PObject *o){
+    PObject **lv;
+    int left;
+
+    while(PSEQUENCE_ELEMENTS(cs->stack)){
+        lv = CBOR_TOP(cs);
+        switch(CBOR_KIND(lv)){
+            case CBOR_LEVEL_ARRAY:
+                plist_append(lv[0],o);
+                break;
+            case CBOR_LEVEL_MAP:
+                if (lv[3]==cs->stack) {
+                    lv[3] = o;
+                } else {
+                    phash_put(lv[0],lv[3],o);
+                    lv[3] = cs->stack;
                 }
-                o = pstring_new(sz,NULL);
-                uint8_t *buf = PSEQUENCE_BYTES(o);
-                for(i=0;i<ns;i++){
-                    sz=cbor_string_length(strs[i]);
-                    memcpy(buf,cbor_string_handle(strs[i]),sz);
-                    buf+=sz;
+                break;
+            case CBOR_LEVEL_TAG:
+                phash_put(((PInstance*)lv[0])->dict, PSMALLINT_NEW(valuename), o);
+                break;
+            default:
+                //chunks of indefinite strings must be definite strings of the same type
+                if (PTYPE(o)!=((CBOR_KIND(lv)==CBOR_LEVEL_STRING) ? PSTRING:PBYTES)) {
+                    cs->err = 1;
+                    return;
                 }
-            }
-
+                plist_append(lv[0],o);
+                break;
         }
-        break;
-        case 4: {
-            //arrays
-            int sz = cbor_array_size(cbo);
-            int i;
-            o = plist_new(sz,NULL);
-            cbor_item_t **items = cbor_array_handle(cbo);
-            for(i=0;i<sz;i++){
-                cbor_item_t *item = items[i];
-                PLIST_SET_ITEM(o,i,_cbor_to_py(item));
-            }
+        left = PSMALLINT_VALUE(lv[2]);
+        if (left<0) return;
+        if (--left) {
+            lv[2] = PSMALLINT_NEW(left);
+            return;
         }
-        break;
-        case 5: {
-            //maps
-            //definite
-            int sz = cbor_map_size(cbo);
-            int i;
-            o = pdict_new(sz);
-            struct cbor_pair* pairs = cbor_map_handle(cbo);
-            for(i=0;i<sz;i++){
-                cbor_item_t *key = pairs[i].key;
-                cbor_item_t *val = pairs[i].value;
-                phash_put(o,_cbor_to_py(key),_cbor_to_py(val));
-            }
+        //the container is complete: it becomes a value of the parent
+        o = lv[0];
+        PSEQUENCE_ELEMENTS_SET(cs->stack,PSEQUENCE_ELEMENTS(cs->stack)-CBOR_LEVEL_SLOTS);
+    }
+    plist_append(cs->out,o);
+}
 
+// opens a container expecting items values (-1 if indefinite)
+void _cbor_open(CborStream *cs, PObject *o, int kind, int items){
+    if (!items) {
+        _cbor_value(cs,o);
+        return;
+    }
+    if (PSEQUENCE_ELEMENTS(cs->stack)>=CBOR_MAX_DEPTH*CBOR_LEVEL_SLOTS) {
+        cs->err = 1;
+        return;
+    }
+    plist_append(cs->stack,o);
+    plist_append(cs->stack,PSMALLINT_NEW(kind));
+    plist_append(cs->stack,PSMALLINT_NEW(items));
+    plist_append(cs->stack,cs->stack);
+}
+
+void _cbor_uint(CborStream *cs, uint64_t v){
+    _cbor_value(cs,(v<0x40000000) ? PSMALLINT_NEW(v):(PObject*)pinteger_new(v));
+}
+void _cbor_negint(CborStream *cs, uint64_t v){
+    _cbor_value(cs,(v<0x40000000) ? PSMALLINT_NEW(-(int64_t)v-1):(PObject*)pinteger_new(-(int64_t)v-1));
+}
+void _cbor_cb_uint8(void *cs, uint8_t v){ _cbor_uint(cs,v); }
+void _cbor_cb_uint16(void *cs, uint16_t v){ _cbor_uint(cs,v); }
+void _cbor_cb_uint32(void *cs, uint32_t v){ _cbor_uint(cs,v); }
+void _cbor_cb_uint64(void *cs, uint64_t v){ _cbor_uint(cs,v); }
+void _cbor_cb_negint8(void *cs, uint8_t v){ _cbor_negint(cs,v); }
+void _cbor_cb_negint16(void *cs, uint16_t v){ _cbor_negint(cs,v); }
+void _cbor_cb_negint32(void *cs, uint32_t v){ _cbor_negint(cs,v); }
+void _cbor_cb_negint64(void *cs, uint64_t v){ _cbor_negint(cs,v); }
+
+void _cbor_cb_bytes(void *ctx, cbor_data data, size_t len){
+    CborStream *cs = ctx;
+    if (len>0xffff) {
+        cs->err = 1;
+        return;
+    }
+    if (cs->base && !(PSEQUENCE_ELEMENTS(cs->stack) && CBOR_KIND(CBOR_TOP(cs))==CBOR_LEVEL_BYTES)) {
+        //chunks of indefinite byte strings are still copied, to be joined
+        int32_t start = (int32_t)(data-cs->base);
+        int32_t stop = start+(int32_t)len;
+        _cbor_value(cs,(PObject*)pslice_new(PSMALLINT_NEW(start),PSMALLINT_NEW(stop),PSMALLINT_NEW(1)));
+        return;
+    }
+    _cbor_value(cs,(PObject*)pbytes_new(len,(uint8_t*)data));
+}
+
+void _cbor_cb_string(void *ctx, cbor_data data, size_t len){
+    CborStream *cs = ctx;
+    PObject **lv;
+    if (len>0xffff) {
+        cs->err = 1;
+        return;
+    }
+    if (cs->keys && PSEQUENCE_ELEMENTS(cs->stack)) {
+        lv = CBOR_TOP(cs);
+        if (CBOR_KIND(lv)==CBOR_LEVEL_MAP && lv[3]==cs->stack) {
+            _cbor_value(cs,_cbor_intern(cs->keys,(uint8_t*)data,len));
+            return;
         }
-        break;
-        case 6: {
-            //tags
-            o = pinstance_new(TagClass);
-            PInstance *oo = (PInstance *)o;
-            phash_put(oo->dict, PSMALLINT_NEW(tagname), pinteger_new(cbor_tag_value(cbo)));
-            PObject *ooo = _cbor_to_py(cbor_tag_item(cbo));
-            phash_put(oo->dict, PSMALLINT_NEW(valuename), ooo);
+    }
+    _cbor_value(cs,(PObject*)pstring_new(len,(uint8_t*)data));
+}
+
+void _cbor_cb_bytes_start(void *cs){ _cbor_open(cs,(PObject*)plist_new(0,NULL),CBOR_LEVEL_BYTES,-1); }
+void _cbor_cb_string_start(void *cs){ _cbor_open(cs,(PObject*)plist_new(0,NULL),CBOR_LEVEL_STRING,-1); }
+
+void _cbor_cb_array_start(void *ctx, size_t n){
+    CborStream *cs = ctx;
+    PObject *o;
+    if (n>0xffff) {
+        cs->err = 1;
+        return;
+    }
+    //the size is only a hint: don't trust it for a big allocation
+    o = (PObject*)plist_new((n<16) ? n:16,NULL);
+    PSEQUENCE_ELEMENTS_SET(o,0);
+    _cbor_open(cs,o,CBOR_LEVEL_ARRAY,n);
+}
+void _cbor_cb_indef_array_start(void *cs){
+    PObject *o = (PObject*)plist_new(0,NULL);
+    _cbor_open(cs,o,CBOR_LEVEL_ARRAY,-1);
+}
+void _cbor_cb_map_start(void *ctx, size_t n){
+    CborStream *cs = ctx;
+    if (n>0xffff) {
+        cs->err = 1;
+        return;
+    }
+    _cbor_open(cs,(PObject*)pdict_new((n<16) ? n:16),CBOR_LEVEL_MAP,2*n);
+}
+void _cbor_cb_indef_map_start(void *cs){
+    _cbor_open(cs,(PObject*)pdict_new(4),CBOR_LEVEL_MAP,-1);
+}
+
+void _cbor_cb_tag(void *cs, uint64_t v){
+    PObject *o = pinstance_new(TagClass);
+    phash_put(((PInstance *)o)->dict, PSMALLINT_NEW(tagname), pinteger_new(v));
+    _cbor_open(cs,o,CBOR_LEVEL_TAG,1);
+}
+
+void _cbor_cb_float(void *cs, float v){ _cbor_value(cs,(PObject*)pfloat_new(v)); }
+void _cbor_cb_double(void *cs, double v){ _cbor_value(cs,(PObject*)pfloat_new(v)); }
+void _cbor_cb_null(void *cs){ _cbor_value(cs,MAKE_NONE()); }
+void _cbor_cb_undefined(void *cs){ _cbor_value(cs,pinstance_new(UndefinedClass)); }
+void _cbor_cb_bool(void *cs, bool v){ _cbor_value(cs,(v) ? PBOOL_TRUE():PBOOL_FALSE()); }
+
+void _cbor_cb_break(void *ctx){
+    CborStream *cs = ctx;
+    PObject **lv;
+    PObject *o;
+    uint8_t *buf;
+    int i,n,sz;
+
+    if (!PSEQUENCE_ELEMENTS(cs->stack)) {
+        cs->err = 1;
+        return;
+    }
+    lv = CBOR_TOP(cs);
+    //only indefinite containers end with a break, and maps must not have a pending key
+    if (PSMALLINT_VALUE(lv[2])>=0 || lv[3]!=cs->stack) {
+        cs->err = 1;
+        return;
+    }
+    o = lv[0];
+    if (CBOR_KIND(lv)==CBOR_LEVEL_STRING || CBOR_KIND(lv)==CBOR_LEVEL_BYTES) {
+        //join the chunks
+        n = PSEQUENCE_ELEMENTS(o);
+        for(i=0,sz=0;i<n;i++) sz+=PSEQUENCE_ELEMENTS(PLIST_ITEM(o,i));
+        if (sz>0xffff) {
+            cs->err = 1;
+            return;
         }
-        break;
-        case 7: {
-            //special: float & ctrls
-            if (cbor_float_ctrl_is_ctrl(cbo)) {
-                uint8_t val = cbor_ctrl_value(cbo);
-                if (val==20) o = PBOOL_FALSE();
-                else if (val==21) o = PBOOL_TRUE();
-                else if (val==22) o = MAKE_NONE();
-                else if (val==23) {
-                    o = pinstance_new(UndefinedClass);
-                } else {
-                    //return None for all other unassigned/reserved values
-                    o = MAKE_NONE();
-                }
-            } else {
-                double v = cbor_float_get_float(cbo);
-                o = pfloat_new(v);
-            }
+        o = (CBOR_KIND(lv)==CBOR_LEVEL_STRING) ? (PObject*)pstring_new(sz,NULL):(PObject*)pbytes_new(sz,NULL);
+        buf = PSEQUENCE_BYTES(o);
+        lv = CBOR_TOP(cs);
+        for(i=0;i<n;i++){
+            sz = PSEQUENCE_ELEMENTS(PLIST_ITEM(lv[0],i));
+            memcpy(buf,PSEQUENCE_BYTES(PLIST_ITEM(lv[0],i)),sz);
+            buf+=sz;
         }
-        break;
-        default:
-        //TODO: error
-        break;
     }
-    return o;
+    PSEQUENCE_ELEMENTS_SET(cs->stack,PSEQUENCE_ELEMENTS(cs->stack)-CBOR_LEVEL_SLOTS);
+    _cbor_value(cs,o);
+}
+
+const struct cbor_callbacks _cbor_stream_callbacks = {
+    .uint8 = _cbor_cb_uint8,
+    .uint16 = _cbor_cb_uint16,
+    .uint32 = _cbor_cb_uint32,
+    .uint64 = _cbor_cb_uint64,
+    .negint64 = _cbor_cb_negint64,
+    .negint32 = _cbor_cb_negint32,
+    .negint16 = _cbor_cb_negint16,
+    .negint8 = _cbor_cb_negint8,
+    .byte_string_start = _cbor_cb_bytes_start,
+    .byte_string = _cbor_cb_bytes,
+    .string = _cbor_cb_string,
+    .string_start = _cbor_cb_string_start,
+    .indef_array_start = _cbor_cb_indef_array_start,
+    .array_start = _cbor_cb_array_start,
+    .indef_map_start = _cbor_cb_indef_map_start,
+    .map_start = _cbor_cb_map_start,
+    .tag = _cbor_cb_tag,
+    .float2 = _cbor_cb_float,
+    .float4 = _cbor_cb_float,
+    .float8 = _cbor_cb_double,
+    .undefined = _cbor_cb_undefined,
+    .null = _cbor_cb_null,
+    .boolean = _cbor_cb_bool,
+    .indef_break = _cbor_cb_break
+};
+
+// decodes items from buf until the end of buf, an incomplete item or, if one is set,
+// the first complete root value. Returns the number of bytes consumed or -1 on error
+int _cbor_decode(CborStream *cs, uint8_t *buf, uint32_t len, int one){
+    struct cbor_decoder_result r;
+    uint32_t pos = 0;
+
+    while(pos<len){
+        r = cbor_stream_decode(buf+pos,len-pos,&_cbor_stream_callbacks,cs);
+        if (r.status==CBOR_DECODER_NEDATA) break;
+        if (r.status!=CBOR_DECODER_FINISHED || cs->err) {
+            printf("CBOR ERR %i at %i\n",r.status,pos);
+            return -1;
+        }
+        pos+=r.read;
+        if (one && PSEQUENCE_ELEMENTS(cs->out)) break;
+    }
+    return pos;
+}
+
+// prepares the keys table, an empty list to fill or a list already in use
+void _cbor_keys_init(PObject *keys){
+    while(PSEQUENCE_ELEMENTS(keys)<CBOR_KEYS_SIZE) plist_append(keys,MAKE_NONE());
 }
 
 C_NATIVE(_cbor_loads)
 {
     NATIVE_UNWARN();
-    uint8_t *buf;
-    uint32_t len;
+    CborStream cs;
     *res = MAKE_NONE();
-    if (parse_py_args("s", nargs, args, &buf, &len) != 1) {
+    if (nargs!=3 || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[0]))) {
         return ERR_TYPE_EXC;
     }
-    struct cbor_load_result lr;
-    cbor_item_t *rc = cbor_load(buf,len, &lr);
-    if (lr.error.code!=CBOR_ERR_NONE){
-        printf("ERR %i\n",lr.error.code);
-        // cbor_decref(&rc);
+    cs.stack = (PObject*)plist_new(0,NULL);
+    cs.out = (PObject*)plist_new(0,NULL);
+    cs.keys = NULL;
+    cs.base = (args[2]==PBOOL_TRUE()) ? PSEQUENCE_BYTES(args[0]):NULL;
+    cs.err = 0;
+    if (args[1]==PBOOL_TRUE()) {
+        cs.keys = (PObject*)plist_new(0,NULL);
+        _cbor_keys_init(cs.keys);
+    }
+    if (_cbor_decode(&cs,PSEQUENCE_BYTES(args[0]),PSEQUENCE_ELEMENTS(args[0]),1)<0 || !PSEQUENCE_ELEMENTS(cs.out)) {
+        //bad or truncated data
         return ERR_VALUE_EXC;
     }
+    *res = PLIST_ITEM(cs.out,0);
+    return ERR_OK;
+}
 
-    *res = _cbor_to_py(rc);
-    cbor_decref(&rc);
-    printf("==========> NM %i\n",nm);
+/*
+ * args: stack, data, out, keys
+ * decodes the complete items in data, appending root values to out
+ * returns the number of bytes of data consumed
+ */
+C_NATIVE(_cbor_stream_feed)
+{
+    NATIVE_UNWARN();
+    CborStream cs;
+    int r;
+    *res = MAKE_NONE();
+    if (nargs!=4 || PTYPE(args[0])!=PLIST || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1])) || PTYPE(args[2])!=PLIST) {
+        return ERR_TYPE_EXC;
+    }
+    cs.stack = args[0];
+    cs.out = args[2];
+    cs.keys = NULL;
+    cs.base = NULL;
+    cs.err = 0;
+    if (PTYPE(args[3])==PLIST) {
+        cs.keys = args[3];
+        _cbor_keys_init(cs.keys);
+    }
+    r = _cbor_decode(&cs,PSEQUENCE_BYTES(args[1]),PSEQUENCE_ELEMENTS(args[1]),0);
+    if (r<0) return ERR_VALUE_EXC;
+    *res = PSMALLINT_NEW(r);
     return ERR_OK;
 }
 
-cbor_item_t *_py_to_cbor(PObject *o){
-    cbor_item_t *root=NULL;
+// maximum size of a dumps result (a PBytes)
+#define CBOR_OUT_MAX 0xffff
+
+// output of _cbor_dumps: the first pass only counts bytes (buf==NULL),
+// the second one writes them in a PBytes of the exact size
+typedef struct _cbor_out {
+    uint8_t *buf;
+    uint32_t len;
+} CborOut;
 
-    printf("PTYPE %i\n",PTYPE(o));
+// runs a cbor_encode_* head encoder on out; a head is at most 9 bytes
+#define CBOR_EMIT(out,fn,...) do { \
+        uint8_t _scratch[9]; \
+        (out)->len += fn(__VA_ARGS__,((out)->buf) ? ((out)->buf+(out)->len):_scratch,9); \
+    } while(0)
+#define CBOR_EMIT0(out,fn) do { \
+        uint8_t _scratch[9]; \
+        (out)->len += fn(((out)->buf) ? ((out)->buf+(out)->len):_scratch,9); \
+    } while(0)
+
+void _cbor_emit_data(CborOut *out, uint8_t *data, uint32_t len){
+    if (out->buf) memcpy(out->buf+out->len,data,len);
+    out->len+=len;
+}
+
+// encodes o straight into out, without building libcbor items
+int _py_to_cbor(CborOut *out, PObject *o, int depth){
+    int i,elements;
+
+    if (depth>CBOR_MAX_DEPTH) return -1;
+    if (out->len>CBOR_OUT_MAX) return -1;
     switch(PTYPE(o)){
         case PSMALLINT:
         case PINTEGER:{
             int64_t v = INTEGER_VALUE(o);
-            int is_signed = (v<0) ? 1:0;
-            if (is_signed) v=-v-1;
-            
-            if(v<=0xff) {
-                root = cbor_new_int8();
-                cbor_set_uint8(root,v);
-            } else if(v<=0xffff) {
-                root = cbor_new_int16();
-                cbor_set_uint16(root,v);
-            } else if(v<=0xffffffff){
-                root = cbor_new_int32();
-                cbor_set_uint32(root,v);
-            } else {
-                root = cbor_new_int64();
-                cbor_set_uint64(root,v);
-            }
-            if(is_signed) cbor_mark_negint(root);
-        }
-        break;
-        case PFLOAT:{
-            double v = FLOAT_VALUE(o);
-            root = cbor_new_float8();
-            cbor_set_float8(root,v);
-        }
-        break;
-        case PBOOL:{
-            int v = (o==PBOOL_FALSE())?0:1;
-            root = cbor_build_bool(v);
-        }
-        break;
-        case PSTRING:{
-            root = cbor_new_definite_string();
-            uint8_t *data = cbor_malloc(PSEQUENCE_ELEMENTS(o));
-            memcpy(data,PSEQUENCE_BYTES(o),PSEQUENCE_ELEMENTS(o));
-            cbor_string_set_handle(root,data,PSEQUENCE_ELEMENTS(o));
+            if (v<0) CBOR_EMIT(out,cbor_encode_negint,(uint64_t)(-v-1));
+            else CBOR_EMIT(out,cbor_encode_uint,(uint64_t)v);
         }
         break;
+        case PFLOAT:
+            CBOR_EMIT(out,cbor_encode_double,FLOAT_VALUE(o));
+            break;
+        case PBOOL:
+            CBOR_EMIT(out,cbor_encode_bool,(o==PBOOL_FALSE()) ? false:true);
+            break;
+        case PSTRING:
+            CBOR_EMIT(out,cbor_encode_string_start,PSEQUENCE_ELEMENTS(o));
+            _cbor_emit_data(out,PSEQUENCE_BYTES(o),PSEQUENCE_ELEMENTS(o));
+            break;
         case PBYTES:
-        case PBYTEARRAY:{
-            root = cbor_new_definite_bytestring();
-            uint8_t *data = cbor_malloc(PSEQUENCE_ELEMENTS(o));
-            memcpy(data,PSEQUENCE_BYTES(o),PSEQUENCE_ELEMENTS(o));
-            cbor_bytestring_set_handle(root,data,PSEQUENCE_ELEMENTS(o));
-        }
-        break;
+        case PBYTEARRAY:
+            CBOR_EMIT(out,cbor_encode_bytestring_start,PSEQUENCE_ELEMENTS(o));
+            _cbor_emit_data(out,PSEQUENCE_BYTES(o),PSEQUENCE_ELEMENTS(o));
+            break;
         case PSHORTS:
-        case PSHORTARRAY:{
-            root = cbor_new_definite_bytestring();
-            uint8_t *data = cbor_malloc(PSEQUENCE_ELEMENTS(o)*2);
-            memcpy(data,PSEQUENCE_BYTES(o),PSEQUENCE_ELEMENTS(o)*2);
-            cbor_bytestring_set_handle(root,data,PSEQUENCE_ELEMENTS(o)*2);
-        }
-        break;
+        case PSHORTARRAY:
+            CBOR_EMIT(out,cbor_encode_bytestring_start,PSEQUENCE_ELEMENTS(o)*2);
+            _cbor_emit_data(out,PSEQUENCE_BYTES(o),PSEQUENCE_ELEMENTS(o)*2);
+            break;
         case PTUPLE:
         case PLIST:{
-            int elements = PSEQUENCE_ELEMENTS(o);
-            int i;
-            root = cbor_new_definite_array(elements);
+            elements = PSEQUENCE_ELEMENTS(o);
+            CBOR_EMIT(out,cbor_encode_array_start,elements);
             for(i=0;i<elements;i++){
                 PObject *item = (PTYPE(o)==PLIST)? (PLIST_ITEM(o,i)):(PTUPLE_ITEM(o,i));
-                cbor_item_t *ii = _py_to_cbor(item);
-                cbor_array_set(root,i,ii);
-                cbor_decref(&ii);
+                if (_py_to_cbor(out,item,depth+1)<0) return -1;
             }
         }
         break;
         case PDICT:{
             PHash *dict = (PHash *)o;
-            int i;
-            root = cbor_new_definite_map(dict->elements);
+            CBOR_EMIT(out,cbor_encode_map_start,dict->elements);
             for (i = 0; i < dict->elements; i++) {
                 HashEntry *h = phash_getentry(dict, i);
-                cbor_item_t *kk = _py_to_cbor(h->key);
-                cbor_item_t *vv = _py_to_cbor(h->value);
-                struct cbor_pair pair;
-                pair.key = kk;
-                pair.value = vv;
-                cbor_map_add(root,pair);
-                cbor_decref(&kk);
-                cbor_decref(&vv);
+                if (_py_to_cbor(out,h->key,depth+1)<0) return -1;
+                if (_py_to_cbor(out,h->value,depth+1)<0) return -1;
             }
         }
         break;
         case PINSTANCE:{
             PInstance *p = (PInstance*)o;
-            if (p->base==UndefinedClass) {
-                root = cbor_new_undef();
-            } else if(p->base==TagClass){
+            if(p->base==TagClass){
                 PObject *tag = phash_get(p->dict,PSMALLINT_NEW(tagname));
                 PObject *vv = phash_get(p->dict,PSMALLINT_NEW(valuename));
-                root = cbor_new_tag(INTEGER_VALUE(tag));
-                cbor_item_t * val = _py_to_cbor(vv);
-                cbor_tag_set_item(root,val);
-                cbor_decref(&val);
+                CBOR_EMIT(out,cbor_encode_tag,(uint64_t)INTEGER_VALUE(tag));
+                if (_py_to_cbor(out,vv,depth+1)<0) return -1;
             } else {
-                //error!
-                root = cbor_new_undef();
+                //Undefined and unknown instances
+                CBOR_EMIT0(out,cbor_encode_undef);
             }
         }
         break;
-        case PNONE:{
-            root = cbor_new_null();
-        }
-        break;
+        case PNONE:
+            CBOR_EMIT0(out,cbor_encode_null);
+            break;
         default:
             //return undef!
-            root = cbor_new_undef();
+            CBOR_EMIT0(out,cbor_encode_undef);
             break;
 
     }
-    return root;
+    return 0;
 }
 
 C_NATIVE(_cbor_dumps)
 {
     NATIVE_UNWARN();
     PObject *o = args[0];
+    CborOut out;
     *res = MAKE_NONE();
-    int32_t err = ERR_OK;
-
-    cbor_item_t *cobj = _py_to_cbor(o);
-    uint8_t * buffer;
-    int buffer_size, length = cbor_serialize_alloc(cobj, &buffer, &buffer_size);
-    if(buffer) {
-        *res = pbytes_new(length,buffer);
-        cbor_free(buffer);
-    } else {
-        err = ERR_RUNTIME_EXC;
+
+    //count the bytes, then encode them in a PBytes of the right size
+    out.buf = NULL;
+    out.len = 0;
+    if (_py_to_cbor(&out,o,0)<0 || out.len>CBOR_OUT_MAX) {
+        return ERR_RUNTIME_EXC;
     }
-    cbor_decref(&cobj);
-    printf("==========> NM %i\n",nm);
-    return err;
+    *res = pbytes_new(out.len,NULL);
+    out.buf = PSEQUENCE_BYTES(*res);
+    out.len = 0;
+    _py_to_cbor(&out,o,0);
+    return ERR_OK;
 }
-
-
-
-
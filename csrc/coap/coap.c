@@ -0,0 +1,364 @@
+#include "zerynth.h"
+
+/*
+ * CoAP message codec (RFC 7252) for coap.py.
+ *
+ * Messages are encoded into and decoded from the caller's preallocated buffers: encoding allocates nothing, decoding
+ * only the token and the values asked for. Options are given as (number, value) pairs in any order and are sorted
+ * here, since their numbers are delta encoded; values are integers (minimal big endian unsigned, no bytes for 0) or
+ * byte sequences.
+ */
+
+#define COAP_VERSION        1
+#define COAP_MAX_OPTIONS    16
+#define COAP_MAX_TOKEN      8
+#define COAP_MARKER         0xff
+
+// one option found in a message
+typedef struct _coap_opt {
+    uint32_t number;
+    uint8_t *value;
+    int32_t len;
+} CoapOpt;
+
+static int coap_is_uint(uint32_t number)
+{
+    switch (number) {
+        case 6:     // observe
+        case 7:     // uri port
+        case 12:    // content format
+        case 14:    // max age
+        case 17:    // accept
+        case 23:    // block2
+        case 27:    // block1
+        case 28:    // size2
+        case 60:    // size1
+            return 1;
+    }
+    return 0;
+}
+
+// writes the extended nibble of val: returns the nibble and sets ext/extlen
+static int coap_nibble(uint32_t val, uint8_t *ext, int *extlen)
+{
+    if (val < 13) {
+        *extlen = 0;
+        return val;
+    }
+    if (val < 269) {
+        ext[0] = val - 13;
+        *extlen = 1;
+        return 13;
+    }
+    val -= 269;
+    ext[0] = val >> 8;
+    ext[1] = val;
+    *extlen = 2;
+    return 14;
+}
+
+// reads the extension of nibble from p, -1 if malformed
+static int32_t coap_unnibble(int nibble, uint8_t **p, uint8_t *end)
+{
+    int32_t val;
+
+    if (nibble < 13)
+        return nibble;
+    if (nibble == 13) {
+        if (*p + 1 > end)
+            return -1;
+        val = (*p)[0] + 13;
+        *p += 1;
+        return val;
+    }
+    if (nibble == 14) {
+        if (*p + 2 > end)
+            return -1;
+        val = (((*p)[0] << 8) | (*p)[1]) + 269;
+        *p += 2;
+        return val;
+    }
+    return -1;
+}
+
+// next option at *p, updating number. Returns 1 if found, 0 at the payload or the end, -1 if malformed
+static int coap_next_opt(uint8_t **p, uint8_t *end, CoapOpt *opt)
+{
+    int32_t delta, len;
+    uint8_t b;
+
+    if (*p >= end || **p == COAP_MARKER)
+        return 0;
+    b = *(*p)++;
+    if ((delta = coap_unnibble(b >> 4, p, end)) < 0 || (len = coap_unnibble(b & 0x0f, p, end)) < 0)
+        return -1;
+    if (*p + len > end)
+        return -1;
+    opt->number += delta;
+    opt->value = *p;
+    opt->len = len;
+    *p += len;
+    return 1;
+}
+
+// offset of the first option, -1 if the header is malformed
+static int32_t coap_options_start(uint8_t *buf, int32_t n)
+{
+    int32_t tkl;
+
+    if (n < 4 || (buf[0] >> 6) != COAP_VERSION)
+        return -1;
+    tkl = buf[0] & 0x0f;
+    if (tkl > COAP_MAX_TOKEN || 4 + tkl > n)
+        return -1;
+    return 4 + tkl;
+}
+
+static PObject *coap_value(CoapOpt *opt)
+{
+    uint32_t v = 0;
+    int32_t i;
+
+    if (coap_is_uint(opt->number) && opt->len <= 4) {
+        for (i = 0; i < opt->len; i++)
+            v = (v << 8) | opt->value[i];
+        return (PObject*)PSMALLINT_NEW(v);
+    }
+    return (PObject*)pbytes_new(opt->len, opt->value);
+}
+
+static PObject *coap_opt_item(PObject *opts, int32_t i)
+{
+    return (PTYPE(opts) == PLIST) ? PLIST_ITEM(opts, i) : PTUPLE_ITEM(opts, i);
+}
+
+/*
+ * args: buf, type, code, message id, token, options, payload, ofs, size
+ * encodes a message into the bytearray buf and returns its length. options is a list or tuple of (number, value)
+ * pairs, payload a byte sequence or None of which size bytes from ofs are sent (up to the end if size is negative):
+ * blocks of a larger payload are sent without slicing it
+ */
+C_NATIVE(_coap_encode)
+{
+    C_NATIVE_UNWARN();
+    uint8_t *buf, *tok, *payload = NULL, *val, ext[4], vbuf[4];
+    int32_t size, type, code, mid, tkl, plen = 0, pofs, psize, nopts, i, j, len, dlen, llen, pos;
+    uint32_t last = 0, v;
+    PObject *opts, *pair;
+    PObject *sorted[COAP_MAX_OPTIONS];
+    int32_t numbers[COAP_MAX_OPTIONS];
+
+    if (nargs != 9 || PTYPE(args[0]) != PBYTEARRAY || !PYARG_BYTES(0, buf, size) || !PYARG_INT(1, type)
+        || !PYARG_INT(2, code) || !PYARG_INT(3, mid) || !PYARG_BYTES(4, tok, tkl) || !PYARG_INT(7, pofs)
+        || !PYARG_INT(8, psize))
+        return ERR_TYPE_EXC;
+    opts = args[5];
+    if (PTYPE(opts) != PLIST && PTYPE(opts) != PTUPLE)
+        return ERR_TYPE_EXC;
+    if (args[6] != MAKE_NONE() && !PYARG_BYTES(6, payload, plen))
+        return ERR_TYPE_EXC;
+    if (pofs < 0 || pofs > plen)
+        return ERR_INDEX_EXC;
+    plen -= pofs;
+    if (psize >= 0 && psize < plen)
+        plen = psize;
+    nopts = PSEQUENCE_ELEMENTS(opts);
+    if (type < 0 || type > 3 || code < 0 || code > 255 || tkl > COAP_MAX_TOKEN || nopts > COAP_MAX_OPTIONS)
+        return ERR_VALUE_EXC;
+
+    // insertion sort, stable: repeated options keep their order
+    for (i = 0; i < nopts; i++) {
+        pair = coap_opt_item(opts, i);
+        if (PTYPE(pair) != PTUPLE || PSEQUENCE_ELEMENTS(pair) != 2 || !IS_PSMALLINT(PTUPLE_ITEM(pair, 0)))
+            return ERR_TYPE_EXC;
+        v = PSMALLINT_VALUE(PTUPLE_ITEM(pair, 0));
+        for (j = i; j > 0 && numbers[j - 1] > (int32_t)v; j--) {
+            numbers[j] = numbers[j - 1];
+            sorted[j] = sorted[j - 1];
+        }
+        numbers[j] = v;
+        sorted[j] = pair;
+    }
+
+    if (size < 4 + tkl)
+        return ERR_VALUE_EXC;
+    buf[0] = (COAP_VERSION << 6) | (type << 4) | tkl;
+    buf[1] = code;
+    buf[2] = mid >> 8;
+    buf[3] = mid;
+    memcpy(buf + 4, tok, tkl);
+    pos = 4 + tkl;
+
+    for (i = 0; i < nopts; i++) {
+        pair = PTUPLE_ITEM(sorted[i], 1);
+        if (IS_PSMALLINT(pair)) {
+            v = PSMALLINT_VALUE(pair);
+            for (len = 0; v; v >>= 8)
+                vbuf[3 - len++] = v;
+            val = vbuf + 4 - len;
+        } else if (!pyarg_bytes(pair, &val, &len))
+            return ERR_TYPE_EXC;
+        if (numbers[i] < 0 || numbers[i] > 0xffff || len > 0xffff)
+            return ERR_VALUE_EXC;
+        j = coap_nibble(numbers[i] - last, ext, &dlen);
+        j = (j << 4) | coap_nibble(len, ext + dlen, &llen);
+        if (pos + 1 + dlen + llen + len > size)
+            return ERR_VALUE_EXC;
+        buf[pos++] = j;
+        memcpy(buf + pos, ext, dlen + llen);
+        pos += dlen + llen;
+        memcpy(buf + pos, val, len);
+        pos += len;
+        last = numbers[i];
+    }
+
+    if (plen) {
+        if (pos + 1 + plen > size)
+            return ERR_VALUE_EXC;
+        buf[pos++] = COAP_MARKER;
+        memcpy(buf + pos, payload + pofs, plen);
+        pos += plen;
+    }
+    *res = PSMALLINT_NEW(pos);
+    return ERR_OK;
+}
+
+/*
+ * args: buf, n
+ * checks the message in the first n bytes of buf and returns (type, code, message id, token, payload offset), the
+ * payload offset being n if there is no payload
+ */
+C_NATIVE(_coap_decode)
+{
+    C_NATIVE_UNWARN();
+    uint8_t *buf, *p, *end;
+    int32_t size, n, ofs, r;
+    CoapOpt opt;
+    PTuple *pt;
+
+    if (nargs != 2 || !PYARG_BYTES(0, buf, size) || !PYARG_INT(1, n))
+        return ERR_TYPE_EXC;
+    if (n < 0 || n > size || (ofs = coap_options_start(buf, n)) < 0)
+        return ERR_VALUE_EXC;
+    p = buf + ofs;
+    end = buf + n;
+    opt.number = 0;
+    while ((r = coap_next_opt(&p, end, &opt)) > 0)
+        ;
+    if (r < 0)
+        return ERR_VALUE_EXC;
+    if (p < end) {
+        // the marker must be followed by a payload
+        if (++p == end)
+            return ERR_VALUE_EXC;
+    }
+    pt = ptuple_new(5, NULL);
+    PTUPLE_SET_ITEM(pt, 0, PSMALLINT_NEW(buf[0] >> 4 & 3));
+    PTUPLE_SET_ITEM(pt, 1, PSMALLINT_NEW(buf[1]));
+    PTUPLE_SET_ITEM(pt, 2, PSMALLINT_NEW(buf[2] << 8 | buf[3]));
+    PTUPLE_SET_ITEM(pt, 3, pbytes_new(buf[0] & 0x0f, buf + 4));
+    PTUPLE_SET_ITEM(pt, 4, PSMALLINT_NEW((int32_t)(p - buf)));
+    *res = (PObject*)pt;
+    return ERR_OK;
+}
+
+/*
+ * args: buf, n, number, index
+ * returns the value of the index-th option number of the message in the first n bytes of buf, None if missing.
+ * Options known to be unsigned integers are returned as integers, the others as bytes
+ */
+C_NATIVE(_coap_option)
+{
+    C_NATIVE_UNWARN();
+    uint8_t *buf, *p, *end;
+    int32_t size, n, number, index, ofs, r;
+    CoapOpt opt;
+
+    if (nargs != 4 || !PYARG_BYTES(0, buf, size) || !PYARG_INT(1, n) || !PYARG_INT(2, number) || !PYARG_INT(3, index))
+        return ERR_TYPE_EXC;
+    if (n < 0 || n > size || (ofs = coap_options_start(buf, n)) < 0)
+        return ERR_VALUE_EXC;
+    p = buf + ofs;
+    end = buf + n;
+    opt.number = 0;
+    *res = MAKE_NONE();
+    while ((r = coap_next_opt(&p, end, &opt)) > 0) {
+        if ((int32_t)opt.number > number)
+            break;
+        if ((int32_t)opt.number == number && !index--) {
+            *res = coap_value(&opt);
+            break;
+        }
+    }
+    return (r < 0) ? ERR_VALUE_EXC : ERR_OK;
+}
+
+/*
+ * args: buf, n, number, sep
+ * returns the values of all the options number of the message joined by the string sep, as Uri-Path or Uri-Query
+ * are given; an empty string if there are none
+ */
+C_NATIVE(_coap_join)
+{
+    C_NATIVE_UNWARN();
+    uint8_t *buf, *sep, *p, *end, *s;
+    int32_t size, n, number, seplen, ofs, r, total = 0, count = 0;
+    CoapOpt opt;
+    PString *str;
+
+    if (nargs != 4 || !PYARG_BYTES(0, buf, size) || !PYARG_INT(1, n) || !PYARG_INT(2, number) || !PYARG_BYTES(3, sep, seplen))
+        return ERR_TYPE_EXC;
+    if (n < 0 || n > size || (ofs = coap_options_start(buf, n)) < 0)
+        return ERR_VALUE_EXC;
+    // first pass for the length, second one to copy
+    for (s = NULL;; ) {
+        p = buf + ofs;
+        end = buf + n;
+        opt.number = 0;
+        count = 0;
+        while ((r = coap_next_opt(&p, end, &opt)) > 0 && (int32_t)opt.number <= number) {
+            if ((int32_t)opt.number != number)
+                continue;
+            if (s) {
+                if (count) {
+                    memcpy(s, sep, seplen);
+                    s += seplen;
+                }
+                memcpy(s, opt.value, opt.len);
+                s += opt.len;
+            } else
+                total += opt.len + (count ? seplen : 0);
+            count++;
+        }
+        if (r < 0)
+            return ERR_VALUE_EXC;
+        if (s)
+            break;
+        str = pstring_new(total, NULL);
+        s = PSEQUENCE_BYTES(str);
+        if (!total)
+            break;
+    }
+    *res = (PObject*)str;
+    return ERR_OK;
+}
+
+/*
+ * args: buf, ofs, n
+ * moves the bytes from ofs to n, the payload of a decoded message, to the start of buf and returns their number, so
+ * that the payload can be handed on in the receive buffer itself
+ */
+C_NATIVE(_coap_shift)
+{
+    C_NATIVE_UNWARN();
+    uint8_t *buf;
+    int32_t size, ofs, n;
+
+    if (nargs != 3 || PTYPE(args[0]) != PBYTEARRAY || !PYARG_BYTES(0, buf, size) || !PYARG_INT(1, ofs) || !PYARG_INT(2, n))
+        return ERR_TYPE_EXC;
+    if (n < 0 || n > size || ofs < 0 || ofs > n)
+        return ERR_INDEX_EXC;
+    memmove(buf, buf + ofs, n - ofs);
+    *res = PSMALLINT_NEW(n - ofs);
+    return ERR_OK;
+}
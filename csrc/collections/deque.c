@@ -0,0 +1,348 @@
+#include "zerynth.h"
+
+/*
+ * Double ended queue for collections.deque and fifo.Fifo.
+ *
+ * A deque is a list [state, ring]: the ring is a list used as a circular buffer, so that the items stay visible to
+ * the gc, or a bytearray for deques of bytes. The state (head, count and bound of the ring) lives in a bytearray.
+ * Appends and pops at both ends are O(1); an unbounded deque doubles its ring when full, a bounded one never
+ * reallocates and either refuses new items or discards the ones at the other end.
+ * The deque is not thread safe.
+ */
+
+#define DEQUE_TAG           0x44455155  /* "DEQU" */
+#define DEQUE_MIN_RING      8
+#define DEQUE_MAX_RING      0xffff
+
+typedef struct _deque_state {
+    uint32_t tag;
+    int32_t head;
+    int32_t count;
+    int32_t maxlen;
+} DequeState;
+
+#define DQ_STATE(d) ((DequeState*)PSEQUENCE_BYTES(PLIST_ITEM(d, 0)))
+#define DQ_RING(d)  PLIST_ITEM(d, 1)
+
+static int deque_check(PObject *d)
+{
+    PObject *st;
+
+    if (PTYPE(d) != PLIST || PSEQUENCE_ELEMENTS(d) != 2)
+        return 0;
+    st = PLIST_ITEM(d, 0);
+    return PTYPE(st) == PBYTEARRAY && PSEQUENCE_ELEMENTS(st) == (int32_t)sizeof(DequeState) && DQ_STATE(d)->tag == DEQUE_TAG;
+}
+
+static PObject *deque_ring_new(int bytes, int32_t cap)
+{
+    PObject *ring;
+    int32_t i;
+
+    if (bytes) {
+        ring = (PObject*)psequence_new(PBYTEARRAY, cap);
+        PSEQUENCE_ELEMENTS_SET(ring, cap);
+        memset(PSEQUENCE_BYTES(ring), 0, cap);
+    } else {
+        ring = (PObject*)plist_new(cap, NULL);
+        for (i = 0; i < cap; i++)
+            PLIST_SET_ITEM(ring, i, MAKE_NONE());
+    }
+    return ring;
+}
+
+static inline PObject *deque_get(PObject *ring, int32_t i)
+{
+    if (PTYPE(ring) == PBYTEARRAY)
+        return PSMALLINT_NEW(PSEQUENCE_BYTES(ring)[i]);
+    return PLIST_ITEM(ring, i);
+}
+
+static inline void deque_set(PObject *ring, int32_t i, PObject *obj)
+{
+    if (PTYPE(ring) == PBYTEARRAY)
+        PSEQUENCE_BYTES(ring)[i] = (obj) ? PSMALLINT_VALUE(obj) : 0;
+    else
+        PLIST_SET_ITEM(ring, i, (obj) ? obj : MAKE_NONE());
+}
+
+// doubles the ring of an unbounded deque, keeping the order of the items
+static int deque_grow(PObject *d)
+{
+    DequeState *st = DQ_STATE(d);
+    PObject *ring = DQ_RING(d);
+    int32_t cap = PSEQUENCE_ELEMENTS(ring);
+    int32_t ncap = 2 * cap, i;
+    PObject *nring;
+
+    if (cap >= DEQUE_MAX_RING)
+        return -1;
+    if (ncap > DEQUE_MAX_RING)
+        ncap = DEQUE_MAX_RING;
+    nring = deque_ring_new(PTYPE(ring) == PBYTEARRAY, ncap);
+    for (i = 0; i < st->count; i++)
+        deque_set(nring, i, deque_get(ring, (st->head + i) % cap));
+    PLIST_SET_ITEM(d, 1, nring);
+    st->head = 0;
+    return 0;
+}
+
+// removes and returns the item at the left or right end of a deque that is not empty
+static PObject *deque_take(PObject *d, int left)
+{
+    DequeState *st = DQ_STATE(d);
+    PObject *ring = DQ_RING(d);
+    int32_t cap = PSEQUENCE_ELEMENTS(ring);
+    int32_t i = left ? st->head : (st->head + st->count - 1) % cap;
+    PObject *obj = deque_get(ring, i);
+
+    deque_set(ring, i, NULL);
+    if (left)
+        st->head = (st->head + 1) % cap;
+    st->count--;
+    return obj;
+}
+
+// stores obj at the left or right end of a deque with a free place
+static void deque_store(PObject *d, PObject *obj, int left)
+{
+    DequeState *st = DQ_STATE(d);
+    PObject *ring = DQ_RING(d);
+    int32_t cap = PSEQUENCE_ELEMENTS(ring);
+
+    if (left) {
+        st->head = (st->head + cap - 1) % cap;
+        deque_set(ring, st->head, obj);
+    } else {
+        deque_set(ring, (st->head + st->count) % cap, obj);
+    }
+    st->count++;
+}
+
+// ring index of item i, negative from the right end. Returns -1 if out of range
+static int32_t deque_index(PObject *d, PObject *idx)
+{
+    DequeState *st = DQ_STATE(d);
+    int32_t i;
+
+    if (!IS_PSMALLINT(idx))
+        return -1;
+    i = PSMALLINT_VALUE(idx);
+    if (i < 0)
+        i += st->count;
+    if (i < 0 || i >= st->count)
+        return -1;
+    return (st->head + i) % PSEQUENCE_ELEMENTS(DQ_RING(d));
+}
+
+/*
+ * args: maxlen, bytes
+ * returns a new deque, bounded to maxlen items if maxlen>0, of bytes if bytes is true
+ */
+C_NATIVE(_deque_new)
+{
+    C_NATIVE_UNWARN();
+    int32_t maxlen;
+    PObject *d, *state;
+    DequeState *st;
+
+    if (nargs != 2 || !IS_PSMALLINT(args[0]))
+        return ERR_TYPE_EXC;
+    maxlen = PSMALLINT_VALUE(args[0]);
+    if (maxlen > DEQUE_MAX_RING)
+        return ERR_VALUE_EXC;
+    if (maxlen < 0)
+        maxlen = 0;
+
+    d = (PObject*)plist_new(2, NULL);
+    PLIST_SET_ITEM(d, 0, MAKE_NONE());
+    PLIST_SET_ITEM(d, 1, MAKE_NONE());
+    *res = d;
+    state = (PObject*)psequence_new(PBYTEARRAY, sizeof(DequeState));
+    PSEQUENCE_ELEMENTS_SET(state, sizeof(DequeState));
+    PLIST_SET_ITEM(d, 0, state);
+    st = DQ_STATE(d);
+    st->tag = DEQUE_TAG;
+    st->head = 0;
+    st->count = 0;
+    st->maxlen = maxlen;
+    PLIST_SET_ITEM(d, 1, deque_ring_new(args[1] == PBOOL_TRUE(), maxlen ? maxlen : DEQUE_MIN_RING));
+    return ERR_OK;
+}
+
+/*
+ * args: d, obj, left, discard
+ * adds obj at the left end if left is true, else at the right end. If a bounded deque is full, the item at the other
+ * end is discarded if discard is true, else obj is not added and False is returned
+ */
+C_NATIVE(_deque_push)
+{
+    C_NATIVE_UNWARN();
+    PObject *d;
+    DequeState *st;
+    int left;
+
+    if (nargs != 4 || !deque_check(args[0]))
+        return ERR_TYPE_EXC;
+    d = args[0];
+    st = DQ_STATE(d);
+    left = args[2] == PBOOL_TRUE();
+    if (PTYPE(DQ_RING(d)) == PBYTEARRAY) {
+        if (!IS_PSMALLINT(args[1]))
+            return ERR_TYPE_EXC;
+        if (PSMALLINT_VALUE(args[1]) < 0 || PSMALLINT_VALUE(args[1]) > 255)
+            return ERR_VALUE_EXC;
+    }
+    *res = PBOOL_TRUE();
+    if (st->count == PSEQUENCE_ELEMENTS(DQ_RING(d))) {
+        if (st->maxlen) {
+            if (args[3] != PBOOL_TRUE()) {
+                *res = PBOOL_FALSE();
+                return ERR_OK;
+            }
+            deque_take(d, !left);
+        } else if (deque_grow(d) < 0) {
+            return ERR_RUNTIME_EXC;
+        }
+    }
+    deque_store(d, args[1], left);
+    return ERR_OK;
+}
+
+/*
+ * args: d, left, remove
+ * returns the item at the left end if left is true, else at the right end, removing it if remove is true.
+ * Returns d itself if the deque is empty
+ */
+C_NATIVE(_deque_pop)
+{
+    C_NATIVE_UNWARN();
+    PObject *d;
+    DequeState *st;
+    int left;
+
+    if (nargs != 3 || !deque_check(args[0]))
+        return ERR_TYPE_EXC;
+    d = args[0];
+    st = DQ_STATE(d);
+    left = args[1] == PBOOL_TRUE();
+    if (!st->count) {
+        *res = d;
+        return ERR_OK;
+    }
+    if (args[2] == PBOOL_TRUE())
+        *res = deque_take(d, left);
+    else
+        *res = deque_get(DQ_RING(d), left ? st->head : (st->head + st->count - 1) % PSEQUENCE_ELEMENTS(DQ_RING(d)));
+    return ERR_OK;
+}
+
+/*
+ * args: d, index
+ * returns the item at index, negative from the right end
+ */
+C_NATIVE(_deque_get)
+{
+    C_NATIVE_UNWARN();
+    int32_t i;
+
+    if (nargs != 2 || !deque_check(args[0]))
+        return ERR_TYPE_EXC;
+    if ((i = deque_index(args[0], args[1])) < 0)
+        return ERR_INDEX_EXC;
+    *res = deque_get(DQ_RING(args[0]), i);
+    return ERR_OK;
+}
+
+/*
+ * args: d, index, obj
+ * replaces the item at index, negative from the right end, with obj
+ */
+C_NATIVE(_deque_set)
+{
+    C_NATIVE_UNWARN();
+    PObject *ring;
+    int32_t i;
+
+    if (nargs != 3 || !deque_check(args[0]))
+        return ERR_TYPE_EXC;
+    if ((i = deque_index(args[0], args[1])) < 0)
+        return ERR_INDEX_EXC;
+    ring = DQ_RING(args[0]);
+    if (PTYPE(ring) == PBYTEARRAY && (!IS_PSMALLINT(args[2]) || PSMALLINT_VALUE(args[2]) < 0 || PSMALLINT_VALUE(args[2]) > 255))
+        return ERR_VALUE_EXC;
+    deque_set(ring, i, args[2]);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: d
+ * returns the number of items
+ */
+C_NATIVE(_deque_size)
+{
+    C_NATIVE_UNWARN();
+    if (nargs != 1 || !deque_check(args[0]))
+        return ERR_TYPE_EXC;
+    *res = PSMALLINT_NEW(DQ_STATE(args[0])->count);
+    return ERR_OK;
+}
+
+/*
+ * args: d
+ * removes all the items
+ */
+C_NATIVE(_deque_clear)
+{
+    C_NATIVE_UNWARN();
+    PObject *d;
+    DequeState *st;
+
+    if (nargs != 1 || !deque_check(args[0]))
+        return ERR_TYPE_EXC;
+    d = args[0];
+    st = DQ_STATE(d);
+    while (st->count)
+        deque_take(d, 1);
+    st->head = 0;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: d, n
+ * rotates the deque n steps to the right (to the left if n is negative): moves the fewest items, or none at all
+ * if the ring is full
+ */
+C_NATIVE(_deque_rotate)
+{
+    C_NATIVE_UNWARN();
+    PObject *d;
+    DequeState *st;
+    int32_t n, cap;
+
+    if (nargs != 2 || !deque_check(args[0]) || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    d = args[0];
+    st = DQ_STATE(d);
+    *res = MAKE_NONE();
+    if (st->count < 2)
+        return ERR_OK;
+    n = PSMALLINT_VALUE(args[1]) % st->count;
+    if (n < 0)
+        n += st->count;
+    cap = PSEQUENCE_ELEMENTS(DQ_RING(d));
+    if (st->count == cap) {
+        st->head = (st->head + cap - n) % cap;
+        return ERR_OK;
+    }
+    if (n <= st->count / 2) {
+        while (n--)
+            deque_store(d, deque_take(d, 0), 1);
+    } else {
+        for (n = st->count - n; n; n--)
+            deque_store(d, deque_take(d, 1), 0);
+    }
+    return ERR_OK;
+}
@@ -0,0 +1,173 @@
+#include "zerynth.h"
+
+/*
+ * Binary min heap on a Python list, in place, as the heapq module of CPython: heap[k] <= heap[2k+1] and
+ * heap[k] <= heap[2k+2]. Items are compared with the < of the VM, so they can be numbers, strings or tuples
+ * (a scheduler pushes (deadline, sequence, handle) tuples, so that handles themselves are never compared).
+ * Each operation is a single call of O(log n) comparisons, O(n) for heapify.
+ */
+
+static err_t hq_lt(PObject *a, PObject *b, int *lt)
+{
+    PObject *r;
+    err_t err;
+
+    if (IS_PSMALLINT(a) && IS_PSMALLINT(b)) {
+        *lt = PSMALLINT_VALUE(a) < PSMALLINT_VALUE(b);
+        return ERR_OK;
+    }
+    err = pobj_compare(LT, a, b, &r);
+    if (err != ERR_OK)
+        return err;
+    *lt = (r == PBOOL_TRUE());
+    return ERR_OK;
+}
+
+// moves the item at pos towards the root, not above start. On errors the list keeps all its items
+static err_t hq_up(PObject **h, int32_t start, int32_t pos)
+{
+    PObject *item = h[pos];
+    int32_t parent;
+    int lt;
+    err_t err = ERR_OK;
+
+    while (pos > start) {
+        parent = (pos - 1) >> 1;
+        if ((err = hq_lt(item, h[parent], &lt)) != ERR_OK || !lt)
+            break;
+        h[pos] = h[parent];
+        pos = parent;
+    }
+    h[pos] = item;
+    return err;
+}
+
+// moves the item at pos down to a leaf along the smaller children, then up to its place: fewer comparisons on average
+static err_t hq_down(PObject **h, int32_t n, int32_t pos)
+{
+    PObject *item = h[pos];
+    int32_t start = pos, child = 2 * pos + 1;
+    int lt;
+    err_t err;
+
+    while (child < n) {
+        if (child + 1 < n) {
+            if ((err = hq_lt(h[child], h[child + 1], &lt)) != ERR_OK) {
+                h[pos] = item;
+                return err;
+            }
+            if (!lt)
+                child++;
+        }
+        h[pos] = h[child];
+        pos = child;
+        child = 2 * pos + 1;
+    }
+    h[pos] = item;
+    return hq_up(h, start, pos);
+}
+
+static int hq_check(PObject *heap)
+{
+    return PTYPE(heap) == PLIST;
+}
+
+/*
+ * args: heap, item
+ * pushes item
+ */
+C_NATIVE(_heapq_push)
+{
+    C_NATIVE_UNWARN();
+    PObject *heap;
+    err_t err;
+
+    if (nargs != 2 || !hq_check(args[0]))
+        return ERR_TYPE_EXC;
+    heap = args[0];
+    if ((err = plist_append(heap, args[1])) != ERR_OK)
+        return err;
+    *res = MAKE_NONE();
+    return hq_up(PSEQUENCE_OBJECTS(heap), 0, PSEQUENCE_ELEMENTS(heap) - 1);
+}
+
+/*
+ * args: heap
+ * removes and returns the smallest item
+ */
+C_NATIVE(_heapq_pop)
+{
+    C_NATIVE_UNWARN();
+    PObject *heap, **h;
+    int32_t n;
+
+    if (nargs != 1 || !hq_check(args[0]))
+        return ERR_TYPE_EXC;
+    heap = args[0];
+    n = PSEQUENCE_ELEMENTS(heap);
+    if (!n)
+        return ERR_INDEX_EXC;
+    h = PSEQUENCE_OBJECTS(heap);
+    *res = h[0];
+    h[0] = h[n - 1];
+    h[n - 1] = MAKE_NONE();
+    PSEQUENCE_ELEMENTS_SET(heap, n - 1);
+    if (n == 1)
+        return ERR_OK;
+    return hq_down(h, n - 1, 0);
+}
+
+/*
+ * args: heap, item, push_first
+ * pushes item and pops the smallest item if push_first (heappushpop), else pops then pushes (heapreplace).
+ * Returns the popped item
+ */
+C_NATIVE(_heapq_replace)
+{
+    C_NATIVE_UNWARN();
+    PObject *heap, **h;
+    int lt;
+    err_t err;
+
+    if (nargs != 3 || !hq_check(args[0]))
+        return ERR_TYPE_EXC;
+    heap = args[0];
+    h = PSEQUENCE_OBJECTS(heap);
+    if (args[2] == PBOOL_TRUE()) {
+        // item is returned at once if it is not greater than the root
+        *res = args[1];
+        if (!PSEQUENCE_ELEMENTS(heap))
+            return ERR_OK;
+        if ((err = hq_lt(h[0], args[1], &lt)) != ERR_OK)
+            return err;
+        if (!lt)
+            return ERR_OK;
+    } else if (!PSEQUENCE_ELEMENTS(heap)) {
+        return ERR_INDEX_EXC;
+    }
+    *res = h[0];
+    h[0] = args[1];
+    return hq_down(h, PSEQUENCE_ELEMENTS(heap), 0);
+}
+
+/*
+ * args: heap
+ * turns the list into a heap, in linear time
+ */
+C_NATIVE(_heapq_heapify)
+{
+    C_NATIVE_UNWARN();
+    PObject **h;
+    int32_t n, i;
+    err_t err;
+
+    if (nargs != 1 || !hq_check(args[0]))
+        return ERR_TYPE_EXC;
+    n = PSEQUENCE_ELEMENTS(args[0]);
+    h = PSEQUENCE_OBJECTS(args[0]);
+    for (i = n / 2 - 1; i >= 0; i--)
+        if ((err = hq_down(h, n, i)) != ERR_OK)
+            return err;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
@@ -0,0 +1,229 @@
+#include "zerynth.h"
+#include "crc.h"
+
+/*
+ * CRC engine of the crc module (see crc.h).
+ *
+ * A model is a bytes object: the CrcModel followed by its tables. The register of each CRC object is a 4 bytes
+ * bytearray, updated in place: an update allocates nothing.
+ */
+
+int (*crc_hw_update)(const CrcModel *m, uint32_t *reg, const uint8_t *buf, uint32_t len);
+
+static uint32_t crc_reflect(uint32_t x, int bits)
+{
+    uint32_t r = 0;
+    int i;
+
+    for (i = 0; i < bits; i++) {
+        r = (r << 1) | (x & 1);
+        x >>= 1;
+    }
+    return r;
+}
+
+void crc_model_init(CrcModel *m, uint32_t *tables)
+{
+    uint32_t i, k, c, poly;
+
+    if (m->refin) {
+        poly = crc_reflect(m->poly, m->width);
+        for (i = 0; i < 256; i++) {
+            c = i;
+            for (k = 0; k < 8; k++)
+                c = (c & 1) ? (c >> 1) ^ poly : c >> 1;
+            tables[i] = c;
+        }
+        // T[k][i]: byte i followed by k zero bytes
+        for (k = 1; k < m->slices; k++)
+            for (i = 0; i < 256; i++)
+                tables[256 * k + i] = (tables[256 * (k - 1) + i] >> 8) ^ tables[tables[256 * (k - 1) + i] & 0xff];
+    } else {
+        poly = m->poly << (32 - m->width);
+        for (i = 0; i < 256; i++) {
+            c = i << 24;
+            for (k = 0; k < 8; k++)
+                c = (c & 0x80000000) ? (c << 1) ^ poly : c << 1;
+            tables[i] = c;
+        }
+        for (k = 1; k < m->slices; k++)
+            for (i = 0; i < 256; i++)
+                tables[256 * k + i] = (tables[256 * (k - 1) + i] << 8) ^ tables[tables[256 * (k - 1) + i] >> 24];
+    }
+}
+
+uint32_t crc_reset(const CrcModel *m)
+{
+    return m->refin ? crc_reflect(m->init, m->width) : m->init << (32 - m->width);
+}
+
+uint32_t crc_update(const CrcModel *m, const uint32_t *t, uint32_t reg, const uint8_t *buf, uint32_t len)
+{
+    if (m->refin) {
+        if (m->slices == 4) {
+            for (; len >= 4; len -= 4, buf += 4) {
+                reg ^= buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((uint32_t)buf[3] << 24);
+                reg = t[768 + (reg & 0xff)] ^ t[512 + ((reg >> 8) & 0xff)] ^ t[256 + ((reg >> 16) & 0xff)] ^ t[reg >> 24];
+            }
+        }
+        while (len--)
+            reg = (reg >> 8) ^ t[(reg ^ *buf++) & 0xff];
+    } else {
+        if (m->slices == 4) {
+            for (; len >= 4; len -= 4, buf += 4) {
+                reg ^= ((uint32_t)buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
+                reg = t[768 + (reg >> 24)] ^ t[512 + ((reg >> 16) & 0xff)] ^ t[256 + ((reg >> 8) & 0xff)] ^ t[reg & 0xff];
+            }
+        }
+        while (len--)
+            reg = (reg << 8) ^ t[(reg >> 24) ^ *buf++];
+    }
+    return reg;
+}
+
+uint32_t crc_value(const CrcModel *m, uint32_t reg)
+{
+    uint32_t mask = (m->width == 32) ? 0xffffffff : ((1u << m->width) - 1);
+
+    if (!m->refin)
+        reg >>= 32 - m->width;
+    if (m->refin != m->refout)
+        reg = crc_reflect(reg, m->width);
+    return (reg ^ m->xorout) & mask;
+}
+
+static int32_t crc_int(PObject *o, uint32_t *v)
+{
+    if (!IS_INTEGER(o))
+        return -1;
+    *v = (uint32_t)INTEGER_VALUE(o);
+    return 0;
+}
+
+static CrcModel *crc_model_of(PObject *o)
+{
+    CrcModel *m;
+
+    if (PTYPE(o) != PBYTES || PSEQUENCE_ELEMENTS(o) < sizeof(CrcModel))
+        return NULL;
+    m = (CrcModel*)PSEQUENCE_BYTES(o);
+    if (PSEQUENCE_ELEMENTS(o) != sizeof(CrcModel) + 1024 * m->slices)
+        return NULL;
+    return m;
+}
+
+/*
+ * args: width, poly, init, refin, refout, xorout, slices
+ * returns the model: a bytes object with the parameters and slices (1 or 4) tables
+ */
+C_NATIVE(__crc_model) {
+    NATIVE_UNWARN();
+    uint32_t width, poly, init, refin, refout, xorout, slices, mask;
+    PBytes *bres;
+    CrcModel *m;
+
+    if (nargs != 7 || crc_int(args[0], &width) || crc_int(args[1], &poly) || crc_int(args[2], &init) ||
+        crc_int(args[3], &refin) || crc_int(args[4], &refout) || crc_int(args[5], &xorout) || crc_int(args[6], &slices))
+        return ERR_TYPE_EXC;
+    if (width < 1 || width > 32 || (slices != 1 && slices != 4))
+        return ERR_VALUE_EXC;
+    mask = (width == 32) ? 0xffffffff : ((1u << width) - 1);
+    if (!(poly & 1) || (poly & ~mask) || (init & ~mask) || (xorout & ~mask))
+        return ERR_VALUE_EXC;
+
+    bres = pbytes_new(sizeof(CrcModel) + 1024 * slices, NULL);
+    m = (CrcModel*)PSEQUENCE_BYTES(bres);
+    m->width = width;
+    m->refin = refin != 0;
+    m->refout = refout != 0;
+    m->slices = slices;
+    m->poly = poly;
+    m->init = init;
+    m->xorout = xorout;
+    crc_model_init(m, (uint32_t*)(m + 1));
+    *res = bres;
+    return ERR_OK;
+}
+
+/*
+ * args: model, reg
+ * sets the register (a bytearray of 4 bytes) to the initial value of model
+ */
+C_NATIVE(__crc_reset) {
+    NATIVE_UNWARN();
+    CrcModel *m = (nargs == 2) ? crc_model_of(args[0]) : NULL;
+    uint32_t reg;
+
+    if (!m || PTYPE(args[1]) != PBYTEARRAY || PSEQUENCE_ELEMENTS(args[1]) != 4)
+        return ERR_TYPE_EXC;
+    reg = crc_reset(m);
+    memcpy(PSEQUENCE_BYTES(args[1]), &reg, 4);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: model, reg, data, start, stop
+ * feeds data[start:stop] to the register, stop negative for the end. data can be bytes, bytearray, a string, shorts or
+ * a shortarray: shorts are fed as they are in memory, low byte first, and start and stop count shorts
+ */
+C_NATIVE(__crc_update) {
+    NATIVE_UNWARN();
+    CrcModel *m = (nargs == 5) ? crc_model_of(args[0]) : NULL;
+    int32_t start, stop, n, esize;
+    uint32_t reg;
+    uint8_t *buf;
+
+    if (!m || PTYPE(args[1]) != PBYTEARRAY || PSEQUENCE_ELEMENTS(args[1]) != 4 || !IS_PSMALLINT(args[3]) || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    switch (PTYPE(args[2])) {
+        case PBYTES:
+        case PBYTEARRAY:
+        case PSTRING:
+            esize = 1;
+            break;
+        case PSHORTS:
+        case PSHORTARRAY:
+            esize = 2;
+            break;
+        default:
+            return ERR_TYPE_EXC;
+    }
+    n = PSEQUENCE_ELEMENTS(args[2]);
+    start = PSMALLINT_VALUE(args[3]);
+    stop = PSMALLINT_VALUE(args[4]);
+    if (stop < 0 || stop > n)
+        stop = n;
+    if (start < 0 || start > stop)
+        return ERR_INDEX_EXC;
+    buf = (uint8_t*)PSEQUENCE_BYTES(args[2]) + start * esize;
+    n = (stop - start) * esize;
+    memcpy(&reg, PSEQUENCE_BYTES(args[1]), 4);
+
+    // short buffers cost less than releasing the GIL
+    if (n >= 256)
+        RELEASE_GIL();
+    if (!crc_hw_update || crc_hw_update(m, &reg, buf, n) < 0)
+        reg = crc_update(m, (uint32_t*)(m + 1), reg, buf, n);
+    if (n >= 256)
+        ACQUIRE_GIL();
+    memcpy(PSEQUENCE_BYTES(args[1]), &reg, 4);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: model, reg
+ * returns the CRC of the bytes fed to the register so far
+ */
+C_NATIVE(__crc_value) {
+    NATIVE_UNWARN();
+    CrcModel *m = (nargs == 2) ? crc_model_of(args[0]) : NULL;
+    uint32_t reg;
+
+    if (!m || PTYPE(args[1]) != PBYTEARRAY || PSEQUENCE_ELEMENTS(args[1]) != 4)
+        return ERR_TYPE_EXC;
+    memcpy(&reg, PSEQUENCE_BYTES(args[1]), 4);
+    *res = pinteger_new(crc_value(m, reg));
+    return ERR_OK;
+}
@@ -0,0 +1,40 @@
+#ifndef ZERYNTH_CRC_H_
+#define ZERYNTH_CRC_H_
+
+#include <stdint.h>
+
+/*
+ * Table driven CRCs of any width from 1 to 32 bits, for the crc module.
+ *
+ * The register is kept in 32 bits: LSB aligned for reflected input (refin) and MSB aligned otherwise, so that
+ * a single loop with a 256 entries table (or four, slice-by-4) serves every width. Tables are generated once per
+ * model and shared by the CRC objects using it.
+ */
+
+typedef struct _crc_model {
+    uint8_t width;
+    uint8_t refin;
+    uint8_t refout;
+    uint8_t slices;     // 1 or 4 tables of 256 words follow
+    uint32_t poly;
+    uint32_t init;
+    uint32_t xorout;
+} CrcModel;
+
+/*
+ * Set by ports with a CRC unit: feeds len bytes of buf to the register *reg (in the internal form above) of model m.
+ * Returns 0, or -1 if the unit can't compute m, and the tables are used. Called with the GIL released.
+ */
+extern int (*crc_hw_update)(const CrcModel *m, uint32_t *reg, const uint8_t *buf, uint32_t len);
+
+void crc_model_init(CrcModel *m, uint32_t *tables);
+uint32_t crc_reset(const CrcModel *m);
+uint32_t crc_update(const CrcModel *m, const uint32_t *tables, uint32_t reg, const uint8_t *buf, uint32_t len);
+uint32_t crc_value(const CrcModel *m, uint32_t reg);
+
+/*
+ * Plain CRC-32 of zlib and gzip for the C modules, in crc32.c: crc is 0 or the value of the previous chunk.
+ */
+uint32_t crc32_update(uint32_t crc, const uint8_t *buf, uint32_t len);
+
+#endif
@@ -0,0 +1,411 @@
+#include "zerynth.h"
+
+/*
+ * Calendar conversions and text formats of the datetime module.
+ * A datetime is an ordinal (days from 0001-01-01, that is day 1) and the seconds from midnight;
+ * the offset of an aware datetime is passed in seconds by the Python side, that owns the timezone objects.
+ */
+
+#define DT_MAX_ORD  3652059     // 9999-12-31
+
+static const uint16_t dt_before_month[13] = {0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+static const uint8_t dt_month_days[13] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+static const char dt_days[] = "MonTueWedThuFriSatSun";
+static const char dt_months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+static const char *const dt_day_names[7] = {"Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday"};
+static const char *const dt_month_names[12] = {"January", "February", "March", "April", "May", "June", "July",
+                                               "August", "September", "October", "November", "December"};
+
+static int dt_leap(int32_t y)
+{
+    return (y % 4 == 0) && (y % 100 != 0 || y % 400 == 0);
+}
+
+static int dt_month_len(int32_t y, int32_t m)
+{
+    return (m == 2 && dt_leap(y)) ? 29 : dt_month_days[m];
+}
+
+static int32_t dt_ymd2ord(int32_t y, int32_t m, int32_t d)
+{
+    int32_t p = y - 1;
+    return p * 365 + p / 4 - p / 100 + p / 400 + dt_before_month[m] + (m > 2 && dt_leap(y)) + d;
+}
+
+static void dt_ord2ymd(int32_t n, int32_t *y, int32_t *m, int32_t *d)
+{
+    int32_t n400, n100, n4, n1, before;
+
+    n--;
+    n400 = n / 146097;
+    n %= 146097;
+    n100 = n / 36524;
+    n %= 36524;
+    n4 = n / 1461;
+    n %= 1461;
+    n1 = n / 365;
+    n %= 365;
+    *y = n400 * 400 + n100 * 100 + n4 * 4 + n1 + 1;
+    if (n1 == 4 || n100 == 4) {
+        (*y)--;
+        *m = 12;
+        *d = 31;
+        return;
+    }
+    *m = (n + 50) >> 5;
+    before = dt_before_month[*m] + (*m > 2 && dt_leap(*y));
+    if (before > n) {
+        (*m)--;
+        before -= dt_month_len(*y, *m);
+    }
+    *d = n - before + 1;
+}
+
+// seconds of the day split into h:m:s
+#define DT_HMS(secs, h, mi, s) do { (h) = (secs) / 3600; (mi) = ((secs) / 60) % 60; (s) = (secs) % 60; } while (0)
+
+static int dt_put2(uint8_t *b, int32_t v)
+{
+    b[0] = '0' + (v / 10) % 10;
+    b[1] = '0' + v % 10;
+    return 2;
+}
+
+static int dt_putn(uint8_t *b, int32_t v, int n)
+{
+    int i;
+    for (i = n - 1; i >= 0; i--) {
+        b[i] = '0' + v % 10;
+        v /= 10;
+    }
+    return n;
+}
+
+// +HH:MM of offset seconds, the seconds of the offset are not written
+static int dt_put_offset(uint8_t *b, int32_t off, int colon)
+{
+    int n = 0;
+
+    b[n++] = (off < 0) ? '-' : '+';
+    if (off < 0)
+        off = -off;
+    n += dt_put2(b + n, off / 3600);
+    if (colon)
+        b[n++] = ':';
+    n += dt_put2(b + n, (off / 60) % 60);
+    return n;
+}
+
+static err_t dt_get_ord(PObject *o, int32_t *ord)
+{
+    if (!IS_PSMALLINT(o))
+        return ERR_TYPE_EXC;
+    *ord = PSMALLINT_VALUE(o);
+    if (*ord < 1 || *ord > DT_MAX_ORD)
+        return ERR_VALUE_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: year, month, day, hour, minute, second
+ * returns the ordinal of the date, ValueError if a field is out of range
+ */
+C_NATIVE(_dt_ord) {
+    NATIVE_UNWARN();
+    int32_t y, m, d, h, mi, s;
+
+    if (parse_py_args("iiiiii", nargs, args, &y, &m, &d, &h, &mi, &s) != 6)
+        return ERR_TYPE_EXC;
+    if (y < 1 || y > 9999 || m < 1 || m > 12 || d < 1 || d > dt_month_len(y, m) ||
+        h < 0 || h > 23 || mi < 0 || mi > 59 || s < 0 || s > 59)
+        return ERR_VALUE_EXC;
+    *res = PSMALLINT_NEW(dt_ymd2ord(y, m, d));
+    return ERR_OK;
+}
+
+/*
+ * args: ordinal, seconds
+ * returns (year, month, day, hour, minute, second) of the seconds from midnight of the ordinal day
+ */
+C_NATIVE(_dt_split) {
+    NATIVE_UNWARN();
+    int32_t ord, secs, v[6], i;
+    err_t err;
+    PObject *t;
+
+    if (nargs != 2 || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    if ((err = dt_get_ord(args[0], &ord)) != ERR_OK)
+        return err;
+    secs = PSMALLINT_VALUE(args[1]);
+    if (secs < 0 || secs >= 86400)
+        return ERR_VALUE_EXC;
+    dt_ord2ymd(ord, &v[0], &v[1], &v[2]);
+    DT_HMS(secs, v[3], v[4], v[5]);
+    t = (PObject*)ptuple_new(6, NULL);
+    for (i = 0; i < 6; i++)
+        PTUPLE_SET_ITEM(t, i, PSMALLINT_NEW(v[i]));
+    *res = t;
+    return ERR_OK;
+}
+
+/*
+ * args: ordinal, seconds, delta
+ * adds delta seconds, returns the normalized (ordinal, seconds). OverflowError out of the years 1 to 9999
+ */
+C_NATIVE(_dt_add) {
+    NATIVE_UNWARN();
+    int32_t ord, days;
+    int64_t secs;
+    err_t err;
+    PObject *t;
+
+    if (nargs != 3 || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    if ((err = dt_get_ord(args[0], &ord)) != ERR_OK)
+        return err;
+    if (IS_PSMALLINT(args[2]))
+        secs = PSMALLINT_VALUE(args[2]);
+    else if (PTYPE(args[2]) == PINTEGER)
+        secs = INTEGER_VALUE(args[2]);
+    else
+        return ERR_TYPE_EXC;
+    secs += PSMALLINT_VALUE(args[1]);
+    days = (int32_t)(secs / 86400);
+    secs %= 86400;
+    if (secs < 0) {
+        secs += 86400;
+        days--;
+    }
+    if (days < 1 - ord || days > DT_MAX_ORD - ord)
+        return ERR_OVERFLOW_EXC;
+    t = (PObject*)ptuple_new(2, NULL);
+    PTUPLE_SET_ITEM(t, 0, PSMALLINT_NEW(ord + days));
+    PTUPLE_SET_ITEM(t, 1, PSMALLINT_NEW((int32_t)secs));
+    *res = t;
+    return ERR_OK;
+}
+
+/*
+ * args: ordinal, seconds, sep, offset
+ * returns YYYY-MM-DD<sep>HH:MM:SS, followed by +HH:MM if offset (seconds) is not None
+ */
+C_NATIVE(_dt_isoformat) {
+    NATIVE_UNWARN();
+    uint8_t buf[32], *sep;
+    int32_t ord, secs, y, m, d, h, mi, s, seplen, n = 0;
+    err_t err;
+
+    if (nargs != 4 || !IS_PSMALLINT(args[1]) || (PTYPE(args[2]) != PSTRING) || (args[3] != MAKE_NONE() && !IS_PSMALLINT(args[3])))
+        return ERR_TYPE_EXC;
+    if ((err = dt_get_ord(args[0], &ord)) != ERR_OK)
+        return err;
+    secs = PSMALLINT_VALUE(args[1]);
+    sep = PSEQUENCE_BYTES(args[2]);
+    seplen = PSEQUENCE_ELEMENTS(args[2]);
+    if (secs < 0 || secs >= 86400 || seplen > 8)
+        return ERR_VALUE_EXC;
+    dt_ord2ymd(ord, &y, &m, &d);
+    DT_HMS(secs, h, mi, s);
+    n += dt_putn(buf + n, y, 4);
+    buf[n++] = '-';
+    n += dt_put2(buf + n, m);
+    buf[n++] = '-';
+    n += dt_put2(buf + n, d);
+    memcpy(buf + n, sep, seplen);
+    n += seplen;
+    n += dt_put2(buf + n, h);
+    buf[n++] = ':';
+    n += dt_put2(buf + n, mi);
+    buf[n++] = ':';
+    n += dt_put2(buf + n, s);
+    if (args[3] != MAKE_NONE())
+        n += dt_put_offset(buf + n, PSMALLINT_VALUE(args[3]), 1);
+    *res = (PObject*)pstring_new(n, buf);
+    return ERR_OK;
+}
+
+// parses exactly n digits at *p, advancing it; -1 if they are not digits or the string ends
+static int32_t dt_digits(const uint8_t **p, const uint8_t *end, int n)
+{
+    int32_t v = 0;
+
+    if (end - *p < n)
+        return -1;
+    while (n--) {
+        if (**p < '0' || **p > '9')
+            return -1;
+        v = v * 10 + (*(*p)++ - '0');
+    }
+    return v;
+}
+
+/*
+ * args: s
+ * parses YYYY-MM-DD[*HH[:MM[:SS[.fff[fff]]]]][+HH:MM[:SS[.ffffff]]], * being any separator but '+'.
+ * Returns (ordinal, seconds, offset), offset in seconds or None; fractions of second are dropped
+ */
+C_NATIVE(_dt_fromisoformat) {
+    NATIVE_UNWARN();
+    const uint8_t *p, *end;
+    uint8_t *str;
+    int32_t len, y, m, d, h = 0, mi = 0, s = 0, oh, om, os = 0, sign;
+    PObject *t;
+
+    if (parse_py_args("s", nargs, args, &str, &len) != 1)
+        return ERR_TYPE_EXC;
+    p = str;
+    end = str + len;
+    y = dt_digits(&p, end, 4);
+    if (y < 0 || p == end || *p++ != '-' || (m = dt_digits(&p, end, 2)) < 0 || p == end || *p++ != '-' || (d = dt_digits(&p, end, 2)) < 0)
+        return ERR_VALUE_EXC;
+    if (p < end && *p != '+') {
+        p++;
+        if ((h = dt_digits(&p, end, 2)) < 0)
+            return ERR_VALUE_EXC;
+        if (p < end && *p == ':') {
+            p++;
+            if ((mi = dt_digits(&p, end, 2)) < 0)
+                return ERR_VALUE_EXC;
+            if (p < end && *p == ':') {
+                p++;
+                if ((s = dt_digits(&p, end, 2)) < 0)
+                    return ERR_VALUE_EXC;
+                if (p < end && *p == '.') {
+                    p++;
+                    if (dt_digits(&p, end, 3) < 0)
+                        return ERR_VALUE_EXC;
+                    if (p < end && *p != '+' && *p != '-' && dt_digits(&p, end, 3) < 0)
+                        return ERR_VALUE_EXC;
+                }
+            }
+        }
+    }
+    if (y < 1 || m < 1 || m > 12 || d < 1 || d > dt_month_len(y, m) || h > 23 || mi > 59 || s > 59)
+        return ERR_VALUE_EXC;
+
+    t = (PObject*)ptuple_new(3, NULL);
+    PTUPLE_SET_ITEM(t, 0, PSMALLINT_NEW(dt_ymd2ord(y, m, d)));
+    PTUPLE_SET_ITEM(t, 1, PSMALLINT_NEW(h * 3600 + mi * 60 + s));
+    PTUPLE_SET_ITEM(t, 2, MAKE_NONE());
+    *res = t;
+    if (p == end)
+        return ERR_OK;
+
+    if (*p != '+' && *p != '-')
+        return ERR_VALUE_EXC;
+    sign = (*p++ == '-') ? -1 : 1;
+    if ((oh = dt_digits(&p, end, 2)) < 0 || p == end || *p++ != ':' || (om = dt_digits(&p, end, 2)) < 0)
+        return ERR_VALUE_EXC;
+    if (p < end && *p == ':') {
+        p++;
+        if ((os = dt_digits(&p, end, 2)) < 0)
+            return ERR_VALUE_EXC;
+        if (p < end && *p == '.') {
+            p++;
+            if (dt_digits(&p, end, 6) < 0)
+                return ERR_VALUE_EXC;
+        }
+    }
+    if (p != end || om > 59 || os > 59 || oh > 23)
+        return ERR_VALUE_EXC;
+    PTUPLE_SET_ITEM(t, 2, PSMALLINT_NEW(sign * (oh * 3600 + om * 60 + os)));
+    return ERR_OK;
+}
+
+/*
+ * args: fmt, ordinal, seconds, offset, tzname
+ * formats the datetime as strftime does, with the C locale: %a %A %b %B %d %e %F %H %I %j %m %M %p %S %T %u %w %y %Y %z %Z %%.
+ * %z and %Z are empty if offset (seconds) is None; other directives are copied as they are
+ */
+C_NATIVE(_dt_strftime) {
+    NATIVE_UNWARN();
+    uint8_t *fmt, *out = NULL, buf[16];
+    const uint8_t *src;
+    int32_t flen, ord, secs, y, m, d, h, mi, s, wd, i, n, pass, len = 0;
+    err_t err;
+
+    if (nargs != 5 || (PTYPE(args[0]) != PSTRING) || !IS_PSMALLINT(args[2]) ||
+        (args[3] != MAKE_NONE() && !IS_PSMALLINT(args[3])) || (args[4] != MAKE_NONE() && PTYPE(args[4]) != PSTRING))
+        return ERR_TYPE_EXC;
+    if ((err = dt_get_ord(args[1], &ord)) != ERR_OK)
+        return err;
+    fmt = PSEQUENCE_BYTES(args[0]);
+    flen = PSEQUENCE_ELEMENTS(args[0]);
+    secs = PSMALLINT_VALUE(args[2]);
+    if (secs < 0 || secs >= 86400)
+        return ERR_VALUE_EXC;
+    dt_ord2ymd(ord, &y, &m, &d);
+    DT_HMS(secs, h, mi, s);
+    wd = (ord + 6) % 7;     // 0 is monday
+
+    // measure, then write into the string
+    for (pass = 0; pass < 2; pass++) {
+        len = 0;
+        for (i = 0; i < flen; i++) {
+            src = buf;
+            n = 0;
+            if (fmt[i] != '%' || i == flen - 1) {
+                buf[n++] = fmt[i];
+            } else {
+                switch (fmt[++i]) {
+                    case 'a': src = (const uint8_t*)dt_days + 3 * wd; n = 3; break;
+                    case 'A': src = (const uint8_t*)dt_day_names[wd]; n = strlen((const char*)src); break;
+                    case 'b': src = (const uint8_t*)dt_months + 3 * (m - 1); n = 3; break;
+                    case 'B': src = (const uint8_t*)dt_month_names[m - 1]; n = strlen((const char*)src); break;
+                    case 'd': n = dt_put2(buf, d); break;
+                    case 'e': n = dt_put2(buf, d); if (d < 10) buf[0] = ' '; break;
+                    case 'H': n = dt_put2(buf, h); break;
+                    case 'I': n = dt_put2(buf, (h % 12) ? h % 12 : 12); break;
+                    case 'j': n = dt_putn(buf, ord - dt_ymd2ord(y, 1, 1) + 1, 3); break;
+                    case 'm': n = dt_put2(buf, m); break;
+                    case 'M': n = dt_put2(buf, mi); break;
+                    case 'p': src = (const uint8_t*)((h < 12) ? "AM" : "PM"); n = 2; break;
+                    case 'S': n = dt_put2(buf, s); break;
+                    case 'u': buf[n++] = '1' + wd; break;
+                    case 'w': buf[n++] = '0' + (wd + 1) % 7; break;
+                    case 'y': n = dt_put2(buf, y % 100); break;
+                    case 'Y': n = dt_putn(buf, y, 4); break;
+                    case 'F':
+                        n = dt_putn(buf, y, 4);
+                        buf[n++] = '-';
+                        n += dt_put2(buf + n, m);
+                        buf[n++] = '-';
+                        n += dt_put2(buf + n, d);
+                        break;
+                    case 'T':
+                        n = dt_put2(buf, h);
+                        buf[n++] = ':';
+                        n += dt_put2(buf + n, mi);
+                        buf[n++] = ':';
+                        n += dt_put2(buf + n, s);
+                        break;
+                    case 'z':
+                        if (args[3] != MAKE_NONE())
+                            n = dt_put_offset(buf, PSMALLINT_VALUE(args[3]), 0);
+                        break;
+                    case 'Z':
+                        if (args[4] != MAKE_NONE()) {
+                            src = PSEQUENCE_BYTES(args[4]);
+                            n = PSEQUENCE_ELEMENTS(args[4]);
+                        }
+                        break;
+                    case '%': buf[n++] = '%'; break;
+                    default:
+                        buf[n++] = '%';
+                        buf[n++] = fmt[i];
+                }
+            }
+            if (out)
+                memcpy(out + len, src, n);
+            len += n;
+        }
+        if (!pass) {
+            if (len > 0xffff)
+                return ERR_OVERFLOW_EXC;
+            *res = (PObject*)pstring_new(len, NULL);
+            out = PSEQUENCE_BYTES(*res);
+        }
+    }
+    return ERR_OK;
+}
@@ -0,0 +1,31 @@
+#include "zerynth.h"
+#include "zerynth_drbg.h"
+
+/*
+ * args: n
+ * returns n random bytes
+ */
+C_NATIVE(zdrbg_urandom){
+    NATIVE_UNWARN();
+    int32_t n;
+
+    if (parse_py_args("i", nargs, args, &n) != 1)
+        return ERR_TYPE_EXC;
+    if (n < 0)
+        return ERR_VALUE_EXC;
+    PBytes *bres = pbytes_new(n, NULL);
+    RELEASE_GIL();
+    zdrbg_fill(PSEQUENCE_BYTES(bres), n);
+    ACQUIRE_GIL();
+    *res = bres;
+    return ERR_OK;
+}
+
+C_NATIVE(zdrbg_reseed_now){
+    NATIVE_UNWARN();
+    RELEASE_GIL();
+    zdrbg_reseed();
+    ACQUIRE_GIL();
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
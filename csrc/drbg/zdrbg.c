@@ -0,0 +1,78 @@
+#include "zerynth.h"
+#include "zerynth_drbg.h"
+#include "../../crypto/hash/csrc/cifra/src/drbg.h"
+
+//#define printf(...) vbl_printf_stdout(__VA_ARGS__)
+
+#define ZDRBG_SEED_WORDS 12    /* entropy and nonce of the first seed */
+#define ZDRBG_POOL_WORDS 8     /* entropy of a reseed */
+
+static cf_hash_drbg_sha256 zdrbg;
+static VSemaphore zdrbg_mtx;
+static uint32_t zdrbg_pool[ZDRBG_POOL_WORDS];
+static uint8_t zdrbg_npool;
+static uint8_t zdrbg_seeded;
+
+static void zdrbg_entropy(uint32_t *words, int n){
+    int i;
+    for (i = 0; i < n; i++) {
+        words[i] = vhalRngGenerate();
+    }
+}
+
+/* called with the lock held */
+static void zdrbg_reseed_locked(void){
+    uint32_t seed[ZDRBG_SEED_WORDS];
+
+    if (!zdrbg_seeded) {
+        zdrbg_entropy(seed, ZDRBG_SEED_WORDS);
+        cf_hash_drbg_sha256_init(&zdrbg, seed, ZDRBG_POOL_WORDS*4, seed + ZDRBG_POOL_WORDS,
+            (ZDRBG_SEED_WORDS - ZDRBG_POOL_WORDS)*4, "zerynth", 7);
+        zdrbg_seeded = 1;
+    } else {
+        zdrbg_entropy(seed, ZDRBG_POOL_WORDS);
+        cf_hash_drbg_sha256_reseed(&zdrbg, seed, ZDRBG_POOL_WORDS*4, NULL, 0);
+    }
+    memset(seed, 0, sizeof(seed));
+}
+
+static void zdrbg_lock(void){
+    if (!zdrbg_mtx)
+        zdrbg_mtx = vosMtxCreate();
+    vosMtxLock(zdrbg_mtx);
+}
+
+void zdrbg_fill(uint8_t *out, size_t len){
+    zdrbg_lock();
+    if (!zdrbg_seeded || cf_hash_drbg_sha256_needs_reseed(&zdrbg)) {
+        zdrbg_reseed_locked();
+    } else {
+        //one hardware word per request, a reseed every ZDRBG_POOL_WORDS requests
+        zdrbg_pool[zdrbg_npool++] = vhalRngGenerate();
+        if (zdrbg_npool == ZDRBG_POOL_WORDS) {
+            cf_hash_drbg_sha256_reseed(&zdrbg, zdrbg_pool, sizeof(zdrbg_pool), NULL, 0);
+            memset(zdrbg_pool, 0, sizeof(zdrbg_pool));
+            zdrbg_npool = 0;
+        }
+    }
+    cf_hash_drbg_sha256_gen(&zdrbg, out, len);
+    vosMtxUnlock(zdrbg_mtx);
+}
+
+void zdrbg_reseed(void){
+    zdrbg_lock();
+    zdrbg_reseed_locked();
+    vosMtxUnlock(zdrbg_mtx);
+}
+
+int zdrbg_poll(void *data, unsigned char *output, size_t len, size_t *olen){
+    (void) data;
+    zdrbg_fill(output, len);
+    *olen = len;
+    return 0;
+}
+
+int zdrbg_rng(uint8_t *dest, unsigned size){
+    zdrbg_fill(dest, size);
+    return 1;
+}
@@ -0,0 +1,25 @@
+
+#ifndef ZERYNTH_DRBG_H_
+#define ZERYNTH_DRBG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * System random generator: a Hash_DRBG (SHA-256, from cifra) seeded from the hardware RNG and shared by
+ * mbedTLS, the crypto modules and Python code. The hardware RNG is read at the first request (384 bits) and then
+ * one word per request, reseeding every 256 bits collected: no request waits for more than one hardware word.
+ * Thread safe.
+ */
+
+/* fills out with len random bytes */
+void zdrbg_fill(uint8_t *out, size_t len);
+
+/* reseeds from 256 fresh bits of the hardware RNG, waiting for them */
+void zdrbg_reseed(void);
+
+/* same signature as an mbedTLS entropy source, and as the uECC RNG function (returns 1) */
+int zdrbg_poll(void *data, unsigned char *output, size_t len, size_t *olen);
+int zdrbg_rng(uint8_t *dest, unsigned size);
+
+#endif
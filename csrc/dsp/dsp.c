@@ -0,0 +1,288 @@
+#include "zerynth.h"
+
+/*
+ * Fixed point kernels over buffers of 16 bits samples: a shortarray, or a bytearray read as native order shorts
+ * (the layout of adc captures). Results are written in place, nothing is allocated except the returned values.
+ *
+ * FIR taps are Q15, biquad coefficients Q14, and the FFT works in Q15 scaling by 1/2 at each stage, so its output
+ * is the transform divided by the number of points and cannot overflow. Saturation is applied at every store.
+ * On cores with the DSP extension the dot products use SMLAD, two multiply-accumulates per cycle.
+ * Accumulators have 64 bits.
+ */
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+#define DSP_MAX_FFT_BITS 12
+
+// cos and sin of pi/2^(k+1), to step the twiddle factors of the stage with butterflies 2^(k+1) apart
+static const float dsp_steps[DSP_MAX_FFT_BITS][2] = {
+    {0.000000000f, 1.000000000f},   // pi/2
+    {0.707106781f, 0.707106781f},   // pi/4
+    {0.923879533f, 0.382683432f},   // pi/8
+    {0.980785280f, 0.195090322f},   // pi/16
+    {0.995184727f, 0.098017140f},   // pi/32
+    {0.998795456f, 0.049067674f},   // pi/64
+    {0.999698819f, 0.024541229f},   // pi/128
+    {0.999924702f, 0.012271538f},   // pi/256
+    {0.999981175f, 0.006135885f},   // pi/512
+    {0.999995294f, 0.003067957f},   // pi/1024
+    {0.999998823f, 0.001533980f},   // pi/2048
+    {0.999999706f, 0.000766990f},   // pi/4096
+};
+
+// the samples of a shortarray or bytearray. Returns 0 if obj is neither
+static int dsp_samples(PObject *obj, int16_t **samples, int32_t *n)
+{
+    if (PTYPE(obj) == PSHORTARRAY) {
+        *n = PSEQUENCE_ELEMENTS(obj);
+    } else if (PTYPE(obj) == PBYTEARRAY) {
+        *n = PSEQUENCE_ELEMENTS(obj) / 2;
+    } else {
+        return 0;
+    }
+    *samples = (int16_t*)PSEQUENCE_BYTES(obj);
+    return 1;
+}
+
+static inline int16_t dsp_sat(int32_t v)
+{
+    if (v > 32767)
+        return 32767;
+    if (v < -32768)
+        return -32768;
+    return (int16_t)v;
+}
+
+static inline int16_t dsp_sat64(int64_t v)
+{
+    return dsp_sat((v > 32767) ? 32767 : ((v < -32768) ? -32768 : (int32_t)v));
+}
+
+static int64_t dsp_dot(const int16_t *a, const int16_t *b, int32_t n)
+{
+    int64_t acc = 0;
+    int32_t i = 0;
+
+#if defined(__ARM_FEATURE_DSP)
+    uint32_t pa, pb;
+    for (; i + 1 < n; i += 2) {
+        memcpy(&pa, a + i, 4);
+        memcpy(&pb, b + i, 4);
+        acc = __smlald(pa, pb, acc);
+    }
+#endif
+    for (; i < n; i++)
+        acc += (int32_t)a[i] * b[i];
+    return acc;
+}
+
+static uint32_t dsp_isqrt(uint32_t v)
+{
+    uint32_t r = 0, bit = 1u << 30;
+
+    while (bit > v)
+        bit >>= 2;
+    while (bit) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return r;
+}
+
+/*
+ * args: buf
+ * returns (min, max, mean, rms) of the samples
+ */
+C_NATIVE(_dsp_stats)
+{
+    C_NATIVE_UNWARN();
+    int16_t *x;
+    int32_t n, i, mn = 32767, mx = -32768;
+    int64_t sum = 0;
+    uint64_t sq = 0;
+    PTuple *tpl;
+
+    if (nargs != 1 || !dsp_samples(args[0], &x, &n))
+        return ERR_TYPE_EXC;
+    if (!n)
+        return ERR_VALUE_EXC;
+    for (i = 0; i < n; i++) {
+        int32_t v = x[i];
+        if (v < mn)
+            mn = v;
+        if (v > mx)
+            mx = v;
+        sum += v;
+        sq += (uint64_t)(v * v);
+    }
+    tpl = ptuple_new(4, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(mn));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(mx));
+    PTUPLE_SET_ITEM(tpl, 2, pfloat_new((FLOAT_TYPE)sum / n));
+    PTUPLE_SET_ITEM(tpl, 3, pfloat_new((FLOAT_TYPE)dsp_isqrt((uint32_t)(sq / n))));
+    *res = (PObject*)tpl;
+    return ERR_OK;
+}
+
+/*
+ * args: buf, taps, state
+ * filters buf in place with the Q15 taps. state holds the last len(taps) inputs, newest first, and carries the filter
+ * across calls
+ */
+C_NATIVE(_dsp_fir)
+{
+    C_NATIVE_UNWARN();
+    int16_t *x, *h, *z;
+    int32_t n, nt, nz, i;
+
+    if (nargs != 3 || !dsp_samples(args[0], &x, &n) || !dsp_samples(args[1], &h, &nt) || !dsp_samples(args[2], &z, &nz))
+        return ERR_TYPE_EXC;
+    if (!nt || nz != nt)
+        return ERR_VALUE_EXC;
+    for (i = 0; i < n; i++) {
+        memmove(z + 1, z, (nt - 1) * sizeof(int16_t));
+        z[0] = x[i];
+        x[i] = dsp_sat64(dsp_dot(h, z, nt) >> 15);
+    }
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: buf, coeffs, state
+ * filters buf in place with a cascade of biquads, 5 Q14 coefficients each (b0, b1, b2, a1, a2 of
+ * (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)). state holds x1, x2, y1, y2 of each stage
+ */
+C_NATIVE(_dsp_biquad)
+{
+    C_NATIVE_UNWARN();
+    int16_t *x, *c, *z;
+    int32_t n, nc, nz, i, s;
+    int64_t y;
+
+    if (nargs != 3 || !dsp_samples(args[0], &x, &n) || !dsp_samples(args[1], &c, &nc) || !dsp_samples(args[2], &z, &nz))
+        return ERR_TYPE_EXC;
+    if (!nc || nc % 5 || nz != 4 * (nc / 5))
+        return ERR_VALUE_EXC;
+    for (i = 0; i < n; i++) {
+        y = x[i];
+        for (s = 0; s < nc / 5; s++) {
+            int16_t *k = c + 5 * s, *st = z + 4 * s;
+            int16_t in = (int16_t)y;
+            y = ((int64_t)k[0] * in + (int64_t)k[1] * st[0] + (int64_t)k[2] * st[1] - (int64_t)k[3] * st[2] - (int64_t)k[4] * st[3]) >> 14;
+            y = dsp_sat64(y);
+            st[1] = st[0];
+            st[0] = in;
+            st[3] = st[2];
+            st[2] = y;
+        }
+        x[i] = (int16_t)y;
+    }
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: buf, factor
+ * replaces each group of factor samples with their mean, packed at the start of buf. Returns the number of means
+ */
+C_NATIVE(_dsp_decimate)
+{
+    C_NATIVE_UNWARN();
+    int16_t *x;
+    int32_t n, f, i, j, acc;
+
+    if (nargs != 2 || !dsp_samples(args[0], &x, &n) || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    f = PSMALLINT_VALUE(args[1]);
+    if (f <= 0)
+        return ERR_VALUE_EXC;
+    for (i = 0; i < n / f; i++) {
+        for (acc = 0, j = 0; j < f; j++)
+            acc += x[i * f + j];
+        x[i] = acc / f;
+    }
+    *res = PSMALLINT_NEW(n / f);
+    return ERR_OK;
+}
+
+/*
+ * args: re, im
+ * in place radix-2 FFT of the Q15 complex signal re + j*im, of a power of two length up to 4096.
+ * The result is scaled by 1/len
+ */
+C_NATIVE(_dsp_fft)
+{
+    C_NATIVE_UNWARN();
+    int16_t *xr, *xi, t;
+    int32_t n, ni, bits, i, j, k, half, m;
+
+    if (nargs != 2 || !dsp_samples(args[0], &xr, &n) || !dsp_samples(args[1], &xi, &ni))
+        return ERR_TYPE_EXC;
+    for (bits = 0; (1 << bits) < n; bits++);
+    if (n != ni || n < 2 || n != (1 << bits) || bits > DSP_MAX_FFT_BITS)
+        return ERR_VALUE_EXC;
+
+    // bit reversal
+    for (i = 0, j = 0; i < n; i++) {
+        if (i < j) {
+            t = xr[i]; xr[i] = xr[j]; xr[j] = t;
+            t = xi[i]; xi[i] = xi[j]; xi[j] = t;
+        }
+        for (k = n >> 1; k && (j & k); k >>= 1)
+            j ^= k;
+        j |= k;
+    }
+
+    for (half = 1, m = 0; half < n; half <<= 1, m++) {
+        // twiddle e^(-j*pi*k/half), stepped in float, used in Q15
+        float wr = 1.0f, wi = 0.0f, sr, si, tmp;
+        sr = m ? dsp_steps[m - 1][0] : -1.0f;
+        si = m ? -dsp_steps[m - 1][1] : 0.0f;
+        for (k = 0; k < half; k++) {
+            int32_t qr = (int32_t)(wr * 32767.0f), qi = (int32_t)(wi * 32767.0f);
+            for (i = k; i < n; i += 2 * half) {
+                j = i + half;
+                int32_t tr = (qr * xr[j] - qi * xi[j]) >> 15;
+                int32_t ti = (qr * xi[j] + qi * xr[j]) >> 15;
+                int32_t ar = xr[i], ai = xi[i];
+                xr[j] = (ar - tr) >> 1;
+                xi[j] = (ai - ti) >> 1;
+                xr[i] = (ar + tr) >> 1;
+                xi[i] = (ai + ti) >> 1;
+            }
+            tmp = wr * sr - wi * si;
+            wi = wr * si + wi * sr;
+            wr = tmp;
+        }
+    }
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: re, im, out
+ * stores sqrt(re^2 + im^2) of each point into out, that can be re itself
+ */
+C_NATIVE(_dsp_magnitude)
+{
+    C_NATIVE_UNWARN();
+    int16_t *xr, *xi, *y;
+    int32_t n, ni, ny, i;
+
+    if (nargs != 3 || !dsp_samples(args[0], &xr, &n) || !dsp_samples(args[1], &xi, &ni) || !dsp_samples(args[2], &y, &ny))
+        return ERR_TYPE_EXC;
+    if (ni < n || ny < n)
+        return ERR_INDEX_EXC;
+    for (i = 0; i < n; i++)
+        y[i] = dsp_sat(dsp_isqrt((uint32_t)(xr[i] * xr[i]) + (uint32_t)(xi[i] * xi[i])));
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
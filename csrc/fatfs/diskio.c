@@ -8,8 +8,10 @@
 /*-----------------------------------------------------------------------*/
 
 #include "zerynth.h"
+#include "ff.h"
 #include "diskio.h"		/* FatFs lower layer API */
 #include "spisd.h"
+#include "../ftl/ftl.h"
 #include "vbl.h"
 
 //#define printf(...) vbl_printf_stdout(__VA_ARGS__)
@@ -17,26 +19,75 @@
 /* Definitions of physical drive number for each drive */
 #define SPISD	0	/* Example: Map ATA harddisk to physical drive 0 */
 #define SDIO    1
+#define FTL     2
+
+/* Sectors kept by the cache between FatFs and the drivers (0 disables it) */
+#ifndef DISK_CACHE_SECTORS
+#define DISK_CACHE_SECTORS      8
+#endif
+
+/* Sectors read at once when single sector reads are sequential (must divide DISK_CACHE_SECTORS) */
+#ifndef DISK_CACHE_READAHEAD
+#define DISK_CACHE_READAHEAD    4
+#endif
 
 
 
 PObject *disks_dict = NULL;
+static VMutex disk_mtx;
+
+/* Drive arguments copied from disks_dict (type first, as in the list given */
+/* by fatfs.mount): the disk_* functions run with the GIL released and must */
+/* not touch Python objects.                                                */
+#define DISK_NONE       0xFF
+#define DISK_MAX_ARGS   4
+
+typedef struct _disk_conf {
+    uint32_t nargs;     /* 0 if the drive is not configured */
+    uint32_t args[DISK_MAX_ARGS];
+} DiskConf;
+
+static DiskConf disk_confs[_VOLUMES];
 
 C_NATIVE(__update_disks_dict) {
     NATIVE_UNWARN();
+    uint32_t pdrv, ndrv, i;
+    uint32_t dargs[DISK_MAX_ARGS];
+
+    if (!IS_PSMALLINT(args[0]) || PTYPE(args[1]) != PLIST)
+        return ERR_TYPE_EXC;
+    pdrv = PSMALLINT_VALUE(args[0]);
+    ndrv = PSEQUENCE_ELEMENTS(args[1]);
+    if (pdrv >= _VOLUMES || ndrv < 2 || ndrv > DISK_MAX_ARGS)
+        return ERR_VALUE_EXC;
+    for (i = 0; i < ndrv; i++) {
+        if (!IS_PSMALLINT(PLIST_ITEM(args[1], i)))
+            return ERR_TYPE_EXC;
+        dargs[i] = PSMALLINT_VALUE(PLIST_ITEM(args[1], i));
+    }
+
     if (disks_dict == NULL) {
+        disk_mtx = vosMtxCreate();
         disks_dict = pdict_new(4);
-        pdict_put(disks_dict, args[0], args[1]);
-    }
-    else {
-        pdict_put(disks_dict, args[0], args[1]);
     }
+    pdict_put(disks_dict, args[0], args[1]);
+
+    /* a transfer may be running on another drive */
+    vosMtxLock(disk_mtx);
+    memcpy(disk_confs[pdrv].args, dargs, ndrv * sizeof(uint32_t));
+    disk_confs[pdrv].nargs = ndrv;
+    vosMtxUnlock(disk_mtx);
 
     *res = disks_dict;
 
     return ERR_OK;
 }
 
+static uint32_t disk_type (BYTE pdrv)
+{
+    return (pdrv < _VOLUMES && disk_confs[pdrv].nargs) ? disk_confs[pdrv].args[0] : DISK_NONE;
+}
+
 /*-----------------------------------------------------------------------*/
 /* Get Drive Status                                                      */
 /*-----------------------------------------------------------------------*/
@@ -45,21 +96,22 @@ DSTATUS disk_status (
 	BYTE pdrv		/* Physical drive nmuber to identify the drive */
 )
 {
-    PObject *disk_args = pdict_get(disks_dict, PSMALLINT_NEW(pdrv));
-    uint32_t disk_type = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 0));
+    uint32_t *disk_args = disk_confs[pdrv].args;
 
 
-    switch (disk_type) {
+    switch (disk_type(pdrv)) {
         case SPISD:
             ;
-            uint32_t spi_drv = (PSMALLINT_VALUE(PLIST_ITEM(disk_args, 1)) & 0xff);
+            uint32_t spi_drv = (disk_args[1] & 0xff);
             return spi_disk_status(spi_drv);
 #if defined(VHAL_CUSTOM_SDIO) && VHAL_CUSTOM_SDIO
         case SDIO:
             ;
-            uint32_t sdio_drv = (PSMALLINT_VALUE(PLIST_ITEM(disk_args, 1)) & 0xff);
+            uint32_t sdio_drv = (disk_args[1] & 0xff);
             return sdio_disk_status(sdio_drv);
 #endif
+        case FTL:
+            return ftl_disk_status(disk_args[1]);
     }
     return STA_NOINIT;
 }
@@ -70,21 +122,21 @@ DSTATUS disk_status (
 /* Inidialize a Drive                                                    */
 /*-----------------------------------------------------------------------*/
 
-DSTATUS disk_initialize (
+static
+DSTATUS drv_initialize (
     BYTE pdrv               /* Physical drive nmuber to identify the drive */
 )
 {
-    PObject *disk_args = pdict_get(disks_dict, PSMALLINT_NEW(pdrv));
-    uint32_t disk_type = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 0));
+    uint32_t *disk_args = disk_confs[pdrv].args;
     SpiPins *spipins = ((SpiPins*)_vm_pin_map(PRPH_SPI));
 
-    switch (disk_type) {
+    switch (disk_type(pdrv)) {
         case SPISD:
             ;
-            uint32_t spi_drv = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 1)) & 0xff;
+            uint32_t spi_drv = disk_args[1] & 0xff;
             vhalSpiConf conf;
-            conf.nss = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 2));
-            conf.clock = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 3));
+            conf.nss = disk_args[2];
+            conf.clock = disk_args[3];
             conf.mode = 0;
             conf.bits = 0;
             conf.master = 1;
@@ -96,11 +148,14 @@ DSTATUS disk_initialize (
 #if defined(VHAL_CUSTOM_SDIO) && VHAL_CUSTOM_SDIO
         case SDIO:
             ;
-            uint32_t sdio_drv = (PSMALLINT_VALUE(PLIST_ITEM(disk_args, 1)) & 0xff);
-            uint32_t sdio_bits = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 2));
-            uint32_t sdio_freq = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 3));
+            uint32_t sdio_drv = (disk_args[1] & 0xff);
+            uint32_t sdio_bits = disk_args[2];
+            uint32_t sdio_freq = disk_args[3];
             return sdio_disk_initialize(sdio_drv, sdio_bits, sdio_freq);
 #endif
+        case FTL:
+            /* attached by ftl.Ftl */
+            return ftl_disk_status(disk_args[1]);
     }
 
 	return STA_NOINIT;
@@ -112,7 +167,8 @@ DSTATUS disk_initialize (
 /* Read Sector(s)                                                        */
 /*-----------------------------------------------------------------------*/
 
-DRESULT disk_read (
+static
+DRESULT drv_read (
 	BYTE pdrv,		/* Physical drive nmuber to identify the drive */
 	BYTE *buff,		/* Data buffer to store read data */
 	DWORD sector,	/* Sector address in LBA */
@@ -120,20 +176,21 @@ DRESULT disk_read (
 )
 {
 
-    PObject *disk_args = pdict_get(disks_dict, PSMALLINT_NEW(pdrv));
-    uint32_t disk_type = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 0));
+    uint32_t *disk_args = disk_confs[pdrv].args;
 
-    switch (disk_type) {
+    switch (disk_type(pdrv)) {
         case SPISD:
             ;
-            uint32_t spi_drv = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 1)) & 0xff;
+            uint32_t spi_drv = disk_args[1] & 0xff;
             return spi_disk_read(spi_drv, buff, sector, count);
 #if defined(VHAL_CUSTOM_SDIO) && VHAL_CUSTOM_SDIO
         case SDIO:
             ;
-            uint32_t sdio_drv = (PSMALLINT_VALUE(PLIST_ITEM(disk_args, 1)) & 0xff);
+            uint32_t sdio_drv = (disk_args[1] & 0xff);
             return sdio_disk_read(sdio_drv, buff, sector, count);
 #endif
+        case FTL:
+            return ftl_disk_read(disk_args[1], buff, sector, count);
     }
 
 	return RES_PARERR;
@@ -145,7 +202,8 @@ DRESULT disk_read (
 /* Write Sector(s)                                                       */
 /*-----------------------------------------------------------------------*/
 
-DRESULT disk_write (
+static
+DRESULT drv_write (
 	BYTE pdrv,			/* Physical drive nmuber to identify the drive */
 	const BYTE *buff,	/* Data to be written */
 	DWORD sector,		/* Sector address in LBA */
@@ -153,20 +211,21 @@ DRESULT disk_write (
 )
 {
 
-    PObject *disk_args = pdict_get(disks_dict, PSMALLINT_NEW(pdrv));
-    uint32_t disk_type = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 0));
+    uint32_t *disk_args = disk_confs[pdrv].args;
 
-    switch (disk_type) {
+    switch (disk_type(pdrv)) {
         case SPISD:
             ;
-            uint32_t spi_drv = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 1)) & 0xff;
+            uint32_t spi_drv = disk_args[1] & 0xff;
             return spi_disk_write(spi_drv, buff, sector, count);
 #if defined(VHAL_CUSTOM_SDIO) && VHAL_CUSTOM_SDIO
         case SDIO:
             ;
-            uint32_t sdio_drv = (PSMALLINT_VALUE(PLIST_ITEM(disk_args, 1)) & 0xff);
+            uint32_t sdio_drv = (disk_args[1] & 0xff);
             return sdio_disk_write(sdio_drv, buff, sector, count);
 #endif
+        case FTL:
+            return ftl_disk_write(disk_args[1], buff, sector, count);
     }
 
 	return RES_PARERR;
@@ -178,27 +237,408 @@ DRESULT disk_write (
 /* Miscellaneous Functions                                               */
 /*-----------------------------------------------------------------------*/
 
-DRESULT disk_ioctl (
+static
+DRESULT drv_ioctl (
 	BYTE pdrv,		/* Physical drive nmuber (0..) */
 	BYTE cmd,		/* Control code */
 	void *buff		/* Buffer to send/receive control data */
 )
 {
-    PObject *disk_args = pdict_get(disks_dict, PSMALLINT_NEW(pdrv));
-    uint32_t disk_type = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 0));
+    uint32_t *disk_args = disk_confs[pdrv].args;
+
+    /* only the translation layer uses trims: cards would erase the freed blocks */
+    if (cmd == CTRL_TRIM && disk_type(pdrv) != FTL)
+        return RES_OK;
 
-    switch (disk_type) {
+    switch (disk_type(pdrv)) {
         case SPISD:
             ;
-            uint32_t spi_drv = PSMALLINT_VALUE(PLIST_ITEM(disk_args, 1)) & 0xff;
+            uint32_t spi_drv = disk_args[1] & 0xff;
             return spi_disk_ioctl(spi_drv, cmd, buff);
 #if defined(VHAL_CUSTOM_SDIO) && VHAL_CUSTOM_SDIO
         case SDIO:
             ;
-            uint32_t sdio_drv = (PSMALLINT_VALUE(PLIST_ITEM(disk_args, 1)) & 0xff);
+            uint32_t sdio_drv = (disk_args[1] & 0xff);
             return sdio_disk_ioctl(sdio_drv, cmd, buff);
 #endif
+        case FTL:
+            return ftl_disk_ioctl(disk_args[1], cmd, buff);
     }
 
 	return RES_PARERR;
 }
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Sector cache                                                          */
+/*-----------------------------------------------------------------------*/
+/* FAT and directory sectors are read and written many times by lseek,   */
+/* readdir and file creation: single sector accesses go through a small  */
+/* LRU cache. Writes are kept until CTRL_SYNC (issued by f_sync/f_close) */
+/* or eviction, and then written back in ascending order so that the     */
+/* driver can stream them. Multiple sector transfers (file data) bypass  */
+/* the cache.                                                            */
+
+#if DISK_CACHE_SECTORS
+
+#if DISK_CACHE_SECTORS % DISK_CACHE_READAHEAD
+#error "DISK_CACHE_READAHEAD must divide DISK_CACHE_SECTORS"
+#endif
+
+typedef struct _dcache_line {
+    DWORD sector;
+    uint32_t used;      /* tick of the last access */
+    BYTE pdrv;
+    BYTE valid;
+    BYTE dirty;
+} DCacheLine;
+
+static DCacheLine dc_lines[DISK_CACHE_SECTORS];
+static BYTE dc_data[DISK_CACHE_SECTORS][_MAX_SS];
+static uint32_t dc_tick;
+static BYTE dc_seq_drv = 0xFF;  /* drive and sector following the last single sector read */
+static DWORD dc_seq_next;
+
+static int dc_find (BYTE pdrv, DWORD sector)
+{
+    int i;
+
+    for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+        if (dc_lines[i].valid && dc_lines[i].pdrv == pdrv && dc_lines[i].sector == sector)
+            return i;
+    }
+    return -1;
+}
+
+static DRESULT dc_writeback (int i)
+{
+    DRESULT r = drv_write(dc_lines[i].pdrv, dc_data[i], dc_lines[i].sector, 1);
+
+    if (r == RES_OK)
+        dc_lines[i].dirty = 0;
+    return r;
+}
+
+/* writes back the dirty sectors of pdrv, lowest first */
+static DRESULT dc_flush (BYTE pdrv)
+{
+    int i, m;
+
+    do {
+        m = -1;
+        for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+            if (dc_lines[i].valid && dc_lines[i].dirty && dc_lines[i].pdrv == pdrv && (m < 0 || dc_lines[i].sector < dc_lines[m].sector))
+                m = i;
+        }
+        if (m >= 0 && dc_writeback(m) != RES_OK)
+            return RES_ERROR;
+    } while (m >= 0);
+    return RES_OK;
+}
+
+/* empties the lines [first,first+n): returns 0 if a dirty one can't be written back */
+static int dc_evict (int first, int n)
+{
+    int i;
+
+    for (i = first; i < first + n; i++) {
+        if (dc_lines[i].valid && dc_lines[i].dirty && dc_writeback(i) != RES_OK)
+            return 0;
+        dc_lines[i].valid = 0;
+    }
+    return 1;
+}
+
+/* returns the first of n empty consecutive lines (n is 1 or DISK_CACHE_READAHEAD), the least recently used, or -1 on error */
+static int dc_alloc (int n)
+{
+    int g, i, best = -1;
+    uint32_t age, best_age = 0;
+
+    for (g = 0; g < DISK_CACHE_SECTORS; g += n) {
+        //age of a group is the one of its most recent access, free lines being the oldest
+        age = 0xFFFFFFFF;
+        for (i = g; i < g + n; i++) {
+            if (dc_lines[i].valid && dc_tick - dc_lines[i].used < age)
+                age = dc_tick - dc_lines[i].used;
+        }
+        if (age == 0xFFFFFFFF)
+            return g;
+        if (best < 0 || age > best_age) {
+            best = g;
+            best_age = age;
+        }
+    }
+    return dc_evict(best, n) ? best : -1;
+}
+
+static void dc_fill (int i, BYTE pdrv, DWORD sector, BYTE dirty)
+{
+    dc_lines[i].pdrv = pdrv;
+    dc_lines[i].sector = sector;
+    dc_lines[i].valid = 1;
+    dc_lines[i].dirty = dirty;
+    dc_lines[i].used = ++dc_tick;
+}
+
+#endif
+
+
+static
+DSTATUS dc_initialize (
+    BYTE pdrv               /* Physical drive nmuber to identify the drive */
+)
+{
+#if DISK_CACHE_SECTORS
+    int i;
+
+    /* the card may have been replaced: forget what was cached */
+    for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+        if (dc_lines[i].pdrv == pdrv)
+            dc_lines[i].valid = 0;
+    }
+    if (dc_seq_drv == pdrv)
+        dc_seq_drv = 0xFF;
+#endif
+    return drv_initialize(pdrv);
+}
+
+
+static
+DRESULT dc_read (
+	BYTE pdrv,		/* Physical drive nmuber to identify the drive */
+	BYTE *buff,		/* Data buffer to store read data */
+	DWORD sector,	/* Sector address in LBA */
+	UINT count		/* Number of sectors to read */
+)
+{
+#if DISK_CACHE_SECTORS
+    int i, n;
+    DRESULT r;
+
+    if (count == 1) {
+        i = dc_find(pdrv, sector);
+        if (i < 0) {
+            /* sequential miss: read ahead the following sectors not cached yet */
+            n = 1;
+            if (dc_seq_drv == pdrv && dc_seq_next == sector) {
+                while (n < DISK_CACHE_READAHEAD && dc_find(pdrv, sector + n) < 0) n++;
+                if (n < DISK_CACHE_READAHEAD) n = 1;
+            }
+            i = dc_alloc(n);
+            if (i < 0) return RES_ERROR;
+            r = drv_read(pdrv, dc_data[i], sector, n);
+            if (r != RES_OK && n > 1) {
+                /* the read ahead may cross the end of the disk */
+                n = 1;
+                r = drv_read(pdrv, dc_data[i], sector, n);
+            }
+            if (r != RES_OK) return r;
+            while (n--)
+                dc_fill(i + n, pdrv, sector + n, 0);
+        }
+        dc_lines[i].used = ++dc_tick;
+        dc_seq_drv = pdrv;
+        dc_seq_next = sector + 1;
+        memcpy(buff, dc_data[i], _MAX_SS);
+        return RES_OK;
+    }
+
+    r = drv_read(pdrv, buff, sector, count);
+    if (r == RES_OK) {
+        /* sectors written but not yet flushed are newer than the disk */
+        for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+            if (dc_lines[i].valid && dc_lines[i].dirty && dc_lines[i].pdrv == pdrv && dc_lines[i].sector - sector < count)
+                memcpy(buff + (dc_lines[i].sector - sector) * _MAX_SS, dc_data[i], _MAX_SS);
+        }
+    }
+    return r;
+#else
+    return drv_read(pdrv, buff, sector, count);
+#endif
+}
+
+
+static
+DRESULT dc_write (
+	BYTE pdrv,			/* Physical drive nmuber to identify the drive */
+	const BYTE *buff,	/* Data to be written */
+	DWORD sector,		/* Sector address in LBA */
+	UINT count			/* Number of sectors to write */
+)
+{
+#if DISK_CACHE_SECTORS
+    int i;
+    DRESULT r;
+
+    /* write protected or missing cards report the error now */
+    if (count == 1 && !(disk_status(pdrv) & (STA_NOINIT | STA_PROTECT))) {
+        i = dc_find(pdrv, sector);
+        if (i < 0) {
+            i = dc_alloc(1);
+            if (i < 0) return RES_ERROR;
+        }
+        memcpy(dc_data[i], buff, _MAX_SS);
+        dc_fill(i, pdrv, sector, 1);
+        return RES_OK;
+    }
+
+    r = drv_write(pdrv, buff, sector, count);
+    if (r == RES_OK) {
+        /* cached copies of the sectors written are stale */
+        for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+            if (dc_lines[i].valid && dc_lines[i].pdrv == pdrv && dc_lines[i].sector - sector < count)
+                dc_lines[i].valid = 0;
+        }
+    }
+    return r;
+#else
+    return drv_write(pdrv, buff, sector, count);
+#endif
+}
+
+
+static
+DRESULT dc_ioctl (
+	BYTE pdrv,		/* Physical drive nmuber (0..) */
+	BYTE cmd,		/* Control code */
+	void *buff		/* Buffer to send/receive control data */
+)
+{
+#if DISK_CACHE_SECTORS
+    int i;
+    DWORD *range;
+
+    if (cmd == CTRL_SYNC && dc_flush(pdrv) != RES_OK)
+        return RES_ERROR;
+    if (cmd == CTRL_TRIM) {
+        /* trimmed sectors are free: pending writes to them are not needed anymore */
+        range = (DWORD *)buff;
+        for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+            if (dc_lines[i].valid && dc_lines[i].pdrv == pdrv && dc_lines[i].sector >= range[0] && dc_lines[i].sector <= range[1])
+                dc_lines[i].valid = 0;
+        }
+    }
+#endif
+    return drv_ioctl(pdrv, cmd, buff);
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Locked entry points                                                   */
+/*-----------------------------------------------------------------------*/
+/* FatFs locks each volume, but the drivers and the sector cache are     */
+/* shared by all of them and are called with the GIL released.           */
+
+DSTATUS disk_initialize (
+    BYTE pdrv               /* Physical drive nmuber to identify the drive */
+)
+{
+    DSTATUS st;
+
+    vosMtxLock(disk_mtx);
+    st = dc_initialize(pdrv);
+    vosMtxUnlock(disk_mtx);
+    return st;
+}
+
+DRESULT disk_read (
+	BYTE pdrv,		/* Physical drive nmuber to identify the drive */
+	BYTE *buff,		/* Data buffer to store read data */
+	DWORD sector,	/* Sector address in LBA */
+	UINT count		/* Number of sectors to read */
+)
+{
+    DRESULT r;
+
+    vosMtxLock(disk_mtx);
+    r = dc_read(pdrv, buff, sector, count);
+    vosMtxUnlock(disk_mtx);
+    return r;
+}
+
+DRESULT disk_write (
+	BYTE pdrv,			/* Physical drive nmuber to identify the drive */
+	const BYTE *buff,	/* Data to be written */
+	DWORD sector,		/* Sector address in LBA */
+	UINT count			/* Number of sectors to write */
+)
+{
+    DRESULT r;
+
+    vosMtxLock(disk_mtx);
+    r = dc_write(pdrv, buff, sector, count);
+    vosMtxUnlock(disk_mtx);
+    return r;
+}
+
+DRESULT disk_ioctl (
+	BYTE pdrv,		/* Physical drive nmuber (0..) */
+	BYTE cmd,		/* Control code */
+	void *buff		/* Buffer to send/receive control data */
+)
+{
+    DRESULT r;
+
+    vosMtxLock(disk_mtx);
+    r = dc_ioctl(pdrv, cmd, buff);
+    vosMtxUnlock(disk_mtx);
+    return r;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Raw transfers for fatfs.disk_bench                                    */
+/*-----------------------------------------------------------------------*/
+
+static VSysTimer disk_clock;
+
+/*
+ * args: pdrv, sector, buffer, rewrite
+ * reads the sectors at sector that fit in buffer straight from the driver, without the cache,
+ * or with rewrite writes them back after reading them, so that the content of the disk does not change.
+ * Returns the microseconds of the transfer (only the write, for rewrite), -1 if the driver fails
+ */
+C_NATIVE(__disk_bench) {
+    NATIVE_UNWARN();
+    BYTE pdrv;
+    DWORD sector;
+    UINT count;
+    BYTE *buff;
+    uint32_t t0, dt;
+    DRESULT r;
+
+    if (nargs != 4 || !IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[1]) || PTYPE(args[2]) != PBYTEARRAY)
+        return ERR_TYPE_EXC;
+    pdrv = (BYTE)PSMALLINT_VALUE(args[0]);
+    sector = (DWORD)PSMALLINT_VALUE(args[1]);
+    count = PSEQUENCE_ELEMENTS(args[2]) / _MAX_SS;
+    buff = PSEQUENCE_BYTES(args[2]);
+    if (disk_type(pdrv) == DISK_NONE || !count)
+        return ERR_VALUE_EXC;
+    if (!disk_clock)
+        disk_clock = vosTimerCreate();
+
+    RELEASE_GIL();
+    vosMtxLock(disk_mtx);
+#if DISK_CACHE_SECTORS
+    /* the disk must hold the last version of the sectors */
+    r = dc_flush(pdrv);
+#else
+    r = RES_OK;
+#endif
+    if (r == RES_OK && args[3] == PBOOL_TRUE())
+        r = drv_read(pdrv, buff, sector, count);
+    t0 = vosTimerReadMicros(disk_clock);
+    if (r == RES_OK)
+        r = (args[3] == PBOOL_TRUE()) ? drv_write(pdrv, buff, sector, count) : drv_read(pdrv, buff, sector, count);
+    dt = vosTimerReadMicros(disk_clock) - t0;
+    vosMtxUnlock(disk_mtx);
+    ACQUIRE_GIL();
+
+    *res = PSMALLINT_NEW((r == RES_OK) ? (int32_t)dt : -1);
+    return ERR_OK;
+}
@@ -2,6 +2,8 @@
 #include "zerynth.h"
 #include "ff.h"
 #include "diskio.h"
+#include "../../crypto/hash/csrc/hash_common.h"
+#include "../zsockets/zerynth_sendfile.h"
 
 // #include "vbl.h"
 //
@@ -11,8 +13,14 @@
 FATFS FatFs[_VOLUMES];
 uint32_t mnt_cnt = 0;
 
+/* file and directory slots are handed out by get_available_fd_n under a lock, and FatFs
+   locks the volumes: natives release the GIL around every FatFs call, allocating
+   and touching Python objects only while holding it */
 FIL fil[4];
 DIR dir[4];
+DWORD *clmt[4];     /* cluster link map tables of the files in fast seek mode */
+uint8_t *lbuf[4];   /* sector buffers of readline, allocated at its first call */
+uint16_t lpos[4], llen[4];
 
 #define GET_NAMED_PYPATH(arg,name) \
     uint8_t *__##name = PSEQUENCE_BYTES(arg);  \
@@ -47,8 +55,53 @@ C_NATIVE(__f_mount) {
     return ERR_VALUE_EXC;
 }
 
+C_NATIVE(__f_mkfs) {
+    NATIVE_UNWARN();
+    FRESULT fr;
+    UINT au = PSMALLINT_VALUE(args[1]);
+    BYTE opt = PSMALLINT_VALUE(args[2]) & FM_ANY;
+    GET_PYPATH(args[0]);
+    printf("mkfs %i %s\n",__pathlen,path);
+    RELEASE_GIL();
+    fr = f_mkfs(path, opt | FM_SFD, au);   /* no partition table */
+    ACQUIRE_GIL();
+    if (fr != FR_OK) {
+        *res = PSMALLINT_NEW(-1);
+    }
+    DEL_PYPATH();
+    return ERR_OK;
+}
+
 // File Access
 
+/* back to normal seek mode */
+static void drop_clmt(uint8_t n) {
+    fil[n].cltbl = NULL;
+    if (clmt[n]) {
+        gc_free(clmt[n]);
+        clmt[n] = NULL;
+    }
+}
+
+/* lbuf[n][lpos[n]..llen[n]) is read from the file but not returned by readline yet: the other
+   natives give it back with unread_lbuf before using the file */
+static void drop_lbuf(uint8_t n) {
+    if (lbuf[n]) {
+        gc_free(lbuf[n]);
+        lbuf[n] = NULL;
+    }
+    lpos[n] = llen[n] = 0;
+}
+
+static FRESULT unread_lbuf(uint8_t n) {
+    FRESULT fr = FR_OK;
+    if (lpos[n] < llen[n]) {
+        fr = f_lseek(&fil[n], f_tell(&fil[n]) - (llen[n] - lpos[n]));
+    }
+    lpos[n] = llen[n] = 0;
+    return fr;
+}
+
 C_NATIVE(__f_open) {
     NATIVE_UNWARN();
     FRESULT fr;
@@ -57,7 +110,11 @@ C_NATIVE(__f_open) {
     uint8_t n     = (uint8_t)PSMALLINT_VALUE(args[2]);
     printf("opening file %i %s\n",__pathlen,path);
 
+    drop_clmt(n);
+    drop_lbuf(n);
+    RELEASE_GIL();
     fr = f_open(&fil[n], path, flag);
+    ACQUIRE_GIL();
     if (fr != 0) {
         *res = PSMALLINT_NEW(-1);
     }
@@ -69,7 +126,11 @@ C_NATIVE(__f_close) {
     NATIVE_UNWARN();
     FRESULT fr;
     uint8_t n = (uint8_t)PSMALLINT_VALUE(args[0]);
+    RELEASE_GIL();
     fr = f_close(&fil[n]);
+    ACQUIRE_GIL();
+    drop_clmt(n);
+    drop_lbuf(n);
     if (fr != 0) {
         *res = PSMALLINT_NEW(-1);
     }
@@ -88,7 +149,7 @@ C_NATIVE(__f_tell) {
     NATIVE_UNWARN();
     FRESULT fr;
     uint8_t n = (uint8_t)PSMALLINT_VALUE(args[0]);
-    *res = PSMALLINT_NEW(f_tell(&fil[n]));
+    *res = PSMALLINT_NEW(f_tell(&fil[n]) - (llen[n] - lpos[n]));
     return ERR_OK;
 }
 
@@ -96,16 +157,30 @@ C_NATIVE(__f_read) {
     NATIVE_UNWARN();
     FRESULT fr;          /* FatFs function common result code */
     UINT br;         /* File read/write count */
-    uint16_t to_read = PSMALLINT_VALUE(args[0]);
+    uint32_t to_read = PSMALLINT_VALUE(args[0]);
     uint8_t mode = (uint8_t)PSMALLINT_VALUE(args[1]);
     uint8_t n = (uint8_t)PSMALLINT_VALUE(args[2]);
+    PObject *buffer;
 
-    PObject *buffer = pbytes_new(to_read, NULL);
-    fr = f_read(&fil[n], PSEQUENCE_BYTES(buffer), to_read, &br);
+    if (mode == 1) {
+        buffer = (PObject *)pbytes_new(to_read, NULL);
+    }
+    else {
+        buffer = (PObject *)pstring_new(to_read, NULL);
+    }
+    RELEASE_GIL();
+    fr = unread_lbuf(n);
+    if (fr == FR_OK)
+        fr = f_read(&fil[n], PSEQUENCE_BYTES(buffer), to_read, &br);
+    ACQUIRE_GIL();
     if (fr != 0) {
         *res = PSMALLINT_NEW(-1);
     }
+    else if (br == to_read) {
+        *res = buffer;
+    }
     else {
+        /* short read: copy only at the end of the file */
         if (mode == 1) {
             *res =  (PObject *)pbytes_new(br, PSEQUENCE_BYTES(buffer));
         }
@@ -116,20 +191,213 @@ C_NATIVE(__f_read) {
     return ERR_OK;
 }
 
-// C_NATIVE(__f_readline) {
-//     NATIVE_UNWARN();
-//     BYTE buffer[100];   /* File copy buffer */
-//     FRESULT fr;          /* FatFs function common result code */
-//     UINT br;         /* File read/write count */
-//     int cnt = -1;
-//     uint8_t n = PSMALLINT_VALUE(args[0]);
-//     do {
-//         cnt++;
-//         fr = f_read(&fil[n], &buffer[cnt], 1, &br);
-//     } while (cnt < 99 && br != 0 && buffer[cnt] != '\n');
-//     *res = (PObject *)pstring_new(cnt, buffer);
-//     return ERR_OK;
-// }
+C_NATIVE(__f_readinto) {
+    NATIVE_UNWARN();
+    FRESULT fr;          /* FatFs function common result code */
+    UINT br;         /* File read/write count */
+    PObject *buffer = args[0];
+    int32_t size = PSMALLINT_VALUE(args[1]);
+    int32_t ofs  = PSMALLINT_VALUE(args[2]);
+    uint8_t n    = (uint8_t)PSMALLINT_VALUE(args[3]);
+
+    if (PTYPE(buffer) != PBYTEARRAY)
+        return ERR_TYPE_EXC;
+    if (ofs < 0 || ofs > PSEQUENCE_ELEMENTS(buffer))
+        return ERR_INDEX_EXC;
+    if (size < 0 || size > PSEQUENCE_ELEMENTS(buffer) - ofs)
+        size = PSEQUENCE_ELEMENTS(buffer) - ofs;
+    RELEASE_GIL();
+    fr = unread_lbuf(n);
+    if (fr == FR_OK)
+        fr = f_read(&fil[n], PSEQUENCE_BYTES(buffer) + ofs, size, &br);
+    ACQUIRE_GIL();
+    if (fr != 0) {
+        *res = PSMALLINT_NEW(-1);
+    }
+    else {
+        *res = PSMALLINT_NEW(br);
+    }
+    return ERR_OK;
+}
+
+#define FATFS_HASH_CHUNK 512
+
+/* args: hash common context, hash context, size, n
+   feeds size bytes of file n (up to its end if negative) to the update function of the
+   common context of a crypto.hash object, updating its context in place. Returns the bytes hashed */
+C_NATIVE(__f_hash) {
+    NATIVE_UNWARN();
+    FRESULT fr = 0;
+    UINT br;
+    uint8_t *hash_ctx, *pctx, *chunk;
+    uint32_t hash_ctx_len, ctx_len;
+    int32_t size, n, total = 0;
+
+    if (parse_py_args("ssii", nargs, args, &hash_ctx, &hash_ctx_len, &pctx, &ctx_len, &size, &n) != 4)
+        return ERR_TYPE_EXC;
+    if (hash_ctx_len < sizeof(HashCommonContext) || n < 0 || n >= (int32_t)(sizeof(fil) / sizeof(FIL)))
+        return ERR_VALUE_EXC;
+    HashCommonContext *hcc = (HashCommonContext*)hash_ctx;
+    chunk = gc_malloc(FATFS_HASH_CHUNK);
+    RELEASE_GIL();
+    fr = unread_lbuf(n);
+    while (fr == FR_OK && (size < 0 || total < size)) {
+        UINT want = (size < 0 || size - total > FATFS_HASH_CHUNK) ? FATFS_HASH_CHUNK : (UINT)(size - total);
+        fr = f_read(&fil[n], chunk, want, &br);
+        if (fr != 0 || !br)
+            break;
+        hcc->update_hash(pctx, chunk, br);
+        total += br;
+    }
+    ACQUIRE_GIL();
+    gc_free(chunk);
+    *res = PSMALLINT_NEW((fr != 0) ? -1 : total);
+    return ERR_OK;
+}
+
+/* Buffer of socket.sendfile: a multiple of the sector size, so that aligned chunks are read
+   straight from the disk into it */
+#ifndef FATFS_SEND_CHUNK
+#define FATFS_SEND_CHUNK 2048
+#endif
+
+/* args: sink, offset, count, n
+   writes count bytes of file n (up to its end if negative), from offset (the current position if
+   negative), to the socket sink returned by the py_net_sink native. Returns the bytes sent, -1 on
+   errors of the file and -2 on errors of the socket; the file is left after the last byte sent */
+C_NATIVE(__f_sendfile) {
+    NATIVE_UNWARN();
+    FRESULT fr = 0;
+    UINT br;
+    uint8_t *psink, *chunk;
+    uint32_t sink_len;
+    int32_t offset, count, n, total = 0, w = 0;
+
+    if (parse_py_args("siii", nargs, args, &psink, &sink_len, &offset, &count, &n) != 4)
+        return ERR_TYPE_EXC;
+    if (sink_len < sizeof(ZSockSink) || n < 0 || n >= (int32_t)(sizeof(fil) / sizeof(FIL)))
+        return ERR_VALUE_EXC;
+    ZSockSink *sink = (ZSockSink*)psink;
+    chunk = gc_malloc(FATFS_SEND_CHUNK);
+    RELEASE_GIL();
+    fr = unread_lbuf(n);
+    if (fr == FR_OK && offset >= 0)
+        fr = f_lseek(&fil[n], offset);
+    while (fr == FR_OK && (count < 0 || total < count)) {
+        UINT want = (count < 0 || count - total > FATFS_SEND_CHUNK) ? FATFS_SEND_CHUNK : (UINT)(count - total);
+        fr = f_read(&fil[n], chunk, want, &br);
+        if (fr != 0 || !br)
+            break;
+        w = zsock_sink_write_all(sink, chunk, br);
+        if (w < 0)
+            break;
+        total += br;
+    }
+    ACQUIRE_GIL();
+    gc_free(chunk);
+    *res = PSMALLINT_NEW((fr != 0) ? -1 : ((w < 0) ? -2 : total));
+    return ERR_OK;
+}
+
+/* writer of the sinks of files: n is the file */
+static int fatfs_sink_write(int n, const void *dataptr, size_t size) {
+    UINT bw;
+    if (f_write(&fil[n], dataptr, size, &bw) != FR_OK || !bw)
+        return -1;
+    return bw;
+}
+
+/* args: n
+   returns the sink writing to file n from its current position, as bytes (see zerynth_sendfile.h) */
+C_NATIVE(__f_sink) {
+    NATIVE_UNWARN();
+    FRESULT fr;
+    ZSockSink sink;
+    int32_t n;
+
+    if (parse_py_args("i", nargs, args, &n) != 1)
+        return ERR_TYPE_EXC;
+    if (n < 0 || n >= (int32_t)(sizeof(fil) / sizeof(FIL)))
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    fr = unread_lbuf(n);
+    ACQUIRE_GIL();
+    if (fr != FR_OK)
+        return ERR_IOERROR_EXC;
+    sink.write = fatfs_sink_write;
+    sink.sock = n;
+    *res = (PObject*)pbytes_new(sizeof(ZSockSink), (uint8_t*)&sink);
+    return ERR_OK;
+}
+
+/* args: kind, n
+   returns the next line of file n, up to and including the newline, as a str (kind 0), bytes (1)
+   or bytearray (2); empty at the end of the file. The file is read a sector at a time into lbuf[n]
+   and scanned with memchr: only lines crossing the end of the buffer are copied to a scratch area */
+C_NATIVE(__f_readline) {
+    NATIVE_UNWARN();
+    FRESULT fr = FR_OK;
+    UINT br;
+    uint8_t *acc = NULL, *line, *nl;
+    uint32_t alen = 0, acap = 0, take;
+    uint8_t kind = (uint8_t)PSMALLINT_VALUE(args[0]);
+    uint8_t n    = (uint8_t)PSMALLINT_VALUE(args[1]);
+
+    if (!lbuf[n]) {
+        lbuf[n] = gc_malloc(_MAX_SS);
+        lpos[n] = llen[n] = 0;
+    }
+    for (;;) {
+        nl = memchr(lbuf[n] + lpos[n], '\n', llen[n] - lpos[n]);
+        take = nl ? (uint32_t)(nl - lbuf[n] + 1 - lpos[n]) : (uint32_t)(llen[n] - lpos[n]);
+        if (nl && !acc) {
+            /* the whole line is in the buffer */
+            line = lbuf[n] + lpos[n];
+            lpos[n] += take;
+            alen = take;
+            break;
+        }
+        if (take) {
+            if (alen + take > acap) {
+                acap = (alen + take) * 2;
+                acc = acc ? gc_realloc(acc, acap) : gc_malloc(acap);
+            }
+            memcpy(acc + alen, lbuf[n] + lpos[n], take);
+            alen += take;
+            lpos[n] += take;
+        }
+        if (nl) {
+            line = acc;
+            break;
+        }
+        RELEASE_GIL();
+        fr = f_read(&fil[n], lbuf[n], _MAX_SS, &br);
+        ACQUIRE_GIL();
+        lpos[n] = 0;
+        llen[n] = (fr == FR_OK) ? br : 0;
+        if (fr != FR_OK || !br) {
+            line = acc;
+            break;
+        }
+    }
+    if (fr != FR_OK) {
+        *res = PSMALLINT_NEW(-1);
+    }
+    else if (kind == 0) {
+        *res = (PObject *)pstring_new(alen, line);
+    }
+    else if (kind == 1) {
+        *res = (PObject *)pbytes_new(alen, line);
+    }
+    else {
+        *res = (PObject *)psequence_new(PBYTEARRAY, alen);
+        if (alen)
+            memcpy(PSEQUENCE_BYTES(*res), line, alen);
+    }
+    if (acc)
+        gc_free(acc);
+    return ERR_OK;
+}
 
 C_NATIVE(__f_write) {
     NATIVE_UNWARN();
@@ -138,7 +406,18 @@ C_NATIVE(__f_write) {
     uint32_t len = PSEQUENCE_ELEMENTS(args[0]);
     uint8_t sync = PBOOL_VALUE(args[1]);
     uint8_t n    = (uint8_t)PSMALLINT_VALUE(args[2]);
-    fr = f_write(&fil[n], (BYTE*)PSEQUENCE_BYTES(args[0]), len, &bw);
+    if (fil[n].cltbl && f_tell(&fil[n]) + len > f_size(&fil[n])) {
+        /* files can't grow in fast seek mode */
+        drop_clmt(n);
+    }
+    RELEASE_GIL();
+    fr = unread_lbuf(n);
+    if (fr == 0)
+        fr = f_write(&fil[n], (BYTE*)PSEQUENCE_BYTES(args[0]), len, &bw);
+    if (fr == 0 && sync) {
+        fr = f_sync(&fil[n]);
+    }
+    ACQUIRE_GIL();
     if (fr != 0) {
         *res = PSMALLINT_NEW(-1);
         return ERR_OK;
@@ -146,9 +425,6 @@ C_NATIVE(__f_write) {
     else {
         *res = PSMALLINT_NEW(bw);
     }
-    if (sync) {
-        fr = f_sync(&fil[n]);
-    }
     return ERR_OK;
 }
 
@@ -157,7 +433,10 @@ C_NATIVE(__f_seek) {
     FRESULT fr;          /* FatFs function common result code */
     DWORD pos = PSMALLINT_VALUE(args[0]);
     uint8_t n    = (uint8_t)PSMALLINT_VALUE(args[1]);
+    lpos[n] = llen[n] = 0;
+    RELEASE_GIL();
     fr = f_lseek(&fil[n], pos);
+    ACQUIRE_GIL();
     if (fr != 0) {
         *res = PSMALLINT_NEW(-1);
         return ERR_OK;
@@ -165,11 +444,78 @@ C_NATIVE(__f_seek) {
     return ERR_OK;
 }
 
+C_NATIVE(__f_fastseek) {
+    NATIVE_UNWARN();
+    FRESULT fr;
+    DWORD size = PSMALLINT_VALUE(args[0]);
+    uint8_t n  = (uint8_t)PSMALLINT_VALUE(args[1]);
+
+    drop_clmt(n);
+    RELEASE_GIL();
+    fr = unread_lbuf(n);
+    ACQUIRE_GIL();
+    if (fr != 0) {
+        *res = PSMALLINT_NEW(-1);
+        return ERR_OK;
+    }
+    if (size < 4) size = 4;
+    for (;;) {
+        clmt[n] = gc_malloc(size * sizeof(DWORD));
+        clmt[n][0] = size;
+        fil[n].cltbl = clmt[n];
+        RELEASE_GIL();
+        fr = f_lseek(&fil[n], CREATE_LINKMAP);
+        ACQUIRE_GIL();
+        if (fr != FR_NOT_ENOUGH_CORE || clmt[n][0] <= size)
+            break;
+        /* the table holds the required size: retry once with it */
+        size = clmt[n][0];
+        drop_clmt(n);
+    }
+    if (fr != 0) {
+        drop_clmt(n);
+        *res = PSMALLINT_NEW(-1);
+        return ERR_OK;
+    }
+    /* fragments of the file */
+    *res = PSMALLINT_NEW((clmt[n][0] - 2) / 2);
+    return ERR_OK;
+}
+
+C_NATIVE(__f_expand) {
+    NATIVE_UNWARN();
+    FRESULT fr, fr_c;
+    DWORD size = PSMALLINT_VALUE(args[1]);
+    uint8_t n  = (uint8_t)PSMALLINT_VALUE(args[2]);
+    GET_PYPATH(args[0]);
+    printf("expanding file %i %s\n",__pathlen,path);
+    drop_clmt(n);
+    drop_lbuf(n);
+    RELEASE_GIL();
+    fr = f_open(&fil[n], path, FA_WRITE | FA_CREATE_ALWAYS);
+    if (fr == FR_OK) {
+        fr = f_expand(&fil[n], size, 1);    /* allocate a contiguous block now */
+        fr_c = f_close(&fil[n]);
+        if (fr == FR_OK) fr = fr_c;
+    }
+    ACQUIRE_GIL();
+    if (fr != FR_OK) {
+        *res = PSMALLINT_NEW(-1);
+    }
+    DEL_PYPATH();
+    return ERR_OK;
+}
+
 C_NATIVE(__f_truncate) {
     NATIVE_UNWARN();
     FRESULT fr;          /* FatFs function common result code */
     uint8_t n    = (uint8_t)PSMALLINT_VALUE(args[0]);
-    fr = f_truncate(&fil[n]);
+    drop_clmt(n);
+    RELEASE_GIL();
+    fr = unread_lbuf(n);
+    if (fr == 0)
+        fr = f_truncate(&fil[n]);
+    ACQUIRE_GIL();
     if (fr != 0) {
         *res = PSMALLINT_NEW(-1);
         return ERR_OK;
@@ -181,7 +527,7 @@ C_NATIVE(__f_eof) {
     NATIVE_UNWARN();
     uint8_t n    = (uint8_t)PSMALLINT_VALUE(args[0]);
     int is_eof;
-    is_eof = f_eof(&fil[n]);
+    is_eof = f_eof(&fil[n]) && lpos[n] == llen[n];
     if (is_eof == 0) {
         *res = PBOOL_FALSE();
     }
@@ -203,7 +549,9 @@ C_NATIVE(__f_opendir) {
     memcpy(path,lpath,pathlen);
     path[pathlen]=0;
     printf("opening file %i %s\n",pathlen,path);
+    RELEASE_GIL();
     fr = f_opendir(&dir[n], path);
+    ACQUIRE_GIL();
     if (fr != 0) {
         *res = PSMALLINT_NEW(-1);
     }
@@ -215,7 +563,9 @@ C_NATIVE(__f_closedir) {
     NATIVE_UNWARN();
     FRESULT fr;
     uint8_t n     = (uint8_t)PSMALLINT_VALUE(args[0]);
+    RELEASE_GIL();
     fr = f_closedir(&dir[n]);
+    ACQUIRE_GIL();
     if (fr != 0) {
         *res = PSMALLINT_NEW(-1);
     }
@@ -248,7 +598,9 @@ C_NATIVE(__f_readdir) {
     uint8_t n     = (uint8_t)PSMALLINT_VALUE(args[0]);
     FILINFO fno;
 
+    RELEASE_GIL();
     fr = f_readdir(&dir[n], &fno);                   /* Read a directory item */
+    ACQUIRE_GIL();
     if (fr != FR_OK) {
         *res = PSMALLINT_NEW(-1);
     }
@@ -263,6 +615,63 @@ C_NATIVE(__f_readdir) {
     return ERR_OK;
 }
 
+/* FAT date and time to seconds since 1970-01-01 (FAT times are local: no timezone) */
+static uint32_t fat_mtime(WORD fdate, WORD ftime) {
+    int32_t y = 1980 + (fdate >> 9), m = (fdate >> 5) & 15, d = fdate & 31;
+    int32_t era, yoe, doy, doe;
+
+    if (m < 1 || m > 12 || d < 1) return 0;
+    /* days from civil */
+    y -= (m <= 2);
+    era = y / 400;
+    yoe = y - era * 400;
+    doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return (uint32_t)(era * 146097 + doe - 719468) * 86400 + (ftime >> 11) * 3600 + ((ftime >> 5) & 63) * 60 + (ftime & 31) * 2;
+}
+
+C_NATIVE(__f_scandir) {
+    NATIVE_UNWARN();
+    FRESULT fr;
+    FILINFO fno;
+    PObject *entries, *entry;
+    uint8_t *pat = NULL;
+    uint8_t n     = (uint8_t)PSMALLINT_VALUE(args[0]);
+    int32_t count = PSMALLINT_VALUE(args[1]);
+
+    if (args[2] != MAKE_NONE()) {
+        GET_NAMED_PYPATH(args[2],pattern);
+        pat = pattern;
+    }
+    entries = (PObject *)plist_new(count, NULL);
+    PSEQUENCE_ELEMENTS_SET(entries, 0);
+    while (count-- > 0) {
+        RELEASE_GIL();
+        if (pat) {
+            dir[n].pat = (const TCHAR *)pat;
+            fr = f_findnext(&dir[n], &fno);     /* Read the next matching item */
+        }
+        else {
+            fr = f_readdir(&dir[n], &fno);      /* Read a directory item */
+        }
+        ACQUIRE_GIL();
+        if (fr != FR_OK) {
+            entries = PSMALLINT_NEW(-1);
+            break;
+        }
+        if (fno.fname[0] == 0) break;           /* End of dir */
+        entry = (PObject *)ptuple_new(4, NULL);
+        PTUPLE_SET_ITEM(entry, 0, (PObject *)pstring_new(strlen(fno.fname), fno.fname));
+        PTUPLE_SET_ITEM(entry, 1, (PObject *)pinteger_new(fno.fsize));
+        PTUPLE_SET_ITEM(entry, 2, PSMALLINT_NEW(fno.fattrib));
+        PTUPLE_SET_ITEM(entry, 3, (PObject *)pinteger_new(fat_mtime(fno.fdate, fno.ftime)));
+        plist_append(entries, entry);
+    }
+    if (pat) DEL_NAMED_PYPATH(pat);
+    *res = entries;
+    return ERR_OK;
+}
+
 // File/Directory Management
 
 C_NATIVE(__f_exists) {
@@ -271,7 +680,9 @@ C_NATIVE(__f_exists) {
     FILINFO fno;
     GET_PYPATH(args[0]);
     printf("check exists file %i %s\n",__pathlen,path);
+    RELEASE_GIL();
     fr = f_stat(path, &fno);
+    ACQUIRE_GIL();
     if (fr == FR_OK) {
         *res = PBOOL_TRUE();
     }
@@ -288,7 +699,9 @@ C_NATIVE(__f_isdir) {
     FILINFO fno;
     GET_PYPATH(args[0]);
     printf("isdir %i %s\n",__pathlen,path);
+    RELEASE_GIL();
     fr = f_stat(path, &fno);
+    ACQUIRE_GIL();
     if (fr == FR_OK) {
         if (fno.fattrib & AM_DIR) {
             *res = PBOOL_TRUE();
@@ -304,42 +717,56 @@ C_NATIVE(__f_isdir) {
     return ERR_OK;
 }
 
+/* Buffer of os.copyfile: a multiple of the sector size, so that FatFs reads and writes
+   whole sectors directly from it with multiple block transfers */
+#ifndef COPY_BUFFER_SIZE
+#define COPY_BUFFER_SIZE    4096
+#endif
+
+/* copies the next size bytes at most. Returns the bytes copied in *copied, 0 at the end of src */
+static FRESULT copy_chunk(FIL *src, FIL *dst, BYTE *buffer, UINT size, UINT *copied) {
+    FRESULT fr;
+    UINT bw;
+
+    *copied = 0;
+    fr = f_read(src, buffer, size, copied);     /* Read a chunk of source file */
+    if (fr != FR_OK || *copied == 0) return fr; /* error or eof */
+    fr = f_write(dst, buffer, *copied, &bw);    /* Write it to the destination file */
+    if (fr == FR_OK && bw < *copied) fr = FR_DENIED;    /* disk full */
+    return fr;
+}
+
 C_NATIVE(__f_copy) {
     NATIVE_UNWARN();
     FRESULT fr_1, fr_2;          /* FatFs function common result code */
-    UINT br, bw;         /* File read/write count */
+    UINT br;         /* File read/write count */
     BYTE *buffer;   /* File copy buffer */
-    // uint8_t* src = PSEQUENCE_BYTES(args[0]);
-    // uint8_t* dst = PSEQUENCE_BYTES(args[1]);
     uint32_t n_src = (uint8_t)PSMALLINT_VALUE(args[2]);
     uint32_t n_dst = (uint8_t)PSMALLINT_VALUE(args[3]);
+    drop_clmt(n_src);
+    drop_clmt(n_dst);
+    drop_lbuf(n_src);
+    drop_lbuf(n_dst);
+    buffer = malloc(COPY_BUFFER_SIZE);
+    if (buffer == NULL) {
+        return ERR_VALUE_EXC;
+    }
     GET_NAMED_PYPATH(args[0],src);
     GET_NAMED_PYPATH(args[1],dst);
+    RELEASE_GIL();
     fr_1 = f_open(&fil[n_src], src, FA_READ);
     fr_2 = f_open(&fil[n_dst], dst, FA_WRITE | FA_CREATE_ALWAYS);
-    if (fr_1 != FR_OK || fr_2 != FR_OK) {
-        *res = PSMALLINT_NEW(-1);
-        DEL_NAMED_PYPATH(src);
-        DEL_NAMED_PYPATH(dst);
-        return ERR_OK;
-    }
-    buffer = malloc(128 * sizeof(BYTE));
-    if (buffer == NULL) {
-        DEL_NAMED_PYPATH(src);
-        DEL_NAMED_PYPATH(dst);
-        return ERR_VALUE_EXC;
+    if (fr_1 == FR_OK && fr_2 == FR_OK) {
+        do {
+            fr_1 = copy_chunk(&fil[n_src], &fil[n_dst], buffer, COPY_BUFFER_SIZE, &br);
+        } while (fr_1 == FR_OK && br);
     }
-    for (;;) {
-        fr_1 = f_read(&fil[n_src], buffer, sizeof buffer, &br);  /* Read a chunk of source file */
-        if (fr_1 || br == 0) break; /* error or eof */
-        fr_2 = f_write(&fil[n_dst], buffer, br, &bw);            /* Write it to the destination file */
-        if (fr_2 || bw < br) break; /* error or disk full */
-    }
-    free(buffer);
 
     /* Close open files */
+    if (fr_2 == FR_OK) fr_2 = f_close(&fil[n_dst]);
     f_close(&fil[n_src]);
-    f_close(&fil[n_dst]);
+    ACQUIRE_GIL();
+    free(buffer);
 
     if (fr_1 != FR_OK || fr_2 != FR_OK) {
         *res = PSMALLINT_NEW(-1);
@@ -349,12 +776,35 @@ C_NATIVE(__f_copy) {
     return ERR_OK;
 }
 
+C_NATIVE(__f_copy_chunk) {
+    NATIVE_UNWARN();
+    FRESULT fr;
+    UINT br;
+    PObject *buffer = args[0];
+    uint8_t n_src = (uint8_t)PSMALLINT_VALUE(args[1]);
+    uint8_t n_dst = (uint8_t)PSMALLINT_VALUE(args[2]);
+
+    if (PTYPE(buffer) != PBYTEARRAY)
+        return ERR_TYPE_EXC;
+    RELEASE_GIL();
+    fr = unread_lbuf(n_src);
+    if (fr == FR_OK)
+        fr = unread_lbuf(n_dst);
+    if (fr == FR_OK)
+        fr = copy_chunk(&fil[n_src], &fil[n_dst], PSEQUENCE_BYTES(buffer), PSEQUENCE_ELEMENTS(buffer), &br);
+    ACQUIRE_GIL();
+    *res = PSMALLINT_NEW((fr == FR_OK) ? (int32_t)br : -1);
+    return ERR_OK;
+}
+
 C_NATIVE(__f_unlink) {
     NATIVE_UNWARN();
     FRESULT fr;
     GET_PYPATH(args[0]);
     printf("unlink %i %s\n",__pathlen,path);
+    RELEASE_GIL();
     fr = f_unlink(path);
+    ACQUIRE_GIL();
     if (fr != FR_OK) {
         *res = PSMALLINT_NEW(-1);
     }
@@ -369,7 +819,9 @@ C_NATIVE(__f_rename) {
     // uint8_t *dst_path = PSEQUENCE_BYTES(args[1]);
     GET_NAMED_PYPATH(args[0],src_path);
     GET_NAMED_PYPATH(args[1],dst_path);
+    RELEASE_GIL();
     fr = f_rename(src_path, dst_path);
+    ACQUIRE_GIL();
     if (fr != FR_OK) {
         *res = PSMALLINT_NEW(-1);
     }
@@ -383,7 +835,9 @@ C_NATIVE(__f_mkdir) {
     FRESULT fr;
     GET_PYPATH(args[0]);
     printf("mkdir %i %s\n",__pathlen,path);
+    RELEASE_GIL();
     fr = f_mkdir(path);
+    ACQUIRE_GIL();
     if (fr != FR_OK) {
         *res = PSMALLINT_NEW(-1);
     }
@@ -3898,7 +3898,7 @@ FRESULT f_lseek (
 		if (ofs == CREATE_LINKMAP) {	/* Create CLMT */
 			tbl = fp->cltbl;
 			tlen = *tbl++; ulen = 2;	/* Given table size and required table size */
-			cl = fp->sclust;			/* Top of the chain */
+			cl = fp->obj.sclust;			/* Top of the chain */
 			if (cl) {
 				do {
 					/* Get a fragment */
@@ -3921,8 +3921,8 @@ FRESULT f_lseek (
 				res = FR_NOT_ENOUGH_CORE;	/* Given table size is smaller than required */
 			}
 		} else {						/* Fast seek */
-			if (ofs > fp->fsize) {		/* Clip offset at the file size */
-				ofs = fp->fsize;
+			if (ofs > fp->obj.objsize) {		/* Clip offset at the file size */
+				ofs = fp->obj.objsize;
 			}
 			fp->fptr = ofs;				/* Set file pointer */
 			if (ofs) {
@@ -5053,6 +5053,7 @@ FRESULT f_expand (
 			} else {
 				scl = clst; ncl = 0;		/* Not a free cluster */
 			}
+			if (clst == 2) { scl = 2; ncl = 0; }	/* A block can't wrap around the end of the FAT */
 			if (clst == stcl) { res = FR_DENIED; break; }	/* All cluster scanned? */
 		}
 		if (res == FR_OK) {
@@ -5147,20 +5148,232 @@ FRESULT f_forward (
 /*-----------------------------------------------------------------------*/
 #define N_ROOTDIR	512		/* Number of root directory entries for FAT12/16 */
 #define N_FATS		1		/* Number of FATs (1 or 2) */
+#define MAX_EXFAT	0x7FFFFFFD	/* Maximum number of clusters of exFAT */
+
+
+/* Write a partition table for a single partition of type sys starting at sector 63 */
+static
+FRESULT create_mbr (
+	FATFS* fs,
+	BYTE pdrv,
+	BYTE sys,
+	DWORD b_vol,
+	DWORD n_vol
+)
+{
+	BYTE *tbl;
+	DWORD n;
+
+	mem_set(fs->win, 0, SS(fs));
+	tbl = fs->win + MBR_Table;	/* Create partition table for single partition in the drive */
+	tbl[1] = 1;						/* Partition start head */
+	tbl[2] = 1;						/* Partition start sector */
+	tbl[3] = 0;						/* Partition start cylinder */
+	tbl[4] = sys;					/* System type */
+	tbl[5] = 254;					/* Partition end head */
+	n = (b_vol + n_vol) / 63 / 255;
+	tbl[6] = (BYTE)(n >> 2 | 63);	/* Partition end sector */
+	tbl[7] = (BYTE)n;				/* End cylinder */
+	st_dword(tbl + 8, 63);			/* Partition start in LBA */
+	st_dword(tbl + 12, n_vol);		/* Partition size in LBA */
+	st_word(fs->win + BS_55AA, 0xAA55);	/* MBR signature */
+	return (disk_write(pdrv, fs->win, 0, 1) != RES_OK) ? FR_DISK_ERR : FR_OK;	/* Write it to the MBR */
+}
+
+
+#if _FS_EXFAT
+static
+DWORD xsum32 (	/* Checksum of the boot region and of the up-case table */
+	BYTE dat,
+	DWORD sum
+)
+{
+	return ((sum & 1) ? 0x80000000 : 0) + (sum >> 1) + dat;
+}
+
+
+/* Create an exFAT volume of n_vol sectors at b_vol: boot regions, FAT, allocation bitmap,
+   compressed up-case table and root directory. The bitmap, the up-case table and the root
+   directory take the first clusters, each in a contiguous chain. Data clusters are aligned
+   to the erase block, and fs->win is the only buffer */
+static
+FRESULT mkfs_exfat (
+	FATFS* fs,
+	BYTE pdrv,
+	DWORD b_vol,
+	DWORD n_vol,
+	UINT au				/* Cluster size in sectors, 0: auto */
+)
+{
+	BYTE *buf = fs->win, b;
+	UINT ss = SS(fs), i, j, st;
+	DWORD b_fat, sz_fat, b_data, n_clst, szb_bit, szb_case, sum, sect, nsect, nb, cl, tbl[3], n;
+	WCHAR ch, si;
+
+	if (!au) {					/* Auto selection: 4KB, 32KB from 256MB, 128KB from 32GB */
+		au = 8;
+		if (n_vol >= 0x80000) au = 64;
+		if (n_vol >= 0x4000000) au = 256;
+	}
+	if (au > 32768 * 512 / ss) return FR_MKFS_ABORTED;	/* Up to 32MB */
+
+	b_fat = b_vol + 32;								/* FAT start after the two boot regions */
+	sz_fat = ((n_vol / au + 2) * 4 + ss - 1) / ss;	/* Number of FAT sectors */
+	if (disk_ioctl(pdrv, GET_BLOCK_SIZE, &n) != RES_OK || !n || n > 32768) n = 1;
+	b_data = (b_fat + sz_fat + n - 1) & ~(n - 1);	/* Align data start to the erase block */
+	if (b_data - b_vol >= n_vol / 2) return FR_MKFS_ABORTED;	/* Too small volume */
+	n_clst = (n_vol - (b_data - b_vol)) / au;
+	if (n_clst < 16 || n_clst > MAX_EXFAT) return FR_MKFS_ABORTED;
+
+	szb_bit = (n_clst + 7) / 8;							/* Size of the allocation bitmap [byte] */
+	tbl[0] = (szb_bit + au * ss - 1) / (au * ss);		/* Its clusters */
+
+	/* Compressed up-case table: runs of 128 or more chars without upper case are stored as 0xFFFF, length */
+	sect = b_data + au * tbl[0];
+	sum = 0;
+	st = si = i = j = szb_case = 0;
+	do {
+		switch (st) {
+		case 0:
+			ch = ff_wtoupper(si);
+			if (ch != si) {					/* Has an upper case */
+				si++;
+				break;
+			}
+			for (j = 1; (WCHAR)(si + j) && (WCHAR)(si + j) == ff_wtoupper((WCHAR)(si + j)); j++) ;
+			if (j >= 128) {
+				ch = 0xFFFF;
+				st = 2;
+				break;
+			}
+			st = 1;							/* Short run: stored as it is */
+			/* fall through */
+		case 1:
+			ch = si++;
+			if (--j == 0) st = 0;
+			break;
+		default:
+			ch = (WCHAR)j;					/* Length of the run */
+			si += j;
+			st = 0;
+		}
+		sum = xsum32(buf[i + 0] = (BYTE)ch, sum);
+		sum = xsum32(buf[i + 1] = (BYTE)(ch >> 8), sum);
+		i += 2;
+		szb_case += 2;
+		if (!si || i == ss) {
+			if (disk_write(pdrv, buf, sect++, 1) != RES_OK) return FR_DISK_ERR;
+			i = 0;
+		}
+	} while (si);
+	tbl[1] = (szb_case + au * ss - 1) / (au * ss);	/* Clusters of the up-case table */
+	tbl[2] = 1;										/* Clusters of the root directory */
+
+	/* Allocation bitmap, with the clusters taken above */
+	sect = b_data;
+	nsect = (szb_bit + ss - 1) / ss;
+	nb = tbl[0] + tbl[1] + tbl[2];
+	do {
+		mem_set(buf, 0, ss);
+		for (i = 0; nb >= 8 && i < ss; buf[i++] = 0xFF, nb -= 8) ;
+		for (b = 1; nb && i < ss; buf[i] |= b, b <<= 1, nb--) ;
+		if (disk_write(pdrv, buf, sect++, 1) != RES_OK) return FR_DISK_ERR;
+	} while (--nsect);
+
+	/* FAT: the two reserved entries and a chain for each of the three objects */
+	sect = b_fat;
+	nsect = sz_fat;
+	j = nb = cl = 0;
+	do {
+		mem_set(buf, 0, ss);
+		i = 0;
+		if (cl == 0) {
+			st_dword(buf + i, 0xFFFFFFF8); i += 4; cl++;
+			st_dword(buf + i, 0xFFFFFFFF); i += 4; cl++;
+		}
+		do {
+			while (nb && i < ss) {
+				st_dword(buf + i, (nb > 1) ? cl + 1 : 0xFFFFFFFF);
+				i += 4; cl++; nb--;
+			}
+			if (!nb && j < 3) nb = tbl[j++];
+		} while (nb && i < ss);
+		if (disk_write(pdrv, buf, sect++, 1) != RES_OK) return FR_DISK_ERR;
+	} while (--nsect);
+
+	/* Root directory: volume label, bitmap and up-case table entries */
+	mem_set(buf, 0, ss);
+	buf[SZDIRE * 0 + 0] = 0x83;						/* Empty volume label */
+	buf[SZDIRE * 1 + 0] = 0x81;						/* Bitmap */
+	st_dword(buf + SZDIRE * 1 + 20, 2);
+	st_dword(buf + SZDIRE * 1 + 24, szb_bit);
+	buf[SZDIRE * 2 + 0] = 0x82;						/* Up-case table */
+	st_dword(buf + SZDIRE * 2 + 4, sum);
+	st_dword(buf + SZDIRE * 2 + 20, 2 + tbl[0]);
+	st_dword(buf + SZDIRE * 2 + 24, szb_case);
+	sect = b_data + au * (tbl[0] + tbl[1]);
+	nsect = au;
+	do {
+		if (disk_write(pdrv, buf, sect++, 1) != RES_OK) return FR_DISK_ERR;
+		mem_set(buf, 0, ss);
+	} while (--nsect);
+
+	/* Main and backup boot regions: boot sector, 8 extended boot sectors, OEM and reserved sectors, checksum */
+	sect = b_vol;
+	for (n = 0; n < 2; n++) {
+		mem_set(buf, 0, ss);
+		mem_cpy(buf + BS_jmpBoot, "\xEB\x76\x90" "EXFAT   ", 11);
+		st_dword(buf + BPB_VolOfsEx, b_vol);
+		st_dword(buf + BPB_TotSecEx, n_vol);
+		st_dword(buf + BPB_FatOfsEx, b_fat - b_vol);
+		st_dword(buf + BPB_FatSzEx, sz_fat);
+		st_dword(buf + BPB_DataOfsEx, b_data - b_vol);
+		st_dword(buf + BPB_NumClusEx, n_clst);
+		st_dword(buf + BPB_RootClusEx, 2 + tbl[0] + tbl[1]);
+		st_dword(buf + BPB_VolIDEx, GET_FATTIME());
+		st_word(buf + BPB_FSVerEx, 0x100);
+		for (buf[BPB_BytsPerSecEx] = 0, i = ss; i >>= 1; buf[BPB_BytsPerSecEx]++) ;
+		for (buf[BPB_SecPerClusEx] = 0, i = au; i >>= 1; buf[BPB_SecPerClusEx]++) ;
+		buf[BPB_NumFATsEx] = 1;
+		buf[BPB_DrvNumEx] = 0x80;
+		st_word(buf + 120, 0xFEEB);					/* Boot code: infinite loop */
+		st_word(buf + BS_55AA, 0xAA55);
+		for (i = sum = 0; i < ss; i++) {			/* Volume flags and percent in use are not covered */
+			if (i != BPB_VolFlagEx && i != BPB_VolFlagEx + 1 && i != BPB_PercInUseEx) sum = xsum32(buf[i], sum);
+		}
+		if (disk_write(pdrv, buf, sect++, 1) != RES_OK) return FR_DISK_ERR;
+		mem_set(buf, 0, ss);
+		st_word(buf + ss - 2, 0xAA55);
+		for (j = 1; j < 9; j++) {
+			for (i = 0; i < ss; sum = xsum32(buf[i++], sum)) ;
+			if (disk_write(pdrv, buf, sect++, 1) != RES_OK) return FR_DISK_ERR;
+		}
+		mem_set(buf, 0, ss);
+		for ( ; j < 11; j++) {
+			for (i = 0; i < ss; sum = xsum32(buf[i++], sum)) ;
+			if (disk_write(pdrv, buf, sect++, 1) != RES_OK) return FR_DISK_ERR;
+		}
+		for (i = 0; i < ss; i += 4) st_dword(buf + i, sum);
+		if (disk_write(pdrv, buf, sect++, 1) != RES_OK) return FR_DISK_ERR;
+	}
+
+	return (disk_ioctl(pdrv, CTRL_SYNC, 0) == RES_OK) ? FR_OK : FR_DISK_ERR;
+}
+#endif
 
 
 FRESULT f_mkfs (
 	const TCHAR* path,	/* Logical drive number */
-	BYTE sfd,			/* Partitioning rule 0:FDISK, 1:SFD */
+	BYTE opt,			/* Format options: FM_FAT, FM_FAT32, FM_EXFAT, FM_ANY and FM_SFD (no partition table) */
 	UINT au				/* Size of allocation unit in unit of byte or sector */
 )
 {
 	static const WORD vst[] = { 1024,   512,  256,  128,   64,    32,   16,    8,    4,    2,   0};
 	static const WORD cst[] = {32768, 16384, 8192, 4096, 2048, 16384, 8192, 4096, 2048, 1024, 512};
 	int vol;
-	BYTE fmt, md, sys, *tbl, pdrv, part;
+	BYTE fmt, md, sys, *tbl, pdrv, part, sfd = (opt & FM_SFD) ? 1 : 0;
 	DWORD n_clst, vs, n, wsect;
-	UINT i;
+	UINT i, pau;
 	DWORD b_vol, b_fat, b_dir, b_data;	/* LBA */
 	DWORD n_vol, n_rsv, n_fat, n_dir;	/* Size */
 	FATFS *fs;
@@ -5171,7 +5384,7 @@ FRESULT f_mkfs (
 
 
 	/* Check mounted drive and clear work area */
-	if (sfd > 1) return FR_INVALID_PARAMETER;
+	if (!(opt & FM_ANY)) return FR_INVALID_PARAMETER;
 	vol = get_ldnumber(&path);				/* Get target volume */
 	if (vol < 0) return FR_INVALID_DRIVE;
 	fs = FatFs[vol];						/* Check if the volume has work area */
@@ -5207,6 +5420,24 @@ FRESULT f_mkfs (
 	}
 
 	if (au & (au - 1)) au = 0;
+
+#if _FS_EXFAT
+	/* exFAT if it is the only format allowed, or from 32GB (64M sectors) when FAT32 is allowed too */
+	if ((opt & FM_EXFAT) && (!(opt & (FM_FAT | FM_FAT32)) || n_vol >= 0x4000000)) {
+		if (au >= _MIN_SS) au /= SS(fs);	/* Number of sectors per cluster */
+		if (_MULTI_PARTITION && part) {
+			tbl = &fs->win[MBR_Table + (part - 1) * SZ_PTE];
+			tbl[4] = 0x07;
+			if (disk_write(pdrv, fs->win, 0, 1) != RES_OK) return FR_DISK_ERR;
+		} else if (!sfd) {
+			if (create_mbr(fs, pdrv, 0x07, b_vol, n_vol) != FR_OK) return FR_DISK_ERR;
+		}
+		return mkfs_exfat(fs, pdrv, b_vol, n_vol, au);
+	}
+#endif
+	if (!(opt & (FM_FAT | FM_FAT32))) return FR_MKFS_ABORTED;
+
+	pau = au;						/* Given AU, 0 for auto selection */
 	if (!au) {						/* AU auto selection */
 		vs = n_vol / (2000 / (SS(fs) / 512));
 		for (i = 0; vs < vst[i]; i++) ;
@@ -5215,6 +5446,12 @@ FRESULT f_mkfs (
 	if (au >= _MIN_SS) au /= SS(fs);	/* Number of sectors per cluster */
 	if (!au) au = 1;
 	if (au > 128) au = 128;
+	if (!pau && !(opt & FM_FAT)) {	/* FAT32 only: smaller clusters until there are enough of them */
+		while (au > 1 && n_vol / au < MIN_FAT32 + 0x100) au >>= 1;
+	}
+	if (!pau && !(opt & FM_FAT32)) {	/* FAT12/16 only: larger clusters until there are few enough */
+		while (au < 128 && n_vol / au >= MIN_FAT32 - 0x100) au <<= 1;
+	}
 
 	/* Pre-compute number of clusters and FAT sub-type */
 	n_clst = n_vol / au;
@@ -5255,6 +5492,7 @@ FRESULT f_mkfs (
 		|| (fmt == FS_FAT32 && n_clst < MIN_FAT32)) {
 		return FR_MKFS_ABORTED;
 	}
+	if (!(opt & ((fmt == FS_FAT32) ? FM_FAT32 : FM_FAT))) return FR_MKFS_ABORTED;	/* Sub-type not allowed with this cluster size */
 
 	/* Determine system ID in the partition table */
 	if (fmt == FS_FAT32) {
@@ -5279,20 +5517,7 @@ FRESULT f_mkfs (
 		if (sfd) {	/* No partition table (SFD) */
 			md = 0xF0;
 		} else {	/* Create partition table (FDISK) */
-			mem_set(fs->win, 0, SS(fs));
-			tbl = fs->win + MBR_Table;	/* Create partition table for single partition in the drive */
-			tbl[1] = 1;						/* Partition start head */
-			tbl[2] = 1;						/* Partition start sector */
-			tbl[3] = 0;						/* Partition start cylinder */
-			tbl[4] = sys;					/* System type */
-			tbl[5] = 254;					/* Partition end head */
-			n = (b_vol + n_vol) / 63 / 255;
-			tbl[6] = (BYTE)(n >> 2 | 63);	/* Partition end sector */
-			tbl[7] = (BYTE)n;				/* End cylinder */
-			st_dword(tbl + 8, 63);			/* Partition start in LBA */
-			st_dword(tbl + 12, n_vol);		/* Partition size in LBA */
-			st_word(fs->win + BS_55AA, 0xAA55);	/* MBR signature */
-			if (disk_write(pdrv, fs->win, 0, 1) != RES_OK) {	/* Write it to the MBR */
+			if (create_mbr(fs, pdrv, sys, b_vol, n_vol) != FR_OK) {
 				return FR_DISK_ERR;
 			}
 			md = 0xF8;
@@ -5313,7 +5538,7 @@ FRESULT f_mkfs (
 	if (n_vol < 0x10000) {					/* Number of total sectors */
 		st_word(tbl + BPB_TotSec16, (WORD)n_vol);
 	} else {
-		st_dword(tbl + BPB_TotSec32, (WORD)n_vol);
+		st_dword(tbl + BPB_TotSec32, n_vol);
 	}
 	tbl[BPB_Media] = md;					/* Media descriptor */
 	st_word(tbl + BPB_SecPerTrk, 63);		/* Number of sectors per track */
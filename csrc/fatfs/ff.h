@@ -269,7 +269,7 @@ FRESULT f_setlabel (const TCHAR* label);							/* Set volume label */
 FRESULT f_forward (FIL* fp, UINT(*func)(const BYTE*,UINT), UINT btf, UINT* bf);	/* Forward data to the stream */
 FRESULT f_expand (FIL* fp, FSIZE_t szf, BYTE opt);					/* Allocate a contiguous block to the file */
 FRESULT f_mount (FATFS* fs, const TCHAR* path, BYTE opt);			/* Mount/Unmount a logical drive */
-FRESULT f_mkfs (const TCHAR* path, BYTE sfd, UINT au);				/* Create a file system on the volume */
+FRESULT f_mkfs (const TCHAR* path, BYTE opt, UINT au);				/* Create a file system on the volume */
 FRESULT f_fdisk (BYTE pdrv, const DWORD szt[], void* work);			/* Divide a physical drive into some partitions */
 int f_putc (TCHAR c, FIL* fp);										/* Put a character to the file */
 int f_puts (const TCHAR* str, FIL* cp);								/* Put a string to the file */
@@ -335,6 +335,15 @@ int ff_del_syncobj (_SYNC_t sobj);				/* Delete a sync object */
 #define _FA_DIRTY			0x40
 
 
+/* Format options (f_mkfs) */
+
+#define FM_FAT		0x01	/* FAT12/16 */
+#define FM_FAT32	0x02
+#define FM_EXFAT	0x04
+#define FM_ANY		0x07	/* Any of them, from the size of the volume */
+#define FM_SFD		0x08	/* No partition table */
+
+
 /* FAT sub type (FATFS.fs_type) */
 
 #define FS_FAT12	1
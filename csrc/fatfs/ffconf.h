@@ -34,7 +34,7 @@
 /  2: Enable with LF-CRLF conversion. */
 
 
-#define _USE_FIND       0
+#define _USE_FIND       1
 /* This option switches filtered directory read functions, f_findfirst() and
 /  f_findnext(). (0:Disable, 1:Enable 2:Enable with matching altname[] too) */
 
@@ -43,11 +43,11 @@
 /* This option switches f_mkfs() function. (0:Disable or 1:Enable) */
 
 
-#define _USE_FASTSEEK   0
+#define _USE_FASTSEEK   1
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
-#define _USE_EXPAND     0
+#define _USE_EXPAND     1
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
 
@@ -99,6 +99,15 @@
 */
 
 
+#define _CC_TINY_TABLE  0
+/* This option selects the conversion tables of the DBCS code pages (932, 936, 949
+/  and 950), used with LFN enabled.
+/
+/   0: Unicode to OEM code and OEM code to Unicode tables. (47K-73K bytes)
+/   1: Unicode to OEM code table only. (33K-45K bytes) OEM codes are converted
+/      by searching it, with the last 16 results cached. */
+
+
 #define _USE_LFN    3
 #define _MAX_LFN    255
 /* The _USE_LFN switches the support of long file name (LFN).
@@ -180,7 +189,7 @@
 /  disk_ioctl() function. */
 
 
-#define _USE_TRIM   0
+#define _USE_TRIM   1
 /* This option switches support of ATA-TRIM. (0:Disable or 1:Enable)
 /  To enable Trim function, also CTRL_TRIM command should be implemented to the
 /  disk_ioctl() function. */
@@ -210,7 +219,7 @@
 /  buffer in the file system object (FATFS) is used for the file data transfer. */
 
 
-#define _FS_EXFAT   0
+#define _FS_EXFAT   1
 /* This option switches support of exFAT file system in addition to the traditional
 /  FAT file system. (0:Disable or 1:Enable) To enable exFAT, also LFN must be enabled.
 /  Note that enabling exFAT discards C89 compatibility. */
@@ -242,9 +251,10 @@
 /      lock control is independent of re-entrancy. */
 
 
-#define _FS_REENTRANT   0
+#include "vosal.h"
+#define _FS_REENTRANT   1
 #define _FS_TIMEOUT     1000
-#define _SYNC_t         HANDLE
+#define _SYNC_t         VMutex
 /* The option _FS_REENTRANT switches the re-entrancy (thread safe) of the FatFs
 /  module itself. Note that regardless of this option, file access to different
 /  volume is always re-entrant and volume control functions, f_mount(), f_mkfs()
@@ -1,5 +1,6 @@
 #include "zerynth.h"
 #include "diskio.h"
+#include "spisd.h"
 #include "vbl.h"
 
 
@@ -14,6 +15,7 @@
 /* MMC/SD command */
 #define CMD0	(0)			/* GO_IDLE_STATE */
 #define CMD1	(1)			/* SEND_OP_COND (MMC) */
+#define CMD6	(6)			/* SWITCH_FUNC (SDC) */
 #define	ACMD41	(0x80+41)	/* SEND_OP_COND (SDC) */
 #define CMD8	(8)			/* SEND_IF_COND */
 #define CMD9	(9)			/* SEND_CSD */
@@ -32,6 +34,7 @@
 #define CMD38	(38)		/* ERASE */
 #define CMD55	(55)		/* APP_CMD */
 #define CMD58	(58)		/* READ_OCR */
+#define CMD59	(59)		/* CRC_ON_OFF */
 
 
 // static volatile
@@ -79,6 +82,8 @@ static vhalSpiConf spi_conf;
 static uint32_t fast_clock;
 static uint32_t slow_clock = 400000;
 
+#define SD_DEFAULT_SPEED	25000000	/* Max clock before CMD6 high-speed mode */
+
 
 /* Initialize MMC interface */
 static
@@ -126,13 +131,102 @@ BYTE xchg_spi (
 
 
 /* Receive multiple byte */
+#define RCVR_CHUNK 128
+static BYTE rcvr_ones[RCVR_CHUNK];
+
 static
 void rcvr_spi_multi (
 	BYTE *buff,		/* Pointer to data buffer */
 	UINT btr		/* Number of bytes to receive (even number) */
 )
 {
-	vhalSpiExchange(spi_drv, NULL, buff, btr);
+	UINT n;
+
+	/* MOSI must stay high while receiving: during a multiple block read the card
+	   watches it for CMD12, and a NULL tx buffer leaves its content to the driver */
+	if (rcvr_ones[0] != 0xFF) memset(rcvr_ones, 0xFF, RCVR_CHUNK);
+	while (btr) {
+		n = (btr > RCVR_CHUNK) ? RCVR_CHUNK : btr;
+		vhalSpiExchange(spi_drv, rcvr_ones, buff, n);
+		buff += n;
+		btr -= n;
+	}
+}
+
+
+#if SPISD_CRC
+/* CRC-16/XMODEM of the data blocks, CRC7 of the commands */
+WORD (*spisd_crc16_hw)(const BYTE *buff, UINT len);
+
+static BYTE CrcOn;		/* 1: the card checks and sends CRCs (CMD59) */
+
+static const WORD crc16_table[256] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+	0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+	0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+	0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+	0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+	0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+	0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+	0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+	0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+	0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+	0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+	0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+	0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+	0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+	0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+	0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+	0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+	0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+	0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+	0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+	0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+	0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+	0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+	0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+	0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+	0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+	0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+	0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+	0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+	0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+	0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+
+static
+WORD crc16 (
+	const BYTE *buff,
+	UINT len
+)
+{
+	WORD crc = 0;
+
+	if (spisd_crc16_hw) return spisd_crc16_hw(buff, len);
+	while (len--) crc = (crc << 8) ^ crc16_table[(crc >> 8) ^ *buff++];
+	return crc;
+}
+#endif
+
+static
+BYTE crc7 (
+	const BYTE *buff,
+	UINT len
+)
+{
+	BYTE crc = 0, d;
+	UINT i;
+
+	while (len--) {
+		d = *buff++;
+		for (i = 0; i < 8; i++) {
+			crc <<= 1;
+			if ((d ^ crc) & 0x80) crc ^= 0x09;
+			d <<= 1;
+		}
+	}
+	return crc & 0x7F;
 }
 
 
@@ -214,6 +308,7 @@ int rcvr_datablock (	/* 1:OK, 0:Error */
 )
 {
 	BYTE token;
+	WORD crc;
 
 
 	Timer1_eq(200);
@@ -224,7 +319,13 @@ int rcvr_datablock (	/* 1:OK, 0:Error */
 	if(token != 0xFE) return 0;		/* Function fails if invalid DataStart token or timeout */
 
 	rcvr_spi_multi(buff, btr);		/* Store trailing data to the buffer */
-	xchg_spi(0xFF); xchg_spi(0xFF);			/* Discard CRC */
+	crc = (WORD)xchg_spi(0xFF) << 8;
+	crc |= xchg_spi(0xFF);
+#if SPISD_CRC
+	if (CrcOn && crc != crc16(buff, btr)) return 0;	/* Corrupted: read again */
+#else
+	(void)crc;		/* Discard CRC */
+#endif
 
 	return 1;						/* Function succeeded */
 }
@@ -243,6 +344,7 @@ int xmit_datablock (	/* 1:OK, 0:Failed */
 )
 {
 	BYTE resp;
+	WORD crc = 0xFFFF;
 
 
 	if (!wait_ready(500)) return 0;		/* Wait for card ready */
@@ -250,7 +352,10 @@ int xmit_datablock (	/* 1:OK, 0:Failed */
 	xchg_spi(token);					/* Send token */
 	if (token != 0xFD) {				/* Send data if token is other than StopTran */
 		xmit_spi_multi(buff, 512);		/* Data */
-		xchg_spi(0xFF); xchg_spi(0xFF);	/* Dummy CRC */
+#if SPISD_CRC
+		if (CrcOn) crc = crc16(buff, 512);
+#endif
+		xchg_spi(crc >> 8); xchg_spi(crc);	/* CRC (dummy without CMD59) */
 
 		resp = xchg_spi(0xFF);				/* Receive data resp */
 		if ((resp & 0x1F) != 0x05)		/* Function fails if the data packet was not accepted */
@@ -271,7 +376,7 @@ BYTE send_cmd (		/* Return value: R1 resp (bit7==1:Failed to send) */
 	DWORD arg		/* Argument */
 )
 {
-	BYTE n, res;
+	BYTE n, res, pkt[5];
 
 
 	if (cmd & 0x80) {	/* Send a CMD55 prior to ACMD<n> */
@@ -287,15 +392,13 @@ BYTE send_cmd (		/* Return value: R1 resp (bit7==1:Failed to send) */
 	}
 
 	/* Send command packet */
-	xchg_spi(0x40 | cmd);				/* Start + command index */
-	xchg_spi((BYTE)(arg >> 24));		/* Argument[31..24] */
-	xchg_spi((BYTE)(arg >> 16));		/* Argument[23..16] */
-	xchg_spi((BYTE)(arg >> 8));			/* Argument[15..8] */
-	xchg_spi((BYTE)arg);				/* Argument[7..0] */
-	n = 0x01;							/* Dummy CRC + Stop */
-	if (cmd == CMD0) n = 0x95;			/* Valid CRC for CMD0(0) */
-	if (cmd == CMD8) n = 0x87;			/* Valid CRC for CMD8(0x1AA) */
-	xchg_spi(n);
+	pkt[0] = 0x40 | cmd;				/* Start + command index */
+	pkt[1] = (BYTE)(arg >> 24);			/* Argument[31..24] */
+	pkt[2] = (BYTE)(arg >> 16);			/* Argument[23..16] */
+	pkt[3] = (BYTE)(arg >> 8);			/* Argument[15..8] */
+	pkt[4] = (BYTE)arg;					/* Argument[7..0] */
+	for (n = 0; n < 5; n++) xchg_spi(pkt[n]);
+	xchg_spi((crc7(pkt, 5) << 1) | 1);	/* CRC + Stop: checked by the card in SD mode, CMD0, CMD8 and after CMD59 */
 
 	/* Receive command resp */
 	if (cmd == CMD12) xchg_spi(0xFF);	/* Diacard following one byte when CMD12 */
@@ -308,6 +411,86 @@ BYTE send_cmd (		/* Return value: R1 resp (bit7==1:Failed to send) */
 }
 
 
+#if _USE_WRITE
+/* A multiple block write is left open between calls, so that writes of consecutive
+   sectors (e.g. a log file growing cluster after cluster) stream into a single CMD25
+   instead of waiting for the card to program and close every chunk. Any other access
+   to the card, CTRL_SYNC included, stops the stream first. */
+static BYTE wr_open;		/* 1: CMD25 in progress */
+static DWORD wr_next;		/* Address of the next block of the open CMD25 */
+
+static
+int stop_stream (void)	/* 1:OK, 0:Failed */
+{
+	int ok;
+
+	if (!wr_open) return 1;
+	wr_open = 0;
+	ok = select() && xmit_datablock(0, 0xFD);	/* STOP_TRAN token */
+	deselect();
+	return ok;
+}
+#endif
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Raise the clock after initialization                                  */
+/*-----------------------------------------------------------------------*/
+
+/* Moves from the slow clock to the fastest one allowed by both the card (its CSD,
+   after switching to high-speed mode with CMD6 if asked more than 25MHz) and the
+   requested clock. Each step is checked by reading the CSD back: the clock is
+   halved until it reads the same as at the slow clock. */
+static
+void ramp_clock (void)
+{
+	static const BYTE tran_value[16] = {0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80};
+	static const DWORD tran_unit[4] = {10000, 100000, 1000000, 10000000};
+	BYTE csd[16], chk[16], sts[64];
+	DWORD max, clk;
+
+	if (send_cmd(CMD9, 0) != 0 || !rcvr_datablock(csd, 16)) {	/* Reference CSD */
+		deselect();
+		FCLK_FAST();
+		return;
+	}
+	deselect();
+
+	/* High-speed mode: CMD6 switch of function group 1 to function 1, if the card has
+	   command class 10 (CCC bit 10) and reports the function as supported */
+	if (fast_clock > SD_DEFAULT_SPEED && (CardType & CT_SD2) && (csd[4] & 0x40)) {
+		if (send_cmd(CMD6, 0x00FFFFF1) == 0 && rcvr_datablock(sts, 64) && (sts[13] & 0x02)) {
+			deselect();
+			if (send_cmd(CMD6, 0x80FFFFF1) == 0 && rcvr_datablock(sts, 64) && (sts[16] & 0x0F) == 1) {
+				deselect();
+				/* TRAN_SPEED now reads 50MHz */
+				if (send_cmd(CMD9, 0) != 0 || !rcvr_datablock(csd, 16)) {
+					deselect();
+					FCLK_FAST();
+					return;
+				}
+			}
+		}
+		deselect();
+	}
+
+	max = ((csd[3] & 7) < 4) ? tran_value[(csd[3] >> 3) & 15] * tran_unit[csd[3] & 7] : 0;
+	if (!max || max > fast_clock) max = fast_clock;
+	for (clk = max; clk > slow_clock; clk /= 2) {
+		fast_clock = clk;
+		FCLK_FAST();
+		if (send_cmd(CMD9, 0) == 0 && rcvr_datablock(chk, 16) && !memcmp(chk, csd, 16)) break;
+		deselect();
+	}
+	deselect();
+	if (clk <= slow_clock) {
+		fast_clock = slow_clock;
+		FCLK_FAST();
+	}
+}
+
+
 
 /*--------------------------------------------------------------------------
 
@@ -330,6 +513,9 @@ DSTATUS spi_disk_initialize (
 
 	// if (drv) return STA_NOINIT;			/* Supports only drive 0 */
 	init_spi(spi, conf);							/* Initialize SPI */
+#if _USE_WRITE
+	wr_open = 0;
+#endif
 
 	// if (Stat & STA_NODISK) return Stat;	/* Is card existing in the soket? */
 	// FCLK_SLOW();
@@ -359,10 +545,13 @@ DSTATUS spi_disk_initialize (
 		}
 	}
 	CardType = ty;	/* Card type */
+#if SPISD_CRC
+	CrcOn = ty && send_cmd(CMD59, 1) == 0;	/* CRC checks on both sides */
+#endif
 	deselect();
 
 	if (ty) {			/* OK */
-		FCLK_FAST();			/* Set fast clock */
+		ramp_clock();			/* Set fast clock */
 		Stat &= ~STA_NOINIT;	/* Clear STA_NOINIT flag */
         for (n = 10; n; n--) xchg_spi(0xFF);
 	} else {			/* Failed */
@@ -415,6 +604,9 @@ DRESULT spi_disk_read (
 {
 	if (!count) return RES_PARERR;		/* Check parameter */
 	if (Stat & STA_NOINIT) return RES_NOTRDY;	/* Check if drive is ready */
+#if _USE_WRITE
+	if (!stop_stream()) return RES_ERROR;	/* Finish the open multiple block write */
+#endif
 
 	if (!(CardType & CT_BLOCK)) sector *= 512;	/* LBA ot BA conversion (byte addressing cards) */
 
@@ -425,20 +617,22 @@ DRESULT spi_disk_read (
         count = spi_single_read(spi, buff, sector);
 	}
 	else {				/* Multiple sector read */
-		// if (send_cmd(CMD18, sector) == 0) {	/* READ_MULTIPLE_BLOCK */ NOT WORKING!!!
-		// 	do {
-		// 		if (!rcvr_datablock(buff, 512)) break;
-		// 		buff += 512;
-		// 	} while (--count);
-		// 	send_cmd(CMD12, 0);				/* STOP_TRANSMISSION */
-		// }
-        UINT i = 0;
-        DWORD sector_step = 1;
-        if (!(CardType & CT_BLOCK)) sector_step = 512;
-        for (i = 0; i < count; i++) {
-            spi_single_read(spi, &buff[512*i], sector + sector_step*i);
-        }
-        count = 0;
+		DWORD sector_step = (CardType & CT_BLOCK) ? 1 : 512;
+		if (send_cmd(CMD18, sector) == 0) {	/* READ_MULTIPLE_BLOCK */
+			do {
+				if (!rcvr_datablock(buff, 512)) break;
+				buff += 512;
+				sector += sector_step;
+			} while (--count);
+			send_cmd(CMD12, 0);				/* STOP_TRANSMISSION */
+			wait_ready(500);				/* R1b: wait for the end of busy */
+		}
+		/* sectors not read in the stream are retried one at a time */
+		while (count && spi_single_read(spi, buff, sector) == 0) {
+			buff += 512;
+			sector += sector_step;
+			count--;
+		}
 	}
 	deselect();
 
@@ -459,27 +653,30 @@ DRESULT spi_disk_write (
 	UINT count			/* Number of sectors to write (1..128) */
 )
 {
+	DWORD sector_step = (CardType & CT_BLOCK) ? 1 : 512;
+
 	if (!count) return RES_PARERR;		/* Check parameter */
 	if (Stat & STA_NOINIT) return RES_NOTRDY;	/* Check drive status */
 	if (Stat & STA_PROTECT) return RES_WRPRT;	/* Check write protect */
 
 	if (!(CardType & CT_BLOCK)) sector *= 512;	/* LBA ==> BA conversion (byte addressing cards) */
 
-	if (count == 1) {	/* Single sector write */
-		if ((send_cmd(CMD24, sector) == 0)	/* WRITE_BLOCK */
-			&& xmit_datablock(buff, 0xFE))
-			count = 0;
-	}
-	else {				/* Multiple sector write */
+	if (wr_open && sector == wr_next) {	/* Continue the open stream */
+		if (!select()) wr_open = 0;
+	} else if (stop_stream()) {
+		/* Pre-erase only the sectors of this call: the content of pre-erased but not
+		   written blocks is undefined, and the next call may not follow them */
 		if (CardType & CT_SDC) send_cmd(ACMD23, count);	/* Predefine number of sectors */
-		if (send_cmd(CMD25, sector) == 0) {	/* WRITE_MULTIPLE_BLOCK */
-			do {
-				if (!xmit_datablock(buff, 0xFC)) break;
-				buff += 512;
-			} while (--count);
-			if (!xmit_datablock(0, 0xFD))	/* STOP_TRAN token */
-				count = 1;
-		}
+		if (send_cmd(CMD25, sector) == 0) wr_open = 1;	/* WRITE_MULTIPLE_BLOCK */
+	}
+	if (wr_open) {
+		do {
+			if (!xmit_datablock(buff, 0xFC)) break;
+			buff += 512;
+			sector += sector_step;
+		} while (--count);
+		wr_next = sector;
+		if (count) stop_stream();		/* Data rejected: leave streaming mode */
 	}
 	deselect();
 
@@ -500,7 +697,7 @@ DRESULT spi_disk_ioctl (
 )
 {
 	DRESULT res;
-	BYTE n, csd[16];
+	BYTE n, csd[16], sds[64];
 	DWORD *dp, st, ed, csize;
 
 
@@ -508,6 +705,9 @@ DRESULT spi_disk_ioctl (
 	if (Stat & STA_NOINIT) return RES_NOTRDY;	/* Check if drive is ready */
 
 	res = RES_ERROR;
+#if _USE_WRITE
+	if (!stop_stream()) return RES_ERROR;	/* Finish the open multiple block write */
+#endif
 
 	switch (cmd) {
 	case CTRL_SYNC :		/* Wait for end of internal write process of the drive */
@@ -532,9 +732,8 @@ DRESULT spi_disk_ioctl (
 		if (CardType & CT_SD2) {	/* SDC ver 2.00 */
 			if (send_cmd(ACMD13, 0) == 0) {	/* Read SD status */
 				xchg_spi(0xFF);
-				if (rcvr_datablock(csd, 16)) {				/* Read partial block */
-					for (n = 64 - 16; n; n--) xchg_spi(0xFF);	/* Purge trailing data */
-					*(DWORD*)buff = 16UL << (csd[10] >> 4);
+				if (rcvr_datablock(sds, 64)) {				/* Whole block, for its CRC */
+					*(DWORD*)buff = 16UL << (sds[10] >> 4);
 					res = RES_OK;
 				}
 			}
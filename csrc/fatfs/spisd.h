@@ -6,6 +6,16 @@
 #include "diskio.h"
 #include "vbl.h"
 
+/* 1: CRC checks of commands and data blocks (CMD59). A corrupted block is read or written again */
+#ifndef SPISD_CRC
+#define SPISD_CRC   0
+#endif
+
+#if SPISD_CRC
+/* Set by ports with a CRC unit: returns the CRC-16/XMODEM of len bytes of buff. The table is used otherwise */
+extern WORD (*spisd_crc16_hw)(const BYTE *buff, UINT len);
+#endif
+
 DSTATUS spi_disk_initialize (uint32_t spi, vhalSpiConf *conf);
 DSTATUS spi_disk_status (uint32_t spi);
 DRESULT spi_disk_read (uint32_t spi, BYTE* buff, DWORD sector, UINT count);
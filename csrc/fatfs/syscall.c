@@ -4,8 +4,78 @@
 /*------------------------------------------------------------------------*/
 
 
-#include "ff.h"
 #include "zerynth.h"
+#include "ff.h"
+
+
+
+#if _FS_REENTRANT
+/*------------------------------------------------------------------------*/
+/* Create a Synchronization Object                                        */
+/*------------------------------------------------------------------------*/
+/* Called in f_mount() to create a new synchronization object for the
+/  volume: a VOSAL mutex. Returns 1 on success, 0 on failure.
+*/
+
+int ff_cre_syncobj (	/* 1:Function succeeded, 0:Could not create the sync object */
+	BYTE vol,			/* Corresponding volume (logical drive number) */
+	_SYNC_t *sobj		/* Pointer to return the created sync object */
+)
+{
+	*sobj = vosMtxCreate();
+	return (*sobj != NULL);
+}
+
+
+
+/*------------------------------------------------------------------------*/
+/* Delete a Synchronization Object                                        */
+/*------------------------------------------------------------------------*/
+/* Called in f_mount() to delete the synchronization object of the volume.
+*/
+
+int ff_del_syncobj (	/* 1:Function succeeded, 0:Could not delete due to any error */
+	_SYNC_t sobj		/* Sync object tied to the logical drive to be deleted */
+)
+{
+	vosMtxDestroy(sobj);
+	return 1;
+}
+
+
+
+/*------------------------------------------------------------------------*/
+/* Request Grant to Access the Volume                                     */
+/*------------------------------------------------------------------------*/
+/* Called on entering file functions to lock the volume. VOSAL mutexes
+/  can't be waited for with a timeout: _FS_TIMEOUT is not used and the
+/  grant is always obtained.
+*/
+
+int ff_req_grant (	/* 1:Got a grant to access the volume, 0:Could not get a grant */
+	_SYNC_t sobj	/* Sync object to wait */
+)
+{
+	vosMtxLock(sobj);
+	return 1;
+}
+
+
+
+/*------------------------------------------------------------------------*/
+/* Release Grant to Access the Volume                                     */
+/*------------------------------------------------------------------------*/
+/* Called on leaving file functions to unlock the volume.
+*/
+
+void ff_rel_grant (
+	_SYNC_t sobj	/* Sync object to be signaled */
+)
+{
+	vosMtxUnlock(sobj);
+}
+
+#endif
 
 
 #if _USE_LFN == 3	/* LFN with a working buffer on the heap */
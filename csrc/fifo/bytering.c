@@ -0,0 +1,226 @@
+#include "zerynth.h"
+
+/*
+ * Single producer, single consumer byte ring for fifo.ByteRing.
+ *
+ * A ring is a list [buffer, sem]: buffer is a bytearray holding the RingState header followed by the data, with a
+ * power of two capacity. head and tail run freely and are each written by one side only (tail by the producer, head by
+ * the consumer), so neither side needs a lock and the producer can be an ISR. sem is signaled when the producer finds
+ * the ring empty, and lets the consumer wait for data without the GIL.
+ *
+ * Natives can produce into a ring with bytering_write, given the list the Python object keeps in _ring.
+ */
+
+#define RING_TAG        0x474e4952  /* "RING" */
+#define RING_MAX        0x8000
+
+typedef struct _ring_state {
+    uint32_t tag;
+    uint32_t mask;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint8_t data[];
+} RingState;
+
+#define R_STATE(r)  ((RingState*)PSEQUENCE_BYTES(PLIST_ITEM(r, 0)))
+#define R_SEM(r)    (((PSysObject*)PLIST_ITEM(r, 1))->sys.sem)
+
+static int ring_check(PObject *r)
+{
+    PObject *buf;
+
+    if (PTYPE(r) != PLIST || PSEQUENCE_ELEMENTS(r) != 2)
+        return 0;
+    buf = PLIST_ITEM(r, 0);
+    return PTYPE(buf) == PBYTEARRAY && PSEQUENCE_ELEMENTS(buf) > (int32_t)sizeof(RingState) && R_STATE(r)->tag == RING_TAG;
+}
+
+/*
+ * Producer side: copies up to len bytes into ring r and returns how many fit.
+ * Must not run concurrently with another producer of the same ring; set isr when called inside an ISR.
+ */
+int bytering_write(PObject *r, const uint8_t *data, int len, int isr)
+{
+    RingState *st = R_STATE(r);
+    uint32_t tail = st->tail;
+    uint32_t head = st->head;
+    uint32_t cap = st->mask + 1;
+    uint32_t pos, n;
+
+    if ((uint32_t)len > cap - (tail - head))
+        len = cap - (tail - head);
+    if (len <= 0)
+        return 0;
+    pos = tail & st->mask;
+    n = cap - pos;
+    if (n > (uint32_t)len)
+        n = len;
+    memcpy(st->data + pos, data, n);
+    memcpy(st->data, data + n, len - n);
+    // data must be in place before the consumer sees the new tail
+    __sync_synchronize();
+    st->tail = tail + len;
+    if (tail == head) {
+        if (isr)
+            vosSemSignalIsr(R_SEM(r));
+        else
+            vosSemSignalCap(R_SEM(r), 1);
+    }
+    return len;
+}
+
+// consumer side: copies up to len bytes out of the ring
+static int bytering_read(PObject *r, uint8_t *data, int len)
+{
+    RingState *st = R_STATE(r);
+    uint32_t head = st->head;
+    uint32_t tail = st->tail;
+    uint32_t pos, n;
+
+    if ((uint32_t)len > tail - head)
+        len = tail - head;
+    if (len <= 0)
+        return 0;
+    // tail is read before the data it covers
+    __sync_synchronize();
+    pos = head & st->mask;
+    n = st->mask + 1 - pos;
+    if (n > (uint32_t)len)
+        n = len;
+    memcpy(data, st->data + pos, n);
+    memcpy(data + n, st->data, len - n);
+    __sync_synchronize();
+    st->head = head + len;
+    return len;
+}
+
+/*
+ * args: size
+ * returns a new ring of at least size bytes
+ */
+C_NATIVE(_bytering_new)
+{
+    C_NATIVE_UNWARN();
+    int32_t size, cap;
+    PObject *r, *buf;
+    PSysObject *sem;
+    RingState *st;
+
+    if (parse_py_args("i", nargs, args, &size) != 1)
+        return ERR_TYPE_EXC;
+    if (size <= 0 || size > RING_MAX)
+        return ERR_VALUE_EXC;
+    for (cap = 1; cap < size; cap <<= 1);
+
+    r = (PObject*)plist_new(2, NULL);
+    PLIST_SET_ITEM(r, 0, MAKE_NONE());
+    PLIST_SET_ITEM(r, 1, MAKE_NONE());
+    *res = r;
+    buf = (PObject*)psequence_new(PBYTEARRAY, sizeof(RingState) + cap);
+    PSEQUENCE_ELEMENTS_SET(buf, sizeof(RingState) + cap);
+    PLIST_SET_ITEM(r, 0, buf);
+    st = R_STATE(r);
+    st->tag = RING_TAG;
+    st->mask = cap - 1;
+    st->head = 0;
+    st->tail = 0;
+    sem = psysobj_new(PSYS_SEMAPHORE);
+    sem->sys.sem = vosSemCreate(0);
+    PLIST_SET_ITEM(r, 1, sem);
+    return ERR_OK;
+}
+
+/*
+ * args: r, data, ofs, size
+ * appends size bytes of data from ofs (all of them if size is negative), never waiting.
+ * Returns how many were appended
+ */
+C_NATIVE(_bytering_put)
+{
+    C_NATIVE_UNWARN();
+    int32_t ofs, size;
+
+    if (nargs != 4 || !ring_check(args[0]) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1])) || !IS_PSMALLINT(args[2]) || !IS_PSMALLINT(args[3]))
+        return ERR_TYPE_EXC;
+    ofs = PSMALLINT_VALUE(args[2]);
+    size = PSMALLINT_VALUE(args[3]);
+    if (size < 0)
+        size = PSEQUENCE_ELEMENTS(args[1]) - ofs;
+    if (ofs < 0 || size < 0 || ofs + size > PSEQUENCE_ELEMENTS(args[1]))
+        return ERR_INDEX_EXC;
+    *res = PSMALLINT_NEW(bytering_write(args[0], PSEQUENCE_BYTES(args[1]) + ofs, size, 0));
+    return ERR_OK;
+}
+
+/*
+ * args: r, buf, ofs, size, timeout
+ * moves up to size bytes into the bytearray buf from ofs (to its end if size is negative), waiting at most timeout millis
+ * (forever if negative) for the first one. Returns how many were moved, 0 on timeout
+ */
+C_NATIVE(_bytering_get)
+{
+    C_NATIVE_UNWARN();
+    int32_t ofs, size, timeout, n;
+    PObject *r;
+
+    if (nargs != 5 || !ring_check(args[0]) || PTYPE(args[1]) != PBYTEARRAY || !IS_PSMALLINT(args[2]) || !IS_PSMALLINT(args[3]) || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    r = args[0];
+    ofs = PSMALLINT_VALUE(args[2]);
+    size = PSMALLINT_VALUE(args[3]);
+    timeout = PSMALLINT_VALUE(args[4]);
+    if (size < 0)
+        size = PSEQUENCE_ELEMENTS(args[1]) - ofs;
+    if (ofs < 0 || size < 0 || ofs + size > PSEQUENCE_ELEMENTS(args[1]))
+        return ERR_INDEX_EXC;
+
+    // signals left by data already consumed only cost another check
+    while (size && !(n = bytering_read(r, PSEQUENCE_BYTES(args[1]) + ofs, size))) {
+        if (!timeout) {
+            *res = PSMALLINT_NEW(0);
+            return ERR_OK;
+        }
+        RELEASE_GIL();
+        n = vosSemWaitTimeout(R_SEM(r), (timeout < 0) ? VTIME_INFINITE : TIME_U(timeout, MILLIS));
+        ACQUIRE_GIL();
+        if (n != VRES_OK) {
+            *res = PSMALLINT_NEW(0);
+            return ERR_OK;
+        }
+    }
+    *res = PSMALLINT_NEW(size ? n : 0);
+    return ERR_OK;
+}
+
+/*
+ * args: r
+ * returns the number of bytes in the ring
+ */
+C_NATIVE(_bytering_count)
+{
+    C_NATIVE_UNWARN();
+    RingState *st;
+
+    if (nargs != 1 || !ring_check(args[0]))
+        return ERR_TYPE_EXC;
+    st = R_STATE(args[0]);
+    *res = PSMALLINT_NEW(st->tail - st->head);
+    return ERR_OK;
+}
+
+/*
+ * args: r
+ * discards the bytes in the ring. Consumer side
+ */
+C_NATIVE(_bytering_clear)
+{
+    C_NATIVE_UNWARN();
+    RingState *st;
+
+    if (nargs != 1 || !ring_check(args[0]))
+        return ERR_TYPE_EXC;
+    st = R_STATE(args[0]);
+    st->head = st->tail;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
@@ -0,0 +1,679 @@
+#include "zerynth.h"
+#include "../spiflash/spiflash.h"
+#include "../zsockets/zerynth_sendfile.h"
+#include "../crc/crc.h"
+
+/*
+ * Circular log of records on raw flash.
+ *
+ * The region is a ring of erase units (sectors). Each sector begins with a header holding a magic and
+ * the sequence number given when the sector was opened, followed by records. A record is a 16 bytes
+ * header (length and its complement, timestamp, crc32 of timestamp and payload) and the payload, padded
+ * to FLASHLOG_ALIGN bytes so that internal flashes with double word programming can store it.
+ *
+ * Sectors are opened in ring order: when the active sector is full, the next one is erased, dropping
+ * the oldest records, and gets the next sequence number. An append only programs erased bytes, header
+ * first: a torn payload is detected by the crc and skipped, a torn header closes the sector.
+ *
+ * The sequence number and the timestamp of the first record of every sector are kept in RAM: seeks
+ * pick the sector by timestamp and then walk its records. Only the active sector is walked at attach.
+ *
+ * Flash accesses are done without the GIL, holding the mutex of the log.
+ */
+
+#define FLASHLOG_QSPI           0
+#define FLASHLOG_SPI            1
+#define FLASHLOG_INTERNAL       2
+
+#define FLASHLOG_MAGIC          0x474C465A
+#define FLASHLOG_ALIGN          8
+#define FLASHLOG_HDR_SIZE       16
+#define FLASHLOG_MIN_SECTORS    2
+#define FLASHLOG_NO_SEQ         0xFFFFFFFF
+
+#ifndef FLASHLOG_MAX_LOGS
+#define FLASHLOG_MAX_LOGS       2
+#endif
+
+// milliseconds to wait for the end of page program and sector erase on spiflash
+#define FLASHLOG_SPI_PAGE_TIMEOUT   100
+#define FLASHLOG_SPI_ERASE_TIMEOUT  3000
+
+typedef struct _flashlog_sector_header {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t reserved[2];
+} FlashLogSectorHeader;
+
+typedef struct _flashlog_record {
+    uint16_t len;
+    uint16_t nlen;          /* ~len: tells a programmed header from a torn one */
+    uint32_t ts;
+    uint32_t crc;
+    uint32_t reserved;
+} FlashLogRecord;
+
+#define FLASHLOG_REC_FREE(r)    ((r).len == 0xFFFF && (r).nlen == 0xFFFF)
+#define FLASHLOG_REC_VALID(r)   ((r).nlen == (uint16_t)~(r).len)
+#define FLASHLOG_REC_SIZE(n)    ((FLASHLOG_HDR_SIZE + (n) + FLASHLOG_ALIGN - 1) & ~(FLASHLOG_ALIGN - 1))
+
+typedef struct _flashlog {
+    VMutex mtx;
+    uint8_t in_use;
+    uint8_t type;
+    uint8_t drv;            /* spi driver of spiflash */
+    uint8_t erase_cmd;      /* erase command of spiflash */
+    uint32_t page_size;
+    uint32_t start;
+    uint32_t sector_size;
+    uint32_t nsectors;
+    int32_t active;         /* -1 if no sector has been opened */
+    uint32_t wr_off;        /* next free byte of the active sector */
+    int32_t rd_sector;      /* read cursor */
+    uint32_t rd_off;
+    uint32_t seq;
+    uint32_t *seqs;         /* sequence number of each sector, FLASHLOG_NO_SEQ if free */
+    uint32_t *first_ts;     /* timestamp of the first record of each sector */
+    uint32_t last_ts;
+    uint32_t corrupted;     /* records skipped for a bad crc */
+} FlashLog;
+
+static FlashLog flashlogs[FLASHLOG_MAX_LOGS];
+
+#define FLASHLOG_ADDR(l, s, o)  ((s) * (l)->sector_size + (o))
+#define FLASHLOG_NEXT(l, s)     ((s) + 1 < (l)->nsectors ? (s) + 1 : 0)
+
+static uint32_t flashlog_record_crc(uint32_t ts, const uint8_t *data, uint32_t len)
+{
+    return crc32_update(crc32_update(0, (uint8_t *)&ts, 4), data, len);
+}
+
+/*-----------------------------------------------------------------------*/
+/* Flash access                                                          */
+/*-----------------------------------------------------------------------*/
+
+static int flashlog_read(FlashLog *l, uint32_t addr, uint8_t *buf, uint32_t len)
+{
+    addr += l->start;
+    if (l->type == FLASHLOG_SPI)
+        return spiflash_dev_read(l->drv, addr, buf, len) < 0;
+    if (l->type == FLASHLOG_INTERNAL) {
+        // internal flash is memory mapped
+        memcpy(buf, (uint8_t *)addr, len);
+        return 0;
+    }
+#if defined(VHAL_QSPIFLASH)
+    return vhalQspiFlashRead(0, addr, buf, len) != VHAL_OK;
+#else
+    return 1;
+#endif
+}
+
+static int flashlog_prog(FlashLog *l, uint32_t addr, const uint8_t *data, uint32_t len)
+{
+    addr += l->start;
+    if (l->type == FLASHLOG_SPI)
+        return spiflash_dev_write(l->drv, addr, data, len, l->page_size, FLASHLOG_SPI_PAGE_TIMEOUT) < 0;
+    if (l->type == FLASHLOG_INTERNAL)
+        return vhalFlashWrite((void *)addr, (uint8_t *)data, len) != (int)len;
+#if defined(VHAL_QSPIFLASH)
+    uint32_t n;
+
+    while (len > 0) {
+        n = l->page_size - (addr & (l->page_size - 1));
+        if (n > len)
+            n = len;
+        if (vhalQspiFlashWrite(0, addr, (uint8_t *)data, n) != VHAL_OK)
+            return 1;
+        addr += n;
+        data += n;
+        len -= n;
+    }
+    return 0;
+#else
+    return 1;
+#endif
+}
+
+static int flashlog_erase(FlashLog *l, uint32_t s)
+{
+    uint32_t addr = l->start + FLASHLOG_ADDR(l, s, 0);
+
+    if (l->type == FLASHLOG_SPI)
+        return spiflash_dev_erase(l->drv, l->erase_cmd, addr, FLASHLOG_SPI_ERASE_TIMEOUT) < 0;
+    if (l->type == FLASHLOG_INTERNAL)
+        return vhalFlashErase((void *)addr, l->sector_size) != 0;
+#if defined(VHAL_QSPIFLASH)
+    return vhalQspiFlashEraseSector(0, addr, 1) != VHAL_OK;
+#else
+    return 1;
+#endif
+}
+
+/*-----------------------------------------------------------------------*/
+/* Ring                                                                  */
+/*-----------------------------------------------------------------------*/
+
+// oldest sector holding records, -1 if the log is empty
+static int32_t flashlog_oldest(FlashLog *l)
+{
+    uint32_t s;
+
+    if (l->active < 0)
+        return -1;
+    for (s = FLASHLOG_NEXT(l, l->active); s != l->active; s = FLASHLOG_NEXT(l, s)) {
+        if (l->seqs[s] != FLASHLOG_NO_SEQ)
+            return s;
+    }
+    return l->active;
+}
+
+// erases the sector after the active one and opens it
+static int flashlog_open_sector(FlashLog *l)
+{
+    uint32_t s = l->active < 0 ? 0 : FLASHLOG_NEXT(l, l->active);
+    FlashLogSectorHeader h;
+
+    // the records of the sector are lost: the cursor skips to the next oldest one
+    l->seqs[s] = FLASHLOG_NO_SEQ;
+    l->first_ts[s] = 0xFFFFFFFF;
+    if (l->rd_sector == s) {
+        l->rd_sector = -1;
+        l->rd_off = FLASHLOG_HDR_SIZE;
+    }
+    if (flashlog_erase(l, s))
+        return -1;
+
+    h.magic = FLASHLOG_MAGIC;
+    h.seq = ++l->seq;
+    h.reserved[0] = 0xFFFFFFFF;
+    h.reserved[1] = 0xFFFFFFFF;
+    if (flashlog_prog(l, FLASHLOG_ADDR(l, s, 0), (uint8_t *)&h, FLASHLOG_HDR_SIZE))
+        return -1;
+    l->seqs[s] = h.seq;
+    l->active = s;
+    l->wr_off = FLASHLOG_HDR_SIZE;
+    if (l->rd_sector < 0)
+        l->rd_sector = flashlog_oldest(l);
+    return 0;
+}
+
+static int flashlog_add(FlashLog *l, uint32_t ts, const uint8_t *data, uint32_t len)
+{
+    FlashLogRecord r;
+    uint8_t tail[FLASHLOG_ALIGN];
+    uint32_t addr, body = len & ~(FLASHLOG_ALIGN - 1);
+
+    if (l->active < 0 || l->wr_off + FLASHLOG_REC_SIZE(len) > l->sector_size) {
+        if (flashlog_open_sector(l))
+            return -1;
+    }
+    addr = FLASHLOG_ADDR(l, l->active, l->wr_off);
+    // the space is used even if programming fails: it is not erased anymore
+    l->wr_off += FLASHLOG_REC_SIZE(len);
+
+    r.len = len;
+    r.nlen = ~len;
+    r.ts = ts;
+    r.crc = flashlog_record_crc(ts, data, len);
+    r.reserved = 0xFFFFFFFF;
+    if (flashlog_prog(l, addr, (uint8_t *)&r, FLASHLOG_HDR_SIZE))
+        return -1;
+    addr += FLASHLOG_HDR_SIZE;
+    if (body && flashlog_prog(l, addr, data, body))
+        return -1;
+    if (len > body) {
+        memset(tail, 0xff, FLASHLOG_ALIGN);
+        memcpy(tail, data + body, len - body);
+        if (flashlog_prog(l, addr + body, tail, FLASHLOG_ALIGN))
+            return -1;
+    }
+    if (l->first_ts[l->active] == 0xFFFFFFFF)
+        l->first_ts[l->active] = ts;
+    l->last_ts = ts;
+    return 0;
+}
+
+/*
+ * reads the header of the record at the cursor, moving the cursor to the next sector at the end of one.
+ * Returns 1 if there is a record, 0 at the end of the log and -1 on error.
+ */
+static int flashlog_next(FlashLog *l, FlashLogRecord *r)
+{
+    while (l->rd_sector >= 0) {
+        if (l->rd_sector == l->active && l->rd_off >= l->wr_off)
+            return 0;
+        if (l->rd_off + FLASHLOG_HDR_SIZE <= l->sector_size) {
+            if (flashlog_read(l, FLASHLOG_ADDR(l, l->rd_sector, l->rd_off), (uint8_t *)r, FLASHLOG_HDR_SIZE))
+                return -1;
+            if (FLASHLOG_REC_VALID(*r) && l->rd_off + FLASHLOG_REC_SIZE(r->len) <= l->sector_size)
+                return 1;
+        }
+        // end of sector, or a torn header that closed it
+        if (l->rd_sector == l->active)
+            return 0;
+        do {
+            l->rd_sector = FLASHLOG_NEXT(l, l->rd_sector);
+        } while (l->seqs[l->rd_sector] == FLASHLOG_NO_SEQ && l->rd_sector != l->active);
+        l->rd_off = FLASHLOG_HDR_SIZE;
+    }
+    return 0;
+}
+
+// offset of the end of the records of sector s
+static int flashlog_end(FlashLog *l, uint32_t s, uint32_t *end)
+{
+    FlashLogRecord r;
+    uint32_t off = FLASHLOG_HDR_SIZE;
+
+    while (off + FLASHLOG_HDR_SIZE <= l->sector_size) {
+        if (flashlog_read(l, FLASHLOG_ADDR(l, s, off), (uint8_t *)&r, FLASHLOG_HDR_SIZE))
+            return -1;
+        if (FLASHLOG_REC_FREE(r))
+            break;
+        if (!FLASHLOG_REC_VALID(r) || off + FLASHLOG_REC_SIZE(r.len) > l->sector_size) {
+            // torn header: nothing can be appended after it
+            off = l->sector_size;
+            break;
+        }
+        l->last_ts = r.ts;
+        off += FLASHLOG_REC_SIZE(r.len);
+    }
+    *end = off;
+    return 0;
+}
+
+// rebuilds sequence numbers and first timestamps from the sector headers
+static int flashlog_scan(FlashLog *l)
+{
+    uint32_t s;
+    FlashLogSectorHeader h;
+    FlashLogRecord r;
+
+    l->active = -1;
+    l->seq = 0;
+    l->last_ts = 0;
+    for (s = 0; s < l->nsectors; s++) {
+        l->seqs[s] = FLASHLOG_NO_SEQ;
+        l->first_ts[s] = 0xFFFFFFFF;
+        if (flashlog_read(l, FLASHLOG_ADDR(l, s, 0), (uint8_t *)&h, FLASHLOG_HDR_SIZE))
+            return -1;
+        if (h.magic != FLASHLOG_MAGIC || h.seq == FLASHLOG_NO_SEQ)
+            continue;
+        l->seqs[s] = h.seq;
+        if (l->active < 0 || h.seq > l->seq) {
+            l->active = s;
+            l->seq = h.seq;
+        }
+        if (flashlog_read(l, FLASHLOG_ADDR(l, s, FLASHLOG_HDR_SIZE), (uint8_t *)&r, FLASHLOG_HDR_SIZE))
+            return -1;
+        if (FLASHLOG_REC_VALID(r))
+            l->first_ts[s] = r.ts;
+    }
+    l->wr_off = l->sector_size;
+    if (l->active >= 0 && flashlog_end(l, l->active, &l->wr_off))
+        return -1;
+    l->rd_sector = flashlog_oldest(l);
+    l->rd_off = FLASHLOG_HDR_SIZE;
+    return 0;
+}
+
+// moves the cursor to the first record with a timestamp not lower than ts
+static int flashlog_find(FlashLog *l, uint32_t ts)
+{
+    FlashLogRecord r;
+    int32_t s, best;
+    int err;
+
+    best = s = flashlog_oldest(l);
+    if (s < 0)
+        return 0;
+    // the last sector starting before ts: timestamps don't decrease along the ring
+    do {
+        s = FLASHLOG_NEXT(l, s);
+        if (l->seqs[s] != FLASHLOG_NO_SEQ && l->first_ts[s] != 0xFFFFFFFF && l->first_ts[s] < ts)
+            best = s;
+    } while (s != l->active);
+    l->rd_sector = best;
+    l->rd_off = FLASHLOG_HDR_SIZE;
+    while ((err = flashlog_next(l, &r)) > 0 && r.ts < ts)
+        l->rd_off += FLASHLOG_REC_SIZE(r.len);
+    return err < 0 ? -1 : 0;
+}
+
+static FlashLog *flashlog_get(int32_t id)
+{
+    if (id < 0 || id >= FLASHLOG_MAX_LOGS || !flashlogs[id].in_use)
+        return NULL;
+    return &flashlogs[id];
+}
+
+static void flashlog_release(FlashLog *l)
+{
+    l->in_use = 0;
+    if (l->seqs) gc_free(l->seqs);
+    if (l->first_ts) gc_free(l->first_ts);
+    l->seqs = NULL;
+    l->first_ts = NULL;
+}
+
+// timestamps are below 2^31, but may not fit a small int
+#define FLASHLOG_TS_NEW(ts)     ((ts) < 0x40000000 ? PSMALLINT_NEW(ts) : (PObject *)pinteger_new(ts))
+
+/*-----------------------------------------------------------------------*/
+/* Natives                                                               */
+/*-----------------------------------------------------------------------*/
+
+/*
+ * args: type, drv, start, size, sector_size, page_size, erase_cmd
+ * attaches the flash region [start, start+size) and returns the log id
+ */
+C_NATIVE(flashlog_attach)
+{
+    C_NATIVE_UNWARN();
+    int32_t type, drv, start, size, sector_size, page_size, erase_cmd, id, err;
+    FlashLog *l;
+
+    if (parse_py_args("iiiiiii", nargs, args, &type, &drv, &start, &size, &sector_size, &page_size, &erase_cmd) != 7)
+        return ERR_TYPE_EXC;
+    if (type < FLASHLOG_QSPI || type > FLASHLOG_INTERNAL || size <= 0 || page_size <= 0 || (page_size & (page_size - 1)))
+        return ERR_VALUE_EXC;
+    if (sector_size <= 2 * FLASHLOG_HDR_SIZE || sector_size % FLASHLOG_ALIGN || size / sector_size < FLASHLOG_MIN_SECTORS)
+        return ERR_VALUE_EXC;
+    if (type == FLASHLOG_INTERNAL ? vhalFlashAlignToSector((void *)start) != (void *)start : (start < 0 || start % sector_size))
+        return ERR_VALUE_EXC;
+
+    for (id = 0; id < FLASHLOG_MAX_LOGS && flashlogs[id].in_use; id++);
+    if (id >= FLASHLOG_MAX_LOGS)
+        return ERR_RUNTIME_EXC;
+    l = &flashlogs[id];
+    if (!l->mtx)
+        l->mtx = vosMtxCreate();
+
+    l->type = type;
+    l->drv = drv & 0xff;
+    l->erase_cmd = erase_cmd;
+    l->page_size = page_size;
+    l->start = start;
+    l->sector_size = sector_size;
+    l->nsectors = size / sector_size;
+    l->corrupted = 0;
+    l->seqs = gc_malloc(l->nsectors * sizeof(uint32_t));
+    l->first_ts = gc_malloc(l->nsectors * sizeof(uint32_t));
+    l->in_use = 1;
+
+    RELEASE_GIL();
+    vosMtxLock(l->mtx);
+    err = flashlog_scan(l);
+    vosMtxUnlock(l->mtx);
+    ACQUIRE_GIL();
+    if (err) {
+        flashlog_release(l);
+        return ERR_IOERROR_EXC;
+    }
+    *res = PSMALLINT_NEW(id);
+    return ERR_OK;
+}
+
+/*
+ * args: id
+ */
+C_NATIVE(flashlog_detach)
+{
+    C_NATIVE_UNWARN();
+    FlashLog *l;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !(l = flashlog_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(l->mtx);
+    l->in_use = 0;
+    vosMtxUnlock(l->mtx);
+    ACQUIRE_GIL();
+    flashlog_release(l);
+    return ERR_OK;
+}
+
+/*
+ * args: id, data, timestamp
+ * appends a record; timestamps must not decrease for seeks to work
+ */
+C_NATIVE(flashlog_append)
+{
+    C_NATIVE_UNWARN();
+    int32_t id, len, ts, err;
+    uint8_t *data;
+    FlashLog *l;
+
+    if (parse_py_args("isi", nargs, args, &id, &data, &len, &ts) != 3)
+        return ERR_TYPE_EXC;
+    if (!(l = flashlog_get(id)) || ts < 0 || len >= 0xFFFF || FLASHLOG_REC_SIZE(len) > l->sector_size - FLASHLOG_HDR_SIZE)
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(l->mtx);
+    err = l->in_use ? flashlog_add(l, ts, data, len) : -1;
+    vosMtxUnlock(l->mtx);
+    ACQUIRE_GIL();
+    if (err)
+        return ERR_IOERROR_EXC;
+    return ERR_OK;
+}
+
+/*
+ * writer of the sinks of logs: id is the log. The data is appended as records as large as a sector allows, stamped
+ * with the milliseconds since boot, or with the timestamp of the last record if greater
+ */
+static int flashlog_sink_write(int id, const void *dataptr, size_t size)
+{
+    FlashLog *l = flashlog_get(id);
+    uint32_t max, len, done = 0, ts;
+    int err = 0;
+
+    if (!l)
+        return -1;
+    max = (l->sector_size - 2 * FLASHLOG_HDR_SIZE) & ~(FLASHLOG_ALIGN - 1);
+    if (max >= 0xFFFF)
+        max = 0xFFF8;
+    vosMtxLock(l->mtx);
+    ts = (uint32_t)vosMillis() & 0x7FFFFFFF;
+    if (ts < l->last_ts)
+        ts = l->last_ts;
+    while (!err && done < size) {
+        len = (size - done > max) ? max : size - done;
+        err = l->in_use ? flashlog_add(l, ts, (const uint8_t *)dataptr + done, len) : -1;
+        if (!err)
+            done += len;
+    }
+    vosMtxUnlock(l->mtx);
+    return done ? (int)done : -1;
+}
+
+/*
+ * args: id
+ * returns the sink appending to the log, as bytes (see zerynth_sendfile.h)
+ */
+C_NATIVE(flashlog_sink)
+{
+    C_NATIVE_UNWARN();
+    ZSockSink sink;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !flashlog_get(PSMALLINT_VALUE(args[0])))
+        return ERR_VALUE_EXC;
+    sink.write = flashlog_sink_write;
+    sink.sock = PSMALLINT_VALUE(args[0]);
+    *res = (PObject *)pbytes_new(sizeof(ZSockSink), (uint8_t *)&sink);
+    return ERR_OK;
+}
+
+/*
+ * args: id, n, buffer, ofs
+ * copies up to n records from the cursor into the bytearray buffer starting at ofs, until the buffer is full.
+ * Returns a list of (timestamp, start, end) with the position of each payload in buffer.
+ */
+C_NATIVE(flashlog_read_records)
+{
+    C_NATIVE_UNWARN();
+    int32_t n, ofs, size, i, count = 0, err = 0;
+    uint32_t *found, pos;
+    uint8_t *buf;
+    FlashLogRecord r;
+    FlashLog *l;
+    PList *lst;
+    PTuple *tpl;
+
+    if (nargs != 4 || !IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[1]) || PTYPE(args[2]) != PBYTEARRAY || !IS_PSMALLINT(args[3]))
+        return ERR_TYPE_EXC;
+    if (!(l = flashlog_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+    n = PSMALLINT_VALUE(args[1]);
+    ofs = PSMALLINT_VALUE(args[3]);
+    size = PSEQUENCE_ELEMENTS(args[2]);
+    if (n < 0 || ofs < 0 || ofs > size)
+        return ERR_INDEX_EXC;
+    buf = PSEQUENCE_BYTES(args[2]);
+    found = gc_malloc((n ? n : 1) * 3 * sizeof(uint32_t));
+    pos = ofs;
+
+    RELEASE_GIL();
+    vosMtxLock(l->mtx);
+    while (count < n && l->in_use) {
+        err = flashlog_next(l, &r);
+        if (err <= 0 || pos + r.len > size)
+            break;
+        err = flashlog_read(l, FLASHLOG_ADDR(l, l->rd_sector, l->rd_off + FLASHLOG_HDR_SIZE), buf + pos, r.len);
+        if (err) {
+            err = -1;
+            break;
+        }
+        l->rd_off += FLASHLOG_REC_SIZE(r.len);
+        if (flashlog_record_crc(r.ts, buf + pos, r.len) != r.crc) {
+            // torn by a power loss
+            l->corrupted++;
+            continue;
+        }
+        found[3 * count] = r.ts;
+        found[3 * count + 1] = pos;
+        found[3 * count + 2] = pos + r.len;
+        pos += r.len;
+        count++;
+    }
+    vosMtxUnlock(l->mtx);
+    ACQUIRE_GIL();
+    if (err < 0) {
+        gc_free(found);
+        return ERR_IOERROR_EXC;
+    }
+
+    lst = plist_new(count, NULL);
+    for (i = 0; i < count; i++) {
+        tpl = ptuple_new(3, NULL);
+        PTUPLE_SET_ITEM(tpl, 0, FLASHLOG_TS_NEW(found[3 * i]));
+        PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(found[3 * i + 1]));
+        PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(found[3 * i + 2]));
+        PLIST_SET_ITEM(lst, i, tpl);
+    }
+    gc_free(found);
+    *res = lst;
+    return ERR_OK;
+}
+
+/*
+ * args: id, timestamp
+ * moves the cursor to the first record not older than timestamp (0 rewinds to the oldest record)
+ */
+C_NATIVE(flashlog_seek)
+{
+    C_NATIVE_UNWARN();
+    int32_t id, ts, err;
+    FlashLog *l;
+
+    if (parse_py_args("ii", nargs, args, &id, &ts) != 2)
+        return ERR_TYPE_EXC;
+    if (!(l = flashlog_get(id)) || ts < 0)
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(l->mtx);
+    err = l->in_use ? flashlog_find(l, ts) : -1;
+    vosMtxUnlock(l->mtx);
+    ACQUIRE_GIL();
+    if (err)
+        return ERR_IOERROR_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: id
+ * erases the sectors holding records
+ */
+C_NATIVE(flashlog_clear)
+{
+    C_NATIVE_UNWARN();
+    uint32_t s;
+    int32_t err = 0;
+    FlashLog *l;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !(l = flashlog_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(l->mtx);
+    for (s = 0; s < l->nsectors && !err; s++) {
+        if (l->seqs[s] != FLASHLOG_NO_SEQ)
+            err = flashlog_erase(l, s);
+        if (!err)
+            l->seqs[s] = FLASHLOG_NO_SEQ;
+        l->first_ts[s] = 0xFFFFFFFF;
+    }
+    l->active = -1;
+    l->wr_off = l->sector_size;
+    l->rd_sector = -1;
+    l->rd_off = FLASHLOG_HDR_SIZE;
+    vosMtxUnlock(l->mtx);
+    ACQUIRE_GIL();
+    if (err)
+        return ERR_IOERROR_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: id
+ * returns (sectors, used sectors, free bytes of the active sector, oldest timestamp, newest timestamp, corrupted records)
+ */
+C_NATIVE(flashlog_stats)
+{
+    C_NATIVE_UNWARN();
+    uint32_t s, used = 0, oldest = 0, newest, avail;
+    int32_t o;
+    FlashLog *l;
+    PTuple *tpl;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !(l = flashlog_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(l->mtx);
+    for (s = 0; s < l->nsectors; s++) {
+        if (l->seqs[s] != FLASHLOG_NO_SEQ)
+            used++;
+    }
+    o = flashlog_oldest(l);
+    if (o >= 0 && l->first_ts[o] != 0xFFFFFFFF)
+        oldest = l->first_ts[o];
+    newest = l->last_ts;
+    avail = l->active < 0 || l->wr_off + FLASHLOG_HDR_SIZE > l->sector_size ? 0 : l->sector_size - l->wr_off - FLASHLOG_HDR_SIZE;
+    vosMtxUnlock(l->mtx);
+    ACQUIRE_GIL();
+
+    tpl = ptuple_new(6, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(l->nsectors));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(used));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(avail));
+    PTUPLE_SET_ITEM(tpl, 3, FLASHLOG_TS_NEW(oldest));
+    PTUPLE_SET_ITEM(tpl, 4, FLASHLOG_TS_NEW(newest));
+    PTUPLE_SET_ITEM(tpl, 5, PSMALLINT_NEW(l->corrupted));
+    *res = tpl;
+    return ERR_OK;
+}
@@ -0,0 +1,229 @@
+#include "zerynth.h"
+
+/*
+ * Resumable application of sequential delta patches (bsdiff control blocks, interleaved as in detools).
+ *
+ * A patch is a 12 bytes header ("ZDL1", old size, new size, little endian) followed by records:
+ *   varint diff_len, varint extra_len, zigzag varint seek,
+ *   diff_len bytes added (mod 256) to the old image from the current position,
+ *   extra_len bytes copied as they are,
+ * after which the position in the old image moves by seek. The patch ends when new size bytes have
+ * been produced. The old image is read in place (slots are memory mapped), the state lives in a
+ * bytearray owned by Python, and input and output can be given in pieces of any size.
+ */
+
+#define FD_MAGIC        0x314C445A  /* "ZDL1" */
+#define FD_HDR_SIZE     12
+
+// steps of the patcher
+#define FD_M_HEAD       0
+#define FD_M_DIFF_LEN   1
+#define FD_M_EXTRA_LEN  2
+#define FD_M_SEEK       3
+#define FD_M_DIFF       4
+#define FD_M_EXTRA      5
+#define FD_M_DONE       6
+
+// results of fd_run
+#define FD_MORE  0
+#define FD_END   1
+#define FD_BAD  -1
+
+typedef struct _fd_state {
+    uint32_t tag;           // FD_MAGIC, to recognize the bytearray
+    uint8_t mode;
+    uint8_t shift;          // of the varint being read
+    uint8_t hlen;           // header bytes collected
+    uint8_t head[FD_HDR_SIZE];
+    uint32_t varint;
+    uint8_t *old;
+    uint32_t old_size;
+    uint32_t old_pos;
+    uint32_t new_size;
+    uint32_t new_pos;
+    uint32_t diff_len;
+    uint32_t extra_len;
+    int32_t seek;           // applied to old_pos after the extra bytes
+} FdState;
+
+#define FD_STATE(o) ((FdState*)PSEQUENCE_BYTES(o))
+#define IS_FD_STATE(o) (PTYPE(o)==PBYTEARRAY && PSEQUENCE_ELEMENTS(o)==(int32_t)sizeof(FdState) && FD_STATE(o)->tag==FD_MAGIC)
+
+typedef struct _fd_buf {
+    uint8_t *buf;
+    int32_t len;
+    int32_t pos;
+} FdBuf;
+
+static uint32_t fd_le32(uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// reads a varint byte by byte: returns 1 when complete, 0 when input ends, -1 if too long
+static int fd_varint(FdState *f, FdBuf *in)
+{
+    uint8_t b;
+
+    while (in->pos < in->len) {
+        b = in->buf[in->pos++];
+        if (f->shift > 28)
+            return -1;
+        f->varint |= (uint32_t)(b & 0x7f) << f->shift;
+        f->shift += 7;
+        if (!(b & 0x80))
+            return 1;
+    }
+    return 0;
+}
+
+static int fd_run(FdState *f, FdBuf *in, FdBuf *out)
+{
+    int32_t n, i, r;
+
+    for (;;) {
+        switch (f->mode) {
+            case FD_M_HEAD:
+                while (f->hlen < FD_HDR_SIZE && in->pos < in->len)
+                    f->head[f->hlen++] = in->buf[in->pos++];
+                if (f->hlen < FD_HDR_SIZE)
+                    return FD_MORE;
+                if (fd_le32(f->head) != FD_MAGIC || fd_le32(f->head + 4) > f->old_size)
+                    return FD_BAD;
+                // the slot may be larger than the image the patch was made from
+                f->old_size = fd_le32(f->head + 4);
+                f->new_size = fd_le32(f->head + 8);
+                f->mode = FD_M_DIFF_LEN;
+                break;
+            case FD_M_DIFF_LEN:
+            case FD_M_EXTRA_LEN:
+            case FD_M_SEEK:
+                if (f->mode == FD_M_DIFF_LEN && f->new_pos >= f->new_size) {
+                    f->mode = FD_M_DONE;
+                    break;
+                }
+                r = fd_varint(f, in);
+                if (r <= 0)
+                    return r ? FD_BAD : FD_MORE;
+                if (f->mode == FD_M_DIFF_LEN) {
+                    f->diff_len = f->varint;
+                } else if (f->mode == FD_M_EXTRA_LEN) {
+                    f->extra_len = f->varint;
+                    if (f->diff_len > f->new_size - f->new_pos || f->extra_len > f->new_size - f->new_pos - f->diff_len)
+                        return FD_BAD;
+                } else {
+                    f->seek = (int32_t)(f->varint >> 1) ^ -(int32_t)(f->varint & 1);
+                }
+                f->varint = 0;
+                f->shift = 0;
+                f->mode++;
+                break;
+            case FD_M_DIFF:
+                if (f->diff_len > f->old_size || f->old_pos > f->old_size - f->diff_len)
+                    return FD_BAD;
+                n = in->len - in->pos;
+                if (n > out->len - out->pos)
+                    n = out->len - out->pos;
+                if ((uint32_t)n > f->diff_len)
+                    n = f->diff_len;
+                for (i = 0; i < n; i++)
+                    out->buf[out->pos + i] = in->buf[in->pos + i] + f->old[f->old_pos + i];
+                in->pos += n;
+                out->pos += n;
+                f->old_pos += n;
+                f->new_pos += n;
+                f->diff_len -= n;
+                if (f->diff_len)
+                    return FD_MORE;
+                f->mode = FD_M_EXTRA;
+                break;
+            case FD_M_EXTRA:
+                n = in->len - in->pos;
+                if (n > out->len - out->pos)
+                    n = out->len - out->pos;
+                if ((uint32_t)n > f->extra_len)
+                    n = f->extra_len;
+                memcpy(out->buf + out->pos, in->buf + in->pos, n);
+                in->pos += n;
+                out->pos += n;
+                f->new_pos += n;
+                f->extra_len -= n;
+                if (f->extra_len)
+                    return FD_MORE;
+                if ((int32_t)f->old_pos + f->seek < 0 || (int32_t)f->old_pos + f->seek > (int32_t)f->old_size)
+                    return FD_BAD;
+                f->old_pos += f->seek;
+                f->mode = FD_M_DIFF_LEN;
+                break;
+            default:
+                return FD_END;
+        }
+    }
+}
+
+/*
+ * args: old_addr, old_size
+ * returns the state of a patcher reading the old image at old_addr (at most old_size bytes)
+ */
+C_NATIVE(fdelta_new)
+{
+    C_NATIVE_UNWARN();
+    int32_t addr, size;
+    PObject *state;
+    FdState *f;
+
+    if (parse_py_args("ii", nargs, args, &addr, &size) != 2)
+        return ERR_TYPE_EXC;
+    if (size < 0)
+        return ERR_VALUE_EXC;
+
+    state = (PObject*)psequence_new(PBYTEARRAY, sizeof(FdState));
+    PSEQUENCE_ELEMENTS_SET(state, sizeof(FdState));
+    f = FD_STATE(state);
+    memset(f, 0, sizeof(FdState));
+    f->tag = FD_MAGIC;
+    f->mode = FD_M_HEAD;
+    f->old = (uint8_t *)addr;
+    f->old_size = size;
+    *res = state;
+    return ERR_OK;
+}
+
+/*
+ * args: state, data, ofs, out, outofs
+ * applies the patch bytes of data from ofs, producing the new image into out from outofs, until data is consumed,
+ * out is full or the new image is complete. Returns a tuple (position in data, position in out, ended)
+ */
+C_NATIVE(fdelta_run)
+{
+    C_NATIVE_UNWARN();
+    FdState *f;
+    FdBuf in, out;
+    int32_t ofs, outofs, r;
+    PObject *tpl;
+
+    if (nargs != 5 || !IS_FD_STATE(args[0]) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1])) || !IS_PSMALLINT(args[2]) || PTYPE(args[3]) != PBYTEARRAY || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    f = FD_STATE(args[0]);
+    in.buf = PSEQUENCE_BYTES(args[1]);
+    in.len = PSEQUENCE_ELEMENTS(args[1]);
+    ofs = PSMALLINT_VALUE(args[2]);
+    out.buf = PSEQUENCE_BYTES(args[3]);
+    out.len = PSEQUENCE_ELEMENTS(args[3]);
+    outofs = PSMALLINT_VALUE(args[4]);
+    if (ofs < 0 || ofs > in.len || outofs < 0 || outofs > out.len)
+        return ERR_INDEX_EXC;
+    in.pos = ofs;
+    out.pos = outofs;
+
+    r = fd_run(f, &in, &out);
+    if (r == FD_BAD)
+        return ERR_VALUE_EXC;
+
+    tpl = (PObject*)ptuple_new(3, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(in.pos));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(out.pos));
+    PTUPLE_SET_ITEM(tpl, 2, (r == FD_END) ? PBOOL_TRUE() : PBOOL_FALSE());
+    *res = tpl;
+    return ERR_OK;
+}
@@ -0,0 +1,539 @@
+#include "zerynth.h"
+
+/*
+ * Framebuffer of the framebuf module.
+ *
+ * A framebuffer is a list [state, band0, band1, ...]: state is a bytearray holding the FbState, the bands are
+ * bytearrays of band_rows rows each (the last may be shorter), since a single buffer can't hold a whole display.
+ * RGB565 pixels are 2 bytes, high byte first as the panels want them, so that rows are sent as they are.
+ * MONO_VLSB pixels are bits of bytes covering 8 rows each (lsb on top), in pages of width bytes, as in SSD1306
+ * controllers: a row of the framebuffer is a page.
+ *
+ * Drawing marks the changed area dirty: up to FB_MAX_DIRTY rectangles are kept, merging the ones that touch, and
+ * the pair growing the least when more are needed. A flush sends only the dirty rectangles, each as a window of the
+ * controller followed by its rows, with the GIL released. Full width rectangles go out in one transfer per band.
+ */
+
+#define FB_TAG          0x46425546  /* "FBUF" */
+#define FB_MAX_DIRTY    8
+#define FB_MAX_BAND     0x8000
+
+#define FB_RGB565       0
+#define FB_MONO_VLSB    1
+
+// MIPI DCS commands of RGB565 panels (ST7735, ST7789, ILI9341...)
+#define FB_DCS_CASET    0x2A
+#define FB_DCS_RASET    0x2B
+#define FB_DCS_RAMWR    0x2C
+// SSD1306 commands, in horizontal addressing mode
+#define FB_SSD_COLUMNS  0x21
+#define FB_SSD_PAGES    0x22
+
+typedef struct _fb_rect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+} FbRect;
+
+typedef struct _fb_state {
+    uint32_t tag;
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride;    // bytes of a row (a page for MONO_VLSB)
+    uint16_t rows;      // rows (pages) of the framebuffer
+    uint16_t band_rows;
+    uint8_t format;
+    uint8_t ndirty;
+    FbRect dirty[FB_MAX_DIRTY];
+} FbState;
+
+static FbState *fb_check(PObject *fb)
+{
+    FbState *st;
+    int32_t i, nbands;
+
+    if (PTYPE(fb) != PLIST || PSEQUENCE_ELEMENTS(fb) < 2 || PTYPE(PLIST_ITEM(fb, 0)) != PBYTEARRAY ||
+        PSEQUENCE_ELEMENTS(PLIST_ITEM(fb, 0)) != sizeof(FbState))
+        return NULL;
+    st = (FbState*)PSEQUENCE_BYTES(PLIST_ITEM(fb, 0));
+    if (st->tag != FB_TAG)
+        return NULL;
+    nbands = (st->rows + st->band_rows - 1) / st->band_rows;
+    if (PSEQUENCE_ELEMENTS(fb) != 1 + nbands)
+        return NULL;
+    for (i = 0; i < nbands; i++) {
+        if (PTYPE(PLIST_ITEM(fb, 1 + i)) != PBYTEARRAY ||
+            PSEQUENCE_ELEMENTS(PLIST_ITEM(fb, 1 + i)) < ((i < nbands - 1) ? st->band_rows : st->rows - i * st->band_rows) * st->stride)
+            return NULL;
+    }
+    return st;
+}
+
+static inline uint8_t *fb_row(PObject *fb, FbState *st, int32_t row)
+{
+    return PSEQUENCE_BYTES(PLIST_ITEM(fb, 1 + row / st->band_rows)) + (row % st->band_rows) * st->stride;
+}
+
+static int fb_int(PObject *o, int32_t *v)
+{
+    if (!IS_INTEGER(o))
+        return -1;
+    *v = (int32_t)INTEGER_VALUE(o);
+    return 0;
+}
+
+// clips the rectangle to the framebuffer, returns 0 if nothing is left
+static int fb_clip(FbState *st, int32_t *x, int32_t *y, int32_t *w, int32_t *h)
+{
+    if (*x < 0) {
+        *w += *x;
+        *x = 0;
+    }
+    if (*y < 0) {
+        *h += *y;
+        *y = 0;
+    }
+    if (*x + *w > st->width)
+        *w = st->width - *x;
+    if (*y + *h > st->height)
+        *h = st->height - *y;
+    return *w > 0 && *h > 0;
+}
+
+static inline int32_t fb_area(FbRect *r)
+{
+    return (int32_t)r->w * r->h;
+}
+
+static void fb_union(FbRect *a, FbRect *b, FbRect *u)
+{
+    int32_t x0 = (a->x < b->x) ? a->x : b->x;
+    int32_t y0 = (a->y < b->y) ? a->y : b->y;
+    int32_t x1 = (a->x + a->w > b->x + b->w) ? a->x + a->w : b->x + b->w;
+    int32_t y1 = (a->y + a->h > b->y + b->h) ? a->y + a->h : b->y + b->h;
+
+    u->x = x0;
+    u->y = y0;
+    u->w = x1 - x0;
+    u->h = y1 - y0;
+}
+
+// adds a clipped rectangle to the dirty ones
+static void fb_mark(FbState *st, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    FbRect r, u;
+    int32_t i, best, grow, bgrow;
+
+    if (st->format == FB_MONO_VLSB) {
+        // whole pages
+        h += y & 7;
+        y &= ~7;
+        h = (h + 7) & ~7;
+    }
+    r.x = x;
+    r.y = y;
+    r.w = w;
+    r.h = h;
+again:
+    for (i = 0; i < st->ndirty; i++) {
+        FbRect *d = &st->dirty[i];
+        if (r.x <= d->x + d->w && d->x <= r.x + r.w && r.y <= d->y + d->h && d->y <= r.y + r.h) {
+            // touching or overlapping: merge and look again, the union may reach others
+            fb_union(&r, d, &r);
+            st->dirty[i] = st->dirty[--st->ndirty];
+            goto again;
+        }
+    }
+    if (st->ndirty == FB_MAX_DIRTY) {
+        best = 0;
+        bgrow = 0;
+        for (i = 0; i < st->ndirty; i++) {
+            fb_union(&r, &st->dirty[i], &u);
+            grow = fb_area(&u) - fb_area(&r) - fb_area(&st->dirty[i]);
+            if (!i || grow < bgrow) {
+                best = i;
+                bgrow = grow;
+            }
+        }
+        fb_union(&r, &st->dirty[best], &r);
+        st->dirty[best] = st->dirty[--st->ndirty];
+        goto again;
+    }
+    st->dirty[st->ndirty++] = r;
+}
+
+static inline void fb_set(PObject *fb, FbState *st, int32_t x, int32_t y, uint32_t color)
+{
+    uint8_t *p;
+
+    if (st->format == FB_RGB565) {
+        p = fb_row(fb, st, y) + 2 * x;
+        p[0] = color >> 8;
+        p[1] = color;
+    } else {
+        p = fb_row(fb, st, y >> 3) + x;
+        if (color)
+            *p |= 1 << (y & 7);
+        else
+            *p &= ~(1 << (y & 7));
+    }
+}
+
+static void fb_fill(PObject *fb, FbState *st, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    uint8_t *p, hi = color >> 8, lo = color, bits;
+    int32_t r, i;
+
+    if (st->format == FB_RGB565) {
+        for (r = y; r < y + h; r++) {
+            p = fb_row(fb, st, r) + 2 * x;
+            if (hi == lo) {
+                memset(p, lo, 2 * w);
+            } else {
+                for (i = 0; i < w; i++, p += 2) {
+                    p[0] = hi;
+                    p[1] = lo;
+                }
+            }
+        }
+    } else {
+        for (r = y; r < y + h; r = (r | 7) + 1) {
+            // rows of this page in the rectangle
+            bits = 0xff << (r & 7);
+            if (y + h < ((r | 7) + 1))
+                bits &= 0xff >> (((r | 7) + 1) - (y + h));
+            p = fb_row(fb, st, r >> 3) + x;
+            if (color) {
+                for (i = 0; i < w; i++)
+                    p[i] |= bits;
+            } else {
+                for (i = 0; i < w; i++)
+                    p[i] &= ~bits;
+            }
+        }
+    }
+}
+
+/*
+ * args: width, height, format, band_rows
+ * returns the state of a new framebuffer, for the list of the framebuffer
+ */
+C_NATIVE(__fb_state) {
+    NATIVE_UNWARN();
+    int32_t width, height, format, band_rows, stride, rows;
+    FbState *st;
+
+    if (nargs != 4 || fb_int(args[0], &width) || fb_int(args[1], &height) || fb_int(args[2], &format) || fb_int(args[3], &band_rows))
+        return ERR_TYPE_EXC;
+    if (width < 1 || height < 1 || width > 0x7fff || height > 0x7fff || (format != FB_RGB565 && format != FB_MONO_VLSB))
+        return ERR_VALUE_EXC;
+    stride = (format == FB_RGB565) ? 2 * width : width;
+    rows = (format == FB_RGB565) ? height : (height + 7) / 8;
+    if (band_rows < 1 || band_rows * stride > FB_MAX_BAND)
+        return ERR_VALUE_EXC;
+    *res = psequence_new(PBYTEARRAY, sizeof(FbState));
+    st = (FbState*)PSEQUENCE_BYTES(*res);
+    memset(st, 0, sizeof(FbState));
+    st->tag = FB_TAG;
+    st->width = width;
+    st->height = height;
+    st->stride = stride;
+    st->rows = rows;
+    st->band_rows = (band_rows > rows) ? rows : band_rows;
+    st->format = format;
+    return ERR_OK;
+}
+
+/*
+ * args: fb, x, y, w, h, color
+ * fills the rectangle with color
+ */
+C_NATIVE(__fb_fill_rect) {
+    NATIVE_UNWARN();
+    FbState *st;
+    int32_t x, y, w, h, color;
+
+    if (nargs != 6 || !(st = fb_check(args[0])) || fb_int(args[1], &x) || fb_int(args[2], &y) || fb_int(args[3], &w) ||
+        fb_int(args[4], &h) || fb_int(args[5], &color))
+        return ERR_TYPE_EXC;
+    if (fb_clip(st, &x, &y, &w, &h)) {
+        fb_fill(args[0], st, x, y, w, h, color);
+        fb_mark(st, x, y, w, h);
+    }
+    return ERR_OK;
+}
+
+/*
+ * args: fb, x, y, color
+ * sets the pixel at x, y to color, or returns its color if negative (-1 out of the framebuffer)
+ */
+C_NATIVE(__fb_pixel) {
+    NATIVE_UNWARN();
+    FbState *st;
+    int32_t x, y, color;
+    uint8_t *p;
+
+    if (nargs != 4 || !(st = fb_check(args[0])) || fb_int(args[1], &x) || fb_int(args[2], &y) || fb_int(args[3], &color))
+        return ERR_TYPE_EXC;
+    if (x < 0 || y < 0 || x >= st->width || y >= st->height) {
+        if (color < 0)
+            *res = PSMALLINT_NEW(-1);
+        return ERR_OK;
+    }
+    if (color < 0) {
+        if (st->format == FB_RGB565) {
+            p = fb_row(args[0], st, y) + 2 * x;
+            *res = PSMALLINT_NEW((p[0] << 8) | p[1]);
+        } else {
+            p = fb_row(args[0], st, y >> 3) + x;
+            *res = PSMALLINT_NEW((*p >> (y & 7)) & 1);
+        }
+        return ERR_OK;
+    }
+    fb_set(args[0], st, x, y, color);
+    fb_mark(st, x, y, 1, 1);
+    return ERR_OK;
+}
+
+/*
+ * args: fb, data, x, y, w, h, key
+ * copies an image of w x h pixels at x, y: RGB565 pixels high byte first, or rows of bits msb first for MONO_VLSB,
+ * each row starting on a new byte. Pixels of color key are skipped, unless key is negative
+ */
+C_NATIVE(__fb_blit) {
+    NATIVE_UNWARN();
+    FbState *st;
+    int32_t x, y, w, h, key, sw, i, j, x0, y0, cw, ch, color;
+    const uint8_t *src, *p;
+
+    if (nargs != 7 || !(st = fb_check(args[0])) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1])) || fb_int(args[2], &x) ||
+        fb_int(args[3], &y) || fb_int(args[4], &w) || fb_int(args[5], &h) || fb_int(args[6], &key))
+        return ERR_TYPE_EXC;
+    if (w < 0 || h < 0)
+        return ERR_VALUE_EXC;
+    sw = (st->format == FB_RGB565) ? 2 * w : (w + 7) / 8;
+    if (PSEQUENCE_ELEMENTS(args[1]) < sw * h)
+        return ERR_INDEX_EXC;
+    src = PSEQUENCE_BYTES(args[1]);
+    x0 = x;
+    y0 = y;
+    cw = w;
+    ch = h;
+    if (!fb_clip(st, &x0, &y0, &cw, &ch))
+        return ERR_OK;
+    for (j = y0 - y; j < y0 - y + ch; j++) {
+        p = src + j * sw;
+        if (st->format == FB_RGB565 && key < 0) {
+            memcpy(fb_row(args[0], st, y + j) + 2 * x0, p + 2 * (x0 - x), 2 * cw);
+            continue;
+        }
+        for (i = x0 - x; i < x0 - x + cw; i++) {
+            if (st->format == FB_RGB565)
+                color = (p[2 * i] << 8) | p[2 * i + 1];
+            else
+                color = (p[i >> 3] >> (7 - (i & 7))) & 1;
+            if (color != key)
+                fb_set(args[0], st, x + i, y + j, color);
+        }
+    }
+    fb_mark(st, x0, y0, cw, ch);
+    return ERR_OK;
+}
+
+/*
+ * args: fb, font, text, x, y, fg, bg
+ * draws text with font: 4 bytes (first char, number of chars, width, height) followed by the glyphs, each of height
+ * rows of bits msb first, each row starting on a new byte. bg negative is transparent. Chars out of the font are
+ * skipped (they still advance). Returns x after the text
+ */
+C_NATIVE(__fb_text) {
+    NATIVE_UNWARN();
+    FbState *st;
+    int32_t x, y, fg, bg, len, k, i, j, rb, gw, gh, x0, y0, cw, ch;
+    uint8_t *text, *font, *g;
+    uint32_t flen;
+
+    if (nargs != 7 || !(st = fb_check(args[0])) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1])) ||
+        !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[2])) || fb_int(args[3], &x) || fb_int(args[4], &y) || fb_int(args[5], &fg) ||
+        fb_int(args[6], &bg))
+        return ERR_TYPE_EXC;
+    font = PSEQUENCE_BYTES(args[1]);
+    flen = PSEQUENCE_ELEMENTS(args[1]);
+    if (flen < 4 || !font[2] || !font[3])
+        return ERR_VALUE_EXC;
+    gw = font[2];
+    gh = font[3];
+    rb = (gw + 7) / 8;
+    if (flen < 4 + (uint32_t)font[1] * rb * gh)
+        return ERR_VALUE_EXC;
+    text = PSEQUENCE_BYTES(args[2]);
+    len = PSEQUENCE_ELEMENTS(args[2]);
+
+    x0 = x;
+    y0 = y;
+    cw = gw * len;
+    ch = gh;
+    for (k = 0; k < len; k++, x += gw) {
+        if (text[k] < font[0] || text[k] >= font[0] + font[1] || x >= st->width || x + gw <= 0 || y >= st->height || y + gh <= 0)
+            continue;
+        g = font + 4 + (text[k] - font[0]) * rb * gh;
+        for (j = 0; j < gh; j++) {
+            if (y + j < 0 || y + j >= st->height)
+                continue;
+            for (i = 0; i < gw; i++) {
+                if (x + i < 0 || x + i >= st->width)
+                    continue;
+                if ((g[j * rb + (i >> 3)] >> (7 - (i & 7))) & 1)
+                    fb_set(args[0], st, x + i, y + j, fg);
+                else if (bg >= 0)
+                    fb_set(args[0], st, x + i, y + j, bg);
+            }
+        }
+    }
+    if (fb_clip(st, &x0, &y0, &cw, &ch))
+        fb_mark(st, x0, y0, cw, ch);
+    *res = PSMALLINT_NEW(x);
+    return ERR_OK;
+}
+
+/*
+ * args: fb, x, y, w, h
+ * marks the rectangle dirty
+ */
+C_NATIVE(__fb_mark) {
+    NATIVE_UNWARN();
+    FbState *st;
+    int32_t x, y, w, h;
+
+    if (nargs != 5 || !(st = fb_check(args[0])) || fb_int(args[1], &x) || fb_int(args[2], &y) || fb_int(args[3], &w) ||
+        fb_int(args[4], &h))
+        return ERR_TYPE_EXC;
+    if (fb_clip(st, &x, &y, &w, &h))
+        fb_mark(st, x, y, w, h);
+    return ERR_OK;
+}
+
+/*
+ * args: fb
+ * returns the dirty rectangles as bytes of FbRect, and clears them
+ */
+C_NATIVE(__fb_take) {
+    NATIVE_UNWARN();
+    FbState *st;
+
+    if (nargs != 1 || !(st = fb_check(args[0])))
+        return ERR_TYPE_EXC;
+    *res = (PObject*)pbytes_new(st->ndirty * sizeof(FbRect), (uint8_t*)st->dirty);
+    st->ndirty = 0;
+    return ERR_OK;
+}
+
+static int32_t fb_command(uint32_t drv, int32_t dc, uint8_t *cmd, int32_t len)
+{
+    vhalPinWrite(dc, 0);
+    return vhalSpiExchange(drv, cmd, NULL, len);
+}
+
+static int32_t fb_data(uint32_t drv, int32_t dc, uint8_t *data, int32_t len)
+{
+    vhalPinWrite(dc, 1);
+    return vhalSpiExchange(drv, data, NULL, len);
+}
+
+// sends the window of rectangle r and its rows
+static int32_t fb_send_rect(PObject *fb, FbState *st, FbRect *r, uint32_t drv, int32_t dc, int32_t xoff, int32_t yoff)
+{
+    uint8_t cmd[6];
+    int32_t err, row, last, bpp, n;
+
+    if (st->format == FB_RGB565) {
+        bpp = 2;
+        row = r->y;
+        last = r->y + r->h - 1;
+        cmd[0] = FB_DCS_CASET;
+        cmd[1] = (r->x + xoff) >> 8;
+        cmd[2] = r->x + xoff;
+        cmd[3] = (r->x + r->w - 1 + xoff) >> 8;
+        cmd[4] = r->x + r->w - 1 + xoff;
+        if ((err = fb_command(drv, dc, cmd, 1)) < 0 || (err = fb_data(drv, dc, cmd + 1, 4)) < 0)
+            return err;
+        cmd[0] = FB_DCS_RASET;
+        cmd[1] = (row + yoff) >> 8;
+        cmd[2] = row + yoff;
+        cmd[3] = (last + yoff) >> 8;
+        cmd[4] = last + yoff;
+        if ((err = fb_command(drv, dc, cmd, 1)) < 0 || (err = fb_data(drv, dc, cmd + 1, 4)) < 0)
+            return err;
+        cmd[0] = FB_DCS_RAMWR;
+        if ((err = fb_command(drv, dc, cmd, 1)) < 0)
+            return err;
+    } else {
+        bpp = 1;
+        row = r->y >> 3;
+        last = (r->y + r->h - 1) >> 3;
+        if (last >= st->rows)
+            last = st->rows - 1;
+        cmd[0] = FB_SSD_COLUMNS;
+        cmd[1] = r->x + xoff;
+        cmd[2] = r->x + r->w - 1 + xoff;
+        cmd[3] = FB_SSD_PAGES;
+        cmd[4] = row + yoff;
+        cmd[5] = last + yoff;
+        if ((err = fb_command(drv, dc, cmd, 6)) < 0)
+            return err;
+    }
+    while (row <= last) {
+        // full width rows are contiguous up to the end of their band
+        n = 1;
+        if (r->w == st->width) {
+            n = st->band_rows - row % st->band_rows;
+            if (n > last - row + 1)
+                n = last - row + 1;
+        }
+        if ((err = fb_data(drv, dc, fb_row(fb, st, row) + bpp * r->x, n * bpp * r->w)) < 0)
+            return err;
+        row += n;
+    }
+    return 0;
+}
+
+/*
+ * args: fb, rects, drvid, nss, dc, lock, xoff, yoff
+ * sends the rectangles taken by __fb_take through the spi driver drvid, already configured by the Spi instance of nss.
+ * dc is the data/command pin, xoff and yoff the position of the framebuffer in the memory of the controller
+ */
+C_NATIVE(__fb_flush) {
+    NATIVE_UNWARN();
+    FbState *st;
+    FbRect *rects;
+    int32_t n, drvid, nss, dc, lock, xoff, yoff, i, err = 0;
+
+    if (nargs != 8 || !(st = fb_check(args[0])) || PTYPE(args[1]) != PBYTES || fb_int(args[2], &drvid) ||
+        fb_int(args[3], &nss) || fb_int(args[4], &dc) || fb_int(args[5], &lock) || fb_int(args[6], &xoff) || fb_int(args[7], &yoff))
+        return ERR_TYPE_EXC;
+    n = PSEQUENCE_ELEMENTS(args[1]) / sizeof(FbRect);
+    rects = (FbRect*)PSEQUENCE_BYTES(args[1]);
+    for (i = 0; i < n; i++)
+        if (rects[i].x < 0 || rects[i].y < 0 || rects[i].w < 1 || rects[i].h < 1 ||
+            rects[i].x + rects[i].w > st->width || rects[i].y + rects[i].h > st->height + 7)
+            return ERR_VALUE_EXC;
+    if (!n)
+        return ERR_OK;
+    drvid &= 0xff;
+    RELEASE_GIL();
+    if (lock)
+        err = vhalSpiLock(drvid);
+    if (err >= 0) {
+        vhalPinWrite(nss, 0);
+        for (i = 0; i < n && err >= 0; i++)
+            err = fb_send_rect(args[0], st, &rects[i], drvid, dc, xoff, yoff);
+        vhalPinWrite(nss, 1);
+        if (lock)
+            vhalSpiUnlock(drvid);
+    }
+    ACQUIRE_GIL();
+    if (err < 0)
+        return -err;
+    return ERR_OK;
+}
@@ -0,0 +1,748 @@
+#include "zerynth.h"
+#include "ftl.h"
+#include "../spiflash/spiflash.h"
+
+/*
+ * Log structured flash translation layer.
+ *
+ * The flash region is divided in blocks of one erase unit. The first 512 bytes slot of a block holds
+ * the header and a tag for each of the other slots, which store logical sectors. A sector write
+ * programs the next free slot of the active block and then its tag (logical sector and its complement),
+ * and finally clears the tag of the previous copy: NOR programming only clears bits, so nothing is
+ * erased in the write path and a write interrupted at any point leaves the old or the new copy.
+ * Copies surviving an interrupted write are told apart by the sequence number of their blocks.
+ *
+ * The page map (2 bytes per logical sector), the live sectors and the erase count of each block are
+ * kept in RAM and rebuilt by scanning the headers at attach. When the active block is full, the least
+ * erased free block is opened (dynamic wear levelling); when less than two free blocks are left, the
+ * live sectors of the block with fewer of them are moved to the active block (garbage collection).
+ * Keeping at least FTL_SPARE_BLOCKS blocks worth of sectors unmapped guarantees that such a block
+ * has a free slot at least, so that each collection gains some room.
+ *
+ * Flash accesses are done without the GIL, holding the mutex of the volume.
+ */
+
+#define FTL_QSPI            0
+#define FTL_SPI             1
+
+#define FTL_MAGIC           0x4C54465A
+#define FTL_HDR_SIZE        16
+#define FTL_MIN_SLOTS       4
+#define FTL_MAX_SLOTS       ((FTL_SECTOR_SIZE - FTL_HDR_SIZE) / sizeof(FtlTag) + 1)
+#define FTL_SPARE_BLOCKS    3
+#define FTL_NONE            0xFFFF
+
+// milliseconds to wait for the end of page program and sector erase on spiflash
+#define FTL_SPI_PAGE_TIMEOUT    100
+#define FTL_SPI_ERASE_TIMEOUT   3000
+
+typedef struct _ftl_header {
+    uint32_t magic;         /* programmed last */
+    uint32_t erase_count;
+    uint32_t seq;           /* order in which blocks have been opened */
+    uint16_t slots;
+    uint16_t reserved;
+} FtlHeader;
+
+typedef struct _ftl_tag {
+    uint16_t lsn;
+    uint16_t chk;           /* ~lsn for a live sector, 0 once obsolete */
+} FtlTag;
+
+/* a free tag is only ever programmed with a valid value, that an interrupted program can't
+   produce from another one, and a valid tag only with 0 */
+#define FTL_TAG_FREE(t)     ((t).lsn == 0xFFFF && (t).chk == 0xFFFF)
+#define FTL_TAG_VALID(t)    ((t).chk == (uint16_t)~(t).lsn)
+
+typedef struct _ftl_volume {
+    VMutex mtx;
+    uint8_t in_use;
+    uint8_t type;
+    uint8_t drv;            /* spi driver of spiflash */
+    uint8_t erase_cmd;      /* erase command of spiflash */
+    uint32_t page_size;
+    uint32_t start;         /* flash address of the first block */
+    uint32_t block_size;
+    uint16_t nblocks;
+    uint16_t slots;         /* slots per block, header included */
+    uint16_t nsectors;
+    uint16_t next;          /* next free slot of the active block */
+    int32_t active;
+    uint32_t seq;
+    uint16_t *map;          /* logical sector -> block * slots + slot */
+    uint8_t *valid;         /* live sectors of each block */
+    uint32_t *erases;
+    FtlTag *tags;
+    uint8_t *buf;
+    uint32_t gc_runs;
+    uint32_t moved;
+} FtlVolume;
+
+static FtlVolume ftl_volumes[FTL_MAX_VOLUMES];
+
+#define FTL_ADDR(f, b, s)   ((b) * (f)->block_size + (s) * FTL_SECTOR_SIZE)
+
+/*-----------------------------------------------------------------------*/
+/* Flash access                                                          */
+/*-----------------------------------------------------------------------*/
+
+static int ftl_read(FtlVolume *f, uint32_t addr, uint8_t *buf, uint32_t len)
+{
+    addr += f->start;
+    if (f->type == FTL_SPI)
+        return spiflash_dev_read(f->drv, addr, buf, len) < 0;
+#if defined(VHAL_QSPIFLASH)
+    return vhalQspiFlashRead(0, addr, buf, len) != VHAL_OK;
+#else
+    return 1;
+#endif
+}
+
+static int ftl_prog(FtlVolume *f, uint32_t addr, const uint8_t *data, uint32_t len)
+{
+    addr += f->start;
+    if (f->type == FTL_SPI)
+        return spiflash_dev_write(f->drv, addr, data, len, f->page_size, FTL_SPI_PAGE_TIMEOUT) < 0;
+#if defined(VHAL_QSPIFLASH)
+    uint32_t n;
+
+    while (len > 0) {
+        n = f->page_size - (addr & (f->page_size - 1));
+        if (n > len)
+            n = len;
+        if (vhalQspiFlashWrite(0, addr, (uint8_t *)data, n) != VHAL_OK)
+            return 1;
+        addr += n;
+        data += n;
+        len -= n;
+    }
+    return 0;
+#else
+    return 1;
+#endif
+}
+
+static int ftl_erase(FtlVolume *f, uint32_t b)
+{
+    uint32_t addr = f->start + FTL_ADDR(f, b, 0);
+
+    if (f->type == FTL_SPI)
+        return spiflash_dev_erase(f->drv, f->erase_cmd, addr, FTL_SPI_ERASE_TIMEOUT) < 0;
+#if defined(VHAL_QSPIFLASH)
+    return vhalQspiFlashEraseSector(0, addr, 1) != VHAL_OK;
+#else
+    return 1;
+#endif
+}
+
+static int ftl_put_tag(FtlVolume *f, uint32_t b, uint32_t s, uint16_t lsn, uint16_t chk)
+{
+    FtlTag t;
+
+    t.lsn = lsn;
+    t.chk = chk;
+    return ftl_prog(f, FTL_ADDR(f, b, 0) + FTL_HDR_SIZE + (s - 1) * sizeof(FtlTag), (uint8_t *)&t, sizeof(t));
+}
+
+/*-----------------------------------------------------------------------*/
+/* Log                                                                   */
+/*-----------------------------------------------------------------------*/
+
+// forgets the copy in slot p: a failed mark is resolved by the sequence numbers at the next attach
+static void ftl_drop(FtlVolume *f, uint16_t p)
+{
+    uint32_t b = p / f->slots;
+
+    f->valid[b]--;
+    ftl_put_tag(f, b, p % f->slots, 0, 0);
+}
+
+static int ftl_free_blocks(FtlVolume *f)
+{
+    int32_t b, n = 0;
+
+    for (b = 0; b < f->nblocks; b++) {
+        if (b != f->active && !f->valid[b])
+            n++;
+    }
+    return n;
+}
+
+// erases the least erased free block and makes it the active one
+static int ftl_open_block(FtlVolume *f)
+{
+    int32_t b, best = -1;
+    FtlHeader h;
+
+    for (b = 0; b < f->nblocks; b++) {
+        if (b != f->active && !f->valid[b] && (best < 0 || f->erases[b] < f->erases[best]))
+            best = b;
+    }
+    if (best < 0 || ftl_erase(f, best))
+        return -1;
+    f->erases[best]++;
+
+    h.magic = FTL_MAGIC;
+    h.erase_count = f->erases[best];
+    h.seq = ++f->seq;
+    h.slots = f->slots;
+    h.reserved = 0xFFFF;
+    // a torn header leaves the block unformatted
+    if (ftl_prog(f, FTL_ADDR(f, best, 0) + 4, ((uint8_t *)&h) + 4, FTL_HDR_SIZE - 4) || ftl_prog(f, FTL_ADDR(f, best, 0), (uint8_t *)&h, 4))
+        return -1;
+    f->active = best;
+    f->next = 1;
+    return 0;
+}
+
+// stores data in the next slot of the active block as the newest copy of lsn
+static int ftl_append(FtlVolume *f, uint16_t lsn, const uint8_t *data)
+{
+    uint16_t old = f->map[lsn];
+    uint32_t s = f->next++;
+
+    // the slot is skipped on failure: clearing a free tag could tear into a valid one
+    if (ftl_prog(f, FTL_ADDR(f, f->active, s), data, FTL_SECTOR_SIZE) || ftl_put_tag(f, f->active, s, lsn, ~lsn))
+        return -1;
+    f->map[lsn] = f->active * f->slots + s;
+    f->valid[f->active]++;
+    if (old != FTL_NONE)
+        ftl_drop(f, old);
+    return 0;
+}
+
+// moves the live sectors of the block with fewer of them to the active block, opening a new one when it is full
+static int ftl_collect(FtlVolume *f)
+{
+    int32_t b, victim = -1;
+    uint32_t s;
+    uint16_t lsn;
+
+    for (b = 0; b < f->nblocks; b++) {
+        if (b != f->active && f->valid[b] && (victim < 0 || f->valid[b] < f->valid[victim] || (f->valid[b] == f->valid[victim] && f->erases[b] < f->erases[victim])))
+            victim = b;
+    }
+    if (victim < 0 || ftl_read(f, FTL_ADDR(f, victim, 0) + FTL_HDR_SIZE, (uint8_t *)f->tags, (f->slots - 1) * sizeof(FtlTag)))
+        return -1;
+    for (s = 1; s < f->slots && f->valid[victim]; s++) {
+        lsn = f->tags[s - 1].lsn;
+        if (!FTL_TAG_VALID(f->tags[s - 1]) || lsn >= f->nsectors || f->map[lsn] != victim * f->slots + s)
+            continue;
+        if (f->next >= f->slots && ftl_open_block(f))
+            return -1;
+        if (ftl_read(f, FTL_ADDR(f, victim, s), f->buf, FTL_SECTOR_SIZE) || ftl_append(f, lsn, f->buf))
+            return -1;
+        f->moved++;
+    }
+    f->gc_runs++;
+    return 0;
+}
+
+// makes sure the active block has a free slot
+static int ftl_make_room(FtlVolume *f)
+{
+    // two free blocks are kept, so that a collection interrupted after opening one still finds
+    // room for the rest of its victim in the active block at the next attach
+    while (ftl_free_blocks(f) < 2) {
+        if (ftl_collect(f))
+            return -1;
+    }
+    if (f->active >= 0 && f->next < f->slots)
+        return 0;
+    return ftl_open_block(f);
+}
+
+static int ftl_read_sector(FtlVolume *f, uint32_t lsn, uint8_t *data)
+{
+    uint16_t p = f->map[lsn];
+
+    if (p == FTL_NONE) {
+        // never written or trimmed
+        memset(data, 0xff, FTL_SECTOR_SIZE);
+        return 0;
+    }
+    return ftl_read(f, FTL_ADDR(f, p / f->slots, p % f->slots), data, FTL_SECTOR_SIZE);
+}
+
+static int ftl_write_sector(FtlVolume *f, uint32_t lsn, const uint8_t *data)
+{
+    if (ftl_make_room(f))
+        return -1;
+    return ftl_append(f, lsn, data);
+}
+
+static void ftl_trim_sector(FtlVolume *f, uint32_t lsn)
+{
+    uint16_t p = f->map[lsn];
+
+    if (p != FTL_NONE) {
+        f->map[lsn] = FTL_NONE;
+        ftl_drop(f, p);
+    }
+}
+
+// rebuilds the page map from the headers; seqs has room for the sequence number of each block
+static int ftl_scan(FtlVolume *f, uint32_t *seqs)
+{
+    uint32_t b, s, p, q, known = 0, unknown = 0;
+    uint64_t total = 0;
+    FtlHeader h;
+    FtlTag *t;
+
+    memset(f->map, 0xff, f->nsectors * sizeof(uint16_t));
+    f->seq = 0;
+    f->active = -1;
+    f->next = f->slots;
+    for (b = 0; b < f->nblocks; b++) {
+        f->valid[b] = 0;
+        seqs[b] = 0;
+        if (ftl_read(f, FTL_ADDR(f, b, 0), (uint8_t *)&h, FTL_HDR_SIZE))
+            return -1;
+        if (h.magic != FTL_MAGIC || h.slots != f->slots) {
+            // unformatted or torn header: it is free, and its erase count is kept if it was programmed
+            if (h.slots == f->slots && h.erase_count != 0xFFFFFFFF) {
+                f->erases[b] = h.erase_count;
+                total += h.erase_count;
+                known++;
+            } else {
+                f->erases[b] = 0xFFFFFFFF;
+                unknown++;
+            }
+            continue;
+        }
+        f->erases[b] = h.erase_count;
+        total += h.erase_count;
+        known++;
+        seqs[b] = h.seq;
+        if (f->active < 0 || h.seq > f->seq) {
+            f->active = b;
+            f->seq = h.seq;
+        }
+
+        if (ftl_read(f, FTL_ADDR(f, b, 0) + FTL_HDR_SIZE, (uint8_t *)f->tags, (f->slots - 1) * sizeof(FtlTag)))
+            return -1;
+        for (s = 1; s < f->slots; s++) {
+            t = &f->tags[s - 1];
+            if (!FTL_TAG_VALID(*t) || t->lsn >= f->nsectors)
+                continue;
+            p = b * f->slots + s;
+            q = f->map[t->lsn];
+            if (q != FTL_NONE) {
+                // two copies left by an interrupted write: the newest one wins
+                if (seqs[q / f->slots] > h.seq) {
+                    ftl_put_tag(f, b, s, 0, 0);
+                    continue;
+                }
+                ftl_drop(f, q);
+            }
+            f->map[t->lsn] = p;
+            f->valid[b]++;
+        }
+    }
+
+    if (unknown) {
+        for (b = 0; b < f->nblocks; b++) {
+            if (f->erases[b] == 0xFFFFFFFF)
+                f->erases[b] = known ? total / known : 0;
+        }
+    }
+
+    if (f->active >= 0) {
+        // appends resume after the last programmed slot of the newest block
+        if (ftl_read(f, FTL_ADDR(f, f->active, 0) + FTL_HDR_SIZE, (uint8_t *)f->tags, (f->slots - 1) * sizeof(FtlTag)))
+            return -1;
+        for (s = f->slots - 1; s > 0 && FTL_TAG_FREE(f->tags[s - 1]); s--);
+        f->next = s + 1;
+        if (f->next < f->slots) {
+            // the data of a slot whose tag was not programmed may be partially written
+            if (ftl_read(f, FTL_ADDR(f, f->active, f->next), f->buf, FTL_SECTOR_SIZE))
+                return -1;
+            for (p = 0; p < FTL_SECTOR_SIZE && f->buf[p] == 0xff; p++);
+            if (p < FTL_SECTOR_SIZE)
+                f->next++;
+        }
+    }
+    return 0;
+}
+
+static void ftl_release(FtlVolume *f)
+{
+    f->in_use = 0;
+    if (f->map) gc_free(f->map);
+    if (f->valid) gc_free(f->valid);
+    if (f->erases) gc_free(f->erases);
+    if (f->tags) gc_free(f->tags);
+    if (f->buf) gc_free(f->buf);
+    f->map = NULL;
+    f->valid = NULL;
+    f->erases = NULL;
+    f->tags = NULL;
+    f->buf = NULL;
+}
+
+static FtlVolume *ftl_get(int32_t id)
+{
+    if (id < 0 || id >= FTL_MAX_VOLUMES || !ftl_volumes[id].in_use)
+        return NULL;
+    return &ftl_volumes[id];
+}
+
+// returns the volume locked, or NULL if it is not (or no more) attached
+static FtlVolume *ftl_lock(int32_t id)
+{
+    FtlVolume *f = ftl_get(id);
+
+    if (f) {
+        vosMtxLock(f->mtx);
+        if (!f->in_use) {
+            vosMtxUnlock(f->mtx);
+            f = NULL;
+        }
+    }
+    return f;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Disk entry points                                                     */
+/*-----------------------------------------------------------------------*/
+
+DSTATUS ftl_disk_status(uint32_t id)
+{
+    return ftl_get(id) ? 0 : STA_NOINIT;
+}
+
+DRESULT ftl_disk_read(uint32_t id, uint8_t *buff, uint32_t sector, uint32_t count)
+{
+    FtlVolume *f = ftl_lock(id);
+    DRESULT r = RES_OK;
+
+    if (!f)
+        return RES_NOTRDY;
+    if (sector >= f->nsectors || count > f->nsectors - sector) {
+        vosMtxUnlock(f->mtx);
+        return RES_PARERR;
+    }
+    for (; count && r == RES_OK; count--, sector++, buff += FTL_SECTOR_SIZE) {
+        if (ftl_read_sector(f, sector, buff))
+            r = RES_ERROR;
+    }
+    vosMtxUnlock(f->mtx);
+    return r;
+}
+
+DRESULT ftl_disk_write(uint32_t id, const uint8_t *buff, uint32_t sector, uint32_t count)
+{
+    FtlVolume *f = ftl_lock(id);
+    DRESULT r = RES_OK;
+
+    if (!f)
+        return RES_NOTRDY;
+    if (sector >= f->nsectors || count > f->nsectors - sector) {
+        vosMtxUnlock(f->mtx);
+        return RES_PARERR;
+    }
+    for (; count && r == RES_OK; count--, sector++, buff += FTL_SECTOR_SIZE) {
+        if (ftl_write_sector(f, sector, buff))
+            r = RES_ERROR;
+    }
+    vosMtxUnlock(f->mtx);
+    return r;
+}
+
+DRESULT ftl_disk_ioctl(uint32_t id, uint8_t cmd, void *buff)
+{
+    FtlVolume *f = ftl_lock(id);
+    DWORD *range;
+    DRESULT r = RES_OK;
+
+    if (!f)
+        return RES_NOTRDY;
+    switch (cmd) {
+        case CTRL_SYNC:
+            // sectors are durable when disk_write returns
+            break;
+        case GET_SECTOR_COUNT:
+            *(DWORD *)buff = f->nsectors;
+            break;
+        case GET_SECTOR_SIZE:
+            *(WORD *)buff = FTL_SECTOR_SIZE;
+            break;
+        case GET_BLOCK_SIZE:
+            // erase units are hidden by the translation
+            *(DWORD *)buff = 1;
+            break;
+        case CTRL_TRIM:
+            range = (DWORD *)buff;
+            if (range[0] > range[1] || range[1] >= f->nsectors) {
+                r = RES_PARERR;
+                break;
+            }
+            for (; range[0] <= range[1]; range[0]++)
+                ftl_trim_sector(f, range[0]);
+            break;
+        default:
+            r = RES_PARERR;
+    }
+    vosMtxUnlock(f->mtx);
+    return r;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Natives                                                               */
+/*-----------------------------------------------------------------------*/
+
+/*
+ * args: type, drv, start, size, block_size, page_size, erase_cmd, sectors
+ * attaches the flash region [start, start+size) and returns the volume id. With sectors 0 the
+ * logical size leaves 1/8 of the blocks (FTL_SPARE_BLOCKS at least) for garbage collection.
+ */
+C_NATIVE(ftl_attach)
+{
+    C_NATIVE_UNWARN();
+    int32_t type, drv, start, size, block_size, page_size, erase_cmd, sectors, id, nblocks, slots, spare, err;
+    uint32_t *seqs;
+    FtlVolume *f;
+
+    if (parse_py_args("iiiiiiii", nargs, args, &type, &drv, &start, &size, &block_size, &page_size, &erase_cmd, &sectors) != 8)
+        return ERR_TYPE_EXC;
+    if ((type != FTL_QSPI && type != FTL_SPI) || start < 0 || size <= 0 || sectors < 0 || page_size <= 0 || (page_size & (page_size - 1)))
+        return ERR_VALUE_EXC;
+    if (block_size <= 0 || block_size % FTL_SECTOR_SIZE || start % block_size)
+        return ERR_VALUE_EXC;
+    slots = block_size / FTL_SECTOR_SIZE;
+    nblocks = size / block_size;
+    if (slots < FTL_MIN_SLOTS || slots > FTL_MAX_SLOTS || nblocks <= FTL_SPARE_BLOCKS || nblocks * slots >= FTL_NONE)
+        return ERR_VALUE_EXC;
+    spare = nblocks / 8;
+    if (spare < FTL_SPARE_BLOCKS)
+        spare = FTL_SPARE_BLOCKS;
+    if (!sectors)
+        sectors = (nblocks - spare) * (slots - 1);
+    if (sectors > (nblocks - FTL_SPARE_BLOCKS) * (slots - 1))
+        return ERR_VALUE_EXC;
+
+    for (id = 0; id < FTL_MAX_VOLUMES && ftl_volumes[id].in_use; id++);
+    if (id >= FTL_MAX_VOLUMES)
+        return ERR_RUNTIME_EXC;
+    f = &ftl_volumes[id];
+    if (!f->mtx)
+        f->mtx = vosMtxCreate();
+
+    f->type = type;
+    f->drv = drv & 0xff;
+    f->erase_cmd = erase_cmd;
+    f->page_size = page_size;
+    f->start = start;
+    f->block_size = block_size;
+    f->nblocks = nblocks;
+    f->slots = slots;
+    f->nsectors = sectors;
+    f->gc_runs = 0;
+    f->moved = 0;
+    f->map = gc_malloc(sectors * sizeof(uint16_t));
+    f->valid = gc_malloc(nblocks);
+    f->erases = gc_malloc(nblocks * sizeof(uint32_t));
+    f->tags = gc_malloc((slots - 1) * sizeof(FtlTag));
+    f->buf = gc_malloc(FTL_SECTOR_SIZE);
+    seqs = gc_malloc(nblocks * sizeof(uint32_t));
+    f->in_use = 1;
+
+    RELEASE_GIL();
+    vosMtxLock(f->mtx);
+    err = ftl_scan(f, seqs);
+    vosMtxUnlock(f->mtx);
+    ACQUIRE_GIL();
+    gc_free(seqs);
+    if (err) {
+        ftl_release(f);
+        return ERR_IOERROR_EXC;
+    }
+    *res = PSMALLINT_NEW(id);
+    return ERR_OK;
+}
+
+/*
+ * args: id
+ */
+C_NATIVE(ftl_detach)
+{
+    C_NATIVE_UNWARN();
+    FtlVolume *f;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !(f = ftl_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    vosMtxLock(f->mtx);
+    f->in_use = 0;
+    vosMtxUnlock(f->mtx);
+    ACQUIRE_GIL();
+    ftl_release(f);
+    return ERR_OK;
+}
+
+/*
+ * args: id, sector, buffer, ofs, count
+ * reads count sectors into the bytearray buffer starting at ofs
+ */
+C_NATIVE(ftl_read_sectors)
+{
+    C_NATIVE_UNWARN();
+    int32_t sector, ofs, count;
+    DRESULT r;
+    FtlVolume *f;
+
+    if (nargs != 5 || !IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[1]) || PTYPE(args[2]) != PBYTEARRAY || !IS_PSMALLINT(args[3]) || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    if (!(f = ftl_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+    sector = PSMALLINT_VALUE(args[1]);
+    ofs = PSMALLINT_VALUE(args[3]);
+    count = PSMALLINT_VALUE(args[4]);
+    if (sector < 0 || ofs < 0 || count < 0 || ofs + count * FTL_SECTOR_SIZE > PSEQUENCE_ELEMENTS(args[2]))
+        return ERR_INDEX_EXC;
+    if (!count)
+        return ERR_OK;
+
+    RELEASE_GIL();
+    r = ftl_disk_read(PSMALLINT_VALUE(args[0]), PSEQUENCE_BYTES(args[2]) + ofs, sector, count);
+    ACQUIRE_GIL();
+    if (r == RES_PARERR)
+        return ERR_INDEX_EXC;
+    if (r != RES_OK)
+        return ERR_IOERROR_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: id, sector, data
+ * writes the sectors in data, whose length must be a multiple of the sector size
+ */
+C_NATIVE(ftl_write_sectors)
+{
+    C_NATIVE_UNWARN();
+    int32_t id, sector, len;
+    uint8_t *data;
+    DRESULT r;
+
+    if (parse_py_args("iis", nargs, args, &id, &sector, &data, &len) != 3)
+        return ERR_TYPE_EXC;
+    if (!ftl_get(id) || len % FTL_SECTOR_SIZE)
+        return ERR_VALUE_EXC;
+    if (sector < 0)
+        return ERR_INDEX_EXC;
+    if (!len)
+        return ERR_OK;
+
+    RELEASE_GIL();
+    r = ftl_disk_write(id, data, sector, len / FTL_SECTOR_SIZE);
+    ACQUIRE_GIL();
+    if (r == RES_PARERR)
+        return ERR_INDEX_EXC;
+    if (r != RES_OK)
+        return ERR_IOERROR_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: id, sector, count
+ * unmaps count sectors, that read as 0xff until written again
+ */
+C_NATIVE(ftl_trim)
+{
+    C_NATIVE_UNWARN();
+    int32_t id, sector, count;
+    DWORD range[2];
+    DRESULT r;
+
+    if (parse_py_args("iii", nargs, args, &id, &sector, &count) != 3)
+        return ERR_TYPE_EXC;
+    if (!ftl_get(id))
+        return ERR_VALUE_EXC;
+    if (sector < 0 || count < 0)
+        return ERR_INDEX_EXC;
+    if (!count)
+        return ERR_OK;
+
+    range[0] = sector;
+    range[1] = sector + count - 1;
+    RELEASE_GIL();
+    r = ftl_disk_ioctl(id, CTRL_TRIM, range);
+    ACQUIRE_GIL();
+    if (r != RES_OK)
+        return ERR_INDEX_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: id
+ * erases every block of the volume, keeping the erase counts, and unmaps all the sectors
+ */
+C_NATIVE(ftl_format)
+{
+    C_NATIVE_UNWARN();
+    FtlVolume *f;
+    uint32_t b;
+    int32_t err = 0;
+    FtlHeader h;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !(f = ftl_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(f->mtx);
+    memset(f->map, 0xff, f->nsectors * sizeof(uint16_t));
+    memset(f->valid, 0, f->nblocks);
+    f->active = -1;
+    f->next = f->slots;
+    for (b = 0; b < f->nblocks && !err; b++) {
+        err = ftl_erase(f, b);
+        f->erases[b]++;
+        // header without magic: the block stays free and its erase count survives a restart
+        h.erase_count = f->erases[b];
+        h.seq = 0;
+        h.slots = f->slots;
+        h.reserved = 0xFFFF;
+        if (!err)
+            err = ftl_prog(f, FTL_ADDR(f, b, 0) + 4, ((uint8_t *)&h) + 4, FTL_HDR_SIZE - 4);
+    }
+    vosMtxUnlock(f->mtx);
+    ACQUIRE_GIL();
+    if (err)
+        return ERR_IOERROR_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: id
+ * returns (sectors, free blocks, min erase count, max erase count, garbage collections, moved sectors)
+ */
+C_NATIVE(ftl_stats)
+{
+    C_NATIVE_UNWARN();
+    FtlVolume *f;
+    uint32_t b, emin = 0xFFFFFFFF, emax = 0, nfree;
+    PTuple *tpl;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !(f = ftl_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(f->mtx);
+    for (b = 0; b < f->nblocks; b++) {
+        if (f->erases[b] < emin) emin = f->erases[b];
+        if (f->erases[b] > emax) emax = f->erases[b];
+    }
+    nfree = ftl_free_blocks(f);
+    vosMtxUnlock(f->mtx);
+    ACQUIRE_GIL();
+
+    tpl = ptuple_new(6, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(f->nsectors));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(nfree));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(emin));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(emax));
+    PTUPLE_SET_ITEM(tpl, 4, PSMALLINT_NEW(f->gc_runs));
+    PTUPLE_SET_ITEM(tpl, 5, PSMALLINT_NEW(f->moved));
+    *res = tpl;
+    return ERR_OK;
+}
@@ -0,0 +1,22 @@
+#ifndef __FTL__
+#define __FTL__
+
+#include "../fatfs/diskio.h"
+
+/*
+ * Flash translation layer: 512 bytes logical sectors stored in a log over qspiflash or spiflash.
+ * The disk entry points are called by diskio.c with the GIL released.
+ */
+
+#define FTL_SECTOR_SIZE 512
+
+#ifndef FTL_MAX_VOLUMES
+#define FTL_MAX_VOLUMES 2
+#endif
+
+DSTATUS ftl_disk_status(uint32_t id);
+DRESULT ftl_disk_read(uint32_t id, uint8_t *buff, uint32_t sector, uint32_t count);
+DRESULT ftl_disk_write(uint32_t id, const uint8_t *buff, uint32_t sector, uint32_t count);
+DRESULT ftl_disk_ioctl(uint32_t id, uint8_t cmd, void *buff);
+
+#endif
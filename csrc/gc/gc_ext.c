@@ -0,0 +1,315 @@
+#include "zerynth.h"
+#include "gc_ext.h"
+
+/*
+ * The external region is split in blocks: an ExtBlock header followed, when used, by a bytearray and its buffer laid
+ * out as the VM lays them in the heap. The gc neither scans nor moves objects out of its heap (as the constants in
+ * flash), so the blocks are reclaimed by gc_ext_sweep after a collection: the used blocks of the heap are scanned for
+ * words pointing into an external block, and the blocks nobody points to are freed and merged with their free
+ * neighbours. The scan is conservative: a stale word keeps a buffer alive until it is overwritten.
+ * External bytearrays must keep their length: a growing buffer would be moved by the VM into the heap, referenced
+ * only from the external header that the gc does not see.
+ */
+
+#ifndef GC_EXT_THRESHOLD
+#define GC_EXT_THRESHOLD    4096
+#endif
+#ifndef GC_EXT_MAX_BUFFERS
+#define GC_EXT_MAX_BUFFERS  64
+#endif
+
+#define EXT_ALIGN           8
+#define EXT_SPLIT_MIN       64
+#define EXT_MAX_SIZE        (0xffff - sizeof(PObjectHeader))
+
+#define EXT_FREE            0
+#define EXT_USED            1
+// allocated since the last sweep, maybe not stored in the heap yet: survives one sweep
+#define EXT_FRESH           2
+
+typedef struct _ext_block {
+    uint32_t size;  // bytes of the block, header included
+    uint32_t state;
+} ExtBlock;
+
+#define EXT_NEXT(blk) ((ExtBlock*)(((uint8_t*)(blk)) + (blk)->size))
+
+static uint8_t *ext_base;
+static uint8_t *ext_end;
+static uint32_t ext_threshold = GC_EXT_THRESHOLD;
+// used blocks, sorted by address, and their marks during a sweep
+static ExtBlock *ext_used[GC_EXT_MAX_BUFFERS];
+static uint8_t ext_marks[GC_EXT_MAX_BUFFERS];
+static int32_t ext_nused;
+
+static int ext_init(uint8_t *base, uint32_t size)
+{
+    uint8_t *end = (uint8_t*)(((uint32_t)(base + size)) & ~(EXT_ALIGN - 1));
+    ExtBlock *blk;
+
+    base = (uint8_t*)(((uint32_t)base + EXT_ALIGN - 1) & ~(EXT_ALIGN - 1));
+    if (end <= base + sizeof(ExtBlock) + EXT_SPLIT_MIN)
+        return -1;
+    ext_base = base;
+    ext_end = end;
+    ext_nused = 0;
+    blk = (ExtBlock*)base;
+    blk->size = end - base;
+    blk->state = EXT_FREE;
+    return 0;
+}
+
+static int ext_ready(void)
+{
+#if defined(GC_EXT_BASE) && defined(GC_EXT_SIZE)
+    if (!ext_base)
+        ext_init((uint8_t*)(GC_EXT_BASE), GC_EXT_SIZE);
+#endif
+    return ext_base != NULL;
+}
+
+// index of the used block containing addr, -1 if none. If ins is given, it is set to the index of the first used
+// block after addr
+static int32_t ext_find(uint8_t *addr, int32_t *ins)
+{
+    int32_t lo = 0, hi = ext_nused, mid;
+
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if ((uint8_t*)ext_used[mid] <= addr)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (ins)
+        *ins = lo;
+    if (lo && addr < (uint8_t*)EXT_NEXT(ext_used[lo - 1]))
+        return lo - 1;
+    return -1;
+}
+
+// first fit. Called with the memory lock held
+static PObject *ext_alloc(uint32_t size)
+{
+    uint32_t need = (sizeof(ExtBlock) + sizeof(PByteArray) + sizeof(PBuffer) + size + EXT_ALIGN - 1) & ~(EXT_ALIGN - 1);
+    ExtBlock *blk, *rest;
+    PByteArray *ba;
+    PBuffer *buf;
+    int32_t pos;
+
+    if (ext_nused >= GC_EXT_MAX_BUFFERS)
+        return NULL;
+    for (blk = (ExtBlock*)ext_base; (uint8_t*)blk < ext_end; blk = EXT_NEXT(blk))
+        if (blk->state == EXT_FREE && blk->size >= need)
+            break;
+    if ((uint8_t*)blk >= ext_end)
+        return NULL;
+    if (blk->size - need >= sizeof(ExtBlock) + EXT_SPLIT_MIN) {
+        rest = (ExtBlock*)(((uint8_t*)blk) + need);
+        rest->size = blk->size - need;
+        rest->state = EXT_FREE;
+        blk->size = need;
+    }
+    blk->state = EXT_FRESH;
+    ext_find((uint8_t*)blk, &pos);
+    memmove(&ext_used[pos + 1], &ext_used[pos], (ext_nused - pos) * sizeof(ExtBlock*));
+    ext_used[pos] = blk;
+    ext_nused++;
+
+    ba = (PByteArray*)(blk + 1);
+    buf = (PBuffer*)(ba + 1);
+    memset(ba, 0, blk->size - sizeof(ExtBlock));
+    GCH_FLAG_SET(buf, GC_USED_MARKED);
+    buf->header.size = sizeof(PObjectHeader) + size;
+    buf->header.type = PBUFFER;
+    buf->header.flags = 1;
+    GCH_FLAG_SET(ba, GC_USED_MARKED);
+    ba->header.size = sizeof(PByteArray);
+    ba->header.type = PBYTEARRAY;
+    ba->header.flags = MAKE_SEQ_FLAGS(1, 1);
+    ba->elements = size;
+    ba->seq = buf;
+    return (PObject*)ba;
+}
+
+PObject *gc_ext_bytearray(uint32_t size, int region)
+{
+    PObject *obj = NULL;
+
+    if (region == GC_REGION_AUTO && size < ext_threshold)
+        region = GC_REGION_INT;
+    if (region != GC_REGION_INT && size <= EXT_MAX_SIZE && ext_ready()) {
+        gc_wait();
+        obj = ext_alloc(size);
+        gc_signal();
+        if (!obj) {
+            gc_collect();
+            gc_ext_sweep();
+            gc_wait();
+            obj = ext_alloc(size);
+            gc_signal();
+        }
+    }
+    if (!obj && region != GC_REGION_EXT) {
+        obj = (PObject*)psequence_new(PBYTEARRAY, size);
+        PSEQUENCE_ELEMENTS_SET(obj, size);
+        memset(PSEQUENCE_BYTES(obj), 0, size);
+    }
+    return obj;
+}
+
+int gc_ext_contains(PObject *obj)
+{
+    return ext_base && (uint8_t*)obj >= ext_base && (uint8_t*)obj < ext_end;
+}
+
+uint32_t gc_ext_sweep(void)
+{
+    uint8_t *b, *p;
+    uint32_t sz, freed = 0, *w, *wend;
+    ExtBlock *blk, *nxt;
+    int32_t i, j;
+
+    gc_wait();
+    if (!ext_nused) {
+        gc_signal();
+        return 0;
+    }
+    memset(ext_marks, 0, ext_nused);
+    for (b = hbase; b < hedge; b += sz) {
+        sz = GCH_SIZE(b);
+        if (!sz)
+            break;
+        if (GCH_FLAG(b) == GC_FREE)
+            continue;
+        wend = (uint32_t*)(b + sz);
+        for (w = (uint32_t*)(b + sizeof(PObjectHeader)); w < wend; w++) {
+            p = (uint8_t*)*w;
+            if (p >= ext_base && p < ext_end && !IS_TAGGED(p) && (i = ext_find(p, NULL)) >= 0)
+                ext_marks[i] = 1;
+        }
+    }
+    for (i = j = 0; i < ext_nused; i++) {
+        blk = ext_used[i];
+        if (ext_marks[i] || blk->state == EXT_FRESH) {
+            blk->state = EXT_USED;
+            ext_used[j++] = blk;
+        } else {
+            blk->state = EXT_FREE;
+            freed += blk->size;
+        }
+    }
+    ext_nused = j;
+    for (blk = (ExtBlock*)ext_base; (uint8_t*)blk < ext_end; blk = EXT_NEXT(blk)) {
+        if (blk->state != EXT_FREE)
+            continue;
+        while ((uint8_t*)(nxt = EXT_NEXT(blk)) < ext_end && nxt->state == EXT_FREE)
+            blk->size += nxt->size;
+    }
+    gc_signal();
+    return freed;
+}
+
+/*
+ * args: address, size
+ * hands the external region to the tier, once the board has set up the memory controller
+ */
+C_NATIVE(_gc_ext_init)
+{
+    C_NATIVE_UNWARN();
+    if (nargs != 2 || !IS_PSMALLINT(args[1]) || (!IS_PSMALLINT(args[0]) && PTYPE(args[0]) != PINTEGER))
+        return ERR_TYPE_EXC;
+    if (ext_nused)
+        return ERR_RUNTIME_EXC;
+    if (PSMALLINT_VALUE(args[1]) <= 0 || ext_init((uint8_t*)(uint32_t)INTEGER_VALUE(args[0]), PSMALLINT_VALUE(args[1])) < 0)
+        return ERR_VALUE_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: size, region
+ * returns a new bytearray of size zeroed bytes placed in region
+ */
+C_NATIVE(_gc_ext_bytearray)
+{
+    C_NATIVE_UNWARN();
+    int32_t size, region;
+
+    if (nargs != 2 || !IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    size = PSMALLINT_VALUE(args[0]);
+    region = PSMALLINT_VALUE(args[1]);
+    if (size < 0 || size > 0xffff || region < GC_REGION_INT || region > GC_REGION_AUTO)
+        return ERR_VALUE_EXC;
+    if (region == GC_REGION_EXT && !ext_ready())
+        return ERR_UNSUPPORTED_EXC;
+    *res = gc_ext_bytearray(size, region);
+    if (!*res)
+        return (size > EXT_MAX_SIZE) ? ERR_VALUE_EXC : ERR_RUNTIME_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: none
+ * returns (total, free, largest, buffers, threshold) of the external region, all zero but threshold if missing
+ */
+C_NATIVE(_gc_ext_info)
+{
+    C_NATIVE_UNWARN();
+    uint32_t total = 0, nfree = 0, largest = 0;
+    ExtBlock *blk;
+    PTuple *pt;
+
+    if (ext_ready()) {
+        gc_wait();
+        total = ext_end - ext_base;
+        for (blk = (ExtBlock*)ext_base; (uint8_t*)blk < ext_end; blk = EXT_NEXT(blk)) {
+            if (blk->state != EXT_FREE)
+                continue;
+            nfree += blk->size;
+            if (blk->size > largest)
+                largest = blk->size;
+        }
+        gc_signal();
+    }
+    // the largest bytearray fitting in the largest block
+    largest = (largest > sizeof(ExtBlock) + sizeof(PByteArray) + sizeof(PBuffer)) ? largest - sizeof(ExtBlock) - sizeof(PByteArray) - sizeof(PBuffer) : 0;
+    if (largest > EXT_MAX_SIZE)
+        largest = EXT_MAX_SIZE;
+    pt = ptuple_new(5, NULL);
+    PTUPLE_SET_ITEM(pt, 0, PSMALLINT_NEW(total));
+    PTUPLE_SET_ITEM(pt, 1, PSMALLINT_NEW(nfree));
+    PTUPLE_SET_ITEM(pt, 2, PSMALLINT_NEW(largest));
+    PTUPLE_SET_ITEM(pt, 3, PSMALLINT_NEW(ext_nused));
+    PTUPLE_SET_ITEM(pt, 4, PSMALLINT_NEW(ext_threshold));
+    *res = (PObject*)pt;
+    return ERR_OK;
+}
+
+/*
+ * args: size
+ * sets the size from which AUTO places bytearrays in the external region
+ */
+C_NATIVE(_gc_ext_threshold)
+{
+    C_NATIVE_UNWARN();
+    if (nargs != 1 || !IS_PSMALLINT(args[0]))
+        return ERR_TYPE_EXC;
+    if (PSMALLINT_VALUE(args[0]) < 0)
+        return ERR_VALUE_EXC;
+    ext_threshold = PSMALLINT_VALUE(args[0]);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: none
+ * frees the external buffers no longer referenced and returns the bytes freed
+ */
+C_NATIVE(_gc_ext_sweep)
+{
+    C_NATIVE_UNWARN();
+    *res = PSMALLINT_NEW(gc_ext_sweep());
+    return ERR_OK;
+}
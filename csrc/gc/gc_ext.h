@@ -0,0 +1,22 @@
+#ifndef __GC_EXT__
+#define __GC_EXT__
+
+/*
+ * External memory tier: bytearrays placed in a region of slower external RAM (PSRAM, SDRAM), outside the gc heap,
+ * so that large buffers do not take the internal SRAM of small hot objects. The region is given by the defines
+ * GC_EXT_BASE and GC_EXT_SIZE of the board or project, or at runtime by gc.ext_init.
+ */
+
+#define GC_REGION_INT       0
+#define GC_REGION_EXT       1
+#define GC_REGION_AUTO      2
+
+// a new zeroed bytearray of size bytes placed in region. Returns NULL if region is GC_REGION_EXT and the external
+// region is missing or full. AUTO places buffers of at least the external threshold in the external region if they fit
+PObject *gc_ext_bytearray(uint32_t size, int region);
+// 1 if obj lives in the external region
+int gc_ext_contains(PObject *obj);
+// frees the external buffers no longer referenced from the heap and returns the bytes freed
+uint32_t gc_ext_sweep(void);
+
+#endif
@@ -0,0 +1,93 @@
+#include "zerynth.h"
+#include "gc_pool.h"
+
+/*
+ * A pool is a list [cursor, kind, size, obj0, obj1, ...] built by _gc_pool_new: the objects stay referenced by the
+ * pool, so they are never collected and the memory of the pool is fixed. Taking an object only moves the cursor.
+ * Natives producing many small results of the same shape (tuples of a driver read, frame buffers, float samples) can
+ * take them from a pool passed by the caller, and the heap does not fragment under them.
+ */
+
+#define POOL_HEADER     3
+#define POOL_MAX        1024
+
+int gc_pool_check(PObject *pool, int kind, int size)
+{
+    if (PTYPE(pool) != PLIST || PSEQUENCE_ELEMENTS(pool) <= POOL_HEADER)
+        return 0;
+    if (!IS_PSMALLINT(PLIST_ITEM(pool, 0)) || !IS_PSMALLINT(PLIST_ITEM(pool, 1)) || !IS_PSMALLINT(PLIST_ITEM(pool, 2)))
+        return 0;
+    return PSMALLINT_VALUE(PLIST_ITEM(pool, 1)) == kind && PSMALLINT_VALUE(PLIST_ITEM(pool, 2)) >= size;
+}
+
+PObject *gc_pool_take(PObject *pool)
+{
+    int32_t n = PSEQUENCE_ELEMENTS(pool) - POOL_HEADER;
+    int32_t i = PSMALLINT_VALUE(PLIST_ITEM(pool, 0));
+
+    PLIST_SET_ITEM(pool, 0, PSMALLINT_NEW((i + 1) % n));
+    return PLIST_ITEM(pool, POOL_HEADER + i);
+}
+
+PObject *gc_pool_float(PObject *pool, FLOAT_TYPE v)
+{
+    PFloat *f = (PFloat*)gc_pool_take(pool);
+
+    f->val = v;
+    return (PObject*)f;
+}
+
+/*
+ * args: kind, n, size
+ * returns a new pool of n objects of kind: tuples of size items (None), bytearrays of size bytes, or floats
+ */
+C_NATIVE(_gc_pool_new)
+{
+    C_NATIVE_UNWARN();
+    int32_t kind, n, size, i;
+    PObject *pool, *obj;
+
+    if (parse_py_args("iii", nargs, args, &kind, &n, &size) != 3)
+        return ERR_TYPE_EXC;
+    if (kind < GC_POOL_TUPLE || kind > GC_POOL_FLOAT || n <= 0 || n > POOL_MAX || size < 0 || size > 0xffff)
+        return ERR_VALUE_EXC;
+
+    pool = (PObject*)plist_new(POOL_HEADER + n, NULL);
+    PLIST_SET_ITEM(pool, 0, PSMALLINT_NEW(0));
+    PLIST_SET_ITEM(pool, 1, PSMALLINT_NEW(kind));
+    PLIST_SET_ITEM(pool, 2, PSMALLINT_NEW(size));
+    for (i = 0; i < n; i++)
+        PLIST_SET_ITEM(pool, POOL_HEADER + i, MAKE_NONE());
+    // reachable from here on, while the objects are allocated
+    *res = pool;
+    for (i = 0; i < n; i++) {
+        if (kind == GC_POOL_TUPLE) {
+            obj = (PObject*)ptuple_new(size, NULL);
+            for (int32_t k = 0; k < size; k++)
+                PTUPLE_SET_ITEM(obj, k, MAKE_NONE());
+        } else if (kind == GC_POOL_BYTEARRAY) {
+            obj = (PObject*)psequence_new(PBYTEARRAY, size);
+            PSEQUENCE_ELEMENTS_SET(obj, size);
+        } else {
+            obj = (PObject*)pfloat_new(0);
+        }
+        PLIST_SET_ITEM(pool, POOL_HEADER + i, obj);
+    }
+    return ERR_OK;
+}
+
+/*
+ * args: pool
+ * returns the next object of pool
+ */
+C_NATIVE(_gc_pool_take)
+{
+    C_NATIVE_UNWARN();
+
+    if (nargs != 1 || PTYPE(args[0]) != PLIST || PSEQUENCE_ELEMENTS(args[0]) <= POOL_HEADER || !IS_PSMALLINT(PLIST_ITEM(args[0], 1)))
+        return ERR_TYPE_EXC;
+    if (!gc_pool_check(args[0], PSMALLINT_VALUE(PLIST_ITEM(args[0], 1)), 0))
+        return ERR_TYPE_EXC;
+    *res = gc_pool_take(args[0]);
+    return ERR_OK;
+}
@@ -0,0 +1,20 @@
+#ifndef __GC_POOL__
+#define __GC_POOL__
+
+/*
+ * Pools of preallocated objects of the same kind and size, reused round robin by natives instead of allocating
+ * their results. An object taken from a pool of n is handed out again after n more takes.
+ */
+
+#define GC_POOL_TUPLE       0
+#define GC_POOL_BYTEARRAY   1
+#define GC_POOL_FLOAT       2
+
+// returns 1 if pool is a pool of kind, with objects of at least size items (bytes for bytearrays)
+int gc_pool_check(PObject *pool, int kind, int size);
+// the next object of a checked pool. Tuples keep their items, bytearrays their length
+PObject *gc_pool_take(PObject *pool);
+// the next float of a checked pool, set to v
+PObject *gc_pool_float(PObject *pool, FLOAT_TYPE v);
+
+#endif
@@ -0,0 +1,157 @@
+#include "zerynth.h"
+
+/*
+ * Sampling allocation tracker for gc.alloc_stats.
+ *
+ * gc_malloc belongs to the VM and has no hook, so allocations are sampled: a recurrent system timer reads the free
+ * memory and the used blocks at each tick, and charges the bytes and blocks allocated since the previous tick to the
+ * Python frame running when the tick fires (module, code and pc, the same pairs decoded in tracebacks).
+ * Sites sharing the tick with other allocations are overcharged and short lived ones can be missed, but over a loop
+ * the sites that churn the heap collect most of the bytes.
+ * Ticks where memory was freed (a collection) only move the baseline. When the table is full the site with the
+ * fewest bytes is replaced, and the newcomer inherits its bytes, so that heavy sites are never lost.
+ */
+
+#define TRACK_SITES     32
+
+typedef struct _track_site {
+    uint16_t module;
+    uint16_t code;
+    uint16_t pc;
+    uint16_t used;
+    uint32_t count;
+    uint32_t bytes;
+} TrackSite;
+
+static TrackSite track_sites[TRACK_SITES];
+static VSysTimer track_vtm;
+static uint32_t track_free;
+static uint32_t track_blocks;
+static uint32_t track_lost;
+
+static void track_tick_isr(void *arg)
+{
+    (void)arg;
+    uint32_t fmem = hfreemem, blocks = hblocks, bytes, count;
+    PThread *pth;
+    PFrame *frm;
+    TrackSite *s = NULL, *min = NULL;
+    int i;
+
+    SYSLOCK_I();
+    bytes = track_free - fmem;
+    count = (blocks > track_blocks) ? blocks - track_blocks : 1;
+    if (fmem >= track_free || GC_IS_LOCKED())
+        goto out;
+    pth = (PThread*)vosThGetData(vosThCurrent());
+    frm = pth ? pth->frame : NULL;
+    if (!frm) {
+        // native code or idle
+        track_lost += bytes;
+        goto out;
+    }
+    for (i = 0; i < TRACK_SITES; i++) {
+        TrackSite *t = &track_sites[i];
+        if (!t->used || (t->module == frm->module && t->code == frm->code && t->pc == frm->pc)) {
+            s = t;
+            break;
+        }
+        if (!min || t->bytes < min->bytes)
+            min = t;
+    }
+    if (!s)
+        s = min;
+    if (!s->used || s->module != frm->module || s->code != frm->code || s->pc != frm->pc) {
+        s->used = 1;
+        s->module = frm->module;
+        s->code = frm->code;
+        s->pc = frm->pc;
+    }
+    s->count += count;
+    s->bytes += bytes;
+out:
+    track_free = fmem;
+    track_blocks = blocks;
+    SYSUNLOCK_I();
+}
+
+/*
+ * args: period
+ * starts sampling every period millis, clearing the sites, or stops it if period is 0
+ */
+C_NATIVE(_gc_track)
+{
+    C_NATIVE_UNWARN();
+    int32_t period;
+
+    if (parse_py_args("i", nargs, args, &period) != 1)
+        return ERR_TYPE_EXC;
+    if (period < 0)
+        return ERR_VALUE_EXC;
+    *res = MAKE_NONE();
+    if (!track_vtm)
+        track_vtm = vosTimerCreate();
+    SYSLOCK();
+    vosTimerReset(track_vtm);
+    if (period) {
+        memset(track_sites, 0, sizeof(track_sites));
+        track_lost = 0;
+        track_free = hfreemem;
+        track_blocks = hblocks;
+        vosTimerRecurrent(track_vtm, TIME_U(period, MILLIS), track_tick_isr, NULL);
+    }
+    SYSUNLOCK();
+    return ERR_OK;
+}
+
+/*
+ * args: top_n
+ * returns a tuple with the list of the top_n sites by bytes, as (module, code, pc, count, bytes) tuples,
+ * and the bytes allocated outside of Python frames
+ */
+C_NATIVE(_gc_alloc_stats)
+{
+    C_NATIVE_UNWARN();
+    int32_t top, n, i, j;
+    TrackSite sites[TRACK_SITES], t;
+    PTuple *tpl, *site;
+    PList *lst;
+    uint32_t lost;
+
+    if (parse_py_args("i", nargs, args, &top) != 1)
+        return ERR_TYPE_EXC;
+    SYSLOCK();
+    memcpy(sites, track_sites, sizeof(sites));
+    lost = track_lost;
+    SYSUNLOCK();
+    for (n = 0; n < TRACK_SITES && sites[n].used; n++);
+    if (top < 0 || top > n)
+        top = n;
+    // partial selection sort, the table is small
+    for (i = 0; i < top; i++) {
+        for (j = i + 1; j < n; j++) {
+            if (sites[j].bytes > sites[i].bytes) {
+                t = sites[i];
+                sites[i] = sites[j];
+                sites[j] = t;
+            }
+        }
+    }
+
+    tpl = ptuple_new(2, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, MAKE_NONE());
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(lost));
+    *res = (PObject*)tpl;
+    lst = plist_new(top, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, lst);
+    for (i = 0; i < top; i++) {
+        site = ptuple_new(5, NULL);
+        PTUPLE_SET_ITEM(site, 0, PSMALLINT_NEW(sites[i].module));
+        PTUPLE_SET_ITEM(site, 1, PSMALLINT_NEW(sites[i].code));
+        PTUPLE_SET_ITEM(site, 2, PSMALLINT_NEW(sites[i].pc));
+        PTUPLE_SET_ITEM(site, 3, PSMALLINT_NEW(sites[i].count));
+        PTUPLE_SET_ITEM(site, 4, PSMALLINT_NEW(sites[i].bytes));
+        PLIST_SET_ITEM(lst, i, site);
+    }
+    return ERR_OK;
+}
@@ -1,10 +1,72 @@
 #include "zerynth.h"
+#include "gc_ext.h"
 
 #define GC_CMD_INFO     0
 #define GC_CMD_COLLECT  1
 #define GC_CMD_DISABLE  2
 #define GC_CMD_ENABLE   3
+#define GC_CMD_STEP     4
+#define GC_CMD_PAUSES   5
+#define GC_CMD_FREEMAP  6
 
+// free blocks are counted by size below 64, 256, 1K, 4K, 16K bytes, and above
+#define GC_FREEMAP_CLASSES 6
+
+/*
+ * Collections requested by the program are timed, so that gc.step can run one only when the expected pause fits the
+ * time the caller can spare. The pause includes the sweep of the external buffers. The expected pause is an average of the last ones, weighted towards the longest.
+ */
+static VSysTimer gc_clock;
+static uint32_t gc_pause_last;
+static uint32_t gc_pause_max;
+static uint32_t gc_pause_expected;
+static uint32_t gc_collections;
+
+static uint32_t gc_timed_collect(void) {
+    uint32_t t0, dt;
+
+    if (!gc_clock)
+        gc_clock = vosTimerCreate();
+    t0 = vosTimerReadMicros(gc_clock);
+    gc_collect();
+    gc_ext_sweep();
+    dt = vosTimerReadMicros(gc_clock) - t0;
+    gc_pause_last = dt;
+    if (dt > gc_pause_max)
+        gc_pause_max = dt;
+    if (dt > gc_pause_expected)
+        gc_pause_expected = dt;
+    else
+        gc_pause_expected -= (gc_pause_expected - dt) / 4;
+    gc_collections++;
+    return dt;
+}
+
+/*
+ * Walks the blocks between hbase and hedge under the memory lock, counting the free ones by size class. The space
+ * between hedge and hend has never been split and is reported apart. Returns the largest free block, edge included
+ */
+static uint32_t gc_freemap(uint32_t *counts, uint32_t *edge) {
+    uint8_t *b;
+    uint32_t sz, largest = 0;
+    int c;
+
+    gc_wait();
+    for (b = hbase; b < hedge; b += sz) {
+        sz = GCH_SIZE(b);
+        if (!sz)
+            break;
+        if (GCH_FLAG(b) != GC_FREE)
+            continue;
+        for (c = 0; c < GC_FREEMAP_CLASSES - 1 && sz >= (64u << (2 * c)); c++);
+        counts[c]++;
+        if (sz > largest)
+            largest = sz;
+    }
+    *edge = hend - hedge;
+    gc_signal();
+    return (*edge > largest) ? *edge : largest;
+}
 
 C_NATIVE(__gc) {
     NATIVE_UNWARN();
@@ -28,8 +90,47 @@ C_NATIVE(__gc) {
         }
         break;
         case GC_CMD_COLLECT: {
-            //gc_collect();
-            return ERR_NOT_IMPLEMENTED_EXC;
+            *res = PSMALLINT_NEW(gc_timed_collect());
+        }
+        break;
+        case GC_CMD_STEP: {
+            // args: budget, min_free. Collects if the expected pause is within budget micros, or if less than min_free
+            // bytes are free. Returns the pause, -1 if skipped
+            if (nargs < 3)
+                return ERR_TYPE_EXC;
+            CHECK_ARG(args[1], PSMALLINT);
+            CHECK_ARG(args[2], PSMALLINT);
+            if (gc_pause_expected <= (uint32_t)PSMALLINT_VALUE(args[1]) || GC_FREE_MEMORY() < PSMALLINT_VALUE(args[2]))
+                *res = PSMALLINT_NEW(gc_timed_collect());
+            else
+                *res = PSMALLINT_NEW(-1);
+        }
+        break;
+        case GC_CMD_PAUSES: {
+            PTuple *pt = ptuple_new(4, NULL);
+            PTUPLE_SET_ITEM(pt, 0, PSMALLINT_NEW(gc_pause_last));
+            PTUPLE_SET_ITEM(pt, 1, PSMALLINT_NEW(gc_pause_max));
+            PTUPLE_SET_ITEM(pt, 2, PSMALLINT_NEW(gc_pause_expected));
+            PTUPLE_SET_ITEM(pt, 3, PSMALLINT_NEW(gc_collections));
+            *res = (PObject *)pt;
+        }
+        break;
+        case GC_CMD_FREEMAP: {
+            uint32_t counts[GC_FREEMAP_CLASSES] = {0}, edge, largest;
+            PTuple *pt;
+            PTuple *hist;
+            int i;
+
+            largest = gc_freemap(counts, &edge);
+            pt = ptuple_new(3, NULL);
+            PTUPLE_SET_ITEM(pt, 0, MAKE_NONE());
+            PTUPLE_SET_ITEM(pt, 1, PSMALLINT_NEW(largest));
+            PTUPLE_SET_ITEM(pt, 2, PSMALLINT_NEW(edge));
+            *res = (PObject *)pt;
+            hist = ptuple_new(GC_FREEMAP_CLASSES, NULL);
+            for (i = 0; i < GC_FREEMAP_CLASSES; i++)
+                PTUPLE_SET_ITEM(hist, i, PSMALLINT_NEW(counts[i]));
+            PTUPLE_SET_ITEM(pt, 0, hist);
         }
         break;
         case GC_CMD_DISABLE: {
@@ -39,7 +140,7 @@ C_NATIVE(__gc) {
         break;
         case GC_CMD_ENABLE: {
             
-            if (nargs == 2) {
+            if (nargs >= 2) {
                 CHECK_ARG(args[1], PSMALLINT);
                 code = PSMALLINT_VALUE(args[1]);
                 if (code <= 0)
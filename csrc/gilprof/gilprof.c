@@ -0,0 +1,144 @@
+#include "zerynth.h"
+
+/*
+ * Access to the tables of the GIL hold time profiler (zerynth_gilprof.h).
+ * Without ZERYNTH_GIL_PROFILE the tables do not exist and the results are empty.
+ */
+
+#if defined(ZERYNTH_GIL_PROFILE)
+static PObject *gilprof_name(const char *name)
+{
+    return (PObject*)pstring_new(strlen(name), (uint8_t*)name);
+}
+
+static PObject *gilprof_hold(GilProfHold *h)
+{
+    PTuple *tpl = ptuple_new(4, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, gilprof_name(h->name));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(h->us));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(h->thread));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(h->at & 0x3fffffff));
+    return (PObject*)tpl;
+}
+#endif
+
+/*
+ * no args: returns a list of (name, count, total us, max us, histogram) for every native that held the GIL,
+ * with histogram a tuple counting the holds shorter than 16us, 32us, ... doubling, the last one unbounded
+ */
+C_NATIVE(__gilprof_stats)
+{
+    C_NATIVE_UNWARN();
+#if defined(ZERYNTH_GIL_PROFILE)
+    int32_t i, j, n;
+    PList *lst;
+
+    for (n = 0; n < GILPROF_NATIVES && gilprof_stats[n].name; n++);
+    lst = plist_new(n, NULL);
+    *res = (PObject*)lst;
+    for (i = 0; i < n; i++) {
+        GilProfStats *st = &gilprof_stats[i];
+        PTuple *tpl = ptuple_new(5, NULL);
+        PTuple *hist;
+        PLIST_SET_ITEM(lst, i, tpl);
+        PTUPLE_SET_ITEM(tpl, 0, gilprof_name(st->name));
+        PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(st->count));
+        PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(st->total & 0x3fffffff));
+        PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(st->max));
+        hist = ptuple_new(GILPROF_BUCKETS, NULL);
+        PTUPLE_SET_ITEM(tpl, 4, hist);
+        for (j = 0; j < GILPROF_BUCKETS; j++)
+            PTUPLE_SET_ITEM(hist, j, PSMALLINT_NEW(st->hist[j]));
+    }
+#else
+    *res = (PObject*)plist_new(0, NULL);
+#endif
+    return ERR_OK;
+}
+
+/*
+ * args: which
+ * returns a list of (name, us, thread id, millis) holds: the longest ones, longest first, if which is 0,
+ * the latest ones, oldest first, otherwise
+ */
+C_NATIVE(__gilprof_holds)
+{
+    C_NATIVE_UNWARN();
+    int32_t which;
+
+    if (parse_py_args("i", nargs, args, &which) != 1)
+        return ERR_TYPE_EXC;
+#if defined(ZERYNTH_GIL_PROFILE)
+    int32_t i, j, n;
+    PList *lst;
+    GilProfHold *sorted[GILPROF_TOP];
+
+    if (which == 0) {
+        for (n = 0, i = 0; i < GILPROF_TOP; i++) {
+            if (!gilprof_top[i].name)
+                continue;
+            // insertion by decreasing duration
+            for (j = n; j > 0 && sorted[j - 1]->us < gilprof_top[i].us; j--)
+                sorted[j] = sorted[j - 1];
+            sorted[j] = &gilprof_top[i];
+            n++;
+        }
+        lst = plist_new(n, NULL);
+        *res = (PObject*)lst;
+        for (i = 0; i < n; i++)
+            PLIST_SET_ITEM(lst, i, gilprof_hold(sorted[i]));
+    } else {
+        uint32_t first = (gilprof_ring_pos > GILPROF_RING) ? gilprof_ring_pos - GILPROF_RING : 0;
+        n = gilprof_ring_pos - first;
+        lst = plist_new(n, NULL);
+        *res = (PObject*)lst;
+        for (i = 0; i < n; i++)
+            PLIST_SET_ITEM(lst, i, gilprof_hold(&gilprof_ring[(first + i) % GILPROF_RING]));
+    }
+#else
+    (void)which;
+    *res = (PObject*)plist_new(0, NULL);
+#endif
+    return ERR_OK;
+}
+
+/*
+ * no args: clears the profiler tables
+ */
+C_NATIVE(__gilprof_reset)
+{
+    C_NATIVE_UNWARN();
+#if defined(ZERYNTH_GIL_PROFILE)
+    memset(gilprof_stats, 0, sizeof(gilprof_stats));
+    memset(gilprof_top, 0, sizeof(gilprof_top));
+    memset(gilprof_ring, 0, sizeof(gilprof_ring));
+    gilprof_ring_pos = 0;
+#endif
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * no args: returns (handoffs, waiting) of the GIL handoff (zerynth_gilprio.h), with waiting a tuple of the threads
+ * waiting for the GIL in natives by priority. None without ZERYNTH_GIL_HANDOFF
+ */
+C_NATIVE(__gilprio_stats)
+{
+    C_NATIVE_UNWARN();
+#if defined(ZERYNTH_GIL_HANDOFF)
+    PTuple *tpl = ptuple_new(2, NULL);
+    PTuple *waiting;
+    int32_t i;
+
+    *res = (PObject*)tpl;
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(gilprio_handoffs));
+    PTUPLE_SET_ITEM(tpl, 1, MAKE_NONE());
+    waiting = ptuple_new(GILPRIO_LEVELS, NULL);
+    for (i = 0; i < GILPRIO_LEVELS; i++)
+        PTUPLE_SET_ITEM(waiting, i, PSMALLINT_NEW(gilprio_waiting[i]));
+    PTUPLE_SET_ITEM(tpl, 1, waiting);
+#else
+    *res = MAKE_NONE();
+#endif
+    return ERR_OK;
+}
@@ -0,0 +1,173 @@
+#include "zerynth.h"
+
+/*
+ * Port level access to groups of up to 32 mcu pins: bit i of a value is pin i of the group. A group is given as a list
+ * or tuple of pins, or as the bytearray made by _gpio_group, that holds the port and pad of each pin already resolved
+ * for vhalPinFastSet/Clear/Read.
+ */
+
+#define GPIO_MAX_PINS   32
+#define GPIO_TAG        0x4f495047  /* "GPIO" */
+
+typedef struct _gpio_pad {
+    void *port;
+    int32_t pad;
+} GpioPad;
+
+typedef struct _gpio_group {
+    uint32_t tag;
+    uint32_t n;
+    GpioPad pads[];
+} GpioGroup;
+
+// the pads of obj into pads, returns their number or -1 if obj is not a group
+static int gpio_resolve(PObject *obj, GpioPad *pads)
+{
+    int32_t n, i;
+    PObject *pin;
+
+    if (PTYPE(obj) == PBYTEARRAY) {
+        GpioGroup *g = (GpioGroup*)PSEQUENCE_BYTES(obj);
+        if (PSEQUENCE_ELEMENTS(obj) < (int32_t)sizeof(GpioGroup) || g->tag != GPIO_TAG || g->n > GPIO_MAX_PINS)
+            return -1;
+        if (PSEQUENCE_ELEMENTS(obj) < (int32_t)(sizeof(GpioGroup) + g->n * sizeof(GpioPad)))
+            return -1;
+        memcpy(pads, g->pads, g->n * sizeof(GpioPad));
+        return g->n;
+    }
+    if (PTYPE(obj) != PLIST && PTYPE(obj) != PTUPLE)
+        return -1;
+    n = PSEQUENCE_ELEMENTS(obj);
+    if (!n || n > GPIO_MAX_PINS)
+        return -1;
+    for (i = 0; i < n; i++) {
+        pin = (PTYPE(obj) == PLIST) ? PLIST_ITEM(obj, i) : PTUPLE_ITEM(obj, i);
+        if (!IS_PSMALLINT(pin))
+            return -1;
+        pads[i].port = vhalPinGetPort(PSMALLINT_VALUE(pin));
+        pads[i].pad = vhalPinGetPad(PSMALLINT_VALUE(pin));
+    }
+    return n;
+}
+
+static inline void gpio_level(void *port, int32_t pad, int level)
+{
+    if (level)
+        vhalPinFastSet(port, pad);
+    else
+        vhalPinFastClear(port, pad);
+}
+
+static inline void gpio_write(GpioPad *pads, int32_t n, uint32_t value, uint32_t mask)
+{
+    int32_t i;
+
+    for (i = 0; i < n; i++) {
+        if (mask & (1u << i))
+            gpio_level(pads[i].port, pads[i].pad, value & (1u << i));
+    }
+}
+
+/*
+ * args: pins
+ * returns a bytearray with the pins resolved, usable wherever a group of pins is expected
+ */
+C_NATIVE(_gpio_group)
+{
+    C_NATIVE_UNWARN();
+    GpioPad pads[GPIO_MAX_PINS];
+    GpioGroup *g;
+    int32_t n, size;
+
+    if (nargs != 1 || PTYPE(args[0]) == PBYTEARRAY || (n = gpio_resolve(args[0], pads)) < 0)
+        return ERR_TYPE_EXC;
+    size = sizeof(GpioGroup) + n * sizeof(GpioPad);
+    *res = (PObject*)psequence_new(PBYTEARRAY, size);
+    PSEQUENCE_ELEMENTS_SET(*res, size);
+    g = (GpioGroup*)PSEQUENCE_BYTES(*res);
+    g->tag = GPIO_TAG;
+    g->n = n;
+    memcpy(g->pads, pads, n * sizeof(GpioPad));
+    return ERR_OK;
+}
+
+/*
+ * args: group, value, mask
+ * sets each pin i of group with bit i of mask to bit i of value
+ */
+C_NATIVE(_gpio_port_write)
+{
+    C_NATIVE_UNWARN();
+    GpioPad pads[GPIO_MAX_PINS];
+    int32_t n;
+
+    if (nargs != 3 || (n = gpio_resolve(args[0], pads)) < 0 || !IS_INTEGER(args[1]) || !IS_INTEGER(args[2]))
+        return ERR_TYPE_EXC;
+    gpio_write(pads, n, (uint32_t)INTEGER_VALUE(args[1]), (uint32_t)INTEGER_VALUE(args[2]));
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: group
+ * returns the value of the pins, pin i in bit i
+ */
+C_NATIVE(_gpio_port_read)
+{
+    C_NATIVE_UNWARN();
+    GpioPad pads[GPIO_MAX_PINS];
+    int32_t n, i;
+    uint32_t value = 0;
+
+    if (nargs != 1 || (n = gpio_resolve(args[0], pads)) < 0)
+        return ERR_TYPE_EXC;
+    for (i = 0; i < n; i++) {
+        if (vhalPinFastRead(pads[i].port, pads[i].pad))
+            value |= 1u << i;
+    }
+    if (value < 0x40000000)
+        *res = PSMALLINT_NEW(value);
+    else
+        *res = (PObject*)pinteger_new(value);
+    return ERR_OK;
+}
+
+/*
+ * args: group, data, strobe, active
+ * puts each byte of data (or each short of a shortarray) on the pins of group, then pulses strobe to the active level
+ * and back, if strobe is not negative. Runs without the GIL
+ */
+C_NATIVE(_gpio_bus_write)
+{
+    C_NATIVE_UNWARN();
+    GpioPad pads[GPIO_MAX_PINS];
+    void *sport = NULL;
+    int32_t n, i, len, strobe, active, spad = 0, shorts;
+    uint8_t *data;
+
+    if (nargs != 4 || (n = gpio_resolve(args[0], pads)) < 0 || (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1])) && PTYPE(args[1]) != PSHORTARRAY))
+        return ERR_TYPE_EXC;
+    if (!IS_PSMALLINT(args[2]) || !IS_PSMALLINT(args[3]))
+        return ERR_TYPE_EXC;
+    shorts = PTYPE(args[1]) == PSHORTARRAY;
+    data = PSEQUENCE_BYTES(args[1]);
+    len = PSEQUENCE_ELEMENTS(args[1]);
+    strobe = PSMALLINT_VALUE(args[2]);
+    active = PSMALLINT_VALUE(args[3]);
+    if (strobe >= 0) {
+        sport = vhalPinGetPort(strobe);
+        spad = vhalPinGetPad(strobe);
+    }
+
+    RELEASE_GIL();
+    for (i = 0; i < len; i++) {
+        gpio_write(pads, n, shorts ? ((uint16_t*)data)[i] : data[i], 0xffffffff);
+        if (sport) {
+            gpio_level(sport, spad, active);
+            gpio_level(sport, spad, !active);
+        }
+    }
+    ACQUIRE_GIL();
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
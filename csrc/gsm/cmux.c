@@ -0,0 +1,381 @@
+#include "zerynth.h"
+#include "cmux.h"
+
+/*
+ * Basic option framing of TS 27.010 (see cmux.h):
+ *     flag (F9), address (DLCI << 2 | C/R | EA), control, length (1 or 2 bytes, EA terminated), information, FCS, flag
+ * The FCS is the reflected CRC-8 of the header, and of the information too for frames other than UIH.
+ * As the initiator, commands carry C/R set. Multiplexer commands of the modem on DLCI 0 (MSC, test) are answered by echoing them
+ * as responses, which is all the modems in use expect.
+ */
+
+#define CMUX_FLAG   0xF9
+#define CMUX_EA     0x01
+#define CMUX_CR     0x02
+#define CMUX_PF     0x10
+
+#define CMUX_SABM   0x2F
+#define CMUX_UA     0x63
+#define CMUX_DM     0x0F
+#define CMUX_DISC   0x43
+#define CMUX_UIH    0xEF
+#define CMUX_UI     0x03
+
+#define CMUX_CLD    0xC1        // multiplexer close down, type byte
+
+#define S_FLAG  0
+#define S_ADDR  1
+#define S_CTRL  2
+#define S_LEN1  3
+#define S_LEN2  4
+#define S_DATA  5
+#define S_FCS   6
+#define S_END   7
+
+static uint8_t cmux_crc(uint8_t fcs, const uint8_t *p, int len)
+{
+    int i;
+
+    while (len--) {
+        fcs ^= *p++;
+        for (i = 0; i < 8; i++)
+            fcs = (fcs & 1) ? (fcs >> 1) ^ 0xE0 : fcs >> 1;
+    }
+    return fcs;
+}
+
+// one frame, under the tx mutex
+static int cmux_frame(CMux *m, uint8_t dlci, uint8_t ctrl, uint8_t cr, const uint8_t *data, int len)
+{
+    uint8_t hdr[5], tail[2];
+    int n = 4, fcs;
+
+    hdr[0] = CMUX_FLAG;
+    hdr[1] = (dlci << 2) | (cr ? CMUX_CR : 0) | CMUX_EA;
+    hdr[2] = ctrl;
+    if (len < 128) {
+        hdr[3] = (len << 1) | CMUX_EA;
+    } else {
+        hdr[3] = len << 1;
+        hdr[4] = len >> 7;
+        n = 5;
+    }
+    fcs = cmux_crc(0xFF, hdr + 1, n - 1);
+    if ((ctrl & ~CMUX_PF) != CMUX_UIH)
+        fcs = cmux_crc(fcs, data, len);
+    tail[0] = 0xFF - fcs;
+    tail[1] = CMUX_FLAG;
+    if (m->write(m, hdr, n) != n || (len && m->write(m, data, len) != len) || m->write(m, tail, 2) != 2)
+        return -1;
+    m->tx_frames++;
+    return 0;
+}
+
+static int cmux_command(CMux *m, uint8_t dlci, uint8_t ctrl, const uint8_t *data, int len)
+{
+    int r;
+
+    vosMtxLock(m->tx);
+    r = cmux_frame(m, dlci, ctrl, 1, data, len);
+    vosMtxUnlock(m->tx);
+    return r;
+}
+
+#if defined(ZERYNTH_GSM_PPP)
+static void cmux_ppp_input(CMux *m, const uint8_t *data, int len);
+#endif
+
+static void cmux_dispatch(CMux *m)
+{
+    uint8_t dlci = m->addr >> 2, ctrl = m->ctrl & ~CMUX_PF, bit;
+
+    m->rx_frames++;
+    if (dlci >= 8)
+        return;
+    bit = 1 << dlci;
+    switch (ctrl) {
+        case CMUX_UA:
+            // answers SABM, or DISC (marked refused by cmux_close), or a SABM given up by cmux_open
+            if (m->refused & bit)
+                m->refused &= ~bit;
+            else
+                m->up |= bit;
+            vosSemSignal(m->ev);
+            break;
+        case CMUX_DM:
+        case CMUX_DISC:
+            m->up &= ~bit;
+            m->refused &= ~bit;
+            if (ctrl == CMUX_DM)
+                m->denied |= bit;
+            if (ctrl == CMUX_DISC) {
+                vosMtxLock(m->tx);
+                cmux_frame(m, dlci, CMUX_UA | CMUX_PF, 0, NULL, 0);
+                vosMtxUnlock(m->tx);
+            }
+            vosSemSignal(m->ev);
+            break;
+        case CMUX_UIH:
+        case CMUX_UI:
+            if (!dlci) {
+                // a command of the modem (C/R of the type byte set): echo it as the response
+                if (m->len && (m->frame[0] & CMUX_CR)) {
+                    m->frame[0] &= ~CMUX_CR;
+                    cmux_command(m, 0, CMUX_UIH, m->frame, m->len);
+                }
+                break;
+            }
+#if defined(ZERYNTH_GSM_PPP)
+            if (dlci == m->ppp_dlci && m->ppp) {
+                cmux_ppp_input(m, m->frame, m->len);
+                break;
+            }
+#endif
+            if (m->recv)
+                m->recv(m, dlci, m->frame, m->len);
+            break;
+    }
+}
+
+void cmux_init(CMux *m, cmux_write_fn write, cmux_recv_fn recv, void *ctx)
+{
+    memset(m, 0, sizeof(CMux));
+    m->write = write;
+    m->recv = recv;
+    m->ctx = ctx;
+    m->tx = vosMtxCreate();
+    m->ev = vosSemCreate(0);
+}
+
+void cmux_input(CMux *m, const uint8_t *data, int len)
+{
+    uint8_t b;
+
+    while (len--) {
+        b = *data++;
+        switch (m->state) {
+            case S_FLAG:
+                if (b == CMUX_FLAG)
+                    m->state = S_ADDR;
+                break;
+            case S_ADDR:
+                // repeated flags between frames
+                if (b == CMUX_FLAG)
+                    break;
+                m->addr = b;
+                m->fcs = cmux_crc(0xFF, &b, 1);
+                m->state = S_CTRL;
+                break;
+            case S_CTRL:
+                m->ctrl = b;
+                m->fcs = cmux_crc(m->fcs, &b, 1);
+                m->state = S_LEN1;
+                break;
+            case S_LEN1:
+            case S_LEN2:
+                m->fcs = cmux_crc(m->fcs, &b, 1);
+                if (m->state == S_LEN1) {
+                    m->len = b >> 1;
+                    if (!(b & CMUX_EA)) {
+                        m->state = S_LEN2;
+                        break;
+                    }
+                } else {
+                    m->len |= b << 7;
+                }
+                m->pos = 0;
+                if (m->len > CMUX_N1) {
+                    m->rx_errors++;
+                    m->state = S_FLAG;
+                } else {
+                    m->state = m->len ? S_DATA : S_FCS;
+                }
+                break;
+            case S_DATA:
+                m->frame[m->pos++] = b;
+                if (m->pos == m->len) {
+                    if ((m->ctrl & ~CMUX_PF) != CMUX_UIH)
+                        m->fcs = cmux_crc(m->fcs, m->frame, m->len);
+                    m->state = S_FCS;
+                }
+                break;
+            case S_FCS:
+                if (cmux_crc(m->fcs, &b, 1) != 0xCF) {
+                    m->rx_errors++;
+                    m->state = (b == CMUX_FLAG) ? S_ADDR : S_FLAG;
+                } else {
+                    m->state = S_END;
+                }
+                break;
+            case S_END:
+                if (b != CMUX_FLAG) {
+                    m->rx_errors++;
+                    m->state = S_FLAG;
+                    break;
+                }
+                cmux_dispatch(m);
+                // the closing flag may open the next frame
+                m->state = S_ADDR;
+                break;
+        }
+    }
+}
+
+int cmux_open(CMux *m, uint8_t dlci, uint32_t timeout)
+{
+    uint8_t bit = 1 << dlci;
+    uint32_t since = (uint32_t)vosMillis(), t;
+
+    if (dlci >= 8)
+        return -1;
+    if (m->up & bit)
+        return 0;
+    vosSemReset(m->ev);
+    m->denied &= ~bit;
+    if (cmux_command(m, dlci, CMUX_SABM | CMUX_PF, NULL, 0) < 0)
+        return -1;
+    while (!(m->up & bit) && !(m->denied & bit)) {
+        t = (uint32_t)vosMillis() - since;
+        if (t >= timeout || vosSemWaitTimeout(m->ev, TIME_U(timeout - t, MILLIS)) == VRES_TIMEOUT)
+            break;
+    }
+    if (!(m->up & bit)) {
+        // a late UA must not open it
+        m->refused |= bit;
+        return -1;
+    }
+    return 0;
+}
+
+void cmux_close(CMux *m, uint8_t dlci)
+{
+    uint8_t bit = 1 << dlci;
+
+    if (dlci >= 8 || !(m->up & bit))
+        return;
+    cmux_command(m, dlci, CMUX_DISC | CMUX_PF, NULL, 0);
+    m->up &= ~bit;
+    m->refused |= bit;
+}
+
+void cmux_stop(CMux *m)
+{
+    uint8_t cld[2] = {CMUX_CLD | CMUX_CR, CMUX_EA};
+    int dlci;
+
+#if defined(ZERYNTH_GSM_PPP)
+    cmux_ppp_stop(m);
+#endif
+    for (dlci = 7; dlci > 0; dlci--)
+        cmux_close(m, dlci);
+    if (m->up & 1)
+        cmux_command(m, 0, CMUX_UIH, cld, 2);
+    m->up = 0;
+    m->refused = 0;
+    m->state = S_FLAG;
+}
+
+int cmux_send(CMux *m, uint8_t dlci, const uint8_t *data, int len)
+{
+    int n, sent = 0;
+
+    if (dlci >= 8 || !(m->up & (1 << dlci)))
+        return -1;
+    vosMtxLock(m->tx);
+    while (sent < len) {
+        n = len - sent;
+        if (n > CMUX_N1)
+            n = CMUX_N1;
+        if (cmux_frame(m, dlci, CMUX_UIH, 1, data + sent, n) < 0) {
+            vosMtxUnlock(m->tx);
+            return -1;
+        }
+        sent += n;
+    }
+    vosMtxUnlock(m->tx);
+    return len;
+}
+
+#if defined(ZERYNTH_GSM_PPP)
+
+#include "lwip/tcpip.h"
+#include "netif/ppp/pppapi.h"
+#include "netif/ppp/pppos.h"
+
+// one modem per device: the netif is never released, as lwIP requires
+static struct netif cmux_netif;
+
+static void cmux_ppp_input(CMux *m, const uint8_t *data, int len)
+{
+    pppos_input_tcpip((ppp_pcb*)m->ppp, (u8_t*)data, len);
+}
+
+// from the tcpip thread
+static u32_t cmux_ppp_output(ppp_pcb *pcb, u8_t *data, u32_t len, void *ctx)
+{
+    CMux *m = (CMux*)ctx;
+    (void)pcb;
+
+    return (cmux_send(m, m->ppp_dlci, data, len) < 0) ? 0 : len;
+}
+
+static void cmux_ppp_status(ppp_pcb *pcb, int err, void *ctx)
+{
+    CMux *m = (CMux*)ctx;
+    (void)pcb;
+
+    m->ppp_err = err;
+    vosSemSignal(m->ppp_ev);
+}
+
+int cmux_ppp_start(CMux *m, uint8_t dlci, const char *user, const char *pwd, int auth, uint32_t timeout)
+{
+    ppp_pcb *pcb;
+    uint8_t authtype;
+
+    if (m->ppp)
+        return PPPERR_PARAM;
+    switch (auth) {
+        case 1: authtype = PPPAUTHTYPE_PAP; break;
+        case 2: authtype = PPPAUTHTYPE_CHAP; break;
+        case 3: authtype = PPPAUTHTYPE_ANY; break;
+        default: authtype = PPPAUTHTYPE_NONE; break;
+    }
+    if (!m->ppp_ev)
+        m->ppp_ev = vosSemCreate(0);
+    vosSemReset(m->ppp_ev);
+    m->ppp_dlci = dlci;
+    m->ppp_err = PPPERR_CONNECT;
+    pcb = pppapi_pppos_create(&cmux_netif, cmux_ppp_output, cmux_ppp_status, m);
+    if (!pcb)
+        return PPPERR_ALLOC;
+    m->netif = &cmux_netif;
+    ppp_set_usepeerdns(pcb, 1);
+    if (authtype != PPPAUTHTYPE_NONE)
+        ppp_set_auth(pcb, authtype, user, pwd);
+    pppapi_set_default(pcb);
+    // the decoder hands the channel to PPP from now on
+    m->ppp = pcb;
+    pppapi_connect(pcb, 0);
+    if (vosSemWaitTimeout(m->ppp_ev, TIME_U(timeout, MILLIS)) == VRES_TIMEOUT || m->ppp_err != PPPERR_NONE) {
+        cmux_ppp_stop(m);
+        return (m->ppp_err == PPPERR_NONE) ? PPPERR_CONNECT : m->ppp_err;
+    }
+    return PPPERR_NONE;
+}
+
+void cmux_ppp_stop(CMux *m)
+{
+    ppp_pcb *pcb = (ppp_pcb*)m->ppp;
+
+    if (!pcb)
+        return;
+    vosSemReset(m->ppp_ev);
+    pppapi_close(pcb, 0);
+    // the status callback reports PPPERR_USER once the link is dead and the pcb can be freed
+    vosSemWaitTimeout(m->ppp_ev, TIME_U(5000, MILLIS));
+    m->ppp = NULL;
+    pppapi_free(pcb);
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef ZERYNTH_CMUX_H_
+#define ZERYNTH_CMUX_H_
+
+#include <stdint.h>
+#include "zerynth.h"
+
+/*
+ * 3GPP TS 27.010 multiplexer, basic option, for gsm drivers running PPP next to the AT channel.
+ *
+ * The driver owns the serial port: it passes the bytes read to cmux_input from its reader thread, and gives cmux_init the function
+ * writing to the port. After AT+CMUX=0 succeeds, cmux_open opens the control channel (DLCI 0) and then each data channel: usually
+ * DLCI 1 for AT commands and DLCI 2 for data. Frames received on channels other than the PPP one go to the recv callback.
+ *
+ * With ZERYNTH_GSM_PPP defined, and lwIP with PPPoS support in the VM (ZERYNTH_SOCKETS_EXTERNAL_TCP_STACK), cmux_ppp_start runs
+ * lwIP PPP over a channel, once the driver dialed it (ATD*99# answered by CONNECT): the netif becomes the default one and the
+ * driver can register the lwIP socket API with gzsock_init, so that sockets, select, TLS and requests bypass the AT socket commands.
+ */
+
+#ifndef CMUX_N1
+#define CMUX_N1         127     // max information bytes per frame, as in AT+CMUX (default 31 in the standard)
+#endif
+#define CMUX_CHANNELS   4
+
+typedef struct _cmux CMux;
+
+typedef int (*cmux_write_fn)(CMux *m, const uint8_t *data, int len);
+typedef void (*cmux_recv_fn)(CMux *m, uint8_t dlci, const uint8_t *data, int len);
+
+struct _cmux {
+    cmux_write_fn write;
+    cmux_recv_fn recv;
+    void *ctx;                  // for the driver
+    VMutex tx;
+    VSemaphore ev;
+    volatile uint8_t up;        // open channels, a bit per DLCI
+    volatile uint8_t refused;   // channels whose next UA is not an opening
+    volatile uint8_t denied;    // channels answered with DM
+    uint8_t ppp_dlci;
+    // decoder
+    uint8_t state;
+    uint8_t addr;
+    uint8_t ctrl;
+    uint8_t fcs;
+    uint16_t len;
+    uint16_t pos;
+    uint8_t frame[CMUX_N1];
+    // stats
+    uint32_t rx_frames;
+    uint32_t tx_frames;
+    uint32_t rx_errors;         // bad FCS, length or closing flag
+#if defined(ZERYNTH_GSM_PPP)
+    void *ppp;
+    void *netif;
+    VSemaphore ppp_ev;
+    volatile int ppp_err;
+#endif
+};
+
+void cmux_init(CMux *m, cmux_write_fn write, cmux_recv_fn recv, void *ctx);
+// feeds bytes read from the serial port: complete frames are dispatched from the calling thread
+void cmux_input(CMux *m, const uint8_t *data, int len);
+// opens channel dlci (0 first), waiting at most timeout milliseconds for the modem. Returns 0, or -1 if refused or timed out
+int cmux_open(CMux *m, uint8_t dlci, uint32_t timeout);
+void cmux_close(CMux *m, uint8_t dlci);
+// closes every channel and the multiplexer: the port is back to AT commands
+void cmux_stop(CMux *m);
+// sends data on channel dlci, split in frames of CMUX_N1 bytes. Returns len, or -1 if the channel is not open or the port fails
+int cmux_send(CMux *m, uint8_t dlci, const uint8_t *data, int len);
+
+#if defined(ZERYNTH_GSM_PPP)
+/*
+ * Starts PPP on the dialed channel dlci, authenticating with auth (gsm.AUTH_ constants), and waits at most timeout milliseconds
+ * for the link to be up. Returns 0 or the lwIP PPPERR_ code
+ */
+int cmux_ppp_start(CMux *m, uint8_t dlci, const char *user, const char *pwd, int auth, uint32_t timeout);
+void cmux_ppp_stop(CMux *m);
+#endif
+
+#endif
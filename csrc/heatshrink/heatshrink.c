@@ -0,0 +1,353 @@
+#include "zerynth.h"
+
+/*
+ * Resumable LZSS compression in the heatshrink format, for the heatshrink module.
+ *
+ * The output is a stream of bits, most significant first: a 1 followed by 8 bits is a literal byte, a 0 followed by
+ * window_bits bits (offset - 1) and lookahead_bits bits (length - 1) is a copy of length bytes found offset bytes back.
+ * The last byte is padded with zeros. Streams are interchangeable with the heatshrink library with the same parameters.
+ *
+ * As in zinflate.c the whole state lives in a bytearray owned by Python, and both directions stop when either the input
+ * or the output runs out, continuing from the same point at the next call. The encoder keeps the window and as much input
+ * in a buffer of twice the window, and finds matches through chains of positions with the same hash of their first two
+ * bytes, stored as 16 bits stream positions: a stale position can only point to bytes still in the buffer, that are
+ * compared anyway. The decoder only keeps the window.
+ */
+
+#define HS_MIN_WINDOW   8
+#define HS_MAX_WINDOW   12
+#define HS_MIN_LOOKAHEAD 3
+#define HS_HASH         256
+#define HS_CHAIN        16      // positions tried per match
+#define HS_NIL          0xffff
+
+typedef struct _hs_encoder {
+    uint8_t wbits;
+    uint8_t lbits;
+    uint8_t minmatch;
+    uint8_t finishing;
+    uint8_t done;
+    uint8_t nbits;      // pending output bits in acc
+    uint16_t fill;      // bytes in buf
+    uint16_t pos;       // next byte of buf to encode
+    uint16_t hashed;    // next byte of buf to insert in the chains
+    uint16_t base;      // stream position of buf[0], modulo 65536
+    uint32_t acc;
+    uint16_t head[HS_HASH];
+    // uint16_t prev[window], stream position of the previous byte with the same hash, by stream position
+    // uint8_t buf[2 * window]
+} HsEncoder;
+
+typedef struct _hs_decoder {
+    uint8_t wbits;
+    uint8_t lbits;
+    uint8_t nbits;
+    uint8_t pad;
+    uint16_t wpos;
+    uint16_t copy_len;
+    uint16_t copy_off;
+    uint32_t acc;
+    // uint8_t window[window]
+} HsDecoder;
+
+#define HS_ENC_SIZE(w)  (sizeof(HsEncoder) + (sizeof(uint16_t) << (w)) + (2 << (w)))
+#define HS_DEC_SIZE(w)  (sizeof(HsDecoder) + (1 << (w)))
+#define HS_ENCODER(o)   ((HsEncoder*)PSEQUENCE_BYTES(o))
+#define HS_DECODER(o)   ((HsDecoder*)PSEQUENCE_BYTES(o))
+#define IS_HS_ENCODER(o) (PTYPE(o)==PBYTEARRAY && PSEQUENCE_ELEMENTS(o)>(int32_t)sizeof(HsEncoder) && HS_ENC_SIZE(HS_ENCODER(o)->wbits)==(uint32_t)PSEQUENCE_ELEMENTS(o))
+#define IS_HS_DECODER(o) (PTYPE(o)==PBYTEARRAY && PSEQUENCE_ELEMENTS(o)>(int32_t)sizeof(HsDecoder) && HS_DEC_SIZE(HS_DECODER(o)->wbits)==(uint32_t)PSEQUENCE_ELEMENTS(o))
+#define HS_PREV(e)  ((uint16_t*)((e) + 1))
+#define HS_BUF(e)   ((uint8_t*)(HS_PREV(e) + (1 << (e)->wbits)))
+#define HS_WIN(d)   ((uint8_t*)((d) + 1))
+
+static inline uint32_t hs_hash(const uint8_t *p)
+{
+    return ((p[0] << 3) ^ p[1] ^ (p[0] >> 5)) & (HS_HASH - 1);
+}
+
+// inserts the positions before pos in the chains, as soon as the byte after each is there
+static void hs_insert(HsEncoder *e)
+{
+    uint32_t h;
+    uint16_t s;
+
+    while (e->hashed < e->pos && e->hashed + 1 < e->fill) {
+        h = hs_hash(HS_BUF(e) + e->hashed);
+        s = e->base + e->hashed;
+        HS_PREV(e)[s & ((1 << e->wbits) - 1)] = e->head[h];
+        e->head[h] = s;
+        e->hashed++;
+    }
+}
+
+// longest match for buf[pos], at most avail bytes. Returns its length, the offset in *off
+static uint32_t hs_match(HsEncoder *e, uint32_t avail, uint32_t *off)
+{
+    uint8_t *buf = HS_BUF(e);
+    uint8_t *p = buf + e->pos, *q;
+    uint32_t window = 1 << e->wbits, best = 0, last = 0, d, n, tries = HS_CHAIN;
+    uint16_t s = e->base + e->pos, c;
+
+    if (avail < 2)
+        return 0;
+    c = e->head[hs_hash(p)];
+    while (c != HS_NIL && tries--) {
+        d = (uint16_t)(s - c);
+        // chains go back in the stream: anything else is stale
+        if (d <= last || d > window || d > e->pos)
+            break;
+        last = d;
+        q = p - d;
+        if (p[best] == q[best]) {
+            for (n = 0; n < avail && p[n] == q[n]; n++);
+            if (n > best) {
+                best = n;
+                *off = d;
+                if (n == avail)
+                    break;
+            }
+        }
+        c = HS_PREV(e)[c & (window - 1)];
+    }
+    return best;
+}
+
+// appends the n low bits of v to the pending output bits
+static inline void hs_push(HsEncoder *e, uint32_t v, uint32_t n)
+{
+    e->acc = (e->acc << n) | v;
+    e->nbits += n;
+}
+
+// moves the whole pending bytes into out, returns 0 if out is full before
+static inline uint32_t hs_drain(HsEncoder *e, uint8_t *out, uint32_t outlen, uint32_t *o)
+{
+    while (e->nbits >= 8) {
+        if (*o == outlen)
+            return 0;
+        e->nbits -= 8;
+        out[(*o)++] = e->acc >> e->nbits;
+    }
+    return 1;
+}
+
+/*
+ * compresses at most inlen bytes of in into out, returning the bytes written and the bytes consumed in *used.
+ * With e->finishing set, everything buffered is flushed, and done is set when the last byte is written.
+ * A symbol is encoded only with less than a byte pending (at most 31 bits then), so that out can be of any size
+ */
+static uint32_t hs_enc_run(HsEncoder *e, const uint8_t *in, uint32_t inlen, uint32_t *used, uint8_t *out, uint32_t outlen)
+{
+    uint32_t window = 1 << e->wbits, lookahead = 1 << e->lbits, size = 2 * window;
+    uint32_t o = 0, i = 0, k, avail, len, off = 0;
+    uint8_t *buf = HS_BUF(e);
+
+    while (!e->done && hs_drain(e, out, outlen, &o)) {
+        if (e->fill < size && i < inlen) {
+            k = size - e->fill;
+            if (k > inlen - i)
+                k = inlen - i;
+            memcpy(buf + e->fill, in + i, k);
+            e->fill += k;
+            i += k;
+        }
+        avail = e->fill - e->pos;
+        if (avail < lookahead && (i < inlen || !e->finishing)) {
+            if (i == inlen)
+                break;
+            // buffer full: keep the window behind pos
+            k = e->pos - window;
+            memmove(buf, buf + k, e->fill - k);
+            e->fill -= k;
+            e->pos -= k;
+            e->hashed -= k;
+            e->base += k;
+            continue;
+        }
+        if (!avail) {
+            // finishing: pad the last byte, done once written
+            if (e->nbits)
+                hs_push(e, 0, 8 - e->nbits);
+            else
+                e->done = 1;
+            continue;
+        }
+        hs_insert(e);
+        len = hs_match(e, (avail < lookahead) ? avail : lookahead, &off);
+        if (len >= e->minmatch) {
+            hs_push(e, 0, 1);
+            hs_push(e, off - 1, e->wbits);
+            hs_push(e, len - 1, e->lbits);
+        } else {
+            hs_push(e, 0x100 | buf[e->pos], 9);
+            len = 1;
+        }
+        e->pos += len;
+    }
+    *used = i;
+    return o;
+}
+
+static uint32_t hs_dec_run(HsDecoder *d, const uint8_t *in, uint32_t inlen, uint32_t *used, uint8_t *out, uint32_t outlen)
+{
+    uint32_t mask = (1 << d->wbits) - 1, o = 0, i = 0, need, v;
+    uint8_t *win = HS_WIN(d), b;
+
+    for (;;) {
+        while (d->copy_len && o < outlen) {
+            b = win[(d->wpos - d->copy_off) & mask];
+            win[d->wpos] = b;
+            d->wpos = (d->wpos + 1) & mask;
+            out[o++] = b;
+            d->copy_len--;
+        }
+        if (d->copy_len)
+            break;
+        while (d->nbits <= 24 && i < inlen) {
+            d->acc = (d->acc << 8) | in[i++];
+            d->nbits += 8;
+        }
+        if (!d->nbits)
+            break;
+        need = ((d->acc >> (d->nbits - 1)) & 1) ? 9 : 1 + d->wbits + d->lbits;
+        if (d->nbits < need)
+            break;
+        if (need == 9) {
+            if (o == outlen)
+                break;
+            d->nbits -= 9;
+            b = d->acc >> d->nbits;
+            win[d->wpos] = b;
+            d->wpos = (d->wpos + 1) & mask;
+            out[o++] = b;
+        } else {
+            d->nbits -= need;
+            v = (d->acc >> d->nbits) & ((1 << (need - 1)) - 1);
+            d->copy_off = (v >> d->lbits) + 1;
+            d->copy_len = (v & ((1 << d->lbits) - 1)) + 1;
+        }
+    }
+    *used = i;
+    return o;
+}
+
+static PObject *hs_state(int nargs, PObject **args, uint32_t enc)
+{
+    int32_t wbits, lbits;
+    uint32_t size;
+    PObject *state;
+
+    if (parse_py_args("ii", nargs, args, &wbits, &lbits) != 2)
+        return NULL;
+    if (wbits < HS_MIN_WINDOW || wbits > HS_MAX_WINDOW || lbits < HS_MIN_LOOKAHEAD || lbits >= wbits)
+        return NULL;
+    size = enc ? HS_ENC_SIZE(wbits) : HS_DEC_SIZE(wbits);
+    state = (PObject*)psequence_new(PBYTEARRAY, size);
+    PSEQUENCE_ELEMENTS_SET(state, size);
+    memset(PSEQUENCE_BYTES(state), 0, size);
+    if (enc) {
+        HsEncoder *e = HS_ENCODER(state);
+        e->wbits = wbits;
+        e->lbits = lbits;
+        // a copy must be shorter than the literals it replaces
+        e->minmatch = (1 + wbits + lbits) / 9 + 1;
+        memset(e->head, 0xff, sizeof(e->head));
+        memset(HS_PREV(e), 0xff, sizeof(uint16_t) << wbits);
+    } else {
+        HsDecoder *d = HS_DECODER(state);
+        d->wbits = wbits;
+        d->lbits = lbits;
+    }
+    return state;
+}
+
+/*
+ * args: window_bits, lookahead_bits
+ * returns the state of a new encoder
+ */
+C_NATIVE(hs_encoder_new)
+{
+    C_NATIVE_UNWARN();
+
+    if (!(*res = hs_state(nargs, args, 1)))
+        return ERR_VALUE_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: window_bits, lookahead_bits
+ * returns the state of a new decoder
+ */
+C_NATIVE(hs_decoder_new)
+{
+    C_NATIVE_UNWARN();
+
+    if (!(*res = hs_state(nargs, args, 0)))
+        return ERR_VALUE_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: state, data, ofs, out, outofs, finish
+ * compresses data[ofs:] into the bytearray out from outofs, flushing everything buffered if finish is True.
+ * Returns (ofs, outofs, done): the positions reached and whether the compressed stream is complete
+ */
+C_NATIVE(hs_encode)
+{
+    C_NATIVE_UNWARN();
+    HsEncoder *e;
+    int32_t ofs, outofs, inlen, outlen;
+    uint32_t used, n;
+    PObject *tpl;
+
+    if (nargs != 6 || !IS_HS_ENCODER(args[0]) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1])) || !IS_PSMALLINT(args[2]) || PTYPE(args[3]) != PBYTEARRAY || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    e = HS_ENCODER(args[0]);
+    inlen = PSEQUENCE_ELEMENTS(args[1]);
+    ofs = PSMALLINT_VALUE(args[2]);
+    outlen = PSEQUENCE_ELEMENTS(args[3]);
+    outofs = PSMALLINT_VALUE(args[4]);
+    if (ofs < 0 || ofs > inlen || outofs < 0 || outofs > outlen)
+        return ERR_INDEX_EXC;
+    if (args[5] == PBOOL_TRUE())
+        e->finishing = 1;
+    n = hs_enc_run(e, PSEQUENCE_BYTES(args[1]) + ofs, inlen - ofs, &used, PSEQUENCE_BYTES(args[3]) + outofs, outlen - outofs);
+
+    tpl = (PObject*)ptuple_new(3, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(ofs + used));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(outofs + n));
+    PTUPLE_SET_ITEM(tpl, 2, e->done ? PBOOL_TRUE() : PBOOL_FALSE());
+    *res = tpl;
+    return ERR_OK;
+}
+
+/*
+ * args: state, data, ofs, out, outofs
+ * decompresses data[ofs:] into the bytearray out from outofs. Returns (ofs, outofs), the positions reached:
+ * input is left over only when out is full
+ */
+C_NATIVE(hs_decode)
+{
+    C_NATIVE_UNWARN();
+    HsDecoder *d;
+    int32_t ofs, outofs, inlen, outlen;
+    uint32_t used, n;
+    PObject *tpl;
+
+    if (nargs != 5 || !IS_HS_DECODER(args[0]) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1])) || !IS_PSMALLINT(args[2]) || PTYPE(args[3]) != PBYTEARRAY || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    d = HS_DECODER(args[0]);
+    inlen = PSEQUENCE_ELEMENTS(args[1]);
+    ofs = PSMALLINT_VALUE(args[2]);
+    outlen = PSEQUENCE_ELEMENTS(args[3]);
+    outofs = PSMALLINT_VALUE(args[4]);
+    if (ofs < 0 || ofs > inlen || outofs < 0 || outofs > outlen)
+        return ERR_INDEX_EXC;
+    n = hs_dec_run(d, PSEQUENCE_BYTES(args[1]) + ofs, inlen - ofs, &used, PSEQUENCE_BYTES(args[3]) + outofs, outlen - outofs);
+
+    tpl = (PObject*)ptuple_new(2, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(ofs + used));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(outofs + n));
+    *res = tpl;
+    return ERR_OK;
+}
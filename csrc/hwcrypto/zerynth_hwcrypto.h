@@ -15,6 +15,12 @@ typedef struct _zhwcrypto_api_pointers
     void (*digest_sha256_finish)(void *ctx, unsigned char output[32]);
     void*(*digest_sha256_ctx_alloc)(void);
     void (*digest_sha256_ctx_free)(void *ctx);
+    //optional accelerators: NULL, or returning nonzero, falls back to software
+    int (*aes_gcm_crypt)(int mode, const unsigned char *key, unsigned int keybits, const unsigned char *iv, size_t iv_len,
+                         const unsigned char *add, size_t add_len, const unsigned char *input, size_t length,
+                         unsigned char *output, unsigned char *tag, size_t tag_len);
+    int (*ecp_secp256r1_mul)(const unsigned char k[32], const unsigned char P[64], unsigned char R[64]);
+    int (*ecdsa_secp256r1_verify)(const unsigned char Q[64], const unsigned char *hash, size_t hash_len, const unsigned char rs[64]);
 } ZHWCryptoAPIPointers;
 
 typedef enum {
@@ -39,6 +45,8 @@ typedef struct _zhwcrypto_ {
     //fields used to store api when crypto disabled
     ZHWCryptoInfo *cnfo;
     ZHWCryptoAPIPointers *capi;
+    //accelerators, kept enabled for software keys too
+    ZHWCryptoAPIPointers *accel;
 } ZHWCrypto;
 
 extern ZHWCrypto zhwcrypto;
@@ -50,10 +58,12 @@ extern ZHWCrypto zhwcrypto;
 #define ZERYNTH_HWCRYPTO_HAS_HASH() (zhwcrypto.api->digest_sha256)
 #define ZERYNTH_HWCRYPTO_API() (zhwcrypto.api)
 #define ZERYNTH_HWCRYPTO_NFO() (zhwcrypto.nfo)
+#define ZERYNTH_HWCRYPTO_ACCEL() (zhwcrypto.accel)
 
 void gzcrypto_hw_init(ZHWCryptoAPIPointers *pointers, ZHWCryptoInfo *nfo);
 void gzcrypto_hw_disable();
 void gzcrypto_hw_enable();
+void gzcrypto_hw_accel_init(ZHWCryptoAPIPointers *pointers);
 
 
 
@@ -6,7 +6,9 @@ ZHWCrypto zhwcrypto={0};
 #endif
 
 void gzcrypto_hw_init(ZHWCryptoAPIPointers *pointers, ZHWCryptoInfo *nfo) {
+    ZHWCryptoAPIPointers *accel = zhwcrypto.accel;
     memset(&zhwcrypto,0,sizeof(ZHWCrypto));
+    zhwcrypto.accel = accel;
     zhwcrypto.capi = pointers;
     zhwcrypto.cnfo = nfo;
 }
@@ -20,6 +22,14 @@ void gzcrypto_hw_enable(){
     zhwcrypto.api = zhwcrypto.capi;
     zhwcrypto.nfo = zhwcrypto.cnfo;
 }
+
+/*
+ * accelerators are used by mbedtls for any key, hardware or software:
+ * gzcrypto_hw_disable does not touch them
+ */
+void gzcrypto_hw_accel_init(ZHWCryptoAPIPointers *pointers) {
+    zhwcrypto.accel = pointers;
+}
 #else
 
 #endif
@@ -8,7 +8,139 @@
 #define VBOARD_SLEEP_MICRO_COMPENSATION 0
 #endif
 
+/*
+ * Sleeps with microsecond deadlines on a single hardware timer.
+ *
+ * Sleeping threads take a slot of htm_waiters and suspend. The timer is armed for the earliest deadline, its callback
+ * resumes the threads whose deadline is due and the first of them to run arms the timer for the next deadline: vhal is
+ * only called from threads, under htm_lock. A thread woken early (the timer was armed again meanwhile) goes back to sleep.
+ * htm_clock is a system timer that only gives the microsecond clock.
+ */
+
+#define HTM_WAITERS     8
+#define HTM_NONE        ((uint64_t)-1)
+#define HTM_MAX_DELAY   0x3fffffff
+
+#define HTM_FREE        0
+#define HTM_WAITING     1
+#define HTM_WOKEN       2
+
+typedef struct _htm_waiter {
+    VThread th;
+    uint64_t deadline;
+    uint8_t state;
+    uint8_t suspended;
+} HtmWaiter;
+
 int32_t hwtimer = -1;
+static VSysTimer htm_clock;
+static VSemaphore htm_lock;
+static HtmWaiter htm_waiters[HTM_WAITERS];
+static uint64_t htm_armed = HTM_NONE;
+
+
+// 64 bits microseconds: the 32 bits micros of the system timer, placed around its 64 bits millis
+static uint64_t htm_micros(void)
+{
+    uint64_t ms = vosTimerReadMillis(htm_clock);
+    uint32_t us = vosTimerReadMicros(htm_clock);
+    uint64_t approx = ms * 1000;
+
+    return approx + (int32_t)(us - (uint32_t)approx);
+}
+
+static void htm_expired(uint32_t tm, void *args)
+{
+    (void)tm;
+    (void)args;
+    int i;
+
+    SYSLOCK_I();
+    for (i = 0; i < HTM_WAITERS; i++) {
+        HtmWaiter *w = &htm_waiters[i];
+        if (w->state == HTM_WAITING && w->deadline <= htm_armed) {
+            w->state = HTM_WOKEN;
+            if (w->suspended) {
+                w->suspended = 0;
+                vosThResumeIsr(w->th);
+            }
+        }
+    }
+    htm_armed = HTM_NONE;
+    SYSUNLOCK_I();
+}
+
+// arms the timer for the earliest waiting deadline, unless already armed for it or before
+static void htm_arm(void)
+{
+    uint64_t next = HTM_NONE, now;
+    int64_t delay;
+    int i;
+
+    vosSemWait(htm_lock);
+    SYSLOCK();
+    for (i = 0; i < HTM_WAITERS; i++) {
+        if (htm_waiters[i].state == HTM_WAITING && htm_waiters[i].deadline < next)
+            next = htm_waiters[i].deadline;
+    }
+    if (next >= htm_armed)
+        next = HTM_NONE;
+    else
+        htm_armed = next;
+    SYSUNLOCK();
+    if (next != HTM_NONE) {
+        now = htm_micros();
+        delay = (int64_t)(next - now) - VBOARD_SLEEP_MICRO_COMPENSATION;
+        if (delay < 1)
+            delay = 1;
+        if (delay > HTM_MAX_DELAY)
+            delay = HTM_MAX_DELAY;
+        vhalHtmOneShot(hwtimer, TIME_U((uint32_t)delay, MICROS), htm_expired, NULL, 0);
+    }
+    vosSemSignal(htm_lock);
+}
+
+// suspends the current thread until the clock reaches deadline. Called without the GIL
+static int htm_sleep_until(uint64_t deadline)
+{
+    HtmWaiter *w = NULL;
+    int i;
+
+    SYSLOCK();
+    for (i = 0; i < HTM_WAITERS; i++) {
+        if (htm_waiters[i].state == HTM_FREE) {
+            w = &htm_waiters[i];
+            w->state = HTM_WAITING;
+            w->suspended = 0;
+            w->deadline = deadline;
+            w->th = vosThCurrent();
+            break;
+        }
+    }
+    SYSUNLOCK();
+    if (!w)
+        return -1;
+
+    while (htm_micros() + VBOARD_SLEEP_MICRO_COMPENSATION < deadline) {
+        htm_arm();
+        SYSLOCK();
+        if (w->state == HTM_WAITING) {
+            w->suspended = 1;
+            // releases the lock
+            vosThSuspend();
+        } else {
+            SYSUNLOCK();
+        }
+        // early if the timer was armed again for an earlier deadline meanwhile
+        w->state = HTM_WAITING;
+    }
+    SYSLOCK();
+    w->state = HTM_FREE;
+    SYSUNLOCK();
+    // the others
+    htm_arm();
+    return 0;
+}
 
 
 C_NATIVE(hwtimers_init) {
@@ -17,6 +149,8 @@ C_NATIVE(hwtimers_init) {
     hwtimer = vhalHtmGetFreeTimer();
     if (hwtimer < 0)
         return ERR_UNSUPPORTED_EXC;
+    htm_clock = vosTimerCreate();
+    htm_lock = vosSemCreate(1);
     *res = MAKE_NONE();
     return ERR_OK;
 }
@@ -28,15 +162,50 @@ C_NATIVE(hwtimers_sleep_micros) {
         return ERR_TYPE_EXC;
     int32_t micros = PSMALLINT_VALUE(args[0]);
     *res = MAKE_NONE();
-    int ret=ERR_OK;
-    //printf("wait %i\n",micros);
-    //compensate: 
-    //micros=micros-(80-((_system_frequency/1000000-84)*80)/84);
-    micros-=VBOARD_SLEEP_MICRO_COMPENSATION;
+    int ret = 0;
     if (micros > 0) {
         RELEASE_GIL();
-        ret = vhalSleepMicros(hwtimer, micros);
+        ret = htm_sleep_until(htm_micros() + micros);
         ACQUIRE_GIL();
     }
+    return (ret < 0) ? ERR_RUNTIME_EXC : ERR_OK;
+}
+
+/*
+ * no args: returns the microseconds since hwtimers_init, as wide as the VM integers
+ */
+C_NATIVE(hwtimers_micros) {
+    C_NATIVE_UNWARN();
+    INT_TYPE us = (INT_TYPE)htm_micros();
+
+    if (us > -1073741824 && us < 1073741824)
+        *res = PSMALLINT_NEW(us);
+    else
+        *res = (PObject*)pinteger_new(us);
     return ERR_OK;
-}
\ No newline at end of file
+}
+
+/*
+ * args: deadline
+ * suspends the thread until hwtimers_micros reaches deadline, if in the future
+ */
+C_NATIVE(hwtimers_sleep_until_micros) {
+    C_NATIVE_UNWARN();
+    INT_TYPE deadline, delta;
+    uint64_t now;
+    int ret = 0;
+
+    if (nargs != 1 || !IS_INTEGER(args[0]))
+        return ERR_TYPE_EXC;
+    deadline = INTEGER_VALUE(args[0]);
+    *res = MAKE_NONE();
+    now = htm_micros();
+    // a deadline truncated to 32 bits integers is still compared correctly
+    delta = (INT_TYPE)((UINT_TYPE)deadline - (UINT_TYPE)now);
+    if (delta > 0) {
+        RELEASE_GIL();
+        ret = htm_sleep_until(now + delta);
+        ACQUIRE_GIL();
+    }
+    return (ret < 0) ? ERR_RUNTIME_EXC : ERR_OK;
+}
@@ -320,176 +320,1152 @@ void jsmn_init(jsmn_parser *parser) {
 #include "zerynth.h"
 //#define printf(...) vbl_printf_stdout(__VA_ARGS__)
 
+#include "../misc/zfloat.h"
+
+/* floats of the VM are single precision */
+#if defined(Z_DOUBLE_FP)
+#define JSMN_SINGLE 0
+#else
+#define JSMN_SINGLE 1
+#endif
+
+/**
+ * Converts the JSON number in str to an integer (returns 0, result in ires)
+ * or to a float (returns 1, result in fres). Returns -1 if str is not a number.
+ * Floats are correctly rounded by zf_parse, whatever their number of digits.
+ */
 int str_to_num(char *str,int size, int64_t* ires, FLOAT_TYPE* fres){
     int i=0;
-    int sign;
-    uint64_t iacc=0;
+    int neg=0;
+    int ndigits=0;
+    int exp10=0;
+    int ex=0;
+    int exneg=0;
+    int is_float=0;
     uint64_t macc=0;
-    uint64_t dacc=0;
-    FLOAT_TYPE facc=0;
-    int is_float = 0;
+    double facc;
 
-    if(str[0]=='-'){
-        sign = -1;
-        i=1;
-    } else {
-        sign = 1;
+    if (i<size && str[i]=='-') {
+        neg = 1;
+        i++;
+    }
+    if (i>=size || str[i]<'0' || str[i]>'9') return -1;
+    for(;i<size && str[i]>='0' && str[i]<='9';i++){
+        if (ndigits<19) {
+            macc = macc*10+(str[i]-'0');
+            if (macc) ndigits++;
+        } else exp10++;
+    }
+    if (i<size && str[i]=='.'){
+        is_float = 1;
+        i++;
+        if (i>=size || str[i]<'0' || str[i]>'9') return -1;
+        for(;i<size && str[i]>='0' && str[i]<='9';i++){
+            if (ndigits<19) {
+                macc = macc*10+(str[i]-'0');
+                if (macc) ndigits++;
+                exp10--;
+            }
+        }
+    }
+    if (i<size && (str[i]=='e' || str[i]=='E')){
+        is_float = 1;
+        i++;
+        if (i<size && (str[i]=='+' || str[i]=='-')) exneg = (str[i++]=='-');
+        if (i>=size || str[i]<'0' || str[i]>'9') return -1;
+        for(;i<size && str[i]>='0' && str[i]<='9';i++){
+            if (ex<10000) ex = ex*10+(str[i]-'0');
+        }
+        exp10 += (exneg) ? -ex:ex;
+    }
+    if (i!=size) return -1;
+
+    if (!is_float && !exp10 && macc<=(uint64_t)INT64_MAX) {
+        *ires = (neg) ? -(int64_t)macc:(int64_t)macc;
+        return 0;
+    }
+    zf_parse(str,size,JSMN_SINGLE,&facc);
+    *fres = (FLOAT_TYPE)facc;
+    return 1;
+}
+
+
+/**
+ * Maximum nesting of objects and arrays accepted by the parser.
+ * Each level costs one JsmnLevel in the parser state.
+ */
+#ifndef JSMN_MAX_DEPTH
+#define JSMN_MAX_DEPTH 32
+#endif
+
+/* at most one path per bit of the JsmnLevel masks */
+#define JSMN_MAX_PATHS 32
+
+/* what the parser expects to find after the current position */
+#define JSMN_EXPECT_VALUE       0
+#define JSMN_EXPECT_VALUE_OR_END 1
+#define JSMN_EXPECT_KEY         2
+#define JSMN_EXPECT_KEY_OR_END  3
+#define JSMN_EXPECT_COLON       4
+#define JSMN_EXPECT_NEXT        5
+#define JSMN_EXPECT_NOTHING     6
+
+/* parser flags */
+#define JSMN_FLAG_STREAM    1   /* input comes in chunks, many root values allowed */
+#define JSMN_FLAG_APPEND    2   /* selected values are appended to out instead of stored at out[path] */
+#define JSMN_FLAG_PACK      4   /* numeric arrays are decoded into bytearray/shortarray/float buffers */
+
+/**
+ * Open container. Containers being built (build=1) also have an entry
+ * [container, pending key] in the stack list; the others are only scanned.
+ * match is the set of paths that may still select something inside the
+ * container, sel the set of paths selecting the container itself.
+ * kmatch and ksel are the same sets computed for the value of the pending key.
+ */
+typedef struct _jsmn_level {
+    uint8_t type;
+    uint8_t build;
+    uint16_t index;
+    uint32_t match;
+    uint32_t sel;
+    uint32_t kmatch;
+    uint32_t ksel;
+} JsmnLevel;
+
+/**
+ * Parser state. It only holds scalars so that it can live in a bytes
+ * object between two chunks; PObjects are kept in the stack list.
+ */
+typedef struct _jsmn_state {
+    uint8_t expect;
+    uint8_t depth;
+    uint8_t flags;
+    uint8_t npaths;
+    JsmnLevel levels[JSMN_MAX_DEPTH];
+} JsmnState;
+
+/* value of 4 hex digits, -1 if not hex */
+static int jsmn_hex4(uint8_t *str){
+    int i,v=0;
+    uint8_t c;
+
+    for(i=0;i<4;i++){
+        c = str[i];
+        if (c>='0' && c<='9') c-='0';
+        else if (c>='a' && c<='f') c-='a'-10;
+        else if (c>='A' && c<='F') c-='A'-10;
+        else return -1;
+        v = (v<<4)|c;
     }
+    return v;
+}
+
+/**
+ * Creates a PSTRING from the raw (still escaped) bytes of a JSON string.
+ * Escapes are decoded in place with a read and a write cursor; \uXXXX
+ * (and surrogate pairs) become UTF-8, never longer than the escape itself.
+ * Returns NULL on a bad escape.
+ */
+static PObject *jsmn_make_string(uint8_t *str, int len){
+    PObject *obj;
+    uint8_t *buf;
+    int i,j,u,lo;
 
-    for(;i<size;i++){
-        if (str[i]=='.'){
-            is_float=1;
-            macc=0;
-            dacc=1;
+    if (!memchr(str,'\\',len)) return (PObject*)pstring_new(len,str);
+
+    obj = (PObject*)pstring_new(len,str);
+    buf = PSEQUENCE_BYTES(obj);
+    for(i=0,j=0;i<len;i++,j++) {
+        if (buf[i]!='\\') {
+            buf[j] = buf[i];
             continue;
         }
-        if (is_float){
-            macc=macc*10+(str[i]-'0');
-            dacc=dacc*10;
-        } else {
-            iacc=iacc*10+(str[i]-'0');
+        if (++i>=len) return NULL;
+        switch(buf[i]){
+            case 'n': buf[j]='\n'; break;
+            case 't': buf[j]='\t'; break;
+            case 'r': buf[j]='\r'; break;
+            case 'f': buf[j]='\f'; break;
+            case 'b': buf[j]='\b'; break;
+            case '\"': case '\\': case '/': buf[j]=buf[i]; break;
+            case 'u':
+                if (i+4>=len) return NULL;
+                u = jsmn_hex4(buf+i+1);
+                if (u<0) return NULL;
+                i+=4;
+                if (u>=0xd800 && u<0xdc00 && i+6<len && buf[i+1]=='\\' && buf[i+2]=='u') {
+                    lo = jsmn_hex4(buf+i+3);
+                    if (lo>=0xdc00 && lo<0xe000) {
+                        u = 0x10000+((u-0xd800)<<10)+(lo-0xdc00);
+                        i+=6;
+                    }
+                }
+                if (u<0x80) {
+                    buf[j] = u;
+                } else if (u<0x800) {
+                    buf[j++] = 0xc0|(u>>6);
+                    buf[j] = 0x80|(u&0x3f);
+                } else if (u<0x10000) {
+                    buf[j++] = 0xe0|(u>>12);
+                    buf[j++] = 0x80|((u>>6)&0x3f);
+                    buf[j] = 0x80|(u&0x3f);
+                } else {
+                    buf[j++] = 0xf0|(u>>18);
+                    buf[j++] = 0x80|((u>>12)&0x3f);
+                    buf[j++] = 0x80|((u>>6)&0x3f);
+                    buf[j] = 0x80|(u&0x3f);
+                }
+                break;
+            default:
+                return NULL;
         }
     }
-    if (is_float){
-        facc = (FLOAT_TYPE)iacc+(FLOAT_TYPE)macc/(FLOAT_TYPE)dacc;
-        //printf("iacc %i, macc %i, dacc %i, is_float %i, f %g %x\n",iacc,macc,dacc,is_float,facc,facc);
+    PSEQUENCE_ELEMENTS_SET(obj,j);
+    return obj;
+}
+
+/**
+ * Size of the key interning table of a call (a power of 2). When it is
+ * full, new keys take the place of older ones.
+ */
+#ifndef JSMN_KEYS_SIZE
+#define JSMN_KEYS_SIZE 64
+#endif
+
+/**
+ * Returns the PSTRING for an object key, reusing a previous one with the same
+ * raw bytes if it is still in the keys table (a list of JSMN_KEYS_SIZE slots).
+ * With no table, a new PSTRING is always created.
+ */
+static PObject *jsmn_intern(PObject *keys, uint8_t *str, int len){
+    PObject **slots;
+    PObject *obj;
+    uint32_t h=2166136261u;
+    int i,p;
+
+    if (!keys) return jsmn_make_string(str,len);
+    for(i=0;i<len;i++) h=(h^str[i])*16777619u;
+    slots = PSEQUENCE_OBJECTS(keys);
+    //probe a few slots, then give up and replace the first one
+    for(i=0;i<4;i++){
+        p = (h+i)&(JSMN_KEYS_SIZE-1);
+        obj = slots[p];
+        if (obj==MAKE_NONE()) break;
+        if (PSEQUENCE_ELEMENTS(obj)==len && memcmp(PSEQUENCE_BYTES(obj),str,len)==0) return obj;
     }
-    *ires=sign*iacc;
-    *fres=sign*facc;
-    return is_float;
+    if (i==4) p = h&(JSMN_KEYS_SIZE-1);
+    obj = jsmn_make_string(str,len);
+    //keys with escapes decode to different bytes: don't store them
+    if (obj && PSEQUENCE_ELEMENTS(obj)==len) slots[p] = obj;
+    return obj;
 }
 
-C_NATIVE(jsmn_loads){
-    C_NATIVE_UNWARN();
-    uint8_t *jstr;
-    uint32_t jlen;
-    int r,i,c,ii,j;
+/**
+ * Creates the PObject for a JSON primitive (true, false, null or number).
+ * Returns NULL if the primitive is not valid.
+ */
+static PObject *jsmn_make_primitive(uint8_t *str, int len){
     int64_t nn;
     FLOAT_TYPE ff;
+    int32_t sv=0;
+    int i;
 
-    if (parse_py_args("s", nargs, args, &jstr, &jlen) != 1)
-        return ERR_TYPE_EXC;
+    switch(str[0]){
+        case 't':
+            if (len==4 && memcmp(str,"true",4)==0) return PBOOL_TRUE();
+            return NULL;
+        case 'f':
+            if (len==5 && memcmp(str,"false",5)==0) return PBOOL_FALSE();
+            return NULL;
+        case 'n':
+            if (len==4 && memcmp(str,"null",4)==0) return MAKE_NONE();
+            return NULL;
+    }
+    //fast path: up to 9 digits always fit in a PSMALLINT
+    i = (str[0]=='-');
+    if (len>i && len-i<=9) {
+        for(;i<len && str[i]>='0' && str[i]<='9';i++) sv = sv*10+(str[i]-'0');
+        if (i==len) return PSMALLINT_NEW((str[0]=='-') ? -sv:sv);
+    }
+    switch(str_to_num((char*)str,len,&nn,&ff)){
+        case 0:
+            if (nn>-1073741824 && nn<1073741824) return PSMALLINT_NEW(nn);
+            return (PObject*)pinteger_new(nn);
+        case 1:
+            return (PObject*)pfloat_new(ff);
+    }
+    return NULL;
+}
 
-    RELEASE_GIL();
+/* kinds of packed arrays, from the narrowest */
+#define JSMN_PACK_BYTES     0
+#define JSMN_PACK_SHORTS    1
+#define JSMN_PACK_INTS      2
+#define JSMN_PACK_FLOATS    3
 
-    jsmn_parser parser;
-    jsmn_init(&parser);
+/**
+ * Reads the number starting at *pos and the separator following it.
+ * Returns 1 if the array goes on, 0 if the number was the last one (and
+ * *pos is at the closing bracket) or -1 if the array is not made of numbers.
+ */
+static int jsmn_pack_next(uint8_t *js, uint32_t len, uint32_t *pos, int *kind, int64_t *ires, FLOAT_TYPE *fres){
+    uint32_t i=*pos,start;
 
-    r = jsmn_parse(&parser,jstr,jlen,NULL,0);
-    printf("TOKENS %i %x %i\n",r,(int)jstr,jlen);
+    for(;i<len && (js[i]==' ' || js[i]=='\t' || js[i]=='\r' || js[i]=='\n');i++);
+    start = i;
+    for(;i<len && ((js[i]>='0' && js[i]<='9') || js[i]=='-' || js[i]=='+' || js[i]=='.' || js[i]=='e' || js[i]=='E');i++);
+    if (i==start) return -1;
+    *kind = str_to_num((char*)js+start,i-start,ires,fres);
+    if (*kind<0) return -1;
+    for(;i<len && (js[i]==' ' || js[i]=='\t' || js[i]=='\r' || js[i]=='\n');i++);
+    if (i>=len) return -1;
+    *pos = i+1;
+    if (js[i]==',') return 1;
+    if (js[i]!=']') return -1;
+    *pos = i;
+    return 0;
+}
 
-    if(r<0) {
-        ACQUIRE_GIL();
-        return ERR_VALUE_EXC;
+/**
+ * If the array starting at pos only holds numbers, decodes it into a
+ * bytearray (integers in 0..255), a shortarray (integers in 0..65535),
+ * a bytearray of packed 32 bit integers (any other integers fitting 32 bits)
+ * or a bytearray of packed 32 bit floats (only floats) and returns the
+ * position of its closing bracket. Returns 0 if the array must be built as
+ * a list instead (empty, not numeric, mixing integers and floats, with
+ * integers not fitting 32 bits or too big): integers are never rounded.
+ */
+static int jsmn_pack_array(uint8_t *js, uint32_t len, uint32_t pos, PObject **res){
+    uint32_t i,n=0;
+    int kind=JSMN_PACK_BYTES,isfloat,r,nfloats=0;
+    int64_t iv;
+    FLOAT_TYPE fv;
+    PObject *obj;
+    uint8_t *buf;
+    int32_t i32;
+    float f32;
+
+    //first pass: check the array and find the narrowest kind
+    i = pos+1;
+    do {
+        r = jsmn_pack_next(js,len,&i,&isfloat,&iv,&fv);
+        if (r<0) return 0;
+        if (isfloat) nfloats++;
+        else if (iv<INT32_MIN || iv>INT32_MAX) return 0;
+        else if (iv<0 || iv>65535) kind = JSMN_PACK_INTS;
+        else if (iv>255 && kind==JSMN_PACK_BYTES) kind = JSMN_PACK_SHORTS;
+        n++;
+    } while(r);
+    if (nfloats) {
+        //integers would be rounded as floats
+        if (nfloats!=n) return 0;
+        kind = JSMN_PACK_FLOATS;
     }
-    jsmntok_t *tokens=gc_malloc(sizeof(jsmntok_t)*r);
+    if ((kind==JSMN_PACK_SHORTS && n>0xffff/2) || (kind>=JSMN_PACK_INTS && n>0xffff/4)) return 0;
 
-    jsmn_init(&parser);
-    jsmn_parse(&parser,jstr,jlen,tokens,r);
-    printf("TOKENS2 %i\n",r);
-
-    //check parse correctness
-    for(i=0;i<r;i++){
-        if (tokens[i].end<0){
-            gc_free(tokens);
-            ACQUIRE_GIL();
-            return ERR_VALUE_EXC;
+    //second pass: store the numbers
+    obj = (PObject*)psequence_new((kind==JSMN_PACK_SHORTS) ? PSHORTARRAY:PBYTEARRAY,(kind>=JSMN_PACK_INTS) ? 4*n:n);
+    if (!obj) return 0;
+    buf = PSEQUENCE_BYTES(obj);
+    i = pos+1;
+    n = 0;
+    do {
+        r = jsmn_pack_next(js,len,&i,&isfloat,&iv,&fv);
+        if (kind==JSMN_PACK_BYTES) buf[n] = iv;
+        else if (kind==JSMN_PACK_SHORTS) ((uint16_t*)buf)[n] = iv;
+        else if (kind==JSMN_PACK_INTS) {
+            i32 = iv;
+            memcpy(buf+4*n,&i32,4);
+        } else {
+            f32 = fv;
+            memcpy(buf+4*n,&f32,4);
         }
+        n++;
+    } while(r);
+    PSEQUENCE_ELEMENTS_SET(obj,(kind>=JSMN_PACK_INTS) ? 4*n:n);
+    *res = obj;
+    return i;
+}
+
+/**
+ * Finds the end of the primitive starting at pos. The end of the input
+ * terminates the primitive only if it is the last chunk.
+ * Returns the end position or a JSMN_ERROR_* code.
+ */
+static int jsmn_scan_primitive(uint8_t *js, uint32_t len, uint32_t pos, int last){
+    for (; pos < len; pos++) {
+        switch (js[pos]) {
+            case '\t' : case '\r' : case '\n' : case ' ' :
+            case ','  : case ']'  : case '}' :
+                return pos;
+        }
+        if (js[pos] < 32 || js[pos] >= 127) return JSMN_ERROR_INVAL;
     }
+    return (last) ? (int)pos:JSMN_ERROR_PART;
+}
 
-    jsmntok_t *token;
+/**
+ * Checks the path component comp against an object key (key!=NULL) or an
+ * array index. None matches everything.
+ */
+static int jsmn_comp_match(PObject *comp, uint8_t *key, int keylen, int index){
+    if (comp==MAKE_NONE()) return 1;
+    if (key) {
+        return PTYPE(comp)==PSTRING && PSEQUENCE_ELEMENTS(comp)==keylen && memcmp(PSEQUENCE_BYTES(comp),key,keylen)==0;
+    }
+    return IS_PSMALLINT(comp) && PSMALLINT_VALUE(comp)==index;
+}
 
-    for(i=0;i<r;i++){
-        token =  &tokens[i];
-        //printf("TOKEN %i %i %i ch %i p %i %x\n",i,token->start,token->end,token->size, token->parent,(int)token->obj);
-        switch(token->type){
-            case JSMN_OBJECT:
-                token->obj = (void*)pdict_new(token->size);
-                printf("OBJECT %i %i ch %i p %i %x\n",token->start,token->end,token->size, token->parent,(int)token->obj);
-                break;
-            case JSMN_ARRAY:
-                token->obj = (void*)plist_new(token->size,NULL);
-                PSEQUENCE_ELEMENTS_SET(token->obj,0);
-                printf("ARRAY %i %i ch %i p %i %x\n",token->start,token->end,token->size, token->parent,(int)token->obj);
-                break;
-            case JSMN_STRING:
-                token->obj = (void*)pstring_new(token->end-token->start,jstr+token->start);
-                {
-                    int j,sz=PSEQUENCE_ELEMENTS(token->obj);
-                    uint8_t *buf = PSEQUENCE_BYTES(token->obj);
-
-                    for(j=0;j<PSEQUENCE_ELEMENTS(token->obj);j++) {
-                        if (buf[j]=='\\') {
-                            //escape!
-                            switch(buf[j+1]){
-                                case 'n': buf[j]='\n'; break;
-                                case 't': buf[j]='\t'; break;
-                                case 'r': buf[j]='\r'; break;
-                                case 'f': buf[j]='\f'; break;
-                                case 'b': buf[j]='\b'; break;
-                                case '\"': buf[j]='"'; break;
-                            }
-                            memcpy(buf+j+1,buf+j+2,sz-j-2);
-                            sz--;
-                        }
+/**
+ * Computes which of the paths in match select (sel) or go through (cmatch)
+ * the child at position key/index of a container at nesting depth.
+ */
+static void jsmn_child_masks(PObject *paths, uint32_t match, int depth, uint8_t *key, int keylen, int index, uint32_t *sel, uint32_t *cmatch){
+    int p,plen;
+    PObject *path;
+
+    *sel = 0;
+    *cmatch = 0;
+    for(p=0;match;p++,match>>=1){
+        if (!(match&1)) continue;
+        path = PTUPLE_ITEM(paths,p);
+        plen = PSEQUENCE_ELEMENTS(path);
+        if (plen<depth || !jsmn_comp_match(PTUPLE_ITEM(path,depth-1),key,keylen,index)) continue;
+        if (plen==depth) *sel|=(1<<p);
+        else *cmatch|=(1<<p);
+    }
+}
+
+/**
+ * Stores a value selected by the paths in sel.
+ */
+static void jsmn_deliver(JsmnState *st, PObject *out, PObject *obj, uint32_t sel){
+    int p;
+
+    if (st->flags&JSMN_FLAG_APPEND) {
+        plist_append(out,obj);
+        return;
+    }
+    for(p=0;sel;p++,sel>>=1){
+        if (sel&1) PLIST_SET_ITEM(out,p,obj);
+    }
+}
+
+/**
+ * Prepares st for a new document. With no paths, the root value is selected
+ * and stored in out[0].
+ */
+static void jsmn_state_init(JsmnState *st, int npaths, int flags){
+    memset(st,0,sizeof(JsmnState));
+    st->expect = JSMN_EXPECT_VALUE;
+    st->flags = flags;
+    st->npaths = npaths;
+}
+
+/**
+ * Root paths bookkeeping: a root value behaves as the child of a virtual
+ * container matching every path.
+ */
+static void jsmn_root_masks(JsmnState *st, PObject *paths, uint32_t *sel, uint32_t *cmatch){
+    int p;
+
+    *sel = 0;
+    *cmatch = 0;
+    if (!st->npaths) {
+        *sel = 1;
+        return;
+    }
+    for(p=0;p<st->npaths;p++){
+        if (PSEQUENCE_ELEMENTS(PTUPLE_ITEM(paths,p))) *cmatch|=(1<<p);
+        else *sel|=(1<<p);
+    }
+}
+
+/**
+ * Runs the parser over js. Values are built only when selected by a path
+ * (or by default the root value) and everything else is skipped without
+ * allocations. stack is the list holding the containers being built;
+ * selected values go to out. If keys is not NULL, it is the table used to
+ * intern the keys of built objects.
+ * If a string or primitive is cut by the end of a chunk, parsing stops at
+ * its first byte: the caller must feed it again together with the next chunk.
+ * Returns the number of consumed bytes or a JSMN_ERROR_* code.
+ */
+static int jsmn_walk(JsmnState *st, PObject *stack, PObject *paths, PObject *keys, uint8_t *js, uint32_t len, PObject *out, int last){
+    jsmn_parser parser;
+    JsmnLevel *top,*lv;
+    PObject *obj;
+    PObject **slots;
+    uint32_t sel,cmatch;
+    int start,end,build,nstack;
+    uint8_t c;
+
+    jsmn_init(&parser);
+
+    for (; parser.pos < len; parser.pos++) {
+        c = js[parser.pos];
+        if (c=='\t' || c=='\r' || c=='\n' || c==' ') continue;
+        top = (st->depth) ? &st->levels[st->depth-1]:NULL;
+        nstack = PSEQUENCE_ELEMENTS(stack);
+        slots = PSEQUENCE_OBJECTS(stack);
+        obj = NULL;
+        start = parser.pos;
+
+        switch(st->expect){
+            case JSMN_EXPECT_NOTHING:
+                //garbage after the root value
+                return JSMN_ERROR_INVAL;
+            case JSMN_EXPECT_COLON:
+                if (c!=':') return JSMN_ERROR_INVAL;
+                st->expect = JSMN_EXPECT_VALUE;
+                continue;
+            case JSMN_EXPECT_NEXT:
+                if (c==',') {
+                    st->expect = (top->type==JSMN_OBJECT) ? JSMN_EXPECT_KEY:JSMN_EXPECT_VALUE;
+                    continue;
+                }
+                if (c!='}' && c!=']') return JSMN_ERROR_INVAL;
+                goto close_container;
+            case JSMN_EXPECT_KEY:
+            case JSMN_EXPECT_KEY_OR_END:
+                if (c=='}' && st->expect==JSMN_EXPECT_KEY_OR_END) goto close_container;
+                if (c!='\"') return JSMN_ERROR_INVAL;
+                end = jsmn_parse_string(&parser,js,len,NULL,0);
+                if (end==JSMN_ERROR_PART && !last) return start;
+                if (end<0) return end;
+                top->ksel = 0;
+                top->kmatch = 0;
+                if (top->build || top->match) {
+                    if (top->build || memchr(js+start+1,'\\',parser.pos-start-1)) {
+                        obj = jsmn_intern((top->build) ? keys:NULL,js+start+1,parser.pos-start-1);
+                        if (!obj) return JSMN_ERROR_INVAL;
+                        if (top->build) slots[nstack-1] = obj;
+                        jsmn_child_masks(paths,top->match,st->depth,PSEQUENCE_BYTES(obj),PSEQUENCE_ELEMENTS(obj),0,&top->ksel,&top->kmatch);
+                    } else {
+                        jsmn_child_masks(paths,top->match,st->depth,js+start+1,parser.pos-start-1,0,&top->ksel,&top->kmatch);
                     }
-                    PSEQUENCE_ELEMENTS_SET(token->obj,sz);
                 }
-                printf("STRING %i %i ch %i p %i %x\n",token->start,token->end,token->size, token->parent,(int)token->obj);
+                st->expect = JSMN_EXPECT_COLON;
+                continue;
+            case JSMN_EXPECT_VALUE:
+            case JSMN_EXPECT_VALUE_OR_END:
+                if (c==']' && st->expect==JSMN_EXPECT_VALUE_OR_END) goto close_container;
                 break;
-            case JSMN_PRIMITIVE:
-                c = jstr[token->start];
-                switch(c){
-                    case 't':
-                        token->obj = (void*)PBOOL_TRUE();
-                        printf("TRUE %i %i ch %i p %i %x\n",token->start,token->end,token->size, token->parent,(int)token->obj);
-                        break;
-                    case 'f':
-                        token->obj = (void*)PBOOL_FALSE();
-                        printf("FALSE %i %i ch %i p %i %x\n",token->start,token->end,token->size, token->parent,(int)token->obj);
-                        break;
-                    case 'n':
-                        token->obj = (void*)MAKE_NONE();
-                        printf("NULL %i %i ch %i p %i %x\n",token->start,token->end,token->size, token->parent,(int)token->obj);
+        }
+
+        //a value starts here: decide whether to build it
+        if (!top) {
+            jsmn_root_masks(st,paths,&sel,&cmatch);
+            build = (sel!=0);
+        } else {
+            if (top->type==JSMN_OBJECT) {
+                sel = top->ksel;
+                cmatch = top->kmatch;
+            } else if (top->match) {
+                jsmn_child_masks(paths,top->match,st->depth,NULL,0,top->index,&sel,&cmatch);
+            } else {
+                sel = cmatch = 0;
+            }
+            build = top->build || sel;
+        }
+
+        switch(c){
+            case '{': case '[':
+                if (c=='[' && build && (st->flags&JSMN_FLAG_PACK)) {
+                    end = jsmn_pack_array(js,len,parser.pos,&obj);
+                    if (end) {
+                        parser.pos = end;
                         break;
-                    default:
-                        if ((c>='0' && c<='9') || c=='-') {
-                            //it's a number
-                            if (str_to_num(jstr+token->start,token->end-token->start,&nn,&ff)){
-                                //is float
-                                token->obj = (void*)pfloat_new(ff);
-                                printf("FLOAT %i %i ch %i p %i %x\n",token->start,token->end,token->size, token->parent,(int)token->obj);
-                            } else {
-                                //is int
-                                token->obj = (void*)pinteger_new(nn);
-                                printf("INT %i %i ch %i p %i %x\n",token->start,token->end,token->size, token->parent,(int)token->obj);
-                            }
-                        }
+                    }
+                }
+                if (st->depth>=JSMN_MAX_DEPTH) return JSMN_ERROR_NOMEM;
+                if (top) top->index++;
+                lv = &st->levels[st->depth++];
+                lv->type = (c=='{') ? JSMN_OBJECT:JSMN_ARRAY;
+                lv->build = build;
+                lv->index = 0;
+                lv->sel = sel;
+                lv->match = cmatch;
+                if (build) {
+                    if (c=='{') {
+                        obj = (PObject*)pdict_new(4);
+                    } else {
+                        obj = (PObject*)plist_new(4,NULL);
+                        PSEQUENCE_ELEMENTS_SET(obj,0);
+                    }
+                    plist_append(stack,obj);
+                    plist_append(stack,MAKE_NONE());
+                }
+                st->expect = (c=='{') ? JSMN_EXPECT_KEY_OR_END:JSMN_EXPECT_VALUE_OR_END;
+                continue;
+            case '\"':
+                end = jsmn_parse_string(&parser,js,len,NULL,0);
+                if (end==JSMN_ERROR_PART && !last) return start;
+                if (end<0) return end;
+                if (build) {
+                    obj = jsmn_make_string(js+start+1,parser.pos-start-1);
+                    if (!obj) return JSMN_ERROR_INVAL;
+                }
+                break;
+            case '-': case '0': case '1' : case '2': case '3' : case '4':
+            case '5': case '6': case '7' : case '8': case '9':
+            case 't': case 'f': case 'n' :
+                end = jsmn_scan_primitive(js,len,parser.pos,last);
+                if (end==JSMN_ERROR_PART) return start;
+                if (end<0) return end;
+                parser.pos = end-1;
+                if (build) {
+                    obj = jsmn_make_primitive(js+start,end-start);
+                    if (!obj) return JSMN_ERROR_INVAL;
                 }
                 break;
+            default:
+                return JSMN_ERROR_INVAL;
         }
-        if (token->parent>=0){
-            jsmntok_t *ptoken = &tokens[token->parent];
-            if (ptoken->type == JSMN_STRING){
-                //when the parent is a string, token it's the value of a key (ptoken is the key)
-                jsmntok_t *dtoken = &tokens[ptoken->parent];
-                pdict_put(dtoken->obj,ptoken->obj,token->obj);
-            } else if (ptoken->type==JSMN_OBJECT) {
-                //skip, token it's a key, we will add it together with the key
-            } else if (ptoken->type==JSMN_ARRAY){
-                ii = PSEQUENCE_ELEMENTS(ptoken->obj);
-                PLIST_SET_ITEM(ptoken->obj,ii,token->obj);
-                PSEQUENCE_ELEMENTS_SET(ptoken->obj,ii+1);
+        //count the value only now that it is complete in this chunk
+        if (top) top->index++;
+        goto value_done;
+
+close_container:
+        //closing bracket: check it matches the open container and pop it
+        if ((c=='}') != (top->type==JSMN_OBJECT)) return JSMN_ERROR_INVAL;
+        build = top->build;
+        sel = top->sel;
+        if (build) {
+            obj = slots[nstack-2];
+            nstack-=2;
+            PSEQUENCE_ELEMENTS_SET(stack,nstack);
+        }
+        st->depth--;
+        top = (st->depth) ? &st->levels[st->depth-1]:NULL;
+
+value_done:
+        //attach the completed value to its parent and hand it out if selected
+        if (build) {
+            if (top && top->build) {
+                if (top->type==JSMN_OBJECT) {
+                    pdict_put(slots[nstack-2],slots[nstack-1],obj);
+                    slots[nstack-1] = MAKE_NONE();
+                } else {
+                    plist_append(slots[nstack-2],obj);
+                }
             }
+            if (sel) jsmn_deliver(st,out,obj,sel);
         }
+        if (top) st->expect = JSMN_EXPECT_NEXT;
+        else st->expect = (st->flags&JSMN_FLAG_STREAM) ? JSMN_EXPECT_VALUE:JSMN_EXPECT_NOTHING;
     }
 
-    *res = tokens[0].obj;
-    gc_free(tokens);
+    if (last && (st->depth || (st->expect==JSMN_EXPECT_VALUE && !(st->flags&JSMN_FLAG_STREAM)))) {
+        //unterminated containers or empty document
+        return JSMN_ERROR_PART;
+    }
+    return parser.pos;
+}
+
+C_NATIVE(jsmn_loads){
+    C_NATIVE_UNWARN();
+    uint8_t *jstr;
+    uint32_t jlen;
+    JsmnState st;
+    PObject *stack;
+    PObject *out;
+    PObject *keys = NULL;
+    int i,r;
+
+    if (nargs!=3 || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[0])))
+        return ERR_TYPE_EXC;
+    jstr = PSEQUENCE_BYTES(args[0]);
+    jlen = PSEQUENCE_ELEMENTS(args[0]);
+
+    stack = (PObject*)plist_new(2*4,NULL);
+    PSEQUENCE_ELEMENTS_SET(stack,0);
+    out = (PObject*)plist_new(1,NULL);
+    PLIST_SET_ITEM(out,0,MAKE_NONE());
+    if (args[1]==PBOOL_TRUE()) {
+        keys = (PObject*)plist_new(JSMN_KEYS_SIZE,NULL);
+        for(i=0;i<JSMN_KEYS_SIZE;i++) PLIST_SET_ITEM(keys,i,MAKE_NONE());
+    }
+
+    RELEASE_GIL();
+    jsmn_state_init(&st,0,(args[2]==PBOOL_TRUE()) ? JSMN_FLAG_PACK:0);
+    r = jsmn_walk(&st,stack,NULL,keys,jstr,jlen,out,1);
     ACQUIRE_GIL();
 
+    if (r<0) {
+        *res = MAKE_NONE();
+        return ERR_VALUE_EXC;
+    }
+    *res = PLIST_ITEM(out,0);
     return ERR_OK;
 }
 
+/**
+ * Parses a path like "a.b[2].c", "items[*]" or "*.id" into a tuple of
+ * components: strings for keys, integers for indexes and None for "*".
+ * The empty path selects the root. Returns NULL on bad syntax.
+ */
+static PObject *jsmn_compile_path(uint8_t *str, int len){
+    PObject *comps[JSMN_MAX_DEPTH];
+    int n=0,pos=0,start,idx;
 
+    while(pos<len){
+        if (n>=JSMN_MAX_DEPTH) return NULL;
+        if (str[pos]=='[') {
+            pos++;
+            if (pos<len && str[pos]=='*') {
+                comps[n++] = MAKE_NONE();
+                pos++;
+            } else {
+                start = pos;
+                idx = 0;
+                while(pos<len && str[pos]>='0' && str[pos]<='9') idx = idx*10+(str[pos++]-'0');
+                if (pos==start) return NULL;
+                comps[n++] = PSMALLINT_NEW(idx);
+            }
+            if (pos>=len || str[pos]!=']') return NULL;
+            pos++;
+        } else {
+            if (str[pos]=='.') {
+                if (!n) return NULL;
+                pos++;
+            }
+            start = pos;
+            while(pos<len && str[pos]!='.' && str[pos]!='[') pos++;
+            if (pos==start) return NULL;
+            if (pos-start==1 && str[start]=='*') comps[n++] = MAKE_NONE();
+            else comps[n++] = (PObject*)pstring_new(pos-start,str+start);
+        }
+    }
+    return (PObject*)ptuple_new(n,comps);
+}
 
+C_NATIVE(jsmn_paths){
+    C_NATIVE_UNWARN();
+    PObject *paths = args[0];
+    PObject *tpl;
+    PObject *path;
+    PObject *item;
+    int i,n;
+
+    if (PTYPE(paths)!=PLIST && PTYPE(paths)!=PTUPLE) return ERR_TYPE_EXC;
+    n = PSEQUENCE_ELEMENTS(paths);
+    if (n>JSMN_MAX_PATHS) return ERR_VALUE_EXC;
+    tpl = (PObject*)ptuple_new(n,NULL);
+    for(i=0;i<n;i++){
+        item = PSEQUENCE_OBJECTS(paths)[i];
+        if (PTYPE(item)!=PSTRING) return ERR_TYPE_EXC;
+        path = jsmn_compile_path(PSEQUENCE_BYTES(item),PSEQUENCE_ELEMENTS(item));
+        if (!path) return ERR_VALUE_EXC;
+        PTUPLE_SET_ITEM(tpl,i,path);
+    }
+    *res = tpl;
+    return ERR_OK;
+}
+
+/*
+ * args: data, paths
+ * returns a list with the value selected by each path, None if not found
+ */
+C_NATIVE(jsmn_extract){
+    C_NATIVE_UNWARN();
+    uint8_t *jstr;
+    uint32_t jlen;
+    JsmnState st;
+    PObject *stack;
+    PObject *out;
+    PObject *paths;
+    int i,n,r;
+
+    if (nargs!=2) return ERR_TYPE_EXC;
+    if (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[0])) || PTYPE(args[1])!=PTUPLE) return ERR_TYPE_EXC;
+    jstr = PSEQUENCE_BYTES(args[0]);
+    jlen = PSEQUENCE_ELEMENTS(args[0]);
+    paths = args[1];
+    n = PSEQUENCE_ELEMENTS(paths);
+    if (!n || n>JSMN_MAX_PATHS) return ERR_VALUE_EXC;
+
+    stack = (PObject*)plist_new(2*4,NULL);
+    PSEQUENCE_ELEMENTS_SET(stack,0);
+    out = (PObject*)plist_new(n,NULL);
+    for(i=0;i<n;i++) PLIST_SET_ITEM(out,i,MAKE_NONE());
+
+    RELEASE_GIL();
+    jsmn_state_init(&st,n,0);
+    r = jsmn_walk(&st,stack,paths,NULL,jstr,jlen,out,1);
+    ACQUIRE_GIL();
+
+    if (r<0) {
+        *res = MAKE_NONE();
+        return ERR_VALUE_EXC;
+    }
+    *res = out;
+    return ERR_OK;
+}
+
+C_NATIVE(jsmn_stream_new){
+    C_NATIVE_UNWARN();
+    PObject *paths = args[0];
+    PObject *st;
+
+    if (PTYPE(paths)!=PTUPLE) return ERR_TYPE_EXC;
+    st = (PObject*)pbytes_new(sizeof(JsmnState),NULL);
+    jsmn_state_init((JsmnState*)PSEQUENCE_BYTES(st),PSEQUENCE_ELEMENTS(paths),JSMN_FLAG_STREAM|JSMN_FLAG_APPEND);
+    *res = st;
+    return ERR_OK;
+}
+
+/*
+ * args: state, stack, paths, data, out, last
+ * returns the number of bytes of data consumed
+ */
+C_NATIVE(jsmn_stream_feed){
+    C_NATIVE_UNWARN();
+    JsmnState *st;
+    uint8_t *data;
+    uint32_t len;
+    int r;
+
+    if (nargs!=6) return ERR_TYPE_EXC;
+    if (PTYPE(args[0])!=PBYTES || PSEQUENCE_ELEMENTS(args[0])!=sizeof(JsmnState)) return ERR_TYPE_EXC;
+    if (PTYPE(args[1])!=PLIST || PTYPE(args[2])!=PTUPLE || PTYPE(args[4])!=PLIST) return ERR_TYPE_EXC;
+    if (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[3]))) return ERR_TYPE_EXC;
+    st = (JsmnState*)PSEQUENCE_BYTES(args[0]);
+    data = PSEQUENCE_BYTES(args[3]);
+    len = PSEQUENCE_ELEMENTS(args[3]);
+
+    r = jsmn_walk(st,args[1],args[2],NULL,data,len,args[4],args[5]==PBOOL_TRUE());
+    if (r<0) return ERR_VALUE_EXC;
+    *res = PSMALLINT_NEW(r);
+    return ERR_OK;
+}
+
+
+/**
+ * Where a windowed serialization stopped, kept by the caller between
+ * windows: for each container level, the child being serialized and the
+ * output position where it starts. The next window goes straight down to
+ * the deepest child and serializes again only from its start.
+ */
+typedef struct _jsmn_resume {
+    uint32_t valid;
+    uint32_t depth;
+    uint32_t idx[JSMN_MAX_DEPTH];
+    uint32_t start[JSMN_MAX_DEPTH];
+} JsmnResume;
+
+/**
+ * Output buffer of jsmn_dumps. It grows by doubling.
+ * If fixed, buf is a caller buffer receiving only the serialized bytes
+ * from skip to skip+size: serialization stops as soon as they are all written.
+ * If resume is given, the walk is recorded into it and resumed from it.
+ */
+typedef struct _jsmn_out {
+    uint8_t *buf;
+    uint32_t len;
+    uint32_t size;
+    uint32_t skip;
+    int fixed;
+    int resuming;
+    JsmnResume *resume;
+} JsmnOut;
+
+/* skip of a fixed output that only counts bytes */
+#define JSMN_OUT_COUNT 0x7fffffff
+
+/* PSTRING elements are 16 bits */
+#define JSMN_OUT_MAX 0xffff
+
+static const uint8_t jsmn_hex[] = "0123456789abcdef";
+
+static int jsmn_out_reserve(JsmnOut *out, uint32_t n){
+    uint32_t nsize;
+    uint8_t *nbuf;
+
+    if (out->len+n<=out->size) return 0;
+    if (out->len+n>JSMN_OUT_MAX) return -1;
+    nsize = (out->size) ? out->size:64;
+    while(nsize<out->len+n) nsize*=2;
+    if (nsize>JSMN_OUT_MAX) nsize = JSMN_OUT_MAX;
+    nbuf = gc_realloc(out->buf,nsize);
+    if (!nbuf) return -1;
+    out->buf = nbuf;
+    out->size = nsize;
+    return 0;
+}
+
+static int jsmn_out_write(JsmnOut *out, uint8_t *data, uint32_t n){
+    uint32_t from,to;
+
+    if (out->fixed) {
+        //copy the part of data falling in [skip,skip+size[
+        from = (out->len<out->skip) ? out->skip-out->len:0;
+        to = (out->len+n>out->skip+out->size) ? out->skip+out->size-out->len:n;
+        if (from<to) memcpy(out->buf+out->len+from-out->skip,data+from,to-from);
+        out->len+=n;
+        //full: stop here
+        return (out->len>out->skip+out->size) ? -1:0;
+    }
+    if (jsmn_out_reserve(out,n)<0) return -1;
+    memcpy(out->buf+out->len,data,n);
+    out->len+=n;
+    return 0;
+}
+
+static int jsmn_out_byte(JsmnOut *out, uint8_t c){
+    return jsmn_out_write(out,&c,1);
+}
+
+#define jsmn_out_char(out,c) ((out)->fixed ? jsmn_out_byte(out,c):((jsmn_out_reserve(out,1)<0) ? -1:((out)->buf[(out)->len++]=(c),0)))
+
+/**
+ * Writes x in decimal into str (at least 21 bytes). Returns the written length.
+ */
+static int jsmn_itoa(int64_t x, uint8_t *str){
+    uint8_t tmp[20];
+    uint64_t v = (x<0) ? -(uint64_t)x:(uint64_t)x;
+    int n=0,i=0;
+
+    do {
+        tmp[n++] = '0'+(v%10);
+        v/=10;
+    } while(v);
+    if (x<0) str[i++]='-';
+    while(n) str[i++]=tmp[--n];
+    return i;
+}
+
+/**
+ * Writes f into str (at least ZF_FORMAT_SIZE bytes) as the shortest string
+ * that loads back to the same float, NaN and Infinity as JavaScript does.
+ * Returns the written length.
+ */
+static int jsmn_ftoa(FLOAT_TYPE f, uint8_t *str){
+    if (f!=f) {
+        memcpy(str,"NaN",3);
+        return 3;
+    }
+    if (f>FLOAT_MAX) {
+        memcpy(str,"Infinity",8);
+        return 8;
+    }
+    if (f<-FLOAT_MAX) {
+        memcpy(str,"-Infinity",9);
+        return 9;
+    }
+    return zf_format(f,JSMN_SINGLE,(char*)str);
+}
+
+static int jsmn_dump_string(JsmnOut *out, uint8_t *str, int len){
+    int i;
+    uint8_t c;
+    uint8_t esc[6];
+
+    if (jsmn_out_char(out,'\"')<0) return -1;
+    for(i=0;i<len;i++){
+        c = str[i];
+        if (c>=0x20 && c<=0x7e && c!='\"' && c!='\\') {
+            if (jsmn_out_char(out,c)<0) return -1;
+            continue;
+        }
+        esc[0]='\\';
+        switch(c){
+            case '\"': esc[1]='\"'; break;
+            case '\\': esc[1]='\\'; break;
+            case '\n': esc[1]='n'; break;
+            case '\r': esc[1]='r'; break;
+            case '\t': esc[1]='t'; break;
+            case '\f': esc[1]='f'; break;
+            case '\b': esc[1]='b'; break;
+            default:
+                esc[1]='u';
+                esc[2]='0';
+                esc[3]='0';
+                esc[4]=jsmn_hex[c>>4];
+                esc[5]=jsmn_hex[c&0xf];
+                if (jsmn_out_write(out,esc,6)<0) return -1;
+                continue;
+        }
+        if (jsmn_out_write(out,esc,2)<0) return -1;
+    }
+    return jsmn_out_char(out,'\"');
+}
+
+/**
+ * Records that the container at depth is serializing its child i, starting
+ * at the current output position.
+ */
+static void jsmn_out_mark(JsmnOut *out, int depth, int i){
+    if (!out->resume) return;
+    out->resume->depth = depth+1;
+    out->resume->idx[depth] = i;
+    out->resume->start[depth] = out->len;
+}
+
+/**
+ * When resuming, returns the child the container at depth restarts from,
+ * or -1 if the container is serialized from its start. At the deepest
+ * recorded level the output goes back to the start of that child, and the
+ * walk goes on as usual; above it the child is entered directly.
+ * Sets *inside if the child must be entered without its separators.
+ */
+static int jsmn_out_resume(JsmnOut *out, int depth, int *inside){
+    JsmnResume *r = out->resume;
+
+    *inside = 0;
+    if (!out->resuming) return -1;
+    if (depth+1>=(int)r->depth) {
+        out->resuming = 0;
+        out->len = r->start[depth];
+    } else *inside = 1;
+    return r->idx[depth];
+}
+
+/**
+ * Serializes obj at the end of out. Returns -1 on unserializable objects,
+ * too deep nesting or out of memory.
+ */
+static int jsmn_dump(JsmnOut *out, PObject *obj, int depth){
+    uint8_t num[32];
+    int i,n,inside;
+
+    switch(PTYPE(obj)){
+        case PSMALLINT:
+        case PINTEGER:
+            n = jsmn_itoa(INTEGER_VALUE(obj),num);
+            return jsmn_out_write(out,num,n);
+        case PFLOAT:
+            n = jsmn_ftoa(FLOAT_VALUE(obj),num);
+            return jsmn_out_write(out,num,n);
+        case PBOOL:
+            if (obj==PBOOL_TRUE()) return jsmn_out_write(out,(uint8_t*)"true",4);
+            return jsmn_out_write(out,(uint8_t*)"false",5);
+        case PNONE:
+            return jsmn_out_write(out,(uint8_t*)"null",4);
+        case PSTRING:
+        case PBYTES:
+        case PBYTEARRAY:
+            return jsmn_dump_string(out,PSEQUENCE_BYTES(obj),PSEQUENCE_ELEMENTS(obj));
+        case PLIST:
+        case PTUPLE:
+            if (depth>=JSMN_MAX_DEPTH) return -1;
+            n = PSEQUENCE_ELEMENTS(obj);
+            i = jsmn_out_resume(out,depth,&inside);
+            if (i<0) {
+                if (jsmn_out_char(out,'[')<0) return -1;
+                i = 0;
+            }
+            for(;i<n;i++){
+                if (!inside) {
+                    jsmn_out_mark(out,depth,i);
+                    if (i && jsmn_out_char(out,',')<0) return -1;
+                }
+                inside = 0;
+                if (jsmn_dump(out,PSEQUENCE_OBJECTS(obj)[i],depth+1)<0) return -1;
+            }
+            jsmn_out_mark(out,depth,n);
+            return jsmn_out_char(out,']');
+        case PDICT:
+            if (depth>=JSMN_MAX_DEPTH) return -1;
+            n = PDICT_ELEMENTS(obj);
+            i = jsmn_out_resume(out,depth,&inside);
+            if (i<0) {
+                if (jsmn_out_char(out,'{')<0) return -1;
+                i = 0;
+            }
+            for(;i<n;i++){
+                HashEntry *h = phash_getentry((PDict*)obj,i);
+                if (PTYPE(h->key)!=PSTRING) return -1;
+                if (!inside) {
+                    jsmn_out_mark(out,depth,i);
+                    if (i && jsmn_out_char(out,',')<0) return -1;
+                    if (jsmn_dump_string(out,PSEQUENCE_BYTES(h->key),PSEQUENCE_ELEMENTS(h->key))<0) return -1;
+                    if (jsmn_out_char(out,':')<0) return -1;
+                }
+                inside = 0;
+                if (jsmn_dump(out,h->value,depth+1)<0) return -1;
+            }
+            jsmn_out_mark(out,depth,n);
+            return jsmn_out_char(out,'}');
+    }
+    return -1;
+}
+
+C_NATIVE(jsmn_dumps){
+    C_NATIVE_UNWARN();
+    JsmnOut out;
+    err_t err = ERR_OK;
+
+    out.buf = NULL;
+    out.len = 0;
+    out.size = 0;
+    out.fixed = 0;
+    out.resuming = 0;
+    out.resume = NULL;
+
+    if (jsmn_dump(&out,args[0],0)<0) {
+        err = ERR_VALUE_EXC;
+        *res = MAKE_NONE();
+    } else {
+        *res = (PObject*)pstring_new(out.len,out.buf);
+    }
+    if (out.buf) gc_free(out.buf);
+    return err;
+}
+
+C_NATIVE(jsmn_dump_state){
+    C_NATIVE_UNWARN();
+    PObject *st;
+
+    st = (PObject*)pbytes_new(sizeof(JsmnResume),NULL);
+    memset(PSEQUENCE_BYTES(st),0,sizeof(JsmnResume));
+    *res = st;
+    return ERR_OK;
+}
+
+/*
+ * args: obj, buffer, offset, skip, state
+ * serializes obj writing the bytes from skip on into buffer from offset, until buffer is full.
+ * If buffer is None bytes are only counted. Returns the number of bytes serialized:
+ * when more than skip plus the room in buffer, serialization stopped at a full buffer.
+ * state is None or a state from jsmn_dump_state where the walk is recorded: when given, the next window
+ * restarts from where the last one stopped instead of from the start of obj
+ */
+C_NATIVE(jsmn_dump_window){
+    C_NATIVE_UNWARN();
+    JsmnOut out;
+    int32_t offset;
+
+    *res = MAKE_NONE();
+    if (nargs!=5 || PTYPE(args[2])!=PSMALLINT || PTYPE(args[3])!=PSMALLINT) return ERR_TYPE_EXC;
+    offset = PSMALLINT_VALUE(args[2]);
+    out.len = 0;
+    out.fixed = 1;
+    out.resuming = 0;
+    out.resume = NULL;
+    if (args[1]==MAKE_NONE()) {
+        out.buf = NULL;
+        out.size = 0;
+        out.skip = JSMN_OUT_COUNT;
+    } else {
+        if (PTYPE(args[1])!=PBYTEARRAY) return ERR_TYPE_EXC;
+        if (offset<0 || offset>PSEQUENCE_ELEMENTS(args[1]) || PSMALLINT_VALUE(args[3])<0) return ERR_INDEX_EXC;
+        out.buf = PSEQUENCE_BYTES(args[1])+offset;
+        out.size = PSEQUENCE_ELEMENTS(args[1])-offset;
+        out.skip = PSMALLINT_VALUE(args[3]);
+    }
+    if (args[4]!=MAKE_NONE()) {
+        if (PTYPE(args[4])!=PBYTES || PSEQUENCE_ELEMENTS(args[4])!=sizeof(JsmnResume)) return ERR_TYPE_EXC;
+        out.resume = (JsmnResume*)PSEQUENCE_BYTES(args[4]);
+        //a record behind skip can be resumed: no byte before skip is written
+        out.resuming = out.resume->valid && out.resume->depth && out.resume->start[out.resume->depth-1]<=out.skip;
+        out.resume->valid = 0;
+    }
+    if (jsmn_dump(&out,args[0],0)<0 && out.len<=out.skip+out.size) {
+        //not stopped by a full buffer: obj is not serializable
+        return ERR_VALUE_EXC;
+    }
+    if (out.resume && out.len>out.skip+out.size) out.resume->valid = 1;
+    *res = PSMALLINT_NEW(out.len);
+    return ERR_OK;
+}
@@ -0,0 +1,211 @@
+#include "zerynth.h"
+#include "uECC.h"
+#include "sha2.h"
+#include "hmac.h"
+#include "zerynth_drbg.h"
+
+/*
+ * One pass JWT encoding for jwt.encode.
+ *
+ * The encoded header, '.', the payload encoded in base64url as it is read, '.' and the encoded signature are written straight
+ * into the output, and each 64 bytes block of the signing input is hashed (SHA-256 for ES256, HMAC-SHA256 for HS256) as soon as
+ * it is written, while still in cache. ES256 signatures are deterministic (RFC 6979 with SHA-256), as with ecc.sign.
+ */
+
+#define JWT_HS256   0
+#define JWT_ES256   1
+
+static const char jwt_b64url[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+typedef struct _jwt_hash {
+    uECC_HashContext uECC;
+    cf_sha256_context sha;
+    uint8_t tmp[2 * CF_SHA256_HASHSZ + CF_SHA256_BLOCKSZ];
+} JwtHash;
+
+// the signing input, hashed or authenticated as it is written
+typedef struct _jwt_mac {
+    int algo;
+    cf_sha256_context sha;
+    cf_hmac_ctx hmac;
+} JwtMac;
+
+static void jwt_hash_init(uECC_HashContext *base)
+{
+    cf_sha256_init(&((JwtHash*)base)->sha);
+}
+
+static void jwt_hash_update(uECC_HashContext *base, const uint8_t *message, unsigned message_size)
+{
+    cf_sha256_update(&((JwtHash*)base)->sha, message, message_size);
+}
+
+static void jwt_hash_finish(uECC_HashContext *base, uint8_t *hash_result)
+{
+    cf_sha256_digest_final(&((JwtHash*)base)->sha, hash_result);
+}
+
+static void jwt_mac_update(JwtMac *mac, const uint8_t *data, uint32_t len)
+{
+    if (mac->algo == JWT_ES256)
+        cf_sha256_update(&mac->sha, data, len);
+    else
+        cf_hmac_update(&mac->hmac, data, len);
+}
+
+static uint32_t jwt_b64_len(uint32_t len)
+{
+    return (len / 3) * 4 + ((len % 3) ? (len % 3) + 1 : 0);
+}
+
+// base64url without padding, returns the bytes written
+static uint32_t jwt_b64(uint8_t *out, const uint8_t *in, uint32_t len)
+{
+    uint8_t *p = out;
+    uint32_t i, w;
+
+    for (i = 0; i + 2 < len; i += 3) {
+        w = ((uint32_t)in[i] << 16) | ((uint32_t)in[i + 1] << 8) | in[i + 2];
+        p[0] = jwt_b64url[w >> 18];
+        p[1] = jwt_b64url[(w >> 12) & 0x3F];
+        p[2] = jwt_b64url[(w >> 6) & 0x3F];
+        p[3] = jwt_b64url[w & 0x3F];
+        p += 4;
+    }
+    if (i < len) {
+        w = (uint32_t)in[i] << 16;
+        if (i + 1 < len)
+            w |= (uint32_t)in[i + 1] << 8;
+        *p++ = jwt_b64url[w >> 18];
+        *p++ = jwt_b64url[(w >> 12) & 0x3F];
+        if (i + 1 < len)
+            *p++ = jwt_b64url[(w >> 6) & 0x3F];
+    }
+    return p - out;
+}
+
+static int jwt_hex(uint8_t c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    c |= 0x20;
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+/*
+ * Writes the signing input (header.payload) at out, returns its length.
+ * The payload is encoded 48 bytes at a time: 64 characters, one SHA-256 block
+ */
+static uint32_t jwt_input(JwtMac *mac, uint8_t *out, const uint8_t *header, uint32_t hlen, const uint8_t *payload, uint32_t plen)
+{
+    uint32_t n = hlen + 1, hashed, k;
+
+    memcpy(out, header, hlen);
+    out[hlen] = '.';
+    hashed = n & ~63;
+    jwt_mac_update(mac, out, hashed);
+    while (plen) {
+        k = (plen > 48) ? 48 : plen;
+        n += jwt_b64(out + n, payload, k);
+        payload += k;
+        plen -= k;
+        if (n - hashed >= 64) {
+            jwt_mac_update(mac, out + hashed, (n - hashed) & ~63);
+            hashed += (n - hashed) & ~63;
+        }
+    }
+    jwt_mac_update(mac, out + hashed, n - hashed);
+    return n;
+}
+
+/*
+ * args: algo, header, payload, key, out
+ * encodes and signs a JWT: header is the already encoded header, payload the bytes of the claims. The key is the
+ * private key (32 bytes or 64 hex digits) for ES256, the secret for HS256. The token is written into the bytearray out
+ * if given, returning its length, else returned as a string
+ */
+C_NATIVE(__jwt_encode) {
+    NATIVE_UNWARN();
+    int32_t algo;
+    uint8_t *header, *payload, *key, *out;
+    uint32_t hlen, plen, klen, olen, n, i;
+    int hi, lo;
+    uint8_t pvkey[32], digest[CF_SHA256_HASHSZ], signature[64];
+    JwtMac *mac;
+    JwtHash *hctx;
+    err_t err = ERR_OK;
+
+    if (nargs != 5 || parse_py_args("isss", 4, args, &algo, &header, &hlen, &payload, &plen, &key, &klen) != 4)
+        return ERR_TYPE_EXC;
+    if (algo != JWT_ES256 && algo != JWT_HS256)
+        return ERR_UNSUPPORTED_EXC;
+    if (algo == JWT_ES256) {
+        if (klen == 32) {
+            memcpy(pvkey, key, 32);
+        } else if (klen == 64) {
+            for (i = 0; i < 32; i++) {
+                hi = jwt_hex(key[2 * i]);
+                lo = jwt_hex(key[2 * i + 1]);
+                if (hi < 0 || lo < 0)
+                    return ERR_VALUE_EXC;
+                pvkey[i] = (hi << 4) | lo;
+            }
+        } else {
+            return ERR_VALUE_EXC;
+        }
+    }
+
+    olen = hlen + 1 + jwt_b64_len(plen) + 1 + jwt_b64_len((algo == JWT_ES256) ? 64 : CF_SHA256_HASHSZ);
+    if (args[4] == MAKE_NONE()) {
+        // not a Python object while the GIL is released
+        out = gc_malloc(olen);
+    } else if (PTYPE(args[4]) == PBYTEARRAY) {
+        if (PSEQUENCE_ELEMENTS(args[4]) < olen)
+            return ERR_INDEX_EXC;
+        out = PSEQUENCE_BYTES(args[4]);
+    } else {
+        return ERR_TYPE_EXC;
+    }
+
+    mac = gc_malloc(sizeof(JwtMac) + ((algo == JWT_ES256) ? sizeof(JwtHash) : 0));
+    mac->algo = algo;
+    RELEASE_GIL();
+    if (algo == JWT_ES256)
+        cf_sha256_init(&mac->sha);
+    else
+        cf_hmac_init(&mac->hmac, &cf_sha256, key, klen);
+    n = jwt_input(mac, out, header, hlen, payload, plen);
+    out[n++] = '.';
+    if (algo == JWT_ES256) {
+        cf_sha256_digest_final(&mac->sha, digest);
+        hctx = (JwtHash*)(mac + 1);
+        hctx->uECC.init_hash = jwt_hash_init;
+        hctx->uECC.update_hash = jwt_hash_update;
+        hctx->uECC.finish_hash = jwt_hash_finish;
+        hctx->uECC.block_size = CF_SHA256_BLOCKSZ;
+        hctx->uECC.result_size = CF_SHA256_HASHSZ;
+        hctx->uECC.tmp = hctx->tmp;
+        // blinds the signature as ecc.sign does
+        if (!uECC_get_rng())
+            uECC_set_rng(zdrbg_rng);
+        if (!uECC_sign_deterministic(pvkey, digest, sizeof(digest), &hctx->uECC, signature, uECC_secp256r1()))
+            err = ERR_VALUE_EXC;
+        n += jwt_b64(out + n, signature, 64);
+    } else {
+        cf_hmac_finish(&mac->hmac, digest);
+        n += jwt_b64(out + n, digest, CF_SHA256_HASHSZ);
+    }
+    ACQUIRE_GIL();
+    memset(pvkey, 0, sizeof(pvkey));
+    gc_free(mac);
+    if (args[4] == MAKE_NONE()) {
+        if (err == ERR_OK)
+            *res = (PObject*)pstring_new(n, out);
+        gc_free(out);
+    } else if (err == ERR_OK) {
+        *res = PSMALLINT_NEW(n);
+    }
+    return err;
+}
@@ -0,0 +1,602 @@
+#include "zerynth.h"
+#include "../crc/crc.h"
+
+/*
+ * Log structured key-value store on internal flash.
+ *
+ * The region is a ring of flash sectors, each beginning with a header holding a magic and the sequence
+ * number given when the sector was opened. Entries are appended to the active sector: a 16 bytes header
+ * (key length and its complement, value length, crc32 of key and value, presence flag) followed by key
+ * and value padded to KV_ALIGN bytes. Flash is only programmed once between erases, so that flashes with
+ * ECC on double words can be used: an update appends a new entry and the newest entry of a key wins.
+ *
+ * Sectors are opened in ring order, and one of them is always kept erased: when the sector after the
+ * new active one holds entries, its live entries are copied to the active sector and it is erased
+ * (compaction). Entries copied by an interrupted compaction are identical to the originals, so the
+ * compaction is simply resumed at attach.
+ *
+ * The index is an open addressing hash table in RAM mapping each key to the offset of its newest entry;
+ * keys are compared in flash, that is memory mapped. Flash writes are done without the GIL, holding the
+ * mutex of the store.
+ */
+
+#define KV_MAGIC            0x53564B5A
+#define KV_ALIGN            8
+#define KV_HDR_SIZE         16
+#define KV_MIN_SECTORS      2
+#define KV_NO_SEQ           0xFFFFFFFF
+#define KV_CHUNK            64
+
+#define KV_EMPTY            0xFFFFFFFF  /* index slot never used */
+#define KV_GONE             0xFFFFFFFE  /* index slot of a dropped deletion */
+
+#ifndef KV_MAX_STORES
+#define KV_MAX_STORES       2
+#endif
+
+typedef struct _kv_sector_header {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t reserved[2];
+} KvSectorHeader;
+
+typedef struct _kv_entry {
+    uint8_t klen;
+    uint8_t nklen;          /* ~klen: tells a programmed header from a torn one */
+    uint16_t vlen;
+    uint32_t crc;
+    uint32_t present;       /* 0 for a deletion, 0xFFFFFFFF otherwise */
+    uint32_t reserved;
+} KvEntry;
+
+#define KV_ENTRY_VALID(e)   ((e)->nklen == (uint8_t)~(e)->klen)
+#define KV_ENTRY_FREE(e)    ((e)->klen == 0xFF && (e)->nklen == 0xFF)
+#define KV_ENTRY_SIZE(e)    KV_SIZE((e)->klen + (e)->vlen)
+#define KV_SIZE(n)          ((KV_HDR_SIZE + (n) + KV_ALIGN - 1) & ~(KV_ALIGN - 1))
+
+typedef struct _kv_slot {
+    uint32_t hash;
+    uint32_t off;           /* offset in the region of the newest entry of the key */
+} KvSlot;
+
+typedef struct _kv_store {
+    VMutex mtx;
+    uint8_t in_use;
+    uint8_t *base;          /* address of the region */
+    uint32_t sector_size;
+    uint32_t nsectors;
+    int32_t active;         /* -1 if no sector has been opened */
+    uint32_t wr_off;        /* next free byte of the active sector */
+    uint32_t seq;
+    uint32_t *seqs;         /* sequence number of each sector, KV_NO_SEQ if free */
+    KvSlot *slots;
+    uint32_t nslots;        /* power of 2 */
+    uint32_t used;          /* slots not empty */
+    uint32_t live;          /* bytes of the entries referenced by the index */
+    uint32_t compactions;
+} KvStore;
+
+static KvStore kv_stores[KV_MAX_STORES];
+
+#define KV_NEXT(k, s)       ((s) + 1 < (k)->nsectors ? (s) + 1 : 0)
+#define KV_ENTRY(k, off)    ((KvEntry *)((k)->base + (off)))
+#define KV_CAPACITY(k)      ((k)->sector_size - KV_HDR_SIZE)
+
+// FNV-1a
+static uint32_t kv_hash(const uint8_t *key, uint32_t klen)
+{
+    uint32_t h = 2166136261u;
+
+    while (klen--)
+        h = (h ^ *key++) * 16777619u;
+    return h;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Index                                                                 */
+/*-----------------------------------------------------------------------*/
+
+// slot of key, or the first reusable slot if it is not indexed (NULL if the table is full)
+static KvSlot *kv_find(KvStore *k, const uint8_t *key, uint32_t klen, uint32_t hash)
+{
+    uint32_t i, n;
+    KvSlot *slot, *reuse = NULL;
+    KvEntry *e;
+
+    for (i = hash & (k->nslots - 1), n = 0; n < k->nslots; i = (i + 1) & (k->nslots - 1), n++) {
+        slot = &k->slots[i];
+        if (slot->off == KV_EMPTY)
+            return reuse ? reuse : slot;
+        if (slot->off == KV_GONE) {
+            if (!reuse)
+                reuse = slot;
+            continue;
+        }
+        e = KV_ENTRY(k, slot->off);
+        if (slot->hash == hash && e->klen == klen && !memcmp(e + 1, key, klen))
+            return slot;
+    }
+    return reuse;
+}
+
+static int kv_slot_used(KvSlot *slot)
+{
+    return slot->off != KV_EMPTY && slot->off != KV_GONE;
+}
+
+// points the index to the entry at off, the newest one of its key
+static int kv_index(KvStore *k, uint32_t off)
+{
+    KvEntry *e = KV_ENTRY(k, off);
+    uint32_t hash = kv_hash((uint8_t *)(e + 1), e->klen);
+    KvSlot *slot = kv_find(k, (uint8_t *)(e + 1), e->klen, hash);
+
+    if (!slot)
+        return -1;
+    if (kv_slot_used(slot)) {
+        k->live -= KV_ENTRY_SIZE(KV_ENTRY(k, slot->off));
+    } else {
+        if (slot->off == KV_EMPTY)
+            k->used++;
+    }
+    slot->hash = hash;
+    slot->off = off;
+    k->live += KV_ENTRY_SIZE(e);
+    return 0;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Log                                                                   */
+/*-----------------------------------------------------------------------*/
+
+// programs the concatenation of a and b, padded with 0xff to KV_ALIGN, in chunks from RAM
+static int kv_prog(KvStore *k, uint32_t off, const uint8_t *a, uint32_t alen, const uint8_t *b, uint32_t blen)
+{
+    uint8_t chunk[KV_CHUNK];
+    uint32_t n, m;
+
+    while (alen + blen) {
+        n = 0;
+        while (n < KV_CHUNK && alen + blen) {
+            m = alen ? alen : blen;
+            if (m > KV_CHUNK - n)
+                m = KV_CHUNK - n;
+            memcpy(chunk + n, alen ? a : b, m);
+            if (alen) {
+                a += m;
+                alen -= m;
+            } else {
+                b += m;
+                blen -= m;
+            }
+            n += m;
+        }
+        m = (n + KV_ALIGN - 1) & ~(KV_ALIGN - 1);
+        memset(chunk + n, 0xff, m - n);
+        if (vhalFlashWrite(k->base + off, chunk, m) != (int)m)
+            return -1;
+        off += m;
+    }
+    return 0;
+}
+
+static int kv_erase(KvStore *k, uint32_t s)
+{
+    k->seqs[s] = KV_NO_SEQ;
+    return vhalFlashErase(k->base + s * k->sector_size, k->sector_size) != 0;
+}
+
+static int kv_open_sector(KvStore *k, uint32_t s)
+{
+    KvSectorHeader h;
+
+    if (kv_erase(k, s))
+        return -1;
+    h.magic = KV_MAGIC;
+    h.seq = ++k->seq;
+    h.reserved[0] = 0xFFFFFFFF;
+    h.reserved[1] = 0xFFFFFFFF;
+    if (kv_prog(k, s * k->sector_size, (uint8_t *)&h, KV_HDR_SIZE, NULL, 0))
+        return -1;
+    k->seqs[s] = h.seq;
+    k->active = s;
+    k->wr_off = KV_HDR_SIZE;
+    return 0;
+}
+
+// appends a copy of an entry (header fields in e) and indexes it
+static int kv_write(KvStore *k, KvEntry *e, const uint8_t *key, const uint8_t *value)
+{
+    uint32_t off = k->active * k->sector_size + k->wr_off;
+
+    // the space is used even if programming fails: it is not erased anymore
+    k->wr_off += KV_ENTRY_SIZE(e);
+    if (kv_prog(k, off, (uint8_t *)e, KV_HDR_SIZE, NULL, 0) || kv_prog(k, off + KV_HDR_SIZE, key, e->klen, value, e->vlen))
+        return -1;
+    return kv_index(k, off);
+}
+
+// moves the live entries of sector s to the active sector and erases s
+static int kv_compact(KvStore *k, uint32_t s)
+{
+    uint32_t off, end = (s + 1) * k->sector_size;
+    KvEntry *e, copy;
+    KvSlot *slot;
+
+    for (off = s * k->sector_size + KV_HDR_SIZE; off + KV_HDR_SIZE <= end; off += KV_ENTRY_SIZE(e)) {
+        e = KV_ENTRY(k, off);
+        if (!KV_ENTRY_VALID(e) || off + KV_ENTRY_SIZE(e) > end)
+            break;
+        slot = kv_find(k, (uint8_t *)(e + 1), e->klen, kv_hash((uint8_t *)(e + 1), e->klen));
+        if (!slot || slot->off != off)
+            continue;
+        if (!e->present) {
+            // no older entry of the key survives the erase
+            k->live -= KV_ENTRY_SIZE(e);
+            slot->off = KV_GONE;
+            continue;
+        }
+        if (k->wr_off + KV_ENTRY_SIZE(e) > k->sector_size)
+            return -1;
+        memcpy(&copy, e, KV_HDR_SIZE);
+        // key and value are copied from flash through the RAM chunk of kv_prog
+        if (kv_write(k, &copy, (uint8_t *)(e + 1), (uint8_t *)(e + 1) + e->klen))
+            return -1;
+    }
+    k->compactions++;
+    return kv_erase(k, s);
+}
+
+// makes room for size bytes in the active sector
+static int kv_make_room(KvStore *k, uint32_t size)
+{
+    uint32_t s, after, rounds = 0;
+
+    while (k->active < 0 || k->wr_off + size > k->sector_size) {
+        // every sector is almost full of live entries
+        if (rounds++ > k->nsectors)
+            return -2;
+        s = k->active < 0 ? 0 : KV_NEXT(k, k->active);
+        if (k->seqs[s] != KV_NO_SEQ || kv_open_sector(k, s))
+            return -1;
+        after = KV_NEXT(k, s);
+        if (after != s && k->seqs[after] != KV_NO_SEQ && kv_compact(k, after))
+            return -1;
+    }
+    return 0;
+}
+
+static int kv_set(KvStore *k, const uint8_t *key, uint32_t klen, const uint8_t *value, uint32_t vlen, int deleted)
+{
+    KvEntry e;
+    KvSlot *slot;
+    uint32_t hash = kv_hash(key, klen), size = KV_SIZE(klen + vlen), old = 0;
+    int err;
+
+    slot = kv_find(k, key, klen, hash);
+    if (!slot || (slot->off == KV_EMPTY && k->used >= k->nslots / 2))
+        return -2;
+    if (kv_slot_used(slot))
+        old = KV_ENTRY_SIZE(KV_ENTRY(k, slot->off));
+    // nothing to delete
+    if (deleted && (!old || !KV_ENTRY(k, slot->off)->present))
+        return 0;
+    // everything live must fit in all the sectors but the erased one
+    if (k->live - old + size > (k->nsectors - 1) * KV_CAPACITY(k))
+        return -2;
+
+    e.klen = klen;
+    e.nklen = ~klen;
+    e.vlen = vlen;
+    e.crc = crc32_update(crc32_update(0, key, klen), value, vlen);
+    e.present = deleted ? 0 : 0xFFFFFFFF;
+    e.reserved = 0xFFFFFFFF;
+    if ((err = kv_make_room(k, size)))
+        return err;
+    return kv_write(k, &e, key, value);
+}
+
+// rebuilds the index walking the sectors from the oldest
+static int kv_scan(KvStore *k)
+{
+    uint32_t s, first, n, off, end, nfree = 0;
+    KvSectorHeader *h;
+    KvEntry *e;
+
+    k->active = -1;
+    k->seq = 0;
+    for (s = 0; s < k->nsectors; s++) {
+        h = (KvSectorHeader *)(k->base + s * k->sector_size);
+        k->seqs[s] = (h->magic == KV_MAGIC) ? h->seq : KV_NO_SEQ;
+        if (k->seqs[s] == KV_NO_SEQ) {
+            nfree++;
+        } else if (k->active < 0 || h->seq > k->seq) {
+            k->active = s;
+            k->seq = h->seq;
+        }
+    }
+    k->wr_off = k->sector_size;
+    if (k->active < 0)
+        return 0;
+
+    first = KV_NEXT(k, k->active);
+    for (n = 0, s = first; n < k->nsectors; n++, s = KV_NEXT(k, s)) {
+        if (k->seqs[s] == KV_NO_SEQ)
+            continue;
+        end = (s + 1) * k->sector_size;
+        for (off = s * k->sector_size + KV_HDR_SIZE; off + KV_HDR_SIZE <= end; off += KV_ENTRY_SIZE(e)) {
+            e = KV_ENTRY(k, off);
+            if (KV_ENTRY_FREE(e) || !KV_ENTRY_VALID(e) || off + KV_ENTRY_SIZE(e) > end)
+                break;
+            // entries torn by a power loss are skipped
+            if (crc32_update(crc32_update(0, (uint8_t *)(e + 1), e->klen), (uint8_t *)(e + 1) + e->klen, e->vlen) != e->crc)
+                continue;
+            if (kv_index(k, off))
+                return -2;
+        }
+        if (s == k->active) {
+            // a torn header closes the sector
+            k->wr_off = (off + KV_HDR_SIZE <= end && KV_ENTRY_FREE(e)) ? off - s * k->sector_size : k->sector_size;
+        }
+    }
+
+    // no erased sector: a compaction was interrupted before erasing its source
+    if (!nfree && kv_compact(k, KV_NEXT(k, k->active)))
+        return -1;
+    return 0;
+}
+
+static KvStore *kv_get(int32_t id)
+{
+    if (id < 0 || id >= KV_MAX_STORES || !kv_stores[id].in_use)
+        return NULL;
+    return &kv_stores[id];
+}
+
+static void kv_release(KvStore *k)
+{
+    k->in_use = 0;
+    if (k->seqs) gc_free(k->seqs);
+    if (k->slots) gc_free(k->slots);
+    k->seqs = NULL;
+    k->slots = NULL;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Natives                                                               */
+/*-----------------------------------------------------------------------*/
+
+/*
+ * args: start, size, sector_size, max_keys
+ * attaches the internal flash region [start, start+size) and returns the store id
+ */
+C_NATIVE(kvstore_attach)
+{
+    C_NATIVE_UNWARN();
+    int32_t start, size, sector_size, max_keys, id, err;
+    KvStore *k;
+
+    if (parse_py_args("iiii", nargs, args, &start, &size, &sector_size, &max_keys) != 4)
+        return ERR_TYPE_EXC;
+    if (sector_size <= 2 * KV_HDR_SIZE || sector_size % KV_ALIGN || size / sector_size < KV_MIN_SECTORS || max_keys <= 0)
+        return ERR_VALUE_EXC;
+    if (vhalFlashAlignToSector((void *)start) != (void *)start)
+        return ERR_VALUE_EXC;
+
+    for (id = 0; id < KV_MAX_STORES && kv_stores[id].in_use; id++);
+    if (id >= KV_MAX_STORES)
+        return ERR_RUNTIME_EXC;
+    k = &kv_stores[id];
+    if (!k->mtx)
+        k->mtx = vosMtxCreate();
+
+    k->base = (uint8_t *)start;
+    k->sector_size = sector_size;
+    k->nsectors = size / sector_size;
+    // at most half of the slots are used, keeping probe sequences short
+    for (k->nslots = 4; k->nslots < 2 * (uint32_t)max_keys; k->nslots <<= 1);
+    k->used = 0;
+    k->live = 0;
+    k->compactions = 0;
+    k->seqs = gc_malloc(k->nsectors * sizeof(uint32_t));
+    k->slots = gc_malloc(k->nslots * sizeof(KvSlot));
+    memset(k->slots, 0xff, k->nslots * sizeof(KvSlot));
+    k->in_use = 1;
+
+    RELEASE_GIL();
+    vosMtxLock(k->mtx);
+    err = kv_scan(k);
+    vosMtxUnlock(k->mtx);
+    ACQUIRE_GIL();
+    if (err) {
+        kv_release(k);
+        return err == -2 ? ERR_RUNTIME_EXC : ERR_IOERROR_EXC;
+    }
+    *res = PSMALLINT_NEW(id);
+    return ERR_OK;
+}
+
+/*
+ * args: id
+ */
+C_NATIVE(kvstore_detach)
+{
+    C_NATIVE_UNWARN();
+    KvStore *k;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !(k = kv_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    vosMtxLock(k->mtx);
+    k->in_use = 0;
+    vosMtxUnlock(k->mtx);
+    ACQUIRE_GIL();
+    kv_release(k);
+    return ERR_OK;
+}
+
+/*
+ * args: id, key, value
+ * stores value for key; with value None the key is deleted
+ */
+C_NATIVE(kvstore_set)
+{
+    C_NATIVE_UNWARN();
+    int32_t id, klen, vlen = 0, err;
+    uint8_t *key, *value = NULL;
+    KvStore *k;
+
+    if (nargs != 3 || !IS_PSMALLINT(args[0]))
+        return ERR_TYPE_EXC;
+    if (args[2] == MAKE_NONE()) {
+        if (parse_py_args("is", 2, args, &id, &key, &klen) != 2)
+            return ERR_TYPE_EXC;
+    } else if (parse_py_args("iss", nargs, args, &id, &key, &klen, &value, &vlen) != 3) {
+        return ERR_TYPE_EXC;
+    }
+    if (!(k = kv_get(id)) || klen <= 0 || klen >= 0xFF || vlen >= 0xFFFF || KV_SIZE(klen + vlen) > KV_CAPACITY(k))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(k->mtx);
+    err = k->in_use ? kv_set(k, key, klen, value, vlen, value == NULL) : -1;
+    vosMtxUnlock(k->mtx);
+    ACQUIRE_GIL();
+    if (err == -2)
+        return ERR_RUNTIME_EXC;
+    if (err)
+        return ERR_IOERROR_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: id, key
+ * returns the value of key as bytes, or None if it is not stored
+ */
+C_NATIVE(kvstore_get)
+{
+    C_NATIVE_UNWARN();
+    int32_t id, klen;
+    uint8_t *key;
+    KvStore *k;
+    KvSlot *slot;
+    KvEntry *e;
+
+    if (parse_py_args("is", nargs, args, &id, &key, &klen) != 2)
+        return ERR_TYPE_EXC;
+    if (!(k = kv_get(id)))
+        return ERR_VALUE_EXC;
+
+    *res = MAKE_NONE();
+    RELEASE_GIL();
+    vosMtxLock(k->mtx);
+    slot = k->in_use ? kv_find(k, key, klen, kv_hash(key, klen)) : NULL;
+    // the bytes are created holding the mutex, so that no compaction erases the entry meanwhile
+    ACQUIRE_GIL();
+    if (slot && kv_slot_used(slot)) {
+        e = KV_ENTRY(k, slot->off);
+        if (e->present)
+            *res = (PObject *)pbytes_new(e->vlen, (uint8_t *)(e + 1) + e->klen);
+    }
+    vosMtxUnlock(k->mtx);
+    return ERR_OK;
+}
+
+/*
+ * args: id
+ * returns the list of the stored keys, as bytes
+ */
+C_NATIVE(kvstore_keys)
+{
+    C_NATIVE_UNWARN();
+    uint32_t i, n = 0;
+    KvStore *k;
+    KvEntry *e;
+    PList *lst;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !(k = kv_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(k->mtx);
+    ACQUIRE_GIL();
+    for (i = 0; i < k->nslots; i++) {
+        if (kv_slot_used(&k->slots[i]) && KV_ENTRY(k, k->slots[i].off)->present)
+            n++;
+    }
+    lst = plist_new(n, NULL);
+    for (i = 0, n = 0; i < k->nslots; i++) {
+        if (!kv_slot_used(&k->slots[i]))
+            continue;
+        e = KV_ENTRY(k, k->slots[i].off);
+        if (e->present)
+            PLIST_SET_ITEM(lst, n++, pbytes_new(e->klen, (uint8_t *)(e + 1)));
+    }
+    vosMtxUnlock(k->mtx);
+    *res = lst;
+    return ERR_OK;
+}
+
+/*
+ * args: id
+ * erases the whole region
+ */
+C_NATIVE(kvstore_clear)
+{
+    C_NATIVE_UNWARN();
+    uint32_t s;
+    int32_t err = 0;
+    KvStore *k;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !(k = kv_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(k->mtx);
+    for (s = 0; s < k->nsectors && !err; s++) {
+        if (k->seqs[s] != KV_NO_SEQ)
+            err = kv_erase(k, s);
+    }
+    memset(k->slots, 0xff, k->nslots * sizeof(KvSlot));
+    k->used = 0;
+    k->live = 0;
+    k->active = -1;
+    k->wr_off = k->sector_size;
+    vosMtxUnlock(k->mtx);
+    ACQUIRE_GIL();
+    if (err)
+        return ERR_IOERROR_EXC;
+    return ERR_OK;
+}
+
+/*
+ * args: id
+ * returns (sectors, live bytes, free bytes, index slots used, index slots, compactions)
+ */
+C_NATIVE(kvstore_stats)
+{
+    C_NATIVE_UNWARN();
+    uint32_t live, used;
+    KvStore *k;
+    PTuple *tpl;
+
+    if (nargs != 1 || !IS_PSMALLINT(args[0]) || !(k = kv_get(PSMALLINT_VALUE(args[0]))))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(k->mtx);
+    live = k->live;
+    used = k->used;
+    vosMtxUnlock(k->mtx);
+    ACQUIRE_GIL();
+
+    tpl = ptuple_new(6, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(k->nsectors));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(live));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW((k->nsectors - 1) * KV_CAPACITY(k) - live));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(used));
+    PTUPLE_SET_ITEM(tpl, 4, PSMALLINT_NEW(k->nslots / 2));
+    PTUPLE_SET_ITEM(tpl, 5, PSMALLINT_NEW(k->compactions));
+    *res = tpl;
+    return ERR_OK;
+}
@@ -0,0 +1,325 @@
+#include "zerynth.h"
+#include "zerynth_log.h"
+#include "../misc/snprintf.h"
+
+/*
+ * Natives of the log module over the ring of zerynth_log.h.
+ * _log_put packs the arguments of a record with no allocation; _log_get, called by the flush thread only,
+ * takes the oldest record out and builds its Python objects, formatting C records with snprintf.
+ */
+
+#define ZLOG_TEXT_SIZE 256
+
+static PObject *zlog_arg(PObject *args, int i)
+{
+    if (PTYPE(args) == PTUPLE)
+        return PTUPLE_ITEM(args, i);
+    return PLIST_ITEM(args, i);
+}
+
+static PObject *zlog_int(int64_t v)
+{
+    if (v > -1073741824 && v < 1073741824)
+        return PSMALLINT_NEW(v);
+    return (PObject*)pinteger_new(v);
+}
+
+// consumer side: moves the oldest record into rec (ZLOG_RECORD_MAX bytes), returns its length or 0 if none
+static int zlog_read(uint8_t *rec)
+{
+    uint32_t head = zlog_head, tail = zlog_tail;
+    uint32_t pos, n, i;
+    uint16_t len;
+
+    if (head == tail)
+        return 0;
+    // tail is read before the record it covers
+    __sync_synchronize();
+    for (i = 0; i < 2; i++)
+        ((uint8_t*)&len)[i] = zlog_ring[(head + i) & (ZLOG_SIZE - 1)];
+    pos = head & (ZLOG_SIZE - 1);
+    n = ZLOG_SIZE - pos;
+    if (n > len)
+        n = len;
+    memcpy(rec, zlog_ring + pos, n);
+    memcpy(rec + n, zlog_ring, len - n);
+    __sync_synchronize();
+    zlog_head = head + len;
+    return len;
+}
+
+// reads the argument at *pos of rec into v, f or s (a pointer into rec); returns its tag
+static int zlog_unpack(uint8_t *rec, int *pos, int64_t *v, double *f, const char **s, int *slen)
+{
+    int tag = rec[(*pos)++];
+
+    switch (tag) {
+        case ZLOG_STR:
+            *slen = rec[(*pos)++];
+            *s = (const char*)rec + *pos;
+            *pos += *slen;
+            break;
+        case ZLOG_FLOAT:
+            memcpy(f, rec + *pos, 8);
+            *pos += 8;
+            break;
+        case ZLOG_NONE:
+        case ZLOG_TRUE:
+        case ZLOG_FALSE:
+            break;
+        default:
+            memcpy(v, rec + *pos, 8);
+            *pos += 8;
+    }
+    return tag;
+}
+
+/*
+ * Formats the C record rec into text, following its format conversion by conversion.
+ * Each conversion is given back to snprintf with an argument of the type it was recorded with.
+ */
+static int zlog_format(uint8_t *rec, char *text)
+{
+    ZLogHeader *h = (ZLogHeader*)rec;
+    ZLogCSource src;
+    char spec[24], sbuf[ZLOG_STR_MAX + 1];
+    const char *p, *s = NULL, *start;
+    int pos, tl = 0, sl = 0, left = h->nargs, tag, k, n;
+    int64_t v = 0;
+    double f = 0;
+
+    memcpy(&src, rec + sizeof(ZLogHeader), sizeof(src));
+    pos = sizeof(ZLogHeader) + sizeof(src);
+    for (p = src.fmt; *p && tl < ZLOG_TEXT_SIZE - 1; p++) {
+        if (*p != '%') {
+            text[tl++] = *p;
+            continue;
+        }
+        if (p[1] == '%') {
+            text[tl++] = '%';
+            p++;
+            continue;
+        }
+        // copy the conversion spec, resolving '*' from the recorded ints
+        start = p;
+        k = 0;
+        spec[k++] = *p++;
+        while (*p && !((*p >= 'a' && *p <= 'z' && *p != 'l' && *p != 'h' && *p != 'z' && *p != 'j' && *p != 't') || (*p >= 'A' && *p <= 'Z'))) {
+            if (*p == '*') {
+                if (!left--)
+                    return tl;
+                zlog_unpack(rec, &pos, &v, &f, &s, &sl);
+                k += snprintf(spec + k, sizeof(spec) - k, "%i", (int)v);
+                if (k > (int)sizeof(spec) - 2)
+                    k = sizeof(spec) - 2;
+            } else if (k < (int)sizeof(spec) - 2)
+                spec[k++] = *p;
+            p++;
+        }
+        if (!*p) {
+            p = start;
+            text[tl++] = '%';
+            continue;
+        }
+        spec[k++] = *p;
+        spec[k] = 0;
+        if (!left--)
+            return tl;
+        tag = zlog_unpack(rec, &pos, &v, &f, &s, &sl);
+        n = ZLOG_TEXT_SIZE - tl;
+        switch (tag) {
+            case ZLOG_STR:
+                memcpy(sbuf, s, sl);
+                sbuf[sl] = 0;
+                n = snprintf(text + tl, n, spec, sbuf);
+                break;
+            case ZLOG_FLOAT:
+                n = snprintf(text + tl, n, spec, f);
+                break;
+            case ZLOG_LLONG:
+                n = snprintf(text + tl, n, spec, (long long)v);
+                break;
+            case ZLOG_LONG:
+                n = snprintf(text + tl, n, spec, (long)v);
+                break;
+            case ZLOG_PTR:
+                n = snprintf(text + tl, n, spec, (void*)(uintptr_t)v);
+                break;
+            default:
+                n = snprintf(text + tl, n, spec, (int)v);
+        }
+        if (n > 0)
+            tl += n;
+    }
+    if (tl > ZLOG_TEXT_SIZE - 1)
+        tl = ZLOG_TEXT_SIZE - 1;
+    return tl;
+}
+
+/*
+ * args: level, id, args
+ * records the tuple or list args for template id, if level is enabled. Strings, bytes and bytearrays are copied
+ * up to ZLOG_STR_MAX bytes; TypeError for arguments other than ints, floats, bools, None and strings
+ */
+C_NATIVE(_log_put) {
+    NATIVE_UNWARN();
+    uint32_t recbuf[ZLOG_RECORD_MAX / 4];
+    uint8_t *rec = (uint8_t*)recbuf;
+    PObject *a;
+    int32_t level, i, n, len;
+
+    if (nargs != 3 || PTYPE(args[0]) != PSMALLINT || PTYPE(args[1]) != PSMALLINT ||
+        (PTYPE(args[2]) != PTUPLE && PTYPE(args[2]) != PLIST))
+        return ERR_TYPE_EXC;
+    *res = MAKE_NONE();
+    level = PSMALLINT_VALUE(args[0]);
+    if (!zlog_enabled(level))
+        return ERR_OK;
+    len = zlog_begin(rec, level, ZLOG_PY);
+    ((ZLogHeader*)rec)->id = PSMALLINT_VALUE(args[1]);
+    n = PSEQUENCE_ELEMENTS(args[2]);
+    for (i = 0; i < n; i++) {
+        a = zlog_arg(args[2], i);
+        switch (PTYPE(a)) {
+            case PSMALLINT:
+                len = zlog_pack(rec, len, ZLOG_INT, PSMALLINT_VALUE(a), 0, NULL, 0);
+                break;
+            case PINTEGER:
+                len = zlog_pack(rec, len, ZLOG_INT, INTEGER_VALUE(a), 0, NULL, 0);
+                break;
+            case PFLOAT:
+                len = zlog_pack(rec, len, ZLOG_FLOAT, 0, FLOAT_VALUE(a), NULL, 0);
+                break;
+            case PBOOL:
+                len = zlog_pack(rec, len, PBOOL_VALUE(a) ? ZLOG_TRUE : ZLOG_FALSE, 0, 0, NULL, 0);
+                break;
+            case PNONE:
+                len = zlog_pack(rec, len, ZLOG_NONE, 0, 0, NULL, 0);
+                break;
+            case PSTRING:
+            case PBYTES:
+            case PBYTEARRAY:
+                len = zlog_pack(rec, len, ZLOG_STR, 0, 0, (const char*)PSEQUENCE_BYTES(a), PSEQUENCE_ELEMENTS(a));
+                break;
+            default:
+                return ERR_TYPE_EXC;
+        }
+    }
+    ((ZLogHeader*)rec)->len = len;
+    zlog_write(rec, len);
+    return ERR_OK;
+}
+
+/*
+ * args: timeout
+ * takes the oldest record out of the ring, waiting at most timeout millis (forever if negative).
+ * Returns None on timeout, else (millis, level, id, args, truncated): args is the tuple of arguments of template id,
+ * or, for C records, id is -1 and args the tuple (tag, text)
+ */
+C_NATIVE(_log_get) {
+    NATIVE_UNWARN();
+    uint32_t recbuf[ZLOG_RECORD_MAX / 4];
+    uint8_t *rec = (uint8_t*)recbuf;
+    char text[ZLOG_TEXT_SIZE];
+    ZLogHeader *h = (ZLogHeader*)rec;
+    ZLogCSource src;
+    PObject *t, *a, *o;
+    const char *s = NULL;
+    int32_t timeout, i, pos, sl = 0, tag;
+    int64_t v = 0;
+    double f = 0;
+
+    if (nargs != 1 || PTYPE(args[0]) != PSMALLINT)
+        return ERR_TYPE_EXC;
+    timeout = PSMALLINT_VALUE(args[0]);
+    if (!zlog_sem)
+        zlog_sem = vosSemCreate(0);
+
+    // signals left by records already taken only cost another check
+    while (!zlog_read(rec)) {
+        if (!timeout) {
+            *res = MAKE_NONE();
+            return ERR_OK;
+        }
+        RELEASE_GIL();
+        i = vosSemWaitTimeout(zlog_sem, (timeout < 0) ? VTIME_INFINITE : TIME_U(timeout, MILLIS));
+        ACQUIRE_GIL();
+        if (i != VRES_OK) {
+            *res = MAKE_NONE();
+            return ERR_OK;
+        }
+    }
+
+    if (h->kind == ZLOG_C) {
+        memcpy(&src, rec + sizeof(ZLogHeader), sizeof(src));
+        a = (PObject*)ptuple_new(2, NULL);
+        PTUPLE_SET_ITEM(a, 0, pstring_new(strlen(src.tag), (uint8_t*)src.tag));
+        i = zlog_format(rec, text);
+        PTUPLE_SET_ITEM(a, 1, pstring_new(i, (uint8_t*)text));
+    } else {
+        a = (PObject*)ptuple_new(h->nargs, NULL);
+        pos = sizeof(ZLogHeader);
+        for (i = 0; i < h->nargs; i++) {
+            tag = zlog_unpack(rec, &pos, &v, &f, &s, &sl);
+            switch (tag) {
+                case ZLOG_STR:
+                    o = (PObject*)pstring_new(sl, (uint8_t*)s);
+                    break;
+                case ZLOG_FLOAT:
+                    o = (PObject*)pfloat_new(f);
+                    break;
+                case ZLOG_TRUE:
+                    o = PBOOL_TRUE();
+                    break;
+                case ZLOG_FALSE:
+                    o = PBOOL_FALSE();
+                    break;
+                case ZLOG_NONE:
+                    o = MAKE_NONE();
+                    break;
+                default:
+                    o = zlog_int(v);
+            }
+            PTUPLE_SET_ITEM(a, i, o);
+        }
+    }
+
+    t = (PObject*)ptuple_new(5, NULL);
+    PTUPLE_SET_ITEM(t, 0, zlog_int(h->at));
+    PTUPLE_SET_ITEM(t, 1, PSMALLINT_NEW(h->level));
+    PTUPLE_SET_ITEM(t, 2, PSMALLINT_NEW((h->kind == ZLOG_C) ? -1 : h->id));
+    PTUPLE_SET_ITEM(t, 3, a);
+    PTUPLE_SET_ITEM(t, 4, h->truncated ? PBOOL_TRUE() : PBOOL_FALSE());
+    *res = t;
+    return ERR_OK;
+}
+
+/*
+ * args: level
+ * records from now on only the levels up to level (ERROR only if -1); returns the previous one
+ */
+C_NATIVE(_log_level) {
+    NATIVE_UNWARN();
+    int32_t prev = zlog_level;
+
+    if (nargs != 1 || PTYPE(args[0]) != PSMALLINT)
+        return ERR_TYPE_EXC;
+    zlog_level = PSMALLINT_VALUE(args[0]);
+    *res = PSMALLINT_NEW(prev);
+    return ERR_OK;
+}
+
+/*
+ * returns (used, size, dropped): bytes in the ring, its capacity and the number of records dropped since the start
+ */
+C_NATIVE(_log_stats) {
+    NATIVE_UNWARN();
+    PObject *t;
+
+    t = (PObject*)ptuple_new(3, NULL);
+    PTUPLE_SET_ITEM(t, 0, PSMALLINT_NEW(zlog_tail - zlog_head));
+    PTUPLE_SET_ITEM(t, 1, PSMALLINT_NEW(ZLOG_SIZE));
+    PTUPLE_SET_ITEM(t, 2, zlog_int(zlog_dropped));
+    *res = t;
+    return ERR_OK;
+}
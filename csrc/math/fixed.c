@@ -0,0 +1,317 @@
+#include "zerynth.h"
+
+/*
+ * Fixed point trigonometry for control loops on cores without FPU: no float operation, tables in flash.
+ *
+ * Angles are fractions of a turn: the 16 bits of a Q15 angle span [-pi,pi) (32768 is pi), the 32 bits of a Q31 angle likewise,
+ * so angles wrap naturally on overflow. Results are Q15 (32767 is about 1.0) or Q31.
+ *
+ * sin and cos use a quarter wave table of 256 segments: Q15 values are linearly interpolated (error below 0.2 lsb),
+ * Q31 values are rotated from the nearest entry with sin(a+d) = sin(a)cos(d) + cos(a)sin(d) and short Taylor series for d.
+ * atan2 interpolates a table of atan over [0,1] after octant reduction.
+ */
+
+// sin(i*pi/512) in Q31, i = 0..256
+static const int32_t fix_sin_tab[257] = {
+    0, 13176712, 26352928, 39528151, 52701887, 65873638, 79042909, 92209205,
+    105372028, 118530885, 131685278, 144834714, 157978697, 171116733, 184248325, 197372981,
+    210490206, 223599506, 236700388, 249792358, 262874923, 275947592, 289009871, 302061269,
+    315101295, 328129457, 341145265, 354148230, 367137861, 380113669, 393075166, 406021865,
+    418953276, 431868915, 444768294, 457650927, 470516330, 483364019, 496193509, 509004318,
+    521795963, 534567963, 547319836, 560051104, 572761285, 585449903, 598116479, 610760536,
+    623381598, 635979190, 648552838, 661102068, 673626408, 686125387, 698598533, 711045377,
+    723465451, 735858287, 748223418, 760560380, 772868706, 785147934, 797397602, 809617249,
+    821806413, 833964638, 846091463, 858186435, 870249095, 882278992, 894275671, 906238681,
+    918167572, 930061894, 941921200, 953745043, 965532978, 977284562, 988999351, 1000676905,
+    1012316784, 1023918550, 1035481766, 1047005996, 1058490808, 1069935768, 1081340445, 1092704411,
+    1104027237, 1115308496, 1126547765, 1137744621, 1148898640, 1160009405, 1171076495, 1182099496,
+    1193077991, 1204011567, 1214899813, 1225742318, 1236538675, 1247288478, 1257991320, 1268646800,
+    1279254516, 1289814068, 1300325060, 1310787095, 1321199781, 1331562723, 1341875533, 1352137822,
+    1362349204, 1372509294, 1382617710, 1392674072, 1402678000, 1412629117, 1422527051, 1432371426,
+    1442161874, 1451898025, 1461579514, 1471205974, 1480777044, 1490292364, 1499751576, 1509154322,
+    1518500250, 1527789007, 1537020244, 1546193612, 1555308768, 1564365367, 1573363068, 1582301533,
+    1591180426, 1599999411, 1608758157, 1617456335, 1626093616, 1634669676, 1643184191, 1651636841,
+    1660027308, 1668355276, 1676620432, 1684822463, 1692961062, 1701035922, 1709046739, 1716993211,
+    1724875040, 1732691928, 1740443581, 1748129707, 1755750017, 1763304224, 1770792044, 1778213194,
+    1785567396, 1792854372, 1800073849, 1807225553, 1814309216, 1821324572, 1828271356, 1835149306,
+    1841958164, 1848697674, 1855367581, 1861967634, 1868497586, 1874957189, 1881346202, 1887664383,
+    1893911494, 1900087301, 1906191570, 1912224073, 1918184581, 1924072871, 1929888720, 1935631910,
+    1941302225, 1946899451, 1952423377, 1957873796, 1963250501, 1968553292, 1973781967, 1978936331,
+    1984016189, 1989021350, 1993951625, 1998806829, 2003586779, 2008291295, 2012920201, 2017473321,
+    2021950484, 2026351522, 2030676269, 2034924562, 2039096241, 2043191150, 2047209133, 2051150040,
+    2055013723, 2058800036, 2062508835, 2066139983, 2069693342, 2073168777, 2076566160, 2079885360,
+    2083126254, 2086288720, 2089372638, 2092377892, 2095304370, 2098151960, 2100920556, 2103610054,
+    2106220352, 2108751352, 2111202959, 2113575080, 2115867626, 2118080511, 2120213651, 2122266967,
+    2124240380, 2126133817, 2127947206, 2129680480, 2131333572, 2132906420, 2134398966, 2135811153,
+    2137142927, 2138394240, 2139565043, 2140655293, 2141664948, 2142593971, 2143442326, 2144209982,
+    2144896910, 2145503083, 2146028480, 2146473080, 2146836866, 2147119825, 2147321946, 2147443222,
+    2147483647
+};
+
+// atan(i/256)/pi in Q31, i = 0..256
+static const int32_t fix_atan_tab[257] = {
+    0, 2670163, 5340245, 8010164, 10679838, 13349187, 16018129, 18686582,
+    21354465, 24021698, 26688200, 29353889, 32018685, 34682507, 37345276, 40006910,
+    42667331, 45326458, 47984212, 50640513, 53295284, 55948444, 58599915, 61249621,
+    63897482, 66543421, 69187361, 71829226, 74468939, 77106424, 79741605, 82374407,
+    85004756, 87632577, 90257796, 92880340, 95500135, 98117110, 100731191, 103342309,
+    105950391, 108555367, 111157167, 113755721, 116350962, 118942819, 121531227, 124116117,
+    126697423, 129275078, 131849018, 134419178, 136985493, 139547900, 142106335, 144660738,
+    147211045, 149757197, 152299132, 154836791, 157370116, 159899047, 162423527, 164943499,
+    167458907, 169969696, 172475810, 174977196, 177473799, 179965568, 182452450, 184934394,
+    187411349, 189883266, 192350096, 194811789, 197268300, 199719579, 202165583, 204606264,
+    207041579, 209471483, 211895933, 214314887, 216728303, 219136141, 221538359, 223934919,
+    226325781, 228710908, 231090262, 233463808, 235831508, 238193329, 240549235, 242899194,
+    245243172, 247581137, 249913059, 252238905, 254558647, 256872255, 259179700, 261480955,
+    263775993, 266064788, 268347313, 270623543, 272893455, 275157025, 277414230, 279665048,
+    281909457, 284147437, 286378966, 288604026, 290822599, 293034664, 295240206, 297439207,
+    299631651, 301817523, 303996806, 306169488, 308335554, 310494991, 312647786, 314793928,
+    316933406, 319066208, 321192324, 323311746, 325424463, 327530468, 329629752, 331722309,
+    333808132, 335887214, 337959550, 340025134, 342083962, 344136031, 346181336, 348219874,
+    350251643, 352276640, 354294865, 356306316, 358310992, 360308894, 362300021, 364284375,
+    366261957, 368232767, 370196809, 372154086, 374104599, 376048352, 377985350, 379915596,
+    381839095, 383755852, 385665872, 387569162, 389465727, 391355574, 393238710, 395115141,
+    396984877, 398847924, 400704291, 402553986, 404397019, 406233399, 408063135, 409886237,
+    411702716, 413512582, 415315845, 417112518, 418902610, 420686135, 422463104, 424233528,
+    425997422, 427754796, 429505665, 431250041, 432987938, 434719370, 436444350, 438162893,
+    439875013, 441580724, 443280042, 444972981, 446659557, 448339785, 450013680, 451681259,
+    453342536, 454997530, 456646255, 458288728, 459924966, 461554985, 463178803, 464796437,
+    466407904, 468013221, 469612406, 471205476, 472792449, 474373344, 475948178, 477516969,
+    479079736, 480636498, 482187271, 483732076, 485270931, 486803855, 488330866, 489851983,
+    491367227, 492876615, 494380167, 495877903, 497369841, 498856002, 500336404, 501811068,
+    503280012, 504743258, 506200824, 507652730, 509098996, 510539643, 511974689, 513404156,
+    514828063, 516246430, 517659277, 519066625, 520468494, 521864904, 523255875, 524641427,
+    526021581, 527396357, 528765775, 530129856, 531488619, 532842087, 534190278, 535533213,
+    536870912
+};
+
+#define FIX_PI_Q29 1686629713    // pi in Q29
+
+// sin of a quarter turn phase p in [0,2^14], Q15
+static int32_t fix_qsin15(uint32_t p)
+{
+    uint32_t i = p >> 6, f = p & 63;
+    int32_t v;
+    if (i >= 256)
+        return 32767;
+    v = fix_sin_tab[i] + (int32_t)(((int64_t)(fix_sin_tab[i + 1] - fix_sin_tab[i]) * f) >> 6);
+    v = ((v >> 15) + 1) >> 1;
+    return (v > 32767) ? 32767 : v;
+}
+
+// sin of a 16 bits angle, Q15
+static int32_t fix_sin15(uint32_t a)
+{
+    uint32_t p = a & 0x3fff;
+    switch ((a >> 14) & 3) {
+        case 0: return fix_qsin15(p);
+        case 1: return fix_qsin15(0x4000 - p);
+        case 2: return -fix_qsin15(p);
+        default: return -fix_qsin15(0x4000 - p);
+    }
+}
+
+// sin of a 32 bits angle, Q31
+static int32_t fix_sin31(uint32_t a)
+{
+    uint32_t p = a & 0x3fffffff, i = p >> 22;
+    int64_t s = fix_sin_tab[i], c = fix_sin_tab[256 - i];
+    // d in Q31 radians, below pi/512
+    int64_t d = ((int64_t)(p & 0x3fffff) * FIX_PI_Q29) >> 29;
+    int64_t d2 = (d * d) >> 31;
+    int64_t sd = d - ((((d2 * d) >> 31) + 3) / 6);
+    int64_t cd = ((int64_t)1 << 31) - (d2 >> 1) + (((d2 * d2) >> 31) / 24);
+    int64_t v;
+    switch (a >> 30) {
+        case 0: v = (s * cd + c * sd) >> 31; break;
+        case 1: v = (c * cd - s * sd) >> 31; break;
+        case 2: v = -((s * cd + c * sd) >> 31); break;
+        default: v = -((c * cd - s * sd) >> 31); break;
+    }
+    return (v > 0x7fffffff) ? 0x7fffffff : ((v < -0x7fffffff) ? -0x7fffffff : (int32_t)v);
+}
+
+// atan2 as a 32 bits angle (Q31 of pi), optionally rounded to 16 bits
+static int32_t fix_atan2(int32_t y, int32_t x, int q31)
+{
+    uint32_t ax = (x < 0) ? -(uint32_t)x : (uint32_t)x, ay = (y < 0) ? -(uint32_t)y : (uint32_t)y;
+    uint32_t mn = (ay <= ax) ? ay : ax, mx = (ay <= ax) ? ax : ay, r, i, f;
+    int32_t a;
+
+    if (!mx)
+        return 0;
+    // r = mn/mx in Q32, 1.0 excluded
+    if (q31) {
+        r = (mn == mx) ? 0 : (uint32_t)(((uint64_t)mn << 32) / mx);
+    } else {
+        // 32 bits division, 16 bits of ratio are enough for Q15
+        while (mx > 0xffff) {
+            mx >>= 1;
+            mn >>= 1;
+        }
+        r = (mn == mx) ? 0 : ((mn << 16) / mx) << 16;
+    }
+    i = r >> 24;
+    f = r & 0xffffff;
+    if (mn == mx)
+        a = fix_atan_tab[256];
+    else
+        a = fix_atan_tab[i] + (int32_t)(((int64_t)(fix_atan_tab[i + 1] - fix_atan_tab[i]) * f) >> 24);
+    if (ay > ax)
+        a = 0x40000000 - a;
+    if (x < 0)
+        a = (int32_t)(0x80000000u - (uint32_t)a);
+    if (y < 0)
+        a = -a;
+    if (q31)
+        return a;
+    // pi rounds to -pi, the same angle
+    return (int16_t)(((a >> 15) + 1) >> 1);
+}
+
+static uint32_t fix_isqrt64(uint64_t v)
+{
+    uint64_t r = 0, b = (uint64_t)1 << 62;
+    while (b > v)
+        b >>= 2;
+    while (b) {
+        if (v >= r + b) {
+            v -= r + b;
+            r = (r >> 1) + b;
+        } else {
+            r >>= 1;
+        }
+        b >>= 2;
+    }
+    return (uint32_t)r;
+}
+
+static PObject *fix_int(int32_t v)
+{
+    if (v > 0x3fffffff || v < -0x40000000)
+        return (PObject*)pinteger_new(v);
+    return PSMALLINT_NEW(v);
+}
+
+static int fix_arg(PObject *o, int32_t *v)
+{
+    if (!IS_PSMALLINT(o) && PTYPE(o) != PINTEGER)
+        return 0;
+    *v = (int32_t)INTEGER_VALUE(o);
+    return 1;
+}
+
+// shortarray or bytearray of 16 bits samples, as in the dsp module; bytes and shorts only as sources
+static int fix_samples(PObject *obj, int16_t **samples, int32_t *n, int mutable)
+{
+    int tt = PTYPE(obj);
+    if (tt == PSHORTARRAY || (!mutable && tt == PSHORTS)) {
+        *n = PSEQUENCE_ELEMENTS(obj);
+    } else if (tt == PBYTEARRAY || (!mutable && tt == PBYTES)) {
+        *n = PSEQUENCE_ELEMENTS(obj) / 2;
+    } else {
+        return 0;
+    }
+    *samples = (int16_t*)PSEQUENCE_BYTES(obj);
+    return 1;
+}
+
+#define FIX_SIN     0
+#define FIX_COS     1
+#define FIX_SINCOS  2
+
+/*
+ * args: angle, kind, q31
+ * returns sin, cos or the tuple (sin, cos)
+ */
+C_NATIVE(_fix_trig)
+{
+    C_NATIVE_UNWARN();
+    int32_t a, kind, q31, s, c;
+
+    if (nargs != 3 || !fix_arg(args[0], &a) || !IS_PSMALLINT(args[1]) || !IS_PSMALLINT(args[2]))
+        return ERR_TYPE_EXC;
+    kind = PSMALLINT_VALUE(args[1]);
+    q31 = PSMALLINT_VALUE(args[2]);
+    if (q31) {
+        s = fix_sin31((uint32_t)a);
+        c = fix_sin31((uint32_t)a + 0x40000000u);
+    } else {
+        s = fix_sin15((uint32_t)a);
+        c = fix_sin15((uint32_t)a + 0x4000u);
+    }
+    if (kind == FIX_SIN) {
+        *res = fix_int(s);
+    } else if (kind == FIX_COS) {
+        *res = fix_int(c);
+    } else {
+        PTuple *tpl = ptuple_new(2, NULL);
+        PTUPLE_SET_ITEM(tpl, 0, fix_int(s));
+        PTUPLE_SET_ITEM(tpl, 1, fix_int(c));
+        *res = (PObject*)tpl;
+    }
+    return ERR_OK;
+}
+
+/*
+ * args: y, x, q31
+ */
+C_NATIVE(_fix_atan2)
+{
+    C_NATIVE_UNWARN();
+    int32_t y, x;
+
+    if (nargs != 3 || !fix_arg(args[0], &y) || !fix_arg(args[1], &x) || !IS_PSMALLINT(args[2]))
+        return ERR_TYPE_EXC;
+    *res = fix_int(fix_atan2(y, x, PSMALLINT_VALUE(args[2])));
+    return ERR_OK;
+}
+
+/*
+ * args: x, q31
+ */
+C_NATIVE(_fix_sqrt)
+{
+    C_NATIVE_UNWARN();
+    int32_t x;
+
+    if (nargs != 2 || !fix_arg(args[0], &x) || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    if (x < 0)
+        return ERR_VALUE_EXC;
+    *res = fix_int(fix_isqrt64((uint64_t)x << (PSMALLINT_VALUE(args[1]) ? 31 : 15)));
+    return ERR_OK;
+}
+
+/*
+ * args: src, src2, dst, kind
+ * sin (kind 0) or cos (kind 1) of the Q15 angles of src, or atan2 (kind 2) of src and src2, into dst that can be src
+ */
+C_NATIVE(_fix_vtrig)
+{
+    C_NATIVE_UNWARN();
+    int16_t *x, *x2 = NULL, *y;
+    int32_t n, n2, ny, i, kind;
+
+    if (nargs != 4 || !IS_PSMALLINT(args[3]) || !fix_samples(args[0], &x, &n, 0) || !fix_samples(args[2], &y, &ny, 1))
+        return ERR_TYPE_EXC;
+    kind = PSMALLINT_VALUE(args[3]);
+    if (kind == 2) {
+        if (!fix_samples(args[1], &x2, &n2, 0))
+            return ERR_TYPE_EXC;
+        if (n2 < n)
+            return ERR_INDEX_EXC;
+    }
+    if (ny < n)
+        return ERR_INDEX_EXC;
+    for (i = 0; i < n; i++) {
+        if (kind == 0)
+            y[i] = (int16_t)fix_sin15((uint16_t)x[i]);
+        else if (kind == 1)
+            y[i] = (int16_t)fix_sin15((uint16_t)x[i] + 0x4000u);
+        else
+            y[i] = (int16_t)fix_atan2(x[i], x2[i], 0);
+    }
+    *res = args[2];
+    return ERR_OK;
+}
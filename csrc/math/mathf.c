@@ -0,0 +1,308 @@
+#include "zerynth.h"
+
+#include "include/math.h"
+#include "mathf.h"
+
+#if defined(ZM_FLOAT32)
+
+/*
+ * Float kernels: Cody-Waite argument reduction followed by the minimax polynomials of the FreeBSD float libm
+ * (k_sinf, k_cosf, e_expf, e_logf, s_atanf), evaluated in single precision only.
+ */
+
+typedef union {
+    float f;
+    uint32_t i;
+} zm_bits;
+
+#define ZM_ABS_BITS(x) (((zm_bits){x}).i & 0x7fffffff)
+
+// pi/2 split in parts of 12 bits, k*part is exact for k < 2^12
+static const float zm_pio2_1 = 1.5703125000e+00f,
+                   zm_pio2_2 = 4.8375129700e-04f,
+                   zm_pio2_3 = 7.5495336205e-08f,
+                   zm_pio2_4 = 2.5632829193e-12f,
+                   zm_pio2_5 = 6.1232342629e-17f,
+                   zm_invpio2 = 6.3661974669e-01f;
+
+// beyond this k*part is no more exact: use the double reduction
+#define ZM_REDUCE_MAX 6.4e3f
+
+// r = x - k*pi/2, returns k
+static int zm_reduce(float x, float *r)
+{
+    float fk = x * zm_invpio2;
+    int k = (int)((fk < 0) ? fk - 0.5f : fk + 0.5f);
+    fk = (float)k;
+    *r = ((((x - fk * zm_pio2_1) - fk * zm_pio2_2) - fk * zm_pio2_3) - fk * zm_pio2_4) - fk * zm_pio2_5;
+    return k;
+}
+
+// sin and cos on [-pi/4, pi/4]
+static inline float zm_ksin(float x)
+{
+    float z = x * x;
+    return x + x * z * (-1.6666666641e-01f + z * (8.3333293859e-03f + z * (-1.9839334836e-04f + z * 2.7183114940e-06f)));
+}
+
+static inline float zm_kcos(float x)
+{
+    float z = x * x;
+    return 1.0f + z * (-4.9999999725e-01f + z * (4.1666623324e-02f + z * (-1.3886763775e-03f + z * 2.4390448796e-05f)));
+}
+
+float zm_sinf(float x)
+{
+    float r;
+    int k;
+    if (!(ZM_ABS_BITS(x) < 0x7f800000))
+        return x - x;
+    if (x > ZM_REDUCE_MAX || x < -ZM_REDUCE_MAX)
+        return (float)sin(x);
+    k = zm_reduce(x, &r);
+    switch (k & 3) {
+        case 0: return zm_ksin(r);
+        case 1: return zm_kcos(r);
+        case 2: return -zm_ksin(r);
+        default: return -zm_kcos(r);
+    }
+}
+
+float zm_cosf(float x)
+{
+    float r;
+    int k;
+    if (!(ZM_ABS_BITS(x) < 0x7f800000))
+        return x - x;
+    if (x > ZM_REDUCE_MAX || x < -ZM_REDUCE_MAX)
+        return (float)cos(x);
+    k = zm_reduce(x, &r);
+    switch (k & 3) {
+        case 0: return zm_kcos(r);
+        case 1: return -zm_ksin(r);
+        case 2: return -zm_kcos(r);
+        default: return zm_ksin(r);
+    }
+}
+
+float zm_tanf(float x)
+{
+    float r;
+    int k;
+    if (!(ZM_ABS_BITS(x) < 0x7f800000))
+        return x - x;
+    if (x > ZM_REDUCE_MAX || x < -ZM_REDUCE_MAX)
+        return (float)tan(x);
+    k = zm_reduce(x, &r);
+    if (k & 1)
+        return -zm_kcos(r) / zm_ksin(r);
+    return zm_ksin(r) / zm_kcos(r);
+}
+
+float zm_sqrtf(float x)
+{
+#if defined(__ARM_FP) && (__ARM_FP & 4)
+    float r;
+    __asm__("vsqrt.f32 %0, %1" : "=t"(r) : "t"(x));
+    return r;
+#else
+    return (float)sqrt(x);
+#endif
+}
+
+static const float zm_atanhi[] = {4.6364760399e-01f, 7.8539812565e-01f, 9.8279368877e-01f, 1.5707962513e+00f};
+static const float zm_atanlo[] = {5.0121582440e-09f, 3.7748947079e-08f, 3.4473217170e-08f, 7.5497894159e-08f};
+
+float zm_atanf(float x)
+{
+    float z, w, s1, s2, ax;
+    int id;
+    uint32_t ix = ZM_ABS_BITS(x);
+
+    if (ix >= 0x4c800000) {
+        // |x| >= 2^26 or NaN
+        if (ix > 0x7f800000)
+            return x + x;
+        return (x < 0) ? -zm_atanhi[3] - zm_atanlo[3] : zm_atanhi[3] + zm_atanlo[3];
+    }
+    ax = (x < 0) ? -x : x;
+    if (ix < 0x3ee00000) {
+        // |x| < 0.4375
+        if (ix < 0x39800000)
+            return x;
+        id = -1;
+    } else if (ix < 0x3f300000) {
+        id = 0;
+        ax = (2.0f * ax - 1.0f) / (2.0f + ax);
+    } else if (ix < 0x3f980000) {
+        id = 1;
+        ax = (ax - 1.0f) / (ax + 1.0f);
+    } else if (ix < 0x401c0000) {
+        id = 2;
+        ax = (ax - 1.5f) / (1.0f + 1.5f * ax);
+    } else {
+        id = 3;
+        ax = -1.0f / ax;
+    }
+    if (id < 0)
+        ax = x;
+    z = ax * ax;
+    w = z * z;
+    s1 = z * (3.3333328366e-01f + w * (1.4253635705e-01f + w * 6.1687607318e-02f));
+    s2 = w * (-1.9999158382e-01f + w * -1.0648017377e-01f);
+    if (id < 0)
+        return ax - ax * (s1 + s2);
+    z = zm_atanhi[id] - ((ax * (s1 + s2) - zm_atanlo[id]) - ax);
+    return (x < 0) ? -z : z;
+}
+
+#define ZM_PI 3.1415927410e+00f
+#define ZM_PI_LO -8.7422776573e-08f
+
+float zm_atan2f(float y, float x)
+{
+    float a;
+    if (x != x || y != y)
+        return x + y;
+    if (y == 0) {
+        // keep the sign of zero y, pi for negative x (and -0)
+        if (x > 0 || (x == 0 && !(((zm_bits){x}).i >> 31)))
+            return y;
+        return (((zm_bits){y}).i >> 31) ? -ZM_PI - ZM_PI_LO : ZM_PI + ZM_PI_LO;
+    }
+    if (x == 0)
+        return (y < 0) ? -zm_atanhi[3] - zm_atanlo[3] : zm_atanhi[3] + zm_atanlo[3];
+    if (ZM_ABS_BITS(x) == 0x7f800000 && ZM_ABS_BITS(y) == 0x7f800000)
+        a = zm_atanhi[1];
+    else
+        a = zm_atanf((y < 0 ? -y : y) / (x < 0 ? -x : x));
+    if (x < 0)
+        a = (ZM_PI - (a - ZM_PI_LO));
+    return (y < 0) ? -a : a;
+}
+
+float zm_asinf(float x)
+{
+    return zm_atan2f(x, zm_sqrtf((1.0f - x) * (1.0f + x)));
+}
+
+float zm_acosf(float x)
+{
+    return zm_atan2f(zm_sqrtf((1.0f - x) * (1.0f + x)), x);
+}
+
+static const float zm_ln2_hi = 6.9313812256e-01f,
+                   zm_ln2_lo = 9.0580006145e-06f,
+                   zm_invln2 = 1.4426950216e+00f;
+
+// x * 2^k, k in [-151,128]
+static inline float zm_scale(float x, int k)
+{
+    zm_bits u;
+    if (k > 127) {
+        x *= 1.7014118346e+38f;   // 2^127
+        k -= 127;
+        if (k > 127)
+            k = 127;
+    } else if (k < -126) {
+        x *= 1.1754943508e-38f;   // 2^-126
+        k += 126;
+        if (k < -126)
+            k = -126;
+    }
+    u.i = (uint32_t)(0x7f + k) << 23;
+    return x * u.f;
+}
+
+float zm_expf(float x)
+{
+    float hi, lo, r, z, c;
+    int k;
+    uint32_t ix = ZM_ABS_BITS(x);
+
+    if (ix >= 0x42aeac50) {
+        // |x| >= 87.33 or NaN
+        if (ix > 0x7f800000)
+            return x + x;
+        if (x > 88.7216796875f)
+            return 1.0f / 0.0f;
+        if (x < -103.972084f)
+            return 0.0f;
+    }
+    if (ix < 0x39000000)
+        return 1.0f + x;
+    k = (int)(x * zm_invln2 + ((x < 0) ? -0.5f : 0.5f));
+    hi = x - (float)k * zm_ln2_hi;
+    lo = (float)k * zm_ln2_lo;
+    r = hi - lo;
+    z = r * r;
+    c = r - z * (1.6666625440e-1f + z * -2.7667332906e-3f);
+    r = 1.0f - ((lo - (r * c) / (2.0f - c)) - hi);
+    return (k == 0) ? r : zm_scale(r, k);
+}
+
+float zm_logf(float x)
+{
+    zm_bits u = {x};
+    float f, hfsq, s, z, w, t1, t2, dk;
+    int k = 0;
+    uint32_t ix = u.i;
+
+    if (ix < 0x00800000 || (ix >> 31)) {
+        if ((ix << 1) == 0)
+            return -1.0f / 0.0f;
+        if (ix >> 31)
+            return (x - x) / 0.0f;
+        // subnormal, scale up
+        k -= 25;
+        u.f = x * 3.3554432e7f;
+        ix = u.i;
+    } else if (ix >= 0x7f800000) {
+        return x;
+    } else if (ix == 0x3f800000) {
+        return 0;
+    }
+    // reduce x into [sqrt(2)/2, sqrt(2)]
+    ix += 0x3f800000 - 0x3f3504f3;
+    k += (int)(ix >> 23) - 0x7f;
+    ix = (ix & 0x007fffff) + 0x3f3504f3;
+    u.i = ix;
+    f = u.f - 1.0f;
+    s = f / (2.0f + f);
+    z = s * s;
+    w = z * z;
+    t1 = w * (0.40000972152f + w * 0.24279078841f);
+    t2 = z * (0.66666662693f + w * 0.28498786688f);
+    hfsq = 0.5f * f * f;
+    dk = (float)k;
+    return s * (hfsq + t1 + t2) + dk * zm_ln2_lo - hfsq + f + dk * zm_ln2_hi;
+}
+
+float zm_powf(float x, float y)
+{
+    float r, ay;
+    int odd = 0;
+
+    if (y == 0 || x == 1.0f)
+        return 1.0f;
+    if (x != x || y != y)
+        return x + y;
+    if (x < 0) {
+        // only integer exponents, the sign follows their parity
+        ay = (y < 0) ? -y : y;
+        if (ay < 1.6777216e7f) {
+            int32_t iy = (int32_t)ay;
+            if ((float)iy != ay)
+                return (x - x) / 0.0f;
+            odd = iy & 1;
+        }
+        x = -x;
+    }
+    if (x == 0)
+        r = (y < 0) ? 1.0f / 0.0f : 0.0f;
+    else
+        r = zm_expf(y * zm_logf(x));
+    return odd ? -r : r;
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef __ZERYNTH_MATHF__
+#define __ZERYNTH_MATHF__
+
+/*
+ * Single precision backend of the math natives.
+ *
+ * The fdlibm sources compute in double precision, that is emulated in software on cores with a single precision FPU.
+ * When the VM has float numbers (Z_DOUBLE_FP undefined), or when ZERYNTH_MATH_FLOAT32 is defined to trade accuracy
+ * for speed on a double VM, the natives call the float kernels of mathf.c instead: results are within a couple of ulps
+ * of float precision, except pow whose relative error grows with |y*log(x)|.
+ */
+
+#if !defined(Z_DOUBLE_FP) || defined(ZERYNTH_MATH_FLOAT32)
+
+#define ZM_FLOAT32 1
+
+float zm_sinf(float x);
+float zm_cosf(float x);
+float zm_tanf(float x);
+float zm_atanf(float x);
+float zm_atan2f(float y, float x);
+float zm_asinf(float x);
+float zm_acosf(float x);
+float zm_expf(float x);
+float zm_logf(float x);
+float zm_powf(float x, float y);
+float zm_sqrtf(float x);
+
+#define ZM_SIN(x)     zm_sinf((float)(x))
+#define ZM_COS(x)     zm_cosf((float)(x))
+#define ZM_TAN(x)     zm_tanf((float)(x))
+#define ZM_ATAN(x)    zm_atanf((float)(x))
+#define ZM_ATAN2(y,x) zm_atan2f((float)(y),(float)(x))
+#define ZM_ASIN(x)    zm_asinf((float)(x))
+#define ZM_ACOS(x)    zm_acosf((float)(x))
+#define ZM_EXP(x)     zm_expf((float)(x))
+#define ZM_LOG(x)     zm_logf((float)(x))
+#define ZM_POW(x,y)   zm_powf((float)(x),(float)(y))
+#define ZM_SQRT(x)    zm_sqrtf((float)(x))
+
+#else
+
+#define ZM_SIN(x)     sin(x)
+#define ZM_COS(x)     cos(x)
+#define ZM_TAN(x)     tan(x)
+#define ZM_ATAN(x)    atan(x)
+#define ZM_ATAN2(y,x) atan2(y,x)
+#define ZM_ASIN(x)    asin(x)
+#define ZM_ACOS(x)    acos(x)
+#define ZM_EXP(x)     exp(x)
+#define ZM_LOG(x)     log(x)
+#define ZM_POW(x,y)   pow(x,y)
+#define ZM_SQRT(x)    sqrt(x)
+
+#endif
+
+#endif
@@ -1,6 +1,7 @@
 #include "zerynth.h"
 
 #include "include/math.h"
+#include "mathf.h"
 
 //TODO: allow integers
 #define GET_ARG_x(n,x) do { \
@@ -27,7 +28,7 @@ C_NATIVE(__expn) {
     NATIVE_UNWARN();
     double x;
     GET_ARG_x(0,x);
-    *res = (PObject*)pfloat_new((float)exp(x));
+    *res = (PObject*)pfloat_new((float)ZM_EXP(x));
     return ERR_OK;
 }
 
@@ -38,9 +39,9 @@ C_NATIVE(__logn) {
     GET_ARG_x(1,y);
 
     if (y<=0) {
-        *res = (PObject*)pfloat_new((float)log(x)); 
+        *res = (PObject*)pfloat_new((float)ZM_LOG(x)); 
     } else {
-        *res = (PObject*)pfloat_new((float)(log(x)/log(y)));
+        *res = (PObject*)pfloat_new((float)(ZM_LOG(x)/ZM_LOG(y)));
     }
     return ERR_OK;
 }
@@ -0,0 +1,417 @@
+#include "zerynth.h"
+
+#include "include/math.h"
+#include "mathf.h"
+
+/////////////////////LINEAR ALGEBRA
+
+/*
+ * Small fixed size linear algebra for the linalg module: vectors, square matrices up to 4x4 (row major) and
+ * quaternions (w, x, y, z), all bytearrays of single precision floats in native byte order as the array functions
+ * of math. Operands are loaded in local arrays before the result is stored, so dst can be one of them.
+ * Everything is computed in single precision: one VM call per operation and nothing allocated but scalar results.
+ */
+
+#define LA_ADD          0
+#define LA_SUB          1
+#define LA_SCALE        2
+#define LA_MUL          3
+#define LA_MULV         4
+#define LA_TRANSPOSE    5
+#define LA_INVERSE      6
+#define LA_DET          7
+#define LA_DOT          8
+#define LA_CROSS        9
+#define LA_NORMALIZE    10
+#define LA_IDENTITY     11
+#define LA_LOAD         12
+#define LA_QMUL         13
+#define LA_QCONJ        14
+#define LA_QROTATE      15
+#define LA_QMAT         16
+#define LA_QEULER       17
+#define LA_GET          18
+#define LA_SET          19
+
+#define LA_MAX          16
+
+// float buffer of at least n elements; ERR_OK, ERR_TYPE_EXC for a wrong kind or ERR_INDEX_EXC if too short
+static err_t la_buf(PObject *obj, int32_t n, int mutable, uint8_t **buf)
+{
+    int tt = PTYPE(obj);
+
+    if (!(tt == PBYTEARRAY || (!mutable && tt == PBYTES)))
+        return ERR_TYPE_EXC;
+    if (PSEQUENCE_ELEMENTS(obj) < 4 * n)
+        return ERR_INDEX_EXC;
+    *buf = PSEQUENCE_BYTES(obj);
+    return ERR_OK;
+}
+
+static inline void la_load(float *v, uint8_t *buf, int32_t n)
+{
+    memcpy(v, buf, 4 * n);
+}
+
+static inline void la_store(uint8_t *buf, float *v, int32_t n)
+{
+    memcpy(buf, v, 4 * n);
+}
+
+static int la_num(PObject *o, float *v)
+{
+    switch (PTYPE(o)) {
+        case PSMALLINT:
+            *v = (float)PSMALLINT_VALUE(o);
+            return 0;
+        case PINTEGER:
+            *v = (float)INTEGER_VALUE(o);
+            return 0;
+        case PFLOAT:
+            *v = (float)FLOAT_VALUE(o);
+            return 0;
+    }
+    return -1;
+}
+
+static inline float la_fabs(float x)
+{
+    return (x < 0) ? -x : x;
+}
+
+// Gauss-Jordan elimination with partial pivoting: inverts the n x n matrix m into r, returns 0 if singular
+static int la_inverse(float *m, float *r, int32_t n)
+{
+    int32_t i, j, k, p;
+    float t;
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+            r[i * n + j] = (i == j) ? 1.0f : 0.0f;
+    for (k = 0; k < n; k++) {
+        p = k;
+        for (i = k + 1; i < n; i++)
+            if (la_fabs(m[i * n + k]) > la_fabs(m[p * n + k]))
+                p = i;
+        if (la_fabs(m[p * n + k]) < 1e-30f)
+            return 0;
+        if (p != k) {
+            for (j = 0; j < n; j++) {
+                t = m[k * n + j]; m[k * n + j] = m[p * n + j]; m[p * n + j] = t;
+                t = r[k * n + j]; r[k * n + j] = r[p * n + j]; r[p * n + j] = t;
+            }
+        }
+        t = 1.0f / m[k * n + k];
+        for (j = 0; j < n; j++) {
+            m[k * n + j] *= t;
+            r[k * n + j] *= t;
+        }
+        for (i = 0; i < n; i++) {
+            if (i == k || m[i * n + k] == 0)
+                continue;
+            t = m[i * n + k];
+            for (j = 0; j < n; j++) {
+                m[i * n + j] -= t * m[k * n + j];
+                r[i * n + j] -= t * r[k * n + j];
+            }
+        }
+    }
+    return 1;
+}
+
+// determinant by elimination with partial pivoting, m is destroyed
+static float la_det(float *m, int32_t n)
+{
+    int32_t i, j, k, p;
+    float t, det = 1.0f;
+
+    for (k = 0; k < n; k++) {
+        p = k;
+        for (i = k + 1; i < n; i++)
+            if (la_fabs(m[i * n + k]) > la_fabs(m[p * n + k]))
+                p = i;
+        if (m[p * n + k] == 0)
+            return 0;
+        if (p != k) {
+            for (j = 0; j < n; j++) {
+                t = m[k * n + j]; m[k * n + j] = m[p * n + j]; m[p * n + j] = t;
+            }
+            det = -det;
+        }
+        det *= m[k * n + k];
+        for (i = k + 1; i < n; i++) {
+            t = m[i * n + k] / m[k * n + k];
+            for (j = k; j < n; j++)
+                m[i * n + j] -= t * m[k * n + j];
+        }
+    }
+    return det;
+}
+
+static inline void la_cross(float *a, float *b, float *r)
+{
+    r[0] = a[1] * b[2] - a[2] * b[1];
+    r[1] = a[2] * b[0] - a[0] * b[2];
+    r[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static inline void la_qmul(float *p, float *q, float *r)
+{
+    r[0] = p[0] * q[0] - p[1] * q[1] - p[2] * q[2] - p[3] * q[3];
+    r[1] = p[0] * q[1] + p[1] * q[0] + p[2] * q[3] - p[3] * q[2];
+    r[2] = p[0] * q[2] - p[1] * q[3] + p[2] * q[0] + p[3] * q[1];
+    r[3] = p[0] * q[3] + p[1] * q[2] - p[2] * q[1] + p[3] * q[0];
+}
+
+/*
+ * args: op, a, b, dst, n, k
+ * n is the number of elements of element wise operations, the size of square matrices or the index of get and set,
+ * k the factor of scale or the value of set.
+ * Returns dst, or the scalar result of det, dot, normalize (the norm) and get, or a bool for inverse
+ */
+C_NATIVE(__linalg) {
+    NATIVE_UNWARN();
+    int32_t op, n, cnt, i, j, l;
+    float a[LA_MAX], b[LA_MAX], r[LA_MAX], k, s;
+    uint8_t *pa = NULL, *pb = NULL, *pd = NULL;
+    err_t err;
+
+    if (nargs != 6 || !IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    op = PSMALLINT_VALUE(args[0]);
+    n = PSMALLINT_VALUE(args[4]);
+    if (op < LA_ADD || op > LA_SET)
+        return ERR_VALUE_EXC;
+    *res = args[3];
+
+    if (op == LA_GET || op == LA_SET) {
+        // element n of a, or of dst set to k
+        if (n < 0)
+            return ERR_INDEX_EXC;
+        if (op == LA_GET) {
+            if ((err = la_buf(args[1], n + 1, 0, &pa)) != ERR_OK)
+                return err;
+            memcpy(&k, pa + 4 * n, 4);
+            *res = pfloat_new(k);
+        } else {
+            if ((err = la_buf(args[3], n + 1, 1, &pd)) != ERR_OK)
+                return err;
+            if (la_num(args[5], &k))
+                return ERR_TYPE_EXC;
+            memcpy(pd + 4 * n, &k, 4);
+        }
+        return ERR_OK;
+    }
+
+    switch (op) {
+        case LA_ADD:
+        case LA_SUB:
+        case LA_SCALE:
+        case LA_DOT:
+        case LA_NORMALIZE:
+        case LA_LOAD:
+            // element wise, any length
+            if (n < 0)
+                return ERR_VALUE_EXC;
+            cnt = n;
+            break;
+        case LA_MUL:
+        case LA_MULV:
+        case LA_TRANSPOSE:
+        case LA_INVERSE:
+        case LA_DET:
+        case LA_IDENTITY:
+            if (n < 1 || n > 4)
+                return ERR_VALUE_EXC;
+            cnt = n * n;
+            break;
+        default:
+            cnt = (op == LA_CROSS) ? 3 : 4;
+            break;
+    }
+
+    if (op != LA_IDENTITY && op != LA_LOAD && (err = la_buf(args[1], (op == LA_QROTATE) ? 4 : cnt, 0, &pa)) != ERR_OK)
+        return err;
+    if (op == LA_ADD || op == LA_SUB || op == LA_MUL || op == LA_DOT || op == LA_CROSS || op == LA_QMUL) {
+        if ((err = la_buf(args[2], cnt, 0, &pb)) != ERR_OK)
+            return err;
+    } else if (op == LA_MULV) {
+        if ((err = la_buf(args[2], n, 0, &pb)) != ERR_OK)
+            return err;
+    } else if (op == LA_QROTATE) {
+        if ((err = la_buf(args[2], 3, 0, &pb)) != ERR_OK)
+            return err;
+    }
+    if (op != LA_DET && op != LA_DOT) {
+        l = (op == LA_MULV || op == LA_QROTATE || op == LA_QEULER) ? ((op == LA_MULV) ? n : 3) : ((op == LA_QMAT) ? 9 : cnt);
+        if ((err = la_buf(args[3], l, 1, &pd)) != ERR_OK)
+            return err;
+    }
+
+    switch (op) {
+        case LA_ADD:
+        case LA_SUB:
+        case LA_SCALE:
+        case LA_DOT:
+        case LA_NORMALIZE: {
+            // element by element, vectors can be longer than the local arrays
+            float v, w = 0;
+            s = 0;
+            if (op == LA_SCALE && la_num(args[5], &k))
+                return ERR_TYPE_EXC;
+            if (op == LA_NORMALIZE) {
+                for (i = 0; i < n; i++) {
+                    memcpy(&v, pa + 4 * i, 4);
+                    s += v * v;
+                }
+                s = ZM_SQRT(s);
+                k = (s > 0) ? 1.0f / s : 0.0f;
+            }
+            for (i = 0; i < n; i++) {
+                memcpy(&v, pa + 4 * i, 4);
+                if (pb)
+                    memcpy(&w, pb + 4 * i, 4);
+                switch (op) {
+                    case LA_ADD: v += w; break;
+                    case LA_SUB: v -= w; break;
+                    case LA_DOT: s += v * w; continue;
+                    default: v *= k; break;
+                }
+                memcpy(pd + 4 * i, &v, 4);
+            }
+            if (op == LA_DOT || op == LA_NORMALIZE)
+                *res = pfloat_new(s);
+        }
+        break;
+        case LA_LOAD: {
+            PObject *seq = args[1];
+            float v;
+            if ((PTYPE(seq) != PLIST && PTYPE(seq) != PTUPLE) || PSEQUENCE_ELEMENTS(seq) < n)
+                return ERR_TYPE_EXC;
+            for (i = 0; i < n; i++) {
+                if (la_num(PSEQUENCE_OBJECTS(seq)[i], &v))
+                    return ERR_TYPE_EXC;
+                memcpy(pd + 4 * i, &v, 4);
+            }
+        }
+        break;
+        case LA_MUL:
+            la_load(a, pa, cnt);
+            la_load(b, pb, cnt);
+            for (i = 0; i < n; i++) {
+                for (j = 0; j < n; j++) {
+                    s = 0;
+                    for (l = 0; l < n; l++)
+                        s += a[i * n + l] * b[l * n + j];
+                    r[i * n + j] = s;
+                }
+            }
+            la_store(pd, r, cnt);
+            break;
+        case LA_MULV:
+            la_load(a, pa, cnt);
+            la_load(b, pb, n);
+            for (i = 0; i < n; i++) {
+                s = 0;
+                for (l = 0; l < n; l++)
+                    s += a[i * n + l] * b[l];
+                r[i] = s;
+            }
+            la_store(pd, r, n);
+            break;
+        case LA_TRANSPOSE:
+            la_load(a, pa, cnt);
+            for (i = 0; i < n; i++)
+                for (j = 0; j < n; j++)
+                    r[j * n + i] = a[i * n + j];
+            la_store(pd, r, cnt);
+            break;
+        case LA_INVERSE:
+            la_load(a, pa, cnt);
+            if (la_inverse(a, r, n)) {
+                la_store(pd, r, cnt);
+                *res = PBOOL_TRUE();
+            } else {
+                *res = PBOOL_FALSE();
+            }
+            break;
+        case LA_DET:
+            la_load(a, pa, cnt);
+            *res = pfloat_new(la_det(a, n));
+            break;
+        case LA_IDENTITY:
+            for (i = 0; i < cnt; i++)
+                r[i] = (i % (n + 1)) ? 0.0f : 1.0f;
+            la_store(pd, r, cnt);
+            break;
+        case LA_CROSS:
+            la_load(a, pa, 3);
+            la_load(b, pb, 3);
+            la_cross(a, b, r);
+            la_store(pd, r, 3);
+            break;
+        case LA_QMUL:
+            la_load(a, pa, 4);
+            la_load(b, pb, 4);
+            la_qmul(a, b, r);
+            la_store(pd, r, 4);
+            break;
+        case LA_QCONJ:
+            la_load(a, pa, 4);
+            r[0] = a[0];
+            r[1] = -a[1];
+            r[2] = -a[2];
+            r[3] = -a[3];
+            la_store(pd, r, 4);
+            break;
+        case LA_QROTATE: {
+            // v + w*t + u x t, with u the vector part of q and t = 2 u x v
+            float t[3], c[3];
+            la_load(a, pa, 4);
+            la_load(b, pb, 3);
+            la_cross(a + 1, b, t);
+            t[0] *= 2;
+            t[1] *= 2;
+            t[2] *= 2;
+            la_cross(a + 1, t, c);
+            for (i = 0; i < 3; i++)
+                r[i] = b[i] + a[0] * t[i] + c[i];
+            la_store(pd, r, 3);
+        }
+        break;
+        case LA_QMAT: {
+            float w, x, y, z;
+            la_load(a, pa, 4);
+            w = a[0]; x = a[1]; y = a[2]; z = a[3];
+            r[0] = 1 - 2 * (y * y + z * z);
+            r[1] = 2 * (x * y - w * z);
+            r[2] = 2 * (x * z + w * y);
+            r[3] = 2 * (x * y + w * z);
+            r[4] = 1 - 2 * (x * x + z * z);
+            r[5] = 2 * (y * z - w * x);
+            r[6] = 2 * (x * z - w * y);
+            r[7] = 2 * (y * z + w * x);
+            r[8] = 1 - 2 * (x * x + y * y);
+            la_store(pd, r, 9);
+        }
+        break;
+        case LA_QEULER: {
+            float w, x, y, z;
+            la_load(a, pa, 4);
+            w = a[0]; x = a[1]; y = a[2]; z = a[3];
+            s = 2 * (w * y - z * x);
+            if (s > 1)
+                s = 1;
+            else if (s < -1)
+                s = -1;
+            r[0] = ZM_ATAN2(2 * (w * x + y * z), 1 - 2 * (x * x + y * y));
+            r[1] = ZM_ASIN(s);
+            r[2] = ZM_ATAN2(2 * (w * z + x * y), 1 - 2 * (y * y + z * z));
+            la_store(pd, r, 3);
+        }
+        break;
+        default:
+            return ERR_VALUE_EXC;
+    }
+    return ERR_OK;
+}
@@ -1,6 +1,7 @@
 #include "zerynth.h"
 
 #include "include/math.h"
+#include "mathf.h"
 
 //TODO: allow integers
 #define GET_ARG_x(n,x) do { \
@@ -28,7 +29,7 @@ C_NATIVE(__pow) {
     double x,y;
     GET_ARG_x(0,x);
     GET_ARG_x(1,y);
-    *res = (PObject*)pfloat_new((float)pow(x,y));
+    *res = (PObject*)pfloat_new((float)ZM_POW(x,y));
     return ERR_OK;
 }
 
@@ -36,7 +37,7 @@ C_NATIVE(__sqrt) {
     NATIVE_UNWARN();
     double x;
     GET_ARG_x(0,x);
-    *res = (PObject*)pfloat_new((float)sqrt(x)); 
+    *res = (PObject*)pfloat_new((float)ZM_SQRT(x)); 
     return ERR_OK;
 }
 
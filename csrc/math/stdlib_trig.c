@@ -1,6 +1,7 @@
 #include "zerynth.h"
 
 #include "include/math.h"
+#include "mathf.h"
 
 //TODO: allow integers
 #define GET_ARG_x(n,x) do { \
@@ -28,7 +29,7 @@ C_NATIVE(__cos) {
     NATIVE_UNWARN();
     double x;
     GET_ARG_x(0,x);
-    *res = (PObject*)pfloat_new((float)cos(x));
+    *res = (PObject*)pfloat_new((float)ZM_COS(x));
     return ERR_OK;
 }
 
@@ -36,7 +37,7 @@ C_NATIVE(__sin) {
     NATIVE_UNWARN();
     double x;
     GET_ARG_x(0,x);
-    *res = (PObject*)pfloat_new((float)sin(x));
+    *res = (PObject*)pfloat_new((float)ZM_SIN(x));
     return ERR_OK;
 }
 
@@ -44,7 +45,7 @@ C_NATIVE(__tan) {
     NATIVE_UNWARN();
     double x;
     GET_ARG_x(0,x);
-    *res = (PObject*)pfloat_new((float)tan(x));
+    *res = (PObject*)pfloat_new((float)ZM_TAN(x));
     return ERR_OK;
 }
 
@@ -52,7 +53,7 @@ C_NATIVE(__acos) {
     NATIVE_UNWARN();
     double x;
     GET_ARG_x(0,x);
-    *res = (PObject*)pfloat_new((float)acos(x));
+    *res = (PObject*)pfloat_new((float)ZM_ACOS(x));
     return ERR_OK;
 }
 
@@ -60,7 +61,7 @@ C_NATIVE(__asin) {
     NATIVE_UNWARN();
     double x;
     GET_ARG_x(0,x);
-    *res = (PObject*)pfloat_new((float)asin(x));
+    *res = (PObject*)pfloat_new((float)ZM_ASIN(x));
     return ERR_OK;
 }
 
@@ -68,7 +69,7 @@ C_NATIVE(__atan) {
     NATIVE_UNWARN();
     double x;
     GET_ARG_x(0,x);
-    *res = (PObject*)pfloat_new((float)atan(x));
+    *res = (PObject*)pfloat_new((float)ZM_ATAN(x));
     return ERR_OK;
 }
 
@@ -77,7 +78,7 @@ C_NATIVE(__atan2) {
     double x,y;
     GET_ARG_x(1,x);
     GET_ARG_x(0,y);
-    *res = (PObject*)pfloat_new((float)atan2(y,x));
+    *res = (PObject*)pfloat_new((float)ZM_ATAN2(y,x));
     return ERR_OK;
 }
 
@@ -0,0 +1,177 @@
+#include "zerynth.h"
+
+#include "include/math.h"
+#include "mathf.h"
+
+/////////////////////ARRAYS
+
+/*
+ * Element wise functions over buffers, one VM call and no allocation for a whole buffer.
+ * A bytearray (or bytes, as source) holds single precision floats in native byte order;
+ * a shortarray (or shorts, as source) holds Q15 samples, signed values in [-1,1) as in the dsp module.
+ * Q15 angles are normalized to pi: sin and cos take x*pi radians and atan2 returns radians/pi,
+ * so a full period spans the whole range. Q15 results are rounded and saturated.
+ */
+
+#define VEC_SIN   0
+#define VEC_COS   1
+#define VEC_EXP   2
+#define VEC_LOG   3
+#define VEC_SQRT  4
+#define VEC_POW   5
+#define VEC_ATAN2 6
+#define VEC_SCALE 7
+
+#define GET_ARG_x(n,x) do { \
+        PObject *o = args[n];                       \
+        switch(PTYPE(o)){                           \
+            case PSMALLINT:                         \
+                x = (double)PSMALLINT_VALUE(o);     \
+                break;                              \
+            case PINTEGER:                          \
+                x = (double)INTEGER_VALUE(o);       \
+                break;                              \
+            case PFLOAT:                            \
+                x = (double)FLOAT_VALUE(o);         \
+                break;                              \
+            default:                                \
+                return ERR_TYPE_EXC;                \
+        }                                           \
+    } while (0)
+
+// number of elements of a float or Q15 buffer; -1 if obj is neither or does not match the kind q15
+static int32_t vec_len(PObject *obj, int q15, int mutable)
+{
+    int tt = PTYPE(obj);
+    if (q15) {
+        if (tt == PSHORTARRAY || (!mutable && tt == PSHORTS))
+            return PSEQUENCE_ELEMENTS(obj);
+    } else {
+        if ((tt == PBYTEARRAY || (!mutable && tt == PBYTES)) && !(PSEQUENCE_ELEMENTS(obj) & 3))
+            return PSEQUENCE_ELEMENTS(obj) / 4;
+    }
+    return -1;
+}
+
+// bytearray data has no alignment guarantee, floats are moved with memcpy
+static inline double vec_load(uint8_t *buf, int32_t i, int q15)
+{
+    float f;
+    if (q15)
+        return ((int16_t*)buf)[i] * (1.0 / 32768.0);
+    memcpy(&f, buf + 4 * i, 4);
+    return f;
+}
+
+static inline void vec_store(uint8_t *buf, int32_t i, int q15, double v)
+{
+    float f;
+    if (q15) {
+        v = v * 32768.0;
+        // NaN saturates to zero
+        if (!(v == v))
+            v = 0;
+        ((int16_t*)buf)[i] = (v >= 32767.0) ? 32767 : ((v <= -32768.0) ? -32768 : (int16_t)((v < 0) ? v - 0.5 : v + 0.5));
+        return;
+    }
+    f = (float)v;
+    memcpy(buf + 4 * i, &f, 4);
+}
+
+/*
+ * args: op, src, src2, dst, a, b
+ * src2 is the x buffer of atan2 (src being y), a is the exponent of pow or the factor of scale, b the offset of scale
+ */
+C_NATIVE(__vmath) {
+    NATIVE_UNWARN();
+    int32_t op, n, i;
+    int q15;
+    double a = 0, b = 0, x;
+    uint8_t *src, *src2 = NULL, *dst;
+
+    if (nargs != 6 || PTYPE(args[0]) != PSMALLINT)
+        return ERR_TYPE_EXC;
+    op = PSMALLINT_VALUE(args[0]);
+    q15 = IS_SHORT_PSEQUENCE_TYPE(PTYPE(args[1]));
+    n = vec_len(args[1], q15, 0);
+    if (n < 0 || vec_len(args[3], q15, 1) < 0)
+        return ERR_TYPE_EXC;
+    if (vec_len(args[3], q15, 1) < n)
+        return ERR_INDEX_EXC;
+    if (op == VEC_ATAN2) {
+        if (vec_len(args[2], q15, 0) < 0)
+            return ERR_TYPE_EXC;
+        if (vec_len(args[2], q15, 0) < n)
+            return ERR_INDEX_EXC;
+        src2 = PSEQUENCE_BYTES(args[2]);
+    }
+    if (op == VEC_POW || op == VEC_SCALE)
+        GET_ARG_x(4, a);
+    if (op == VEC_SCALE)
+        GET_ARG_x(5, b);
+    src = PSEQUENCE_BYTES(args[1]);
+    dst = PSEQUENCE_BYTES(args[3]);
+
+    switch (op) {
+        case VEC_SIN:
+            for (i = 0; i < n; i++) {
+                x = vec_load(src, i, q15);
+                vec_store(dst, i, q15, ZM_SIN(q15 ? x * M_PI : x));
+            }
+            break;
+        case VEC_COS:
+            for (i = 0; i < n; i++) {
+                x = vec_load(src, i, q15);
+                vec_store(dst, i, q15, ZM_COS(q15 ? x * M_PI : x));
+            }
+            break;
+        case VEC_EXP:
+            for (i = 0; i < n; i++)
+                vec_store(dst, i, q15, ZM_EXP(vec_load(src, i, q15)));
+            break;
+        case VEC_LOG:
+            for (i = 0; i < n; i++)
+                vec_store(dst, i, q15, ZM_LOG(vec_load(src, i, q15)));
+            break;
+        case VEC_SQRT:
+            for (i = 0; i < n; i++)
+                vec_store(dst, i, q15, ZM_SQRT(vec_load(src, i, q15)));
+            break;
+        case VEC_POW:
+            for (i = 0; i < n; i++)
+                vec_store(dst, i, q15, ZM_POW(vec_load(src, i, q15), a));
+            break;
+        case VEC_ATAN2:
+            for (i = 0; i < n; i++) {
+                x = ZM_ATAN2(vec_load(src, i, q15), vec_load(src2, i, q15));
+                vec_store(dst, i, q15, q15 ? x * M_1_PI : x);
+            }
+            break;
+        case VEC_SCALE:
+            if (!q15) {
+                // single precision multiply-add, no double conversion: pipelines on the FPU
+                float fa = (float)a, fb = (float)b, f;
+                for (i = 0; i < n; i++) {
+                    memcpy(&f, src + 4 * i, 4);
+                    f = f * fa + fb;
+                    memcpy(dst + 4 * i, &f, 4);
+                }
+            } else {
+                // Q15 multiply-add with a Q16 factor, in integer arithmetic
+                int32_t ka, kb, v;
+                if (!(a < 32768.0 && a > -32768.0 && b < 32768.0 && b > -32768.0))
+                    return ERR_VALUE_EXC;
+                ka = (int32_t)(a * 65536.0);
+                kb = (int32_t)(b * 32768.0);
+                for (i = 0; i < n; i++) {
+                    v = (int32_t)(((int64_t)((int16_t*)src)[i] * ka + 32768) >> 16) + kb;
+                    ((int16_t*)dst)[i] = (v > 32767) ? 32767 : ((v < -32768) ? -32768 : (int16_t)v);
+                }
+            }
+            break;
+        default:
+            return ERR_VALUE_EXC;
+    }
+    *res = args[3];
+    return ERR_OK;
+}
@@ -45,7 +45,7 @@
 // 32 byte is a good default
 #define PRINTF_FTOA_BUFFER_SIZE    32U
 
-// define this to support floating point (%f)
+// define this to support floating point (%f, %g)
 #define PRINTF_SUPPORT_FLOAT
 
 // define this to support long long types (%llu or %p)
@@ -262,6 +262,49 @@ static size_t _ntoa_long_long(out_fct_type out, char* buffer, size_t idx, size_t
 
 
 #if defined(PRINTF_SUPPORT_FLOAT)
+#include "zfloat.h"
+
+// shortest round trip representation (%g, %G), the precision is ignored
+static size_t _gtoa(out_fct_type out, char* buffer, size_t idx, size_t maxlen, double value, unsigned int width, unsigned int flags)
+{
+  char buf[ZF_FORMAT_SIZE + 1];
+  size_t len = 0U;
+
+  if (value >= 0) {
+    if (flags & FLAGS_PLUS) {
+      buf[len++] = '+';
+    }
+    else if (flags & FLAGS_SPACE) {
+      buf[len++] = ' ';
+    }
+  }
+  len += (size_t)zf_format(value, 0, buf + len);
+  if (flags & FLAGS_UPPERCASE) {
+    for (size_t i = 0U; i < len; i++) {
+      if (buf[i] >= 'a' && buf[i] <= 'z') {
+        buf[i] -= 'a' - 'A';
+      }
+    }
+  }
+
+  // pad spaces up to given width
+  if (!(flags & FLAGS_LEFT)) {
+    for (size_t i = len; i < width; i++) {
+      out(' ', buffer, idx++, maxlen);
+    }
+  }
+  for (size_t i = 0U; i < len; i++) {
+    out(buf[i], buffer, idx++, maxlen);
+  }
+  // append pad spaces up to given width
+  if (flags & FLAGS_LEFT) {
+    for (size_t i = len; i < width; i++) {
+      out(' ', buffer, idx++, maxlen);
+    }
+  }
+  return idx;
+}
+
 static size_t _ftoa(out_fct_type out, char* buffer, size_t idx, size_t maxlen, double value, unsigned int prec, unsigned int width, unsigned int flags)
 {
   char buf[PRINTF_FTOA_BUFFER_SIZE];
@@ -274,6 +317,11 @@ static size_t _ftoa(out_fct_type out, char* buffer, size_t idx, size_t maxlen, d
   // powers of 10
   static const double pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
 
+  // not a number, infinite or too large for the integer digit loops
+  if (!(value > -thres_max && value < thres_max)) {
+    return _gtoa(out, buffer, idx, maxlen, value, width, flags);
+  }
+
   // test for negative
   bool negative = false;
   if (value < 0) {
@@ -309,12 +357,6 @@ static size_t _ftoa(out_fct_type out, char* buffer, size_t idx, size_t maxlen, d
     ++frac;
   }
 
-  // TBD: for very large numbers switch back to native sprintf for exponentials. Anyone want to write code to replace this?
-  // Normal printf behavior is to print EVERY whole number digit which can be 100s of characters overflowing your buffers == bad
-  if (value > thres_max) {
-    return 0U;
-  }
-
   if (prec == 0U) {
     diff = value - (double)whole;
     if (diff > 0.5) {
@@ -582,6 +624,12 @@ static int _vsnprintf(out_fct_type out, char* buffer, const size_t maxlen, const
         idx = _ftoa(out, buffer, idx, maxlen, va_arg(va, double), precision, width, flags);
         format++;
         break;
+      case 'g' :
+      case 'G' :
+        if (*format == 'G') flags |= FLAGS_UPPERCASE;
+        idx = _gtoa(out, buffer, idx, maxlen, va_arg(va, double), width, flags);
+        format++;
+        break;
 #endif  // PRINTF_SUPPORT_FLOAT
       case 'c' : {
         unsigned int l = 1U;
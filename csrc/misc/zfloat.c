@@ -0,0 +1,641 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "zfloat.h"
+
+/*
+ * Grisu2 and DiyFp strtod after F. Loitsch, "Printing floating-point numbers quickly and accurately with integers"
+ * (PLDI 2010), and the double-conversion library. Only integer arithmetic, except the exact fast path of zf_parse.
+ */
+
+typedef struct {
+    uint64_t f;
+    int e;
+} zf_diy;
+
+// binary layout of doubles (0) and floats (1)
+typedef struct {
+    int sig;        // significand bits, hidden bit included
+    int denorm;     // exponent of subnormals, as a DiyFp with an integer significand
+    int maxexp;     // smallest overflowing exponent
+    int fastpow;    // largest power of ten exactly representable
+} zf_layout;
+
+static const zf_layout zf_layouts[2] = {
+    {53, -1074, 972, 22},
+    {24, -149, 105, 10},
+};
+
+// normalized 10^k for k = -348, -340, ..., 340
+static const zf_diy zf_cached[] = {
+    {0xfa8fd5a0081c0288ULL, -1220},
+    {0xbaaee17fa23ebf76ULL, -1193},
+    {0x8b16fb203055ac76ULL, -1166},
+    {0xcf42894a5dce35eaULL, -1140},
+    {0x9a6bb0aa55653b2dULL, -1113},
+    {0xe61acf033d1a45dfULL, -1087},
+    {0xab70fe17c79ac6caULL, -1060},
+    {0xff77b1fcbebcdc4fULL, -1034},
+    {0xbe5691ef416bd60cULL, -1007},
+    {0x8dd01fad907ffc3cULL, -980},
+    {0xd3515c2831559a83ULL, -954},
+    {0x9d71ac8fada6c9b5ULL, -927},
+    {0xea9c227723ee8bcbULL, -901},
+    {0xaecc49914078536dULL, -874},
+    {0x823c12795db6ce57ULL, -847},
+    {0xc21094364dfb5637ULL, -821},
+    {0x9096ea6f3848984fULL, -794},
+    {0xd77485cb25823ac7ULL, -768},
+    {0xa086cfcd97bf97f4ULL, -741},
+    {0xef340a98172aace5ULL, -715},
+    {0xb23867fb2a35b28eULL, -688},
+    {0x84c8d4dfd2c63f3bULL, -661},
+    {0xc5dd44271ad3cdbaULL, -635},
+    {0x936b9fcebb25c996ULL, -608},
+    {0xdbac6c247d62a584ULL, -582},
+    {0xa3ab66580d5fdaf6ULL, -555},
+    {0xf3e2f893dec3f126ULL, -529},
+    {0xb5b5ada8aaff80b8ULL, -502},
+    {0x87625f056c7c4a8bULL, -475},
+    {0xc9bcff6034c13053ULL, -449},
+    {0x964e858c91ba2655ULL, -422},
+    {0xdff9772470297ebdULL, -396},
+    {0xa6dfbd9fb8e5b88fULL, -369},
+    {0xf8a95fcf88747d94ULL, -343},
+    {0xb94470938fa89bcfULL, -316},
+    {0x8a08f0f8bf0f156bULL, -289},
+    {0xcdb02555653131b6ULL, -263},
+    {0x993fe2c6d07b7facULL, -236},
+    {0xe45c10c42a2b3b06ULL, -210},
+    {0xaa242499697392d3ULL, -183},
+    {0xfd87b5f28300ca0eULL, -157},
+    {0xbce5086492111aebULL, -130},
+    {0x8cbccc096f5088ccULL, -103},
+    {0xd1b71758e219652cULL, -77},
+    {0x9c40000000000000ULL, -50},
+    {0xe8d4a51000000000ULL, -24},
+    {0xad78ebc5ac620000ULL, 3},
+    {0x813f3978f8940984ULL, 30},
+    {0xc097ce7bc90715b3ULL, 56},
+    {0x8f7e32ce7bea5c70ULL, 83},
+    {0xd5d238a4abe98068ULL, 109},
+    {0x9f4f2726179a2245ULL, 136},
+    {0xed63a231d4c4fb27ULL, 162},
+    {0xb0de65388cc8ada8ULL, 189},
+    {0x83c7088e1aab65dbULL, 216},
+    {0xc45d1df942711d9aULL, 242},
+    {0x924d692ca61be758ULL, 269},
+    {0xda01ee641a708deaULL, 295},
+    {0xa26da3999aef774aULL, 322},
+    {0xf209787bb47d6b85ULL, 348},
+    {0xb454e4a179dd1877ULL, 375},
+    {0x865b86925b9bc5c2ULL, 402},
+    {0xc83553c5c8965d3dULL, 428},
+    {0x952ab45cfa97a0b3ULL, 455},
+    {0xde469fbd99a05fe3ULL, 481},
+    {0xa59bc234db398c25ULL, 508},
+    {0xf6c69a72a3989f5cULL, 534},
+    {0xb7dcbf5354e9beceULL, 561},
+    {0x88fcf317f22241e2ULL, 588},
+    {0xcc20ce9bd35c78a5ULL, 614},
+    {0x98165af37b2153dfULL, 641},
+    {0xe2a0b5dc971f303aULL, 667},
+    {0xa8d9d1535ce3b396ULL, 694},
+    {0xfb9b7cd9a4a7443cULL, 720},
+    {0xbb764c4ca7a44410ULL, 747},
+    {0x8bab8eefb6409c1aULL, 774},
+    {0xd01fef10a657842cULL, 800},
+    {0x9b10a4e5e9913129ULL, 827},
+    {0xe7109bfba19c0c9dULL, 853},
+    {0xac2820d9623bf429ULL, 880},
+    {0x80444b5e7aa7cf85ULL, 907},
+    {0xbf21e44003acdd2dULL, 933},
+    {0x8e679c2f5e44ff8fULL, 960},
+    {0xd433179d9c8cb841ULL, 986},
+    {0x9e19db92b4e31ba9ULL, 1013},
+    {0xeb96bf6ebadf77d9ULL, 1039},
+    {0xaf87023b9bf0ee6bULL, 1066}
+};
+
+#define ZF_CACHED_MIN (-348)
+#define ZF_CACHED_MAX 340
+
+static const uint64_t zf_pow10_64[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+    10000000000000000000ULL
+};
+
+static const double zf_pow10[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const float zf_pow10f[11] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+static zf_diy zf_norm(zf_diy x)
+{
+    if (!(x.f >> 32)) { x.f <<= 32; x.e -= 32; }
+    if (!(x.f >> 48)) { x.f <<= 16; x.e -= 16; }
+    if (!(x.f >> 56)) { x.f <<= 8; x.e -= 8; }
+    while (!(x.f >> 63)) { x.f <<= 1; x.e--; }
+    return x;
+}
+
+// upper 64 bits of the product, rounded
+static zf_diy zf_mul(zf_diy x, zf_diy y)
+{
+    uint64_t a = x.f >> 32, b = x.f & 0xffffffff, c = y.f >> 32, d = y.f & 0xffffffff;
+    uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    uint64_t t = (bd >> 32) + (ad & 0xffffffff) + (bc & 0xffffffff) + (1U << 31);
+    x.f = ac + (ad >> 32) + (bc >> 32) + (t >> 32);
+    x.e += y.e + 64;
+    return x;
+}
+
+static uint64_t zf_bits(double v, int single)
+{
+    uint64_t u;
+    if (single) {
+        float x = (float)v;
+        uint32_t b;
+        memcpy(&b, &x, 4);
+        return b;
+    }
+    memcpy(&u, &v, 8);
+    return u;
+}
+
+static double zf_value(uint64_t u, int single)
+{
+    double v;
+    if (single) {
+        float x;
+        uint32_t b = (uint32_t)u;
+        memcpy(&x, &b, 4);
+        return x;
+    }
+    memcpy(&v, &u, 8);
+    return v;
+}
+
+#define ZF_INF_BITS(l) ((uint64_t)((l)->maxexp - (l)->denorm + 1) << ((l)->sig - 1))
+
+// significand and exponent of the finite, positive v
+static uint64_t zf_unpack(double v, int single, int *e)
+{
+    const zf_layout *l = &zf_layouts[single];
+    uint64_t u = zf_bits(v, single);
+    uint64_t f = u & ((1ULL << (l->sig - 1)) - 1);
+    int be = (int)(u >> (l->sig - 1));
+    if (be) {
+        *e = l->denorm + be - 1;
+        return f | (1ULL << (l->sig - 1));
+    }
+    *e = l->denorm;
+    return f;
+}
+
+// f*2^e, with f of at most sig+1 bits
+static double zf_pack(uint64_t f, int e, int single)
+{
+    const zf_layout *l = &zf_layouts[single];
+    uint64_t hidden = 1ULL << (l->sig - 1);
+    while (f >= (hidden << 1)) {
+        f >>= 1;
+        e++;
+    }
+    if (e >= l->maxexp)
+        return zf_value(ZF_INF_BITS(l), single);
+    if (e < l->denorm)
+        return 0;
+    while (e > l->denorm && !(f & hidden)) {
+        f <<= 1;
+        e--;
+    }
+    if (e == l->denorm && !(f & hidden))
+        return zf_value(f, single);
+    return zf_value((f & (hidden - 1)) | ((uint64_t)(e - l->denorm + 1) << (l->sig - 1)), single);
+}
+
+/////////////////////FORMAT
+
+static void zf_round(char *digits, int n, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t wp_w)
+{
+    while (rest < wp_w && delta - rest >= ten_kappa &&
+           (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w)) {
+        digits[n - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+int zf_shortest(double v, int single, char *digits, int *dexp)
+{
+    const zf_layout *l = &zf_layouts[single];
+    zf_diy w, wp, wm, one;
+    uint64_t f, delta, p2, rest, wp_w;
+    uint32_t p1, d;
+    int e, k, idx, kappa, n = 0;
+
+    f = zf_unpack(v, single, &e);
+    // boundaries: halfway to the neighbours, the lower one is closer at powers of two
+    wp = zf_norm((zf_diy){(f << 1) + 1, e - 1});
+    if (f == (1ULL << (l->sig - 1)) && e > l->denorm)
+        wm = (zf_diy){(f << 2) - 1, e - 2};
+    else
+        wm = (zf_diy){(f << 1) - 1, e - 1};
+    wm.f <<= wm.e - wp.e;
+    wm.e = wp.e;
+
+    // cached power bringing the exponent of wp in [-60,-32]: k = ceil((-61-e)*log10(2))+347
+    k = (int)(((-61 - wp.e) * 315653 + (1 << 20) - 1) >> 20) + 347;
+    idx = (k >> 3) + 1;
+    *dexp = -(ZF_CACHED_MIN + idx * 8);
+
+    w = zf_mul(zf_norm((zf_diy){f, e}), zf_cached[idx]);
+    wp = zf_mul(wp, zf_cached[idx]);
+    wm = zf_mul(wm, zf_cached[idx]);
+    // stay inside the interval despite the rounding of the products
+    wm.f++;
+    wp.f--;
+    delta = wp.f - wm.f;
+    wp_w = wp.f - w.f;
+
+    // integer and fractional parts of wp
+    one.e = wp.e;
+    one.f = 1ULL << -one.e;
+    p1 = (uint32_t)(wp.f >> -one.e);
+    p2 = wp.f & (one.f - 1);
+    for (kappa = 1; kappa < 10 && p1 >= zf_pow10_64[kappa]; kappa++);
+
+    while (kappa > 0) {
+        d = p1 / (uint32_t)zf_pow10_64[kappa - 1];
+        p1 %= (uint32_t)zf_pow10_64[kappa - 1];
+        if (d || n)
+            digits[n++] = '0' + d;
+        kappa--;
+        rest = ((uint64_t)p1 << -one.e) + p2;
+        if (rest <= delta) {
+            *dexp += kappa;
+            zf_round(digits, n, delta, rest, zf_pow10_64[kappa] << -one.e, wp_w);
+            return n;
+        }
+    }
+    for (;;) {
+        p2 *= 10;
+        delta *= 10;
+        d = (uint32_t)(p2 >> -one.e);
+        if (d || n)
+            digits[n++] = '0' + d;
+        p2 &= one.f - 1;
+        kappa--;
+        if (p2 < delta) {
+            *dexp += kappa;
+            zf_round(digits, n, delta, p2, one.f, (-kappa < 20) ? wp_w * zf_pow10_64[-kappa] : 0);
+            return n;
+        }
+    }
+}
+
+int zf_format(double v, int single, char *str)
+{
+    char digits[18];
+    int i = 0, n, k, point, j;
+
+    if (v != v) {
+        memcpy(str, "nan", 3);
+        return 3;
+    }
+    if (zf_bits(v, 0) >> 63) {
+        str[i++] = '-';
+        v = -v;
+    }
+    if (v == 0) {
+        memcpy(str + i, "0.0", 3);
+        return i + 3;
+    }
+    if (v > 1.7976931348623157e308) {
+        memcpy(str + i, "inf", 3);
+        return i + 3;
+    }
+    n = zf_shortest(v, single, digits, &k);
+    // the decimal point follows the point-th digit
+    point = n + k;
+    if (point > -4 && point <= 16) {
+        if (point <= 0) {
+            str[i++] = '0';
+            str[i++] = '.';
+            for (j = 0; j < -point; j++)
+                str[i++] = '0';
+            memcpy(str + i, digits, n);
+            i += n;
+        } else if (point >= n) {
+            memcpy(str + i, digits, n);
+            i += n;
+            for (j = n; j < point; j++)
+                str[i++] = '0';
+            str[i++] = '.';
+            str[i++] = '0';
+        } else {
+            memcpy(str + i, digits, point);
+            i += point;
+            str[i++] = '.';
+            memcpy(str + i, digits + point, n - point);
+            i += n - point;
+        }
+    } else {
+        str[i++] = digits[0];
+        if (n > 1) {
+            str[i++] = '.';
+            memcpy(str + i, digits + 1, n - 1);
+            i += n - 1;
+        }
+        str[i++] = 'e';
+        point--;
+        str[i++] = (point < 0) ? '-' : '+';
+        if (point < 0)
+            point = -point;
+        if (point >= 100)
+            str[i++] = '0' + point / 100;
+        str[i++] = '0' + (point / 10) % 10;
+        str[i++] = '0' + point % 10;
+    }
+    return i;
+}
+
+/////////////////////PARSE
+
+// the halfway points met by zf_bigcmp and their scale factors fit in 900 bits
+#define ZF_BIG_LIMBS 30
+
+typedef struct {
+    uint32_t d[ZF_BIG_LIMBS];
+    int n;
+} zf_big;
+
+static void zf_big_set(zf_big *b, uint64_t v)
+{
+    b->d[0] = (uint32_t)v;
+    b->d[1] = (uint32_t)(v >> 32);
+    b->n = (b->d[1]) ? 2 : ((b->d[0]) ? 1 : 0);
+}
+
+static void zf_big_mul(zf_big *b, uint32_t m)
+{
+    uint64_t c = 0;
+    int i;
+    for (i = 0; i < b->n; i++) {
+        c += (uint64_t)b->d[i] * m;
+        b->d[i] = (uint32_t)c;
+        c >>= 32;
+    }
+    if (c && b->n < ZF_BIG_LIMBS)
+        b->d[b->n++] = (uint32_t)c;
+}
+
+static void zf_big_pow5(zf_big *b, int e)
+{
+    static const uint32_t p5[14] = {1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625,
+                                    48828125, 244140625, 1220703125};
+    for (; e >= 13; e -= 13)
+        zf_big_mul(b, p5[13]);
+    if (e)
+        zf_big_mul(b, p5[e]);
+}
+
+static void zf_big_shl(zf_big *b, int s)
+{
+    int w = s >> 5, i;
+    s &= 31;
+    if (!b->n)
+        return;
+    if (b->n + w + 1 > ZF_BIG_LIMBS)
+        w = ZF_BIG_LIMBS - b->n - 1;
+    b->d[b->n] = 0;
+    for (i = b->n; i > 0; i--)
+        b->d[i + w] = (s) ? (b->d[i] << s) | (b->d[i - 1] >> (32 - s)) : b->d[i];
+    b->d[w] = b->d[0] << s;
+    for (i = 0; i < w; i++)
+        b->d[i] = 0;
+    b->n += w + 1;
+    while (b->n && !b->d[b->n - 1])
+        b->n--;
+}
+
+static int zf_big_cmp(zf_big *a, zf_big *b)
+{
+    int i;
+    if (a->n != b->n)
+        return (a->n < b->n) ? -1 : 1;
+    for (i = a->n - 1; i >= 0; i--) {
+        if (a->d[i] != b->d[i])
+            return (a->d[i] < b->d[i]) ? -1 : 1;
+    }
+    return 0;
+}
+
+// a -= b, with a >= b
+static void zf_big_sub(zf_big *a, zf_big *b)
+{
+    int64_t c = 0;
+    int i;
+    for (i = 0; i < a->n; i++) {
+        c += (int64_t)a->d[i] - ((i < b->n) ? b->d[i] : 0);
+        a->d[i] = (uint32_t)c;
+        c >>= 32;
+    }
+    while (a->n && !a->d[a->n - 1])
+        a->n--;
+}
+
+/*
+ * Exact decision between guess and the next float: the nsig significant digits starting at sd, times 10^e10,
+ * are compared one by one with the decimal expansion of the halfway point between them, so that any number
+ * of digits is handled in constant memory.
+ */
+static double zf_bigcmp(const char *sd, int nsig, int e10, double guess, int single)
+{
+    zf_big num, den;
+    uint64_t f;
+    int e, p, q, c = -1;
+
+    if (zf_bits(guess, single) == ZF_INF_BITS(&zf_layouts[single]))
+        return guess;
+    // halfway point (2f+1)*2^(e-1) divided by 10^p, as num/den: the digits are 0.d1d2d3...
+    f = zf_unpack(guess, single, &e);
+    e--;
+    p = e10 + nsig;
+    zf_big_set(&num, 2 * f + 1);
+    zf_big_set(&den, 1);
+    if (p >= 0)
+        zf_big_pow5(&den, p);
+    else
+        zf_big_pow5(&num, -p);
+    if (e >= p)
+        zf_big_shl(&num, e - p);
+    else
+        zf_big_shl(&den, p - e);
+
+    // a halfway point above 10^p is above the value
+    if (zf_big_cmp(&num, &den) < 0) {
+        for (; nsig; sd++) {
+            if (*sd == '.')
+                continue;
+            zf_big_mul(&num, 10);
+            for (q = 0; zf_big_cmp(&num, &den) >= 0; q++)
+                zf_big_sub(&num, &den);
+            if (*sd - '0' != q)
+                break;
+            nsig--;
+        }
+        if (nsig)
+            c = (*sd - '0' > q) ? 1 : -1;
+        else
+            c = (num.n) ? -1 : 0;
+    }
+    if (c < 0 || (!c && !(f & 1)))
+        return guess;
+    return zf_pack(f + 1, e + 1, single);
+}
+
+/*
+ * w*10^e10 rounded to the nearest float: w holds the first 19 significant digits, rounded up when the dropped ones
+ * start with 5 or more, dropped tells whether any dropped digit is not zero.
+ */
+static double zf_decimal(uint64_t w, int e10, int dropped, int rounded, int ndigits,
+                         const char *sd, int nsig, int e10all, int single)
+{
+    const zf_layout *l = &zf_layouts[single];
+    zf_diy x;
+    uint64_t error, bits, half, mask;
+    int idx, adj, s, order, prec;
+    double guess;
+
+    if (!dropped) {
+        // exact operands give a correctly rounded result
+        uint64_t lim = 1ULL << l->sig, m = w;
+        int k = e10;
+        while (k > l->fastpow && m <= lim / 10) {
+            m *= 10;
+            k--;
+        }
+        if (m <= lim && k >= -l->fastpow && k <= l->fastpow) {
+            if (single) {
+                float r = (float)m;
+                return (k < 0) ? r / zf_pow10f[-k] : r * zf_pow10f[k];
+            }
+            return (k < 0) ? (double)m / zf_pow10[-k] : (double)m * zf_pow10[k];
+        }
+    }
+    if (e10 > ZF_CACHED_MAX)
+        return zf_pack(1, l->maxexp, single);
+    if (e10 < ZF_CACHED_MIN)
+        return 0;
+
+    // error of x in eighths of its last bit
+    x.f = w + rounded;
+    x.e = 0;
+    error = (dropped) ? 4 : 0;
+    s = x.e;
+    x = zf_norm(x);
+    error <<= s - x.e;
+
+    idx = (e10 - ZF_CACHED_MIN) >> 3;
+    adj = e10 - ZF_CACHED_MIN - 8 * idx;
+    if (adj) {
+        x = zf_mul(x, zf_norm((zf_diy){zf_pow10_64[adj], 0}));
+        // exact unless the product needs more than 64 bits
+        if (ndigits + adj > 19)
+            error += 4;
+    }
+    x = zf_mul(x, zf_cached[idx]);
+    error += 4 + (error ? 1 : 0) + 4;
+    s = x.e;
+    x = zf_norm(x);
+    error <<= s - x.e;
+
+    // bits of x below the significand of the result, fewer for subnormals
+    order = 64 + x.e;
+    if (order >= l->denorm + l->sig)
+        prec = 64 - l->sig;
+    else if (order <= l->denorm)
+        prec = 64;
+    else
+        prec = 64 - (order - l->denorm);
+    if (prec + 3 >= 64) {
+        s = prec + 3 - 64 + 1;
+        x.f >>= s;
+        x.e += s;
+        error = (error >> s) + 1 + 8;
+        prec -= s;
+    }
+    mask = (1ULL << prec) - 1;
+    bits = (x.f & mask) * 8;
+    half = (1ULL << (prec - 1)) * 8;
+    guess = zf_pack((x.f >> prec) + (bits >= half + error), x.e + prec, single);
+    if (half - error < bits && bits < half + error)
+        return zf_bigcmp(sd, nsig, e10all, guess, single);
+    return guess;
+}
+
+int zf_parse(const char *str, int len, int single, double *res)
+{
+    uint64_t w = 0;
+    const char *sd = NULL;
+    int i = 0, neg = 0, nsig = 0, ndigits = 0, dexp = 0, ex = 0, exneg = 0, dropped = 0, rounded = 0;
+    int frac = 0, any = 0, j;
+    double v;
+
+    if (i < len && (str[i] == '-' || str[i] == '+'))
+        neg = (str[i++] == '-');
+    for (; i < len; i++) {
+        char c = str[i];
+        if (c == '.' && !frac) {
+            frac = 1;
+            continue;
+        }
+        if (c < '0' || c > '9')
+            break;
+        any = 1;
+        if (c != '0' || nsig) {
+            if (!nsig)
+                sd = str + i;
+            if (nsig < 19) {
+                w = w * 10 + (c - '0');
+                ndigits++;
+            } else {
+                if (nsig == 19)
+                    rounded = (c >= '5');
+                if (c != '0')
+                    dropped = 1;
+            }
+            nsig++;
+        }
+        if (frac)
+            dexp--;
+    }
+    if (!any)
+        return 0;
+    if (i < len && (str[i] == 'e' || str[i] == 'E')) {
+        j = i + 1;
+        if (j < len && (str[j] == '-' || str[j] == '+'))
+            exneg = (str[j++] == '-');
+        if (j < len && str[j] >= '0' && str[j] <= '9') {
+            for (; j < len && str[j] >= '0' && str[j] <= '9'; j++) {
+                if (ex < 100000)
+                    ex = ex * 10 + (str[j] - '0');
+            }
+            i = j;
+            dexp += (exneg) ? -ex : ex;
+        }
+    }
+    if (!w)
+        v = 0;
+    else
+        v = zf_decimal(w, dexp + nsig - ndigits, dropped, dropped && rounded, ndigits, sd, nsig, dexp, single);
+    *res = (neg) ? -v : v;
+    return i;
+}
@@ -0,0 +1,41 @@
+#ifndef __ZERYNTH_ZFLOAT__
+#define __ZERYNTH_ZFLOAT__
+
+#include <stdint.h>
+
+/*
+ * Shortest round trip conversions between binary floats and decimal strings.
+ *
+ * zf_format writes the shortest decimal string that reads back to the same float (Grisu2 over a table of 87
+ * cached powers of ten), laid out as Python repr does. zf_parse converts a decimal string to the nearest float:
+ * exact float arithmetic when possible, a 64 bit approximation with a bounded error otherwise and, in the rare
+ * cases too close to a rounding boundary, an exact big integer comparison.
+ *
+ * Both work on doubles or, with single set, on single precision values held in a double: the shortest string
+ * of a float is usually much shorter than the one of the same value as a double.
+ */
+
+/* enough for any double or float formatted by zf_format, terminator included */
+#define ZF_FORMAT_SIZE 32
+
+/*
+ * Writes the shortest digits of the finite, positive v in digits (at least 18 bytes, not terminated).
+ * Returns the number of digits n; v is digits*10^(*dexp).
+ */
+int zf_shortest(double v, int single, char *digits, int *dexp);
+
+/*
+ * Writes v in str (at least ZF_FORMAT_SIZE bytes, not terminated) as Python repr does: fixed notation
+ * for exponents in [-4,16[, exponential notation otherwise, "inf" and "nan" for non finite values.
+ * Returns the written length.
+ */
+int zf_format(double v, int single, char *str);
+
+/*
+ * Parses the decimal number at the start of str ([-+]digits[.digits][(e|E)[-+]digits], at most len chars)
+ * into the nearest double, or float if single is set, stored in *res.
+ * Returns the number of chars consumed, 0 if str does not start with a number.
+ */
+int zf_parse(const char *str, int len, int single, double *res);
+
+#endif
@@ -0,0 +1,36 @@
+#include "zerynth.h"
+
+/*
+ * Tables and hooks of the GIL handoff (see zerynth_gilprio.h). ACQUIRE_GIL calls the hooks from any native, so this
+ * file is linked with the builtins natives; it is empty without ZERYNTH_GIL_HANDOFF.
+ */
+
+#if defined(ZERYNTH_GIL_HANDOFF)
+
+volatile uint8_t gilprio_waiting[GILPRIO_LEVELS];
+volatile uint32_t gilprio_mask;
+uint32_t gilprio_handoffs;
+
+// before waiting for the GIL
+void gilprio_wait(void)
+{
+    int32_t p = vosThGetPriority();
+
+    vosSysLock();
+    if (!gilprio_waiting[p]++)
+        gilprio_mask |= (1 << p);
+    vosSysUnlock();
+}
+
+// after taking the GIL
+void gilprio_got(void)
+{
+    int32_t p = vosThGetPriority();
+
+    vosSysLock();
+    if (!--gilprio_waiting[p])
+        gilprio_mask &= ~(1 << p);
+    vosSysUnlock();
+}
+
+#endif
@@ -0,0 +1,230 @@
+#include "zerynth.h"
+
+/*
+ * Native loops of the builtins sum, min, max, any and all over bytes, shorts and lists or tuples of numbers.
+ * Results are the ones of the bytecode loops in __builtins__.py: sums are accumulated left to right, as integers until
+ * the first float, min and max keep the first of equal elements. For any other sequence, any element that is not
+ * a number (or for any and all, a number, None or a sequence), and integer overflows, None is returned and the
+ * builtin falls back to its bytecode loop.
+ */
+
+#define SEQ_SUM 0
+#define SEQ_MIN 1
+#define SEQ_MAX 2
+#define SEQ_ANY 3
+#define SEQ_ALL 4
+
+#define SEQ_BYTES(tt)  ((tt) == PBYTES || (tt) == PBYTEARRAY)
+#define SEQ_SHORTS(tt) ((tt) == PSHORTS || (tt) == PSHORTARRAY)
+
+static PObject *seq_int(int64_t v)
+{
+    if (v > -1073741824 && v < 1073741824)
+        return PSMALLINT_NEW(v);
+    if ((int64_t)(INT_TYPE)v != v)
+        return NULL;
+    return (PObject*)pinteger_new((INT_TYPE)v);
+}
+
+// kind of a number: 1 integer, 2 float, 0 other
+static int seq_num(PObject *o, int64_t *i, FLOAT_TYPE *f)
+{
+    switch (PTYPE(o)) {
+        case PSMALLINT:
+            *i = PSMALLINT_VALUE(o);
+            return 1;
+        case PINTEGER:
+            *i = INTEGER_VALUE(o);
+            return 1;
+        case PFLOAT:
+            *f = FLOAT_VALUE(o);
+            return 2;
+    }
+    return 0;
+}
+
+// truth value: 1, 0, or -1 if it can't be told without calling methods
+static int seq_truth(PObject *o)
+{
+    int tt = PTYPE(o);
+
+    switch (tt) {
+        case PSMALLINT:
+            return PSMALLINT_VALUE(o) != 0;
+        case PINTEGER:
+            return INTEGER_VALUE(o) != 0;
+        case PFLOAT:
+            return FLOAT_VALUE(o) != 0;
+        case PBOOL:
+            return o == PBOOL_TRUE();
+        case PNONE:
+            return 0;
+    }
+    if (tt == PSTRING || SEQ_BYTES(tt) || SEQ_SHORTS(tt) || tt == PLIST || tt == PTUPLE)
+        return PSEQUENCE_ELEMENTS(o) != 0;
+    return -1;
+}
+
+// sum, min and max of bytes and shorts
+static PObject *seq_packed(int op, PObject *x, int64_t start)
+{
+    int32_t n = PSEQUENCE_ELEMENTS(x), i;
+    int shorts = SEQ_SHORTS(PTYPE(x));
+    uint8_t *b = PSEQUENCE_BYTES(x);
+    uint16_t *s = PSEQUENCE_SHORTS(x);
+    int64_t acc;
+    uint32_t v, best;
+
+    if (op == SEQ_SUM) {
+        acc = start;
+        if (shorts) {
+            for (i = 0; i < n; i++)
+                acc += s[i];
+        } else {
+            for (i = 0; i < n; i++)
+                acc += b[i];
+        }
+        return seq_int(acc);
+    }
+    best = shorts ? s[0] : b[0];
+    for (i = 1; i < n; i++) {
+        v = shorts ? s[i] : b[i];
+        if ((op == SEQ_MAX) ? (v > best) : (v < best))
+            best = v;
+    }
+    return PSMALLINT_NEW(best);
+}
+
+static PObject *seq_sum(PObject **items, int32_t n, PObject *start)
+{
+    int64_t iacc, iv;
+    FLOAT_TYPE facc = 0, fv;
+    int kind, i;
+
+    kind = seq_num(start, &iacc, &facc);
+    if (!kind)
+        return NULL;
+    for (i = 0; i < n; i++) {
+        switch (seq_num(items[i], &iv, &fv)) {
+            case 1:
+                if (kind == 2) {
+                    facc += (FLOAT_TYPE)iv;
+                } else {
+                    // the VM raises on overflow: leave it to the bytecode
+                    if ((iv > 0 && iacc > INT64_MAX - iv) || (iv < 0 && iacc < INT64_MIN - iv))
+                        return NULL;
+                    iacc += iv;
+                }
+                break;
+            case 2:
+                if (kind == 1) {
+                    facc = (FLOAT_TYPE)iacc;
+                    kind = 2;
+                }
+                facc += fv;
+                break;
+            default:
+                return NULL;
+        }
+    }
+    return (kind == 1) ? seq_int(iacc) : (PObject*)pfloat_new(facc);
+}
+
+static PObject *seq_minmax(int op, PObject **items, int32_t n)
+{
+    PObject *best = items[0];
+    int64_t bi, iv;
+    FLOAT_TYPE bf = 0, fv = 0;
+    int bk, k, gt, i;
+
+    bk = seq_num(best, &bi, &bf);
+    if (!bk)
+        return NULL;
+    for (i = 1; i < n; i++) {
+        k = seq_num(items[i], &iv, &fv);
+        if (!k)
+            return NULL;
+        if (k == 1 && bk == 1) {
+            gt = (op == SEQ_MAX) ? (iv > bi) : (iv < bi);
+        } else {
+            if (k == 1)
+                fv = (FLOAT_TYPE)iv;
+            if (bk == 1)
+                bf = (FLOAT_TYPE)bi;
+            gt = (op == SEQ_MAX) ? (fv > bf) : (fv < bf);
+        }
+        if (gt) {
+            best = items[i];
+            bk = k;
+            bi = iv;
+            bf = fv;
+        }
+    }
+    return best;
+}
+
+/*
+ * args: op, x, start
+ * returns sum(x,start), min(x), max(x), any(x) or all(x), None if x must go through the bytecode loop.
+ * x is not empty for min and max
+ */
+C_NATIVE(__seqop) {
+    NATIVE_UNWARN();
+    int32_t op, n, i;
+    int tt, t;
+    int64_t start;
+    PObject *r = NULL, **items;
+
+    if (nargs != 3 || !IS_PSMALLINT(args[0]))
+        return ERR_TYPE_EXC;
+    op = PSMALLINT_VALUE(args[0]);
+    tt = PTYPE(args[1]);
+    n = (tt == PLIST || tt == PTUPLE || SEQ_BYTES(tt) || SEQ_SHORTS(tt)) ? PSEQUENCE_ELEMENTS(args[1]) : -1;
+    *res = MAKE_NONE();
+    if (n < 0 || ((op == SEQ_MIN || op == SEQ_MAX) && !n))
+        return ERR_OK;
+
+    if (op == SEQ_ANY || op == SEQ_ALL) {
+        if (tt != PLIST && tt != PTUPLE) {
+            // packed elements are numbers: all is true without zeros, any without only zeros
+            for (i = 0; i < n; i++) {
+                t = SEQ_SHORTS(tt) ? PSEQUENCE_SHORTS(args[1])[i] != 0 : PSEQUENCE_BYTES(args[1])[i] != 0;
+                if (t == (op == SEQ_ANY))
+                    break;
+            }
+            *res = ((i < n) == (op == SEQ_ANY)) ? PBOOL_TRUE() : PBOOL_FALSE();
+            return ERR_OK;
+        }
+        items = PSEQUENCE_OBJECTS(args[1]);
+        for (i = 0; i < n; i++) {
+            t = seq_truth(items[i]);
+            if (t < 0)
+                return ERR_OK;
+            if (t == (op == SEQ_ANY))
+                break;
+        }
+        *res = ((i < n) == (op == SEQ_ANY)) ? PBOOL_TRUE() : PBOOL_FALSE();
+        return ERR_OK;
+    }
+
+    if (tt != PLIST && tt != PTUPLE) {
+        if (op == SEQ_SUM) {
+            if (PTYPE(args[2]) == PSMALLINT)
+                start = PSMALLINT_VALUE(args[2]);
+            else if (PTYPE(args[2]) == PINTEGER)
+                start = INTEGER_VALUE(args[2]);
+            else
+                return ERR_OK;
+        } else {
+            start = 0;
+        }
+        r = seq_packed(op, args[1], start);
+    } else if (op == SEQ_SUM) {
+        r = seq_sum(PSEQUENCE_OBJECTS(args[1]), n, args[2]);
+    } else if (op == SEQ_MIN || op == SEQ_MAX) {
+        r = seq_minmax(op, PSEQUENCE_OBJECTS(args[1]), n);
+    }
+    if (r)
+        *res = r;
+    return ERR_OK;
+}
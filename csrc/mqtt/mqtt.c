@@ -0,0 +1,512 @@
+#include "zerynth.h"
+
+/*
+ * MQTT 3.1.1 and 5 packet codec for mqtt.py.
+ *
+ * Packets are encoded into the caller's buffer: the variable header and payload are written after room for the
+ * longest fixed header, then moved down behind the fixed header once the remaining length is known. PUBLISH is
+ * encoded up to the topic and packet id only, the payload being sent after it by the same socket.sendmsg.
+ * Version 5 packets are sent without properties, but session expiry in CONNECT; received properties are skipped.
+ *
+ * QoS 1 messages waiting for their PUBACK are tracked in a fixed table kept in a bytearray: packet id, time of the
+ * last transmission and a used flag per slot. The client keeps what to retransmit in a list indexed by slot.
+ */
+
+#define MQTT_V311           4
+#define MQTT_V5             5
+#define MQTT_MAX_HEAD       5   // type byte and four bytes of remaining length
+#define MQTT_MAX_LEN        268435455
+#define MQTT_MAX_INFLIGHT   64
+
+#define MQTT_CONNECT        0x10
+#define MQTT_PUBLISH        0x30
+#define MQTT_SUBSCRIBE      0x82
+#define MQTT_UNSUBSCRIBE    0xa2
+
+typedef struct _mqtt_slot {
+    uint32_t sent;
+    uint16_t pid;
+    uint16_t used;
+} MqttSlot;
+
+typedef struct _mqtt_inflight {
+    uint16_t size;
+    uint16_t count;
+    uint16_t next_pid;
+    uint16_t pad;
+    MqttSlot slots[];
+} MqttInflight;
+
+#define MQTT_INFLIGHT(o) ((MqttInflight*)PSEQUENCE_BYTES(o))
+#define IS_MQTT_INFLIGHT(o) (PTYPE(o) == PBYTEARRAY && PSEQUENCE_ELEMENTS(o) >= (int32_t)sizeof(MqttInflight) \
+    && PSEQUENCE_ELEMENTS(o) == (int32_t)(sizeof(MqttInflight) + MQTT_INFLIGHT(o)->size * sizeof(MqttSlot)))
+
+// a packet being written: data from MQTT_MAX_HEAD, pos past the last byte written, -1 once out of room
+typedef struct _mqtt_writer {
+    uint8_t *buf;
+    int32_t size;
+    int32_t pos;
+} MqttWriter;
+
+static void mqtt_put(MqttWriter *w, const uint8_t *data, int32_t len)
+{
+    if (w->pos < 0 || w->pos + len > w->size) {
+        w->pos = -1;
+        return;
+    }
+    memcpy(w->buf + w->pos, data, len);
+    w->pos += len;
+}
+
+static void mqtt_put_byte(MqttWriter *w, uint8_t b)
+{
+    mqtt_put(w, &b, 1);
+}
+
+static void mqtt_put_u16(MqttWriter *w, uint32_t v)
+{
+    uint8_t b[2];
+
+    b[0] = v >> 8;
+    b[1] = v;
+    mqtt_put(w, b, 2);
+}
+
+// UTF-8 string or binary data: two bytes of length and the bytes
+static void mqtt_put_str(MqttWriter *w, const uint8_t *s, int32_t len)
+{
+    if (len > 0xffff) {
+        w->pos = -1;
+        return;
+    }
+    mqtt_put_u16(w, len);
+    mqtt_put(w, s, len);
+}
+
+static int mqtt_varint(uint32_t v, uint8_t *out)
+{
+    int n = 0;
+
+    do {
+        out[n] = v & 0x7f;
+        v >>= 7;
+        if (v)
+            out[n] |= 0x80;
+        n++;
+    } while (v);
+    return n;
+}
+
+// completes the packet with its fixed header: returns its length, -1 if it does not fit
+static int32_t mqtt_finish(MqttWriter *w, uint8_t type, uint32_t extra)
+{
+    uint8_t head[MQTT_MAX_HEAD];
+    uint32_t rl;
+    int n;
+
+    if (w->pos < 0)
+        return -1;
+    rl = w->pos - MQTT_MAX_HEAD + extra;
+    if (rl > MQTT_MAX_LEN)
+        return -1;
+    head[0] = type;
+    n = 1 + mqtt_varint(rl, head + 1);
+    memmove(w->buf + n, w->buf + MQTT_MAX_HEAD, w->pos - MQTT_MAX_HEAD);
+    memcpy(w->buf, head, n);
+    return w->pos - MQTT_MAX_HEAD + n;
+}
+
+static int mqtt_writer(MqttWriter *w, PObject *buf)
+{
+    if (PTYPE(buf) != PBYTEARRAY || PSEQUENCE_ELEMENTS(buf) < MQTT_MAX_HEAD)
+        return 0;
+    w->buf = PSEQUENCE_BYTES(buf);
+    w->size = PSEQUENCE_ELEMENTS(buf);
+    w->pos = MQTT_MAX_HEAD;
+    return 1;
+}
+
+// an optional string argument: None gives len -1
+static int mqtt_opt_str(PObject *o, uint8_t **s, int32_t *len)
+{
+    if (o == MAKE_NONE()) {
+        *s = NULL;
+        *len = -1;
+        return 1;
+    }
+    return pyarg_bytes(o, s, len);
+}
+
+// matches topic against filter, with the single level + and multi level # wildcards
+static int mqtt_match(const uint8_t *f, int32_t flen, const uint8_t *t, int32_t tlen)
+{
+    int32_t i = 0, j = 0;
+
+    // topics starting with $ are not matched by filters starting with a wildcard
+    if (tlen && t[0] == '$' && flen && (f[0] == '+' || f[0] == '#'))
+        return 0;
+    while (i < flen) {
+        if (f[i] == '#')
+            return 1;
+        if (f[i] == '+') {
+            while (j < tlen && t[j] != '/')
+                j++;
+            i++;
+        } else {
+            if (j >= tlen) {
+                // "a/#" matches "a" too
+                return (i + 2 == flen && f[i] == '/' && f[i + 1] == '#');
+            }
+            if (f[i] != t[j])
+                return 0;
+            i++;
+            j++;
+        }
+    }
+    return j == tlen;
+}
+
+/*
+ * args: buf, version, client id, keepalive, clean, user, password, will topic, will message, will qos, will retain,
+ *       session expiry
+ * encodes a CONNECT packet into buf and returns its length. user, password and the will topic can be None.
+ * session expiry, in seconds, is sent only by version 5
+ */
+C_NATIVE(_mqtt_connect)
+{
+    C_NATIVE_UNWARN();
+    MqttWriter w;
+    int32_t version, keepalive, clean, idlen, ulen, pwlen, wtlen, wmlen, wqos, wretain, expiry;
+    uint8_t *id, *user, *pw, *wt, *wm, flags, b[4];
+
+    if (nargs != 12 || !mqtt_writer(&w, args[0]) || !PYARG_INT(1, version) || !PYARG_BYTES(2, id, idlen)
+        || !PYARG_INT(3, keepalive) || !PYARG_INT(4, clean) || !mqtt_opt_str(args[5], &user, &ulen)
+        || !mqtt_opt_str(args[6], &pw, &pwlen) || !mqtt_opt_str(args[7], &wt, &wtlen)
+        || !mqtt_opt_str(args[8], &wm, &wmlen) || !PYARG_INT(9, wqos) || !PYARG_INT(10, wretain)
+        || !PYARG_INT(11, expiry))
+        return ERR_TYPE_EXC;
+    if ((version != MQTT_V311 && version != MQTT_V5) || keepalive < 0 || keepalive > 0xffff || wqos < 0 || wqos > 2)
+        return ERR_VALUE_EXC;
+    flags = clean ? 0x02 : 0;
+    if (wtlen >= 0) {
+        flags |= 0x04 | (wqos << 3) | (wretain ? 0x20 : 0);
+        if (wmlen < 0)
+            wmlen = 0;
+    }
+    if (ulen >= 0)
+        flags |= 0x80;
+    if (pwlen >= 0)
+        flags |= 0x40;
+
+    mqtt_put_str(&w, (const uint8_t*)"MQTT", 4);
+    mqtt_put_byte(&w, version);
+    mqtt_put_byte(&w, flags);
+    mqtt_put_u16(&w, keepalive);
+    if (version == MQTT_V5) {
+        if (expiry) {
+            mqtt_put_byte(&w, 5);
+            mqtt_put_byte(&w, 0x11);
+            b[0] = expiry >> 24;
+            b[1] = expiry >> 16;
+            b[2] = expiry >> 8;
+            b[3] = expiry;
+            mqtt_put(&w, b, 4);
+        } else
+            mqtt_put_byte(&w, 0);
+    }
+    mqtt_put_str(&w, id, idlen);
+    if (wtlen >= 0) {
+        if (version == MQTT_V5)
+            mqtt_put_byte(&w, 0);
+        mqtt_put_str(&w, wt, wtlen);
+        mqtt_put_str(&w, wm, wmlen);
+    }
+    if (ulen >= 0)
+        mqtt_put_str(&w, user, ulen);
+    if (pwlen >= 0)
+        mqtt_put_str(&w, pw, pwlen);
+    if ((w.pos = mqtt_finish(&w, MQTT_CONNECT, 0)) < 0)
+        return ERR_VALUE_EXC;
+    *res = PSMALLINT_NEW(w.pos);
+    return ERR_OK;
+}
+
+/*
+ * args: buf, topic, packet id, flags, payload length, version
+ * encodes the head of a PUBLISH packet, up to the payload, into buf and returns its length. flags are the low
+ * nibble of the fixed header: dup << 3 | qos << 1 | retain. The packet id is sent only for qos > 0
+ */
+C_NATIVE(_mqtt_publish)
+{
+    C_NATIVE_UNWARN();
+    MqttWriter w;
+    uint8_t *topic;
+    int32_t tlen, pid, flags, plen, version, n;
+
+    if (nargs != 6 || !mqtt_writer(&w, args[0]) || !PYARG_BYTES(1, topic, tlen) || !PYARG_INT(2, pid)
+        || !PYARG_INT(3, flags) || !PYARG_INT(4, plen) || !PYARG_INT(5, version))
+        return ERR_TYPE_EXC;
+    if (flags < 0 || flags > 15 || (flags & 6) == 6 || plen < 0)
+        return ERR_VALUE_EXC;
+    mqtt_put_str(&w, topic, tlen);
+    if (flags & 6)
+        mqtt_put_u16(&w, pid);
+    if (version == MQTT_V5)
+        mqtt_put_byte(&w, 0);
+    if ((n = mqtt_finish(&w, MQTT_PUBLISH | flags, plen)) < 0)
+        return ERR_VALUE_EXC;
+    *res = PSMALLINT_NEW(n);
+    return ERR_OK;
+}
+
+/*
+ * args: buf, packet id, filters, qos, version
+ * encodes a SUBSCRIBE packet for the list or tuple of topic filters, all with qos, into buf and returns its length.
+ * A negative qos encodes an UNSUBSCRIBE packet
+ */
+C_NATIVE(_mqtt_subscribe)
+{
+    C_NATIVE_UNWARN();
+    MqttWriter w;
+    PObject *filters, *f;
+    int32_t pid, qos, version, i, n;
+
+    if (nargs != 5 || !mqtt_writer(&w, args[0]) || !PYARG_INT(1, pid) || !PYARG_INT(3, qos) || !PYARG_INT(4, version))
+        return ERR_TYPE_EXC;
+    filters = args[2];
+    if (PTYPE(filters) != PLIST && PTYPE(filters) != PTUPLE)
+        return ERR_TYPE_EXC;
+    if (!PSEQUENCE_ELEMENTS(filters) || qos > 2)
+        return ERR_VALUE_EXC;
+    mqtt_put_u16(&w, pid);
+    if (version == MQTT_V5)
+        mqtt_put_byte(&w, 0);
+    for (i = 0; i < PSEQUENCE_ELEMENTS(filters); i++) {
+        f = PSEQUENCE_OBJECTS(filters)[i];
+        if (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(f)))
+            return ERR_TYPE_EXC;
+        mqtt_put_str(&w, PSEQUENCE_BYTES(f), PSEQUENCE_ELEMENTS(f));
+        if (qos >= 0)
+            mqtt_put_byte(&w, qos);
+    }
+    if ((n = mqtt_finish(&w, (qos >= 0) ? MQTT_SUBSCRIBE : MQTT_UNSUBSCRIBE, 0)) < 0)
+        return ERR_VALUE_EXC;
+    *res = PSMALLINT_NEW(n);
+    return ERR_OK;
+}
+
+/*
+ * args: buf, n, flags, version
+ * decodes the body of a PUBLISH packet in the first n bytes of buf, flags being the low nibble of its fixed header.
+ * The payload is moved to the start of buf, so that it can be handed on in buf itself.
+ * Returns (topic, packet id, payload length), the packet id 0 for qos 0
+ */
+C_NATIVE(_mqtt_publish_parse)
+{
+    C_NATIVE_UNWARN();
+    uint8_t *buf, *topic;
+    int32_t size, n, flags, version, tlen, pos, pid = 0, plen, shift;
+    uint32_t props = 0;
+    PTuple *pt;
+
+    if (nargs != 4 || PTYPE(args[0]) != PBYTEARRAY || !PYARG_BYTES(0, buf, size) || !PYARG_INT(1, n)
+        || !PYARG_INT(2, flags) || !PYARG_INT(3, version))
+        return ERR_TYPE_EXC;
+    if (n < 2 || n > size)
+        return ERR_VALUE_EXC;
+    tlen = (buf[0] << 8) | buf[1];
+    pos = 2 + tlen;
+    if (flags & 6)
+        pos += 2;
+    if (pos > n)
+        return ERR_VALUE_EXC;
+    if (flags & 6)
+        pid = (buf[pos - 2] << 8) | buf[pos - 1];
+    if (version == MQTT_V5) {
+        // properties length, then the properties skipped
+        shift = 0;
+        do {
+            if (pos >= n || shift > 21)
+                return ERR_VALUE_EXC;
+            props |= (buf[pos] & 0x7f) << shift;
+            shift += 7;
+        } while (buf[pos++] & 0x80);
+        if (props > (uint32_t)(n - pos))
+            return ERR_VALUE_EXC;
+        pos += props;
+    }
+    topic = (uint8_t*)pstring_new(tlen, buf + 2);
+    plen = n - pos;
+    memmove(buf, buf + pos, plen);
+    pt = ptuple_new(3, NULL);
+    PTUPLE_SET_ITEM(pt, 0, topic);
+    PTUPLE_SET_ITEM(pt, 1, PSMALLINT_NEW(pid));
+    PTUPLE_SET_ITEM(pt, 2, PSMALLINT_NEW(plen));
+    *res = (PObject*)pt;
+    return ERR_OK;
+}
+
+/*
+ * args: filters, topic
+ * returns a bitmask of the filters, a list or tuple of at most 30, matching topic
+ */
+C_NATIVE(_mqtt_matches)
+{
+    C_NATIVE_UNWARN();
+    PObject *filters, *f;
+    uint8_t *topic;
+    int32_t tlen, i, mask = 0;
+
+    if (nargs != 2 || !PYARG_BYTES(1, topic, tlen))
+        return ERR_TYPE_EXC;
+    filters = args[0];
+    if (PTYPE(filters) != PLIST && PTYPE(filters) != PTUPLE)
+        return ERR_TYPE_EXC;
+    if (PSEQUENCE_ELEMENTS(filters) > 30)
+        return ERR_VALUE_EXC;
+    for (i = 0; i < PSEQUENCE_ELEMENTS(filters); i++) {
+        f = PSEQUENCE_OBJECTS(filters)[i];
+        if (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(f)))
+            return ERR_TYPE_EXC;
+        if (mqtt_match(PSEQUENCE_BYTES(f), PSEQUENCE_ELEMENTS(f), topic, tlen))
+            mask |= (1 << i);
+    }
+    *res = PSMALLINT_NEW(mask);
+    return ERR_OK;
+}
+
+/*
+ * args: size
+ * returns an empty table of size inflight messages
+ */
+C_NATIVE(_mqtt_inflight_new)
+{
+    C_NATIVE_UNWARN();
+    int32_t size, bytes;
+    PObject *state;
+    MqttInflight *inf;
+
+    if (nargs != 1 || !PYARG_INT(0, size))
+        return ERR_TYPE_EXC;
+    if (size <= 0 || size > MQTT_MAX_INFLIGHT)
+        return ERR_VALUE_EXC;
+    bytes = sizeof(MqttInflight) + size * sizeof(MqttSlot);
+    state = (PObject*)psequence_new(PBYTEARRAY, bytes);
+    PSEQUENCE_ELEMENTS_SET(state, bytes);
+    memset(PSEQUENCE_BYTES(state), 0, bytes);
+    inf = MQTT_INFLIGHT(state);
+    inf->size = size;
+    inf->next_pid = 1;
+    *res = state;
+    return ERR_OK;
+}
+
+/*
+ * args: table, now
+ * takes a free slot and a packet id not in flight for a message sent at now (milliseconds).
+ * Returns slot << 16 | packet id, -1 if the table is full
+ */
+C_NATIVE(_mqtt_inflight_add)
+{
+    C_NATIVE_UNWARN();
+    MqttInflight *inf;
+    int32_t now, i, free = -1;
+    uint16_t pid;
+
+    if (nargs != 2 || !IS_MQTT_INFLIGHT(args[0]) || !PYARG_INT(1, now))
+        return ERR_TYPE_EXC;
+    inf = MQTT_INFLIGHT(args[0]);
+    *res = PSMALLINT_NEW(-1);
+    if (inf->count >= inf->size)
+        return ERR_OK;
+    // packet ids cycle over 1..65535, skipping the ones still in flight
+    do {
+        pid = inf->next_pid++;
+        if (!inf->next_pid)
+            inf->next_pid = 1;
+        for (i = 0; i < inf->size; i++) {
+            if (inf->slots[i].used && inf->slots[i].pid == pid)
+                break;
+            if (!inf->slots[i].used && free < 0)
+                free = i;
+        }
+    } while (i < inf->size);
+    inf->slots[free].used = 1;
+    inf->slots[free].pid = pid;
+    inf->slots[free].sent = now;
+    inf->count++;
+    *res = PSMALLINT_NEW((free << 16) | pid);
+    return ERR_OK;
+}
+
+/*
+ * args: table, packet id
+ * frees the slot of the acknowledged packet id and returns it, -1 if the packet id is not in flight
+ */
+C_NATIVE(_mqtt_inflight_ack)
+{
+    C_NATIVE_UNWARN();
+    MqttInflight *inf;
+    int32_t pid, i;
+
+    if (nargs != 2 || !IS_MQTT_INFLIGHT(args[0]) || !PYARG_INT(1, pid))
+        return ERR_TYPE_EXC;
+    inf = MQTT_INFLIGHT(args[0]);
+    *res = PSMALLINT_NEW(-1);
+    for (i = 0; i < inf->size; i++) {
+        if (inf->slots[i].used && inf->slots[i].pid == pid) {
+            inf->slots[i].used = 0;
+            inf->count--;
+            *res = PSMALLINT_NEW(i);
+            break;
+        }
+    }
+    return ERR_OK;
+}
+
+/*
+ * args: table, now, timeout
+ * returns slot << 16 | packet id of the message in flight for longest, if it was sent at least timeout milliseconds
+ * before now, marking it as sent again at now; -1 if none is due
+ */
+C_NATIVE(_mqtt_inflight_due)
+{
+    C_NATIVE_UNWARN();
+    MqttInflight *inf;
+    int32_t now, timeout, i, oldest = -1;
+    uint32_t age, maxage = 0;
+
+    if (nargs != 3 || !IS_MQTT_INFLIGHT(args[0]) || !PYARG_INT(1, now) || !PYARG_INT(2, timeout))
+        return ERR_TYPE_EXC;
+    if (timeout <= 0)
+        return ERR_VALUE_EXC;
+    inf = MQTT_INFLIGHT(args[0]);
+    for (i = 0; i < inf->size; i++) {
+        if (!inf->slots[i].used)
+            continue;
+        age = (uint32_t)now - inf->slots[i].sent;
+        if (age >= (uint32_t)timeout && (oldest < 0 || age > maxage)) {
+            oldest = i;
+            maxage = age;
+        }
+    }
+    if (oldest >= 0) {
+        inf->slots[oldest].sent = now;
+        *res = PSMALLINT_NEW((oldest << 16) | inf->slots[oldest].pid);
+    } else
+        *res = PSMALLINT_NEW(-1);
+    return ERR_OK;
+}
+
+/*
+ * args: table
+ * returns the number of messages in flight
+ */
+C_NATIVE(_mqtt_inflight_count)
+{
+    C_NATIVE_UNWARN();
+    if (nargs != 1 || !IS_MQTT_INFLIGHT(args[0]))
+        return ERR_TYPE_EXC;
+    *res = PSMALLINT_NEW(MQTT_INFLIGHT(args[0])->count);
+    return ERR_OK;
+}
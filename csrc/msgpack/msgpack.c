@@ -0,0 +1,409 @@
+#include "zerynth.h"
+
+// nesting of arrays and maps accepted by pack and unpack
+#ifndef MSGPACK_MAX_DEPTH
+#define MSGPACK_MAX_DEPTH 32
+#endif
+
+// maximum size of a pack result (a bytearray)
+#define MSGPACK_OUT_MAX 0xffff
+
+// errors of mp_pack
+#define MP_ERR_TYPE     -1  // not serializable
+#define MP_ERR_SPACE    -2  // output buffer too small
+
+// ExtType class and the names of its attributes, set by msgpack_init
+PObject *ExtClass;
+int extcode,extdata;
+
+C_NATIVE(msgpack_init){
+    C_NATIVE_UNWARN();
+    ExtClass = args[0];
+    extcode = PSMALLINT_VALUE(args[1]);
+    extdata = PSMALLINT_VALUE(args[2]);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/**
+ * Output of pack. With buf==NULL bytes are only counted, otherwise they are
+ * written to buf, failing if more than size bytes are needed.
+ */
+typedef struct _mp_out {
+    uint8_t *buf;
+    uint32_t len;
+    uint32_t size;
+} MpOut;
+
+static int mp_write(MpOut *out, uint8_t *data, uint32_t n){
+    if (out->buf) {
+        if (out->len+n>out->size) return MP_ERR_SPACE;
+        memcpy(out->buf+out->len,data,n);
+    }
+    out->len+=n;
+    return 0;
+}
+
+/**
+ * Writes the type byte c followed by the n lowest bytes of v, big endian.
+ */
+static int mp_head(MpOut *out, uint8_t c, uint64_t v, int n){
+    uint8_t h[9];
+    int i;
+
+    h[0] = c;
+    for(i=n;i>0;i--){
+        h[i] = v&0xff;
+        v>>=8;
+    }
+    return mp_write(out,h,n+1);
+}
+
+/**
+ * Writes the head of a str, bin, array or map of len elements: fix is the
+ * fixed format byte (0 if none) with its maximum length, c8 the type byte
+ * of the 8 bit length format (0 if none) and c16 the one of the 16 bit
+ * length format, followed by the 32 bit one.
+ */
+static int mp_len_head(MpOut *out, uint8_t fix, uint32_t fixmax, uint8_t c8, uint8_t c16, uint32_t len){
+    if (fix && len<=fixmax) return mp_head(out,fix|len,0,0);
+    if (c8 && len<=0xff) return mp_head(out,c8,len,1);
+    if (len<=0xffff) return mp_head(out,c16,len,2);
+    return mp_head(out,c16+1,len,4);
+}
+
+/**
+ * Writes an ExtType instance: fixext for data of 1, 2, 4, 8 or 16 bytes,
+ * ext 8/16/32 otherwise.
+ */
+static int mp_pack_ext(MpOut *out, PInstance *o){
+    PObject *code = phash_get(o->dict,PSMALLINT_NEW(extcode));
+    PObject *data = phash_get(o->dict,PSMALLINT_NEW(extdata));
+    uint32_t n;
+    uint8_t t;
+    int r;
+
+    if (!code || !data || !IS_PSMALLINT(code) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(data))) return MP_ERR_TYPE;
+    if (PSMALLINT_VALUE(code)<-128 || PSMALLINT_VALUE(code)>127) return MP_ERR_TYPE;
+    t = PSMALLINT_VALUE(code);
+    n = PSEQUENCE_ELEMENTS(data);
+    switch(n){
+        case 1: r = mp_head(out,0xd4,t,1); break;
+        case 2: r = mp_head(out,0xd5,t,1); break;
+        case 4: r = mp_head(out,0xd6,t,1); break;
+        case 8: r = mp_head(out,0xd7,t,1); break;
+        case 16: r = mp_head(out,0xd8,t,1); break;
+        default:
+            if (n<=0xff) r = mp_head(out,0xc7,(n<<8)|t,2);
+            else if (n<=0xffff) r = mp_head(out,0xc8,(n<<8)|t,3);
+            else r = mp_head(out,0xc9,((uint64_t)n<<8)|t,5);
+    }
+    if (r<0) return r;
+    return mp_write(out,PSEQUENCE_BYTES(data),n);
+}
+
+/**
+ * Packs o into out. Returns 0 or an MP_ERR_* code.
+ */
+static int mp_pack(MpOut *out, PObject *o, int depth){
+    int i,n,r;
+    int64_t v;
+    union {
+        float f;
+        uint32_t u;
+    } fu;
+    union {
+        double d;
+        uint64_t u;
+    } du;
+
+    if (depth>MSGPACK_MAX_DEPTH) return MP_ERR_TYPE;
+    switch(PTYPE(o)){
+        case PSMALLINT:
+        case PINTEGER:
+            v = INTEGER_VALUE(o);
+            if (v>=0) {
+                if (v<=0x7f) return mp_head(out,v,0,0);
+                if (v<=0xff) return mp_head(out,0xcc,v,1);
+                if (v<=0xffff) return mp_head(out,0xcd,v,2);
+                if (v<=0xffffffffLL) return mp_head(out,0xce,v,4);
+                return mp_head(out,0xcf,v,8);
+            }
+            if (v>=-32) return mp_head(out,v&0xff,0,0);
+            if (v>=-128) return mp_head(out,0xd0,v,1);
+            if (v>=-32768) return mp_head(out,0xd1,v,2);
+            if (v>=-2147483648LL) return mp_head(out,0xd2,v,4);
+            return mp_head(out,0xd3,v,8);
+        case PFLOAT:
+            //float 32 if it holds the value exactly (NaN included), float 64 otherwise
+            fu.f = FLOAT_VALUE(o);
+            if ((FLOAT_TYPE)fu.f==FLOAT_VALUE(o) || FLOAT_VALUE(o)!=FLOAT_VALUE(o)) return mp_head(out,0xca,fu.u,4);
+            du.d = FLOAT_VALUE(o);
+            return mp_head(out,0xcb,du.u,8);
+        case PBOOL:
+            return mp_head(out,(o==PBOOL_TRUE()) ? 0xc3:0xc2,0,0);
+        case PNONE:
+            return mp_head(out,0xc0,0,0);
+        case PSTRING:
+            n = PSEQUENCE_ELEMENTS(o);
+            if ((r=mp_len_head(out,0xa0,31,0xd9,0xda,n))<0) return r;
+            return mp_write(out,PSEQUENCE_BYTES(o),n);
+        case PBYTES:
+        case PBYTEARRAY:
+            n = PSEQUENCE_ELEMENTS(o);
+            if ((r=mp_len_head(out,0,0,0xc4,0xc5,n))<0) return r;
+            return mp_write(out,PSEQUENCE_BYTES(o),n);
+        case PSHORTS:
+        case PSHORTARRAY:
+            n = PSEQUENCE_ELEMENTS(o);
+            if ((r=mp_len_head(out,0x90,15,0,0xdc,n))<0) return r;
+            for(i=0;i<n;i++){
+                if ((r=mp_pack(out,PSMALLINT_NEW(PSEQUENCE_SHORTS(o)[i]),depth+1))<0) return r;
+            }
+            return 0;
+        case PLIST:
+        case PTUPLE:
+            n = PSEQUENCE_ELEMENTS(o);
+            if ((r=mp_len_head(out,0x90,15,0,0xdc,n))<0) return r;
+            for(i=0;i<n;i++){
+                if ((r=mp_pack(out,PSEQUENCE_OBJECTS(o)[i],depth+1))<0) return r;
+            }
+            return 0;
+        case PDICT:
+            n = PHASH_ELEMENTS(o);
+            if ((r=mp_len_head(out,0x80,15,0,0xde,n))<0) return r;
+            for(i=0;i<n;i++){
+                HashEntry *h = phash_getentry((PHash*)o,i);
+                if ((r=mp_pack(out,h->key,depth+1))<0) return r;
+                if ((r=mp_pack(out,h->value,depth+1))<0) return r;
+            }
+            return 0;
+        case PINSTANCE:
+            if ((PObject*)((PInstance*)o)->base==ExtClass) return mp_pack_ext(out,(PInstance*)o);
+            break;
+    }
+    return MP_ERR_TYPE;
+}
+
+C_NATIVE(msgpack_pack){
+    C_NATIVE_UNWARN();
+    MpOut out;
+
+    //count the bytes, then write them in a bytearray of the right size
+    out.buf = NULL;
+    out.len = 0;
+    if (mp_pack(&out,args[0],0)<0) return ERR_TYPE_EXC;
+    if (out.len>MSGPACK_OUT_MAX) return ERR_OVERFLOW_EXC;
+    *res = (PObject*)psequence_new(PBYTEARRAY,out.len);
+    out.buf = PSEQUENCE_BYTES(*res);
+    out.size = out.len;
+    out.len = 0;
+    mp_pack(&out,args[0],0);
+    PSEQUENCE_ELEMENTS_SET(*res,out.len);
+    return ERR_OK;
+}
+
+/*
+ * args: buffer, offset, obj
+ * returns the number of bytes written in buffer from offset
+ */
+C_NATIVE(msgpack_pack_into){
+    C_NATIVE_UNWARN();
+    MpOut out;
+    int32_t offs;
+    int r;
+
+    if (nargs!=3 || PTYPE(args[0])!=PBYTEARRAY || !IS_PSMALLINT(args[1])) return ERR_TYPE_EXC;
+    offs = PSMALLINT_VALUE(args[1]);
+    if (offs<0 || offs>PSEQUENCE_ELEMENTS(args[0])) return ERR_INDEX_EXC;
+    out.buf = PSEQUENCE_BYTES(args[0])+offs;
+    out.size = PSEQUENCE_ELEMENTS(args[0])-offs;
+    out.len = 0;
+    r = mp_pack(&out,args[2],0);
+    if (r==MP_ERR_SPACE) return ERR_INDEX_EXC;
+    if (r<0) return ERR_TYPE_EXC;
+    *res = PSMALLINT_NEW(out.len);
+    return ERR_OK;
+}
+
+
+/**
+ * Input of unpack.
+ */
+typedef struct _mp_in {
+    uint8_t *buf;
+    uint32_t pos;
+    uint32_t len;
+    int slices;     // bin payloads are returned as slices of buf instead of copies
+} MpIn;
+
+/**
+ * Reads an n bytes big endian unsigned integer. Returns -1 if data is missing.
+ */
+static int mp_read(MpIn *in, int n, uint64_t *v){
+    if (in->pos+n>in->len) return -1;
+    *v = 0;
+    while(n--) *v = (*v<<8)|in->buf[in->pos++];
+    return 0;
+}
+
+static PObject *mp_int(int64_t v){
+    if (v>-1073741824 && v<1073741824) return PSMALLINT_NEW(v);
+    return (PObject*)pinteger_new(v);
+}
+
+/**
+ * Decodes the object at in->pos. Returns NULL on bad or unsupported data.
+ */
+static PObject *mp_unpack(MpIn *in, int depth){
+    PObject *o,*k,*val;
+    uint64_t v;
+    uint32_t n,i;
+    uint8_t c;
+    union {
+        float f;
+        uint32_t u;
+    } fu;
+    union {
+        double d;
+        uint64_t u;
+    } du;
+
+    if (depth>MSGPACK_MAX_DEPTH || in->pos>=in->len) return NULL;
+    c = in->buf[in->pos++];
+
+    if (c<=0x7f) return PSMALLINT_NEW(c);
+    if (c>=0xe0) return PSMALLINT_NEW((int8_t)c);
+    if (c>=0xa0 && c<=0xbf) {
+        n = c&0x1f;
+        goto str;
+    }
+    if (c>=0x90 && c<=0x9f) {
+        n = c&0x0f;
+        goto array;
+    }
+    if (c>=0x80 && c<=0x8f) {
+        n = c&0x0f;
+        goto map;
+    }
+    switch(c){
+        case 0xc0: return MAKE_NONE();
+        case 0xc2: return PBOOL_FALSE();
+        case 0xc3: return PBOOL_TRUE();
+        case 0xcc: case 0xcd: case 0xce:
+            if (mp_read(in,1<<(c-0xcc),&v)<0) return NULL;
+            return mp_int(v);
+        case 0xcf:
+            if (mp_read(in,8,&v)<0 || v>(uint64_t)INT64_MAX) return NULL;
+            return mp_int(v);
+        case 0xd0:
+            if (mp_read(in,1,&v)<0) return NULL;
+            return PSMALLINT_NEW((int8_t)v);
+        case 0xd1:
+            if (mp_read(in,2,&v)<0) return NULL;
+            return PSMALLINT_NEW((int16_t)v);
+        case 0xd2:
+            if (mp_read(in,4,&v)<0) return NULL;
+            return mp_int((int32_t)v);
+        case 0xd3:
+            if (mp_read(in,8,&v)<0) return NULL;
+            return mp_int((int64_t)v);
+        case 0xca:
+            if (mp_read(in,4,&v)<0) return NULL;
+            fu.u = v;
+            return (PObject*)pfloat_new(fu.f);
+        case 0xcb:
+            if (mp_read(in,8,&v)<0) return NULL;
+            du.u = v;
+            return (PObject*)pfloat_new(du.d);
+        case 0xd9: case 0xda: case 0xdb:
+            if (mp_read(in,1<<(c-0xd9),&v)<0) return NULL;
+            n = v;
+            goto str;
+        case 0xc4: case 0xc5: case 0xc6:
+            if (mp_read(in,1<<(c-0xc4),&v)<0) return NULL;
+            n = v;
+            if (n>0xffff || in->pos+n>in->len) return NULL;
+            if (in->slices)
+                o = (PObject*)pslice_new(PSMALLINT_NEW(in->pos),PSMALLINT_NEW(in->pos+n),PSMALLINT_NEW(1));
+            else
+                o = (PObject*)pbytes_new(n,in->buf+in->pos);
+            in->pos+=n;
+            return o;
+        case 0xdc: case 0xdd:
+            if (mp_read(in,(c==0xdc) ? 2:4,&v)<0) return NULL;
+            n = v;
+            goto array;
+        case 0xde: case 0xdf:
+            if (mp_read(in,(c==0xde) ? 2:4,&v)<0) return NULL;
+            n = v;
+            goto map;
+        case 0xd4: case 0xd5: case 0xd6: case 0xd7: case 0xd8:
+            n = 1<<(c-0xd4);
+            goto ext;
+        case 0xc7: case 0xc8: case 0xc9:
+            if (mp_read(in,1<<(c-0xc7),&v)<0) return NULL;
+            n = v;
+            goto ext;
+    }
+    //reserved bytes
+    return NULL;
+
+ext:
+    if (mp_read(in,1,&v)<0 || n>0xffff || in->pos+n>in->len) return NULL;
+    o = pinstance_new(ExtClass);
+    phash_put(((PInstance*)o)->dict,PSMALLINT_NEW(extcode),PSMALLINT_NEW((int8_t)v));
+    phash_put(((PInstance*)o)->dict,PSMALLINT_NEW(extdata),(PObject*)pbytes_new(n,in->buf+in->pos));
+    in->pos+=n;
+    return o;
+
+str:
+    if (n>0xffff || in->pos+n>in->len) return NULL;
+    o = (PObject*)pstring_new(n,in->buf+in->pos);
+    in->pos+=n;
+    return o;
+
+array:
+    //each element takes at least a byte: don't allocate for more than the data can hold
+    if (n>0xffff || n>in->len-in->pos) return NULL;
+    o = (PObject*)plist_new(n,NULL);
+    for(i=0;i<n;i++){
+        val = mp_unpack(in,depth+1);
+        if (!val) return NULL;
+        PLIST_SET_ITEM(o,i,val);
+    }
+    return o;
+
+map:
+    if (n>0xffff || 2*n>in->len-in->pos) return NULL;
+    o = (PObject*)pdict_new(n);
+    for(i=0;i<n;i++){
+        k = mp_unpack(in,depth+1);
+        if (!k) return NULL;
+        val = mp_unpack(in,depth+1);
+        if (!val) return NULL;
+        pdict_put(o,k,val);
+    }
+    return o;
+}
+
+/*
+ * args: data, offset, bin_slices
+ */
+C_NATIVE(msgpack_unpack){
+    C_NATIVE_UNWARN();
+    MpIn in;
+    int32_t offs;
+
+    if (nargs!=3 || parse_py_args("si", 2, args, &in.buf, &in.len, &offs) != 2)
+        return ERR_TYPE_EXC;
+    if (offs<0 || (uint32_t)offs>in.len) return ERR_INDEX_EXC;
+    in.pos = offs;
+    in.slices = (args[2]==PBOOL_TRUE());
+    *res = mp_unpack(&in,0);
+    if (!*res) {
+        *res = MAKE_NONE();
+        return ERR_VALUE_EXC;
+    }
+    return ERR_OK;
+}
@@ -0,0 +1,76 @@
+#include "zerynth.h"
+
+/*
+ * Access to the table of the native call latency profiler (zerynth_natprof.h).
+ * Without ZERYNTH_NATIVE_PROFILE the table does not exist and the results are empty.
+ */
+
+#if defined(ZERYNTH_NATIVE_PROFILE)
+// saturated to the VM integers
+static PObject *natprof_int(uint64_t v)
+{
+    uint64_t max = ((uint64_t)1 << (sizeof(INT_TYPE) * 8 - 1)) - 1;
+
+    if (v < 1073741824)
+        return PSMALLINT_NEW(v);
+    return (PObject*)pinteger_new((INT_TYPE)((v > max) ? max : v));
+}
+#endif
+
+/*
+ * no args: returns (natives, lost) where natives is a list of (name, count, errors, total us, max us, histogram)
+ * for every native called, with histogram a tuple counting the calls shorter than 16us, 32us, ... doubling,
+ * the last one unbounded; lost counts the calls of natives beyond the table
+ */
+C_NATIVE(__natprof_stats)
+{
+    C_NATIVE_UNWARN();
+    PTuple *out = ptuple_new(2, NULL);
+    PList *lst;
+    int32_t n = 0;
+
+    PTUPLE_SET_ITEM(out, 0, MAKE_NONE());
+    PTUPLE_SET_ITEM(out, 1, PSMALLINT_NEW(0));
+    *res = (PObject*)out;
+#if defined(ZERYNTH_NATIVE_PROFILE)
+    int32_t i, j;
+
+    for (n = 0; n < NATPROF_NATIVES && natprof_stats[n].name; n++);
+    lst = plist_new(n, NULL);
+    PTUPLE_SET_ITEM(out, 0, lst);
+    PTUPLE_SET_ITEM(out, 1, natprof_int(natprof_lost));
+    for (i = 0; i < n; i++) {
+        NatProfStats *st = &natprof_stats[i];
+        PTuple *tpl = ptuple_new(6, NULL);
+        PTuple *hist;
+        PLIST_SET_ITEM(lst, i, tpl);
+        PTUPLE_SET_ITEM(tpl, 0, pstring_new(strlen(st->name), (uint8_t*)st->name));
+        PTUPLE_SET_ITEM(tpl, 1, natprof_int(st->count));
+        PTUPLE_SET_ITEM(tpl, 2, natprof_int(st->errors));
+        PTUPLE_SET_ITEM(tpl, 3, natprof_int(st->total));
+        PTUPLE_SET_ITEM(tpl, 4, natprof_int(st->max));
+        hist = ptuple_new(NATPROF_BUCKETS, NULL);
+        PTUPLE_SET_ITEM(tpl, 5, hist);
+        for (j = 0; j < NATPROF_BUCKETS; j++)
+            PTUPLE_SET_ITEM(hist, j, PSMALLINT_NEW(st->hist[j]));
+    }
+#else
+    lst = plist_new(n, NULL);
+    PTUPLE_SET_ITEM(out, 0, lst);
+#endif
+    return ERR_OK;
+}
+
+/*
+ * no args: clears the profiler table
+ */
+C_NATIVE(__natprof_reset)
+{
+    C_NATIVE_UNWARN();
+#if defined(ZERYNTH_NATIVE_PROFILE)
+    memset(natprof_stats, 0, sizeof(natprof_stats));
+    natprof_lost = 0;
+#endif
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
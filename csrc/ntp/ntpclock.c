@@ -0,0 +1,268 @@
+#include "zerynth.h"
+
+/*
+ * Wall clock disciplined by NTP samples, for ntpclient.NTPSync.
+ *
+ * The clock is the microsecond monotonic clock, scaled by a frequency correction and shifted by a base:
+ *     utc(m) = base_utc + (m - base_mono) * (1 + freq) + applied part of the slew
+ * Offsets below NTP_STEP are slewed, at most NTP_SLEW_PPM, so that ordinary corrections never make the clock jump
+ * nor go back; larger ones (the first sample, mostly) step it. Offsets are also integrated in freq (a phase locked loop), so that
+ * between samples the clock drifts less and less.
+ *
+ * Samples go through the clock filter of NTP: among the last NTP_FILTER ones, the one with the smallest round trip
+ * delay is the least disturbed by queues, and only a new minimum is applied.
+ * The packet buffer is the caller's and is reused, no object is allocated per sample.
+ */
+
+#define NTP_PKT         48
+#define NTP_UNIX_DELTA  2208988800ULL   // seconds from 1900 to 1970
+#define NTP_FILTER      8
+#define NTP_STEP        128000          // us
+#define NTP_SLEW_PPM    500
+#define NTP_MAX_PPB     500000
+#define NTP_FREQ_T      900000000LL     // us from a step to the first frequency measure
+#define NTP_PLL_T       2048000000LL    // us, time constant of the frequency correction
+
+#define NTP_SAMPLE      0
+#define NTP_SLEWED      1
+#define NTP_STEPPED     2
+
+typedef struct _ntp_sample {
+    int64_t offset;
+    int64_t delay;
+} NtpSample;
+
+static VSysTimer ntp_timer;
+static int64_t ntp_base_mono, ntp_base_utc;
+static int64_t ntp_slew, ntp_slew_start;   // slew still to apply, from ntp_slew_start
+static int32_t ntp_freq;                    // ppb
+static int64_t ntp_last_at;                 // monotonic micros of the last applied sample
+static int64_t ntp_step_at, ntp_step_sum;   // last step and corrections since, until freq is measured
+static uint8_t ntp_freq_set;
+static uint8_t ntp_synced;
+static uint8_t ntp_origin[8];               // transmit timestamp of the pending request
+static int64_t ntp_t1;
+static NtpSample ntp_samples[NTP_FILTER];
+static uint32_t ntp_count;
+
+// 64 bits monotonic micros: the 32 bits micros of the timer placed around its 64 bits millis
+static int64_t ntp_mono(void)
+{
+    uint64_t ms, approx;
+    uint32_t us;
+
+    if (!ntp_timer)
+        ntp_timer = vosTimerCreate();
+    ms = vosTimerReadMillis(ntp_timer);
+    us = vosTimerReadMicros(ntp_timer);
+    approx = ms * 1000;
+    return approx + (int32_t)(us - (uint32_t)approx);
+}
+
+static int64_t ntp_slew_applied(int64_t m)
+{
+    int64_t max = (m - ntp_slew_start) * NTP_SLEW_PPM / 1000000;
+
+    if (ntp_slew >= 0)
+        return (ntp_slew < max) ? ntp_slew : max;
+    return (-ntp_slew < max) ? ntp_slew : -max;
+}
+
+static int64_t ntp_utc(int64_t m)
+{
+    int64_t e = m - ntp_base_mono;
+    return ntp_base_utc + e + e * ntp_freq / 1000000000 + ntp_slew_applied(m);
+}
+
+// moves the base to m, keeping the clock where it is
+static void ntp_rebase(int64_t m)
+{
+    int64_t applied = ntp_slew_applied(m);
+
+    ntp_base_utc = ntp_utc(m);
+    ntp_base_mono = m;
+    ntp_slew -= applied;
+    ntp_slew_start = m;
+}
+
+static int64_t ntp_now(void)
+{
+    int64_t m = ntp_mono();
+
+    // keeps e * freq far from overflowing
+    if (m - ntp_base_mono > 3600000000LL)
+        ntp_rebase(m);
+    return ntp_utc(m);
+}
+
+static void ntp_put_ts(uint8_t *p, int64_t utc)
+{
+    uint64_t s = (uint64_t)(utc / 1000000) + NTP_UNIX_DELTA;
+    uint32_t frac = (uint32_t)(((uint64_t)(utc % 1000000) << 32) / 1000000);
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        p[i] = (uint8_t)(s >> (24 - 8 * i));
+        p[4 + i] = (uint8_t)(frac >> (24 - 8 * i));
+    }
+}
+
+static int64_t ntp_get_ts(const uint8_t *p)
+{
+    uint32_t s = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    uint32_t frac = ((uint32_t)p[4] << 24) | ((uint32_t)p[5] << 16) | ((uint32_t)p[6] << 8) | p[7];
+
+    // era 0 ends in 2036: later timestamps with the top bit clear belong to era 1
+    return ((int64_t)s + ((s & 0x80000000) ? 0 : 0x100000000LL) - (int64_t)NTP_UNIX_DELTA) * 1000000 +
+           (int64_t)(((uint64_t)frac * 1000000) >> 32);
+}
+
+static PObject *ntp_int(int64_t v)
+{
+    if (v > -1073741824 && v < 1073741824)
+        return PSMALLINT_NEW(v);
+    return (PObject*)pinteger_new(v);
+}
+
+/*
+ * args: pkt
+ * fills the bytearray pkt with a client request stamped with the current time
+ */
+C_NATIVE(_ntp_request) {
+    NATIVE_UNWARN();
+    uint8_t *p;
+
+    if (nargs != 1 || PTYPE(args[0]) != PBYTEARRAY || PSEQUENCE_ELEMENTS(args[0]) < NTP_PKT)
+        return ERR_TYPE_EXC;
+    p = PSEQUENCE_BYTES(args[0]);
+    memset(p, 0, NTP_PKT);
+    p[0] = 0x23;    // no leap warning, version 4, client
+    ntp_t1 = ntp_now();
+    ntp_put_ts(p + 40, ntp_t1);
+    memcpy(ntp_origin, p + 40, 8);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: pkt, n
+ * processes the n bytes of the server reply in pkt, to be called as soon as it is received.
+ * Returns NTP_STEPPED or NTP_SLEWED if the clock was corrected, NTP_SAMPLE if the sample was only filtered.
+ * ValueError if the reply does not match the last request or the server is not synchronized
+ */
+C_NATIVE(_ntp_response) {
+    NATIVE_UNWARN();
+    int64_t t4, m, t2, t3, offset, delay, dt;
+    NtpSample *s, *best;
+    uint8_t *p;
+    int i, n;
+
+    m = ntp_mono();
+    t4 = ntp_now();
+    if (nargs != 2 || PTYPE(args[0]) != PBYTEARRAY || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    p = PSEQUENCE_BYTES(args[0]);
+    n = PSMALLINT_VALUE(args[1]);
+    // server mode, not alarmed, stratum 1 to 15, answer to the last request
+    if (n < NTP_PKT || n > PSEQUENCE_ELEMENTS(args[0]) || (p[0] & 7) != 4 || (p[0] >> 6) == 3 ||
+        p[1] == 0 || p[1] > 15 || memcmp(p + 24, ntp_origin, 8))
+        return ERR_VALUE_EXC;
+    // a duplicate of the reply must not match again
+    memset(ntp_origin, 0, 8);
+    t2 = ntp_get_ts(p + 32);
+    t3 = ntp_get_ts(p + 40);
+    offset = ((t2 - ntp_t1) + (t3 - t4)) / 2;
+    delay = (t4 - ntp_t1) - (t3 - t2);
+    if (delay < 0)
+        delay = 0;
+    *res = PSMALLINT_NEW(NTP_SAMPLE);
+
+    // the clock filter: only a new minimum delay among the last samples is applied
+    s = &ntp_samples[ntp_count % NTP_FILTER];
+    s->offset = offset;
+    s->delay = delay;
+    ntp_count++;
+    best = s;
+    for (i = 0; i < NTP_FILTER && i < (int)ntp_count; i++) {
+        if (ntp_samples[i].delay < best->delay)
+            best = &ntp_samples[i];
+    }
+    if (best != s && ntp_synced)
+        return ERR_OK;
+
+    ntp_rebase(m);
+    if (!ntp_synced || offset > NTP_STEP || offset < -NTP_STEP) {
+        ntp_base_utc += offset;
+        ntp_slew = 0;
+        ntp_step_at = m;
+        ntp_step_sum = 0;
+        ntp_freq_set = 0;
+        *res = PSMALLINT_NEW(NTP_STEPPED);
+    } else if (!ntp_freq_set) {
+        // the first frequency is measured from the drift of a whole interval after the step, quicker than locking to it
+        ntp_slew = offset;
+        ntp_step_sum += offset;
+        dt = m - ntp_step_at;
+        if (dt >= NTP_FREQ_T) {
+            ntp_freq += (int32_t)(ntp_step_sum * 1000000000 / dt);
+            ntp_freq_set = 1;
+        }
+        *res = PSMALLINT_NEW(NTP_SLEWED);
+    } else {
+        ntp_slew = offset;
+        // the frequency integrates offsets as in the phase locked loop of NTP, filtering out the jitter of the delays
+        dt = m - ntp_last_at;
+        if (dt > 16 * NTP_PLL_T)
+            dt = 16 * NTP_PLL_T;
+        ntp_freq += (int32_t)(offset * dt / NTP_PLL_T * 1000000000 / NTP_PLL_T);
+        *res = PSMALLINT_NEW(NTP_SLEWED);
+    }
+    if (ntp_freq > NTP_MAX_PPB)
+        ntp_freq = NTP_MAX_PPB;
+    else if (ntp_freq < -NTP_MAX_PPB)
+        ntp_freq = -NTP_MAX_PPB;
+    ntp_synced = 1;
+    ntp_last_at = m;
+    return ERR_OK;
+}
+
+/*
+ * args: micros
+ * returns the disciplined time since 1970: microseconds if micros is true, else a tuple (seconds, microseconds)
+ */
+C_NATIVE(_ntp_now) {
+    NATIVE_UNWARN();
+    int64_t t = ntp_now();
+    PObject *tpl;
+
+    if (nargs != 1)
+        return ERR_TYPE_EXC;
+    if (args[0] == PBOOL_TRUE()) {
+        *res = ntp_int(t);
+        return ERR_OK;
+    }
+    tpl = (PObject*)ptuple_new(2, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, ntp_int(t / 1000000));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(t % 1000000));
+    *res = tpl;
+    return ERR_OK;
+}
+
+/*
+ * returns (synced, offset, delay, freq, slew): the offset and delay of the last sample and the slew still to apply
+ * in microseconds, the frequency correction in ppb
+ */
+C_NATIVE(_ntp_stats) {
+    NATIVE_UNWARN();
+    NtpSample *s = &ntp_samples[(ntp_count + NTP_FILTER - 1) % NTP_FILTER];
+    PObject *tpl;
+
+    tpl = (PObject*)ptuple_new(5, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, ntp_synced ? PBOOL_TRUE() : PBOOL_FALSE());
+    PTUPLE_SET_ITEM(tpl, 1, ntp_int(ntp_count ? s->offset : 0));
+    PTUPLE_SET_ITEM(tpl, 2, ntp_int(ntp_count ? s->delay : 0));
+    PTUPLE_SET_ITEM(tpl, 3, ntp_int(ntp_freq));
+    PTUPLE_SET_ITEM(tpl, 4, ntp_int(ntp_slew - ntp_slew_applied(ntp_mono())));
+    *res = tpl;
+    return ERR_OK;
+}
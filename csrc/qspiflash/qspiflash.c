@@ -3,6 +3,8 @@
 
 vhalQspiConf qspi_conf;
 vhalQspiFlashConf flash_conf;
+// serializes the accesses to the flash, since erases run without the GIL
+VSemaphore qspi_lock = NULL;
 
 
 C_NATIVE(qspiflash_init) {
@@ -53,6 +55,8 @@ C_NATIVE(qspiflash_init) {
     flash_conf.sr1_qe = sr1_qe;
     flash_conf.sr1_sus = sr1_sus;
 
+    if (!qspi_lock)
+        qspi_lock = vosMtxCreate();
     if (vhalQspiFlashInit(0, &qspi_conf, &flash_conf) != VHAL_OK) {
         return ERR_PERIPHERAL_ERROR_EXC;
     }
@@ -74,9 +78,15 @@ C_NATIVE(qspiflash_get_geometry) {
 
 C_NATIVE(qspiflash_done) {
     NATIVE_UNWARN();
-
-    /* Call the DeInit function to reset the driver */
-    if (vhalQspiFlashDone(0) != VHAL_OK) {
+    int err;
+
+    /* Call the DeInit function to reset the driver, after the erase in progress if any */
+    RELEASE_GIL();
+    vosMtxLock(qspi_lock);
+    err = vhalQspiFlashDone(0);
+    vosMtxUnlock(qspi_lock);
+    ACQUIRE_GIL();
+    if (err != VHAL_OK) {
         return ERR_PERIPHERAL_ERROR_EXC;
     }
     return ERR_OK;
@@ -86,18 +96,56 @@ C_NATIVE(qspiflash_read_data) {
     NATIVE_UNWARN();
 
     uint32_t readaddr, toread_len;
+    int err;
 
-    if (parse_py_args("ii", nargs, args, &readaddr, &toread_len) != 2) 
+    if (nargs < 2 || !PYARG_INT(0, readaddr) || !PYARG_INT(1, toread_len)) 
         return ERR_TYPE_EXC;
 
     *res = pbytes_new(toread_len, NULL);
-    if (vhalQspiFlashRead(0, readaddr, PSEQUENCE_BYTES(*res), toread_len) != VHAL_OK) {
+    RELEASE_GIL();
+    vosMtxLock(qspi_lock);
+    err = vhalQspiFlashRead(0, readaddr, PSEQUENCE_BYTES(*res), toread_len);
+    vosMtxUnlock(qspi_lock);
+    ACQUIRE_GIL();
+    if (err != VHAL_OK) {
         return ERR_PERIPHERAL_ERROR_EXC;
     };
 
     return ERR_OK;
 }
 
+/*
+ * args: addr, buffer, ofs, n
+ * reads n bytes at addr into the bytearray buffer starting at ofs
+ */
+C_NATIVE(qspiflash_read_into) {
+    NATIVE_UNWARN();
+
+    int32_t readaddr, ofs, toread_len, err;
+    PObject *buffer;
+
+    if (nargs != 4 || !IS_PSMALLINT(args[0]) || PTYPE(args[1]) != PBYTEARRAY || !IS_PSMALLINT(args[2]) || !IS_PSMALLINT(args[3]))
+        return ERR_TYPE_EXC;
+    readaddr = PSMALLINT_VALUE(args[0]);
+    buffer = args[1];
+    ofs = PSMALLINT_VALUE(args[2]);
+    toread_len = PSMALLINT_VALUE(args[3]);
+    if (readaddr < 0 || ofs < 0 || toread_len < 0 || ofs + toread_len > PSEQUENCE_ELEMENTS(buffer))
+        return ERR_INDEX_EXC;
+
+    RELEASE_GIL();
+    vosMtxLock(qspi_lock);
+    err = vhalQspiFlashRead(0, readaddr, PSEQUENCE_BYTES(buffer) + ofs, toread_len);
+    vosMtxUnlock(qspi_lock);
+    ACQUIRE_GIL();
+    if (err != VHAL_OK) {
+        return ERR_PERIPHERAL_ERROR_EXC;
+    }
+
+    *res = PSMALLINT_NEW(toread_len);
+    return ERR_OK;
+}
+
 C_NATIVE(qspiflash_write_data) {
     NATIVE_UNWARN();
 
@@ -105,8 +153,9 @@ C_NATIVE(qspiflash_write_data) {
     uint32_t writeaddr;
     uint32_t len;
     uint8_t *tosend; 
+    int err = VHAL_OK;
 
-    if (parse_py_args("is", nargs, args, &writeaddr, &tosend, &len) != 2) 
+    if (nargs < 2 || !PYARG_INT(0, writeaddr) || !PYARG_BYTES(1, tosend, len)) 
         return ERR_TYPE_EXC;
 
 
@@ -122,11 +171,14 @@ C_NATIVE(qspiflash_write_data) {
     current_addr = writeaddr;
     end_addr = writeaddr + len;
 
-    /* Perform the write page by page */
+    /* Perform the write page by page, letting other threads run meanwhile */
+    RELEASE_GIL();
+    vosMtxLock(qspi_lock);
     do {
 
-        if (vhalQspiFlashWrite(0, current_addr, tosend, current_size) != VHAL_OK) {
-            return ERR_PERIPHERAL_ERROR_EXC;
+        err = vhalQspiFlashWrite(0, current_addr, tosend, current_size);
+        if (err != VHAL_OK) {
+            break;
         }
 
         /* Update the address and size variables for next page programming */
@@ -135,7 +187,12 @@ C_NATIVE(qspiflash_write_data) {
         current_size = ((current_addr + flash_conf.page_size) > end_addr) ? (end_addr - current_addr) : flash_conf.page_size;
 
     } while (current_addr < end_addr);
+    vosMtxUnlock(qspi_lock);
+    ACQUIRE_GIL();
 
+    if (err != VHAL_OK) {
+        return ERR_PERIPHERAL_ERROR_EXC;
+    }
     return ERR_OK;
 }
 
@@ -143,15 +200,22 @@ C_NATIVE(qspiflash_erase_block) {
     NATIVE_UNWARN();
 
     uint32_t blockaddr;
+    int err;
 
-    if (parse_py_args("i", nargs, args, &blockaddr) != 1)
+    if (nargs < 1 || !PYARG_INT(0, blockaddr))
         return ERR_TYPE_EXC;
 
     if (blockaddr >= flash_conf.flash_size) {
         return ERR_VALUE_EXC;
     }
 
-    if (vhalQspiFlashEraseBlock(0, blockaddr, 1) != VHAL_OK) {
+    /* Wait for the erase letting other threads run meanwhile */
+    RELEASE_GIL();
+    vosMtxLock(qspi_lock);
+    err = vhalQspiFlashEraseBlock(0, blockaddr, 1);
+    vosMtxUnlock(qspi_lock);
+    ACQUIRE_GIL();
+    if (err != VHAL_OK) {
         return ERR_PERIPHERAL_ERROR_EXC;
     }
 
@@ -162,15 +226,22 @@ C_NATIVE(qspiflash_erase_sector) {
     NATIVE_UNWARN();
 
     uint32_t sectoraddr;
+    int err;
 
-    if (parse_py_args("i", nargs, args, &sectoraddr) != 1)
+    if (nargs < 1 || !PYARG_INT(0, sectoraddr))
         return ERR_TYPE_EXC;
 
     if (sectoraddr >= flash_conf.flash_size) {
         return ERR_VALUE_EXC;
     }
 
-    if (vhalQspiFlashEraseSector(0, sectoraddr, 1) != VHAL_OK) {
+    /* Wait for the erase letting other threads run meanwhile */
+    RELEASE_GIL();
+    vosMtxLock(qspi_lock);
+    err = vhalQspiFlashEraseSector(0, sectoraddr, 1);
+    vosMtxUnlock(qspi_lock);
+    ACQUIRE_GIL();
+    if (err != VHAL_OK) {
         return ERR_PERIPHERAL_ERROR_EXC;
     }
     return ERR_OK;
@@ -178,8 +249,15 @@ C_NATIVE(qspiflash_erase_sector) {
 
 C_NATIVE(qspiflash_erase_chip) {
     NATIVE_UNWARN();
-
-    if (vhalQspiFlashEraseChip(0, 1) != VHAL_OK) {
+    int err;
+
+    /* Wait for the erase letting other threads run meanwhile */
+    RELEASE_GIL();
+    vosMtxLock(qspi_lock);
+    err = vhalQspiFlashEraseChip(0, 1);
+    vosMtxUnlock(qspi_lock);
+    ACQUIRE_GIL();
+    if (err != VHAL_OK) {
         return ERR_PERIPHERAL_ERROR_EXC;
     }
 
@@ -188,8 +266,15 @@ C_NATIVE(qspiflash_erase_chip) {
 
 C_NATIVE(qspiflash_sleep) {
     NATIVE_UNWARN();
-
-    if (vhalQspiFlashSleep(0) != VHAL_OK) {
+    int err;
+
+    /* Wait for the erase in progress, if any */
+    RELEASE_GIL();
+    vosMtxLock(qspi_lock);
+    err = vhalQspiFlashSleep(0);
+    vosMtxUnlock(qspi_lock);
+    ACQUIRE_GIL();
+    if (err != VHAL_OK) {
         return ERR_PERIPHERAL_ERROR_EXC;
     }
 
@@ -198,8 +283,15 @@ C_NATIVE(qspiflash_sleep) {
 
 C_NATIVE(qspiflash_wakeup) {
     NATIVE_UNWARN();
-
-    if (vhalQspiFlashWakeup(0) != VHAL_OK) {
+    int err;
+
+    /* Wait for the erase in progress, if any */
+    RELEASE_GIL();
+    vosMtxLock(qspi_lock);
+    err = vhalQspiFlashWakeup(0);
+    vosMtxUnlock(qspi_lock);
+    ACQUIRE_GIL();
+    if (err != VHAL_OK) {
         return ERR_PERIPHERAL_ERROR_EXC;
     }
 
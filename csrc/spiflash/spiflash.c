@@ -0,0 +1,183 @@
+#include "zerynth.h"
+#include "spiflash.h"
+
+/*
+ * Generic SPI NOR flash. Commands are sent with the bus already configured by the Python Spi instance,
+ * whose nss is driven with vhalSpiSelect/vhalSpiUnselect. The GIL is released for the whole operation:
+ * buffers belong to objects referenced by the arguments and nothing is allocated meanwhile.
+ */
+
+#define SPIFLASH_CMD_FAST_READ 0x0B
+#define SPIFLASH_CMD_WRITE     0x02
+#define SPIFLASH_CMD_WREN      0x06
+#define SPIFLASH_CMD_RDSR      0x05
+#define SPIFLASH_SR_WIP        0x01
+
+// sends cmd followed by the 3 bytes of addr (if addr>=0) and by dummy bytes, leaving the slave selected
+static int32_t spiflash_cmd(uint32_t drv, uint8_t cmd, int32_t addr, int32_t dummy)
+{
+    uint8_t hdr[5];
+    int32_t len = 1;
+
+    hdr[0] = cmd;
+    if (addr >= 0) {
+        hdr[1] = (addr >> 16) & 0xff;
+        hdr[2] = (addr >> 8) & 0xff;
+        hdr[3] = addr & 0xff;
+        len = 4;
+    }
+    while (dummy-- > 0)
+        hdr[len++] = 0xff;
+    vhalSpiSelect(drv);
+    return vhalSpiExchange(drv, hdr, NULL, len);
+}
+
+static int32_t spiflash_write_enable(uint32_t drv)
+{
+    int32_t err = spiflash_cmd(drv, SPIFLASH_CMD_WREN, -1, 0);
+    vhalSpiUnselect(drv);
+    return err;
+}
+
+// polls the status register until the write in progress bit clears, for at most timeout milliseconds
+static int32_t spiflash_wait(uint32_t drv, uint32_t timeout)
+{
+    uint8_t sr[2];
+    uint64_t start = vosMillis();
+    int32_t err;
+
+    for (;;) {
+        sr[0] = SPIFLASH_CMD_RDSR;
+        sr[1] = 0xff;
+        vhalSpiSelect(drv);
+        err = vhalSpiExchange(drv, sr, sr, 2);
+        vhalSpiUnselect(drv);
+        if (err < 0)
+            return err;
+        if (!(sr[1] & SPIFLASH_SR_WIP))
+            return VHAL_OK;
+        if (vosMillis() - start >= timeout)
+            return VHAL_TIMEOUT_ERROR;
+        vosThSleep(TIME_U(1, MILLIS));
+    }
+}
+
+int32_t spiflash_dev_read(uint32_t drv, int32_t addr, uint8_t *buf, int32_t n)
+{
+    int32_t err = spiflash_cmd(drv, SPIFLASH_CMD_FAST_READ, addr, 1);
+
+    if (err >= 0 && n)
+        err = vhalSpiExchange(drv, NULL, buf, n);
+    vhalSpiUnselect(drv);
+    return err;
+}
+
+int32_t spiflash_dev_write(uint32_t drv, int32_t addr, const uint8_t *data, int32_t len, int32_t page, uint32_t timeout)
+{
+    int32_t n, err = 0;
+
+    while (len > 0) {
+        n = page - (addr & (page - 1));
+        if (n > len)
+            n = len;
+        err = spiflash_write_enable(drv);
+        if (err >= 0)
+            err = spiflash_cmd(drv, SPIFLASH_CMD_WRITE, addr, 0);
+        if (err >= 0)
+            err = vhalSpiExchange(drv, (uint8_t *)data, NULL, n);
+        vhalSpiUnselect(drv);
+        if (err >= 0)
+            err = spiflash_wait(drv, timeout);
+        if (err < 0)
+            break;
+        addr += n;
+        data += n;
+        len -= n;
+    }
+    return err;
+}
+
+int32_t spiflash_dev_erase(uint32_t drv, int32_t cmd, int32_t addr, uint32_t timeout)
+{
+    int32_t err = spiflash_write_enable(drv);
+
+    if (err >= 0)
+        err = spiflash_cmd(drv, cmd, addr, 0);
+    vhalSpiUnselect(drv);
+    if (err >= 0)
+        err = spiflash_wait(drv, timeout);
+    return err;
+}
+
+/*
+ * args: drvid, addr, buffer, ofs, n
+ * reads n bytes at addr into buffer starting at ofs, with a single fast read command
+ */
+C_NATIVE(spiflash_read)
+{
+    C_NATIVE_UNWARN();
+    int32_t drv, addr, ofs, n, size, err;
+    uint8_t *buf;
+
+    if (nargs != 5 || !IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[1]) || PTYPE(args[2]) != PBYTEARRAY || !IS_PSMALLINT(args[3]) || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    drv = PSMALLINT_VALUE(args[0]);
+    addr = PSMALLINT_VALUE(args[1]);
+    buf = PSEQUENCE_BYTES(args[2]);
+    size = PSEQUENCE_ELEMENTS(args[2]);
+    ofs = PSMALLINT_VALUE(args[3]);
+    n = PSMALLINT_VALUE(args[4]);
+    if (addr < 0 || ofs < 0 || n < 0 || ofs + n > size)
+        return ERR_INDEX_EXC;
+
+    RELEASE_GIL();
+    err = spiflash_dev_read(drv, addr, buf + ofs, n);
+    ACQUIRE_GIL();
+    if (err < 0)
+        return -err;
+    *res = PSMALLINT_NEW(n);
+    return ERR_OK;
+}
+
+/*
+ * args: drvid, addr, data, page_size, timeout
+ * programs data at addr, splitting it at page boundaries and waiting at most timeout milliseconds for each page
+ */
+C_NATIVE(spiflash_write)
+{
+    C_NATIVE_UNWARN();
+    int32_t drv, addr, len, page, timeout, err;
+    uint8_t *data;
+
+    if (nargs < 5 || !PYARG_INT(0, drv) || !PYARG_INT(1, addr) || !PYARG_BYTES(2, data, len) || !PYARG_INT(3, page) || !PYARG_INT(4, timeout))
+        return ERR_TYPE_EXC;
+    if (addr < 0 || page <= 0 || (page & (page - 1)))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    err = spiflash_dev_write(drv, addr, data, len, page, timeout);
+    ACQUIRE_GIL();
+    if (err < 0)
+        return -err;
+    return ERR_OK;
+}
+
+/*
+ * args: drvid, cmd, addr, timeout
+ * sends the erase command cmd (with addr if not negative) and waits at most timeout milliseconds for its completion
+ */
+C_NATIVE(spiflash_erase)
+{
+    C_NATIVE_UNWARN();
+    int32_t drv, cmd, addr, timeout, err;
+
+    if (nargs < 4 || !PYARG_INT(0, drv) || !PYARG_INT(1, cmd) || !PYARG_INT(2, addr) || !PYARG_INT(3, timeout))
+        return ERR_TYPE_EXC;
+
+    RELEASE_GIL();
+    err = spiflash_dev_erase(drv, cmd, addr, timeout);
+    ACQUIRE_GIL();
+    if (err < 0)
+        return -err;
+    return ERR_OK;
+}
@@ -0,0 +1,13 @@
+#ifndef __SPIFLASH__
+#define __SPIFLASH__
+
+/*
+ * Blocking primitives of the SPI NOR flash driver, also used by the flash translation layer.
+ * They must be called without the GIL and with the bus already configured; errors are negative VHAL codes.
+ */
+
+int32_t spiflash_dev_read(uint32_t drv, int32_t addr, uint8_t *buf, int32_t n);
+int32_t spiflash_dev_write(uint32_t drv, int32_t addr, const uint8_t *data, int32_t len, int32_t page, uint32_t timeout);
+int32_t spiflash_dev_erase(uint32_t drv, int32_t cmd, int32_t addr, uint32_t timeout);
+
+#endif
@@ -0,0 +1,494 @@
+#include "zerynth.h"
+
+/*
+ * Streaming statistics with constant memory. An accumulator is a bytearray holding a StState: its kind selects
+ * the moments (count, Welford mean and variance, min, max, exponential moving average), a fixed bucket histogram
+ * or a P-square quantile estimator (Jain and Chlamtac, 1985: five markers moved by parabolic interpolation).
+ *
+ * Samples come one by one as numbers, or in bulk from a shortarray or a bytearray read as native order signed
+ * shorts (the layout of adc captures and of the dsp module). Bulk moments are summed exactly in 64 bits integers
+ * over blocks of samples and merged with the running ones by the parallel formula of Chan et al., so there is
+ * no division per sample; the moments are kept in double precision, not to lose digits over long streams.
+ */
+
+#define ST_TAG          0x5354
+
+#define ST_MOMENTS      0
+#define ST_HISTOGRAM    1
+#define ST_QUANTILE     2
+
+#define ST_MAX_BUCKETS  4096
+// samples added by a bulk update between two GIL checkpoints: the integer sums of a block of at most 2^16
+// samples of 16 bits do not overflow n*sum(x^2)
+#define ST_BLOCK        4096
+
+typedef struct _st_moments {
+    uint32_t count;
+    float alpha;
+    double mean;
+    double m2;
+    double min;
+    double max;
+    double ewma;
+} StMoments;
+
+typedef struct _st_histogram {
+    float lo;
+    float hi;
+    float scale;        // buckets per unit
+    uint32_t buckets;
+    uint32_t count;
+} StHistogram;
+
+typedef struct _st_quantile {
+    float p;
+    uint32_t count;
+    float q[5];         // marker heights, the first samples until there are five
+    float want[5];      // desired marker positions
+    float inc[5];       // their increments per sample
+    int32_t pos[5];     // actual marker positions
+} StQuantile;
+
+typedef struct _st_state {
+    uint16_t tag;
+    uint16_t kind;
+    union {
+        StMoments m;
+        StHistogram h;
+        StQuantile q;
+    };
+} StState;
+
+// the counts of a histogram follow its state: underflow, buckets, overflow
+#define ST_COUNTS(st) ((uint32_t*)((st) + 1))
+
+static StState *st_check(PObject *obj)
+{
+    StState *st;
+
+    if (PTYPE(obj) != PBYTEARRAY || PSEQUENCE_ELEMENTS(obj) < sizeof(StState))
+        return NULL;
+    st = (StState*)PSEQUENCE_BYTES(obj);
+    if (st->tag != ST_TAG)
+        return NULL;
+    if (st->kind == ST_HISTOGRAM && PSEQUENCE_ELEMENTS(obj) < sizeof(StState) + 4 * (st->h.buckets + 2))
+        return NULL;
+    return st;
+}
+
+static int st_num(PObject *o, double *v)
+{
+    switch (PTYPE(o)) {
+        case PSMALLINT:
+            *v = PSMALLINT_VALUE(o);
+            return 1;
+        case PINTEGER:
+            *v = INTEGER_VALUE(o);
+            return 1;
+        case PFLOAT:
+            *v = FLOAT_VALUE(o);
+            return 1;
+    }
+    return 0;
+}
+
+static PObject *st_int(uint32_t v)
+{
+    if (v < 1073741824)
+        return PSMALLINT_NEW(v);
+    return (PObject*)pinteger_new(v);
+}
+
+static void st_clear(StState *st)
+{
+    switch (st->kind) {
+        case ST_MOMENTS:
+            st->m.count = 0;
+            st->m.mean = st->m.m2 = st->m.min = st->m.max = st->m.ewma = 0;
+            break;
+        case ST_HISTOGRAM:
+            st->h.count = 0;
+            memset(ST_COUNTS(st), 0, 4 * (st->h.buckets + 2));
+            break;
+        case ST_QUANTILE: {
+            float p = st->q.p;
+            st->q.count = 0;
+            st->q.want[0] = 0;
+            st->q.want[1] = 2 * p;
+            st->q.want[2] = 4 * p;
+            st->q.want[3] = 2 + 2 * p;
+            st->q.want[4] = 4;
+            st->q.inc[0] = 0;
+            st->q.inc[1] = p / 2;
+            st->q.inc[2] = p;
+            st->q.inc[3] = (1 + p) / 2;
+            st->q.inc[4] = 1;
+        }
+        break;
+    }
+}
+
+// merges count, mean, m2 of a block of samples into the moments
+static void st_merge(StMoments *m, uint32_t n, double mean, double m2)
+{
+    double delta = mean - m->mean;
+    double tot = (double)m->count + n;
+
+    m->mean += delta * n / tot;
+    m->m2 += m2 + delta * delta * ((double)m->count * n / tot);
+    m->count += n;
+}
+
+static void st_moments_add(StMoments *m, double x)
+{
+    double delta;
+
+    if (!m->count) {
+        m->min = m->max = m->ewma = x;
+    } else {
+        if (x < m->min)
+            m->min = x;
+        if (x > m->max)
+            m->max = x;
+        m->ewma += m->alpha * (x - m->ewma);
+    }
+    m->count++;
+    delta = x - m->mean;
+    m->mean += delta / m->count;
+    m->m2 += delta * (x - m->mean);
+}
+
+static inline void st_histogram_add(StState *st, float x)
+{
+    StHistogram *h = &st->h;
+    int32_t b;
+
+    h->count++;
+    if (!(x >= h->lo)) {
+        ST_COUNTS(st)[0]++;
+        return;
+    }
+    b = (int32_t)((x - h->lo) * h->scale);
+    if (x >= h->hi || b >= (int32_t)h->buckets)
+        ST_COUNTS(st)[h->buckets + 1]++;
+    else
+        ST_COUNTS(st)[b + 1]++;
+}
+
+static float st_parabolic(StQuantile *q, int i, int d)
+{
+    float np = q->pos[i + 1], n = q->pos[i], nm = q->pos[i - 1];
+
+    return q->q[i] + d / (np - nm) * ((n - nm + d) * (q->q[i + 1] - q->q[i]) / (np - n) + (np - n - d) * (q->q[i] - q->q[i - 1]) / (n - nm));
+}
+
+static void st_quantile_add(StQuantile *q, float x)
+{
+    int i, k;
+
+    if (q->count < 5) {
+        // insertion sort of the first samples
+        for (i = q->count; i > 0 && q->q[i - 1] > x; i--)
+            q->q[i] = q->q[i - 1];
+        q->q[i] = x;
+        q->pos[q->count] = q->count;
+        q->count++;
+        return;
+    }
+    q->count++;
+    if (x < q->q[0]) {
+        q->q[0] = x;
+        k = 0;
+    } else if (x >= q->q[4]) {
+        q->q[4] = x;
+        k = 3;
+    } else {
+        for (k = 0; x >= q->q[k + 1]; k++);
+    }
+    for (i = k + 1; i < 5; i++)
+        q->pos[i]++;
+    for (i = 0; i < 5; i++)
+        q->want[i] += q->inc[i];
+    for (i = 1; i < 4; i++) {
+        float d = q->want[i] - q->pos[i];
+        if ((d >= 1 && q->pos[i + 1] - q->pos[i] > 1) || (d <= -1 && q->pos[i - 1] - q->pos[i] < -1)) {
+            int s = (d > 0) ? 1 : -1;
+            float h = st_parabolic(q, i, s);
+            if (!(q->q[i - 1] < h && h < q->q[i + 1]))
+                h = q->q[i] + s * (q->q[i + s] - q->q[i]) / (q->pos[i + s] - q->pos[i]);
+            q->q[i] = h;
+            q->pos[i] += s;
+        }
+    }
+}
+
+static float st_quantile_value(StQuantile *q)
+{
+    int32_t r;
+
+    if (q->count >= 5)
+        return q->q[2];
+    // nearest rank of the sorted first samples
+    r = (int32_t)(q->p * q->count + 0.5f);
+    if (r > 0)
+        r--;
+    return q->q[r];
+}
+
+static void st_add(StState *st, double x)
+{
+    switch (st->kind) {
+        case ST_MOMENTS:
+            st_moments_add(&st->m, x);
+            break;
+        case ST_HISTOGRAM:
+            st_histogram_add(st, (float)x);
+            break;
+        case ST_QUANTILE:
+            st_quantile_add(&st->q, (float)x);
+            break;
+    }
+}
+
+/*
+ * args: kind, a, b, buckets
+ * returns a new accumulator: moments with smoothing factor a for the moving average, histogram of buckets
+ * equal buckets from a to b, or quantile a estimator
+ */
+C_NATIVE(_stats_new)
+{
+    C_NATIVE_UNWARN();
+    int32_t kind, buckets;
+    double a, b;
+    StState *st;
+
+    if (nargs != 4 || !IS_PSMALLINT(args[0]) || !st_num(args[1], &a) || !st_num(args[2], &b) || !IS_PSMALLINT(args[3]))
+        return ERR_TYPE_EXC;
+    kind = PSMALLINT_VALUE(args[0]);
+    buckets = PSMALLINT_VALUE(args[3]);
+    switch (kind) {
+        case ST_MOMENTS:
+            if (a < 0 || a > 1)
+                return ERR_VALUE_EXC;
+            buckets = 0;
+            break;
+        case ST_HISTOGRAM:
+            if (!(a < b) || buckets < 1 || buckets > ST_MAX_BUCKETS)
+                return ERR_VALUE_EXC;
+            break;
+        case ST_QUANTILE:
+            if (!(a > 0 && a < 1))
+                return ERR_VALUE_EXC;
+            buckets = 0;
+            break;
+        default:
+            return ERR_VALUE_EXC;
+    }
+    *res = psequence_new(PBYTEARRAY, sizeof(StState) + ((kind == ST_HISTOGRAM) ? 4 * (buckets + 2) : 0));
+    st = (StState*)PSEQUENCE_BYTES(*res);
+    st->tag = ST_TAG;
+    st->kind = kind;
+    switch (kind) {
+        case ST_MOMENTS:
+            st->m.alpha = (float)a;
+            break;
+        case ST_HISTOGRAM:
+            st->h.lo = (float)a;
+            st->h.hi = (float)b;
+            st->h.scale = (float)(buckets / (b - a));
+            st->h.buckets = buckets;
+            break;
+        case ST_QUANTILE:
+            st->q.p = (float)a;
+            break;
+    }
+    st_clear(st);
+    return ERR_OK;
+}
+
+/*
+ * args: state, x
+ * adds the number x
+ */
+C_NATIVE(_stats_update)
+{
+    C_NATIVE_UNWARN();
+    StState *st;
+    double x;
+
+    if (nargs != 2 || !(st = st_check(args[0])) || !st_num(args[1], &x))
+        return ERR_TYPE_EXC;
+    st_add(st, x);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: state, buf, offset, step, samples
+ * adds samples samples of buf, from offset every step (all those left if samples is negative).
+ * Returns the number of samples added
+ */
+C_NATIVE(_stats_update_from)
+{
+    C_NATIVE_UNWARN();
+    StState *st;
+    int16_t *x, *p;
+    int32_t n, ofs, step, cnt, i, len, done = 0, type, elements;
+
+    if (nargs != 5 || !(st = st_check(args[0])) || !IS_PSMALLINT(args[2]) || !IS_PSMALLINT(args[3]) || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    if (PTYPE(args[1]) == PSHORTARRAY) {
+        n = PSEQUENCE_ELEMENTS(args[1]);
+    } else if (PTYPE(args[1]) == PBYTEARRAY) {
+        n = PSEQUENCE_ELEMENTS(args[1]) / 2;
+    } else {
+        return ERR_TYPE_EXC;
+    }
+    type = PTYPE(args[1]);
+    elements = PSEQUENCE_ELEMENTS(args[1]);
+    x = (int16_t*)PSEQUENCE_BYTES(args[1]);
+    ofs = PSMALLINT_VALUE(args[2]);
+    step = PSMALLINT_VALUE(args[3]);
+    cnt = PSMALLINT_VALUE(args[4]);
+    if (ofs < 0 || step < 1)
+        return ERR_VALUE_EXC;
+    n = (ofs < n) ? (n - ofs + step - 1) / step : 0;
+    if (cnt < 0)
+        cnt = n;
+    else if (cnt > n)
+        return ERR_INDEX_EXC;
+    x += ofs;
+
+    if (st->kind == ST_MOMENTS && st->m.count < 1 && cnt) {
+        // the first sample seeds min, max and the moving average
+        st_moments_add(&st->m, x[0]);
+        done = 1;
+    }
+    while (done < cnt) {
+        len = cnt - done;
+        if (len > ST_BLOCK)
+            len = ST_BLOCK;
+        p = x + done * step;
+        switch (st->kind) {
+            case ST_MOMENTS: {
+                StMoments *m = &st->m;
+                int32_t mn = 32767, mx = -32768;
+                int64_t sum = 0, sq = 0;
+                float e = (float)m->ewma, a = m->alpha;
+                for (i = 0; i < len; i++, p += step) {
+                    int32_t v = *p;
+                    if (v < mn)
+                        mn = v;
+                    if (v > mx)
+                        mx = v;
+                    sum += v;
+                    sq += v * v;
+                    e += a * (v - e);
+                }
+                if (mn < m->min)
+                    m->min = mn;
+                if (mx > m->max)
+                    m->max = mx;
+                m->ewma = e;
+                st_merge(m, len, (double)sum / len, (double)(len * sq - sum * sum) / len);
+            }
+            break;
+            case ST_HISTOGRAM:
+                for (i = 0; i < len; i++, p += step)
+                    st_histogram_add(st, *p);
+                break;
+            case ST_QUANTILE:
+                for (i = 0; i < len; i++, p += step)
+                    st_quantile_add(&st->q, *p);
+                break;
+        }
+        done += len;
+        if (done < cnt) {
+            GIL_CHECKPOINT();
+            // other threads may have changed the objects meanwhile: take their buffers again
+            if (!(st = st_check(args[0])) || PTYPE(args[1]) != type || PSEQUENCE_ELEMENTS(args[1]) != elements)
+                return ERR_VALUE_EXC;
+            x = (int16_t*)PSEQUENCE_BYTES(args[1]) + ofs;
+        }
+    }
+    *res = PSMALLINT_NEW(cnt);
+    return ERR_OK;
+}
+
+/*
+ * args: state, what
+ * moments: 0 count, 1 mean, 2 sample variance, 3 min, 4 max, 5 moving average, None but for count and variance
+ * if empty. histogram: 0 count, 1 underflow, 2 overflow, 3 tuple of the bucket counts. quantile: 0 count,
+ * 1 estimate or None if empty
+ */
+C_NATIVE(_stats_get)
+{
+    C_NATIVE_UNWARN();
+    StState *st;
+    int32_t what, i;
+    double v = 0;
+
+    if (nargs != 2 || !(st = st_check(args[0])) || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    what = PSMALLINT_VALUE(args[1]);
+    switch (st->kind) {
+        case ST_MOMENTS:
+            if (what == 0) {
+                *res = st_int(st->m.count);
+                return ERR_OK;
+            }
+            if (what == 2) {
+                *res = pfloat_new((st->m.count > 1) ? st->m.m2 / (st->m.count - 1) : 0);
+                return ERR_OK;
+            }
+            switch (what) {
+                case 1: v = st->m.mean; break;
+                case 3: v = st->m.min; break;
+                case 4: v = st->m.max; break;
+                case 5: v = st->m.ewma; break;
+                default: return ERR_VALUE_EXC;
+            }
+            *res = (st->m.count) ? (PObject*)pfloat_new(v) : (PObject*)MAKE_NONE();
+            break;
+        case ST_HISTOGRAM:
+            switch (what) {
+                case 0: *res = st_int(st->h.count); break;
+                case 1: *res = st_int(ST_COUNTS(st)[0]); break;
+                case 2: *res = st_int(ST_COUNTS(st)[st->h.buckets + 1]); break;
+                case 3: {
+                    PTuple *tpl = ptuple_new(st->h.buckets, NULL);
+                    for (i = 0; i < (int32_t)st->h.buckets; i++)
+                        PTUPLE_SET_ITEM(tpl, i, st_int(ST_COUNTS(st)[i + 1]));
+                    *res = (PObject*)tpl;
+                }
+                break;
+                default: return ERR_VALUE_EXC;
+            }
+            break;
+        case ST_QUANTILE:
+            if (what == 0)
+                *res = st_int(st->q.count);
+            else if (what == 1)
+                *res = (st->q.count) ? (PObject*)pfloat_new(st_quantile_value(&st->q)) : (PObject*)MAKE_NONE();
+            else
+                return ERR_VALUE_EXC;
+            break;
+    }
+    return ERR_OK;
+}
+
+/*
+ * args: state
+ * forgets all the samples, keeping the parameters
+ */
+C_NATIVE(_stats_reset)
+{
+    C_NATIVE_UNWARN();
+    StState *st;
+
+    if (nargs != 1 || !(st = st_check(args[0])))
+        return ERR_TYPE_EXC;
+    st_clear(st);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
@@ -51,13 +51,66 @@ uint8_t *packmods = "@=<>!";
 uint8_t packbige[] = {0,0,0,1,1};
 #endif
 
-static inline reverse_even_buf(uint8_t *buf, int size) {
-    uint8_t tmp;
-    // size can be 4 or 8
-    for (int i=0; i < size/2; i++) {
-        tmp = buf[i];
-        buf[i] = buf[size-i-1];
-        buf[size-i-1] = tmp;
+// byte swapping of whole words: compiles to single REV/REV16 instructions on ARM
+#if defined(__GNUC__)
+#define PACK_SWAP16(x) __builtin_bswap16(x)
+#define PACK_SWAP32(x) __builtin_bswap32(x)
+#define PACK_SWAP64(x) __builtin_bswap64(x)
+#else
+#define PACK_SWAP16(x) ((uint16_t)(((x)>>8)|((x)<<8)))
+#define PACK_SWAP32(x) ((((x)&0xff)<<24)|(((x)&0xff00)<<8)|(((x)>>8)&0xff00)|(((x)>>24)&0xff))
+#define PACK_SWAP64(x) (((uint64_t)PACK_SWAP32((uint32_t)(x))<<32)|PACK_SWAP32((uint32_t)((x)>>32)))
+#endif
+
+/**
+* @brief writes the low size bytes of v into buf, in big endian order if bigendian.
+* Words are written with a single (possibly unaligned) store
+*/
+static inline void pack_put_word(uint8_t *buf, uint64_t v, int size, int bigendian) {
+    uint16_t v16;
+    uint32_t v32;
+    //TODO: support big endian mcu! At the moment all mcu are little endian
+    switch(size){
+        case 1:
+            *buf = (uint8_t)v;
+            break;
+        case 2:
+            v16 = (uint16_t)v;
+            if (bigendian) v16 = PACK_SWAP16(v16);
+            memcpy(buf,&v16,2);
+            break;
+        case 4:
+            v32 = (uint32_t)v;
+            if (bigendian) v32 = PACK_SWAP32(v32);
+            memcpy(buf,&v32,4);
+            break;
+        case 8:
+            if (bigendian) v = PACK_SWAP64(v);
+            memcpy(buf,&v,8);
+            break;
+    }
+}
+
+/**
+* @brief reads an unsigned integer of size 1,2,4,8 from buf, in big endian order if bigendian
+*/
+static inline uint64_t pack_get_word(uint8_t *buf, int size, int bigendian) {
+    uint16_t v16;
+    uint32_t v32;
+    uint64_t v;
+    //TODO: support big endian mcu! At the moment all mcu are little endian
+    switch(size){
+        case 1:
+            return *buf;
+        case 2:
+            memcpy(&v16,buf,2);
+            return (bigendian) ? PACK_SWAP16(v16):v16;
+        case 4:
+            memcpy(&v32,buf,4);
+            return (bigendian) ? PACK_SWAP32(v32):v32;
+        default:
+            memcpy(&v,buf,8);
+            return (bigendian) ? PACK_SWAP64(v):v;
     }
 }
 
@@ -97,58 +150,7 @@ int pack_get_integer(PObject *tuple, int idx, uint8_t *buf, int mode, int size){
     PObject *item = PTUPLE_ITEM(tuple,idx);
     int tt = PTYPE(item);
     if(tt==PSMALLINT || tt==PINTEGER){
-        uint64_t v = (uint64_t)(INTEGER_VALUE(item));
-        printf("%x\n",v);
-        uint8_t t2[8];
-        if(size==1){
-            t2[0] = v&0xff;
-        } else if(size==2){
-            if(!packbige[mode]){
-                //little
-                t2[0] = v&0xff;
-                t2[1] = (v>>8)&0xff;
-            } else {
-                t2[1] = v&0xff;
-                t2[0] = (v>>8)&0xff;
-            }
-        } else if(size==4){
-            if(!packbige[mode]){
-                //little
-                t2[0] = v&0xff;
-                t2[1] = (v>>8)&0xff;
-                t2[2] = (v>>16)&0xff;
-                t2[3] = (v>>24)&0xff;
-            } else {
-                //big
-                t2[3] = v&0xff;
-                t2[2] = (v>>8)&0xff;
-                t2[1] = (v>>16)&0xff;
-                t2[0] = (v>>24)&0xff;
-            }
-        } else if(size==8){
-            if(!packbige[mode]){
-                //little
-                t2[0] = v&0xff;
-                t2[1] = (v>>8)&0xff;
-                t2[2] = (v>>16)&0xff;
-                t2[3] = (v>>24)&0xff;
-                t2[4] = (v>>32)&0xff;
-                t2[5] = (v>>40)&0xff;
-                t2[6] = (v>>48)&0xff;
-                t2[7] = (v>>52)&0xff;
-            } else {
-                //big
-                t2[7] = v&0xff;
-                t2[6] = (v>>8)&0xff;
-                t2[5] = (v>>16)&0xff;
-                t2[4] = (v>>24)&0xff;
-                t2[3] = (v>>32)&0xff;
-                t2[2] = (v>>40)&0xff;
-                t2[1] = (v>>48)&0xff;
-                t2[0] = (v>>52)&0xff;
-            }
-        }
-        memcpy(buf,t2,size);
+        pack_put_word(buf,(uint64_t)(INTEGER_VALUE(item)),size,packbige[mode]);
         return size;
     } else if (tt==PBOOL){
         if(item==PBOOL_TRUE()) *buf=1;
@@ -174,18 +176,18 @@ int pack_get_float(PObject *tuple, int idx, uint8_t *buf, int size, int bigendia
     if(tt==PFLOAT){
         if(size==4){
             float f = FLOAT_VALUE(item);
-            memcpy(buf,&f,size);
+            uint32_t v32;
+            memcpy(&v32,&f,4);
+            pack_put_word(buf,v32,4,bigendian);
         } else if(size==8) {
             double d = (double)FLOAT_VALUE(item);
-            memcpy(buf,&d,size);
+            uint64_t v;
+            memcpy(&v,&d,8);
+            pack_put_word(buf,v,8,bigendian);
         } else {
             //short float not supported!
             return -1;
         }
-        //TODO: support big endian mcu! At the moment all mcu are little endian
-        if (bigendian) {
-           reverse_even_buf(buf,size);
-        }
         return size;
     }
     return -1;
@@ -220,35 +222,13 @@ int pack_get_string(PObject *tuple, int idx, uint8_t *buf, int size){
     return -1;
 }
 
+/**
+* @brief reads an unsigned integer of size 1,2,4,8 from buf
+*/
 PObject* unpack_make_integer(uint8_t *buf,int size, int is_signed, int bigendian){
-    uint8_t t2[8];
-    uint64_t ii = 0;
+    uint64_t ii = pack_get_word(buf,size,bigendian);
     int64_t ss = 0;
 
-    memcpy(t2,buf,size);
-    
-    //TODO: support big endian mcu! At the moment all mcu are little endian
-    if (bigendian) {
-        if(size==1){
-            ii|= t2[0] & 0xff;
-        } else if (size==2){
-            ii|=((t2[0]<<8) | t2[1]) & 0xffff;
-        } else if (size==4){
-            ii|=((t2[0]<<24)|(t2[1]<<16)|(t2[2]<<8)|(t2[3])) & 0xffffffff;
-        } else if (size==8){
-            ii|=(t2[0]<<56)|(t2[1]<<48)|(t2[2]<<40)|(t2[3]<<32)|(t2[4]<<24)|(t2[5]<<16)|(t2[6]<<8)|(t2[7]);
-        }
-    } else {
-        if (size==1){
-            ii|= (t2[0] & 0xff);
-        } else if (size==2){
-            ii|=((t2[1]<<8) | t2[0]) & 0xffff;
-        } else if (size==4){
-            ii|=((t2[3]<<24)|(t2[2]<<16)|(t2[1]<<8)|(t2[0])) & 0xffffffff;
-        } else if (size==8){
-            ii|=(t2[7]<<56)|(t2[6]<<48)|(t2[5]<<40)|(t2[4]<<32)|(t2[3]<<24)|(t2[2]<<16)|(t2[1]<<8)|(t2[0]);
-        }
-    }
     if (is_signed){
         ss = ii;
         if(size==1) {
@@ -268,17 +248,15 @@ PObject* unpack_make_integer(uint8_t *buf,int size, int is_signed, int bigendian
 
 PObject *unpack_make_float(uint8_t* buf,int size, int bigendian){
     //size 2 is not supported
-    //TODO: support big endian mcu! At the moment all mcu are little endian
-    if (bigendian) {
-        reverse_even_buf(buf,size);
-    }
     if (size==4){
         float f;
-        memcpy(&f,buf,4);
+        uint32_t v32 = pack_get_word(buf,4,bigendian);
+        memcpy(&f,&v32,4);
         return pfloat_new(f);
     } else {
         double d;
-        memcpy(&d,buf,8);
+        uint64_t v = pack_get_word(buf,8,bigendian);
+        memcpy(&d,&v,8);
         return pfloat_new(d);
     }
 }
@@ -409,12 +387,80 @@ PackEntry* pack_calc_size(uint8_t *fmt, int fmtl, int *endianess, int* total_ite
     return pes;
 }
 
-C_NATIVE(__struct_pack) {
+/**
+* @brief header of a compiled format, stored in a PBytes followed by its entries
+*/
+typedef struct _pack_format {
+    uint16_t magic;
+    uint16_t mode;
+    uint16_t items;
+    uint16_t entries;
+    uint16_t size;
+} PackFormat;
+
+#define PACK_FORMAT_ENTRIES(pf) ((PackEntry*)(((uint8_t*)(pf))+sizeof(PackFormat)))
+// "FZ" in memory: F is not a format character, so no valid format is taken for a compiled one
+#define PACK_FORMAT_MAGIC 0x5a46
+
+/**
+* @brief returns the entries of fmt, a format string or bytes to parse or a format compiled by __struct_compile
+*
+* A PBytes is taken as compiled only if it starts with the magic number and its length matches the entries in the header:
+* any other PBytes is parsed as a format.
+*
+* @param fmt
+* @param owned set to 1 if the entries have been allocated and must be freed
+*
+* @return NULL on bad format
+*/
+PackEntry* pack_get_entries(PObject *fmt, int *endianess, int* total_items, int* total_entries, int* total_size, int *owned){
+    PackFormat *pf = (PackFormat*)PSEQUENCE_BYTES(fmt);
+    if (PTYPE(fmt)==PBYTES && PSEQUENCE_ELEMENTS(fmt)>=sizeof(PackFormat) && pf->magic==PACK_FORMAT_MAGIC
+        && PSEQUENCE_ELEMENTS(fmt)==sizeof(PackFormat)+sizeof(PackEntry)*pf->entries) {
+        //already parsed
+        *owned = 0;
+        if(total_size) *total_size = pf->size;
+        if(total_entries) *total_entries = pf->entries;
+        if(total_items) *total_items = pf->items;
+        if(endianess) *endianess = pf->mode;
+        return PACK_FORMAT_ENTRIES(pf);
+    }
+    *owned = 1;
+    return pack_calc_size(PSEQUENCE_BYTES(fmt),PSEQUENCE_ELEMENTS(fmt),endianess,total_items,total_entries,total_size);
+}
+
+#define CHECK_FMT_ARG(x) if( PTYPE(x)!=PSTRING && PTYPE(x)!=PBYTES ) return ERR_TYPE_EXC
+
+/**
+* @brief parses a format string once, returning a PBytes with the header and the entries of the format
+*/
+C_NATIVE(__struct_compile) {
     NATIVE_UNWARN();
     CHECK_ARG(args[0], PSTRING);
+    int mode,items,entries,gsize;
+    PackFormat *pf;
+    *res = MAKE_NONE();
+
+    PackEntry *pes = pack_calc_size(PSEQUENCE_BYTES(args[0]),PSEQUENCE_ELEMENTS(args[0]),&mode,&items,&entries,&gsize);
+    if(!pes){
+        return ERR_OK;
+    }
+    *res = pbytes_new(sizeof(PackFormat)+sizeof(PackEntry)*entries,NULL);
+    pf = (PackFormat*)PSEQUENCE_BYTES(*res);
+    pf->magic = PACK_FORMAT_MAGIC;
+    pf->mode = mode;
+    pf->items = items;
+    pf->entries = entries;
+    pf->size = gsize;
+    memcpy(PACK_FORMAT_ENTRIES(pf),pes,sizeof(PackEntry)*entries);
+    gc_free(pes);
+    return ERR_OK;
+}
+
+C_NATIVE(__struct_pack) {
+    NATIVE_UNWARN();
+    CHECK_FMT_ARG(args[0]);
     CHECK_ARG(args[3], PTUPLE); //vargs
-    uint8_t *fmt = PSEQUENCE_BYTES(args[0]);
-    int fmtl = PSEQUENCE_ELEMENTS(args[0]);
     PObject *ibuffer = args[1];
     PObject *ioffset = args[2];
     PObject *iitems = args[3];
@@ -430,12 +476,14 @@ C_NATIVE(__struct_pack) {
     int gsize = 0;
     int mode = 0;
     int i;
+    int psize;
     int err=0;
     uint8_t *buf;
     PBytes *bres = NULL;
+    int owned;
 
 
-    PackEntry *pes = pack_calc_size(fmt,fmtl,&mode,&items,&entries,&gsize);
+    PackEntry *pes = pack_get_entries(args[0],&mode,&items,&entries,&gsize,&owned);
     if(!pes){
         return ERR_OK;
     }
@@ -500,23 +548,28 @@ C_NATIVE(__struct_pack) {
                 }
             } else if ((ee->type>=PACK_b && ee->type<=PACK_N)||ee->type==PACK_P) {
                 //integer
-                i=0;
-                while(i<ee->count){
-                    if(citem>=nitems){
-                        //no more items! fail
-                        printf("out of arguments\n");
-                        err=1;
-                        goto clean_up;
+                if(citem+ee->count>nitems){
+                    //not enough items! fail
+                    printf("out of arguments\n");
+                    err=1;
+                    goto clean_up;
+                }
+                psize = packsize[ee->type];
+                for(i=0;i<ee->count;i++,citem++){
+                    item = PTUPLE_ITEM(iitems,citem);
+                    if(IS_PSMALLINT(item)){
+                        //fast path for runs of small integers, as in "100H"
+                        pack_put_word(buf,(uint64_t)(int64_t)PSMALLINT_VALUE(item),psize,packbige[mode]);
+                        buf+=psize;
+                        continue;
                     }
-                    pos = pack_get_integer(iitems,citem,buf,mode,packsize[ee->type]);
+                    pos = pack_get_integer(iitems,citem,buf,mode,psize);
                     printf("parsed integer %i %i\n",citem,pos);
                     if(pos<0){
                         //fail!
                         err=1;
                         goto clean_up;
                     }
-                    i++;
-                    citem++;
                     buf+=pos;
                 }
             } else if (ee->type>=PACK_e && ee->type<=PACK_d){
@@ -579,7 +632,7 @@ C_NATIVE(__struct_pack) {
 
 clean_up:
 
-    gc_free(pes); 
+    if(owned) gc_free(pes);
     if (err) *res=MAKE_NONE();
     else *res = bres;
     return ERR_OK;
@@ -588,17 +641,16 @@ clean_up:
 
 C_NATIVE(__struct_calcsize) {
     NATIVE_UNWARN();
-    CHECK_ARG(args[0], PSTRING);
-    uint8_t * fmt = PSEQUENCE_BYTES(args[0]);
-    int fmtl = PSEQUENCE_ELEMENTS(args[0]);
+    CHECK_FMT_ARG(args[0]);
     int gsize=0;
+    int owned;
 
 
-    PackEntry *pes = pack_calc_size(fmt,fmtl,NULL,NULL,NULL,&gsize);
+    PackEntry *pes = pack_get_entries(args[0],NULL,NULL,NULL,&gsize,&owned);
     if(!pes){
         *res = PSMALLINT_NEW(-1);
     } else {
-        gc_free(pes);
+        if(owned) gc_free(pes);
         *res = PSMALLINT_NEW(gsize);
     }
 
@@ -607,10 +659,8 @@ C_NATIVE(__struct_calcsize) {
 
 C_NATIVE(__struct_unpack) {
     NATIVE_UNWARN();
-    CHECK_ARG(args[0], PSTRING);
+    CHECK_FMT_ARG(args[0]);
     CHECK_ARG(args[2],PSMALLINT);
-    uint8_t * fmt = PSEQUENCE_BYTES(args[0]);
-    int fmtl = PSEQUENCE_ELEMENTS(args[0]);
     uint8_t *buf = PSEQUENCE_BYTES(args[1]);
     int bufsize = PSEQUENCE_ELEMENTS(args[1]);
     int offset = PSMALLINT_VALUE(args[2]);
@@ -622,6 +672,7 @@ C_NATIVE(__struct_unpack) {
     int entry;
     int i;
     int err=0;
+    int owned;
 
     PObject *tuple;
     PObject *o;
@@ -629,8 +680,9 @@ C_NATIVE(__struct_unpack) {
     buf+=offset;
     *res = MAKE_NONE();
 
-    PackEntry *pes = pack_calc_size(fmt,fmtl,&mode,&items,&entries,&gsize);
-    if(!pes || gsize!=bufsize){
+    PackEntry *pes = pack_get_entries(args[0],&mode,&items,&entries,&gsize,&owned);
+    //unpack needs an exact size, unpack_from only enough bytes
+    if(!pes || gsize>bufsize || (args[3]==PBOOL_TRUE() && gsize!=bufsize)){
         err=1;
         goto clean_up;
     } 
@@ -723,10 +775,163 @@ C_NATIVE(__struct_unpack) {
 
 clean_up:
 
-    gc_free(pes);
+    if(pes && owned) gc_free(pes);
     if (err) *res=MAKE_NONE();
     else *res = tuple;
     return ERR_OK;
 }
 
 
+/**
+* @brief creates the column for the values of an entry: a bytearray for c and B,
+* a shortarray for H, a list for the others
+*/
+PObject *unpack_new_column(int type, int count){
+    PObject *col;
+    if (type==PACK_c || type==PACK_B) {
+        col = psequence_new(PBYTEARRAY,count);
+    } else if (type==PACK_H) {
+        col = psequence_new(PSHORTARRAY,count);
+    } else {
+        col = plist_new(count,NULL);
+    }
+    PSEQUENCE_ELEMENTS_SET(col,count);
+    return col;
+}
+
+/*
+ * args: fmt, buffer, offset, count
+ * decodes count consecutive records, returning a tuple with a column for each item of fmt
+ */
+C_NATIVE(__struct_unpack_array) {
+    NATIVE_UNWARN();
+    CHECK_FMT_ARG(args[0]);
+    CHECK_ARG(args[2],PSMALLINT);
+    CHECK_ARG(args[3],PSMALLINT);
+    uint8_t *buf = PSEQUENCE_BYTES(args[1]);
+    int bufsize = PSEQUENCE_ELEMENTS(args[1]);
+    int offset = PSMALLINT_VALUE(args[2]);
+    int count = PSMALLINT_VALUE(args[3]);
+    int items;
+    int citem;
+    int entries;
+    int mode;
+    int gsize;
+    int entry;
+    int row;
+    int i;
+    int err=0;
+    int owned;
+    uint8_t *rec;
+
+    PObject *tuple;
+    PObject *col;
+    *res = MAKE_NONE();
+    if (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1]))) return ERR_TYPE_EXC;
+
+    PackEntry *pes = pack_get_entries(args[0],&mode,&items,&entries,&gsize,&owned);
+    if(!pes || offset<0 || count<0 || count>0xffff || (int64_t)gsize*count>bufsize-offset){
+        err=1;
+        goto clean_up;
+    }
+
+    //allocate columns
+    tuple = ptuple_new(items,NULL);
+    citem = 0;
+    for(entry=0;entry<entries;entry++){
+        PackEntry *ee = &pes[entry];
+        if(ee->type==PACK_x) continue;
+        if(ee->type==PACK_e) {
+            //not supported!
+            err=1;
+            goto clean_up;
+        }
+        i = (ee->type==PACK_s||ee->type==PACK_p) ? 1:ee->count;
+        while(i--){
+            PTUPLE_SET_ITEM(tuple,citem,unpack_new_column(ee->type,count));
+            citem++;
+        }
+    }
+
+    for(row=0;row<count;row++){
+        rec = buf+offset+row*gsize;
+        citem = 0;
+        for(entry=0;entry<entries;entry++){
+            PackEntry *ee = &pes[entry];
+            rec+=ee->padding;
+            switch(ee->type){
+                case PACK_x:
+                    rec+=ee->size;
+                    break;
+                case PACK_c:
+                case PACK_B:
+                    //raw bytes, no objects
+                    for(i=0;i<ee->count;i++){
+                        col = PTUPLE_ITEM(tuple,citem++);
+                        _PMS_SET_BYTE(col,row,*rec++);
+                    }
+                    break;
+                case PACK_H:
+                    for(i=0;i<ee->count;i++){
+                        col = PTUPLE_ITEM(tuple,citem++);
+                        _PMS_SET_SHORT(col,row,pack_get_word(rec,2,packbige[mode]));
+                        rec+=2;
+                    }
+                    break;
+                case PACK_Q:
+                case PACK_q:
+                case PACK_b:
+                case PACK_h:
+                case PACK_i:
+                case PACK_l:
+                case PACK_n:
+                    //signed
+                    for(i=0;i<ee->count;i++){
+                        col = PTUPLE_ITEM(tuple,citem++);
+                        PLIST_SET_ITEM(col,row,unpack_make_integer(rec,packsize[ee->type],1,packbige[mode]));
+                        rec+=packsize[ee->type];
+                    }
+                    break;
+                case PACK_I:
+                case PACK_L:
+                case PACK_N:
+                case PACK_P:
+                    //unsigned
+                    for(i=0;i<ee->count;i++){
+                        col = PTUPLE_ITEM(tuple,citem++);
+                        PLIST_SET_ITEM(col,row,unpack_make_integer(rec,packsize[ee->type],0,packbige[mode]));
+                        rec+=packsize[ee->type];
+                    }
+                    break;
+                case PACK_f:
+                case PACK_d:
+                    for(i=0;i<ee->count;i++){
+                        col = PTUPLE_ITEM(tuple,citem++);
+                        PLIST_SET_ITEM(col,row,unpack_make_float(rec,packsize[ee->type],packbige[mode]));
+                        rec+=packsize[ee->type];
+                    }
+                    break;
+                case PACK_p:
+                case PACK_s:
+                    i = (ee->type==PACK_s) ? 0:1;
+                    col = PTUPLE_ITEM(tuple,citem++);
+                    PLIST_SET_ITEM(col,row,pstring_new(ee->size-i,rec+i));
+                    rec+=ee->size;
+                    break;
+                case PACK_bool:
+                    for(i=0;i<ee->count;i++){
+                        col = PTUPLE_ITEM(tuple,citem++);
+                        PLIST_SET_ITEM(col,row,(*rec++) ? PBOOL_TRUE():PBOOL_FALSE());
+                    }
+                    break;
+            }
+        }
+    }
+
+clean_up:
+
+    if(pes && owned) gc_free(pes);
+    if (err) *res=MAKE_NONE();
+    else *res = tuple;
+    return ERR_OK;
+}
@@ -0,0 +1,850 @@
+#include "zerynth.h"
+#include "../misc/zfloat.h"
+#include "../misc/snprintf.h"
+
+/*
+ * Preparsed format strings.
+ * A printf style ("%-8.3f") or str.format style ("{:<8.3f}") template is parsed once into a PBytes holding
+ * a header, an array of fields and the literal text; rendering walks the fields and writes each value straight
+ * into the output buffer, with no parsing and no intermediate string.
+ */
+
+#define TPL_PERCENT 0
+#define TPL_BRACES  1
+
+#define TPL_NONE (-1)   // no width or precision
+#define TPL_STAR (-2)   // width or precision taken from the arguments
+
+#define TPL_MAX_WIDTH 1024
+#define TPL_MAX_PREC  40
+
+// field flags
+#define TPL_PLUS  1
+#define TPL_SPACE 2
+#define TPL_ALT   4
+#define TPL_NAMED 8
+#define TPL_BRACE 16    // str.format field: strings default to left alignment
+
+// conversion of a str.format field without type: the value as str() would print it
+#define TPL_VALUE 'v'
+
+#if defined(Z_DOUBLE_FP)
+#define TPL_SINGLE 0
+#else
+#define TPL_SINGLE 1
+#endif
+
+typedef struct _tpl_field {
+    uint8_t type;       // conversion char, 0 for literal text
+    uint8_t flags;
+    uint8_t fill;
+    uint8_t align;      // '<', '>', '^', '=' or 0 for the default of the value
+    int16_t width;
+    int16_t prec;
+    uint16_t arg;       // literal: offset in the text; field: positional index, or name index with TPL_NAMED
+    uint16_t len;       // literal: length
+} TplField;
+
+typedef struct _tpl_header {
+    uint16_t fields;
+    uint16_t args;      // positional arguments needed, * included
+    uint16_t names;
+    uint16_t text;
+} TplHeader;
+
+#define TPL_FIELDS(h) ((TplField*)(((uint8_t*)(h))+sizeof(TplHeader)))
+#define TPL_TEXT(h) (((uint8_t*)TPL_FIELDS(h))+sizeof(TplField)*(h)->fields)
+
+/////////////////////COMPILE
+
+typedef struct _tpl_parse {
+    TplHeader h;
+    TplField *fields;
+    uint8_t *text;
+    uint16_t *names;    // offset and length in the format of each name
+    int autoidx;        // next automatic str.format index, -1 once numbered manually
+} TplParse;
+
+static void tpl_literal(TplParse *p, const uint8_t *s, int n)
+{
+    TplField *f = (p->h.fields) ? &p->fields[p->h.fields - 1] : NULL;
+    if (!n)
+        return;
+    if (!f || f->type || f->arg + f->len != p->h.text) {
+        f = &p->fields[p->h.fields++];
+        memset(f, 0, sizeof(TplField));
+        f->arg = p->h.text;
+    }
+    memcpy(p->text + p->h.text, s, n);
+    p->h.text += n;
+    f->len += n;
+}
+
+static TplField *tpl_field(TplParse *p, int flags)
+{
+    TplField *f = &p->fields[p->h.fields++];
+    f->type = TPL_VALUE;
+    f->flags = flags;
+    f->fill = ' ';
+    f->align = 0;
+    f->width = TPL_NONE;
+    f->prec = TPL_NONE;
+    f->arg = 0;
+    f->len = 0;
+    return f;
+}
+
+// decimal number at s[*i]; -1 if above limit
+static int tpl_number(const uint8_t *s, int n, int *i, int limit)
+{
+    int v = 0;
+    for (; *i < n && s[*i] >= '0' && s[*i] <= '9'; (*i)++) {
+        v = v * 10 + s[*i] - '0';
+        if (v > limit)
+            return -1;
+    }
+    return v;
+}
+
+static void tpl_name(TplParse *p, TplField *f, int ofs, int len)
+{
+    p->names[2 * p->h.names] = ofs;
+    p->names[2 * p->h.names + 1] = len;
+    f->flags |= TPL_NAMED;
+    f->arg = p->h.names++;
+}
+
+static int tpl_parse_percent(TplParse *p, const uint8_t *s, int n)
+{
+    TplField *f;
+    int i = 0, st, zero;
+
+    while (i < n) {
+        for (st = i; i < n && s[i] != '%'; i++);
+        tpl_literal(p, s + st, i - st);
+        if (i++ >= n)
+            break;
+        if (i >= n)
+            return -1;
+        if (s[i] == '%') {
+            tpl_literal(p, s + i++, 1);
+            continue;
+        }
+        f = tpl_field(p, 0);
+        f->align = '>';
+        zero = 0;
+        if (s[i] == '(') {
+            for (st = ++i; i < n && s[i] != ')'; i++);
+            if (i >= n)
+                return -1;
+            tpl_name(p, f, st, i - st);
+            i++;
+        }
+        for (; i < n; i++) {
+            if (s[i] == '-')
+                f->align = '<';
+            else if (s[i] == '0')
+                zero = 1;
+            else if (s[i] == '+')
+                f->flags |= TPL_PLUS;
+            else if (s[i] == ' ')
+                f->flags |= TPL_SPACE;
+            else if (s[i] == '#')
+                f->flags |= TPL_ALT;
+            else
+                break;
+        }
+        if (i < n && s[i] == '*') {
+            if (f->flags & TPL_NAMED)
+                return -1;
+            f->width = TPL_STAR;
+            p->h.args++;
+            i++;
+        } else if ((f->width = tpl_number(s, n, &i, TPL_MAX_WIDTH)) < 0) {
+            return -1;
+        }
+        if (i < n && s[i] == '.') {
+            i++;
+            if (i < n && s[i] == '*') {
+                if (f->flags & TPL_NAMED)
+                    return -1;
+                f->prec = TPL_STAR;
+                p->h.args++;
+                i++;
+            } else if ((f->prec = tpl_number(s, n, &i, TPL_MAX_PREC)) < 0) {
+                return -1;
+            }
+        }
+        // length modifiers mean nothing here
+        while (i < n && (s[i] == 'l' || s[i] == 'h' || s[i] == 'L'))
+            i++;
+        if (i >= n || !memchr("diuoxXeEfFgGcrsa", s[i], 16))
+            return -1;
+        f->type = s[i++];
+        if (f->type == 'i' || f->type == 'u')
+            f->type = 'd';
+        else if (f->type == 'r' || f->type == 'a')
+            f->type = 's';
+        if (zero && f->align != '<') {
+            f->align = '=';
+            f->fill = '0';
+        }
+        if (!(f->flags & TPL_NAMED))
+            f->arg = p->h.args++;
+    }
+    return 0;
+}
+
+static int tpl_parse_spec(TplField *f, const uint8_t *s, int n, int *pi)
+{
+    int i = *pi;
+    if (i + 1 < n && memchr("<>^=", s[i + 1], 4)) {
+        f->fill = s[i];
+        f->align = s[i + 1];
+        i += 2;
+    } else if (i < n && memchr("<>^=", s[i], 4)) {
+        f->align = s[i++];
+    }
+    if (i < n && (s[i] == '+' || s[i] == '-' || s[i] == ' ')) {
+        if (s[i] == '+')
+            f->flags |= TPL_PLUS;
+        else if (s[i] == ' ')
+            f->flags |= TPL_SPACE;
+        i++;
+    }
+    if (i < n && s[i] == '#') {
+        f->flags |= TPL_ALT;
+        i++;
+    }
+    if (i < n && s[i] == '0') {
+        if (!f->align) {
+            f->fill = '0';
+            f->align = '=';
+        }
+        i++;
+    }
+    if (i < n && s[i] >= '0' && s[i] <= '9') {
+        if ((f->width = tpl_number(s, n, &i, TPL_MAX_WIDTH)) < 0)
+            return -1;
+    }
+    if (i < n && s[i] == '.') {
+        i++;
+        if (i >= n || s[i] < '0' || s[i] > '9' || (f->prec = tpl_number(s, n, &i, TPL_MAX_PREC)) < 0)
+            return -1;
+    }
+    if (i < n && s[i] != '}') {
+        if (!memchr("bcdeEfFgGosxX%", s[i], 14))
+            return -1;
+        f->type = s[i++];
+    }
+    *pi = i;
+    return 0;
+}
+
+static int tpl_parse_braces(TplParse *p, const uint8_t *s, int n)
+{
+    TplField *f;
+    int i = 0, st, idx, arg;
+
+    while (i < n) {
+        for (st = i; i < n && s[i] != '{' && s[i] != '}'; i++);
+        tpl_literal(p, s + st, i - st);
+        if (i >= n)
+            break;
+        if (i + 1 < n && s[i + 1] == s[i]) {
+            // {{ and }}
+            tpl_literal(p, s + i, 1);
+            i += 2;
+            continue;
+        }
+        if (s[i++] == '}')
+            return -1;
+        f = tpl_field(p, TPL_BRACE);
+        for (st = i; i < n && s[i] != '}' && s[i] != ':' && s[i] != '!'; i++);
+        if (i == st) {
+            if (p->autoidx < 0)
+                return -1;
+            f->arg = p->autoidx++;
+            if (p->h.args < p->autoidx)
+                p->h.args = p->autoidx;
+        } else if (s[st] >= '0' && s[st] <= '9') {
+            if (p->autoidx > 0)
+                return -1;
+            p->autoidx = -1;
+            idx = st;
+            if ((arg = tpl_number(s, i, &idx, 0xfffe)) < 0 || idx != i)
+                return -1;
+            f->arg = arg;
+            if (p->h.args <= arg)
+                p->h.args = arg + 1;
+        } else {
+            tpl_name(p, f, st, i - st);
+        }
+        // !s, !r and !a are the same without reprs
+        if (i < n && s[i] == '!')
+            i += 2;
+        if (i < n && s[i] == ':') {
+            i++;
+            if (tpl_parse_spec(f, s, n, &i) < 0)
+                return -1;
+        }
+        if (i >= n || s[i] != '}')
+            return -1;
+        i++;
+    }
+    return 0;
+}
+
+/*
+ * args: fmt, style
+ * returns a tuple with the PBytes of the parsed template and the tuple of the field names
+ */
+C_NATIVE(_tpl_compile) {
+    NATIVE_UNWARN();
+    TplParse p;
+    TplHeader *h;
+    PObject *spec, *names;
+    uint8_t *fmt, *tmp;
+    int len, maxf = 1, i, err;
+
+    if (nargs != 2 || (PTYPE(args[0]) != PSTRING && PTYPE(args[0]) != PBYTES) || PTYPE(args[1]) != PSMALLINT)
+        return ERR_TYPE_EXC;
+    fmt = PSEQUENCE_BYTES(args[0]);
+    len = PSEQUENCE_ELEMENTS(args[0]);
+    // every field may split a literal in two
+    for (i = 0; i < len; i++) {
+        if (fmt[i] == '%' || fmt[i] == '{')
+            maxf += 2;
+    }
+    tmp = gc_malloc(maxf * (sizeof(TplField) + 2 * sizeof(uint16_t)) + len + 1);
+    memset(&p, 0, sizeof(p));
+    p.fields = (TplField*)tmp;
+    p.names = (uint16_t*)(tmp + maxf * sizeof(TplField));
+    p.text = tmp + maxf * (sizeof(TplField) + 2 * sizeof(uint16_t));
+
+    if (PSMALLINT_VALUE(args[1]) == TPL_BRACES)
+        err = tpl_parse_braces(&p, fmt, len);
+    else
+        err = tpl_parse_percent(&p, fmt, len);
+    if (err < 0) {
+        gc_free(tmp);
+        return ERR_VALUE_EXC;
+    }
+
+    spec = (PObject*)pbytes_new(sizeof(TplHeader) + sizeof(TplField) * p.h.fields + p.h.text, NULL);
+    h = (TplHeader*)PSEQUENCE_BYTES(spec);
+    memcpy(h, &p.h, sizeof(TplHeader));
+    memcpy(TPL_FIELDS(h), p.fields, sizeof(TplField) * p.h.fields);
+    memcpy(TPL_TEXT(h), p.text, p.h.text);
+
+    *res = (PObject*)ptuple_new(2, NULL);
+    PTUPLE_SET_ITEM(*res, 0, spec);
+    names = (PObject*)ptuple_new(p.h.names, NULL);
+    PTUPLE_SET_ITEM(*res, 1, names);
+    for (i = 0; i < p.h.names; i++)
+        PTUPLE_SET_ITEM(names, i, pstring_new(p.names[2 * i + 1], fmt + p.names[2 * i]));
+    gc_free(tmp);
+    return ERR_OK;
+}
+
+/////////////////////RENDER
+
+typedef struct _tpl_out {
+    uint8_t *buf;
+    int cap;
+    int len;
+} TplOut;
+
+// writes up to cap, counts everything
+static void tpl_put(TplOut *o, const uint8_t *s, int n)
+{
+    if (n > 0 && o->len < o->cap)
+        memcpy(o->buf + o->len, s, (n < o->cap - o->len) ? n : o->cap - o->len);
+    o->len += n;
+}
+
+static void tpl_fill(TplOut *o, uint8_t c, int n)
+{
+    for (; n > 0; n--, o->len++) {
+        if (o->len < o->cap)
+            o->buf[o->len] = c;
+    }
+}
+
+static void tpl_emit(TplOut *o, TplField *f, int width, const uint8_t *pre, int plen, const uint8_t *body, int blen, int numeric)
+{
+    int pad = width - plen - blen;
+    uint8_t align = f->align, fill = f->fill;
+
+    if (!align)
+        align = (numeric || !(f->flags & TPL_BRACE)) ? '>' : '<';
+    if (align == '=' && !numeric) {
+        align = '>';
+        fill = ' ';
+    }
+    if (pad < 0)
+        pad = 0;
+    if (align == '>' || align == '^')
+        tpl_fill(o, fill, (align == '^') ? pad / 2 : pad);
+    tpl_put(o, pre, plen);
+    if (align == '=')
+        tpl_fill(o, fill, pad);
+    tpl_put(o, body, blen);
+    if (align == '<' || align == '^')
+        tpl_fill(o, fill, (align == '^') ? pad - pad / 2 : pad);
+}
+
+static int tpl_get_int(PObject *o, int64_t *v)
+{
+    switch (PTYPE(o)) {
+        case PSMALLINT:
+            *v = PSMALLINT_VALUE(o);
+            return 0;
+        case PINTEGER:
+            *v = INTEGER_VALUE(o);
+            return 0;
+        case PBOOL:
+            *v = PBOOL_VALUE(o);
+            return 0;
+        case PFLOAT:
+            if (!(FLOAT_VALUE(o) > -9.2233720368547758e18 && FLOAT_VALUE(o) < 9.2233720368547758e18))
+                return -1;
+            *v = (int64_t)FLOAT_VALUE(o);
+            return 0;
+    }
+    return -1;
+}
+
+static int tpl_get_float(PObject *o, double *v)
+{
+    int64_t i;
+    if (PTYPE(o) == PFLOAT) {
+        *v = FLOAT_VALUE(o);
+        return 0;
+    }
+    if (tpl_get_int(o, &i) < 0)
+        return -1;
+    *v = (double)i;
+    return 0;
+}
+
+// digits of v in base, right aligned at end, at least mindigits long
+static int tpl_utoa(uint64_t v, int base, int upper, int mindigits, uint8_t *end)
+{
+    int n = 0, d;
+    do {
+        d = (int)(v % base);
+        *--end = (d < 10) ? '0' + d : ((upper) ? 'A' : 'a') + d - 10;
+        v /= base;
+        n++;
+    } while (v);
+    for (; n < mindigits; n++)
+        *--end = '0';
+    return n;
+}
+
+// the nsig significant digits of v > 0, rounded half up from its shortest digits; returns the decimal point position
+static int tpl_digits(double v, uint8_t *d, int nsig)
+{
+    int k, i, n = zf_shortest(v, TPL_SINGLE, (char*)d, &k), point = n + k;
+    if (n > nsig) {
+        if (d[nsig] >= '5') {
+            for (i = nsig - 1; i >= 0 && d[i] == '9'; i--)
+                d[i] = '0';
+            if (i < 0) {
+                d[0] = '1';
+                point++;
+            } else {
+                d[i]++;
+            }
+        }
+        n = nsig;
+    }
+    for (; n < nsig; n++)
+        d[n] = '0';
+    return point;
+}
+
+// fixed notation of the nsig digits d with the point after the point-th one, at least prec decimals
+static int tpl_fixed(uint8_t *out, const uint8_t *d, int nsig, int point, int prec)
+{
+    int i = 0, j;
+    if (point <= 0) {
+        out[i++] = '0';
+    } else {
+        for (j = 0; j < point; j++)
+            out[i++] = (j < nsig) ? d[j] : '0';
+    }
+    if (prec > 0) {
+        out[i++] = '.';
+        for (j = 0; j < prec; j++)
+            out[i++] = (point + j >= 0 && point + j < nsig) ? d[point + j] : '0';
+    }
+    return i;
+}
+
+static int tpl_exp(uint8_t *out, const uint8_t *d, int nsig, int exp, int alt, int upper)
+{
+    int i = 0;
+    out[i++] = d[0];
+    if (nsig > 1 || alt)
+        out[i++] = '.';
+    memcpy(out + i, d + 1, nsig - 1);
+    i += nsig - 1;
+    out[i++] = (upper) ? 'E' : 'e';
+    out[i++] = (exp < 0) ? '-' : '+';
+    if (exp < 0)
+        exp = -exp;
+    if (exp >= 100)
+        out[i++] = '0' + exp / 100;
+    out[i++] = '0' + (exp / 10) % 10;
+    out[i++] = '0' + exp % 10;
+    return i;
+}
+
+// strips the trailing zeros of the decimals in out[0:n], and the point if no decimal is left
+static int tpl_strip(uint8_t *out, int n)
+{
+    int i, e = n;
+    for (i = 0; i < n && out[i] != '.'; i++);
+    if (i == n)
+        return n;
+    for (e = i + 1; e < n && out[e] != 'e' && out[e] != 'E'; e++);
+    for (i = e; out[i - 1] == '0'; i--);
+    if (out[i - 1] == '.')
+        i--;
+    memmove(out + i, out + e, n - e);
+    return i + n - e;
+}
+
+// width of the biggest rendered number: 64 binary digits, or the fixed notation of 1e308 with TPL_MAX_PREC decimals
+#define TPL_NUM_SIZE (310 + TPL_MAX_PREC + 8)
+
+static err_t tpl_float(TplOut *o, TplField *f, double v, int width, int prec, uint8_t *num)
+{
+    uint8_t pre[2], d[TPL_MAX_PREC + 2];
+    int plen = 0, n, point, upper, type = f->type, percent = 0;
+
+    if (v < 0 || (v == 0 && 1 / v < 0)) {
+        pre[plen++] = '-';
+        v = -v;
+    } else if (f->flags & TPL_PLUS) {
+        pre[plen++] = '+';
+    } else if (f->flags & TPL_SPACE) {
+        pre[plen++] = ' ';
+    }
+    upper = (type == 'E' || type == 'F' || type == 'G');
+    if (type == '%') {
+        v *= 100;
+        percent = 1;
+        type = 'f';
+    }
+    if (!(v == v) || v > 1.7976931348623157e308) {
+        memcpy(num, (v == v) ? ((upper) ? "INF" : "inf") : ((upper) ? "NAN" : "nan"), 3);
+        n = 3;
+        if (percent)
+            num[n++] = '%';
+        tpl_emit(o, f, width, pre, plen, num, n, 1);
+        return ERR_OK;
+    }
+    if (type == TPL_VALUE && prec < 0) {
+        // as str() does
+        n = zf_format(v, TPL_SINGLE, (char*)num);
+        tpl_emit(o, f, width, pre, plen, num, n, 1);
+        return ERR_OK;
+    }
+    switch (type) {
+        case 'f':
+        case 'F':
+            if (prec < 0)
+                prec = 6;
+            if (v < 2147483647.0 && prec <= 9) {
+                // snprintf backend, exact for the integer part
+                n = snprintf((char*)num, TPL_NUM_SIZE, "%.*f", prec, v);
+            } else {
+                point = (v == 0) ? 1 : tpl_digits(v, d, 17);
+                n = tpl_fixed(num, d, (v == 0) ? 0 : 17, point, prec);
+            }
+            if (prec == 0 && (f->flags & TPL_ALT))
+                num[n++] = '.';
+            if (percent)
+                num[n++] = '%';
+            break;
+        case 'e':
+        case 'E':
+            if (prec < 0)
+                prec = 6;
+            if (v == 0) {
+                memset(d, '0', prec + 1);
+                point = 1;
+            } else {
+                point = tpl_digits(v, d, prec + 1);
+            }
+            n = tpl_exp(num, d, prec + 1, point - 1, f->flags & TPL_ALT, upper);
+            break;
+        default:
+            // g, G and the precision of untyped floats
+            if (prec < 0)
+                prec = 6;
+            if (prec == 0)
+                prec = 1;
+            if (v == 0) {
+                memset(d, '0', prec);
+                point = 1;
+            } else {
+                point = tpl_digits(v, d, prec);
+            }
+            if (point - 1 < -4 || point - 1 >= prec)
+                n = tpl_exp(num, d, prec, point - 1, f->flags & TPL_ALT, upper);
+            else
+                n = tpl_fixed(num, d, prec, point, prec - point);
+            if (!(f->flags & TPL_ALT))
+                n = tpl_strip(num, n);
+            if (type == TPL_VALUE && !memchr(num, '.', n) && !memchr(num, 'e', n)) {
+                // untyped floats keep a decimal
+                num[n++] = '.';
+                num[n++] = '0';
+            }
+            break;
+    }
+    tpl_emit(o, f, width, pre, plen, num, n, 1);
+    return ERR_OK;
+}
+
+static err_t tpl_int(TplOut *o, TplField *f, int64_t v, int width, int prec, uint8_t *num)
+{
+    uint8_t pre[4];
+    int plen = 0, n, base = 10;
+    uint64_t u;
+
+    if (v < 0) {
+        pre[plen++] = '-';
+        u = (uint64_t)0 - (uint64_t)v;
+    } else {
+        u = (uint64_t)v;
+        if (f->flags & TPL_PLUS)
+            pre[plen++] = '+';
+        else if (f->flags & TPL_SPACE)
+            pre[plen++] = ' ';
+    }
+    if (f->type == 'x' || f->type == 'X')
+        base = 16;
+    else if (f->type == 'o')
+        base = 8;
+    else if (f->type == 'b')
+        base = 2;
+    if (base != 10 && (f->flags & TPL_ALT)) {
+        pre[plen++] = '0';
+        pre[plen++] = (base == 16) ? f->type : ((base == 8) ? 'o' : 'b');
+    }
+    // the precision of % integers is a minimum number of digits
+    n = tpl_utoa(u, base, f->type == 'X', (f->flags & TPL_BRACE) ? 0 : prec, num + TPL_NUM_SIZE);
+    tpl_emit(o, f, width, pre, plen, num + TPL_NUM_SIZE - n, n, 1);
+    return ERR_OK;
+}
+
+static err_t tpl_value(TplOut *o, TplField *f, PObject *v, int width, int prec, uint8_t *num)
+{
+    int64_t iv;
+    double fv;
+    const uint8_t *s;
+    int n;
+
+    switch (f->type) {
+        case 'd':
+        case 'x':
+        case 'X':
+        case 'o':
+        case 'b':
+            if (tpl_get_int(v, &iv) < 0)
+                return ERR_TYPE_EXC;
+            if (PTYPE(v) == PFLOAT && (f->flags & TPL_BRACE))
+                return ERR_VALUE_EXC;
+            return tpl_int(o, f, iv, width, prec, num);
+        case 'c':
+            if (PTYPE(v) == PSTRING || PTYPE(v) == PBYTES) {
+                if (PSEQUENCE_ELEMENTS(v) < 1)
+                    return ERR_TYPE_EXC;
+                num[0] = PSEQUENCE_BYTES(v)[0];
+            } else {
+                if (tpl_get_int(v, &iv) < 0 || PTYPE(v) == PFLOAT)
+                    return ERR_TYPE_EXC;
+                if (iv < 0 || iv > 255)
+                    return ERR_OVERFLOW_EXC;
+                num[0] = (uint8_t)iv;
+            }
+            tpl_emit(o, f, width, NULL, 0, num, 1, 0);
+            return ERR_OK;
+        case 's':
+        case TPL_VALUE:
+            break;
+        default:
+            if (tpl_get_float(v, &fv) < 0)
+                return ERR_TYPE_EXC;
+            return tpl_float(o, f, fv, width, prec, num);
+    }
+
+    // s and untyped fields print the value as str() would
+    switch (PTYPE(v)) {
+        case PSTRING:
+        case PBYTES:
+        case PBYTEARRAY:
+            s = PSEQUENCE_BYTES(v);
+            n = PSEQUENCE_ELEMENTS(v);
+            break;
+        case PSMALLINT:
+        case PINTEGER:
+            if (f->type == TPL_VALUE)
+                return tpl_int(o, f, INTEGER_VALUE(v), width, TPL_NONE, num);
+            tpl_get_int(v, &iv);
+            n = tpl_utoa((iv < 0) ? (uint64_t)0 - (uint64_t)iv : (uint64_t)iv, 10, 0, 0, num + TPL_NUM_SIZE);
+            if (iv < 0)
+                num[TPL_NUM_SIZE - ++n] = '-';
+            s = num + TPL_NUM_SIZE - n;
+            break;
+        case PFLOAT:
+            if (f->type == TPL_VALUE)
+                return tpl_float(o, f, FLOAT_VALUE(v), width, prec, num);
+            n = zf_format(FLOAT_VALUE(v), TPL_SINGLE, (char*)num);
+            s = num;
+            break;
+        case PBOOL:
+            s = (const uint8_t*)((PBOOL_VALUE(v)) ? "True" : "False");
+            n = (PBOOL_VALUE(v)) ? 4 : 5;
+            break;
+        case PNONE:
+            s = (const uint8_t*)"None";
+            n = 4;
+            break;
+        default:
+            // the caller converts other objects with str()
+            return ERR_TYPE_EXC;
+    }
+    if (prec >= 0 && n > prec)
+        n = prec;
+    tpl_emit(o, f, width, NULL, 0, s, n, 0);
+    return ERR_OK;
+}
+
+static PObject *tpl_arg(PObject *args, int i)
+{
+    if (PTYPE(args) == PTUPLE)
+        return PTUPLE_ITEM(args, i);
+    return PLIST_ITEM(args, i);
+}
+
+static err_t tpl_render(TplHeader *h, PObject *names, PObject *args, TplOut *o)
+{
+    TplField *f = TPL_FIELDS(h), lf;
+    uint8_t *text = TPL_TEXT(h);
+    uint8_t num[TPL_NUM_SIZE];
+    PObject *v, *dict = NULL;
+    int nargs = PSEQUENCE_ELEMENTS(args), i, width, prec;
+    int64_t iv;
+    err_t err;
+
+    if (nargs < h->args)
+        return ERR_INDEX_EXC;
+    if (h->names) {
+        // named fields are looked up in the last argument
+        if (!nargs || PTYPE(tpl_arg(args, nargs - 1)) != PDICT)
+            return ERR_TYPE_EXC;
+        dict = tpl_arg(args, nargs - 1);
+    }
+    for (i = 0; i < h->fields; i++, f++) {
+        if (!f->type) {
+            tpl_put(o, text + f->arg, f->len);
+            continue;
+        }
+        width = f->width;
+        prec = f->prec;
+        if (width == TPL_STAR) {
+            if (tpl_get_int(tpl_arg(args, f->arg - 1 - (prec == TPL_STAR)), &iv) < 0)
+                return ERR_TYPE_EXC;
+            width = (iv < -TPL_MAX_WIDTH) ? TPL_MAX_WIDTH : ((iv > TPL_MAX_WIDTH) ? TPL_MAX_WIDTH : (int)((iv < 0) ? -iv : iv));
+            if (iv < 0 && f->align != '<') {
+                // a negative * width aligns left, as the - flag
+                lf = *f;
+                lf.align = '<';
+                lf.fill = ' ';
+                f = &lf;
+            }
+        }
+        if (prec == TPL_STAR) {
+            if (tpl_get_int(tpl_arg(args, f->arg - 1), &iv) < 0)
+                return ERR_TYPE_EXC;
+            prec = (iv < 0) ? TPL_NONE : ((iv > TPL_MAX_PREC) ? TPL_MAX_PREC : (int)iv);
+        }
+        if (f->flags & TPL_NAMED) {
+            v = pdict_get(dict, PTUPLE_ITEM(names, f->arg));
+            if (!v)
+                return ERR_KEY_EXC;
+        } else {
+            v = tpl_arg(args, f->arg);
+        }
+        err = tpl_value(o, f, v, width, prec, num);
+        if (err != ERR_OK)
+            return err;
+        f = TPL_FIELDS(h) + i;
+    }
+    return ERR_OK;
+}
+
+// renders short results on the stack, longer ones twice
+#define TPL_STACK_SIZE 96
+
+/*
+ * args: spec, names, args, dst, ofs
+ * dst None: returns the rendered string
+ * dst bytearray: writes at ofs, returns the number of written bytes, IndexError if it does not fit
+ */
+C_NATIVE(_tpl_render) {
+    NATIVE_UNWARN();
+    TplOut o;
+    uint8_t sbuf[TPL_STACK_SIZE];
+    TplHeader *h;
+    PObject *dst = args[3];
+    err_t err;
+    int ofs;
+
+    if (nargs != 5 || PTYPE(args[0]) != PBYTES || PTYPE(args[1]) != PTUPLE ||
+        (PTYPE(args[2]) != PTUPLE && PTYPE(args[2]) != PLIST) || PTYPE(args[4]) != PSMALLINT)
+        return ERR_TYPE_EXC;
+    h = (TplHeader*)PSEQUENCE_BYTES(args[0]);
+
+    if (PTYPE(dst) == PBYTEARRAY) {
+        ofs = PSMALLINT_VALUE(args[4]);
+        if (ofs < 0 || ofs > PSEQUENCE_ELEMENTS(dst))
+            return ERR_INDEX_EXC;
+        o.buf = PSEQUENCE_BYTES(dst) + ofs;
+        o.cap = PSEQUENCE_ELEMENTS(dst) - ofs;
+        o.len = 0;
+        err = tpl_render(h, args[1], args[2], &o);
+        if (err != ERR_OK)
+            return err;
+        if (o.len > o.cap)
+            return ERR_INDEX_EXC;
+        *res = PSMALLINT_NEW(o.len);
+        return ERR_OK;
+    }
+    if (dst != MAKE_NONE())
+        return ERR_TYPE_EXC;
+
+    o.buf = sbuf;
+    o.cap = TPL_STACK_SIZE;
+    o.len = 0;
+    err = tpl_render(h, args[1], args[2], &o);
+    if (err != ERR_OK)
+        return err;
+    if (o.len > 0xffff)
+        return ERR_OVERFLOW_EXC;
+    if (o.len <= o.cap) {
+        *res = (PObject*)pstring_new(o.len, sbuf);
+        return ERR_OK;
+    }
+    *res = (PObject*)pstring_new(o.len, NULL);
+    o.buf = PSEQUENCE_BYTES(*res);
+    o.cap = o.len;
+    o.len = 0;
+    return tpl_render(h, args[1], args[2], &o);
+}
@@ -0,0 +1,234 @@
+#include "zerynth.h"
+
+/*
+ * FIFO queue of Python objects for queue.Queue.
+ *
+ * A queue is a list [state, ring, items, slots]: the ring is a list used as a circular buffer, so that the queued
+ * objects stay visible to the gc, and state (head and count of the ring) lives in a bytearray. items counts the
+ * objects that can be taken and slots the free places of a bounded queue (None if unbounded, the ring grows instead).
+ * The ring is only touched with the GIL held, while waits on the semaphores release it: a put or a get is a single call.
+ */
+
+#define QUEUE_TAG           0x51554555  /* "QUEU" */
+#define QUEUE_MIN_RING      8
+#define QUEUE_MAX_RING      0xffff
+
+typedef struct _queue_state {
+    uint32_t tag;
+    int32_t head;
+    int32_t count;
+    int32_t maxsize;
+} QueueState;
+
+#define Q_STATE(q)  ((QueueState*)PSEQUENCE_BYTES(PLIST_ITEM(q, 0)))
+#define Q_RING(q)   PLIST_ITEM(q, 1)
+#define Q_ITEMS(q)  (((PSysObject*)PLIST_ITEM(q, 2))->sys.sem)
+#define Q_SLOTS(q)  (((PSysObject*)PLIST_ITEM(q, 3))->sys.sem)
+
+static int queue_check(PObject *q)
+{
+    PObject *st;
+
+    if (PTYPE(q) != PLIST || PSEQUENCE_ELEMENTS(q) != 4)
+        return 0;
+    st = PLIST_ITEM(q, 0);
+    return PTYPE(st) == PBYTEARRAY && PSEQUENCE_ELEMENTS(st) == (int32_t)sizeof(QueueState) && Q_STATE(q)->tag == QUEUE_TAG;
+}
+
+static uint32_t queue_timeout(int32_t timeout)
+{
+    if (timeout < 0)
+        return VTIME_INFINITE;
+    return TIME_U(timeout, MILLIS);
+}
+
+// waits for sem without the GIL: returns 0 if taken
+static int32_t queue_wait(VSemaphore sem, int32_t timeout)
+{
+    int32_t r;
+
+    RELEASE_GIL();
+    r = vosSemWaitTimeout(sem, queue_timeout(timeout));
+    ACQUIRE_GIL();
+    return r;
+}
+
+static PObject *queue_sem_new(int32_t value)
+{
+    PSysObject *oo = psysobj_new(PSYS_SEMAPHORE);
+    oo->sys.sem = vosSemCreate(value);
+    return (PObject*)oo;
+}
+
+// doubles the ring of an unbounded queue, keeping the order of the objects
+static int queue_grow(PObject *q)
+{
+    QueueState *st = Q_STATE(q);
+    PObject *ring = Q_RING(q);
+    int32_t cap = PSEQUENCE_ELEMENTS(ring);
+    int32_t ncap = 2 * cap, i;
+    PObject *nring;
+
+    if (cap >= QUEUE_MAX_RING)
+        return -1;
+    if (ncap > QUEUE_MAX_RING)
+        ncap = QUEUE_MAX_RING;
+    nring = (PObject*)plist_new(ncap, NULL);
+    for (i = 0; i < ncap; i++)
+        PLIST_SET_ITEM(nring, i, (i < st->count) ? PLIST_ITEM(ring, (st->head + i) % cap) : MAKE_NONE());
+    PLIST_SET_ITEM(q, 1, nring);
+    st->head = 0;
+    return 0;
+}
+
+/*
+ * args: maxsize
+ * returns a new queue, bounded to maxsize objects if maxsize>0
+ */
+C_NATIVE(_queue_new)
+{
+    C_NATIVE_UNWARN();
+    int32_t maxsize, cap, i;
+    PObject *q, *ring, *state;
+    QueueState *st;
+
+    if (parse_py_args("i", nargs, args, &maxsize) != 1)
+        return ERR_TYPE_EXC;
+    if (maxsize > QUEUE_MAX_RING)
+        return ERR_VALUE_EXC;
+    if (maxsize < 0)
+        maxsize = 0;
+    cap = maxsize ? maxsize : QUEUE_MIN_RING;
+
+    q = (PObject*)plist_new(4, NULL);
+    for (i = 0; i < 4; i++)
+        PLIST_SET_ITEM(q, i, MAKE_NONE());
+    *res = q;
+    state = (PObject*)psequence_new(PBYTEARRAY, sizeof(QueueState));
+    PSEQUENCE_ELEMENTS_SET(state, sizeof(QueueState));
+    PLIST_SET_ITEM(q, 0, state);
+    st = Q_STATE(q);
+    st->tag = QUEUE_TAG;
+    st->head = 0;
+    st->count = 0;
+    st->maxsize = maxsize;
+    ring = (PObject*)plist_new(cap, NULL);
+    for (i = 0; i < cap; i++)
+        PLIST_SET_ITEM(ring, i, MAKE_NONE());
+    PLIST_SET_ITEM(q, 1, ring);
+    PLIST_SET_ITEM(q, 2, queue_sem_new(0));
+    if (maxsize)
+        PLIST_SET_ITEM(q, 3, queue_sem_new(maxsize));
+    return ERR_OK;
+}
+
+/*
+ * args: q, obj, timeout
+ * appends obj, waiting at most timeout millis (forever if negative) for a free place.
+ * Returns False if the queue stayed full
+ */
+C_NATIVE(_queue_put)
+{
+    C_NATIVE_UNWARN();
+    PObject *q, *ring;
+    QueueState *st;
+    int32_t timeout;
+
+    if (nargs != 3 || !queue_check(args[0]) || !IS_PSMALLINT(args[2]))
+        return ERR_TYPE_EXC;
+    q = args[0];
+    timeout = PSMALLINT_VALUE(args[2]);
+    st = Q_STATE(q);
+
+    if (st->maxsize) {
+        if (queue_wait(Q_SLOTS(q), timeout) != VRES_OK) {
+            *res = PBOOL_FALSE();
+            return ERR_OK;
+        }
+    } else if (st->count == PSEQUENCE_ELEMENTS(Q_RING(q)) && queue_grow(q) < 0) {
+        return ERR_RUNTIME_EXC;
+    }
+    // the state may have changed while waiting
+    ring = Q_RING(q);
+    PLIST_SET_ITEM(ring, (st->head + st->count) % PSEQUENCE_ELEMENTS(ring), args[1]);
+    st->count++;
+    vosSemSignal(Q_ITEMS(q));
+    *res = PBOOL_TRUE();
+    return ERR_OK;
+}
+
+/*
+ * args: q, timeout, remove
+ * returns the object at the head, removed if remove is true, waiting at most timeout millis (forever if negative)
+ * for one. Returns q itself if the queue stayed empty
+ */
+C_NATIVE(_queue_get)
+{
+    C_NATIVE_UNWARN();
+    PObject *q, *ring;
+    QueueState *st;
+    int32_t timeout;
+
+    if (nargs != 3 || !queue_check(args[0]) || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    q = args[0];
+    timeout = PSMALLINT_VALUE(args[1]);
+    st = Q_STATE(q);
+
+    if (queue_wait(Q_ITEMS(q), timeout) != VRES_OK) {
+        *res = q;
+        return ERR_OK;
+    }
+    ring = Q_RING(q);
+    *res = PLIST_ITEM(ring, st->head);
+    if (args[2] == PBOOL_FALSE()) {
+        // peek: leave the object for the next get
+        vosSemSignal(Q_ITEMS(q));
+        return ERR_OK;
+    }
+    PLIST_SET_ITEM(ring, st->head, MAKE_NONE());
+    st->head = (st->head + 1) % PSEQUENCE_ELEMENTS(ring);
+    st->count--;
+    if (st->maxsize)
+        vosSemSignal(Q_SLOTS(q));
+    return ERR_OK;
+}
+
+/*
+ * args: q
+ * returns the number of queued objects
+ */
+C_NATIVE(_queue_size)
+{
+    C_NATIVE_UNWARN();
+    if (nargs != 1 || !queue_check(args[0]))
+        return ERR_TYPE_EXC;
+    *res = PSMALLINT_NEW(Q_STATE(args[0])->count);
+    return ERR_OK;
+}
+
+/*
+ * args: q
+ * removes the queued objects, except the ones already claimed by a get waiting for the GIL
+ */
+C_NATIVE(_queue_clear)
+{
+    C_NATIVE_UNWARN();
+    PObject *q, *ring;
+    QueueState *st;
+
+    if (nargs != 1 || !queue_check(args[0]))
+        return ERR_TYPE_EXC;
+    q = args[0];
+    st = Q_STATE(q);
+    ring = Q_RING(q);
+    while (st->count && vosSemTryWait(Q_ITEMS(q)) == VRES_OK) {
+        PLIST_SET_ITEM(ring, st->head, MAKE_NONE());
+        st->head = (st->head + 1) % PSEQUENCE_ELEMENTS(ring);
+        st->count--;
+        if (st->maxsize)
+            vosSemSignal(Q_SLOTS(q));
+    }
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
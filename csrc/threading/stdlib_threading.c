@@ -1,5 +1,14 @@
 #include "zerynth.h"
 
+//Enable/Disable tracing of the rtos primitives, independently from ZERYNTH_PRINTF:
+//it runs at every lock acquire and release
+#define RTOS_DEBUG 0
+
+#if !RTOS_DEBUG
+#undef printf
+#define printf(...)
+#endif
+
 #define RTOS__SEM_CREATE   0
 #define RTOS__SEM_SIGNAL   1
 #define RTOS__SEM_WAIT     2
@@ -234,3 +243,253 @@ C_NATIVE(__rtos_do) {
 
 }
 
+
+
+/*
+ * Direct natives for the hot paths of Lock, RLock, Semaphore, Condition and Event:
+ * fixed arguments, no vararg tuple and no dispatch.
+ */
+
+static uint32_t rtos_timeout(int32_t timeout)
+{
+    return timeout <= 0 ? VTIME_INFINITE : (uint32_t)TIME_U(timeout, MILLIS);
+}
+
+/*
+ * args: sem, blocking, timeout
+ * waits for sem at most timeout millis (forever if not positive), or just tries if not blocking.
+ * Returns True if taken
+ */
+C_NATIVE(__rtos_sem_acquire) {
+    NATIVE_UNWARN();
+    int32_t r;
+    if (nargs != 3)
+        return ERR_TYPE_EXC;
+    CHECK_ARG(args[0], PSYSOBJ);
+    CHECK_ARG(args[2], PSMALLINT);
+    VSemaphore sem = ((PSysObject *)args[0])->sys.sem;
+
+    if (args[1] == PBOOL_FALSE()) {
+        r = vosSemTryWait(sem);
+    } else {
+        RELEASE_GIL();
+        r = vosSemWaitTimeout(sem, rtos_timeout(PSMALLINT_VALUE(args[2])));
+        ACQUIRE_GIL();
+    }
+    *res = (r == VRES_OK) ? PBOOL_TRUE() : PBOOL_FALSE();
+    return ERR_OK;
+}
+
+/*
+ * args: sem, cap
+ * signals sem, without raising its count above cap if cap is positive
+ */
+C_NATIVE(__rtos_sem_release) {
+    NATIVE_UNWARN();
+    int32_t cap;
+    if (nargs != 2)
+        return ERR_TYPE_EXC;
+    CHECK_ARG(args[0], PSYSOBJ);
+    CHECK_ARG(args[1], PSMALLINT);
+    cap = PSMALLINT_VALUE(args[1]);
+    if (cap > 0)
+        vosSemSignalCap(((PSysObject *)args[0])->sys.sem, cap);
+    else
+        vosSemSignal(((PSysObject *)args[0])->sys.sem);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * no args: returns the id of the current thread
+ */
+C_NATIVE(__rtos_thread_id) {
+    NATIVE_UNWARN();
+    *res = PSMALLINT_NEW(vosThGetId(vosThCurrent()));
+    return ERR_OK;
+}
+
+/*
+ * args: evt, timeout
+ * waits for evt at most timeout millis (forever if not positive). Returns True if set
+ */
+C_NATIVE(__rtos_evt_wait) {
+    NATIVE_UNWARN();
+    int32_t r;
+    if (nargs != 2)
+        return ERR_TYPE_EXC;
+    CHECK_ARG(args[0], PSYSOBJ);
+    CHECK_ARG(args[1], PSMALLINT);
+    RELEASE_GIL();
+    r = vosEventWait(((PSysObject *)args[0])->sys.evt, rtos_timeout(PSMALLINT_VALUE(args[1])));
+    ACQUIRE_GIL();
+    *res = (r == VRES_OK) ? PBOOL_TRUE() : PBOOL_FALSE();
+    return ERR_OK;
+}
+
+/*
+ * args: evt
+ * sets evt, waking its waiters
+ */
+C_NATIVE(__rtos_evt_set) {
+    NATIVE_UNWARN();
+    if (nargs != 1)
+        return ERR_TYPE_EXC;
+    CHECK_ARG(args[0], PSYSOBJ);
+    vosEventSet(((PSysObject *)args[0])->sys.evt);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: evt
+ * clears evt
+ */
+C_NATIVE(__rtos_evt_clear) {
+    NATIVE_UNWARN();
+    if (nargs != 1)
+        return ERR_TYPE_EXC;
+    CHECK_ARG(args[0], PSYSOBJ);
+    vosEventClear(((PSysObject *)args[0])->sys.evt);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: evt
+ * returns True if evt is set
+ */
+C_NATIVE(__rtos_evt_is_set) {
+    NATIVE_UNWARN();
+    if (nargs != 1)
+        return ERR_TYPE_EXC;
+    CHECK_ARG(args[0], PSYSOBJ);
+    *res = (vosEventGetFlag(((PSysObject *)args[0])->sys.evt) == 1) ? PBOOL_TRUE() : PBOOL_FALSE();
+    return ERR_OK;
+}
+
+/*
+ * args: sem, n
+ * signals sem n times at once
+ */
+C_NATIVE(__rtos_sem_signal_n) {
+    NATIVE_UNWARN();
+    int32_t n;
+    if (nargs != 2)
+        return ERR_TYPE_EXC;
+    CHECK_ARG(args[0], PSYSOBJ);
+    CHECK_ARG(args[1], PSMALLINT);
+    VSemaphore sem = ((PSysObject *)args[0])->sys.sem;
+    SYSLOCK();
+    for (n = PSMALLINT_VALUE(args[1]); n > 0; n--)
+        vosSemSignalIsr(sem);
+    SYSUNLOCK();
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: lock, q, timeout
+ * wait of a condition variable: releases lock and waits for q at most timeout millis (forever if not positive),
+ * atomically if there is no timeout, then takes lock back. Returns True if q has been taken
+ */
+C_NATIVE(__rtos_cond_wait) {
+    NATIVE_UNWARN();
+    int32_t r, timeout;
+    if (nargs != 3)
+        return ERR_TYPE_EXC;
+    CHECK_ARG(args[0], PSYSOBJ);
+    CHECK_ARG(args[1], PSYSOBJ);
+    CHECK_ARG(args[2], PSMALLINT);
+    VSemaphore lock = ((PSysObject *)args[0])->sys.sem;
+    VSemaphore q = ((PSysObject *)args[1])->sys.sem;
+    timeout = PSMALLINT_VALUE(args[2]);
+
+    RELEASE_GIL();
+    if (timeout <= 0) {
+        r = vosSemSignalWait(lock, q);
+    } else {
+        vosSemSignal(lock);
+        r = vosSemWaitTimeout(q, rtos_timeout(timeout));
+    }
+    vosSemWait(lock);
+    ACQUIRE_GIL();
+    *res = (r == VRES_OK) ? PBOOL_TRUE() : PBOOL_FALSE();
+    return ERR_OK;
+}
+
+/*
+ * Stack painting: a thread fills the free part of its stack with a pattern as soon as it starts,
+ * and the words still holding it are counted later to find the deepest point ever reached.
+ * The stack top is not known to the VM: the part of the stack used before painting is assumed
+ * to be at most STACK_PAINT_RESERVE bytes.
+ */
+#if !defined(STACK_PAINT_RESERVE)
+#define STACK_PAINT_RESERVE 256
+#endif
+#define STACK_PAINT_WORD 0x5354434b  /* "STCK" */
+
+static PObject *rtos_addr_new(uint32_t addr)
+{
+    if (addr < 0x40000000)
+        return PSMALLINT_NEW(addr);
+    return (PObject*)pinteger_new(addr);
+}
+
+/*
+ * args: size
+ * paints the stack of the calling thread, of size bytes. Returns the address of the bottom
+ * of the painted region, or -1 if the stack is too small
+ */
+C_NATIVE(__rtos_stack_paint) {
+    NATIVE_UNWARN();
+    volatile uint32_t mark = 0;
+    uint32_t *top, *bottom, *p;
+    int32_t size;
+    if (nargs != 1)
+        return ERR_TYPE_EXC;
+    CHECK_ARG(args[0], PSMALLINT);
+    size = PSMALLINT_VALUE(args[0]);
+    if (size <= 2 * STACK_PAINT_RESERVE) {
+        *res = PSMALLINT_NEW(-1);
+        return ERR_OK;
+    }
+    // leave room below this frame for the loop itself
+    top = (uint32_t *)(((uint32_t)&mark - 64) & ~3);
+    bottom = top - (size - STACK_PAINT_RESERVE - 64) / 4;
+    for (p = bottom; p < top; p++)
+        *p = STACK_PAINT_WORD;
+    *res = rtos_addr_new((uint32_t)bottom);
+    return ERR_OK;
+}
+
+/*
+ * args: bottom, size
+ * returns the bytes of the region painted from bottom (by a thread with a stack of size bytes)
+ * that have never been used
+ */
+C_NATIVE(__rtos_stack_unused) {
+    NATIVE_UNWARN();
+    uint32_t *p, *end;
+    int32_t size;
+    if (nargs != 2 || !IS_INTEGER(args[0]))
+        return ERR_TYPE_EXC;
+    CHECK_ARG(args[1], PSMALLINT);
+    size = PSMALLINT_VALUE(args[1]);
+    p = (uint32_t *)INTEGER_VALUE(args[0]);
+    end = p + (size - STACK_PAINT_RESERVE - 64) / 4;
+    while (p < end && *p == STACK_PAINT_WORD)
+        p++;
+    *res = PSMALLINT_NEW((uint32_t)p - (uint32_t)INTEGER_VALUE(args[0]));
+    return ERR_OK;
+}
+
+/*
+ * no args: returns the milliseconds since boot
+ */
+C_NATIVE(__rtos_millis) {
+    NATIVE_UNWARN();
+    uint64_t ms = vosMillis();
+    *res = (ms < 0x40000000) ? PSMALLINT_NEW((uint32_t)ms) : (PObject*)pinteger_new(ms);
+    return ERR_OK;
+}
@@ -0,0 +1,52 @@
+#include "zerynth.h"
+
+/*
+ * Monotonic clocks of timers.monotonic_ms and timers.monotonic_us.
+ *
+ * Milliseconds come from the 64 bits vosMillis. Microseconds come from a system timer created at the first call,
+ * offset by the vosMillis of that moment so that both clocks share the origin: the 32 bits micros of the timer are
+ * placed around its 64 bits millis, as hwtimers does, so they never wrap.
+ */
+
+static VSysTimer clk_timer;
+static uint64_t clk_base;   // micros of the creation of clk_timer
+
+static uint64_t clk_micros(void)
+{
+    uint64_t ms, approx;
+    uint32_t us;
+
+    if (!clk_timer) {
+        clk_base = vosMillis() * 1000;
+        clk_timer = vosTimerCreate();
+    }
+    ms = vosTimerReadMillis(clk_timer);
+    us = vosTimerReadMicros(clk_timer);
+    approx = ms * 1000;
+    return clk_base + approx + (int32_t)(us - (uint32_t)approx);
+}
+
+static err_t clk_result(INT_TYPE t, PObject **res)
+{
+    if (t > -1073741824 && t < 1073741824)
+        *res = PSMALLINT_NEW(t);
+    else
+        *res = (PObject*)pinteger_new(t);
+    return ERR_OK;
+}
+
+/*
+ * no args: returns the monotonic clock in milliseconds, as wide as the VM integers
+ */
+C_NATIVE(_clk_ms) {
+    C_NATIVE_UNWARN();
+    return clk_result((INT_TYPE)vosMillis(), res);
+}
+
+/*
+ * no args: returns the monotonic clock in microseconds, as wide as the VM integers
+ */
+C_NATIVE(_clk_us) {
+    C_NATIVE_UNWARN();
+    return clk_result((INT_TYPE)clk_micros(), res);
+}
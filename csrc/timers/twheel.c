@@ -0,0 +1,289 @@
+#include "zerynth.h"
+
+/*
+ * Hierarchical timer wheel for timers.timer: a single recurrent system timer ticks the wheel, instead of a system timer
+ * per instance.
+ *
+ * Three levels of 64 slots cover 2^18 ticks, timers further away sit in the last level and are cascaded again.
+ * Slots are doubly linked lists of entries of a fixed pool, so arming and cancelling are O(1). Deadlines are absolute
+ * ticks: a periodic timer is re-armed at its previous deadline plus the period, not at the end of its callback.
+ * Expired entries are moved by the tick (in ISR) to the fired list, that the dispatcher thread drains with the GIL held
+ * and turns into callbacks. The wheel never references Python objects, timers.py maps entries to timer instances.
+ */
+
+#ifndef TW_TIMERS
+#define TW_TIMERS       64
+#endif
+
+#define TW_BITS         6
+#define TW_SLOTS        (1 << TW_BITS)
+#define TW_MASK         (TW_SLOTS - 1)
+#define TW_LEVELS       3
+#define TW_SPAN         (1 << (TW_BITS * TW_LEVELS))
+#define TW_FIRED        (TW_LEVELS * TW_SLOTS)  // list index of the fired list
+#define TW_NONE         -1     // entry free
+#define TW_IDLE         -2     // entry owned by a timer, not armed
+
+typedef struct _tw_entry {
+    uint32_t deadline;      // ticks
+    uint32_t period;        // ticks, 0 for one shot
+    int16_t next;
+    int16_t prev;
+    int16_t where;          // list the entry is in, or TW_NONE/TW_IDLE
+} TwEntry;
+
+static TwEntry tw_entries[TW_TIMERS];
+static int16_t tw_heads[TW_FIRED + 1];
+static int16_t tw_fired_tail;
+static uint32_t tw_now;
+static uint32_t tw_tick;    // millis
+static VSysTimer tw_vtm;
+static VSemaphore tw_sem;
+
+static void tw_link(int16_t i, int16_t where)
+{
+    TwEntry *e = &tw_entries[i];
+
+    e->where = where;
+    e->prev = TW_NONE;
+    if (where == TW_FIRED) {
+        // fifo, to keep the order of expiration
+        e->next = TW_NONE;
+        e->prev = tw_fired_tail;
+        if (tw_fired_tail == TW_NONE)
+            tw_heads[TW_FIRED] = i;
+        else
+            tw_entries[tw_fired_tail].next = i;
+        tw_fired_tail = i;
+        return;
+    }
+    e->next = tw_heads[where];
+    if (e->next != TW_NONE)
+        tw_entries[e->next].prev = i;
+    tw_heads[where] = i;
+}
+
+static void tw_unlink(int16_t i)
+{
+    TwEntry *e = &tw_entries[i];
+
+    if (e->prev == TW_NONE)
+        tw_heads[e->where] = e->next;
+    else
+        tw_entries[e->prev].next = e->next;
+    if (e->next != TW_NONE)
+        tw_entries[e->next].prev = e->prev;
+    else if (e->where == TW_FIRED)
+        tw_fired_tail = e->prev;
+    e->where = TW_NONE;
+}
+
+// places an entry in the slot of its deadline, or in the fired list if already expired
+static void tw_insert(int16_t i)
+{
+    TwEntry *e = &tw_entries[i];
+    int32_t delta = (int32_t)(e->deadline - tw_now);
+    uint32_t at = e->deadline;
+    int level;
+
+    if (delta <= 0) {
+        tw_link(i, TW_FIRED);
+        return;
+    }
+    if (delta >= TW_SPAN) {
+        // cascaded again when its slot comes
+        delta = TW_SPAN - 1;
+        at = tw_now + delta;
+    }
+    for (level = 0; level < TW_LEVELS - 1 && delta >= (1 << (TW_BITS * (level + 1))); level++);
+    tw_link(i, level * TW_SLOTS + ((at >> (TW_BITS * level)) & TW_MASK));
+}
+
+// moves the entries of a slot of an upper level to the lower ones
+static void tw_cascade(int level)
+{
+    int16_t where = level * TW_SLOTS + ((tw_now >> (TW_BITS * level)) & TW_MASK);
+    int16_t i;
+
+    while ((i = tw_heads[where]) != TW_NONE) {
+        tw_unlink(i);
+        tw_insert(i);
+    }
+}
+
+static void tw_tick_isr(void *arg)
+{
+    (void)arg;
+    int level, idle;
+    int16_t i;
+
+    SYSLOCK_I();
+    idle = tw_heads[TW_FIRED] == TW_NONE;
+    tw_now++;
+    // from the highest level, so that entries reach their slot in the same tick
+    for (level = 1; level < TW_LEVELS && !(tw_now & ((1 << (TW_BITS * level)) - 1)); level++);
+    while (--level > 0)
+        tw_cascade(level);
+    while ((i = tw_heads[tw_now & TW_MASK]) != TW_NONE) {
+        tw_unlink(i);
+        tw_insert(i);
+    }
+    // the dispatcher drains the whole list at each wake up
+    if (idle && tw_heads[TW_FIRED] != TW_NONE)
+        vosSemSignalIsr(tw_sem);
+    SYSUNLOCK_I();
+}
+
+static uint32_t tw_ticks(int32_t millis)
+{
+    return (millis + tw_tick - 1) / tw_tick;
+}
+
+static int tw_check(PObject *id)
+{
+    int32_t i;
+
+    if (!IS_PSMALLINT(id))
+        return 0;
+    i = PSMALLINT_VALUE(id);
+    return i < TW_TIMERS && (i < 0 || tw_entries[i].where != TW_NONE);
+}
+
+/*
+ * args: tick
+ * starts the wheel, ticking every tick millis, if not already started. Returns the number of entries
+ */
+C_NATIVE(_tw_init)
+{
+    C_NATIVE_UNWARN();
+    int32_t tick, i;
+
+    if (parse_py_args("i", nargs, args, &tick) != 1)
+        return ERR_TYPE_EXC;
+    if (tick <= 0)
+        return ERR_VALUE_EXC;
+    *res = PSMALLINT_NEW(TW_TIMERS);
+    if (tw_vtm)
+        return ERR_OK;
+    for (i = 0; i < TW_TIMERS; i++)
+        tw_entries[i].where = TW_NONE;
+    for (i = 0; i <= TW_FIRED; i++)
+        tw_heads[i] = TW_NONE;
+    tw_fired_tail = TW_NONE;
+    tw_now = 0;
+    tw_tick = tick;
+    tw_sem = vosSemCreate(0);
+    tw_vtm = vosTimerCreate();
+    SYSLOCK();
+    vosTimerRecurrent(tw_vtm, TIME_U(tick, MILLIS), tw_tick_isr, NULL);
+    SYSUNLOCK();
+    return ERR_OK;
+}
+
+/*
+ * args: id, delay, period
+ * arms entry id (a new one if id is negative) to expire after delay millis, then every period millis if period>0.
+ * Returns the entry id
+ */
+C_NATIVE(_tw_arm)
+{
+    C_NATIVE_UNWARN();
+    int32_t id, delay, period;
+    TwEntry *e;
+
+    if (nargs != 3 || !tw_check(args[0]) || !IS_PSMALLINT(args[1]) || !IS_PSMALLINT(args[2]))
+        return ERR_TYPE_EXC;
+    if (!tw_vtm)
+        return ERR_RUNTIME_EXC;
+    id = PSMALLINT_VALUE(args[0]);
+    delay = PSMALLINT_VALUE(args[1]);
+    period = PSMALLINT_VALUE(args[2]);
+    if (delay < 0 || period < 0)
+        return ERR_VALUE_EXC;
+    if (id < 0) {
+        for (id = 0; id < TW_TIMERS && tw_entries[id].where != TW_NONE; id++);
+        if (id == TW_TIMERS)
+            return ERR_RUNTIME_EXC;
+        tw_entries[id].where = TW_IDLE;
+    }
+    e = &tw_entries[id];
+    SYSLOCK();
+    if (e->where >= 0)
+        tw_unlink(id);
+    e->period = period ? tw_ticks(period) : 0;
+    e->deadline = tw_now + (delay ? tw_ticks(delay) : 1);
+    tw_insert(id);
+    SYSUNLOCK();
+    *res = PSMALLINT_NEW(id);
+    return ERR_OK;
+}
+
+/*
+ * args: id, release
+ * disarms entry id, and gives it back to the pool if release is true
+ */
+C_NATIVE(_tw_cancel)
+{
+    C_NATIVE_UNWARN();
+    int32_t id;
+
+    if (nargs != 2 || !tw_check(args[0]))
+        return ERR_TYPE_EXC;
+    id = PSMALLINT_VALUE(args[0]);
+    *res = MAKE_NONE();
+    if (id < 0)
+        return ERR_OK;
+    SYSLOCK();
+    if (tw_entries[id].where >= 0)
+        tw_unlink(id);
+    tw_entries[id].where = (args[1] == PBOOL_TRUE()) ? TW_NONE : TW_IDLE;
+    SYSUNLOCK();
+    return ERR_OK;
+}
+
+/*
+ * args: timeout
+ * waits at most timeout millis (forever if negative) for expired entries and returns the list of their ids, in order
+ * of expiration. Periodic entries are armed again at their next deadline, skipping the ones already passed
+ */
+C_NATIVE(_tw_fired)
+{
+    C_NATIVE_UNWARN();
+    int32_t timeout, n, k;
+    int16_t ids[TW_TIMERS];
+    int16_t i;
+    TwEntry *e;
+    PList *lst;
+
+    if (parse_py_args("i", nargs, args, &timeout) != 1)
+        return ERR_TYPE_EXC;
+    if (!tw_vtm)
+        return ERR_RUNTIME_EXC;
+    RELEASE_GIL();
+    vosSemWaitTimeout(tw_sem, (timeout < 0) ? VTIME_INFINITE : TIME_U(timeout, MILLIS));
+    ACQUIRE_GIL();
+
+    n = 0;
+    SYSLOCK();
+    while ((i = tw_heads[TW_FIRED]) != TW_NONE) {
+        e = &tw_entries[i];
+        tw_unlink(i);
+        ids[n++] = i;
+        if (!e->period) {
+            e->where = TW_IDLE;
+            continue;
+        }
+        e->deadline += e->period;
+        k = (int32_t)(tw_now - e->deadline);
+        if (k >= 0)
+            e->deadline += (k / e->period + 1) * e->period;
+        tw_insert(i);
+    }
+    SYSUNLOCK();
+
+    lst = plist_new(n, NULL);
+    for (k = 0; k < n; k++)
+        PLIST_SET_ITEM(lst, k, PSMALLINT_NEW(ids[k]));
+    *res = (PObject*)lst;
+    return ERR_OK;
+}
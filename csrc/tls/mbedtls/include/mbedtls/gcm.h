@@ -50,6 +50,10 @@ typedef struct {
     unsigned char y[16];        /*!< Y working value */
     unsigned char buf[16];      /*!< buf working value */
     int mode;                   /*!< Encrypt or Decrypt */
+#if defined(ZERYNTH_HWCRYPTO_ENABLE_AES_GCM)
+    unsigned char hw_key[32];   /*!< AES key for the hardware engine */
+    unsigned int hw_keybits;    /*!< 0 if the cipher is not AES */
+#endif
 }
 mbedtls_gcm_context;
 
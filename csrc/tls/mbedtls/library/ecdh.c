@@ -38,6 +38,10 @@
 
 #include <string.h>
 
+#if defined(ZERYNTH_SSL) && defined(ZERYNTH_SSL_ECDHE_POOL)
+int mbedtls_ecdhe_pool_take( mbedtls_ecp_group *grp, mbedtls_mpi *d, mbedtls_ecp_point *Q );
+#endif
+
 /*
  * Generate public key: simple wrapper around mbedtls_ecp_gen_keypair
  */
@@ -45,6 +49,11 @@ int mbedtls_ecdh_gen_public( mbedtls_ecp_group *grp, mbedtls_mpi *d, mbedtls_ecp
                      int (*f_rng)(void *, unsigned char *, size_t),
                      void *p_rng )
 {
+#if defined(ZERYNTH_SSL) && defined(ZERYNTH_SSL_ECDHE_POOL)
+    /* P-256 key pair generated ahead of time by the zsockets idle thread */
+    if( mbedtls_ecdhe_pool_take( grp, d, Q ) == 0 )
+        return( 0 );
+#endif
     return mbedtls_ecp_gen_keypair( grp, d, Q, f_rng, p_rng );
 }
 
@@ -226,6 +226,26 @@ int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
      */
     MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, Q ) );
 
+#if defined(ZERYNTH_HWCRYPTO_ENABLE_ECDSA_VERIFY)
+    /* whole verification on the engine: 0 valid, 1 invalid, else software */
+    if( grp->id == MBEDTLS_ECP_DP_SECP256R1 && ZERYNTH_HWCRYPTO_ACCEL() &&
+        ZERYNTH_HWCRYPTO_ACCEL()->ecdsa_secp256r1_verify )
+    {
+        unsigned char hwq[64], hwrs[64];
+        int hwret;
+        MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( &Q->X, hwq, 32 ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( &Q->Y, hwq + 32, 32 ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( r, hwrs, 32 ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( s, hwrs + 32, 32 ) );
+        hwret = ZERYNTH_HWCRYPTO_ACCEL()->ecdsa_secp256r1_verify( hwq, buf, blen, hwrs );
+        if( hwret == 0 || hwret == 1 )
+        {
+            ret = ( hwret == 0 ) ? 0 : MBEDTLS_ERR_ECP_VERIFY_FAILED;
+            goto cleanup;
+        }
+    }
+#endif
+
     /*
      * Step 3: derive MPI from hashed message
      */
@@ -1689,6 +1689,29 @@ int mbedtls_ecp_mul( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
         ( ret = mbedtls_ecp_check_pubkey( grp, P ) ) != 0 )
         return( ret );
 
+#if defined(ZERYNTH_HWCRYPTO_ENABLE_ECP_MUL)
+    /* P-256 scalar multiplication on the engine: ECDH key pairs and shared secrets */
+    if( grp->id == MBEDTLS_ECP_DP_SECP256R1 && ZERYNTH_HWCRYPTO_ACCEL() &&
+        ZERYNTH_HWCRYPTO_ACCEL()->ecp_secp256r1_mul )
+    {
+        unsigned char hwk[32], hwp[64];
+        int hwret = -1;
+        if( mbedtls_mpi_write_binary( m, hwk, 32 ) == 0 &&
+            mbedtls_mpi_write_binary( &P->X, hwp, 32 ) == 0 &&
+            mbedtls_mpi_write_binary( &P->Y, hwp + 32, 32 ) == 0 )
+            hwret = ZERYNTH_HWCRYPTO_ACCEL()->ecp_secp256r1_mul( hwk, hwp, hwp );
+        mbedtls_zeroize( hwk, sizeof( hwk ) );
+        if( hwret == 0 )
+        {
+            if( ( ret = mbedtls_mpi_read_binary( &R->X, hwp, 32 ) ) != 0 ||
+                ( ret = mbedtls_mpi_read_binary( &R->Y, hwp + 32, 32 ) ) != 0 ||
+                ( ret = mbedtls_mpi_lset( &R->Z, 1 ) ) != 0 )
+                return( ret );
+            return( 0 );
+        }
+    }
+#endif
+
 #if defined(MBEDTLS_ECP_INTERNAL_ALT)
     if ( is_grp_capable = mbedtls_internal_ecp_grp_capable( grp )  )
     {
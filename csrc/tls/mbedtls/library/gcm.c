@@ -187,6 +187,15 @@ int mbedtls_gcm_setkey( mbedtls_gcm_context *ctx,
     if( ( ret = gcm_gen_table( ctx ) ) != 0 )
         return( ret );
 
+#if defined(ZERYNTH_HWCRYPTO_ENABLE_AES_GCM)
+    ctx->hw_keybits = 0;
+    if( cipher == MBEDTLS_CIPHER_ID_AES && keybits <= 256 )
+    {
+        memcpy( ctx->hw_key, key, keybits / 8 );
+        ctx->hw_keybits = keybits;
+    }
+#endif
+
     return( 0 );
 }
 
@@ -454,6 +463,16 @@ int mbedtls_gcm_crypt_and_tag( mbedtls_gcm_context *ctx,
 {
     int ret;
 
+#if defined(ZERYNTH_HWCRYPTO_ENABLE_AES_GCM)
+    /* one shot on the engine, software if it can't handle the request */
+    if( ctx->hw_keybits && ZERYNTH_HWCRYPTO_ACCEL() && ZERYNTH_HWCRYPTO_ACCEL()->aes_gcm_crypt )
+    {
+        if( ZERYNTH_HWCRYPTO_ACCEL()->aes_gcm_crypt( mode, ctx->hw_key, ctx->hw_keybits, iv, iv_len,
+                                                     add, add_len, input, length, output, tag, tag_len ) == 0 )
+            return( 0 );
+    }
+#endif
+
     if( ( ret = mbedtls_gcm_starts( ctx, mode, iv, iv_len, add, add_len ) ) != 0 )
         return( ret );
 
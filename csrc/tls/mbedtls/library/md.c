@@ -167,17 +167,21 @@ const mbedtls_md_info_t *mbedtls_md_info_from_type( mbedtls_md_type_t md_type )
             return( &mbedtls_sha224_info );
         case MBEDTLS_MD_SHA256:
 #if defined(ZERYNTH_HWCRYPTO_ENABLE_SHA256)
-            if (ZERYNTH_HWCRYPTO_ENABLED() && ZERYNTH_HWCRYPTO_API()->digest_sha256) {
+        {
+            /* hardware key api first, then the accelerators */
+            ZHWCryptoAPIPointers *hw = ZERYNTH_HWCRYPTO_ENABLED() ? ZERYNTH_HWCRYPTO_API() : ZERYNTH_HWCRYPTO_ACCEL();
+            if (hw && hw->digest_sha256) {
                 if (mbedtls_sha256_hwcrypto_info.digest_func == NULL) {
-                    mbedtls_sha256_hwcrypto_info.starts_func = ZERYNTH_HWCRYPTO_API()->digest_sha256_starts;
-                    mbedtls_sha256_hwcrypto_info.update_func = ZERYNTH_HWCRYPTO_API()->digest_sha256_update;
-                    mbedtls_sha256_hwcrypto_info.finish_func = ZERYNTH_HWCRYPTO_API()->digest_sha256_finish;
-                    mbedtls_sha256_hwcrypto_info.ctx_alloc_func = ZERYNTH_HWCRYPTO_API()->digest_sha256_ctx_alloc;
-                    mbedtls_sha256_hwcrypto_info.ctx_free_func = ZERYNTH_HWCRYPTO_API()->digest_sha256_ctx_free;
-                    mbedtls_sha256_hwcrypto_info.digest_func = ZERYNTH_HWCRYPTO_API()->digest_sha256;
+                    mbedtls_sha256_hwcrypto_info.starts_func = hw->digest_sha256_starts;
+                    mbedtls_sha256_hwcrypto_info.update_func = hw->digest_sha256_update;
+                    mbedtls_sha256_hwcrypto_info.finish_func = hw->digest_sha256_finish;
+                    mbedtls_sha256_hwcrypto_info.ctx_alloc_func = hw->digest_sha256_ctx_alloc;
+                    mbedtls_sha256_hwcrypto_info.ctx_free_func = hw->digest_sha256_ctx_free;
+                    mbedtls_sha256_hwcrypto_info.digest_func = hw->digest_sha256;
                 }
                 return (&mbedtls_sha256_hwcrypto_info) ;
             }
+        }
 #endif
             return( &mbedtls_sha256_info );
 #endif
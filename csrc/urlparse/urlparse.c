@@ -0,0 +1,240 @@
+#include "zerynth.h"
+
+/*
+ * URL splitting and percent encoding. Components are found in a single scan and
+ * returned as slices over the input, so that only the ones needed are copied.
+ */
+
+// spans of urlparse_split: scheme, netloc, path, query, fragment, user, password, host, port
+#define UP_SPANS 9
+
+static const uint8_t up_hex[] = "0123456789ABCDEF";
+
+static int up_scheme_char(uint8_t c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '+' || c == '-' || c == '.';
+}
+
+static int up_safe(uint8_t c, int32_t plus)
+{
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))
+        return 1;
+    switch (c) {
+        case '$': case '-': case '_': case '.': case '!': case '*': case '\'': case '(': case ')':
+            return 1;
+        case '+':
+            return plus;
+    }
+    return 0;
+}
+
+static int32_t up_hexval(uint8_t c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// splits [a,b) of s as [user[:password]@]host[:port], hosts in brackets being IPv6 literals
+static void up_netloc(uint8_t *s, int32_t a, int32_t b, int32_t *sp)
+{
+    int32_t i, at = -1, h;
+
+    for (i = a; i < b; i++) {
+        if (s[i] == '@')
+            at = i;
+    }
+    if (at >= 0) {
+        for (i = a; i < at && s[i] != ':'; i++);
+        sp[0] = a; sp[1] = i;
+        sp[2] = (i < at) ? i + 1 : at; sp[3] = at;
+        h = at + 1;
+    } else {
+        sp[0] = sp[1] = sp[2] = sp[3] = a;
+        h = a;
+    }
+    if (h < b && s[h] == '[') {
+        for (i = h; i < b && s[i] != ']'; i++);
+        if (i < b) {
+            sp[4] = h + 1; sp[5] = i;
+            i++;
+            sp[6] = (i < b && s[i] == ':') ? i + 1 : b; sp[7] = b;
+            return;
+        }
+    }
+    for (i = h; i < b && s[i] != ':'; i++);
+    sp[4] = h; sp[5] = i;
+    sp[6] = (i < b) ? i + 1 : b; sp[7] = b;
+}
+
+/*
+ * args: url, netloc_only
+ * returns a tuple of slices selecting in url: scheme, netloc, path, query, fragment, user, password, host and port.
+ * With netloc_only, url is a netloc and only its 4 components are returned
+ */
+C_NATIVE(urlparse_split)
+{
+    C_NATIVE_UNWARN();
+    uint8_t *s;
+    int32_t n, netloc_only, i, p, q, cnt;
+    int32_t sp[2 * UP_SPANS];
+    PObject *tpl;
+
+    if (parse_py_args("si", nargs, args, &s, &n, &netloc_only) != 2)
+        return ERR_TYPE_EXC;
+
+    if (netloc_only) {
+        up_netloc(s, 0, n, sp + 10);
+        i = 5;
+    } else {
+        //scheme only if followed by ://
+        for (i = 0; i < n && up_scheme_char(s[i]); i++);
+        if (i > 0 && i + 3 <= n && s[i] == ':' && s[i + 1] == '/' && s[i + 2] == '/') {
+            sp[0] = 0; sp[1] = i;
+            p = i + 3;
+        } else {
+            sp[0] = sp[1] = 0;
+            p = 0;
+        }
+        for (q = p; q < n && s[q] != '/' && s[q] != '?' && s[q] != '#'; q++);
+        sp[2] = p; sp[3] = q;
+        for (p = q; p < n && s[p] != '?' && s[p] != '#'; p++);
+        sp[4] = q; sp[5] = p;
+        if (p < n && s[p] == '?') {
+            for (q = p + 1; q < n && s[q] != '#'; q++);
+            sp[6] = p + 1; sp[7] = q;
+            p = q;
+        } else {
+            sp[6] = sp[7] = p;
+        }
+        sp[8] = (p < n) ? p + 1 : n; sp[9] = n;
+        up_netloc(s, sp[2], sp[3], sp + 10);
+        i = 0;
+    }
+    cnt = UP_SPANS - i;
+    tpl = (PObject*)ptuple_new(cnt, NULL);
+    for (p = 0; p < cnt; p++)
+        PTUPLE_SET_ITEM(tpl, p, (PObject*)pslice_new(PSMALLINT_NEW(sp[2 * (i + p)]), PSMALLINT_NEW(sp[2 * (i + p) + 1]), PSMALLINT_NEW(1)));
+    *res = tpl;
+    return ERR_OK;
+}
+
+static int32_t up_quote(uint8_t *s, int32_t n, int32_t plus, uint8_t *out)
+{
+    int32_t i, len = 0;
+
+    for (i = 0; i < n; i++) {
+        if (up_safe(s[i], plus)) {
+            if (out) out[len] = s[i];
+            len++;
+        } else {
+            if (out) {
+                out[len] = '%';
+                out[len + 1] = up_hex[s[i] >> 4];
+                out[len + 2] = up_hex[s[i] & 15];
+            }
+            len += 3;
+        }
+    }
+    return len;
+}
+
+/*
+ * args: s, plus
+ * returns s percent encoded, with + left as is if plus is true
+ */
+C_NATIVE(urlparse_quote)
+{
+    C_NATIVE_UNWARN();
+    uint8_t *s;
+    int32_t n, plus;
+    PObject *out;
+
+    if (parse_py_args("si", nargs, args, &s, &n, &plus) != 2)
+        return ERR_TYPE_EXC;
+    out = (PObject*)pstring_new(up_quote(s, n, plus, NULL), NULL);
+    up_quote(s, n, plus, PSEQUENCE_BYTES(out));
+    *res = out;
+    return ERR_OK;
+}
+
+/*
+ * args: s
+ * returns s with %xx sequences decoded and + replaced by spaces. Bad % sequences are left as they are
+ */
+C_NATIVE(urlparse_unquote)
+{
+    C_NATIVE_UNWARN();
+    uint8_t *s, *o;
+    int32_t n, i, len, pass, h, l;
+    PObject *out = NULL;
+
+    if (parse_py_args("s", nargs, args, &s, &n) != 1)
+        return ERR_TYPE_EXC;
+    //first pass counts, second pass writes
+    for (pass = 0; pass < 2; pass++) {
+        o = (pass) ? PSEQUENCE_BYTES(out) : NULL;
+        len = 0;
+        for (i = 0; i < n; i++) {
+            if (s[i] == '%' && i + 2 < n) {
+                h = up_hexval(s[i + 1]);
+                l = up_hexval(s[i + 2]);
+                if (h >= 0 && l >= 0) {
+                    if (o) o[len] = (h << 4) | l;
+                    len++;
+                    i += 2;
+                    continue;
+                }
+            }
+            if (o) o[len] = (s[i] == '+') ? ' ' : s[i];
+            len++;
+        }
+        if (!pass)
+            out = (PObject*)pstring_new(len, NULL);
+    }
+    *res = out;
+    return ERR_OK;
+}
+
+/*
+ * args: items, plus
+ * items is a list of strings [key, value, key, value...]: returns the query string key=value&key=value...
+ * Keys are quoted leaving +, values leaving + only if plus is true
+ */
+C_NATIVE(urlparse_urlencode)
+{
+    C_NATIVE_UNWARN();
+    PObject *items, *o, *out = NULL;
+    uint8_t *b = NULL;
+    int32_t i, n, pass, len, plus;
+
+    if (nargs != 2 || (PTYPE(args[0]) != PLIST && PTYPE(args[0]) != PTUPLE) || !IS_PSMALLINT(args[1]))
+        return ERR_TYPE_EXC;
+    items = args[0];
+    plus = PSMALLINT_VALUE(args[1]);
+    n = PSEQUENCE_ELEMENTS(items);
+    if (n & 1)
+        return ERR_VALUE_EXC;
+    for (i = 0; i < n; i++) {
+        if (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(PSEQUENCE_OBJECTS(items)[i])))
+            return ERR_TYPE_EXC;
+    }
+    for (pass = 0; pass < 2; pass++) {
+        len = 0;
+        for (i = 0; i < n; i++) {
+            o = PSEQUENCE_OBJECTS(items)[i];
+            if (i) {
+                if (b) b[len] = (i & 1) ? '=' : '&';
+                len++;
+            }
+            len += up_quote(PSEQUENCE_BYTES(o), PSEQUENCE_ELEMENTS(o), (i & 1) ? plus : 1, b ? b + len : NULL);
+        }
+        if (!pass) {
+            out = (PObject*)pstring_new(len, NULL);
+            b = PSEQUENCE_BYTES(out);
+        }
+    }
+    *res = out;
+    return ERR_OK;
+}
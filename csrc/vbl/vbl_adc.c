@@ -2,11 +2,32 @@
 #include "vhal.h"
 #include "vbl.h"
 #include "lang.h"
+#include "../zsockets/zerynth_sendfile.h"
 
 
 //#define printf(...) vbl_printf_stdout(__VA_ARGS__)
 #define printf(...)
 
+// last configuration given to each adc, to bring it back after a stream
+static vhalAdcConf adc_confs[4];
+
+// what starts each conversion. Ports with hardware triggers override these
+#if !defined(ADC_TRIGGER_SOFTWARE)
+#define ADC_TRIGGER_SOFTWARE  0
+#define ADC_TRIGGER_TIMER     1   // at samples_per_second, by the timer of the adc
+#define ADC_TRIGGER_RISING    2   // at each rising edge of trigger_vpin
+#define ADC_TRIGGER_FALLING   3
+#define ADC_TRIGGER_BOTH      4
+#endif
+
+static uint8_t adc_trigger_mode = ADC_TRIGGER_SOFTWARE;
+static uint16_t adc_trigger_vpin;
+
+static void adc_set_capture_trigger(vhalAdcCaptureInfo *nfo) {
+	nfo->trigger_mode = adc_trigger_mode;
+	nfo->trigger_vpin = adc_trigger_vpin;
+}
+
 
 err_t _adc_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
 	(void)self;
@@ -29,6 +50,8 @@ err_t _adc_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
 			if (vhalAdcInit(drvid, &conf)) {
 				return ERR_UNSUPPORTED_EXC;
 			}
+			if (drvid < 4)
+				adc_confs[drvid] = conf;
 		}
 		break;
 
@@ -41,6 +64,7 @@ err_t _adc_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
 			uint16_t pin;
 			uint16_t samples=0;
 			nfo.capture_mode =  ADC_CAPTURE_SINGLE;
+			adc_set_capture_trigger(&nfo);
 			int tt = PTYPE(args[0]);
 			if (tt == PSMALLINT) {
 				pin = PSMALLINT_VALUE(args[0]);
@@ -123,6 +147,411 @@ ret_unsup:
 
 }
 
+// args: mode, vpin. Sets the trigger of the next captures
+err_t _adc_set_trigger(int nargs, PObject *self, PObject **args, PObject **res) {
+	(void)self;
+	int32_t mode, vpin;
+
+	if (parse_py_args("ii", nargs, args, &mode, &vpin) != 2)
+		return ERR_TYPE_EXC;
+	if (mode < ADC_TRIGGER_SOFTWARE || mode > ADC_TRIGGER_BOTH)
+		return ERR_VALUE_EXC;
+	adc_trigger_mode = mode;
+	adc_trigger_vpin = vpin;
+	*res = MAKE_NONE();
+	return ERR_OK;
+}
+
+#define ADC_MAX_PINS 16
+
+// a pin or a list/tuple of at most ADC_MAX_PINS pins into pins. Returns how many, -1 if invalid
+static int adc_parse_pins(PObject *obj, uint16_t *pins) {
+	int32_t i, n;
+
+	if (IS_PSMALLINT(obj)) {
+		pins[0] = PSMALLINT_VALUE(obj);
+		return 1;
+	}
+	if (PTYPE(obj) != PLIST && PTYPE(obj) != PTUPLE)
+		return -1;
+	n = PSEQUENCE_ELEMENTS(obj);
+	if (n <= 0 || n > ADC_MAX_PINS)
+		return -1;
+	for (i = 0; i < n; i++) {
+		if (!IS_PSMALLINT(PSEQUENCE_OBJECTS(obj)[i]))
+			return -1;
+		pins[i] = PSMALLINT_VALUE(PSEQUENCE_OBJECTS(obj)[i]);
+	}
+	return n;
+}
+
+// args: drvid, pins, buf, ofs, samples. Captures samples per pin into the shortarray buf from ofs, interleaved by pin
+err_t _adc_read_into(int nargs, PObject *self, PObject **args, PObject **res) {
+	(void)self;
+	vhalAdcCaptureInfo nfo;
+	uint16_t pins[ADC_MAX_PINS];
+	int32_t drvid, ofs, samples, npins, size;
+
+	if (nargs != 5 || !IS_PSMALLINT(args[0]) || PTYPE(args[2]) != PSHORTARRAY || !IS_PSMALLINT(args[3]) || !IS_PSMALLINT(args[4]))
+		return ERR_TYPE_EXC;
+	npins = adc_parse_pins(args[1], pins);
+	if (npins < 0)
+		return ERR_TYPE_EXC;
+	drvid = PSMALLINT_VALUE(args[0]);
+	ofs = PSMALLINT_VALUE(args[3]);
+	samples = PSMALLINT_VALUE(args[4]);
+	if (ofs < 0 || samples <= 0 || ofs + samples * npins > PSEQUENCE_ELEMENTS(args[2]))
+		return ERR_INDEX_EXC;
+
+	nfo.capture_mode = ADC_CAPTURE_SINGLE;
+	adc_set_capture_trigger(&nfo);
+	nfo.pins = pins;
+	nfo.npins = npins;
+	nfo.samples = samples;
+	size = vhalAdcPrepareCapture(drvid, &nfo);
+	// the samples must be shorts to land in place
+	if (size != 2 * samples * npins)
+		return ERR_UNSUPPORTED_EXC;
+	nfo.buffer = ((uint16_t*)PSEQUENCE_BYTES(args[2])) + ofs;
+	RELEASE_GIL();
+	vhalAdcRead(drvid, &nfo);
+	ACQUIRE_GIL();
+	*res = PSMALLINT_NEW(samples);
+	return ERR_OK;
+}
+
+/*
+ * Continuous capture: the driver fills a circular buffer by DMA and calls adc_stream_half in ISR each time one half
+ * is complete, while it goes on in the other one. Each half is counted in filled and signaled, the consumer takes the
+ * oldest one not yet read, or the newest one if it fell behind by more than a buffer (the skipped halves are lost).
+ */
+typedef struct _adc_stream {
+	vhalAdcCaptureInfo nfo;
+	uint16_t pins[ADC_MAX_PINS];
+	uint8_t *buffer;
+	uint32_t half;          // bytes
+	volatile uint32_t filled;
+	uint32_t taken;
+	volatile uint8_t stop;
+	volatile uint8_t stopped;
+	int32_t drvid;
+	VSemaphore sem;
+	// pipeline (see adc_pump_loop)
+	volatile uint8_t pumping;
+	ZSockSink sink;
+	uint8_t *out;           // a half, decimated in place
+	uint32_t decimation;
+	uint32_t phase;         // frames in acc
+	uint32_t acc[ADC_MAX_PINS];
+	int32_t sink_err;
+	uint8_t sample_size;
+	uint32_t halves;
+	uint32_t bytes;
+	uint32_t lost;
+} AdcStream;
+
+static AdcStream *adc_stream;       // NULL once stopping
+static AdcStream *adc_stream_cur;   // until freed, for the callback
+
+static int adc_stream_half(uint32_t adc, vhalAdcCaptureInfo *nfo) {
+	(void)adc;
+	(void)nfo;
+	AdcStream *st = adc_stream_cur;
+	if (!st)
+		return 1;
+	if (st->stop) {
+		st->stopped = 1;
+		vosSemSignalIsr(st->sem);
+		return 1;
+	}
+	st->filled++;
+	vosSemSignalIsr(st->sem);
+	return 0;
+}
+
+/*
+ * copies the oldest filled half not taken yet into dst, or the newest one if the consumer fell behind by more than a
+ * buffer. Returns the halves lost before it. There must be a filled half
+ */
+static uint32_t adc_stream_take(AdcStream *st, uint8_t *dst) {
+	uint32_t idx = st->taken, lost = 0;
+
+	if (st->filled - idx > 2) {
+		lost = st->filled - idx - 1;
+		idx = st->filled - 1;
+	}
+	memcpy(dst, st->buffer + (idx & 1) * st->half, st->half);
+	// the half was overwritten while copying
+	if (st->filled - idx > 2)
+		lost++;
+	st->taken = idx + 1;
+	return lost;
+}
+
+// args: drvid, pins, samples. Starts streaming, samples per pin in each half. Returns the size of a half in bytes
+err_t _adc_stream_start(int nargs, PObject *self, PObject **args, PObject **res) {
+	(void)self;
+	AdcStream *st;
+	int32_t drvid, samples, i, size;
+	PObject *pins;
+
+	if (nargs != 3 || !IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[2]))
+		return ERR_TYPE_EXC;
+	drvid = PSMALLINT_VALUE(args[0]);
+	pins = args[1];
+	samples = PSMALLINT_VALUE(args[2]);
+	if (adc_stream_cur)
+		return ERR_RUNTIME_EXC;
+	if (samples <= 0)
+		return ERR_VALUE_EXC;
+
+	st = gc_malloc(sizeof(AdcStream));
+	memset(st, 0, sizeof(AdcStream));
+	i = adc_parse_pins(pins, st->pins);
+	if (i < 0) {
+		gc_free(st);
+		return ERR_TYPE_EXC;
+	}
+	st->nfo.npins = i;
+	st->nfo.pins = st->pins;
+	st->nfo.capture_mode = ADC_CAPTURE_CONTINUOUS;
+	adc_set_capture_trigger(&st->nfo);
+	st->nfo.samples = 2 * samples;
+	st->nfo.callback = adc_stream_half;
+	st->drvid = drvid;
+	size = vhalAdcPrepareCapture(drvid, &st->nfo);
+	if (size <= 0 || (size & 1)) {
+		gc_free(st);
+		return ERR_UNSUPPORTED_EXC;
+	}
+	st->half = size / 2;
+	st->sample_size = st->half / (samples * st->nfo.npins);
+	st->buffer = gc_malloc(size);
+	st->nfo.buffer = st->buffer;
+	st->sem = vosSemCreate(0);
+	adc_stream = st;
+	adc_stream_cur = st;
+	// in continuous mode the driver returns once the capture is running
+	if (vhalAdcRead(drvid, &st->nfo)) {
+		adc_stream = NULL;
+		adc_stream_cur = NULL;
+		vosSemDestroy(st->sem);
+		gc_free(st->buffer);
+		gc_free(st);
+		return ERR_UNSUPPORTED_EXC;
+	}
+	*res = PSMALLINT_NEW(st->half);
+	return ERR_OK;
+}
+
+// args: buf, timeout. Copies the next filled half into buf. Returns the halves lost before it, or -1 on timeout
+err_t _adc_stream_read(int nargs, PObject *self, PObject **args, PObject **res) {
+	(void)self;
+	AdcStream *st = adc_stream;
+	int32_t timeout, r;
+	uint32_t lost;
+
+	if (nargs != 2 || PTYPE(args[0]) != PBYTEARRAY || !IS_PSMALLINT(args[1]))
+		return ERR_TYPE_EXC;
+	if (!st || st->pumping)
+		return ERR_RUNTIME_EXC;
+	if ((uint32_t)PSEQUENCE_ELEMENTS(args[0]) < st->half)
+		return ERR_INDEX_EXC;
+	timeout = PSMALLINT_VALUE(args[1]);
+
+	// signals of halves already skipped are consumed here too
+	while (st->taken == st->filled) {
+		RELEASE_GIL();
+		r = vosSemWaitTimeout(st->sem, (timeout < 0) ? VTIME_INFINITE : TIME_U(timeout, MILLIS));
+		ACQUIRE_GIL();
+		if (r != VRES_OK || adc_stream != st) {
+			*res = PSMALLINT_NEW(-1);
+			return ERR_OK;
+		}
+	}
+	lost = adc_stream_take(st, PSEQUENCE_BYTES(args[0]));
+	*res = PSMALLINT_NEW(lost);
+	return ERR_OK;
+}
+
+/*
+ * Pipeline: a thread takes the halves of the stream in place of Python and writes them to a sink (zerynth_sendfile.h),
+ * a socket, a FatFs file or a flash log, averaging each group of decimation frames into one. Once the sink fails the
+ * halves are discarded, counted as lost. The thread is created once: when the pipeline stops it parks, waiting for the next.
+ */
+#define ADC_PUMP_STACK  1024
+#define ADC_PUMP_POLL   100     // millis
+
+static AdcStream *adc_pump_st;
+static VThread adc_pump_th;
+static VSemaphore adc_pump_parked;
+static VSemaphore adc_pump_resume;
+
+// averages the frames of the half in st->out in place. Returns its new size in bytes
+static uint32_t adc_pump_decimate(AdcStream *st) {
+	uint16_t *in = (uint16_t*)st->out;
+	uint16_t *o = in;
+	uint32_t npins = st->nfo.npins, frames = st->half / (2 * npins), f, p;
+
+	for (f = 0; f < frames; f++, in += npins) {
+		for (p = 0; p < npins; p++)
+			st->acc[p] += in[p];
+		if (++st->phase == st->decimation) {
+			// o never passes in: a frame is written only after reading at least one
+			for (p = 0; p < npins; p++) {
+				*o++ = (st->acc[p] + st->decimation / 2) / st->decimation;
+				st->acc[p] = 0;
+			}
+			st->phase = 0;
+		}
+	}
+	return (uint8_t*)o - st->out;
+}
+
+static void adc_pump_loop(void *arg) {
+	(void)arg;
+	AdcStream *st;
+	uint32_t lost, n;
+	int32_t w;
+
+	while (1) {
+		st = adc_pump_st;
+		if (!st || !st->pumping) {
+			vosSemSignal(adc_pump_parked);
+			vosSemWait(adc_pump_resume);
+			continue;
+		}
+		if (st->taken == st->filled) {
+			vosSemWaitTimeout(st->sem, TIME_U(ADC_PUMP_POLL, MILLIS));
+			continue;
+		}
+		lost = adc_stream_take(st, st->out);
+		if (st->sink_err) {
+			st->lost += lost + 1;
+			continue;
+		}
+		if (lost) {
+			// no average across a gap
+			st->lost += lost;
+			st->phase = 0;
+			memset(st->acc, 0, sizeof(st->acc));
+		}
+		n = (st->decimation > 1) ? adc_pump_decimate(st) : st->half;
+		if (n) {
+			w = zsock_sink_write_all(&st->sink, st->out, n);
+			if (w < 0) {
+				st->sink_err = w;
+				st->lost++;
+				continue;
+			}
+		}
+		st->halves++;
+		st->bytes += n;
+	}
+}
+
+// parks the thread of the pipeline of st, if running
+static void adc_pump_stop(AdcStream *st) {
+	if (!st->pumping)
+		return;
+	st->pumping = 0;
+	vosSemSignal(st->sem);
+	RELEASE_GIL();
+	vosSemWait(adc_pump_parked);
+	ACQUIRE_GIL();
+	adc_pump_st = NULL;
+	gc_free(st->out);
+	st->out = NULL;
+}
+
+// args: sink, decimation. Starts sending the halves of the stream to sink, averaging decimation frames into one
+err_t _adc_stream_pipe(int nargs, PObject *self, PObject **args, PObject **res) {
+	(void)self;
+	AdcStream *st = adc_stream;
+	uint8_t *sink;
+	uint32_t sink_len;
+	int32_t decimation;
+
+	if (parse_py_args("si", nargs, args, &sink, &sink_len, &decimation) != 2)
+		return ERR_TYPE_EXC;
+	if (sink_len < sizeof(ZSockSink) || decimation <= 0)
+		return ERR_VALUE_EXC;
+	if (!st || st->pumping)
+		return ERR_RUNTIME_EXC;
+	// averages are computed on shorts
+	if (decimation > 1 && st->sample_size != 2)
+		return ERR_UNSUPPORTED_EXC;
+	memcpy(&st->sink, sink, sizeof(ZSockSink));
+	st->decimation = decimation;
+	st->phase = 0;
+	memset(st->acc, 0, sizeof(st->acc));
+	st->sink_err = 0;
+	st->halves = st->bytes = st->lost = 0;
+	st->out = gc_malloc(st->half);
+	// halves filled before the start are not sent
+	st->taken = st->filled;
+	st->pumping = 1;
+	adc_pump_st = st;
+	if (!adc_pump_th) {
+		adc_pump_parked = vosSemCreate(0);
+		adc_pump_resume = vosSemCreate(0);
+		adc_pump_th = vosThCreate(ADC_PUMP_STACK, VOS_PRIO_HIGHER, adc_pump_loop, NULL, NULL);
+		vosThResume(adc_pump_th);
+	} else {
+		vosSemSignal(adc_pump_resume);
+	}
+	*res = MAKE_NONE();
+	return ERR_OK;
+}
+
+// args: none. Returns (halves, bytes, lost, error) of the pipeline: error is the one of the sink, 0 if none
+err_t _adc_stream_pipe_stats(int nargs, PObject *self, PObject **args, PObject **res) {
+	(void)self;
+	(void)nargs;
+	(void)args;
+	AdcStream *st = adc_stream;
+	PTuple *tpl;
+
+	if (!st)
+		return ERR_RUNTIME_EXC;
+	tpl = ptuple_new(4, NULL);
+	PTUPLE_SET_ITEM(tpl, 0, pinteger_new(st->halves));
+	PTUPLE_SET_ITEM(tpl, 1, pinteger_new(st->bytes));
+	PTUPLE_SET_ITEM(tpl, 2, pinteger_new(st->lost));
+	PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(st->sink_err));
+	*res = (PObject*)tpl;
+	return ERR_OK;
+}
+
+// args: drvid. Stops streaming and brings the adc back to single captures
+err_t _adc_stream_stop(int nargs, PObject *self, PObject **args, PObject **res) {
+	(void)self;
+	(void)nargs;
+	(void)args;
+	AdcStream *st = adc_stream;
+
+	*res = MAKE_NONE();
+	if (!st)
+		return ERR_OK;
+	adc_pump_stop(st);
+	adc_stream = NULL;
+	st->stop = 1;
+	RELEASE_GIL();
+	// the driver stops at the next half, unless it ignores the callback result
+	while (!st->stopped && vosSemWaitTimeout(st->sem, TIME_U(100, MILLIS)) == VRES_OK);
+	ACQUIRE_GIL();
+	vhalAdcDone(st->drvid);
+	if (st->drvid < 4)
+		vhalAdcInit(st->drvid, &adc_confs[st->drvid]);
+	// a reader still waiting sees the stream gone
+	vosSemSignal(st->sem);
+	vosSemDestroy(st->sem);
+	adc_stream_cur = NULL;
+	gc_free(st->buffer);
+	gc_free(st);
+	return ERR_OK;
+}
+
 const VBLDriver adcdriver = {
     PRPH_ADC,
     _adc_ctl
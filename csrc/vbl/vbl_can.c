@@ -2,6 +2,7 @@
 #include "vhal.h"
 #include "vbl.h"
 #include "lang.h"
+#include "../gc/gc_pool.h"
 
 
 //Enable/Disable debug printf
@@ -36,6 +37,327 @@ static void debug_printf(const char* fmt, ...)
 #define _CANDRIVER_STOPTX       9
 #define _CANDRIVER_RESUMERX     10
 #define _CANDRIVER_RESUMETX     11
+#define _CANDRIVER_RXSTART      12
+#define _CANDRIVER_RXBATCH      13
+#define _CANDRIVER_RXSTOP       14
+#define _CANDRIVER_TXSTART      15
+#define _CANDRIVER_TXBATCH      16
+#define _CANDRIVER_TXPERIODIC   17
+#define _CANDRIVER_TXSTOP       18
+#define _CANDRIVER_FILTERS      19
+
+/*
+ * Receive ring: a thread per driver waits on vhalCanRx without the GIL and appends each frame, with the microseconds
+ * since the ring started, to a ring of fixed size records. Python drains many records at once with _CANDRIVER_RXBATCH,
+ * packed in a bytearray. Frames arriving with the ring full are counted as lost. The thread is created once: once the
+ * ring is stopped it parks, waiting for the next start.
+ */
+#define CAN_RINGS       4
+#define CAN_RING_MAX    1024
+#define CAN_RING_POLL   100     // millis
+#define CAN_RING_STACK  1024
+
+#define CAN_RING_STOPPED  0
+#define CAN_RING_RUNNING  1
+
+typedef struct _can_record {
+    uint32_t id;
+    uint32_t ts;
+    uint8_t dlc;
+    uint8_t reserved[3];
+    uint8_t data[8];
+} CanRecord;
+
+typedef struct _can_ring {
+    CanRecord *recs;
+    uint32_t mask;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t lost;
+    volatile uint8_t state;
+    int32_t drvid;
+    VThread th;
+    VSysTimer clock;
+    VSemaphore sem;     // signaled when a frame lands in the empty ring
+    VSemaphore parked;
+    VSemaphore resume;
+} CanRing;
+
+static CanRing *can_rings[CAN_RINGS];
+
+static void can_ring_loop(void *arg) {
+    CanRing *r = (CanRing*)arg;
+    vhalCanFrame frame;
+    CanRecord *rec;
+    uint8_t data[8];
+    uint32_t tail;
+
+    while (1) {
+        if (r->state != CAN_RING_RUNNING) {
+            vosSemSignal(r->parked);
+            vosSemWait(r->resume);
+            continue;
+        }
+        frame.dlc = 8;
+        if (vhalCanRx(r->drvid, &frame, data, CAN_RING_POLL) < 0)
+            continue;
+        tail = r->tail;
+        if (tail - r->head > r->mask) {
+            r->lost++;
+            continue;
+        }
+        rec = &r->recs[tail & r->mask];
+        rec->id = frame.id;
+        rec->ts = vosTimerReadMicros(r->clock);
+        rec->dlc = frame.dlc;
+        memset(rec->data, 0, 8);
+        if (!(frame.id & CAN_RTR_FLAG))
+            memcpy(rec->data, data, (frame.dlc > 8) ? 8 : frame.dlc);
+        // the record must be in place before the consumer sees the new tail
+        __sync_synchronize();
+        r->tail = tail + 1;
+        if (tail == r->head)
+            vosSemSignalCap(r->sem, 1);
+    }
+}
+
+/*
+ * Transmit queue: a thread per driver sends the records appended to a ring by _CANDRIVER_TXBATCH (same layout as
+ * the receive records, ts unused), and a table of periodic records (ts is the period in millis), each at its
+ * deadline. Deadlines advance by the period, skipping the ones already passed. Python never waits for a mailbox.
+ */
+#define CAN_TX_TIMEOUT  10      // millis, waiting for a mailbox
+#define CAN_TX_IDLE     100     // millis
+
+typedef struct _can_periodic {
+    CanRecord rec;
+    uint64_t next;
+} CanPeriodic;
+
+typedef struct _can_tx {
+    CanRecord *recs;
+    uint32_t mask;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t failed;
+    volatile uint8_t state;
+    int32_t drvid;
+    CanPeriodic *per;
+    int32_t nper;
+    VThread th;
+    VSemaphore sem;     // signaled by producers and at stop
+    VSemaphore lock;    // of per
+    VSemaphore parked;
+    VSemaphore resume;
+} CanTx;
+
+static CanTx *can_txs[CAN_RINGS];
+
+static void can_tx_send(CanTx *t, CanRecord *rec) {
+    vhalCanFrame frame;
+
+    frame.id = rec->id;
+    frame.dlc = rec->dlc;
+    if (vhalCanTx(t->drvid, &frame, (rec->id & CAN_RTR_FLAG) ? NULL : rec->data, CAN_TX_TIMEOUT) < 0)
+        t->failed++;
+}
+
+static void can_tx_loop(void *arg) {
+    CanTx *t = (CanTx*)arg;
+    uint64_t now, next;
+    uint32_t head;
+    int32_t i;
+
+    while (1) {
+        if (t->state != CAN_RING_RUNNING) {
+            vosSemSignal(t->parked);
+            vosSemWait(t->resume);
+            continue;
+        }
+        while ((head = t->head) != t->tail) {
+            // tail is read before the record it covers
+            __sync_synchronize();
+            can_tx_send(t, &t->recs[head & t->mask]);
+            t->head = head + 1;
+        }
+        now = vosMillis();
+        next = now + CAN_TX_IDLE;
+        vosSemWait(t->lock);
+        for (i = 0; i < t->nper; i++) {
+            CanPeriodic *p = &t->per[i];
+            if (p->next <= now) {
+                can_tx_send(t, &p->rec);
+                p->next += p->rec.ts;
+                if (p->next <= now)
+                    p->next = now + p->rec.ts;
+            }
+            if (p->next < next)
+                next = p->next;
+        }
+        vosSemSignal(t->lock);
+        now = vosMillis();
+        if (next > now)
+            vosSemWaitTimeout(t->sem, TIME_U((uint32_t)(next - now), MILLIS));
+    }
+}
+
+// checks that n records in buf are valid frames of up to 8 data bytes
+static int can_check_records(uint8_t *buf, int32_t n) {
+    CanRecord rec;
+    int32_t i;
+
+    for (i = 0; i < n; i++) {
+        memcpy(&rec, buf + i * sizeof(CanRecord), sizeof(CanRecord));
+        if (rec.dlc > 8)
+            return 0;
+    }
+    return 1;
+}
+
+/*
+ * Acceptance filter compiler: covers a set of ids with at most n id/mask filters. Each id starts as an exact filter,
+ * then the pair of filters whose merge lets through the fewest frames of the traffic sampled on the bus (if any) and,
+ * on a tie, the fewest other ids, is merged until n filters remain. Standard and extended ids are never merged together.
+ * Each filter keeps its best partner, so that after a merge only the filters that pointed to the merged ones are rescanned.
+ */
+#define CAN_FILTER_MAX_IDS      256
+#define CAN_FILTER_MAX_TRAFFIC  1024
+
+typedef struct _can_cover {
+    uint32_t id;        // 11 or 29 bits, with CAN_EXT_FLAG for extended ids
+    uint32_t mask;      // over the bits of the id
+    uint32_t hits;      // frames of the traffic accepted
+    int64_t cost;       // of the merge with best
+    int16_t best;
+    uint8_t alive;
+} CanCover;
+
+typedef struct _can_traffic {
+    uint32_t *ids;
+    int32_t n;
+} CanTraffic;
+
+static inline uint32_t can_id_key(uint32_t id) {
+    return (id & CAN_EXT_FLAG) ? (id & (CAN_EXT_FLAG | CAN_EXT_MASK)) : (id & CAN_STD_MASK);
+}
+
+static inline int64_t can_cover_size(CanCover *c) {
+    uint32_t bits = (c->id & CAN_EXT_FLAG) ? 29 : 11;
+    return (int64_t)1 << (bits - __builtin_popcount(c->mask));
+}
+
+static uint32_t can_cover_hits(CanCover *c, CanTraffic *tr) {
+    uint32_t hits = 0;
+    int32_t i;
+
+    for (i = 0; i < tr->n; i++)
+        if (((tr->ids[i] ^ c->id) & (c->mask | CAN_EXT_FLAG)) == 0)
+            hits++;
+    return hits;
+}
+
+// merges a and b into m and returns the cost of it: the traffic let through in the upper word, the other ids in the lower
+static int64_t can_cover_merge(CanCover *a, CanCover *b, CanCover *m, CanTraffic *tr) {
+    m->mask = a->mask & b->mask & ~(a->id ^ b->id);
+    m->id = (a->id & m->mask) | (a->id & CAN_EXT_FLAG);
+    m->hits = can_cover_hits(m, tr);
+    return ((int64_t)m->hits - a->hits - b->hits) * ((int64_t)1 << 32) + can_cover_size(m) - can_cover_size(a) - can_cover_size(b);
+}
+
+static void can_cover_best(CanCover *cv, int32_t n, int32_t i, CanTraffic *tr) {
+    CanCover m;
+    int64_t cost;
+    int32_t j;
+
+    cv[i].best = -1;
+    for (j = 0; j < n; j++) {
+        if (j == i || !cv[j].alive || ((cv[i].id ^ cv[j].id) & CAN_EXT_FLAG))
+            continue;
+        cost = can_cover_merge(&cv[i], &cv[j], &m, tr);
+        if (cv[i].best < 0 || cost < cv[i].cost) {
+            cv[i].best = j;
+            cv[i].cost = cost;
+        }
+    }
+}
+
+// merges the n filters in cv (alive ones counted by *alive) down to target; returns 0, or -1 if ids of both formats are left
+static int can_cover_reduce(CanCover *cv, int32_t n, int32_t *alive, int32_t target, CanTraffic *tr) {
+    CanCover m;
+    int64_t cost;
+    int32_t i, bi, bj;
+
+    while (*alive > target) {
+        bi = -1;
+        for (i = 0; i < n; i++)
+            if (cv[i].alive && cv[i].best >= 0 && (bi < 0 || cv[i].cost < cv[bi].cost))
+                bi = i;
+        if (bi < 0)
+            return -1;
+        bj = cv[bi].best;
+        can_cover_merge(&cv[bi], &cv[bj], &m, tr);
+        cv[bi].id = m.id;
+        cv[bi].mask = m.mask;
+        cv[bi].hits = m.hits;
+        // bj and any filter inside the merged one are gone
+        for (i = 0; i < n; i++) {
+            if (i != bi && cv[i].alive && !((cv[i].id ^ m.id) & CAN_EXT_FLAG) &&
+                (cv[i].id & m.mask) == (m.id & ~CAN_EXT_FLAG) && (cv[i].mask & m.mask) == m.mask) {
+                cv[i].alive = 0;
+                (*alive)--;
+            }
+        }
+        can_cover_best(cv, n, bi, tr);
+        for (i = 0; i < n; i++) {
+            if (i == bi || !cv[i].alive || ((cv[i].id ^ m.id) & CAN_EXT_FLAG))
+                continue;
+            if (cv[i].best < 0 || cv[i].best == bi || !cv[cv[i].best].alive) {
+                can_cover_best(cv, n, i, tr);
+            } else {
+                cost = can_cover_merge(&cv[i], &cv[bi], &m, tr);
+                if (cost < cv[i].cost) {
+                    cv[i].best = bi;
+                    cv[i].cost = cost;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+ * Adds the filters of cv, up to target of them, merging further whenever the driver refuses one (its banks are over).
+ * Returns the number of filters added, with their indexes in idx, or the negative error of the driver.
+ */
+static int32_t can_cover_apply(int32_t drvid, CanCover *cv, int32_t n, int32_t alive, int32_t target, CanTraffic *tr, int32_t *idx) {
+    vhalCanFilter filter;
+    int32_t i, k, code;
+
+    for (;;) {
+        if (can_cover_reduce(cv, n, &alive, target, tr) < 0)
+            return -ERR_VALUE_EXC;
+        for (i = 0, k = 0; i < n; i++) {
+            if (!cv[i].alive)
+                continue;
+            filter.id = cv[i].id;
+            filter.mask = cv[i].mask | (cv[i].id & CAN_EXT_FLAG);
+            code = vhalCanAddFilter(drvid, &filter);
+            if (code < 0)
+                break;
+            idx[k++] = code;
+        }
+        if (i == n)
+            return k;
+        while (k > 0)
+            vhalCanRemoveFilter(drvid, idx[--k]);
+        // as many filters as were accepted
+        for (target = 0, k = 0; k < i; k++)
+            if (cv[k].alive)
+                target++;
+        if (!target)
+            return code;
+    }
+}
 
 err_t _can_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
     (void)self;
@@ -134,6 +456,9 @@ err_t _can_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
             uint32_t timeout = VTIME_INFINITE;
             if (parse_py_args("bi", nargs, args, &data, &data_len, &timeout) != 2)
                 goto ret_err_type;
+            // optional pool of 3-tuples for the result
+            if (nargs > 2 && args[2] != MAKE_NONE() && !gc_pool_check(args[2], GC_POOL_TUPLE, 3))
+                goto ret_err_type;
             printf("VBL_CAN_RX asked: %i (%d %d)\n",drvid, data_len, timeout);
             frame.dlc = (data_len > 64) ? 64 : data_len;
             RELEASE_GIL();
@@ -146,7 +471,7 @@ err_t _can_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
             data_len = (frame.id & CAN_RTR_FLAG) ? 0 : frame.dlc;
             printf("VBL_CAN_RX len: %i\n",data_len);
             PSEQUENCE_ELEMENTS_SET(args[0], data_len);
-            *res = ptuple_new(3, NULL);
+            *res = (nargs > 2 && args[2] != MAKE_NONE()) ? gc_pool_take(args[2]) : (PObject*)ptuple_new(3, NULL);
             PTUPLE_SET_ITEM(*res, 0, pinteger_new_u(frame.id));
             PTUPLE_SET_ITEM(*res, 1, PSMALLINT_NEW(frame.dlc));
             PTUPLE_SET_ITEM(*res, 2, args[0]);
@@ -218,6 +543,88 @@ err_t _can_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
                 return -code;
         }
         break;
+        case _CANDRIVER_FILTERS: {
+            // args: ids, max filters (-1 for as many as fit), traffic (None, ids or rx_batch records)
+            // returns a tuple of (id, mask, filter index)
+            CanCover *cv;
+            CanTraffic tr;
+            PObject **items, *flt;
+            int32_t n, i, j, alive, target, *idx;
+            uint32_t id;
+            if (nargs != 3 || (PTYPE(args[0]) != PLIST && PTYPE(args[0]) != PTUPLE) || !IS_PSMALLINT(args[1]) ||
+                (args[2] != MAKE_NONE() && PTYPE(args[2]) != PLIST && PTYPE(args[2]) != PTUPLE && !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[2]))))
+                goto ret_err_type;
+            n = PSEQUENCE_ELEMENTS(args[0]);
+            target = PSMALLINT_VALUE(args[1]);
+            if (!n || n > CAN_FILTER_MAX_IDS || target == 0)
+                goto ret_err_value;
+            items = PSEQUENCE_OBJECTS(args[0]);
+            for (i = 0; i < n; i++)
+                if (!IS_INTEGER(items[i]))
+                    goto ret_err_type;
+            tr.n = 0;
+            tr.ids = NULL;
+            if (args[2] != MAKE_NONE()) {
+                if (IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[2]))) {
+                    tr.n = PSEQUENCE_ELEMENTS(args[2]) / sizeof(CanRecord);
+                } else {
+                    tr.n = PSEQUENCE_ELEMENTS(args[2]);
+                    for (i = 0; i < tr.n; i++)
+                        if (!IS_INTEGER(PSEQUENCE_OBJECTS(args[2])[i]))
+                            goto ret_err_type;
+                }
+                if (tr.n > CAN_FILTER_MAX_TRAFFIC)
+                    tr.n = CAN_FILTER_MAX_TRAFFIC;
+            }
+            cv = gc_malloc(sizeof(CanCover) * n + sizeof(int32_t) * n + sizeof(uint32_t) * tr.n);
+            idx = (int32_t*)(cv + n);
+            tr.ids = (uint32_t*)(idx + n);
+            for (i = 0; i < tr.n; i++) {
+                if (IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[2])))
+                    memcpy(&id, PSEQUENCE_BYTES(args[2]) + i * sizeof(CanRecord), 4);
+                else
+                    id = (uint32_t)INTEGER_VALUE(PSEQUENCE_OBJECTS(args[2])[i]);
+                tr.ids[i] = can_id_key(id);
+            }
+            // one exact filter per distinct id
+            for (i = 0, alive = 0; i < n; i++) {
+                id = can_id_key((uint32_t)INTEGER_VALUE(items[i]));
+                for (j = 0; j < alive && cv[j].id != id; j++);
+                if (j < alive)
+                    continue;
+                cv[alive].id = id;
+                cv[alive].mask = (id & CAN_EXT_FLAG) ? CAN_EXT_MASK : CAN_STD_MASK;
+                cv[alive].hits = can_cover_hits(&cv[alive], &tr);
+                cv[alive].alive = 1;
+                alive++;
+            }
+            n = alive;
+            if (target < 0 || target > n)
+                target = n;
+            RELEASE_GIL();
+            for (i = 0; i < n; i++)
+                can_cover_best(cv, n, i, &tr);
+            code = can_cover_apply(drvid, cv, n, alive, target, &tr, idx);
+            ACQUIRE_GIL();
+            printf("VBL_CAN_FILTERS: %i\n",code);
+            if (code < 0) {
+                gc_free(cv);
+                return -code;
+            }
+            *res = (PObject*)ptuple_new(code, NULL);
+            for (i = 0, j = 0; i < n; i++) {
+                if (!cv[i].alive)
+                    continue;
+                flt = (PObject*)ptuple_new(3, NULL);
+                PTUPLE_SET_ITEM(flt, 0, pinteger_new_u(cv[i].id));
+                PTUPLE_SET_ITEM(flt, 1, pinteger_new_u(cv[i].mask | (cv[i].id & CAN_EXT_FLAG)));
+                PTUPLE_SET_ITEM(flt, 2, PSMALLINT_NEW(idx[j]));
+                PTUPLE_SET_ITEM(*res, j, flt);
+                j++;
+            }
+            gc_free(cv);
+        }
+        break;
         case _CANDRIVER_STOPRX: {
             if (nargs != 0)
                 goto ret_err_type;
@@ -262,6 +669,241 @@ err_t _can_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
                 return -code;
         }
         break;
+        case _CANDRIVER_RXSTART: {
+            CanRing *r;
+            int32_t frames, cap;
+            if (parse_py_args("i", nargs, args, &frames) != 1)
+                goto ret_err_type;
+            if (drvid >= CAN_RINGS || frames <= 0 || frames > CAN_RING_MAX)
+                goto ret_err_value;
+            r = can_rings[drvid];
+            if (r && r->state == CAN_RING_RUNNING)
+                return ERR_RUNTIME_EXC;
+            for (cap = 1; cap < frames; cap <<= 1);
+            if (!r) {
+                r = gc_malloc(sizeof(CanRing));
+                memset(r, 0, sizeof(CanRing));
+                r->drvid = drvid;
+                r->clock = vosTimerCreate();
+                r->sem = vosSemCreate(0);
+                r->parked = vosSemCreate(0);
+                r->resume = vosSemCreate(0);
+                can_rings[drvid] = r;
+            }
+            r->recs = gc_malloc(sizeof(CanRecord) * cap);
+            r->mask = cap - 1;
+            r->head = 0;
+            r->tail = 0;
+            r->lost = 0;
+            vosTimerReset(r->clock);
+            r->state = CAN_RING_RUNNING;
+            if (!r->th) {
+                r->th = vosThCreate(CAN_RING_STACK, VOS_PRIO_HIGHER, can_ring_loop, r, NULL);
+                vosThResume(r->th);
+            } else {
+                vosSemSignal(r->resume);
+            }
+            printf("VBL_CAN_RXSTART: %i %i\n", drvid, cap);
+        }
+        break;
+        case _CANDRIVER_RXBATCH: {
+            // args: buf, max_frames, timeout. Returns the number of records copied into buf
+            CanRing *r = (drvid < CAN_RINGS) ? can_rings[drvid] : NULL;
+            int32_t max_frames, timeout, n, i;
+            uint32_t head;
+            uint8_t *dst;
+            if (nargs != 3 || PTYPE(args[0]) != PBYTEARRAY || !IS_PSMALLINT(args[1]) || !IS_PSMALLINT(args[2]))
+                goto ret_err_type;
+            if (!r || r->state != CAN_RING_RUNNING)
+                return ERR_RUNTIME_EXC;
+            max_frames = PSMALLINT_VALUE(args[1]);
+            timeout = PSMALLINT_VALUE(args[2]);
+            n = PSEQUENCE_ELEMENTS(args[0]) / sizeof(CanRecord);
+            if (max_frames < 0 || max_frames > n)
+                max_frames = n;
+            // signals left by records already taken only cost another check
+            while (max_frames && r->tail == r->head && timeout) {
+                RELEASE_GIL();
+                code = vosSemWaitTimeout(r->sem, (timeout < 0) ? VTIME_INFINITE : TIME_U(timeout, MILLIS));
+                ACQUIRE_GIL();
+                if (code != VRES_OK || r->state != CAN_RING_RUNNING)
+                    break;
+            }
+            // stopped meanwhile, the records are gone
+            if (r->state != CAN_RING_RUNNING) {
+                *res = PSMALLINT_NEW(0);
+                break;
+            }
+            head = r->head;
+            n = r->tail - head;
+            if (n > max_frames)
+                n = max_frames;
+            __sync_synchronize();
+            dst = PSEQUENCE_BYTES(args[0]);
+            for (i = 0; i < n; i++)
+                memcpy(dst + i * sizeof(CanRecord), &r->recs[(head + i) & r->mask], sizeof(CanRecord));
+            __sync_synchronize();
+            r->head = head + n;
+            *res = PSMALLINT_NEW(n);
+        }
+        break;
+        case _CANDRIVER_RXSTOP: {
+            // returns the number of frames lost since the start
+            CanRing *r = (drvid < CAN_RINGS) ? can_rings[drvid] : NULL;
+            if (nargs != 0)
+                goto ret_err_type;
+            if (!r || r->state != CAN_RING_RUNNING) {
+                *res = PSMALLINT_NEW(0);
+                break;
+            }
+            r->state = CAN_RING_STOPPED;
+            RELEASE_GIL();
+            // wakes the thread up from vhalCanRx
+            vhalCanAbortRx(drvid);
+            vosSemWait(r->parked);
+            vhalCanResumeRx(drvid);
+            // and the readers from _CANDRIVER_RXBATCH
+            vosSemSignalCap(r->sem, 1);
+            ACQUIRE_GIL();
+            gc_free(r->recs);
+            r->recs = NULL;
+            *res = PSMALLINT_NEW(r->lost);
+        }
+        break;
+        case _CANDRIVER_TXSTART: {
+            CanTx *t;
+            int32_t frames, cap;
+            if (parse_py_args("i", nargs, args, &frames) != 1)
+                goto ret_err_type;
+            if (drvid >= CAN_RINGS || frames <= 0 || frames > CAN_RING_MAX)
+                goto ret_err_value;
+            t = can_txs[drvid];
+            if (t && t->state == CAN_RING_RUNNING)
+                return ERR_RUNTIME_EXC;
+            for (cap = 1; cap < frames; cap <<= 1);
+            if (!t) {
+                t = gc_malloc(sizeof(CanTx));
+                memset(t, 0, sizeof(CanTx));
+                t->drvid = drvid;
+                t->sem = vosSemCreate(0);
+                t->lock = vosSemCreate(1);
+                t->parked = vosSemCreate(0);
+                t->resume = vosSemCreate(0);
+                can_txs[drvid] = t;
+            }
+            t->recs = gc_malloc(sizeof(CanRecord) * cap);
+            t->mask = cap - 1;
+            t->head = 0;
+            t->tail = 0;
+            t->failed = 0;
+            t->per = NULL;
+            t->nper = 0;
+            t->state = CAN_RING_RUNNING;
+            if (!t->th) {
+                t->th = vosThCreate(CAN_RING_STACK, VOS_PRIO_HIGHER, can_tx_loop, t, NULL);
+                vosThResume(t->th);
+            } else {
+                vosSemSignal(t->resume);
+            }
+        }
+        break;
+        case _CANDRIVER_TXBATCH: {
+            // args: buf, nframes. Queues up to nframes records of buf without waiting, returns how many
+            CanTx *t = (drvid < CAN_RINGS) ? can_txs[drvid] : NULL;
+            int32_t n, i;
+            uint32_t tail;
+            uint8_t *src;
+            if (nargs != 2 || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[0])) || !IS_PSMALLINT(args[1]))
+                goto ret_err_type;
+            if (!t || t->state != CAN_RING_RUNNING)
+                return ERR_RUNTIME_EXC;
+            n = PSMALLINT_VALUE(args[1]);
+            if (n < 0)
+                n = PSEQUENCE_ELEMENTS(args[0]) / sizeof(CanRecord);
+            if (n * sizeof(CanRecord) > (uint32_t)PSEQUENCE_ELEMENTS(args[0]))
+                return ERR_INDEX_EXC;
+            src = PSEQUENCE_BYTES(args[0]);
+            if (!can_check_records(src, n))
+                goto ret_err_value;
+            tail = t->tail;
+            if ((uint32_t)n > t->mask + 1 - (tail - t->head))
+                n = t->mask + 1 - (tail - t->head);
+            for (i = 0; i < n; i++)
+                memcpy(&t->recs[(tail + i) & t->mask], src + i * sizeof(CanRecord), sizeof(CanRecord));
+            // records must be in place before the thread sees the new tail
+            __sync_synchronize();
+            t->tail = tail + n;
+            if (n)
+                vosSemSignalCap(t->sem, 1);
+            *res = PSMALLINT_NEW(n);
+        }
+        break;
+        case _CANDRIVER_TXPERIODIC: {
+            // args: buf, nframes. Replaces the periodic table with nframes records of buf, ts being the period
+            CanTx *t = (drvid < CAN_RINGS) ? can_txs[drvid] : NULL;
+            CanPeriodic *per = NULL, *old;
+            int32_t n, i;
+            uint64_t now;
+            uint8_t *src;
+            if (nargs != 2 || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[0])) || !IS_PSMALLINT(args[1]))
+                goto ret_err_type;
+            if (!t || t->state != CAN_RING_RUNNING)
+                return ERR_RUNTIME_EXC;
+            n = PSMALLINT_VALUE(args[1]);
+            if (n < 0)
+                n = PSEQUENCE_ELEMENTS(args[0]) / sizeof(CanRecord);
+            if (n * sizeof(CanRecord) > (uint32_t)PSEQUENCE_ELEMENTS(args[0]))
+                return ERR_INDEX_EXC;
+            src = PSEQUENCE_BYTES(args[0]);
+            if (!can_check_records(src, n))
+                goto ret_err_value;
+            if (n) {
+                per = gc_malloc(sizeof(CanPeriodic) * n);
+                now = vosMillis();
+                for (i = 0; i < n; i++) {
+                    memcpy(&per[i].rec, src + i * sizeof(CanRecord), sizeof(CanRecord));
+                    if (!per[i].rec.ts) {
+                        gc_free(per);
+                        goto ret_err_value;
+                    }
+                    per[i].next = now;
+                }
+            }
+            RELEASE_GIL();
+            vosSemWait(t->lock);
+            old = t->per;
+            t->per = per;
+            t->nper = n;
+            vosSemSignal(t->lock);
+            vosSemSignalCap(t->sem, 1);
+            ACQUIRE_GIL();
+            if (old)
+                gc_free(old);
+        }
+        break;
+        case _CANDRIVER_TXSTOP: {
+            // returns the number of frames that could not be sent since the start
+            CanTx *t = (drvid < CAN_RINGS) ? can_txs[drvid] : NULL;
+            if (nargs != 0)
+                goto ret_err_type;
+            if (!t || t->state != CAN_RING_RUNNING) {
+                *res = PSMALLINT_NEW(0);
+                break;
+            }
+            t->state = CAN_RING_STOPPED;
+            RELEASE_GIL();
+            vosSemSignalCap(t->sem, 1);
+            vosSemWait(t->parked);
+            ACQUIRE_GIL();
+            gc_free(t->recs);
+            t->recs = NULL;
+            if (t->per)
+                gc_free(t->per);
+            t->per = NULL;
+            t->nper = 0;
+            *res = PSMALLINT_NEW(t->failed);
+        }
+        break;
         default:
             goto ret_unsup;
     }
@@ -101,6 +101,126 @@ ret_unsup:
 }
 
 
+/*
+ * Streaming: the driver plays a circular buffer, the position is derived from the time elapsed since the start
+ * (on the core clock, like the dac timer), and each push waits for the half that has just finished playing and refills
+ * it while the other half plays. The state lives in a bytearray, the buffer is kept by Python.
+ */
+#define DAC_STREAM_TAG  0x4d525453  /* "STRM" */
+
+typedef struct _dac_stream {
+    uint32_t tag;
+    uint32_t pin;
+    uint16_t *data;
+    uint32_t half;          // samples
+    uint32_t step;          // micros per sample
+    VSysTimer tm;
+    uint32_t written;       // halves queued since the start, the initial buffer counts for two
+} DacStream;
+
+#define DS_STATE(o) ((DacStream*)PSEQUENCE_BYTES(o))
+#define IS_DS_STATE(o) (PTYPE(o)==PBYTEARRAY && PSEQUENCE_ELEMENTS(o)==(int32_t)sizeof(DacStream) && DS_STATE(o)->tag==DAC_STREAM_TAG)
+
+static uint64_t dac_stream_micros(DacStream *ds) {
+    uint64_t ms = vosTimerReadMillis(ds->tm);
+    uint32_t us = vosTimerReadMicros(ds->tm);
+    uint64_t approx = ms * 1000;
+    return approx + (int32_t)(us - (uint32_t)approx);
+}
+
+// args: pin, buf, timestep, timeunit. Starts playing the shortarray buf in loop and returns the state of the stream
+err_t _dac_stream_start(int nargs, PObject *self, PObject **args, PObject **res) {
+    (void)self;
+    PObject *state;
+    DacStream *ds;
+    int32_t pin, len, timestep, unit, code;
+
+    if (nargs != 4 || !IS_PSMALLINT(args[0]) || PTYPE(args[1]) != PSHORTARRAY || !IS_PSMALLINT(args[2]) || !IS_PSMALLINT(args[3]))
+        return ERR_TYPE_EXC;
+    pin = PSMALLINT_VALUE(args[0]);
+    len = PSEQUENCE_ELEMENTS(args[1]);
+    timestep = PSMALLINT_VALUE(args[2]);
+    unit = PSMALLINT_VALUE(args[3]);
+    if (len < 2 || (len & 1) || timestep <= 0)
+        return ERR_VALUE_EXC;
+
+    state = (PObject*)psequence_new(PBYTEARRAY, sizeof(DacStream));
+    PSEQUENCE_ELEMENTS_SET(state, sizeof(DacStream));
+    ds = DS_STATE(state);
+    memset(ds, 0, sizeof(DacStream));
+    ds->tag = DAC_STREAM_TAG;
+    ds->pin = pin;
+    ds->data = PSEQUENCE_SHORTS(args[1]);
+    ds->half = len / 2;
+    ds->step = GET_TIME_MICROS(TIME_U(timestep, unit));
+    ds->written = 2;
+    if (!ds->step)
+        return ERR_VALUE_EXC;
+    ds->tm = vosTimerCreate();
+    RELEASE_GIL();
+    code = vhalDacWrite(pin, ds->data, len, TIME_U(timestep, unit), 1);
+    ACQUIRE_GIL();
+    if (code < 0) {
+        vosTimerDestroy(ds->tm);
+        ds->tag = 0;
+        return -code;
+    }
+    // the position counts from here
+    SYSLOCK();
+    vosTimerReset(ds->tm);
+    SYSUNLOCK();
+    *res = state;
+    return ERR_OK;
+}
+
+// args: state, data. Copies the half buffer of samples data into the next half to play, waiting for it to be free.
+// Returns the number of halves that played stale samples because the push came late
+err_t _dac_stream_push(int nargs, PObject *self, PObject **args, PObject **res) {
+    (void)self;
+    DacStream *ds;
+    uint64_t now, free_at;
+    uint32_t played, lost = 0;
+
+    if (nargs != 2 || !IS_DS_STATE(args[0]) || !IS_SHORT_PSEQUENCE_TYPE(PTYPE(args[1])))
+        return ERR_TYPE_EXC;
+    ds = DS_STATE(args[0]);
+    if ((uint32_t)PSEQUENCE_ELEMENTS(args[1]) != ds->half)
+        return ERR_VALUE_EXC;
+
+    // half written-2 is rewritten once it has played, when the halves played reach written-1
+    free_at = (uint64_t)(ds->written - 1) * ds->half * ds->step;
+    now = dac_stream_micros(ds);
+    if (now < free_at) {
+        RELEASE_GIL();
+        while ((now = dac_stream_micros(ds)) < free_at) {
+            uint64_t wait = free_at - now;
+            vosThSleep(wait > 1000 ? TIME_U((uint32_t)(wait / 1000), MILLIS) : TIME_U((uint32_t)wait, MICROS));
+        }
+        ACQUIRE_GIL();
+    }
+    played = now / ((uint64_t)ds->half * ds->step);
+    if (played > ds->written - 1) {
+        // late: fill the half after the one playing now
+        lost = played - (ds->written - 1);
+        ds->written = played + 1;
+    }
+    memcpy(ds->data + (ds->written & 1) * ds->half, PSEQUENCE_SHORTS(args[1]), ds->half * sizeof(uint16_t));
+    ds->written++;
+    *res = PSMALLINT_NEW(lost);
+    return ERR_OK;
+}
+
+// args: state. Releases the clock of the stream, the driver is stopped by the caller
+err_t _dac_stream_stop(int nargs, PObject *self, PObject **args, PObject **res) {
+    (void)self;
+    *res = MAKE_NONE();
+    if (nargs != 1 || !IS_DS_STATE(args[0]))
+        return ERR_TYPE_EXC;
+    vosTimerDestroy(DS_STATE(args[0])->tm);
+    DS_STATE(args[0])->tag = 0;
+    return ERR_OK;
+}
+
 const VBLDriver dacdriver = {
     PRPH_DAC,
     _dac_ctl
@@ -0,0 +1,44 @@
+#include "zerynth.h"
+#include "vosal.h"
+#include "vhal.h"
+#include "vbl.h"
+#include "lang.h"
+
+/*
+ * Access in place to resources saved in memory mapped flash: bytes are read straight from their address,
+ * never through an intermediate bytes object.
+ */
+
+/*
+ * args: addr, buffer, ofs, size
+ * copies size bytes at addr into the bytearray buffer from ofs. Returns size
+ */
+C_NATIVE(_vbl_flash_readinto)
+{
+    C_NATIVE_UNWARN();
+    int32_t addr, ofs, size;
+
+    if (nargs != 4 || !IS_INTEGER(args[0]) || PTYPE(args[1]) != PBYTEARRAY || !IS_PSMALLINT(args[2]) || !IS_PSMALLINT(args[3]))
+        return ERR_TYPE_EXC;
+    addr = INTEGER_VALUE(args[0]);
+    ofs = PSMALLINT_VALUE(args[2]);
+    size = PSMALLINT_VALUE(args[3]);
+    if (ofs < 0 || size < 0 || ofs + size > PSEQUENCE_ELEMENTS(args[1]))
+        return ERR_INDEX_EXC;
+    memcpy(PSEQUENCE_BYTES(args[1]) + ofs, (uint8_t*)addr, size);
+    *res = PSMALLINT_NEW(size);
+    return ERR_OK;
+}
+
+/*
+ * args: addr
+ * returns the byte at addr
+ */
+C_NATIVE(_vbl_flash_byte)
+{
+    C_NATIVE_UNWARN();
+    if (nargs != 1 || !IS_INTEGER(args[0]))
+        return ERR_TYPE_EXC;
+    *res = PSMALLINT_NEW(*((uint8_t*)INTEGER_VALUE(args[0])));
+    return ERR_OK;
+}
@@ -16,6 +16,62 @@
 #define _I2CDRIVER_LOCK     5
 #define _I2CDRIVER_UNLOCK   6
 #define _I2CDRIVER_SET_ADDR   7
+#define _I2CDRIVER_READ_REGS_INTO 8
+#define _I2CDRIVER_BATCH    9
+
+typedef struct _i2c_op {
+    uint8_t *tx;
+    uint8_t *rx;
+    uint32_t txlen;
+    uint32_t rxlen;
+    uint16_t addr;
+    uint8_t reg;
+} I2COp;
+
+/*
+ * Converts addr, reg, buf, ofs, n into op: reg is a register number (one byte) or a bytes-like sent as is, buf is a
+ * bytearray receiving n bytes from ofs (to its end if n is negative), or None for a pure write of reg.
+ */
+static err_t i2c_parse_op(PObject **args, I2COp *op)
+{
+    int32_t ofs, n;
+
+    if (!IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[3]) || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    op->addr = (uint16_t)PSMALLINT_VALUE(args[0]);
+    if (IS_PSMALLINT(args[1])) {
+        op->reg = (uint8_t)PSMALLINT_VALUE(args[1]);
+        op->tx = NULL;
+        op->txlen = 1;
+    } else if (IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1]))) {
+        op->tx = PSEQUENCE_BYTES(args[1]);
+        op->txlen = PSEQUENCE_ELEMENTS(args[1]);
+    } else {
+        return ERR_TYPE_EXC;
+    }
+    op->rx = NULL;
+    op->rxlen = 0;
+    if (args[2] == MAKE_NONE())
+        return ERR_OK;
+    if (PTYPE(args[2]) != PBYTEARRAY)
+        return ERR_TYPE_EXC;
+    ofs = PSMALLINT_VALUE(args[3]);
+    n = PSMALLINT_VALUE(args[4]);
+    if (n < 0)
+        n = PSEQUENCE_ELEMENTS(args[2]) - ofs;
+    if (ofs < 0 || n < 0 || ofs + n > PSEQUENCE_ELEMENTS(args[2]))
+        return ERR_INDEX_EXC;
+    op->rx = PSEQUENCE_BYTES(args[2]) + ofs;
+    op->rxlen = n;
+    return ERR_OK;
+}
+
+// without the GIL
+static int i2c_run_op(int32_t drvid, I2COp *op, int32_t timeout)
+{
+    vhalI2CSetAddr(drvid, op->addr);
+    return vhalI2CTransmit(drvid, op->tx ? op->tx : &op->reg, op->txlen, op->rx, op->rxlen, (timeout < 0) ? (VTIME_INFINITE) : TIME_U(timeout, MILLIS));
+}
 
 err_t _i2c_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
     (void)self;
@@ -110,6 +166,63 @@ err_t _i2c_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
             *res=(PObject*)bb;
         }
         break;
+        case _I2CDRIVER_READ_REGS_INTO: {
+            // args: addr, reg, buf, ofs, n, timeout
+            I2COp op;
+            err_t err;
+            if (nargs != 6 || !IS_PSMALLINT(args[5])) goto ret_err_type;
+            err = i2c_parse_op(args, &op);
+            if (err != ERR_OK)
+                return err;
+            RELEASE_GIL();
+            code = i2c_run_op(drvid, &op, PSMALLINT_VALUE(args[5]));
+            ACQUIRE_GIL();
+            if (code < 0)
+                return -code;
+            *res = PSMALLINT_NEW(op.rxlen);
+        }
+        break;
+        case _I2CDRIVER_BATCH: {
+            // args: ops, timeout, lock. ops is a list or tuple of (addr, reg, buf, ofs, n)
+            int32_t timeout, lock, nops, i;
+            PObject *ops, *op;
+            I2COp *iops;
+            err_t err = ERR_OK;
+            if (nargs != 3 || (PTYPE(args[0]) != PLIST && PTYPE(args[0]) != PTUPLE) || !IS_PSMALLINT(args[1]) || !IS_PSMALLINT(args[2])) goto ret_err_type;
+            ops = args[0];
+            timeout = PSMALLINT_VALUE(args[1]);
+            lock = PSMALLINT_VALUE(args[2]);
+            nops = PSEQUENCE_ELEMENTS(ops);
+            if (!nops)
+                break;
+            iops = (I2COp*)gc_malloc(sizeof(I2COp) * nops);
+            for (i = 0; i < nops && err == ERR_OK; i++) {
+                op = (PTYPE(ops) == PLIST) ? PLIST_ITEM(ops, i) : PTUPLE_ITEM(ops, i);
+                if (PTYPE(op) != PTUPLE || PSEQUENCE_ELEMENTS(op) != 5)
+                    err = ERR_TYPE_EXC;
+                else
+                    err = i2c_parse_op((PObject**)((PTuple*)op)->seq, &iops[i]);
+            }
+            if (err != ERR_OK) {
+                gc_free(iops);
+                return err;
+            }
+            code = 0;
+            RELEASE_GIL();
+            if (lock)
+                code = vhalI2CLock(drvid);
+            if (code >= 0) {
+                for (i = 0; i < nops && code >= 0; i++)
+                    code = i2c_run_op(drvid, &iops[i], timeout);
+                if (lock)
+                    vhalI2CUnlock(drvid);
+            }
+            ACQUIRE_GIL();
+            gc_free(iops);
+            if (code < 0)
+                return -code;
+        }
+        break;
         case _I2CDRIVER_SET_ADDR: {
             if (parse_py_args("i",nargs,args,&code)!=1) goto ret_err_type;
             code = vhalI2CSetAddr(drvid,code);
@@ -85,6 +85,65 @@ ret_err:
 }
 
 
+/*
+ * args: pin, trigger, time_window, time_unit, pull, buf, ofs
+ * captures into buf from ofs until its end: a bytearray gets the raw uint32 timings in place (4 bytes each, native order),
+ * a shortarray gets them saturated to 65535 through a temporary buffer. Returns (count, firstbit)
+ */
+err_t _icu_capture_into(int nargs, PObject *self, PObject **args, PObject **res) {
+    (void)self;
+    int32_t pin, trigger, time_unit, pull, ofs, code;
+    uint32_t time_window, bufsize, firstbit = 0, i;
+    uint32_t *buffer;
+    PObject *buf;
+    PTuple *tpl;
+
+    if (nargs != 7 || parse_py_args("iiiii", 5, args, &pin, &trigger, &time_window, &time_unit, &pull) != 5 || !IS_PSMALLINT(args[6]))
+        return ERR_TYPE_EXC;
+    buf = args[5];
+    ofs = PSMALLINT_VALUE(args[6]);
+    if (time_unit < MICROS || time_unit > SECONDS || (int32_t)time_window < 0)
+        return ERR_TYPE_EXC;
+    if (PTYPE(buf) == PBYTEARRAY)
+        bufsize = (ofs < 0) ? 0 : (PSEQUENCE_ELEMENTS(buf) - ofs) / 4;
+    else if (PTYPE(buf) == PSHORTARRAY)
+        bufsize = (ofs < 0) ? 0 : PSEQUENCE_ELEMENTS(buf) - ofs;
+    else
+        return ERR_TYPE_EXC;
+    if (ofs < 0 || ofs > PSEQUENCE_ELEMENTS(buf) || !bufsize || bufsize > 0xffff)
+        return ERR_INDEX_EXC;
+    time_window = TIME_U(time_window, time_unit);
+    uint32_t cfg = ICU_CFG(trigger, 0, (pull) ? ICU_INPUT_PULLUP : ICU_INPUT_PULLDOWN);
+
+    if (PTYPE(buf) == PBYTEARRAY) {
+        // the driver stores words
+        if (ofs % 4)
+            return ERR_VALUE_EXC;
+        buffer = (uint32_t *)(PSEQUENCE_BYTES(buf) + ofs);
+    } else {
+        buffer = (uint32_t *)gc_malloc(sizeof(uint32_t) * bufsize);
+    }
+    RELEASE_GIL();
+    code = vhalIcuStart(pin, cfg, time_window, buffer, &bufsize, &firstbit);
+    ACQUIRE_GIL();
+    if (PTYPE(buf) == PSHORTARRAY) {
+        if (code >= 0) {
+            uint16_t *dst = PSEQUENCE_SHORTS(buf) + ofs;
+            for (i = 0; i < bufsize; i++)
+                dst[i] = (buffer[i] > 0xffff) ? 0xffff : buffer[i];
+        }
+        gc_free(buffer);
+    }
+    if (code < 0)
+        return -code;
+    tpl = ptuple_new(2, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(bufsize));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(firstbit));
+    *res = (PObject *)tpl;
+    return ERR_OK;
+}
+
+
 const VBLDriver icudriver = {
     PRPH_ICU,
     _icu_ctl
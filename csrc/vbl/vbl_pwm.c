@@ -44,6 +44,52 @@ ret_unsup:
 }
 
 
+/*
+ * args: pin, period, pulses, step, repeat, time_unit
+ * plays the pulse widths of the shortarray pulses, each for step microseconds, repeat times, then disables pwm.
+ * The duty cycle is changed by this thread without the GIL, at deadlines taken from a system timer so the error
+ * does not accumulate.
+ */
+err_t _pwm_sequence(int nargs, PObject *self, PObject **args, PObject **res) {
+    (void)self;
+    int32_t pin, period, step, repeat, time_unit, n, i, r, code = 0, wait;
+    uint16_t *pulses;
+    uint32_t start, elapsed, deadline;
+    VSysTimer tm;
+
+    *res = MAKE_NONE();
+    if (nargs != 6 || PTYPE(args[2]) != PSHORTARRAY)
+        return ERR_TYPE_EXC;
+    if (parse_py_args("ii", 2, args, &pin, &period) != 2 || parse_py_args("iii", 3, args + 3, &step, &repeat, &time_unit) != 3)
+        return ERR_TYPE_EXC;
+    n = PSEQUENCE_ELEMENTS(args[2]);
+    if (period <= 0 || step <= 0 || repeat <= 0 || !n)
+        return ERR_VALUE_EXC;
+    pulses = PSEQUENCE_SHORTS(args[2]);
+
+    tm = vosTimerCreate();
+    RELEASE_GIL();
+    start = vosTimerReadMicros(tm);
+    deadline = 0;
+    for (r = 0; r < repeat && code >= 0; r++) {
+        for (i = 0; i < n && code >= 0; i++) {
+            code = vhalPwmStart(pin, TIME_U(period, time_unit), TIME_U(pulses[i], time_unit), 0);
+            deadline += step;
+            elapsed = vosTimerReadMicros(tm) - start;
+            wait = (int32_t)(deadline - elapsed);
+            if (wait > 0)
+                vosThSleep(TIME_U(wait, MICROS));
+        }
+    }
+    vhalPwmStart(pin, 0, 0, 0);
+    ACQUIRE_GIL();
+    vosTimerDestroy(tm);
+    if (code < 0)
+        return -code;
+    return ERR_OK;
+}
+
+
 const VBLDriver pwmdriver = {
     PRPH_PWM,
     _pwm_ctl
@@ -0,0 +1,218 @@
+#include "zerynth.h"
+#include "vosal.h"
+#include "vhal.h"
+#include "vbl.h"
+#include "lang.h"
+
+
+// #define printf(...) vbl_printf_stdout(__VA_ARGS__)
+#define printf(...)
+
+/*
+ * Read-ahead buffer of a serial port, kept in a bytearray owned by the Python object:
+ * a header followed by cap bytes of data, of which count are buffered starting at head.
+ * It is refilled only when drained, so buffered bytes never wrap.
+ */
+typedef struct _serbuf {
+    int32_t head;
+    int32_t count;
+    int32_t cap;
+    uint8_t data[];
+} SerBuf;
+
+#define SER_BUF(o) ((SerBuf*)PSEQUENCE_BYTES(o))
+#define IS_SER_BUF(o) (PTYPE(o)==PBYTEARRAY && PSEQUENCE_ELEMENTS(o)>(int32_t)sizeof(SerBuf) && SER_BUF(o)->cap==PSEQUENCE_ELEMENTS(o)-(int32_t)sizeof(SerBuf))
+
+/*
+ * refills the drained buffer: everything already received (up to cap) without waiting,
+ * otherwise waits at most timeout for bytes up to end (if end>=0) or for a single byte.
+ * Returns the bytes buffered
+ */
+static int32_t ser_fill(int32_t ser, SerBuf *sb, int32_t end, int32_t want, uint32_t timeout)
+{
+    int32_t n, rd = 0;
+
+    RELEASE_GIL();
+    n = vhalSerialAvailable(ser);
+    if (n > 0) {
+        if (n > sb->cap)
+            n = sb->cap;
+        rd = vhalSerialRead(ser, sb->data, n);
+    } else {
+        //with a separator the driver can wait for the whole line
+        if (end < 0 || want > sb->cap)
+            want = (end < 0) ? 1 : sb->cap;
+        vhalSerialReadEx(ser, sb->data, want, end, &rd, timeout);
+    }
+    ACQUIRE_GIL();
+    sb->head = 0;
+    sb->count = (rd > 0) ? rd : 0;
+    return sb->count;
+}
+
+/*
+ * args: size
+ * returns the state of an empty buffer of size bytes
+ */
+C_NATIVE(_vbl_serial_buf_new)
+{
+    C_NATIVE_UNWARN();
+    int32_t size;
+    PObject *state;
+    SerBuf *sb;
+
+    if (parse_py_args("i", nargs, args, &size) != 1)
+        return ERR_TYPE_EXC;
+    if (size <= 0)
+        return ERR_VALUE_EXC;
+    state = (PObject*)psequence_new(PBYTEARRAY, sizeof(SerBuf) + size);
+    PSEQUENCE_ELEMENTS_SET(state, sizeof(SerBuf) + size);
+    sb = SER_BUF(state);
+    sb->head = 0;
+    sb->count = 0;
+    sb->cap = size;
+    *res = state;
+    return ERR_OK;
+}
+
+/*
+ * args: ser, state, end, buffer, ofs, timeout
+ * moves bytes from the serial port to buffer starting at ofs, until the byte end is stored (end>=0), buffer is full or
+ * timeout milliseconds pass without bytes (negative for no timeout). With end<0 returns as soon as some bytes are stored.
+ * Returns the position in buffer after the last byte stored
+ */
+C_NATIVE(_vbl_serial_read_until)
+{
+    C_NATIVE_UNWARN();
+    int32_t ser, end, ofs, size, tmo, n, i;
+    uint32_t timeout;
+    uint8_t *out;
+    uint8_t *p;
+    SerBuf *sb;
+
+    if (nargs != 6 || !IS_PSMALLINT(args[0]) || !IS_SER_BUF(args[1]) || !IS_PSMALLINT(args[2]) || PTYPE(args[3]) != PBYTEARRAY || !IS_PSMALLINT(args[4]) || !IS_PSMALLINT(args[5]))
+        return ERR_TYPE_EXC;
+    ser = PSMALLINT_VALUE(args[0]) & 0xff;
+    sb = SER_BUF(args[1]);
+    end = PSMALLINT_VALUE(args[2]);
+    out = PSEQUENCE_BYTES(args[3]);
+    size = PSEQUENCE_ELEMENTS(args[3]);
+    ofs = PSMALLINT_VALUE(args[4]);
+    tmo = PSMALLINT_VALUE(args[5]);
+    if (ofs < 0 || ofs > size)
+        return ERR_INDEX_EXC;
+    timeout = (tmo < 0) ? VTIME_INFINITE : TIME_U(tmo, MILLIS);
+
+    while (ofs < size) {
+        if (!sb->count) {
+            //without a separator, stop at the first empty read once something is stored
+            if (end < 0 && ofs > PSMALLINT_VALUE(args[4]) && vhalSerialAvailable(ser) <= 0)
+                break;
+            if (!ser_fill(ser, sb, end, size - ofs, timeout))
+                break;
+        }
+        n = size - ofs;
+        if (n > sb->count)
+            n = sb->count;
+        p = sb->data + sb->head;
+        if (end >= 0) {
+            for (i = 0; i < n && p[i] != end; i++);
+            if (i < n)
+                n = i + 1;
+        } else
+            i = n;
+        memcpy(out + ofs, p, n);
+        ofs += n;
+        sb->head += n;
+        sb->count -= n;
+        if (end >= 0 && i < n)
+            break;
+    }
+    *res = PSMALLINT_NEW(ofs);
+    return ERR_OK;
+}
+
+/*
+ * args: state
+ * returns the number of bytes buffered
+ */
+C_NATIVE(_vbl_serial_buffered)
+{
+    C_NATIVE_UNWARN();
+    if (nargs != 1 || !IS_SER_BUF(args[0]))
+        return ERR_TYPE_EXC;
+    *res = PSMALLINT_NEW(SER_BUF(args[0])->count);
+    return ERR_OK;
+}
+
+/*
+ * args: ser, state, buffer, ofs, timeout, gap
+ * reads a burst into buffer from ofs: waits at most timeout millis (forever if negative) for its first byte, then takes
+ * bytes until the line stays idle for gap microseconds or buffer is full. Bytes already in state (None if the stream
+ * has no read-ahead buffer) come first. Returns the position in buffer after the last byte stored
+ */
+C_NATIVE(_vbl_serial_read_frame)
+{
+    C_NATIVE_UNWARN();
+    int32_t ser, ofs, size, tmo, gap, n, rd;
+    uint8_t *out;
+    SerBuf *sb = NULL;
+
+    if (nargs != 6 || !IS_PSMALLINT(args[0]) || PTYPE(args[2]) != PBYTEARRAY || !IS_PSMALLINT(args[3]) || !IS_PSMALLINT(args[4]) || !IS_PSMALLINT(args[5]))
+        return ERR_TYPE_EXC;
+    if (args[1] != MAKE_NONE()) {
+        if (!IS_SER_BUF(args[1]))
+            return ERR_TYPE_EXC;
+        sb = SER_BUF(args[1]);
+    }
+    ser = PSMALLINT_VALUE(args[0]) & 0xff;
+    out = PSEQUENCE_BYTES(args[2]);
+    size = PSEQUENCE_ELEMENTS(args[2]);
+    ofs = PSMALLINT_VALUE(args[3]);
+    tmo = PSMALLINT_VALUE(args[4]);
+    gap = PSMALLINT_VALUE(args[5]);
+    if (ofs < 0 || ofs > size)
+        return ERR_INDEX_EXC;
+    if (gap <= 0)
+        return ERR_VALUE_EXC;
+
+    if (sb && sb->count) {
+        n = size - ofs;
+        if (n > sb->count)
+            n = sb->count;
+        memcpy(out + ofs, sb->data + sb->head, n);
+        ofs += n;
+        sb->head += n;
+        sb->count -= n;
+    } else if (ofs < size) {
+        rd = 0;
+        RELEASE_GIL();
+        vhalSerialReadEx(ser, out + ofs, 1, -1, &rd, (tmo < 0) ? VTIME_INFINITE : TIME_U(tmo, MILLIS));
+        ACQUIRE_GIL();
+        if (rd <= 0) {
+            *res = PSMALLINT_NEW(ofs);
+            return ERR_OK;
+        }
+        ofs += rd;
+    }
+
+    RELEASE_GIL();
+    while (ofs < size) {
+        n = vhalSerialAvailable(ser);
+        if (n > 0) {
+            if (n > size - ofs)
+                n = size - ofs;
+            rd = vhalSerialRead(ser, out + ofs, n);
+        } else {
+            // idle line detection: a byte must come within gap
+            rd = 0;
+            vhalSerialReadEx(ser, out + ofs, 1, -1, &rd, TIME_U(gap, MICROS));
+        }
+        if (rd <= 0)
+            break;
+        ofs += rd;
+    }
+    ACQUIRE_GIL();
+    *res = PSMALLINT_NEW(ofs);
+    return ERR_OK;
+}
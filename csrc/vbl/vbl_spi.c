@@ -22,6 +22,72 @@
 #define _SPIDRIVER_EXCHANGE 9
 #define _SPIDRIVER_READ_INTO 10
 #define _SPIDRIVER_EXCHANGE_INTO 11
+#define _SPIDRIVER_TRANSACTION 12
+
+typedef struct _spi_segment {
+    uint8_t *tosend;
+    uint8_t *toread;
+    uint32_t len;
+} SpiSegment;
+
+#define SEQ_ITEM(seq, i) ((PTYPE(seq) == PLIST) ? PLIST_ITEM(seq, i) : PTUPLE_ITEM(seq, i))
+
+/*
+ * Converts the segments of a transaction: (data, WRITE), (n, SKIP), (n, READ_INTO, buf) or (data, EXCHANGE_INTO, buf).
+ * A negative n reads len(buf) frames. Pointers are taken with the GIL, so the bus runs without it.
+ */
+static int spi_parse_segment(PObject *seg, SpiSegment *s)
+{
+    PObject *data, *buf = NULL;
+    int32_t kind, n;
+
+    if (PTYPE(seg) != PTUPLE || PSEQUENCE_ELEMENTS(seg) < 2 || !IS_PSMALLINT(PTUPLE_ITEM(seg, 1)))
+        return ERR_TYPE_EXC;
+    data = PTUPLE_ITEM(seg, 0);
+    kind = PSMALLINT_VALUE(PTUPLE_ITEM(seg, 1));
+    if (kind == _SPIDRIVER_READ_INTO || kind == _SPIDRIVER_EXCHANGE_INTO) {
+        if (PSEQUENCE_ELEMENTS(seg) != 3 || PTYPE(PTUPLE_ITEM(seg, 2)) != PBYTEARRAY)
+            return ERR_TYPE_EXC;
+        buf = PTUPLE_ITEM(seg, 2);
+    } else if (PSEQUENCE_ELEMENTS(seg) != 2) {
+        return ERR_TYPE_EXC;
+    }
+    s->tosend = NULL;
+    s->toread = NULL;
+    switch (kind) {
+        case _SPIDRIVER_WRITE:
+        case _SPIDRIVER_EXCHANGE_INTO:
+            if (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(data)))
+                return ERR_TYPE_EXC;
+            s->tosend = PSEQUENCE_BYTES(data);
+            s->len = PSEQUENCE_ELEMENTS(data);
+            if (buf) {
+                if ((uint32_t)PSEQUENCE_ELEMENTS(buf) < s->len)
+                    return ERR_INDEX_EXC;
+                s->toread = PSEQUENCE_BYTES(buf);
+            }
+            break;
+        case _SPIDRIVER_SKIP:
+        case _SPIDRIVER_READ_INTO:
+            if (!IS_PSMALLINT(data))
+                return ERR_TYPE_EXC;
+            n = PSMALLINT_VALUE(data);
+            if (buf) {
+                if (n < 0)
+                    n = PSEQUENCE_ELEMENTS(buf);
+                if (n > PSEQUENCE_ELEMENTS(buf))
+                    return ERR_INDEX_EXC;
+                s->toread = PSEQUENCE_BYTES(buf);
+            } else if (n < 0) {
+                return ERR_VALUE_EXC;
+            }
+            s->len = n;
+            break;
+        default:
+            return ERR_VALUE_EXC;
+    }
+    return ERR_OK;
+}
 
 err_t _spi_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
     (void)self;
@@ -78,6 +144,47 @@ err_t _spi_ctl(int nargs, PObject *self, PObject **args, PObject **res) {
                 return -code;
         }
         break;
+        case _SPIDRIVER_TRANSACTION: {
+            // args: nss, lock, segments. The bus is already configured for nss and the other slaves unselected
+            int32_t nss, lock, nseg, i;
+            PObject *segs;
+            SpiSegment *sg;
+            err_t err;
+
+            if (nargs != 3 || !IS_PSMALLINT(args[0]) || !IS_PSMALLINT(args[1]) || (PTYPE(args[2]) != PLIST && PTYPE(args[2]) != PTUPLE))
+                goto ret_err_type;
+            nss = PSMALLINT_VALUE(args[0]);
+            lock = PSMALLINT_VALUE(args[1]);
+            segs = args[2];
+            nseg = PSEQUENCE_ELEMENTS(segs);
+            if (!nseg)
+                break;
+            sg = (SpiSegment*)gc_malloc(sizeof(SpiSegment) * nseg);
+            for (i = 0; i < nseg; i++) {
+                err = spi_parse_segment(SEQ_ITEM(segs, i), &sg[i]);
+                if (err != ERR_OK) {
+                    gc_free(sg);
+                    return err;
+                }
+            }
+            code = 0;
+            RELEASE_GIL();
+            if (lock)
+                code = vhalSpiLock(drvid);
+            if (code >= 0) {
+                vhalPinWrite(nss, 0);
+                for (i = 0; i < nseg && code >= 0; i++)
+                    code = vhalSpiExchange(drvid, sg[i].tosend, sg[i].toread, sg[i].len);
+                vhalPinWrite(nss, 1);
+                if (lock)
+                    vhalSpiUnlock(drvid);
+            }
+            ACQUIRE_GIL();
+            gc_free(sg);
+            if (code < 0)
+                return -code;
+        }
+        break;
         default:
         {
             int32_t len;
@@ -0,0 +1,157 @@
+#include "zerynth.h"
+
+/*
+ * Sampling bytecode profiler for vm.profile_start.
+ *
+ * A recurrent system timer interrupts the running thread and counts a hit for its current Python frame
+ * (module, code and pc, the same triples decoded in tracebacks), per thread, in a hash table in RAM.
+ * The frame of a thread blocked in a native is its caller, so time spent in natives is charged to the bytecode calling them;
+ * ticks with no Python frame (idle, or system threads) are counted apart.
+ * When the table is full new sites are only counted as dropped: the sites already in keep exact counts.
+ */
+
+#ifndef VMPROF_SITES
+#define VMPROF_SITES    128     // power of 2
+#endif
+
+typedef struct _vmprof_site {
+    uint32_t thread;
+    uint16_t module;
+    uint16_t code;
+    uint16_t pc;
+    uint16_t used;
+    uint32_t hits;
+} VmProfSite;
+
+static VmProfSite vmprof_sites[VMPROF_SITES];
+static VSysTimer vmprof_vtm;
+static uint32_t vmprof_samples;
+static uint32_t vmprof_idle;
+static uint32_t vmprof_dropped;
+
+static void vmprof_tick_isr(void *arg)
+{
+    (void)arg;
+    VThread th = vosThCurrent();
+    PThread *pth;
+    PFrame *frm;
+    VmProfSite *s;
+    uint32_t id, h, i;
+
+    SYSLOCK_I();
+    vmprof_samples++;
+    pth = th ? (PThread*)vosThGetData(th) : NULL;
+    frm = pth ? pth->frame : NULL;
+    if (!frm) {
+        vmprof_idle++;
+        goto out;
+    }
+    id = vosThGetId(th);
+    h = (id * 31 + frm->module * 7 + frm->code) * 2654435761u + frm->pc;
+    for (i = 0; i < VMPROF_SITES; i++) {
+        s = &vmprof_sites[(h + i) & (VMPROF_SITES - 1)];
+        if (!s->used) {
+            s->used = 1;
+            s->thread = id;
+            s->module = frm->module;
+            s->code = frm->code;
+            s->pc = frm->pc;
+        } else if (s->thread != id || s->module != frm->module || s->code != frm->code || s->pc != frm->pc) {
+            continue;
+        }
+        s->hits++;
+        goto out;
+    }
+    vmprof_dropped++;
+out:
+    SYSUNLOCK_I();
+}
+
+/*
+ * args: period
+ * starts sampling every period microseconds, clearing the table, or stops it if period is 0
+ */
+C_NATIVE(__vmprof_start)
+{
+    C_NATIVE_UNWARN();
+    int32_t period;
+
+    if (parse_py_args("i", nargs, args, &period) != 1)
+        return ERR_TYPE_EXC;
+    if (period < 0)
+        return ERR_VALUE_EXC;
+    *res = MAKE_NONE();
+    if (!vmprof_vtm)
+        vmprof_vtm = vosTimerCreate();
+    SYSLOCK();
+    vosTimerReset(vmprof_vtm);
+    if (period) {
+        memset(vmprof_sites, 0, sizeof(vmprof_sites));
+        vmprof_samples = vmprof_idle = vmprof_dropped = 0;
+        vosTimerRecurrent(vmprof_vtm, TIME_U(period, MICROS), vmprof_tick_isr, NULL);
+    }
+    SYSUNLOCK();
+    return ERR_OK;
+}
+
+/*
+ * args: top_n
+ * returns (sites, samples, idle, dropped): sites is the list of the top_n sites by hits, as (thread, module, code, pc, hits) tuples.
+ * Sampling goes on: the table is copied first
+ */
+C_NATIVE(__vmprof_stats)
+{
+    C_NATIVE_UNWARN();
+    int32_t top, n, i, j;
+    VmProfSite *sites, t;
+    PTuple *tpl, *site;
+    PList *lst;
+    uint32_t samples, idle, dropped;
+
+    if (parse_py_args("i", nargs, args, &top) != 1)
+        return ERR_TYPE_EXC;
+    sites = gc_malloc(sizeof(vmprof_sites));
+    SYSLOCK();
+    memcpy(sites, vmprof_sites, sizeof(vmprof_sites));
+    samples = vmprof_samples;
+    idle = vmprof_idle;
+    dropped = vmprof_dropped;
+    SYSUNLOCK();
+    // compact the used slots
+    for (i = 0, n = 0; i < VMPROF_SITES; i++) {
+        if (sites[i].used)
+            sites[n++] = sites[i];
+    }
+    if (top < 0 || top > n)
+        top = n;
+    // partial selection sort
+    for (i = 0; i < top; i++) {
+        for (j = i + 1; j < n; j++) {
+            if (sites[j].hits > sites[i].hits) {
+                t = sites[i];
+                sites[i] = sites[j];
+                sites[j] = t;
+            }
+        }
+    }
+
+    tpl = ptuple_new(4, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, MAKE_NONE());
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(samples));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(idle));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(dropped));
+    *res = (PObject*)tpl;
+    lst = plist_new(top, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, lst);
+    for (i = 0; i < top; i++) {
+        site = ptuple_new(5, NULL);
+        PTUPLE_SET_ITEM(site, 0, PSMALLINT_NEW(sites[i].thread));
+        PTUPLE_SET_ITEM(site, 1, PSMALLINT_NEW(sites[i].module));
+        PTUPLE_SET_ITEM(site, 2, PSMALLINT_NEW(sites[i].code));
+        PTUPLE_SET_ITEM(site, 3, PSMALLINT_NEW(sites[i].pc));
+        PTUPLE_SET_ITEM(site, 4, PSMALLINT_NEW(sites[i].hits));
+        PLIST_SET_ITEM(lst, i, site);
+    }
+    gc_free(sites);
+    return ERR_OK;
+}
@@ -8,6 +8,7 @@
 #define ZERYNTH_PRINTF
 #include "zerynth.h"
 #include "zerynth_hwcrypto.h"
+#include "zerynth_drbg.h"
 #include "mbedtls/x509_csr.h"
 #include "mbedtls/pk_internal.h"
 #include "mbedtls/entropy.h"
@@ -82,21 +83,8 @@ int mbedtls_mutex_unlock_alt( mbedtls_threading_mutex_t *mutex ){
 }
 int mbedtls_hardware_poll( void *data, unsigned char *output, size_t len, size_t *olen )
 {
-    (void) data;
-    (void) output;
-    (void) len;
-    (void) olen;
-    /* Fill output buffer */
-    for (uint32_t i = 0, tmp_rnd = 0; i < len; i++)
-    {
-        /* Get 4B random number */
-        if ((i & 0x3) == 0)
-            tmp_rnd = vhalRngGenerate();
-        output[i] = ((uint8_t*)&tmp_rnd)[i & 0x3];
-    }
-    *olen = len;
-    return 0;
-
+    //the system DRBG, seeded from the hardware RNG, does not wait for hardware entropy
+    return zdrbg_poll(data, output, len, olen);
 }
 #endif
 
@@ -0,0 +1,633 @@
+#include "zerynth.h"
+#include "../crc/crc.h"
+
+/*
+ * Resumable inflate (RFC 1951) with zlib (RFC 1950) and gzip (RFC 1952) wrappers.
+ * The whole decoder state lives in a bytearray owned by Python: input and output
+ * can be given in pieces of any size, the decoder stops when either runs out and
+ * continues from the same point at the next call. Huffman codes are decoded a bit
+ * at a time on canonical tables (as in zlib's puff) to keep the state small:
+ * apart from the window, about 2KB.
+ */
+
+// formats, from the wbits convention of CPython zlib
+#define ZI_RAW  0
+#define ZI_ZLIB 1
+#define ZI_GZIP 2
+#define ZI_AUTO 3
+
+// steps of the decoder
+#define ZI_M_AUTO       0
+#define ZI_M_ZHEAD      1
+#define ZI_M_GHEAD      2
+#define ZI_M_GEXTRALEN  3
+#define ZI_M_GEXTRA     4
+#define ZI_M_GNAME      5
+#define ZI_M_GCOMMENT   6
+#define ZI_M_GHCRC      7
+#define ZI_M_BLOCK      8
+#define ZI_M_STORED_LEN 9
+#define ZI_M_STORED     10
+#define ZI_M_TABLE      11
+#define ZI_M_CLENS      12
+#define ZI_M_LENS       13
+#define ZI_M_LEN        14
+#define ZI_M_DIST       15
+#define ZI_M_DISTEXT    16
+#define ZI_M_COPY       17
+#define ZI_M_TRAILER    18
+#define ZI_M_DONE       19
+
+// results of zi_run
+#define ZI_MORE  0
+#define ZI_END   1
+#define ZI_SYNC  2  // the trailer follows: the checksum must be up to date
+#define ZI_BAD  -1
+
+// bytes output by zinflate_run between two GIL checkpoints
+#ifndef ZI_SLICE
+#define ZI_SLICE 2048
+#endif
+
+#define ZI_MAXBITS 15
+
+// gzip header flags
+#define ZI_FHCRC    2
+#define ZI_FEXTRA   4
+#define ZI_FNAME    8
+#define ZI_FCOMMENT 16
+
+typedef struct _zi_huff {
+    uint16_t counts[ZI_MAXBITS+1];  // number of codes of each length
+    uint16_t symbols[288];          // symbols ordered by code
+} ZiHuff;
+
+typedef struct _zi_state {
+    uint8_t mode;
+    uint8_t format;
+    uint8_t final;      // the current block is the last one
+    uint8_t wbits;
+    uint8_t gflags;
+    uint32_t bitbuf;    // bits not consumed yet, lsb first
+    int32_t bitcnt;
+    uint32_t total;     // bytes output so far: the window position is total&wmask
+    uint32_t wmask;
+    int32_t len;        // stored or match length, counter of headers and trailers
+    int32_t dist;       // match distance, or pending distance symbol
+    uint32_t acc;       // trailer being read
+    uint32_t check;     // adler32 or crc32 of the output
+    int16_t hlit;
+    int16_t hdist;
+    int16_t hclen;
+    int16_t ncodes;
+    uint8_t lens[320];
+    ZiHuff ltree;
+    ZiHuff dtree;
+    uint8_t window[];
+} ZiState;
+
+typedef struct _zi_in {
+    uint8_t *buf;
+    int32_t start;
+    int32_t pos;
+    int32_t len;
+} ZiIn;
+
+typedef struct _zi_out {
+    uint8_t *buf;
+    int32_t pos;
+    int32_t len;
+} ZiOut;
+
+#define ZI_STATE(o) ((ZiState*)PSEQUENCE_BYTES(o))
+#define IS_ZI_STATE(o) (PTYPE(o)==PBYTEARRAY && PSEQUENCE_ELEMENTS(o)>(int32_t)sizeof(ZiState) && ZI_STATE(o)->wmask+1==(uint32_t)(PSEQUENCE_ELEMENTS(o)-sizeof(ZiState)))
+
+static const uint16_t zi_lbase[29] = {3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258};
+static const uint8_t zi_lext[29] = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0};
+static const uint16_t zi_dbase[30] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
+static const uint8_t zi_dext[30] = {0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
+static const uint8_t zi_clorder[19] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
+
+static uint32_t zi_adler32(uint32_t adler, uint8_t *buf, int32_t len)
+{
+    uint32_t a = adler & 0xffff, b = adler >> 16;
+    int32_t n;
+
+    while (len > 0) {
+        //5552 bytes can be summed before the sums overflow
+        n = (len < 5552) ? len : 5552;
+        len -= n;
+        while (n--) {
+            a += *buf++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+// makes at least n bits (n <= 24) available: returns 0 if the input ends first
+static int zi_need(ZiState *z, ZiIn *in, int32_t n)
+{
+    while (z->bitcnt < n) {
+        if (in->pos >= in->len)
+            return 0;
+        z->bitbuf |= (uint32_t)in->buf[in->pos++] << z->bitcnt;
+        z->bitcnt += 8;
+    }
+    return 1;
+}
+
+static uint32_t zi_bits(ZiState *z, int32_t n)
+{
+    uint32_t v = z->bitbuf & ((1u << n) - 1);
+    z->bitbuf >>= n;
+    z->bitcnt -= n;
+    return v;
+}
+
+/*
+ * Decodes the next symbol of t without consuming its bits, that are stored in nbits.
+ * Returns the symbol, -1 if the input ends before the code or -2 if the code is invalid
+ */
+static int32_t zi_peek(ZiState *z, ZiIn *in, ZiHuff *t, int32_t *nbits)
+{
+    int32_t code = 0, first = 0, index = 0, count, len;
+
+    for (len = 1; len <= ZI_MAXBITS; len++) {
+        if (!zi_need(z, in, len))
+            return -1;
+        code |= (z->bitbuf >> (len - 1)) & 1;
+        count = t->counts[len];
+        if (code - count < first) {
+            *nbits = len;
+            return t->symbols[index + (code - first)];
+        }
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+    return -2;
+}
+
+// builds the canonical code of n symbols with the given lengths: returns 0 if it is over-subscribed
+static int zi_build(ZiHuff *t, uint8_t *lens, int32_t n)
+{
+    uint16_t offs[ZI_MAXBITS+1];
+    int32_t i, left;
+
+    memset(t->counts, 0, sizeof(t->counts));
+    for (i = 0; i < n; i++)
+        t->counts[lens[i]]++;
+    left = 1;
+    for (i = 1; i <= ZI_MAXBITS; i++) {
+        left <<= 1;
+        left -= t->counts[i];
+        if (left < 0)
+            return 0;
+    }
+    offs[1] = 0;
+    for (i = 1; i < ZI_MAXBITS; i++)
+        offs[i + 1] = offs[i] + t->counts[i];
+    for (i = 0; i < n; i++) {
+        if (lens[i])
+            t->symbols[offs[lens[i]]++] = i;
+    }
+    t->counts[0] = 0;
+    return 1;
+}
+
+static void zi_fixed(ZiState *z)
+{
+    int32_t i;
+
+    for (i = 0; i < 144; i++) z->lens[i] = 8;
+    for (; i < 256; i++) z->lens[i] = 9;
+    for (; i < 280; i++) z->lens[i] = 7;
+    for (; i < 288; i++) z->lens[i] = 8;
+    zi_build(&z->ltree, z->lens, 288);
+    for (i = 0; i < 30; i++) z->lens[i] = 5;
+    zi_build(&z->dtree, z->lens, 30);
+}
+
+static void zi_put(ZiState *z, ZiOut *out, uint8_t c)
+{
+    z->window[z->total & z->wmask] = c;
+    z->total++;
+    out->buf[out->pos++] = c;
+}
+
+// reads the next header or trailer byte: returns -1 if the input ends first
+static int32_t zi_byte(ZiState *z, ZiIn *in)
+{
+    if (!zi_need(z, in, 8))
+        return -1;
+    return zi_bits(z, 8);
+}
+
+static void zi_trailer_start(ZiState *z)
+{
+    //trailers are byte aligned
+    zi_bits(z, z->bitcnt & 7);
+    z->len = 0;
+    z->acc = 0;
+    z->mode = (z->format == ZI_RAW) ? ZI_M_DONE : ZI_M_TRAILER;
+}
+
+/*
+ * Runs the decoder until the input ends, the output is full or the stream ends.
+ * Returns ZI_END at the end of the stream, ZI_BAD on corrupted data, ZI_SYNC after the last block, ZI_MORE otherwise
+ */
+static int zi_run(ZiState *z, ZiIn *in, ZiOut *out)
+{
+    int32_t c, sym, nbits, i;
+
+    for (;;) {
+        switch (z->mode) {
+            case ZI_M_AUTO:
+                if (!zi_need(z, in, 8))
+                    return ZI_MORE;
+                z->format = ((z->bitbuf & 0xff) == 0x1f) ? ZI_GZIP : ZI_ZLIB;
+                z->mode = (z->format == ZI_GZIP) ? ZI_M_GHEAD : ZI_M_ZHEAD;
+                z->check = (z->format == ZI_GZIP) ? 0 : 1;
+                z->len = 0;
+                break;
+            case ZI_M_ZHEAD:
+                if (!zi_need(z, in, 16))
+                    return ZI_MORE;
+                c = zi_bits(z, 8);
+                i = zi_bits(z, 8);
+                //deflate, a window we can hold, no preset dictionary
+                if ((c & 15) != 8 || (c >> 4) + 8 > z->wbits || ((c << 8) | i) % 31 || (i & 0x20))
+                    return ZI_BAD;
+                z->mode = ZI_M_BLOCK;
+                break;
+            case ZI_M_GHEAD:
+                //id1 id2 cm flg mtime(4) xfl os
+                while (z->len < 10) {
+                    c = zi_byte(z, in);
+                    if (c < 0)
+                        return ZI_MORE;
+                    if ((z->len == 0 && c != 0x1f) || (z->len == 1 && c != 0x8b) || (z->len == 2 && c != 8))
+                        return ZI_BAD;
+                    if (z->len == 3)
+                        z->gflags = c;
+                    z->len++;
+                }
+                z->len = 0;
+                z->mode = ZI_M_GEXTRALEN;
+                break;
+            case ZI_M_GEXTRALEN:
+                if (z->gflags & ZI_FEXTRA) {
+                    if (!zi_need(z, in, 16))
+                        return ZI_MORE;
+                    z->len = zi_bits(z, 16);
+                }
+                z->mode = ZI_M_GEXTRA;
+                break;
+            case ZI_M_GEXTRA:
+                while (z->len) {
+                    if (zi_byte(z, in) < 0)
+                        return ZI_MORE;
+                    z->len--;
+                }
+                z->mode = ZI_M_GNAME;
+                break;
+            case ZI_M_GNAME:
+            case ZI_M_GCOMMENT:
+                //zero terminated strings
+                if (z->gflags & ((z->mode == ZI_M_GNAME) ? ZI_FNAME : ZI_FCOMMENT)) {
+                    do {
+                        c = zi_byte(z, in);
+                        if (c < 0)
+                            return ZI_MORE;
+                    } while (c);
+                }
+                z->mode++;
+                break;
+            case ZI_M_GHCRC:
+                if (z->gflags & ZI_FHCRC) {
+                    if (!zi_need(z, in, 16))
+                        return ZI_MORE;
+                    zi_bits(z, 16);
+                }
+                z->mode = ZI_M_BLOCK;
+                break;
+            case ZI_M_BLOCK:
+                if (!zi_need(z, in, 3))
+                    return ZI_MORE;
+                z->final = zi_bits(z, 1);
+                c = zi_bits(z, 2);
+                if (c == 0) {
+                    zi_bits(z, z->bitcnt & 7);
+                    z->mode = ZI_M_STORED_LEN;
+                } else if (c == 1) {
+                    zi_fixed(z);
+                    z->mode = ZI_M_LEN;
+                } else if (c == 2) {
+                    z->mode = ZI_M_TABLE;
+                } else
+                    return ZI_BAD;
+                break;
+            case ZI_M_STORED_LEN:
+                //LEN, then NLEN: ncodes tells which one is next
+                if (!zi_need(z, in, 16))
+                    return ZI_MORE;
+                if (!z->ncodes) {
+                    z->len = zi_bits(z, 16);
+                    z->ncodes = 1;
+                    break;
+                }
+                z->ncodes = 0;
+                if ((zi_bits(z, 16) ^ 0xffff) != (uint32_t)z->len)
+                    return ZI_BAD;
+                z->mode = ZI_M_STORED;
+                break;
+            case ZI_M_STORED:
+                while (z->len) {
+                    if (out->pos >= out->len)
+                        return ZI_MORE;
+                    if (z->bitcnt) {
+                        zi_put(z, out, zi_bits(z, 8));
+                        z->len--;
+                        continue;
+                    }
+                    if (in->pos >= in->len)
+                        return ZI_MORE;
+                    //bulk copy, the bit buffer is empty
+                    c = z->len;
+                    if (c > in->len - in->pos) c = in->len - in->pos;
+                    if (c > out->len - out->pos) c = out->len - out->pos;
+                    for (i = 0; i < c; i++)
+                        z->window[(z->total + i) & z->wmask] = in->buf[in->pos + i];
+                    memcpy(out->buf + out->pos, in->buf + in->pos, c);
+                    z->total += c;
+                    in->pos += c;
+                    out->pos += c;
+                    z->len -= c;
+                }
+                if (z->final) {
+                    zi_trailer_start(z);
+                    return ZI_SYNC;
+                }
+                z->mode = ZI_M_BLOCK;
+                break;
+            case ZI_M_TABLE:
+                if (!zi_need(z, in, 14))
+                    return ZI_MORE;
+                z->hlit = zi_bits(z, 5) + 257;
+                z->hdist = zi_bits(z, 5) + 1;
+                z->hclen = zi_bits(z, 4) + 4;
+                if (z->hlit > 286 || z->hdist > 30)
+                    return ZI_BAD;
+                memset(z->lens, 0, 19);
+                z->ncodes = 0;
+                z->mode = ZI_M_CLENS;
+                break;
+            case ZI_M_CLENS:
+                while (z->ncodes < z->hclen) {
+                    if (!zi_need(z, in, 3))
+                        return ZI_MORE;
+                    z->lens[zi_clorder[z->ncodes++]] = zi_bits(z, 3);
+                }
+                //the code length code is kept in dtree until the lengths are read
+                if (!zi_build(&z->dtree, z->lens, 19))
+                    return ZI_BAD;
+                z->ncodes = 0;
+                z->mode = ZI_M_LENS;
+                break;
+            case ZI_M_LENS:
+                while (z->ncodes < z->hlit + z->hdist) {
+                    sym = zi_peek(z, in, &z->dtree, &nbits);
+                    if (sym == -1)
+                        return ZI_MORE;
+                    if (sym < 0)
+                        return ZI_BAD;
+                    if (sym < 16) {
+                        zi_bits(z, nbits);
+                        z->lens[z->ncodes++] = sym;
+                        continue;
+                    }
+                    //repeats: code and extra bits are consumed together
+                    i = (sym == 16) ? 2 : ((sym == 17) ? 3 : 7);
+                    if (!zi_need(z, in, nbits + i))
+                        return ZI_MORE;
+                    zi_bits(z, nbits);
+                    if (sym == 16) {
+                        if (!z->ncodes)
+                            return ZI_BAD;
+                        c = z->lens[z->ncodes - 1];
+                        i = 3 + zi_bits(z, 2);
+                    } else {
+                        c = 0;
+                        i = (sym == 17) ? 3 + zi_bits(z, 3) : 11 + zi_bits(z, 7);
+                    }
+                    if (z->ncodes + i > z->hlit + z->hdist)
+                        return ZI_BAD;
+                    while (i--)
+                        z->lens[z->ncodes++] = c;
+                }
+                if (!z->lens[256] || !zi_build(&z->ltree, z->lens, z->hlit) || !zi_build(&z->dtree, z->lens + z->hlit, z->hdist))
+                    return ZI_BAD;
+                z->mode = ZI_M_LEN;
+                break;
+            case ZI_M_LEN:
+                if (out->pos >= out->len)
+                    return ZI_MORE;
+                sym = zi_peek(z, in, &z->ltree, &nbits);
+                if (sym == -1)
+                    return ZI_MORE;
+                if (sym < 0 || sym > 285)
+                    return ZI_BAD;
+                if (sym < 256) {
+                    zi_bits(z, nbits);
+                    zi_put(z, out, sym);
+                    break;
+                }
+                if (sym == 256) {
+                    zi_bits(z, nbits);
+                    if (z->final) {
+                        zi_trailer_start(z);
+                        return ZI_SYNC;
+                    }
+                    z->mode = ZI_M_BLOCK;
+                    break;
+                }
+                sym -= 257;
+                if (!zi_need(z, in, nbits + zi_lext[sym]))
+                    return ZI_MORE;
+                zi_bits(z, nbits);
+                z->len = zi_lbase[sym] + zi_bits(z, zi_lext[sym]);
+                z->mode = ZI_M_DIST;
+                break;
+            case ZI_M_DIST:
+                sym = zi_peek(z, in, &z->dtree, &nbits);
+                if (sym == -1)
+                    return ZI_MORE;
+                if (sym < 0 || sym > 29)
+                    return ZI_BAD;
+                zi_bits(z, nbits);
+                z->dist = sym;
+                z->mode = ZI_M_DISTEXT;
+                break;
+            case ZI_M_DISTEXT:
+                sym = z->dist;
+                if (!zi_need(z, in, zi_dext[sym]))
+                    return ZI_MORE;
+                z->dist = zi_dbase[sym] + zi_bits(z, zi_dext[sym]);
+                //before the start of the output or out of the window
+                if ((uint32_t)z->dist > z->total || (uint32_t)z->dist > z->wmask + 1)
+                    return ZI_BAD;
+                z->mode = ZI_M_COPY;
+                break;
+            case ZI_M_COPY:
+                while (z->len) {
+                    if (out->pos >= out->len)
+                        return ZI_MORE;
+                    zi_put(z, out, z->window[(z->total - z->dist) & z->wmask]);
+                    z->len--;
+                }
+                z->mode = ZI_M_LEN;
+                break;
+            case ZI_M_TRAILER:
+                //zlib: adler32 big endian. gzip: crc32 and size little endian
+                while (z->len < ((z->format == ZI_ZLIB) ? 4 : 8)) {
+                    c = zi_byte(z, in);
+                    if (c < 0)
+                        return ZI_MORE;
+                    if (z->format == ZI_ZLIB)
+                        z->acc = (z->acc << 8) | c;
+                    else
+                        z->acc |= (uint32_t)c << (8 * (z->len & 3));
+                    z->len++;
+                    if (z->len == 4 && z->acc != z->check)
+                        return ZI_BAD;
+                    if (z->len == 4)
+                        z->acc = 0;
+                }
+                if (z->format == ZI_GZIP && z->acc != z->total)
+                    return ZI_BAD;
+                z->mode = ZI_M_DONE;
+                break;
+            case ZI_M_DONE:
+                //whole bytes read ahead belong to what follows the stream
+                c = z->bitcnt >> 3;
+                if (c > in->pos - in->start)
+                    c = in->pos - in->start;
+                in->pos -= c;
+                z->bitbuf = 0;
+                z->bitcnt = 0;
+                return ZI_END;
+        }
+    }
+}
+
+/*
+ * args: wbits
+ * returns the state of a new decoder. wbits follows CPython zlib: 8..15 for zlib streams,
+ * -8..-15 for raw deflate, 24..31 for gzip, 40..47 to detect zlib or gzip from the header.
+ * The window is 2**(wbits&15) bytes
+ */
+C_NATIVE(zinflate_new)
+{
+    C_NATIVE_UNWARN();
+    int32_t wbits, format;
+    PObject *state;
+    ZiState *z;
+
+    if (parse_py_args("i", nargs, args, &wbits) != 1)
+        return ERR_TYPE_EXC;
+    if (wbits < 0) {
+        format = ZI_RAW;
+        wbits = -wbits;
+    } else if (wbits >= 40) {
+        format = ZI_AUTO;
+        wbits -= 32;
+    } else if (wbits >= 24) {
+        format = ZI_GZIP;
+        wbits -= 16;
+    } else
+        format = ZI_ZLIB;
+    if (wbits < 8 || wbits > 15)
+        return ERR_VALUE_EXC;
+
+    state = (PObject*)psequence_new(PBYTEARRAY, sizeof(ZiState) + (1 << wbits));
+    PSEQUENCE_ELEMENTS_SET(state, sizeof(ZiState) + (1 << wbits));
+    z = ZI_STATE(state);
+    memset(z, 0, sizeof(ZiState));
+    z->format = format;
+    z->wbits = wbits;
+    z->wmask = (1 << wbits) - 1;
+    switch (format) {
+        case ZI_RAW: z->mode = ZI_M_BLOCK; break;
+        case ZI_ZLIB: z->mode = ZI_M_ZHEAD; z->check = 1; break;
+        case ZI_GZIP: z->mode = ZI_M_GHEAD; break;
+        default: z->mode = ZI_M_AUTO;
+    }
+    *res = state;
+    return ERR_OK;
+}
+
+/*
+ * args: state, data, ofs, out, outofs
+ * decompresses data from ofs into out from outofs, until data is consumed, out is full or the stream ends.
+ * Returns a tuple (position in data, position in out, ended)
+ */
+C_NATIVE(zinflate_run)
+{
+    C_NATIVE_UNWARN();
+    ZiState *z;
+    ZiIn in;
+    ZiOut out;
+    int32_t ofs, outofs, end, start, r;
+    PObject *tpl;
+
+    if (nargs != 5 || !IS_ZI_STATE(args[0]) || !IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[1])) || !IS_PSMALLINT(args[2]) || PTYPE(args[3]) != PBYTEARRAY || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    z = ZI_STATE(args[0]);
+    in.buf = PSEQUENCE_BYTES(args[1]);
+    in.len = PSEQUENCE_ELEMENTS(args[1]);
+    ofs = PSMALLINT_VALUE(args[2]);
+    out.buf = PSEQUENCE_BYTES(args[3]);
+    end = PSEQUENCE_ELEMENTS(args[3]);
+    outofs = PSMALLINT_VALUE(args[4]);
+    if (ofs < 0 || ofs > in.len || outofs < 0 || outofs > end)
+        return ERR_INDEX_EXC;
+    in.start = ofs;
+    in.pos = ofs;
+    out.pos = outofs;
+
+    //output is produced in slices of ZI_SLICE bytes, with a GIL checkpoint between them
+    for (;;) {
+        start = out.pos;
+        out.len = (end - out.pos > ZI_SLICE) ? out.pos + ZI_SLICE : end;
+        r = zi_run(z, &in, &out);
+        if (out.pos > start) {
+            if (z->format == ZI_GZIP)
+                z->check = crc32_update(z->check, out.buf + start, out.pos - start);
+            else if (z->format == ZI_ZLIB)
+                z->check = zi_adler32(z->check, out.buf + start, out.pos - start);
+        }
+        //stop at the end, on errors, and when more input is needed or out is full
+        if (r != ZI_SYNC && (r != ZI_MORE || out.pos < out.len || out.pos == end))
+            break;
+        GIL_CHECKPOINT();
+        //without the GIL the objects may have been changed by other threads: take their buffers again
+        if (!IS_ZI_STATE(args[0]) || PSEQUENCE_ELEMENTS(args[1]) != in.len || PSEQUENCE_ELEMENTS(args[3]) != end)
+            return ERR_VALUE_EXC;
+        z = ZI_STATE(args[0]);
+        in.buf = PSEQUENCE_BYTES(args[1]);
+        out.buf = PSEQUENCE_BYTES(args[3]);
+    }
+    if (r == ZI_BAD)
+        return ERR_VALUE_EXC;
+
+    tpl = (PObject*)ptuple_new(3, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(in.pos));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(out.pos));
+    PTUPLE_SET_ITEM(tpl, 2, (r == ZI_END) ? PBOOL_TRUE() : PBOOL_FALSE());
+    *res = tpl;
+    return ERR_OK;
+}
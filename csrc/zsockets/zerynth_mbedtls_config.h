@@ -32,6 +32,18 @@
 #endif
 
 
+//Session tickets for resumption of client sessions (see ssl.SESSION_RESUME)
+#if !defined(ZERYNTH_SSL_NO_SESSION_TICKETS)
+#define MBEDTLS_SSL_SESSION_TICKETS
+#endif
+
+//DTLS 1.2 for secure sockets of type SOCK_DGRAM (client side only)
+#if defined(ZERYNTH_SSL_DTLS)
+#define MBEDTLS_SSL_PROTO_DTLS
+#define MBEDTLS_SSL_DTLS_ANTI_REPLAY
+#define MBEDTLS_SSL_DTLS_BADMAC_LIMIT
+#endif
+
 #if defined(ZERYNTH_SSL_MAX_CONTENT_LEN)
 #define MBEDTLS_SSL_MAX_CONTENT_LEN ZERYNTH_SSL_MAX_CONTENT_LEN
 #else
@@ -0,0 +1,34 @@
+#ifndef ZERYNTH_SENDFILE_H_
+#define ZERYNTH_SENDFILE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Byte sink, passed between modules as bytes so that they don't link against each other: the natives of the modules
+ * owning the data (__f_sendfile of fatfs, the adc pipeline) write through it with the GIL released.
+ * py_net_sink of the sockets gives gzsock_write, so that secure sockets are encrypted as with sendall; __f_sink of fatfs
+ * and flashlog_sink give writers of files and flash logs, with the file or log as sock. write returns the bytes written
+ * (possibly less than size) or a negative error.
+ */
+
+typedef struct _zsock_sink {
+    int (*write)(int s, const void *dataptr, size_t size);
+    int32_t sock;
+} ZSockSink;
+
+// writes len bytes to the sink, returns len or the negative error of the socket
+static inline int32_t zsock_sink_write_all(ZSockSink *sink, const uint8_t *buf, int32_t len)
+{
+    int32_t wrt = 0;
+    int32_t w;
+    while (wrt < len) {
+        w = sink->write(sink->sock, buf + wrt, len - wrt);
+        if (w < 0)
+            return w;
+        wrt += w;
+    }
+    return wrt;
+}
+
+#endif
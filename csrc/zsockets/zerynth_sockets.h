@@ -25,6 +25,8 @@
 
 typedef struct _zsocket_info {
     int8_t idx;        //index of the socket in the list of ssl sockets. negative if not assigned
+    uint32_t last_rx;  //vosMillis of the last data received, or of the creation of the socket
+    uint32_t last_tx;  //vosMillis of the last data sent, or of the creation of the socket
 } ZSocketInfo;
 
 extern ZSocketInfo _zsocket_info[MAX_SOCKETS];
@@ -19,6 +19,12 @@
 #define _CERT_REQUIRED 4
 #define _CLIENT_AUTH 8
 #define _SERVER_AUTH 16
+#define _SESSION_RESUME 32
+//bits 8-10 of the options: max fragment length code of RFC 6066 (1:512, 2:1024, 3:2048, 4:4096 bytes)
+#define _MFL_SHIFT 8
+#define _MFL_MASK 0x7
+//order the cipher suites by the crypto engines available
+#define _CIPHERS_AUTO 2048
 
 
 typedef struct _sslinfo {
@@ -26,11 +32,14 @@ typedef struct _sslinfo {
     uint8_t* clicert;
     uint8_t* pvkey;
     uint8_t* hostname;
-    uint16_t cacert_len;
-    uint16_t clicert_len;
-    uint16_t pvkey_len;
+    uint32_t cacert_len;        //certificates and key can be resources in flash, larger than 64KB
+    uint32_t clicert_len;
+    uint32_t pvkey_len;
     uint16_t hostname_len;
     uint32_t options;
+    uint8_t* ciphersuites;      //cipher suite ids in order of preference, 2 bytes each big endian
+    uint16_t ciphersuites_len;
+    uint16_t castore;           //id+1 of the x509.CertStore to use instead of cacert, 0 if none
 } SSLInfo;
 
 
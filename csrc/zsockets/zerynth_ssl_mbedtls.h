@@ -9,6 +9,98 @@
 #include "mbedtls/certs.h"
 #include "mbedtls/threading.h"
 
+//TLS sessions kept for resumption (ssl.SESSION_RESUME), least recently used evicted first
+#if !defined(ZERYNTH_SSL_SESSION_CACHE_SIZE)
+#define ZERYNTH_SSL_SESSION_CACHE_SIZE MAX_SSLSOCKS
+#endif
+//sessions are looked up by hostname (or ip), port, verify mode and a hash of the CA chain:
+//a session is only resumed by sockets checking the server as strictly as the one that made it
+#define SSL_SESSION_HOST_LEN 64
+#define SSL_SESSION_KEY_LEN (SSL_SESSION_HOST_LEN+2+1+4)
+
+//retransmission timeouts of DTLS handshakes in ms, doubled at each retransmission from MIN up to MAX
+#if !defined(ZERYNTH_SSL_DTLS_TIMEOUT_MIN)
+#define ZERYNTH_SSL_DTLS_TIMEOUT_MIN 1000
+#endif
+#if !defined(ZERYNTH_SSL_DTLS_TIMEOUT_MAX)
+#define ZERYNTH_SSL_DTLS_TIMEOUT_MAX 60000
+#endif
+
+//cipher suites kept for a socket with ssl.create_ssl_context(ciphersuites=...) or ssl.CIPHERS_AUTO
+#if !defined(ZERYNTH_SSL_MAX_CIPHERSUITES)
+#define ZERYNTH_SSL_MAX_CIPHERSUITES 16
+#endif
+
+typedef struct _sslsession {
+    uint8_t key[SSL_SESSION_KEY_LEN];
+    uint8_t keylen;     //0 for free entries
+    uint32_t used;
+    mbedtls_ssl_session session;
+} SSLSession;
+
+//CA chains parsed once by x509.CertStore and referenced by the sockets created with them
+#if !defined(ZERYNTH_SSL_CERTSTORES)
+#define ZERYNTH_SSL_CERTSTORES 2
+#endif
+#define SSL_CERTSTORE_BUSY (-1)
+
+//P-256 ECDHE key pairs generated ahead of the handshakes by a lowest priority thread
+#if defined(ZERYNTH_SSL_ECDHE_POOL) && defined(ZERYNTH_SSL_EXTERNAL_STACK)
+//taken by the ecdh.c of the bundled mbedtls only
+#undef ZERYNTH_SSL_ECDHE_POOL
+#endif
+#if defined(ZERYNTH_SSL_ECDHE_POOL)
+#if !defined(ZERYNTH_SSL_ECDHE_POOL_STACK)
+#define ZERYNTH_SSL_ECDHE_POOL_STACK 3072
+#endif
+typedef struct _sslecdhekey {
+    uint8_t d[32];
+    uint8_t q[64];      //X and Y
+} SSLEcdheKey;
+#endif
+
+typedef struct _sslcertstore {
+    mbedtls_x509_crt chain;
+    uint16_t refs;      //0 for free entries: one for the CertStore, one for each socket using it
+    uint16_t certs;
+} SSLCertStore;
+
+#if defined(ZERYNTH_SSL_STATIC_BUFFERS)
+//size classes of the mbedtls block pool, in increasing size: a fourth class holds the record buffers
+#if !defined(ZERYNTH_SSL_POOL_CLASS0_SIZE)
+#define ZERYNTH_SSL_POOL_CLASS0_SIZE 64
+#endif
+#if !defined(ZERYNTH_SSL_POOL_CLASS0_NUM)
+#define ZERYNTH_SSL_POOL_CLASS0_NUM 32
+#endif
+#if !defined(ZERYNTH_SSL_POOL_CLASS1_SIZE)
+#define ZERYNTH_SSL_POOL_CLASS1_SIZE 256
+#endif
+#if !defined(ZERYNTH_SSL_POOL_CLASS1_NUM)
+#define ZERYNTH_SSL_POOL_CLASS1_NUM 16
+#endif
+#if !defined(ZERYNTH_SSL_POOL_CLASS2_SIZE)
+#define ZERYNTH_SSL_POOL_CLASS2_SIZE 1024
+#endif
+#if !defined(ZERYNTH_SSL_POOL_CLASS2_NUM)
+#define ZERYNTH_SSL_POOL_CLASS2_NUM 4
+#endif
+#define SSL_POOL_CLASSES 4
+
+typedef struct _sslpool {
+    uint8_t* start;
+    uint8_t* end;
+    void* free;             //list of free blocks, linked through their first word
+    uint32_t size;
+    uint16_t num;
+    uint16_t used;
+    uint16_t high;          //highest number of blocks used at once
+    uint32_t fallbacks;     //requests served by gc_malloc because the class was exhausted
+} SSLPool;
+
+extern SSLPool _sslpools[SSL_POOL_CLASSES];
+void mbedtls_pool_init(void);
+#endif
 
 typedef struct _sslsock {
     int32_t family;
@@ -16,21 +108,48 @@ typedef struct _sslsock {
     int32_t proto;
     uint8_t assigned;
     uint8_t initialized;
+    uint8_t resume;
+    uint8_t hostname_len;
+    uint8_t hostname[SSL_SESSION_HOST_LEN];
+    int ciphersuites[ZERYNTH_SSL_MAX_CIPHERSUITES+1];  //zero terminated
     mbedtls_entropy_context entropy;
     mbedtls_ctr_drbg_context ctr_drbg;
     mbedtls_ssl_context ssl;
     mbedtls_x509_crt cacert;
+    uint8_t castore;    //id+1 of the x509.CertStore referenced instead of cacert, 0 if none
     mbedtls_x509_crt clicert;
     mbedtls_pk_context pkey;
     mbedtls_ssl_config conf;
     mbedtls_net_context ctx;
+#if defined(MBEDTLS_SSL_PROTO_DTLS)
+    uint32_t dtls_start;    //millis when the DTLS timer was set
+    uint32_t dtls_int;      //intermediate and final delays of the DTLS timer, final 0 if stopped
+    uint32_t dtls_fin;
+#endif
 } SSLSock;
 
 int mbedtls_hardware_poll( void *data, unsigned char *output, size_t len, size_t *olen );
 void mbedtls_gc_free( void *pnt);
 void * mbedtls_gc_calloc( size_t n, size_t m);
+void mbedtls_session_init(void);
+void mbedtls_certstore_init(void);
+int mbedtls_certstore_new(void);
+int mbedtls_certstore_add(int id, const uint8_t* buf, uint32_t len);
+mbedtls_x509_crt* mbedtls_certstore_acquire(int id);
+void mbedtls_certstore_release(int id);
+int mbedtls_certstore_info(int id, int* certs, int* refs);
+#if defined(ZERYNTH_SSL_ECDHE_POOL)
+void mbedtls_ecdhe_pool_init(void);
+int mbedtls_ecdhe_pool_take(mbedtls_ecp_group* grp, mbedtls_mpi* d, mbedtls_ecp_point* Q);
+void mbedtls_ecdhe_pool_stats(int* ready, uint32_t* taken, uint32_t* misses);
+#endif
+int mbedtls_ciphersuites_setup(SSLSock* ssock, SSLInfo* sinfo);
 int mbedtls_full_connect(SSLSock* ssock, const struct sockaddr* name, socklen_t namelen);
 int mbedtls_full_close(SSLSock* ssock);
+#if defined(MBEDTLS_SSL_PROTO_DTLS)
+void mbedtls_dtls_timer_set(void* data, uint32_t int_ms, uint32_t fin_ms);
+int mbedtls_dtls_timer_get(void* data);
+#endif
 void mbedtls_uninit(SSLSock* ssock);
 void mbedtls_f_dbg(void *ctx, int lvl, const char *file, int line, const char* message);
 #if !defined(ZERYNTH_SSL_EXTERNAL_STACK)
@@ -41,5 +160,6 @@ int mbedtls_mutex_unlock_alt( mbedtls_threading_mutex_t *mutex );
 #endif
 
 extern SSLSock sslsocks[MAX_SSLSOCKS];
+extern SSLCertStore _sslstores[ZERYNTH_SSL_CERTSTORES];
 
 #include "zerynth_mbedtls_config.h"
@@ -14,8 +14,104 @@
 #include "zerynth.h"
 #include "zerynth_sockets.h"
 #include "zerynth_sockets_debug.h"
+#include "zerynth_sendfile.h"
 
 
+/*
+ * Resolver cache: the last ZERYNTH_SOCKETS_DNS_CACHE_SIZE names resolved by py_net_resolve, evicted least recently used first.
+ * lwip does not give back the TTL of the records, so positive and negative (failed) entries expire after configurable times.
+ * The cache is only accessed with the GIL held.
+ */
+#if !defined(ZERYNTH_SOCKETS_DNS_CACHE_SIZE)
+#define ZERYNTH_SOCKETS_DNS_CACHE_SIZE 4
+#endif
+#if !defined(ZERYNTH_SOCKETS_DNS_CACHE_NAME)
+#define ZERYNTH_SOCKETS_DNS_CACHE_NAME 48
+#endif
+
+typedef struct _dns_entry {
+    uint32_t ip;        //0 for negative entries
+    uint32_t expires;
+    uint32_t used;
+    uint8_t len;        //0 for free entries
+    uint8_t name[ZERYNTH_SOCKETS_DNS_CACHE_NAME];
+} DnsEntry;
+
+static DnsEntry dns_cache[ZERYNTH_SOCKETS_DNS_CACHE_SIZE];
+static uint32_t dns_clock;
+static uint32_t dns_ttl = 300000;
+static uint32_t dns_negative_ttl = 10000;
+
+static DnsEntry* dns_cache_find(uint8_t* name, int32_t len)
+{
+    int32_t i;
+    uint32_t now = vosMillis();
+    for (i = 0; i < ZERYNTH_SOCKETS_DNS_CACHE_SIZE; i++) {
+        DnsEntry* e = &dns_cache[i];
+        if (e->len != len || memcmp(e->name, name, len))
+            continue;
+        if ((int32_t)(e->expires - now) <= 0) {
+            e->len = 0;
+            return NULL;
+        }
+        e->used = ++dns_clock;
+        return e;
+    }
+    return NULL;
+}
+
+static void dns_cache_store(uint8_t* name, int32_t len, uint32_t ip)
+{
+    int32_t i;
+    DnsEntry* e = &dns_cache[0];
+    if (len > ZERYNTH_SOCKETS_DNS_CACHE_NAME)
+        return;
+    //a free entry or the least recently used one
+    for (i = 0; i < ZERYNTH_SOCKETS_DNS_CACHE_SIZE; i++) {
+        if (!dns_cache[i].len) {
+            e = &dns_cache[i];
+            break;
+        }
+        if (dns_cache[i].used < e->used)
+            e = &dns_cache[i];
+    }
+    e->ip = ip;
+    e->expires = vosMillis() + (ip ? dns_ttl : dns_negative_ttl);
+    e->used = ++dns_clock;
+    e->len = len;
+    memcpy(e->name, name, len);
+}
+
+/*
+ * no args: forgets every cached name, e.g. after a change of network
+ */
+C_NATIVE(py_net_dns_flush)
+{
+    C_NATIVE_UNWARN();
+    memset(dns_cache, 0, sizeof(dns_cache));
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: ttl, negative_ttl
+ * sets the lifetime in milliseconds of resolved and failed names; 0 disables caching them
+ */
+C_NATIVE(py_net_dns_config)
+{
+    C_NATIVE_UNWARN();
+    int32_t ttl, negative_ttl;
+    if (nargs < 2 || !PYARG_INT(0, ttl) || !PYARG_INT(1, negative_ttl))
+        return ERR_TYPE_EXC;
+    if (ttl < 0 || negative_ttl < 0)
+        return ERR_VALUE_EXC;
+    dns_ttl = ttl;
+    dns_negative_ttl = negative_ttl;
+    memset(dns_cache, 0, sizeof(dns_cache));
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
 #if !defined(ZERYNTH_SOCKETS_PYNATIVE_CUSTOM_RESOLVE)
 C_NATIVE(py_net_resolve)
 {
@@ -24,10 +120,24 @@ C_NATIVE(py_net_resolve)
     uint32_t len;
     int32_t code;
     NetAddress addr;
-    if (parse_py_args("s", nargs, args, &url, &len) != 1)
+    DnsEntry* e;
+    uint8_t sname[ZERYNTH_SOCKETS_DNS_CACHE_NAME + 1];
+    uint8_t* name;
+    if (nargs < 1 || !PYARG_BYTES(0, url, len))
         return ERR_TYPE_EXC;
     addr.ip = 0;
-    uint8_t* name = (uint8_t*)gc_malloc(len + 1);
+    addr.port = 0;
+    e = dns_cache_find(url, len);
+    if (e) {
+        DEBUG(LVL0,"Resolved from cache");
+        if (!e->ip)
+            return ERR_IOERROR_EXC;
+        addr.ip = e->ip;
+        *res = netaddress_to_object(&addr);
+        return ERR_OK;
+    }
+    //names that fit the cache need no allocation
+    name = (len <= ZERYNTH_SOCKETS_DNS_CACHE_NAME) ? sname : (uint8_t*)gc_malloc(len + 1);
     __memcpy(name, url, len);
     name[len] = 0;
     DEBUG(LVL0,"Resolving %s",name);
@@ -35,12 +145,17 @@ C_NATIVE(py_net_resolve)
     struct ip4_addr ares;
     code = netconn_gethostbyname(name, &ares);
     ACQUIRE_GIL();
-    gc_free(name);
+    if (name != sname)
+        gc_free(name);
     DEBUG(LVL0,"Resolved return code %i",code);
-    if (code != ERR_OK)
+    if (code != ERR_OK) {
+        if (dns_negative_ttl)
+            dns_cache_store(url, len, 0);
         return ERR_IOERROR_EXC;
-    addr.port = 0;
+    }
     addr.ip = ares.addr;
+    if (dns_ttl && addr.ip)
+        dns_cache_store(url, len, addr.ip);
     *res = netaddress_to_object(&addr);
     return ERR_OK;
 }
@@ -66,7 +181,7 @@ C_NATIVE(py_net_socket)
     int32_t type = DRV_SOCK_STREAM;
     int32_t proto = IPPROTO_TCP;
     int32_t sock;
-    if (parse_py_args("III", nargs, args, DRV_AF_INET, &family, DRV_SOCK_STREAM, &type, IPPROTO_TCP, &proto) != 3)
+    if (!PYARG_INT_OPT(0, DRV_AF_INET, family) || !PYARG_INT_OPT(1, DRV_SOCK_STREAM, type) || !PYARG_INT_OPT(2, IPPROTO_TCP, proto))
         return ERR_TYPE_EXC;
     if (type != DRV_SOCK_DGRAM && type != DRV_SOCK_STREAM)
         return ERR_TYPE_EXC;
@@ -87,6 +202,13 @@ C_NATIVE(py_net_socket)
     return ERR_OK;
 }
 
+/*
+ * Non-blocking sockets: operations that would block return -1 to Python instead of raising,
+ * and connect returns -1 while in progress (completion is reported as POLLOUT by the poller).
+ * MSG_PEEK and MSG_DONTWAIT have the same values in Zerynth and lwip and are passed through.
+ */
+#define PY_NET_WOULDBLOCK(r) ((r) == -EAGAIN || (r) == -EWOULDBLOCK)
+
 C_NATIVE(py_net_connect)
 {
     C_NATIVE_UNWARN();
@@ -102,6 +224,10 @@ C_NATIVE(py_net_connect)
     err = gzsock_connect(sock, &vmSocketAddr, sizeof(vmSocketAddr));
     ACQUIRE_GIL();
     DEBUG(LVL0,"Connected with socket %i return code %i",sock,err);
+    if (err == -EINPROGRESS || PY_NET_WOULDBLOCK(err)) {
+        *res = PSMALLINT_NEW(-1);
+        return ERR_OK;
+    }
     if (err < 0) {
         return ERR_IOERROR_EXC;
     }
@@ -114,7 +240,7 @@ C_NATIVE(py_net_close)
     C_NATIVE_UNWARN();
     int32_t sock;
     int rr;
-    if (parse_py_args("i", nargs, args, &sock) != 1)
+    if (nargs < 1 || !PYARG_INT(0, sock))
         return ERR_TYPE_EXC;
     RELEASE_GIL();
     rr = gzsock_close(sock);
@@ -132,16 +258,16 @@ C_NATIVE(py_net_send)
     int32_t flags;
     int32_t sock;
     int32_t snt;
-    if (parse_py_args("isi", nargs, args,
-            &sock,
-            &buf, &len,
-            &flags)
-        != 3)
+    if (nargs < 3 || !PYARG_INT(0, sock) || !PYARG_BYTES(1, buf, len) || !PYARG_INT(2, flags))
         return ERR_TYPE_EXC;
     RELEASE_GIL();
     DEBUG(LVL0,"Sending with socket %i %i bytes",sock,len);
     snt = gzsock_send(sock, buf, len, flags);
     ACQUIRE_GIL();
+    if (PY_NET_WOULDBLOCK(snt)) {
+        *res = PSMALLINT_NEW(-1);
+        return ERR_OK;
+    }
     if (snt < 0) {
         return ERR_IOERROR_EXC;
     }
@@ -159,11 +285,7 @@ C_NATIVE(py_net_send_all)
     int32_t sock;
     int32_t wrt;
     int32_t w;
-    if (parse_py_args("isi", nargs, args,
-            &sock,
-            &buf, &len,
-            &flags)
-        != 3)
+    if (nargs < 3 || !PYARG_INT(0, sock) || !PYARG_BYTES(1, buf, len) || !PYARG_INT(2, flags))
         return ERR_TYPE_EXC;
     RELEASE_GIL();
     DEBUG(LVL0,"Sending with socket %i %i bytes",sock,len);
@@ -183,6 +305,127 @@ C_NATIVE(py_net_send_all)
     return ERR_OK;
 }
 
+//small buffers given to sendmsg are gathered here and written together
+#define _SENDMSG_STAGE 256
+
+static int32_t py_net_write_all(int32_t sock, uint8_t *buf, int32_t len)
+{
+    int32_t wrt = 0;
+    int32_t w;
+    while (wrt < len) {
+        w = gzsock_write(sock, buf + wrt, len - wrt);
+        if (w < 0)
+            return w;
+        wrt += w;
+    }
+    return wrt;
+}
+
+/*
+ * args: sock, buffers
+ * writes every str, bytes or bytearray in the list or tuple buffers, in order, with a single GIL release.
+ * Consecutive small buffers are coalesced so that they reach the network (or the TLS layer) as one write.
+ * Returns the total number of bytes sent
+ */
+C_NATIVE(py_net_sendmsg)
+{
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    int32_t n, i, len, staged, total;
+    int32_t w = 0;
+    PObject *bufs;
+    PObject *item;
+    uint8_t stage[_SENDMSG_STAGE];
+
+    if (nargs != 2 || !IS_PSMALLINT(args[0]))
+        return ERR_TYPE_EXC;
+    sock = PSMALLINT_VALUE(args[0]);
+    bufs = args[1];
+    if (PTYPE(bufs) != PLIST && PTYPE(bufs) != PTUPLE)
+        return ERR_TYPE_EXC;
+    n = PSEQUENCE_ELEMENTS(bufs);
+    total = 0;
+    for (i = 0; i < n; i++) {
+        item = PSEQUENCE_OBJECTS(bufs)[i];
+        if (PTYPE(item) != PSTRING && PTYPE(item) != PBYTES && PTYPE(item) != PBYTEARRAY)
+            return ERR_TYPE_EXC;
+        total += PSEQUENCE_ELEMENTS(item);
+    }
+
+    RELEASE_GIL();
+    DEBUG(LVL0,"Sending with socket %i %i bytes in %i buffers",sock,total,n);
+    staged = 0;
+    for (i = 0; i < n && w >= 0; i++) {
+        item = PSEQUENCE_OBJECTS(bufs)[i];
+        len = PSEQUENCE_ELEMENTS(item);
+        if (staged + len > _SENDMSG_STAGE && staged) {
+            w = py_net_write_all(sock, stage, staged);
+            staged = 0;
+            if (w < 0)
+                break;
+        }
+        if (len < _SENDMSG_STAGE) {
+            memcpy(stage + staged, PSEQUENCE_BYTES(item), len);
+            staged += len;
+        } else {
+            w = py_net_write_all(sock, PSEQUENCE_BYTES(item), len);
+        }
+    }
+    if (staged && w >= 0)
+        w = py_net_write_all(sock, stage, staged);
+    ACQUIRE_GIL();
+    if (w < 0) {
+        return ERR_IOERROR_EXC;
+    }
+    DEBUG(LVL0,"Sent with socket %i %i bytes",sock,total);
+    *res = PSMALLINT_NEW(total);
+    return ERR_OK;
+}
+
+/*
+ * args: sock
+ * returns the sink of sock for socket.sendfile, as bytes (see zerynth_sendfile.h)
+ */
+C_NATIVE(py_net_sink)
+{
+    C_NATIVE_UNWARN();
+    ZSockSink sink;
+    if (nargs != 1 || !IS_PSMALLINT(args[0]))
+        return ERR_TYPE_EXC;
+    sink.write = gzsock_write;
+    sink.sock = PSMALLINT_VALUE(args[0]);
+    *res = (PObject*)pbytes_new(sizeof(ZSockSink), (uint8_t*)&sink);
+    return ERR_OK;
+}
+
+/*
+ * args: sock, addr, size
+ * sends the size bytes of memory mapped flash at addr with a single GIL release, straight from flash.
+ * Returns the number of bytes sent
+ */
+C_NATIVE(py_net_sendmem)
+{
+    C_NATIVE_UNWARN();
+    int32_t sock, size, w;
+    uint8_t *addr;
+    if (nargs != 3 || !IS_PSMALLINT(args[0]) || !IS_INTEGER(args[1]) || !IS_PSMALLINT(args[2]))
+        return ERR_TYPE_EXC;
+    sock = PSMALLINT_VALUE(args[0]);
+    addr = (uint8_t*)INTEGER_VALUE(args[1]);
+    size = PSMALLINT_VALUE(args[2]);
+    if (size < 0)
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    DEBUG(LVL0,"Sending with socket %i %i bytes from %x",sock,size,addr);
+    w = py_net_write_all(sock, addr, size);
+    ACQUIRE_GIL();
+    if (w < 0) {
+        return ERR_IOERROR_EXC;
+    }
+    *res = PSMALLINT_NEW(size);
+    return ERR_OK;
+}
+
 C_NATIVE(py_net_sendto)
 {
     C_NATIVE_UNWARN();
@@ -221,28 +464,28 @@ C_NATIVE(py_net_recv_into)
     int32_t flags;
     int32_t ofs;
     int32_t sock;
-    if (parse_py_args("isiiI", nargs, args,
-            &sock,
-            &buf, &len,
-            &sz,
-            &flags,
-            0,
-            &ofs)
-        != 5)
+    if (nargs < 4 || !PYARG_INT(0, sock) || !PYARG_BYTES(1, buf, len) || !PYARG_INT(2, sz) || !PYARG_INT(3, flags) || !PYARG_INT_OPT(4, 0, ofs))
         return ERR_TYPE_EXC;
     buf += ofs;
     len -= ofs;
     len = (sz < len) ? sz : len;
     RELEASE_GIL();
     int rb = 0;
-    int r;
+    int r = 0;
     while (rb < len) {
         r = gzsock_recv(sock, buf + rb, len - rb, flags);
         if (r <= 0)
             break;
         rb += r;
+        //peeking or not waiting: a single recv
+        if (flags & (MSG_PEEK | MSG_DONTWAIT))
+            break;
     }
     ACQUIRE_GIL();
+    if (PY_NET_WOULDBLOCK(r)) {
+        *res = PSMALLINT_NEW((rb) ? rb : -1);
+        return ERR_OK;
+    }
     if (r <= 0) {
        if (r != 0){
             if (r==-ETIMEDOUT)
@@ -266,14 +509,7 @@ C_NATIVE(py_net_recvfrom_into)
     int32_t ofs;
     int32_t sock;
     NetAddress addr;
-    if (parse_py_args("isiiI", nargs, args,
-            &sock,
-            &buf, &len,
-            &sz,
-            &flags,
-            0,
-            &ofs)
-        != 5)
+    if (nargs < 4 || !PYARG_INT(0, sock) || !PYARG_BYTES(1, buf, len) || !PYARG_INT(2, sz) || !PYARG_INT(3, flags) || !PYARG_INT_OPT(4, 0, ofs))
         return ERR_TYPE_EXC;
     buf += ofs;
     len -= ofs;
@@ -301,6 +537,95 @@ C_NATIVE(py_net_recvfrom_into)
     return ERR_OK;
 }
 
+//metadata of each datagram received by py_net_recvfrom_many: length and port (little endian), ip
+#define _DGRAM_META 8
+
+/*
+ * args: sock, buffer, slot_size, max_count, timeout, meta
+ * receives up to max_count datagrams with a single GIL release, the i-th one in buffer[i*slot_size:(i+1)*slot_size] (truncated to slot_size)
+ * and its metadata in meta[i*8:(i+1)*8]. Waits at most timeout ms (None: socket default) for the first datagram,
+ * then takes only the ones already queued. Returns the number of datagrams received
+ */
+C_NATIVE(py_net_recvfrom_many)
+{
+    C_NATIVE_UNWARN();
+    uint8_t* buf;
+    int32_t len;
+    uint8_t* meta;
+    int32_t metalen;
+    int32_t slot, count, sock, timeout;
+    int32_t n = 0;
+    int32_t r, flags;
+    sockaddr_t vmSocketAddr;
+    socklen_t tlen;
+    fd_set rfd;
+    struct timeval tms;
+
+    if (nargs != 6 || !IS_PSMALLINT(args[0]) || PTYPE(args[1]) != PBYTEARRAY || !IS_PSMALLINT(args[2]) || !IS_PSMALLINT(args[3]) || PTYPE(args[5]) != PBYTEARRAY)
+        return ERR_TYPE_EXC;
+    if (args[4] == MAKE_NONE())
+        timeout = -1;
+    else if (IS_PSMALLINT(args[4]))
+        timeout = PSMALLINT_VALUE(args[4]);
+    else
+        return ERR_TYPE_EXC;
+    sock = PSMALLINT_VALUE(args[0]);
+    buf = PSEQUENCE_BYTES(args[1]);
+    len = PSEQUENCE_ELEMENTS(args[1]);
+    slot = PSMALLINT_VALUE(args[2]);
+    count = PSMALLINT_VALUE(args[3]);
+    meta = PSEQUENCE_BYTES(args[5]);
+    metalen = PSEQUENCE_ELEMENTS(args[5]);
+    if (slot <= 0 || count < 0)
+        return ERR_VALUE_EXC;
+    if (count > len / slot)
+        count = len / slot;
+    if (count > metalen / _DGRAM_META)
+        count = metalen / _DGRAM_META;
+
+    RELEASE_GIL();
+    if (timeout >= 0 && count) {
+        FD_ZERO(&rfd);
+        FD_SET(sock, &rfd);
+        tms.tv_sec = timeout / 1000;
+        tms.tv_usec = (timeout % 1000) * 1000;
+        if (gzsock_select(sock + 1, &rfd, NULL, NULL, &tms) <= 0)
+            count = 0;
+    }
+    flags = 0;
+    r = 0;
+    while (n < count) {
+        tlen = sizeof(vmSocketAddr);
+        r = gzsock_recvfrom(sock, buf + n * slot, slot, flags, &vmSocketAddr, &tlen);
+        if (r < 0)
+            break;
+        meta[n * _DGRAM_META] = r & 0xff;
+        meta[n * _DGRAM_META + 1] = (r >> 8) & 0xff;
+        meta[n * _DGRAM_META + 2] = OAL_GET_NETPORT(vmSocketAddr.sin_port) & 0xff;
+        meta[n * _DGRAM_META + 3] = (OAL_GET_NETPORT(vmSocketAddr.sin_port) >> 8) & 0xff;
+        meta[n * _DGRAM_META + 4] = OAL_IP_AT(vmSocketAddr.sin_addr.s_addr, 0);
+        meta[n * _DGRAM_META + 5] = OAL_IP_AT(vmSocketAddr.sin_addr.s_addr, 1);
+        meta[n * _DGRAM_META + 6] = OAL_IP_AT(vmSocketAddr.sin_addr.s_addr, 2);
+        meta[n * _DGRAM_META + 7] = OAL_IP_AT(vmSocketAddr.sin_addr.s_addr, 3);
+        n++;
+        //drain what is already queued
+        flags = MSG_DONTWAIT;
+    }
+    ACQUIRE_GIL();
+    if (r < 0 && !n && !PY_NET_WOULDBLOCK(r)) {
+        if (r == -ETIMEDOUT)
+            return ERR_TIMEOUT_EXC;
+        return ERR_IOERROR_EXC;
+    }
+    *res = PSMALLINT_NEW(n);
+    return ERR_OK;
+}
+
+/*
+ * args: sock, level, optname, value
+ * sets an integer option, or SO_RCVTIMEO in milliseconds. Option numbers are the socket.py constants:
+ * socket level and TCP level ones are mapped to the values of the TCP stack
+ */
 C_NATIVE(py_net_setsockopt)
 {
     C_NATIVE_UNWARN();
@@ -309,17 +634,28 @@ C_NATIVE(py_net_setsockopt)
     int32_t optname;
     int32_t optvalue;
 
-    if (parse_py_args("iiii", nargs, args, &sock, &level, &optname, &optvalue) != 4)
+    if (nargs < 4 || !PYARG_INT(0, sock) || !PYARG_INT(1, level) || !PYARG_INT(2, optname) || !PYARG_INT(3, optvalue))
         return ERR_TYPE_EXC;
 
     if (level == 0xffff)
         level = SOL_SOCKET;
 
     // SO_RCVTIMEO zerynth value
-    if (optname == 1) {
+    if (level == SOL_SOCKET && optname == 1) {
         optname = SO_RCVTIMEO;
     }
 
+    // zerynth TCP options are numbered as in lwIP, stacks may differ
+    if (level == IPPROTO_TCP) {
+        switch (optname) {
+            case 0x01: optname = TCP_NODELAY; break;
+            case 0x03: optname = TCP_KEEPIDLE; break;
+            case 0x04: optname = TCP_KEEPINTVL; break;
+            case 0x05: optname = TCP_KEEPCNT; break;
+            default: break;
+        }
+    }
+
     RELEASE_GIL();
     if (optname == SO_RCVTIMEO) {
         struct timeval tms;
@@ -338,6 +674,81 @@ C_NATIVE(py_net_setsockopt)
     return ERR_OK;
 }
 
+/*
+ * args: sock, blocking
+ * clears or sets O_NONBLOCK on the socket
+ */
+C_NATIVE(py_net_setblocking)
+{
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    int32_t blocking;
+    int32_t fl;
+
+    if (nargs < 2 || !PYARG_INT(0, sock) || !PYARG_INT(1, blocking))
+        return ERR_TYPE_EXC;
+    RELEASE_GIL();
+    fl = gzsock_fcntl(sock, F_GETFL, 0);
+    if (fl >= 0)
+        fl = gzsock_fcntl(sock, F_SETFL, (blocking) ? (fl & ~O_NONBLOCK) : (fl | O_NONBLOCK));
+    ACQUIRE_GIL();
+    if (fl == -EOPNOTSUPP)
+        return ERR_UNSUPPORTED_EXC;
+    if (fl < 0)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: sock
+ * returns and clears the pending error of the socket (SO_ERROR), 0 if none: after a non-blocking connect it tells if the connection succeeded
+ */
+C_NATIVE(py_net_sockerror)
+{
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    int32_t err;
+    int32_t optval = 0;
+    socklen_t optlen = sizeof(optval);
+
+    if (nargs < 1 || !PYARG_INT(0, sock))
+        return ERR_TYPE_EXC;
+    RELEASE_GIL();
+    err = gzsock_getsockopt(sock, SOL_SOCKET, SO_ERROR, &optval, &optlen);
+    ACQUIRE_GIL();
+    if (err == -EOPNOTSUPP)
+        return ERR_UNSUPPORTED_EXC;
+    if (err < 0)
+        return ERR_IOERROR_EXC;
+    *res = PSMALLINT_NEW(optval);
+    return ERR_OK;
+}
+
+/*
+ * args: sock
+ * returns (milliseconds since data was last received, milliseconds since data was last sent) on the socket,
+ * counting from its creation until the first transfer
+ */
+C_NATIVE(py_net_idle)
+{
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    uint32_t now;
+    PTuple *tpl;
+
+    if (nargs < 1 || !PYARG_INT(0, sock))
+        return ERR_TYPE_EXC;
+    if (sock < 0 || sock >= MAX_SOCKETS)
+        return ERR_VALUE_EXC;
+    now = vosMillis();
+    tpl = ptuple_new(2, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, pinteger_new(now - _zsocket_info[sock].last_rx));
+    PTUPLE_SET_ITEM(tpl, 1, pinteger_new(now - _zsocket_info[sock].last_tx));
+    *res = (PObject*)tpl;
+    return ERR_OK;
+}
+
 C_NATIVE(py_net_bind)
 {
     C_NATIVE_UNWARN();
@@ -362,7 +773,7 @@ C_NATIVE(py_net_listen)
     C_NATIVE_UNWARN();
     int32_t maxlog;
     int32_t sock;
-    if (parse_py_args("ii", nargs, args, &sock, &maxlog) != 2)
+    if (nargs < 2 || !PYARG_INT(0, sock) || !PYARG_INT(1, maxlog))
         return ERR_TYPE_EXC;
     RELEASE_GIL();
     maxlog = gzsock_listen(sock, maxlog);
@@ -378,7 +789,7 @@ C_NATIVE(py_net_accept)
     C_NATIVE_UNWARN();
     int32_t sock;
     NetAddress addr;
-    if (parse_py_args("i", nargs, args, &sock) != 1)
+    if (nargs < 1 || !PYARG_INT(0, sock))
         return ERR_TYPE_EXC;
     sockaddr_t clientaddr;
     socklen_t addrlen;
@@ -483,16 +894,562 @@ C_NATIVE(py_net_select)
 }
 
 
+//poll events, same values as poll.h
+#define _POLLIN  1
+#define _POLLOUT 4
+#define _POLLERR 8
+
+/*
+ * Persistent state of a socket.Poller, kept in a bytearray owned by the Python object:
+ * the fd_sets of registered sockets (read, write, error) and the highest registered fd
+ */
+typedef struct _py_poller {
+    fd_set fds[3];
+    int32_t maxfd;
+} PyPoller;
+
+#define PY_POLLER(o) ((PyPoller*)PSEQUENCE_BYTES(o))
+#define IS_PY_POLLER(o) (PTYPE(o)==PBYTEARRAY && PSEQUENCE_ELEMENTS(o)==sizeof(PyPoller))
+
+C_NATIVE(py_net_poller_new)
+{
+    C_NATIVE_UNWARN();
+    PObject *state = (PObject*)psequence_new(PBYTEARRAY, sizeof(PyPoller));
+    PSEQUENCE_ELEMENTS_SET(state, sizeof(PyPoller));
+    PyPoller *pp = PY_POLLER(state);
+    FD_ZERO(&pp->fds[0]);
+    FD_ZERO(&pp->fds[1]);
+    FD_ZERO(&pp->fds[2]);
+    pp->maxfd = -1;
+    *res = state;
+    return ERR_OK;
+}
+
+/*
+ * args: state, fd, events
+ * sets the events of interest for fd; no events unregisters it
+ */
+C_NATIVE(py_net_poller_ctl)
+{
+    C_NATIVE_UNWARN();
+    int32_t fd, events, j;
+    PyPoller *pp;
+
+    if (nargs != 3 || !IS_PY_POLLER(args[0]) || parse_py_args("ii", 2, args + 1, &fd, &events) != 2)
+        return ERR_TYPE_EXC;
+    if (fd < 0 || fd >= FD_SETSIZE)
+        return ERR_VALUE_EXC;
+    pp = PY_POLLER(args[0]);
+    if (events & _POLLIN) FD_SET(fd, &pp->fds[0]); else FD_CLR(fd, &pp->fds[0]);
+    if (events & _POLLOUT) FD_SET(fd, &pp->fds[1]); else FD_CLR(fd, &pp->fds[1]);
+    if (events & _POLLERR) FD_SET(fd, &pp->fds[2]); else FD_CLR(fd, &pp->fds[2]);
+    if (events && fd > pp->maxfd) {
+        pp->maxfd = fd;
+    } else if (!events && fd == pp->maxfd) {
+        //find the new highest registered fd
+        while (pp->maxfd >= 0) {
+            for (j = 0; j < 3; j++)
+                if (FD_ISSET(pp->maxfd, &pp->fds[j])) break;
+            if (j < 3) break;
+            pp->maxfd--;
+        }
+    }
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+/*
+ * args: state, timeout
+ * waits for the registered sockets and returns a tuple of (fd, events) for the ready ones only
+ */
+C_NATIVE(py_net_poll)
+{
+    C_NATIVE_UNWARN();
+    int32_t timeout;
+    int32_t tmp, i, j, maxfd, ev;
+    fd_set fds[3];
+    struct timeval tms;
+    struct timeval* ptm;
+    PyPoller *pp;
+
+    if (nargs != 2 || !IS_PY_POLLER(args[0]))
+        return ERR_TYPE_EXC;
+    if (args[1] == MAKE_NONE()) {
+        ptm = NULL;
+    }
+    else if (IS_PSMALLINT(args[1])) {
+        timeout = PSMALLINT_VALUE(args[1]);
+        if (timeout < 0)
+            return ERR_TYPE_EXC;
+        tms.tv_sec = timeout / 1000;
+        tms.tv_usec = (timeout % 1000) * 1000;
+        ptm = &tms;
+    }
+    else
+        return ERR_TYPE_EXC;
+
+    //select overwrites its sets: work on a copy
+    pp = PY_POLLER(args[0]);
+    maxfd = pp->maxfd;
+    memcpy(fds, pp->fds, sizeof(fds));
+
+    RELEASE_GIL();
+    tmp = gzsock_select((maxfd + 1), &fds[0], &fds[1], &fds[2], ptm);
+    ACQUIRE_GIL();
+
+    if (tmp < 0) {
+        return ERR_IOERROR_EXC;
+    }
+
+    //select counts a socket once per set it is ready in: count ready sockets
+    j = 0;
+    for (i = 0; i <= maxfd; i++) {
+        if (FD_ISSET(i, &fds[0]) || FD_ISSET(i, &fds[1]) || FD_ISSET(i, &fds[2]))
+            j++;
+    }
+    PTuple* tpl = (PTuple*)psequence_new(PTUPLE, j);
+    j = 0;
+    for (i = 0; i <= maxfd; i++) {
+        ev = 0;
+        if (FD_ISSET(i, &fds[0])) ev |= _POLLIN;
+        if (FD_ISSET(i, &fds[1])) ev |= _POLLOUT;
+        if (FD_ISSET(i, &fds[2])) ev |= _POLLERR;
+        if (!ev) continue;
+        PTuple* pair = (PTuple*)psequence_new(PTUPLE, 2);
+        PTUPLE_SET_ITEM(pair, 0, PSMALLINT_NEW(i));
+        PTUPLE_SET_ITEM(pair, 1, PSMALLINT_NEW(ev));
+        PTUPLE_SET_ITEM(tpl, j, pair);
+        j++;
+    }
+    *res = tpl;
+    return ERR_OK;
+}
+
+
+/*
+ * Receive buffer of a socket, kept in a bytearray owned by the Python object:
+ * a header followed by cap bytes of data, of which count are buffered starting at head.
+ * It is refilled with a single recv only when drained, so buffered bytes never wrap.
+ */
+typedef struct _py_rxbuf {
+    int32_t head;
+    int32_t count;
+    int32_t cap;
+    uint8_t data[];
+} PyRxBuf;
+
+#define PY_RXBUF(o) ((PyRxBuf*)PSEQUENCE_BYTES(o))
+#define IS_PY_RXBUF(o) (PTYPE(o)==PBYTEARRAY && PSEQUENCE_ELEMENTS(o)>(int32_t)sizeof(PyRxBuf) && PY_RXBUF(o)->cap==PSEQUENCE_ELEMENTS(o)-(int32_t)sizeof(PyRxBuf))
+
+static err_t py_net_rx_error(int32_t r)
+{
+    //on non-blocking sockets nothing to read is like a zero timeout
+    if (r == -ETIMEDOUT || PY_NET_WOULDBLOCK(r))
+        return ERR_TIMEOUT_EXC;
+    return ERR_IOERROR_EXC;
+}
+
+//one recv into the drained buffer, with the GIL released: returns the recv result
+static int32_t py_net_rx_fill(int32_t sock, PyRxBuf *rx)
+{
+    int32_t r;
+    RELEASE_GIL();
+    r = gzsock_recv(sock, rx->data, rx->cap, 0);
+    ACQUIRE_GIL();
+    rx->head = 0;
+    rx->count = (r > 0) ? r : 0;
+    return r;
+}
+
+/*
+ * args: size
+ * returns the state of an empty receive buffer of size bytes
+ */
+C_NATIVE(py_net_rx_new)
+{
+    C_NATIVE_UNWARN();
+    int32_t size;
+    PObject *state;
+    PyRxBuf *rx;
+
+    if (nargs < 1 || !PYARG_INT(0, size))
+        return ERR_TYPE_EXC;
+    if (size <= 0)
+        return ERR_VALUE_EXC;
+    state = (PObject*)psequence_new(PBYTEARRAY, sizeof(PyRxBuf) + size);
+    PSEQUENCE_ELEMENTS_SET(state, sizeof(PyRxBuf) + size);
+    rx = PY_RXBUF(state);
+    rx->head = 0;
+    rx->count = 0;
+    rx->cap = size;
+    *res = state;
+    return ERR_OK;
+}
+
+/*
+ * args: sock, state, size
+ * returns a bytearray with at most size buffered bytes, without consuming them.
+ * Blocks for one recv if nothing is buffered; an empty bytearray means the connection is closed
+ */
+C_NATIVE(py_net_rx_peek)
+{
+    C_NATIVE_UNWARN();
+    int32_t sock, size, r;
+    PyRxBuf *rx;
+    PObject *buf;
+
+    if (nargs != 3 || !IS_PSMALLINT(args[0]) || !IS_PY_RXBUF(args[1]) || !IS_PSMALLINT(args[2]))
+        return ERR_TYPE_EXC;
+    sock = PSMALLINT_VALUE(args[0]);
+    size = PSMALLINT_VALUE(args[2]);
+    if (size < 0)
+        return ERR_VALUE_EXC;
+    rx = PY_RXBUF(args[1]);
+    if (!rx->count && size) {
+        r = py_net_rx_fill(sock, rx);
+        if (r < 0)
+            return py_net_rx_error(r);
+    }
+    if (size > rx->count)
+        size = rx->count;
+    buf = (PObject*)psequence_new(PBYTEARRAY, size);
+    PSEQUENCE_ELEMENTS_SET(buf, size);
+    memcpy(PSEQUENCE_BYTES(buf), rx->data + rx->head, size);
+    *res = buf;
+    return ERR_OK;
+}
+
+/*
+ * args: sock, state, pattern, buffer, ofs
+ * moves bytes from the socket to buffer, starting at ofs, until buffer ends with pattern, buffer is full or the connection is closed.
+ * Bytes after pattern stay buffered. Returns the position in buffer after the last byte stored
+ */
+C_NATIVE(py_net_rx_read_until)
+{
+    C_NATIVE_UNWARN();
+    int32_t sock, ofs, size, plen, r;
+    uint8_t *pat;
+    uint8_t *out;
+    uint8_t c, last;
+    PyRxBuf *rx;
+
+    if (nargs != 5 || !IS_PSMALLINT(args[0]) || !IS_PY_RXBUF(args[1]) || PTYPE(args[3]) != PBYTEARRAY || !IS_PSMALLINT(args[4]))
+        return ERR_TYPE_EXC;
+    if (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(args[2])) || !PSEQUENCE_ELEMENTS(args[2]))
+        return ERR_TYPE_EXC;
+    sock = PSMALLINT_VALUE(args[0]);
+    rx = PY_RXBUF(args[1]);
+    pat = PSEQUENCE_BYTES(args[2]);
+    plen = PSEQUENCE_ELEMENTS(args[2]);
+    out = PSEQUENCE_BYTES(args[3]);
+    size = PSEQUENCE_ELEMENTS(args[3]);
+    ofs = PSMALLINT_VALUE(args[4]);
+    if (ofs < 0 || ofs > size)
+        return ERR_INDEX_EXC;
+    last = pat[plen - 1];
+
+    while (ofs < size) {
+        if (!rx->count) {
+            r = py_net_rx_fill(sock, rx);
+            if (r < 0)
+                return py_net_rx_error(r);
+            if (!r)
+                break;
+        }
+        c = rx->data[rx->head++];
+        rx->count--;
+        out[ofs++] = c;
+        if (c == last && ofs >= plen && memcmp(out + ofs - plen, pat, plen) == 0)
+            break;
+    }
+    *res = PSMALLINT_NEW(ofs);
+    return ERR_OK;
+}
+
+/*
+ * args: sock, buffer, size, flags, ofs, state
+ * same as py_net_recv_into, but buffered bytes are consumed first
+ */
+C_NATIVE(py_net_rx_recv_into)
+{
+    C_NATIVE_UNWARN();
+    uint8_t* buf;
+    int32_t len;
+    int32_t sz;
+    int32_t flags;
+    int32_t ofs;
+    int32_t sock;
+    int32_t rb, r;
+    PyRxBuf *rx;
+
+    if (nargs != 6 || !IS_PY_RXBUF(args[5]))
+        return ERR_TYPE_EXC;
+    rx = PY_RXBUF(args[5]);
+    if (parse_py_args("isiii", nargs - 1, args,
+            &sock,
+            &buf, &len,
+            &sz,
+            &flags,
+            &ofs)
+        != 5)
+        return ERR_TYPE_EXC;
+    if (ofs < 0 || ofs > len)
+        return ERR_INDEX_EXC;
+    buf += ofs;
+    len -= ofs;
+    len = (sz < len) ? sz : len;
+    rb = (rx->count < len) ? rx->count : len;
+    memcpy(buf, rx->data + rx->head, rb);
+    rx->head += rb;
+    rx->count -= rb;
+    r = 1;
+    RELEASE_GIL();
+    while (rb < len) {
+        r = gzsock_recv(sock, buf + rb, len - rb, flags);
+        if (r <= 0)
+            break;
+        rb += r;
+    }
+    ACQUIRE_GIL();
+    if (r < 0)
+        return py_net_rx_error(r);
+    *res = PSMALLINT_NEW(rb);
+    return ERR_OK;
+}
+
+#define _HTTP_NAME_LEN  32
+#define _HTTP_VALUE_LEN 128
+
+#define _HH_STATUS 0
+#define _HH_NAME   1
+#define _HH_VALUE  2
+#define _HH_SKIP   3
+
+static int32_t py_net_http_name(PObject *names, uint8_t *name, int32_t nlen)
+{
+    int32_t i;
+    PObject *n;
+
+    if (nlen > _HTTP_NAME_LEN)
+        return -1;
+    for (i = 0; i < PSEQUENCE_ELEMENTS(names); i++) {
+        n = PSEQUENCE_OBJECTS(names)[i];
+        if (PSEQUENCE_ELEMENTS(n) == nlen && memcmp(PSEQUENCE_BYTES(n), name, nlen) == 0)
+            return i;
+    }
+    return -1;
+}
+
+/*
+ * args: sock, state, names, headers
+ * reads an HTTP/1.x response head, from the status line to the empty line, in one pass over the receive buffer.
+ * Only the headers named in names (a tuple or list of lowercase strings) are stored in the dict headers, keyed by the string in names;
+ * the others are skipped without allocating. Values are stripped and truncated to _HTTP_VALUE_LEN bytes.
+ * Returns the status code, or -1 if the connection is closed before the end of the head
+ */
+C_NATIVE(py_net_rx_http_head)
+{
+    C_NATIVE_UNWARN();
+    int32_t sock, r, i;
+    int32_t status = -1;
+    int32_t state = _HH_STATUS;
+    int32_t nlen = 0, vlen = 0, idx = -1;
+    uint8_t name[_HTTP_NAME_LEN];
+    uint8_t value[_HTTP_VALUE_LEN];
+    uint8_t c;
+    PyRxBuf *rx;
+    PObject *names;
+
+    if (nargs != 4 || !IS_PSMALLINT(args[0]) || !IS_PY_RXBUF(args[1]) || PTYPE(args[3]) != PDICT)
+        return ERR_TYPE_EXC;
+    names = args[2];
+    if (PTYPE(names) != PTUPLE && PTYPE(names) != PLIST)
+        return ERR_TYPE_EXC;
+    for (i = 0; i < PSEQUENCE_ELEMENTS(names); i++) {
+        if (PTYPE(PSEQUENCE_OBJECTS(names)[i]) != PSTRING)
+            return ERR_TYPE_EXC;
+    }
+    sock = PSMALLINT_VALUE(args[0]);
+    rx = PY_RXBUF(args[1]);
+
+    while (1) {
+        if (!rx->count) {
+            r = py_net_rx_fill(sock, rx);
+            if (r < 0)
+                return py_net_rx_error(r);
+            if (!r) {
+                status = -1;
+                break;
+            }
+        }
+        c = rx->data[rx->head++];
+        rx->count--;
+        if (c == '\r')
+            continue;
+        if (state == _HH_STATUS) {
+            if (c != '\n') {
+                if (vlen < _HTTP_VALUE_LEN)
+                    value[vlen++] = c;
+                continue;
+            }
+            //HTTP/1.x SSS reason
+            if (vlen < 12 || memcmp(value, "HTTP/1.", 7) != 0 || value[8] != ' ')
+                return ERR_VALUE_EXC;
+            status = 0;
+            for (i = 9; i < 12; i++) {
+                if (value[i] < '0' || value[i] > '9')
+                    return ERR_VALUE_EXC;
+                status = status * 10 + value[i] - '0';
+            }
+            state = _HH_NAME;
+            nlen = 0;
+        } else if (state == _HH_NAME) {
+            if (c == '\n') {
+                if (!nlen)
+                    break;  //empty line: end of the head
+                return ERR_VALUE_EXC;
+            }
+            if (c == ':') {
+                idx = py_net_http_name(names, name, nlen);
+                state = (idx >= 0) ? _HH_VALUE : _HH_SKIP;
+                vlen = 0;
+                continue;
+            }
+            if (nlen < _HTTP_NAME_LEN)
+                name[nlen] = (c >= 'A' && c <= 'Z') ? c + 32 : c;
+            nlen++;
+        } else if (state == _HH_VALUE) {
+            if (c == '\n') {
+                while (vlen && (value[vlen - 1] == ' ' || value[vlen - 1] == '\t'))
+                    vlen--;
+                pdict_put(args[3], PSEQUENCE_OBJECTS(names)[idx], pstring_new(vlen, value));
+                state = _HH_NAME;
+                nlen = 0;
+            } else if ((c != ' ' && c != '\t') || vlen) {
+                if (vlen < _HTTP_VALUE_LEN)
+                    value[vlen++] = c;
+            }
+        } else if (c == '\n') {
+            state = _HH_NAME;
+            nlen = 0;
+        }
+    }
+    *res = PSMALLINT_NEW(status);
+    return ERR_OK;
+}
+
+/*
+ * args: sock, state, buffer, wait
+ * reads one MQTT control packet through the receive buffer: the fixed header is decoded here and the body, of the
+ * remaining length, is stored in buffer. Waiting for the first byte times out as a recv does; once it has arrived,
+ * the rest of the packet is waited for across timeouts for wait milliseconds (forever if negative), then IOError is
+ * raised: the stream is left in the middle of a packet and the connection must be closed.
+ * Bodies longer than buffer are consumed, keeping only the bytes that fit.
+ * Returns (first byte, remaining length), with -1 as first byte if the connection is closed
+ */
+C_NATIVE(py_net_rx_mqtt)
+{
+    C_NATIVE_UNWARN();
+    int32_t sock, size, r, n, wait;
+    int32_t hdr = -1, len = 0, shift = 0, pos = 0, body = 0;
+    uint32_t start = 0;
+    uint8_t *out;
+    uint8_t c;
+    PyRxBuf *rx;
+    PTuple *tpl;
+
+    if (nargs != 4 || !IS_PSMALLINT(args[0]) || !IS_PY_RXBUF(args[1]) || PTYPE(args[2]) != PBYTEARRAY || !IS_PSMALLINT(args[3]))
+        return ERR_TYPE_EXC;
+    wait = PSMALLINT_VALUE(args[3]);
+    sock = PSMALLINT_VALUE(args[0]);
+    rx = PY_RXBUF(args[1]);
+    out = PSEQUENCE_BYTES(args[2]);
+    size = PSEQUENCE_ELEMENTS(args[2]);
+
+    while (!body || pos < len) {
+        if (!rx->count) {
+            r = py_net_rx_fill(sock, rx);
+            if (r < 0) {
+                if (hdr >= 0 && r == -ETIMEDOUT) {
+                    //in the middle of a packet: not a timeout of the caller, that would read the rest as a new one
+                    if (wait >= 0 && (vosMillis() - start) >= (uint32_t)wait)
+                        return ERR_IOERROR_EXC;
+                    continue;
+                }
+                return py_net_rx_error(r);
+            }
+            if (!r) {
+                hdr = -1;
+                len = 0;
+                break;
+            }
+        }
+        if (body) {
+            n = (rx->count < len - pos) ? rx->count : len - pos;
+            if (pos < size)
+                memcpy(out + pos, rx->data + rx->head, (pos + n <= size) ? n : size - pos);
+            rx->head += n;
+            rx->count -= n;
+            pos += n;
+            continue;
+        }
+        c = rx->data[rx->head++];
+        rx->count--;
+        if (hdr < 0) {
+            hdr = c;
+            start = vosMillis();
+            continue;
+        }
+        //remaining length: at most four bytes of seven bits
+        len |= (c & 0x7f) << shift;
+        shift += 7;
+        if (c & 0x80) {
+            if (shift >= 28)
+                return ERR_VALUE_EXC;
+        } else
+            body = 1;
+    }
+    tpl = ptuple_new(2, NULL);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(hdr));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(len));
+    *res = (PObject*)tpl;
+    return ERR_OK;
+}
+
 #define _CERT_NONE 1
 #define _CERT_OPTIONAL 2
 #define _CERT_REQUIRED 4
 #define _CLIENT_AUTH 8
 #define _SERVER_AUTH 16
+#define _SESSION_RESUME 32
 
 
 // ZHWCryptoAPIPointers *zhwcrypto_api_pointers_backup = NULL;
 // extern ZHWCryptoAPIPointers null_api_pointers;
 
+#if defined(ZERYNTH_SSL)
+/*
+ * bytes of a certificate or key of the ssl context: a byte sequence, or an (address, size) tuple
+ * pointing to a resource in memory mapped flash, used in place without copies.
+ * Returns -1 if the object is neither
+ */
+static int32_t py_ssl_ctx_bytes(PObject* o, uint8_t** buf, uint32_t* len)
+{
+    if (PTYPE(o) == PTUPLE) {
+        if (PSEQUENCE_ELEMENTS(o) != 2 || !IS_INTEGER(PTUPLE_ITEM(o, 0)) || !IS_INTEGER(PTUPLE_ITEM(o, 1)))
+            return -1;
+        *buf = (uint8_t*)INTEGER_VALUE(PTUPLE_ITEM(o, 0));
+        *len = INTEGER_VALUE(PTUPLE_ITEM(o, 1));
+        return 0;
+    }
+    if (!IS_BYTE_PSEQUENCE_TYPE(PTYPE(o)))
+        return -1;
+    *buf = PSEQUENCE_BYTES(o);
+    *len = PSEQUENCE_ELEMENTS(o);
+    return 0;
+}
+#endif
+
 C_NATIVE(py_secure_socket)
 {
     C_NATIVE_UNWARN();
@@ -523,7 +1480,7 @@ C_NATIVE(py_secure_socket)
     memset(&nfo,0,sizeof(nfo));
     ctx = (PTuple*)args[nargs - 1];
     nargs--;
-    if (parse_py_args("III", nargs, args, DRV_AF_INET, &family, DRV_SOCK_STREAM, &type, IPPROTO_TCP, &proto) != 3){
+    if (!PYARG_INT_OPT(0, DRV_AF_INET, family) || !PYARG_INT_OPT(1, DRV_SOCK_STREAM, type) || !PYARG_INT_OPT(2, IPPROTO_TCP, proto)){
         return ERR_TYPE_EXC;
     }
     if (type != DRV_SOCK_DGRAM && type != DRV_SOCK_STREAM){
@@ -533,7 +1490,7 @@ C_NATIVE(py_secure_socket)
         return ERR_UNSUPPORTED_EXC;
 
     ctxlen = PSEQUENCE_ELEMENTS(ctx);
-    if (ctxlen && ctxlen != 5)
+    if (ctxlen && ctxlen != 5 && ctxlen != 6)
         return ERR_TYPE_EXC;
 
     if (ctxlen) {
@@ -544,15 +1501,25 @@ C_NATIVE(py_secure_socket)
         PObject* host = PTUPLE_ITEM(ctx, 3);
         PObject* iopts = PTUPLE_ITEM(ctx, 4);
 
-        nfo.cacert = PSEQUENCE_BYTES(cacert);
-        nfo.cacert_len = PSEQUENCE_ELEMENTS(cacert);
-        nfo.clicert = PSEQUENCE_BYTES(clicert);
-        nfo.clicert_len = PSEQUENCE_ELEMENTS(clicert);
+        if (IS_PSMALLINT(cacert)) {
+            //id of an x509.CertStore, already parsed
+            if (PSMALLINT_VALUE(cacert) < 0)
+                return ERR_VALUE_EXC;
+            nfo.castore = PSMALLINT_VALUE(cacert) + 1;
+        } else if (py_ssl_ctx_bytes(cacert, &nfo.cacert, &nfo.cacert_len) < 0)
+            return ERR_TYPE_EXC;
+        if (py_ssl_ctx_bytes(clicert, &nfo.clicert, &nfo.clicert_len) < 0 ||
+            py_ssl_ctx_bytes(ppkey, &nfo.pvkey, &nfo.pvkey_len) < 0)
+            return ERR_TYPE_EXC;
         nfo.hostname = PSEQUENCE_BYTES(host);
         nfo.hostname_len = PSEQUENCE_ELEMENTS(host);
-        nfo.pvkey = PSEQUENCE_BYTES(ppkey);
-        nfo.pvkey_len = PSEQUENCE_ELEMENTS(ppkey);
         nfo.options = PSMALLINT_VALUE(iopts);
+        if (ctxlen == 6) {
+            //cipher suites in order of preference
+            PObject* suites = PTUPLE_ITEM(ctx, 5);
+            nfo.ciphersuites = PSEQUENCE_BYTES(suites);
+            nfo.ciphersuites_len = PSEQUENCE_ELEMENTS(suites);
+        }
     }
     RELEASE_GIL();
     DEBUG(LVL0,"Creating secure socket","");
@@ -571,6 +1538,141 @@ C_NATIVE(py_secure_socket)
 }
 
 
+/*
+ * no args: returns a tuple with a (size, blocks, used, high water mark, fallbacks) tuple for each class of the TLS block pool,
+ * empty if the pool is not compiled
+ */
+C_NATIVE(py_ssl_pool_stats)
+{
+    C_NATIVE_UNWARN();
+#if defined(ZERYNTH_SSL) && defined(ZERYNTH_SSL_MBEDTLS) && defined(ZERYNTH_SSL_STATIC_BUFFERS)
+    int32_t i;
+    PTuple* tpl = (PTuple*)psequence_new(PTUPLE, SSL_POOL_CLASSES);
+    for (i = 0; i < SSL_POOL_CLASSES; i++) {
+        SSLPool* pool = &_sslpools[i];
+        PTuple* cls = (PTuple*)psequence_new(PTUPLE, 5);
+        PTUPLE_SET_ITEM(cls, 0, PSMALLINT_NEW(pool->size));
+        PTUPLE_SET_ITEM(cls, 1, PSMALLINT_NEW(pool->num));
+        PTUPLE_SET_ITEM(cls, 2, PSMALLINT_NEW(pool->used));
+        PTUPLE_SET_ITEM(cls, 3, PSMALLINT_NEW(pool->high));
+        PTUPLE_SET_ITEM(cls, 4, PSMALLINT_NEW(pool->fallbacks));
+        PTUPLE_SET_ITEM(tpl, i, cls);
+    }
+    *res = tpl;
+#else
+    *res = (PObject*)psequence_new(PTUPLE, 0);
+#endif
+    return ERR_OK;
+}
+
+/*
+ * no args: returns (ready, taken, misses) for the precomputed ECDHE key pairs: pairs ready now, handshakes that used one and
+ * P-256 handshakes that found none. Empty if the pool is not compiled
+ */
+C_NATIVE(py_ssl_ecdhe_stats)
+{
+    C_NATIVE_UNWARN();
+#if defined(ZERYNTH_SSL) && defined(ZERYNTH_SSL_MBEDTLS) && defined(ZERYNTH_SSL_ECDHE_POOL)
+    int ready;
+    uint32_t taken, misses;
+    PTuple* tpl = (PTuple*)psequence_new(PTUPLE, 3);
+    mbedtls_ecdhe_pool_stats(&ready, &taken, &misses);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(ready));
+    PTUPLE_SET_ITEM(tpl, 1, pinteger_new(taken));
+    PTUPLE_SET_ITEM(tpl, 2, pinteger_new(misses));
+    *res = tpl;
+#else
+    *res = (PObject*)psequence_new(PTUPLE, 0);
+#endif
+    return ERR_OK;
+}
+/*
+ * no args: returns the id of a new empty CA store. Raises RuntimeError if all ZERYNTH_SSL_CERTSTORES are in use
+ */
+C_NATIVE(py_ssl_certstore_new)
+{
+    C_NATIVE_UNWARN();
+#if defined(ZERYNTH_SSL) && defined(ZERYNTH_SSL_MBEDTLS)
+    int32_t id = mbedtls_certstore_new();
+    if (id < 0)
+        return ERR_RUNTIME_EXC;
+    *res = PSMALLINT_NEW(id);
+    return ERR_OK;
+#else
+    return ERR_UNSUPPORTED_EXC;
+#endif
+}
+
+/*
+ * args: id, cert
+ * parses the certificates in cert (PEM with the terminating zero, or DER), as bytes or an (address, size) flash resource,
+ * into store id. Returns the number of certificates in the store
+ */
+C_NATIVE(py_ssl_certstore_add)
+{
+    C_NATIVE_UNWARN();
+#if defined(ZERYNTH_SSL) && defined(ZERYNTH_SSL_MBEDTLS)
+    uint8_t* buf;
+    uint32_t len;
+    int32_t n;
+    if (nargs != 2 || !IS_PSMALLINT(args[0]) || py_ssl_ctx_bytes(args[1], &buf, &len) < 0)
+        return ERR_TYPE_EXC;
+    RELEASE_GIL();
+    n = mbedtls_certstore_add(PSMALLINT_VALUE(args[0]), buf, len);
+    ACQUIRE_GIL();
+    if (n == SSL_CERTSTORE_BUSY)
+        return ERR_RUNTIME_EXC;
+    if (n < 0)
+        return ERR_VALUE_EXC;
+    *res = PSMALLINT_NEW(n);
+    return ERR_OK;
+#else
+    return ERR_UNSUPPORTED_EXC;
+#endif
+}
+
+/*
+ * args: id
+ * releases store id: the certificates are freed when the last socket using them is closed
+ */
+C_NATIVE(py_ssl_certstore_free)
+{
+    C_NATIVE_UNWARN();
+#if defined(ZERYNTH_SSL) && defined(ZERYNTH_SSL_MBEDTLS)
+    if (nargs != 1 || !IS_PSMALLINT(args[0]))
+        return ERR_TYPE_EXC;
+    mbedtls_certstore_release(PSMALLINT_VALUE(args[0]));
+    *res = MAKE_NONE();
+    return ERR_OK;
+#else
+    return ERR_UNSUPPORTED_EXC;
+#endif
+}
+
+/*
+ * args: id
+ * returns (certificates, references) of store id
+ */
+C_NATIVE(py_ssl_certstore_info)
+{
+    C_NATIVE_UNWARN();
+#if defined(ZERYNTH_SSL) && defined(ZERYNTH_SSL_MBEDTLS)
+    int certs, refs;
+    PTuple* tpl;
+    if (nargs != 1 || !IS_PSMALLINT(args[0]))
+        return ERR_TYPE_EXC;
+    if (mbedtls_certstore_info(PSMALLINT_VALUE(args[0]), &certs, &refs) < 0)
+        return ERR_INDEX_EXC;
+    tpl = (PTuple*)psequence_new(PTUPLE, 2);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(certs));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(refs));
+    *res = tpl;
+    return ERR_OK;
+#else
+    return ERR_UNSUPPORTED_EXC;
+#endif
+}
+
 
 
 #endif
@@ -10,6 +10,16 @@ SocketAPIPointers *socket_api_pointers = NULL;
 #endif
 
 
+//marks data moved by socket s at now, for idle times (py_net_idle)
+#define ZSOCK_TOUCH(s, field, r) do { if ((r) > 0 && (s) >= 0 && (s) < MAX_SOCKETS) _zsocket_info[s].field = vosMillis(); } while (0)
+
+//a new socket starts idle from now
+static int zsock_fresh(int s) {
+    if (s >= 0 && s < MAX_SOCKETS)
+        _zsocket_info[s].last_rx = _zsocket_info[s].last_tx = vosMillis();
+    return s;
+}
+
 SocketAPIPointers *gzsock_init(SocketAPIPointers *pointers) {
     SocketAPIPointers *old = socket_api_pointers;
     if (pointers)
@@ -36,12 +46,12 @@ int gzsock_socket(int domain, int type, int protocol, void *ctx){
     DEBUG(LVL0,"args %i %i %i %x",domain,type,protocol,ctx);
 #if defined(ZERYNTH_SSL)
     if(ctx) {
-        return zssl_socket(domain,type,protocol,ctx);
+        return zsock_fresh(zssl_socket(domain,type,protocol,ctx));
     } else
 #endif
     {
         //call zsock api
-        return zsock_socket(domain,type,protocol);
+        return zsock_fresh(zsock_socket(domain,type,protocol));
     }
 }
 
@@ -71,52 +81,60 @@ int gzsock_close(int s){
     }
 }
 int gzsock_recv(int s, void *mem, size_t len, int flags){
+    int r;
     DEBUG(LVL0,"args %i %x %i %i",s,mem,len,flags);
 #if defined(ZERYNTH_SSL)
     if (IS_SECURE_SOCKET(s)) {
-        return zssl_recv(s,mem,len,flags);
+        r = zssl_recv(s,mem,len,flags);
     } else
 #endif
     {
-        return zsock_recv(s,mem,len,flags);
+        r = zsock_recv(s,mem,len,flags);
     }
+    ZSOCK_TOUCH(s, last_rx, r);
+    return r;
 }
 int gzsock_read(int s, void *mem, size_t len){
+    int r;
     DEBUG(LVL0,"args %i %x %i %i",s,mem,len);
 #if defined(ZERYNTH_SSL)
     if (IS_SECURE_SOCKET(s)) {
-        return zssl_read(s,mem,len);
+        r = zssl_read(s,mem,len);
     } else
 #endif
     {
-        return zsock_read(s,mem,len);
+        r = zsock_read(s,mem,len);
     }
+    ZSOCK_TOUCH(s, last_rx, r);
+    return r;
 }
 int gzsock_send(int s, const void *dataptr, size_t size, int flags){
+    int r;
     DEBUG(LVL0,"args %i %x %i %i",s,dataptr,size,flags);
 #if defined(ZERYNTH_SSL)
     if (IS_SECURE_SOCKET(s)) {
-        return zssl_send(s,dataptr,size,flags);
+        r = zssl_send(s,dataptr,size,flags);
     } else
 #endif
     {
-        return zsock_send(s,dataptr,size,flags);
+        r = zsock_send(s,dataptr,size,flags);
     }
-
+    ZSOCK_TOUCH(s, last_tx, r);
+    return r;
 }
 int gzsock_write(int s, const void *dataptr, size_t size){
+    int r;
     DEBUG(LVL0,"args %i %x %i",s,dataptr,size);
 #if defined(ZERYNTH_SSL)
     if (IS_SECURE_SOCKET(s)) {
-        return zssl_write(s,dataptr,size);
-        SSLSock *sslsock = GET_SECURE_SOCKET(s);
-        return mbedtls_ssl_write(&sslsock->ssl,dataptr,size);
+        r = zssl_write(s,dataptr,size);
     } else
 #endif
     {
-        return zsock_write(s,dataptr,size);
+        r = zsock_write(s,dataptr,size);
     }
-
+    ZSOCK_TOUCH(s, last_tx, r);
+    return r;
 }
 
 int gzsock_setsockopt(int s, int level, int optname, const void *optval, socklen_t optlen){
@@ -131,13 +149,37 @@ int gzsock_setsockopt(int s, int level, int optname, const void *optval, socklen
     }
 }
 
+int gzsock_getsockopt(int s, int level, int optname, void *optval, socklen_t *optlen){
+    DEBUG(LVL0,"args %i %i %i %x %x",s,level,optname,optval,optlen);
+    if (!socket_api_pointers->getsockopt)
+        return -EOPNOTSUPP;
+    return zsock_getsockopt(s, level, optname, optval, optlen);
+}
+
+/*
+ * File status flags (O_NONBLOCK) of secure sockets are the ones of the underlying socket:
+ * zssl_connect takes care of doing the handshake in blocking mode
+ */
+int gzsock_fcntl(int s, int cmd, int val){
+    DEBUG(LVL0,"args %i %i %i",s,cmd,val);
+    if (!socket_api_pointers->fcntl)
+        return -EOPNOTSUPP;
+    return zsock_fcntl(s, cmd, val);
+}
+
 int gzsock_sendto(int s, const void *dataptr, size_t size, int flags, const struct sockaddr *to, socklen_t tolen){
+    int r;
     DEBUG(LVL0,"args %i %x %i %i %x %i",s,dataptr,size,flags,to,tolen);
-    return zsock_sendto(s,dataptr,size,flags,to,tolen);
+    r = zsock_sendto(s,dataptr,size,flags,to,tolen);
+    ZSOCK_TOUCH(s, last_tx, r);
+    return r;
 }
 int gzsock_recvfrom(int s, void *mem, size_t len, int flags, struct sockaddr *from, socklen_t *fromlen){
+    int r;
     DEBUG(LVL0,"args %i %x %i %i %x %x",s,mem,len,flags,from,fromlen);
-    return zsock_recvfrom(s,mem,len,flags,from,fromlen);
+    r = zsock_recvfrom(s,mem,len,flags,from,fromlen);
+    ZSOCK_TOUCH(s, last_rx, r);
+    return r;
 }
 int gzsock_bind(int s, const struct sockaddr *name, socklen_t namelen){
     DEBUG(LVL0,"args %i %x %i",s,name,namelen);
@@ -150,7 +192,7 @@ int gzsock_listen(int s, int backlog){
 
 int gzsock_accept(int s, struct sockaddr *addr, socklen_t *addrlen){
     DEBUG(LVL0,"args %i %x %x",s,addr,addrlen);
-    return zsock_accept(s,addr,addrlen);
+    return zsock_fresh(zsock_accept(s,addr,addrlen));
 }
 
 int gzsock_select(int maxfdp1, void *readset, void *writeset, void *exceptset, struct timeval *timeout){
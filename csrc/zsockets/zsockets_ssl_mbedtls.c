@@ -39,6 +39,14 @@ int zssl_init(){
             mbedtls_mutex_free_alt,
             mbedtls_mutex_lock_alt,
             mbedtls_mutex_unlock_alt);
+#endif
+#if defined(ZERYNTH_SSL_STATIC_BUFFERS)
+    mbedtls_pool_init();
+#endif
+    mbedtls_session_init();
+    mbedtls_certstore_init();
+#if defined(ZERYNTH_SSL_ECDHE_POOL)
+    mbedtls_ecdhe_pool_init();
 #endif
     return 0;
 }
@@ -88,12 +96,27 @@ int zssl_socket(int domain, int type, int protocol, void *ctx) {
         return -1;
     }
 
+#if defined(MBEDTLS_SSL_PROTO_DTLS)
+    if (type == SOCK_DGRAM && (sinfo->options&_CLIENT_AUTH)) {
+        ERROR("DTLS server sockets not supported","");
+        return -1;
+    }
+#else
+    if (type == SOCK_DGRAM) {
+        ERROR("DTLS not compiled, see ZERYNTH_SSL_DTLS","");
+        return -1;
+    }
+#endif
+
     sslsock->family = domain;
     sslsock->socktype = type;
     sslsock->proto = protocol;
 
 
     if (!sslsock->initialized) {
+        //a store still referenced by a socket whose setup failed
+        if (sslsock->castore) mbedtls_certstore_release(sslsock->castore-1);
+        sslsock->castore = 0;
         mbedtls_ssl_init(&sslsock->ssl);
         mbedtls_x509_crt_init(&sslsock->cacert);
         mbedtls_x509_crt_init(&sslsock->clicert);
@@ -115,7 +138,14 @@ int zssl_socket(int domain, int type, int protocol, void *ctx) {
         gzcrypto_hw_disable();
 
         DEBUG(LVL0,"CA certificate length of %i bytes",sinfo->cacert_len);
-        if (sinfo->cacert_len) {
+        if (sinfo->castore) {
+            //already parsed by x509.CertStore
+            if (!mbedtls_certstore_acquire(sinfo->castore-1)) {
+                ERROR("Can't use CA store %i",sinfo->castore-1);
+                return -1;
+            }
+            sslsock->castore = sinfo->castore;
+        } else if (sinfo->cacert_len) {
             err = mbedtls_x509_crt_parse(&sslsock->cacert, sinfo->cacert, sinfo->cacert_len);
             if (err!=0) {
                 ERROR("Can't parse CA certificate %i %x",err,err);
@@ -124,7 +154,7 @@ int zssl_socket(int domain, int type, int protocol, void *ctx) {
         }
 
         DEBUG(LVL0,"hostname length of %i bytes",sinfo->hostname_len);
-        if (sinfo->hostname_len && sinfo->cacert_len) {
+        if (sinfo->hostname_len && (sinfo->cacert_len || sinfo->castore)) {
             /* Hostname set here should match CN in server certificate */
             char *temphost = (char*)gc_malloc(sinfo->hostname_len+1);
             __memcpy(temphost,sinfo->hostname,sinfo->hostname_len);
@@ -139,18 +169,45 @@ int zssl_socket(int domain, int type, int protocol, void *ctx) {
 
         if ((err = mbedtls_ssl_config_defaults(&sslsock->conf,
                  (sinfo->options&_CLIENT_AUTH) ? MBEDTLS_SSL_IS_SERVER:MBEDTLS_SSL_IS_CLIENT,
-                 MBEDTLS_SSL_TRANSPORT_STREAM,
+                 (type == SOCK_DGRAM) ? MBEDTLS_SSL_TRANSPORT_DATAGRAM:MBEDTLS_SSL_TRANSPORT_STREAM,
                  MBEDTLS_SSL_PRESET_DEFAULT))
             != 0) {
             ERROR("Can't set SSL defaults %i %x",err,err);
             return err;
         }
+#if defined(MBEDTLS_SSL_PROTO_DTLS)
+        if (type == SOCK_DGRAM)
+            mbedtls_ssl_conf_handshake_timeout(&sslsock->conf, ZERYNTH_SSL_DTLS_TIMEOUT_MIN, ZERYNTH_SSL_DTLS_TIMEOUT_MAX);
+#endif
         mbedtls_ssl_conf_cert_profile(&sslsock->conf, &mbedtls_x509_crt_profile_custom);
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+        if ((sinfo->options>>_MFL_SHIFT)&_MFL_MASK) {
+            //ask the server for shorter records
+            err = mbedtls_ssl_conf_max_frag_len(&sslsock->conf,(sinfo->options>>_MFL_SHIFT)&_MFL_MASK);
+            if (err!=0) {
+                ERROR("Can't set max fragment length %i %x",err,err);
+                return err;
+            }
+        }
+#endif
+        if (mbedtls_ciphersuites_setup(sslsock,sinfo) != 0) {
+            return -1;
+        }
+        sslsock->resume = (sinfo->options&_SESSION_RESUME) && !(sinfo->options&_CLIENT_AUTH) && sinfo->hostname_len<=SSL_SESSION_HOST_LEN;
+        sslsock->hostname_len = 0;
+        if (sslsock->resume) {
+            sslsock->hostname_len = sinfo->hostname_len;
+            __memcpy(sslsock->hostname,sinfo->hostname,sinfo->hostname_len);
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+            mbedtls_ssl_conf_session_tickets(&sslsock->conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+        }
         mbedtls_ssl_conf_authmode(
                 &sslsock->conf,
                 (sinfo->options&_CERT_NONE) ? MBEDTLS_SSL_VERIFY_NONE: ((sinfo->options&_CERT_OPTIONAL) ? MBEDTLS_SSL_VERIFY_OPTIONAL:MBEDTLS_SSL_VERIFY_REQUIRED));
 
-        if (!(sinfo->options&_CERT_NONE)) mbedtls_ssl_conf_ca_chain(&sslsock->conf, &sslsock->cacert, NULL);
+        if (!(sinfo->options&_CERT_NONE))
+            mbedtls_ssl_conf_ca_chain(&sslsock->conf, (sslsock->castore) ? &_sslstores[sslsock->castore-1].chain:&sslsock->cacert, NULL);
         if (sinfo->clicert_len) {
             DEBUG(LVL0,"Client certificate length of %i bytes",sinfo->clicert_len);
             DEBUG(LVL0,"Private key length of %i bytes",sinfo->pvkey_len);
@@ -194,6 +251,11 @@ int zssl_socket(int domain, int type, int protocol, void *ctx) {
             ERROR("Can't setup SSL %i %x",err,err);
             return err;
         }
+#if defined(MBEDTLS_SSL_PROTO_DTLS)
+        //handshake messages lost by UDP are retransmitted on this timer
+        if (type == SOCK_DGRAM)
+            mbedtls_ssl_set_timer_cb(&sslsock->ssl, sslsock, mbedtls_dtls_timer_set, mbedtls_dtls_timer_get);
+#endif
         sslsock->initialized = 1;
     }
     int llsock = zsock_socket(domain,type,protocol);
@@ -215,8 +277,14 @@ int zssl_socket(int domain, int type, int protocol, void *ctx) {
 
 int zssl_connect(int s, const struct sockaddr *name, socklen_t namelen){
     SSLSock *sslsock = GET_SECURE_SOCKET(s);
+    int fl = gzsock_fcntl(s,F_GETFL,0);
+    int err;
     DEBUG(LVL0,"args %i %x %i",s,name,namelen);
-    if(mbedtls_full_connect(sslsock,name,namelen)){
+    //the handshake is always blocking, non-blocking mode is restored afterwards
+    if (fl>0 && (fl&O_NONBLOCK)) gzsock_fcntl(s,F_SETFL,fl&~O_NONBLOCK);
+    err = mbedtls_full_connect(sslsock,name,namelen);
+    if (fl>0 && (fl&O_NONBLOCK)) gzsock_fcntl(s,F_SETFL,fl);
+    if(err){
         return -1;
     } else {
         return 0;
@@ -232,9 +300,19 @@ int zssl_close(int s){
 
 int zssl_recv(int s, void *mem, size_t len, int flags){
     SSLSock *sslsock = GET_SECURE_SOCKET(s);
-    int rc = mbedtls_ssl_read(&sslsock->ssl,mem,len);
+    int rc;
+    uint8_t c;
+    //records can't be peeked without decrypting them
+    if (flags&MSG_PEEK) return -EOPNOTSUPP;
+    if ((flags&MSG_DONTWAIT) && !mbedtls_ssl_get_bytes_avail(&sslsock->ssl)) {
+        //nothing decrypted: don't wait if nothing arrived either (a partial record is still waited for)
+        rc = zsock_recv(s,&c,1,MSG_PEEK|MSG_DONTWAIT);
+        if (rc == -EAGAIN || rc == -EWOULDBLOCK) return -EWOULDBLOCK;
+    }
+    rc = mbedtls_ssl_read(&sslsock->ssl,mem,len);
     DEBUG(LVL0,"args %i %x %i %i => %i %x",s,mem,len,flags,rc,rc);
     if (rc == MBEDTLS_ERR_SSL_TIMEOUT) rc=-ETIMEDOUT;
+    else if (rc == MBEDTLS_ERR_SSL_WANT_READ || rc == MBEDTLS_ERR_SSL_WANT_WRITE) rc=-EWOULDBLOCK;
     return rc;
 }
 
@@ -243,6 +321,7 @@ int zssl_read(int s, void *mem, size_t len){
     int rc = mbedtls_ssl_read(&sslsock->ssl,mem,len);
     DEBUG(LVL0,"args %i %x %i => %i %x",s,mem,len,rc,rc);
     if (rc == MBEDTLS_ERR_SSL_TIMEOUT) rc=-ETIMEDOUT;
+    else if (rc == MBEDTLS_ERR_SSL_WANT_READ || rc == MBEDTLS_ERR_SSL_WANT_WRITE) rc=-EWOULDBLOCK;
     return rc;
 }
 
@@ -250,6 +329,7 @@ int zssl_send(int s, const void *dataptr, size_t size, int flags){
     SSLSock *sslsock = GET_SECURE_SOCKET(s);
     int rc = mbedtls_ssl_write(&sslsock->ssl,dataptr,size);
     DEBUG(LVL0,"args %i %x %i %i => %i %x",s,dataptr,size,flags,rc,rc);
+    if (rc == MBEDTLS_ERR_SSL_WANT_READ || rc == MBEDTLS_ERR_SSL_WANT_WRITE) rc=-EWOULDBLOCK;
     return rc;
 }
 
@@ -257,6 +337,7 @@ int zssl_write(int s, const void *dataptr, size_t size){
     SSLSock *sslsock = GET_SECURE_SOCKET(s);
     int rc = mbedtls_ssl_write(&sslsock->ssl,dataptr,size);
     DEBUG(LVL0,"args %i %x %i => %i %x",s,dataptr,size,rc,rc);
+    if (rc == MBEDTLS_ERR_SSL_WANT_READ || rc == MBEDTLS_ERR_SSL_WANT_WRITE) rc=-EWOULDBLOCK;
     return rc;
 }
 
@@ -4,6 +4,7 @@
 #include "zerynth_sockets.h"
 #include "zerynth.h" // last position since some defines might cause conflicts (ERR_OK with lwIP, opcodes)
 #include "zerynth_sockets_debug.h"
+#include "../drbg/zerynth_drbg.h"
 #pragma GCC diagnostic ignored "-Wpointer-sign"
 
 #if defined(ZERYNTH_SSL) && defined(ZERYNTH_SSL_MBEDTLS)
@@ -27,11 +28,296 @@ unsigned char _ssl_memory_buf[ZERYNTH_SSL_STATIC_MEMORY_BYTES];
 #endif //STATIC MEMORY
 
 
+static SSLSession _sslsessions[ZERYNTH_SSL_SESSION_CACHE_SIZE];
+static uint32_t _sslsessions_clock;
+static mbedtls_threading_mutex_t _sslsessions_mtx;
+
+void mbedtls_session_init(void){
+    mbedtls_mutex_init(&_sslsessions_mtx);
+}
+
+//FNV-1a of the DER of the certificates in chain, 0 for no chain
+static uint32_t mbedtls_session_chain_hash(const mbedtls_x509_crt* chain){
+    uint32_t h = 2166136261u;
+    size_t i;
+    if (!chain) return 0;
+    for (; chain && chain->raw.len; chain = chain->next) {
+        for (i=0;i<chain->raw.len;i++) h = (h^chain->raw.p[i])*16777619u;
+    }
+    return h;
+}
+
+//the cache key: hostname (or ip if not given), port, verify mode and CA chain hash.
+//The abbreviated handshake skips certificate checks, so a session made without checks or
+//with other CAs must never be resumed by a socket that would have rejected the server
+static int mbedtls_session_key(SSLSock* ssock, const struct sockaddr* name, uint8_t* key){
+    const struct sockaddr_in* addr = (const struct sockaddr_in*)name;
+    uint32_t ca;
+    int len;
+    if (ssock->hostname_len) {
+        len = ssock->hostname_len;
+        memcpy(key,ssock->hostname,len);
+    } else {
+        len = sizeof(addr->sin_addr.s_addr);
+        memcpy(key,&addr->sin_addr.s_addr,len);
+    }
+    memcpy(key+len,&addr->sin_port,2);
+    len+=2;
+    key[len++] = ssock->conf.authmode;
+    ca = (ssock->conf.authmode==MBEDTLS_SSL_VERIFY_NONE) ? 0:mbedtls_session_chain_hash(ssock->conf.ca_chain);
+    memcpy(key+len,&ca,4);
+    return len+4;
+}
+
+//must be called with _sslsessions_mtx locked
+static SSLSession* mbedtls_session_find(uint8_t* key, int keylen){
+    int i;
+    for (i=0;i<ZERYNTH_SSL_SESSION_CACHE_SIZE;i++){
+        if (_sslsessions[i].keylen==keylen && memcmp(_sslsessions[i].key,key,keylen)==0) {
+            _sslsessions[i].used = ++_sslsessions_clock;
+            return &_sslsessions[i];
+        }
+    }
+    return NULL;
+}
+
+static void mbedtls_session_drop(uint8_t* key, int keylen){
+    SSLSession* cs;
+    mbedtls_mutex_lock(&_sslsessions_mtx);
+    cs = mbedtls_session_find(key,keylen);
+    if (cs) {
+        mbedtls_ssl_session_free(&cs->session);
+        cs->keylen = 0;
+    }
+    mbedtls_mutex_unlock(&_sslsessions_mtx);
+}
+
+//saves the session just negotiated, replacing the one for the same key or the least recently used
+static void mbedtls_session_store(uint8_t* key, int keylen, mbedtls_ssl_context* ssl){
+    int i;
+    SSLSession* cs;
+    mbedtls_mutex_lock(&_sslsessions_mtx);
+    cs = mbedtls_session_find(key,keylen);
+    if (!cs) {
+        cs = &_sslsessions[0];
+        for (i=0;i<ZERYNTH_SSL_SESSION_CACHE_SIZE;i++){
+            if (!_sslsessions[i].keylen) {
+                cs = &_sslsessions[i];
+                break;
+            }
+            if (_sslsessions[i].used<cs->used) cs = &_sslsessions[i];
+        }
+    }
+    if (cs->keylen) mbedtls_ssl_session_free(&cs->session);
+    mbedtls_ssl_session_init(&cs->session);
+    if (mbedtls_ssl_get_session(ssl,&cs->session)==0) {
+        memcpy(cs->key,key,keylen);
+        cs->keylen = keylen;
+        cs->used = ++_sslsessions_clock;
+    } else {
+        mbedtls_ssl_session_free(&cs->session);
+        cs->keylen = 0;
+    }
+    mbedtls_mutex_unlock(&_sslsessions_mtx);
+}
+
+SSLCertStore _sslstores[ZERYNTH_SSL_CERTSTORES];
+static mbedtls_threading_mutex_t _sslstores_mtx;
+
+void mbedtls_certstore_init(void){
+    mbedtls_mutex_init(&_sslstores_mtx);
+}
+
+//returns the id of a new empty store, referenced by its CertStore, or -1 if all are taken
+int mbedtls_certstore_new(void){
+    int i, id = -1;
+    mbedtls_mutex_lock(&_sslstores_mtx);
+    for (i=0;i<ZERYNTH_SSL_CERTSTORES;i++){
+        if (!_sslstores[i].refs) {
+            mbedtls_x509_crt_init(&_sslstores[i].chain);
+            _sslstores[i].refs = 1;
+            _sslstores[i].certs = 0;
+            id = i;
+            break;
+        }
+    }
+    mbedtls_mutex_unlock(&_sslstores_mtx);
+    return id;
+}
+
+/*
+ * parses the PEM (null terminated) or DER certificates in buf into the chain of store id.
+ * Returns the number of certificates in the store, SSL_CERTSTORE_BUSY if sockets are using it,
+ * or a negative mbedtls error if not all could be parsed
+ */
+int mbedtls_certstore_add(int id, const uint8_t* buf, uint32_t len){
+    SSLCertStore* st;
+    mbedtls_x509_crt* crt;
+    int err, n = 0;
+    if (id<0 || id>=ZERYNTH_SSL_CERTSTORES) return MBEDTLS_ERR_X509_BAD_INPUT_DATA;
+    st = &_sslstores[id];
+    mbedtls_mutex_lock(&_sslstores_mtx);
+    if (st->refs!=1) {
+        //freed, or walked by sockets while handshaking
+        mbedtls_mutex_unlock(&_sslstores_mtx);
+        return (st->refs) ? SSL_CERTSTORE_BUSY:MBEDTLS_ERR_X509_BAD_INPUT_DATA;
+    }
+    err = mbedtls_x509_crt_parse(&st->chain,buf,len);
+    for (crt=&st->chain;crt && crt->raw.len;crt=crt->next) n++;
+    st->certs = n;
+    mbedtls_mutex_unlock(&_sslstores_mtx);
+    if (err<0) return err;
+    return n;
+}
+
+//a socket starts using store id: its chain stays valid until the matching release
+mbedtls_x509_crt* mbedtls_certstore_acquire(int id){
+    mbedtls_x509_crt* chain = NULL;
+    if (id<0 || id>=ZERYNTH_SSL_CERTSTORES) return NULL;
+    mbedtls_mutex_lock(&_sslstores_mtx);
+    if (_sslstores[id].refs) {
+        _sslstores[id].refs++;
+        chain = &_sslstores[id].chain;
+    }
+    mbedtls_mutex_unlock(&_sslstores_mtx);
+    return chain;
+}
+
+//drops a reference: the chain is freed with the last one
+void mbedtls_certstore_release(int id){
+    if (id<0 || id>=ZERYNTH_SSL_CERTSTORES) return;
+    mbedtls_mutex_lock(&_sslstores_mtx);
+    if (_sslstores[id].refs && !--_sslstores[id].refs) {
+        mbedtls_x509_crt_free(&_sslstores[id].chain);
+        _sslstores[id].certs = 0;
+    }
+    mbedtls_mutex_unlock(&_sslstores_mtx);
+}
+
+int mbedtls_certstore_info(int id, int* certs, int* refs){
+    if (id<0 || id>=ZERYNTH_SSL_CERTSTORES) return -1;
+    mbedtls_mutex_lock(&_sslstores_mtx);
+    *certs = _sslstores[id].certs;
+    *refs = _sslstores[id].refs;
+    mbedtls_mutex_unlock(&_sslstores_mtx);
+    return 0;
+}
+
+#if defined(ZERYNTH_SSL_ECDHE_POOL)
+/*
+ * ECDHE key pairs: the key generation takes about half of a client handshake, so a lowest priority thread
+ * keeps ZERYNTH_SSL_ECDHE_POOL P-256 pairs ready while the device is idle. Each pair is used for one handshake only.
+ */
+static SSLEcdheKey _sslecdhe[ZERYNTH_SSL_ECDHE_POOL];
+static volatile int _sslecdhe_ready;
+static uint32_t _sslecdhe_taken;
+static uint32_t _sslecdhe_misses;
+static VSemaphore _sslecdhe_sem;
+static mbedtls_threading_mutex_t _sslecdhe_mtx;
+
+//as mbedtls_zeroize, not optimized away
+static void mbedtls_ecdhe_zeroize(void* v, size_t n){
+    volatile unsigned char* p = v;
+    while (n--) *p++ = 0;
+}
+
+static int mbedtls_ecdhe_rng(void* ctx, unsigned char* out, size_t len){
+    zdrbg_fill(out,len);
+    return 0;
+}
+
+static void mbedtls_ecdhe_pool_loop(void* arg){
+    mbedtls_ecp_group grp;
+    mbedtls_mpi d;
+    mbedtls_ecp_point Q;
+    SSLEcdheKey key;
+    int err;
+
+    mbedtls_ecp_group_init(&grp);
+    mbedtls_ecp_group_load(&grp, MBEDTLS_ECP_DP_SECP256R1);
+    while (1) {
+        if (_sslecdhe_ready>=ZERYNTH_SSL_ECDHE_POOL) {
+            //full: wait for a handshake to take a pair
+            vosSemWait(_sslecdhe_sem);
+            continue;
+        }
+        mbedtls_mpi_init(&d);
+        mbedtls_ecp_point_init(&Q);
+        err = mbedtls_ecp_gen_keypair(&grp, &d, &Q, mbedtls_ecdhe_rng, NULL);
+        if (!err) err = mbedtls_mpi_write_binary(&d, key.d, 32);
+        if (!err) err = mbedtls_mpi_write_binary(&Q.X, key.q, 32);
+        if (!err) err = mbedtls_mpi_write_binary(&Q.Y, key.q+32, 32);
+        mbedtls_mpi_free(&d);
+        mbedtls_ecp_point_free(&Q);
+        if (err) {
+            //out of memory, probably: retry later
+            vosThSleep(TIME_U(1000,MILLIS));
+            continue;
+        }
+        mbedtls_mutex_lock(&_sslecdhe_mtx);
+        if (_sslecdhe_ready<ZERYNTH_SSL_ECDHE_POOL) {
+            __memcpy(&_sslecdhe[_sslecdhe_ready],&key,sizeof(key));
+            _sslecdhe_ready++;
+        }
+        mbedtls_mutex_unlock(&_sslecdhe_mtx);
+        mbedtls_ecdhe_zeroize(&key,sizeof(key));
+    }
+}
+
+void mbedtls_ecdhe_pool_init(void){
+    VThread th;
+    mbedtls_mutex_init(&_sslecdhe_mtx);
+    _sslecdhe_sem = vosSemCreate(0);
+    th = vosThCreate(ZERYNTH_SSL_ECDHE_POOL_STACK, VOS_PRIO_LOWEST, mbedtls_ecdhe_pool_loop, NULL, NULL);
+    vosThResume(th);
+}
+
+/*
+ * called by mbedtls_ecdh_gen_public: moves a precomputed pair into d and Q if grp is P-256 and one is ready.
+ * Returns 0 on success, -1 if the key pair must be generated now
+ */
+int mbedtls_ecdhe_pool_take(mbedtls_ecp_group* grp, mbedtls_mpi* d, mbedtls_ecp_point* Q){
+    SSLEcdheKey key;
+    int err;
+    if (grp->id!=MBEDTLS_ECP_DP_SECP256R1) return -1;
+    mbedtls_mutex_lock(&_sslecdhe_mtx);
+    if (!_sslecdhe_ready) {
+        _sslecdhe_misses++;
+        mbedtls_mutex_unlock(&_sslecdhe_mtx);
+        return -1;
+    }
+    _sslecdhe_ready--;
+    __memcpy(&key,&_sslecdhe[_sslecdhe_ready],sizeof(key));
+    mbedtls_ecdhe_zeroize(&_sslecdhe[_sslecdhe_ready],sizeof(key));
+    _sslecdhe_taken++;
+    mbedtls_mutex_unlock(&_sslecdhe_mtx);
+    vosSemSignalCap(_sslecdhe_sem,1);
+
+    err = mbedtls_mpi_read_binary(d, key.d, 32);
+    if (!err) err = mbedtls_mpi_read_binary(&Q->X, key.q, 32);
+    if (!err) err = mbedtls_mpi_read_binary(&Q->Y, key.q+32, 32);
+    if (!err) err = mbedtls_mpi_lset(&Q->Z, 1);
+    mbedtls_ecdhe_zeroize(&key,sizeof(key));
+    return (err) ? -1:0;
+}
+
+void mbedtls_ecdhe_pool_stats(int* ready, uint32_t* taken, uint32_t* misses){
+    mbedtls_mutex_lock(&_sslecdhe_mtx);
+    *ready = _sslecdhe_ready;
+    *taken = _sslecdhe_taken;
+    *misses = _sslecdhe_misses;
+    mbedtls_mutex_unlock(&_sslecdhe_mtx);
+}
+#endif
+
 int mbedtls_full_connect(SSLSock* ssock, const struct sockaddr* name, socklen_t namelen)
 {
     int ret = MBEDTLS_ERR_NET_UNKNOWN_HOST;
     int tt =0;
     mbedtls_net_context* ctx = &ssock->ctx;
+    uint8_t key[SSL_SESSION_KEY_LEN];
+    int keylen = 0;
+    SSLSession* cs;
 
     if ((tt=zsock_connect(ctx->fd, name, namelen)) != 0) {
         ERROR("creating socket %i => %i",ctx->fd,tt);
@@ -43,9 +329,21 @@ int mbedtls_full_connect(SSLSock* ssock, const struct sockaddr* name, socklen_t
 
     mbedtls_ssl_set_bio(&ssock->ssl, ctx, mbedtls_net_send, mbedtls_net_recv, mbedtls_net_recv_timeout);
 
+    if (ssock->resume) {
+        //offer the last session with this server: an abbreviated handshake skips key exchange and certificate checks
+        keylen = mbedtls_session_key(ssock,name,key);
+        mbedtls_mutex_lock(&_sslsessions_mtx);
+        cs = mbedtls_session_find(key,keylen);
+        if (cs && mbedtls_ssl_set_session(&ssock->ssl,&cs->session)==0) {
+            DEBUG(LVL0,"Resuming TLS session","");
+        }
+        mbedtls_mutex_unlock(&_sslsessions_mtx);
+    }
+
     while ((ret = mbedtls_ssl_handshake(&ssock->ssl)) != 0) {
         if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
             ERROR("in SSL handshake %i %x",ret,ret);
+            if (keylen) mbedtls_session_drop(key,keylen);
             UNSET_SECURE_SOCKET(ctx->fd);
             mbedtls_ssl_session_reset(&ssock->ssl);
             mbedtls_net_free(ctx);
@@ -54,8 +352,32 @@ int mbedtls_full_connect(SSLSock* ssock, const struct sockaddr* name, socklen_t
         }
     }
 
+    //keep the (possibly new) session and ticket for the next connection
+    if (keylen) mbedtls_session_store(key,keylen,&ssock->ssl);
+
+    return 0;
+}
+
+#if defined(MBEDTLS_SSL_PROTO_DTLS)
+//timer of the DTLS handshake retransmissions, on the millisecond clock of the VM
+void mbedtls_dtls_timer_set(void* data, uint32_t int_ms, uint32_t fin_ms){
+    SSLSock* ssock = (SSLSock*)data;
+    ssock->dtls_int = int_ms;
+    ssock->dtls_fin = fin_ms;
+    if (fin_ms) ssock->dtls_start = (uint32_t)vosMillis();
+}
+
+//-1 if stopped, 0 before the intermediate delay, 1 before the final one, 2 after it
+int mbedtls_dtls_timer_get(void* data){
+    SSLSock* ssock = (SSLSock*)data;
+    uint32_t elapsed;
+    if (!ssock->dtls_fin) return -1;
+    elapsed = (uint32_t)vosMillis() - ssock->dtls_start;
+    if (elapsed >= ssock->dtls_fin) return 2;
+    if (elapsed >= ssock->dtls_int) return 1;
     return 0;
 }
+#endif
 
 #if !defined(ZERYNTH_SSL_EXTERNAL_STACK)
 
@@ -82,27 +404,72 @@ int mbedtls_mutex_unlock_alt( mbedtls_threading_mutex_t *mutex ){
 #else
 #define SSL_BUFFERS_NUM (2*MAX_SSLSOCKS)
 #endif
-typedef struct _sslbuf {
-    uint8_t buffer[MBEDTLS_SSL_BUFFER_LEN];
-    uint8_t taken;
-} SSLBuffer;
-SSLBuffer _sslbuffers[SSL_BUFFERS_NUM];
+
+//blocks are kept 8 bytes aligned
+#define SSL_POOL_ROUND(x) (((x)+7)&~7)
+#define SSL_POOL_ARENA(size,num) (SSL_POOL_ROUND(size)*((num) ? (num):1))
+
+static uint8_t _sslpool_arena0[SSL_POOL_ARENA(ZERYNTH_SSL_POOL_CLASS0_SIZE,ZERYNTH_SSL_POOL_CLASS0_NUM)] __attribute__((aligned(8)));
+static uint8_t _sslpool_arena1[SSL_POOL_ARENA(ZERYNTH_SSL_POOL_CLASS1_SIZE,ZERYNTH_SSL_POOL_CLASS1_NUM)] __attribute__((aligned(8)));
+static uint8_t _sslpool_arena2[SSL_POOL_ARENA(ZERYNTH_SSL_POOL_CLASS2_SIZE,ZERYNTH_SSL_POOL_CLASS2_NUM)] __attribute__((aligned(8)));
+static uint8_t _sslpool_arena3[SSL_POOL_ARENA(MBEDTLS_SSL_BUFFER_LEN,SSL_BUFFERS_NUM)] __attribute__((aligned(8)));
+SSLPool _sslpools[SSL_POOL_CLASSES];
+static mbedtls_threading_mutex_t _sslpools_mtx;
+
+static void mbedtls_pool_class(SSLPool* pool, uint8_t* arena, uint32_t size, uint32_t num){
+    uint32_t i;
+    pool->size = SSL_POOL_ROUND(size);
+    pool->num = num;
+    pool->start = arena;
+    pool->end = arena+pool->size*num;
+    pool->free = NULL;
+    //thread the free list through the blocks
+    for (i=num;i>0;i--){
+        void** blk = (void**)(arena+pool->size*(i-1));
+        *blk = pool->free;
+        pool->free = blk;
+    }
+}
+
+void mbedtls_pool_init(void){
+    mbedtls_pool_class(&_sslpools[0],_sslpool_arena0,ZERYNTH_SSL_POOL_CLASS0_SIZE,ZERYNTH_SSL_POOL_CLASS0_NUM);
+    mbedtls_pool_class(&_sslpools[1],_sslpool_arena1,ZERYNTH_SSL_POOL_CLASS1_SIZE,ZERYNTH_SSL_POOL_CLASS1_NUM);
+    mbedtls_pool_class(&_sslpools[2],_sslpool_arena2,ZERYNTH_SSL_POOL_CLASS2_SIZE,ZERYNTH_SSL_POOL_CLASS2_NUM);
+    mbedtls_pool_class(&_sslpools[3],_sslpool_arena3,MBEDTLS_SSL_BUFFER_LEN,SSL_BUFFERS_NUM);
+    mbedtls_mutex_init(&_sslpools_mtx);
+}
 #endif
 
 void * mbedtls_gc_calloc( size_t n, size_t m){
 #if defined(ZERYNTH_SSL_STATIC_BUFFERS)
-    if((n*m)==MBEDTLS_SSL_BUFFER_LEN) {
-        int i;
-        for (i=0;i<SSL_BUFFERS_NUM;i++){
-            if(!_sslbuffers[i].taken) {
-                //it's free
-                _sslbuffers[i].taken=1;
-                memset(_sslbuffers[i].buffer,0,MBEDTLS_SSL_BUFFER_LEN);
-                return _sslbuffers[i].buffer;
-            }
+    size_t sz = n*m;
+    int i;
+    void** blk = NULL;
+    SSLPool* pool = NULL;
+    mbedtls_mutex_lock(&_sslpools_mtx);
+    //smallest class that fits, or the next one if it is exhausted
+    for (i=0;i<SSL_POOL_CLASSES;i++){
+        if (sz>_sslpools[i].size || !_sslpools[i].num) continue;
+        //record buffers are reserved to records
+        if (i==SSL_POOL_CLASSES-1 && sz!=MBEDTLS_SSL_BUFFER_LEN) continue;
+        if (_sslpools[i].free) {
+            blk = _sslpools[i].free;
+            _sslpools[i].free = *blk;
+            _sslpools[i].used++;
+            if (_sslpools[i].used>_sslpools[i].high) _sslpools[i].high = _sslpools[i].used;
+            break;
         }
-        return NULL;
+        if (pool) break;
+        pool = &_sslpools[i];
     }
+    if (!blk && pool) pool->fallbacks++;
+    mbedtls_mutex_unlock(&_sslpools_mtx);
+    if (blk) {
+        memset(blk,0,sz);
+        return blk;
+    }
+    //record buffers are never taken from the heap: without a free one the handshake fails
+    if (sz==MBEDTLS_SSL_BUFFER_LEN) return NULL;
 #endif
     uint8_t *res = gc_malloc(n*m);
     return res;
@@ -111,11 +478,14 @@ void * mbedtls_gc_calloc( size_t n, size_t m){
 void mbedtls_gc_free( void *pnt){
     if (pnt) {
 #if defined(ZERYNTH_SSL_STATIC_BUFFERS)
-        //TODO: remove for, use mem comparison  pnt>=_sslbuffers && pnt<_sslbuffer+sizeof()
         int i;
-        for (i=0;i<SSL_BUFFERS_NUM;i++){
-            if (pnt==(void*)_sslbuffers[i].buffer && _sslbuffers[i].taken==1) {
-                _sslbuffers[i].taken=0;
+        for (i=0;i<SSL_POOL_CLASSES;i++){
+            if ((uint8_t*)pnt>=_sslpools[i].start && (uint8_t*)pnt<_sslpools[i].end) {
+                mbedtls_mutex_lock(&_sslpools_mtx);
+                *(void**)pnt = _sslpools[i].free;
+                _sslpools[i].free = pnt;
+                _sslpools[i].used--;
+                mbedtls_mutex_unlock(&_sslpools_mtx);
                 return;
             }
         }
@@ -127,23 +497,61 @@ void mbedtls_gc_free( void *pnt){
 
 int mbedtls_hardware_poll( void *data, unsigned char *output, size_t len, size_t *olen )
 {
-    (void) data;
-    (void) output;
-    (void) len;
-    (void) olen;
-    /* Fill output buffer */
-    for (uint32_t i = 0, tmp_rnd = 0; i < len; i++)
-    {
-        /* Get 4B random number */
-        if ((i & 0x3) == 0)
-            tmp_rnd = vhalRngGenerate();
-        output[i] = ((uint8_t*)&tmp_rnd)[i & 0x3];
-    }
-    *olen = len;
-    return 0;
+    //the system DRBG, seeded from the hardware RNG, does not wait for hardware entropy
+    return zdrbg_poll(data, output, len, olen);
+}
 
+
+/*
+ * Cipher suites: preference order of a socket
+ */
+
+//lower ranks first: with an AES-GCM engine prefer GCM, in software prefer 128 bit keys (10 AES rounds instead of 14)
+static int mbedtls_ciphersuite_rank(int id, int hwgcm){
+    const mbedtls_ssl_ciphersuite_t* cs = mbedtls_ssl_ciphersuite_from_id(id);
+    const mbedtls_cipher_info_t* ci = (cs) ? mbedtls_cipher_info_from_type(cs->cipher):NULL;
+    if (!ci) return 2;
+    if (hwgcm) return (ci->mode==MBEDTLS_MODE_GCM) ? 0:1;
+    return (ci->key_bitlen<=128) ? 0:1;
 }
 
+int mbedtls_ciphersuites_setup(SSLSock* ssock, SSLInfo* sinfo){
+    int i, j, n = 0, id, rank;
+    int hwgcm = 0;
+    const int* suites;
+
+    if (sinfo->ciphersuites_len) {
+        //given by the user: keep the compiled in ones, in the same order
+        for (i = 0; i+1 < sinfo->ciphersuites_len && n < ZERYNTH_SSL_MAX_CIPHERSUITES; i+=2) {
+            id = (sinfo->ciphersuites[i]<<8)|sinfo->ciphersuites[i+1];
+            if (mbedtls_ssl_ciphersuite_from_id(id))
+                ssock->ciphersuites[n++] = id;
+        }
+        if (!n) {
+            ERROR("No supported cipher suite","");
+            return -1;
+        }
+    } else if (sinfo->options&_CIPHERS_AUTO) {
+#if defined(ZERYNTH_HWCRYPTO_ENABLE_AES_GCM)
+        hwgcm = ZERYNTH_HWCRYPTO_ACCEL() && ZERYNTH_HWCRYPTO_ACCEL()->aes_gcm_crypt;
+#endif
+        //stable insertion by rank of the default list
+        suites = mbedtls_ssl_list_ciphersuites();
+        for (i = 0; suites[i] && n < ZERYNTH_SSL_MAX_CIPHERSUITES; i++) {
+            rank = mbedtls_ciphersuite_rank(suites[i],hwgcm);
+            for (j = n; j > 0 && mbedtls_ciphersuite_rank(ssock->ciphersuites[j-1],hwgcm) > rank; j--)
+                ssock->ciphersuites[j] = ssock->ciphersuites[j-1];
+            ssock->ciphersuites[j] = suites[i];
+            n++;
+        }
+    } else {
+        //mbedtls defaults
+        return 0;
+    }
+    ssock->ciphersuites[n] = 0;
+    mbedtls_ssl_conf_ciphersuites(&ssock->conf, ssock->ciphersuites);
+    return 0;
+}
 
 int mbedtls_full_close(SSLSock* ssock){
 
@@ -162,6 +570,10 @@ void mbedtls_uninit(SSLSock* ssock){
         mbedtls_ssl_config_free(&ssock->conf);
         mbedtls_ctr_drbg_free(&ssock->ctr_drbg);
         mbedtls_x509_crt_free(&ssock->cacert);
+        if (ssock->castore) {
+            mbedtls_certstore_release(ssock->castore-1);
+            ssock->castore = 0;
+        }
         mbedtls_x509_crt_free(&ssock->clicert);
         mbedtls_pk_free(&ssock->pkey);
         mbedtls_ssl_free(&ssock->ssl);
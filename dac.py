@@ -48,6 +48,19 @@ def _vbl_dac_init():
     pass
 
 
+@native_c("_dac_stream_start",["csrc/vbl/vbl_dac.c"],["VHAL_DAC"])
+def _dac_stream_start(pin,buf,timestep,timeunit):
+    pass
+
+@native_c("_dac_stream_push",["csrc/vbl/vbl_dac.c"],["VHAL_DAC"])
+def _dac_stream_push(state,data):
+    pass
+
+@native_c("_dac_stream_stop",["csrc/vbl/vbl_dac.c"],["VHAL_DAC"])
+def _dac_stream_stop(state):
+    pass
+
+
 _vbl_dac_init();
 _dacdrv = __driver(DAC0)
 
@@ -66,6 +79,8 @@ The DAC class
         self.drv = _dacdrv
         self.pin = pin
         self._buffer = None
+        self._stream = None
+        self.lost = 0
         # self.drvid = drvname&0xff
 
     def start(self):
@@ -108,6 +123,38 @@ The DAC class
         self.drv.__ctl__(_DACDRIVER_WRITE,self._buffer,timestep,timeunit,circular,self.pin)
 
 
+    def stream(self, size, timestep, timeunit=MICROS, data=None):
+        """
+.. method:: stream(size, timestep, timeunit=MICROS, data=None)
+
+        Start playing a continuous signal, one sample every *timestep* *timeunit*\ econds, from a circular buffer of *size* samples
+        (an even number). The buffer starts with *data* if given, else with zeros, and is refilled one half at a time with :meth:`push`
+        while the other half plays, so the output has no gaps: ::
+
+            my_dac.stream(512,20)       # 50 kHz
+            while True:
+                my_dac.push(synthesize(256))
+
+        The position in the buffer is followed on the system clock: like the dac timer, it derives from the main oscillator.
+
+        """
+        self._buffer = shortarray(size) if data is None else shortarray(data)
+        self.lost = 0
+        self._stream = _dac_stream_start(self.pin,self._buffer,timestep,timeunit)
+
+    def push(self, data):
+        """
+.. method:: push(data)
+
+        Queue *data*, a :class:`shortarray` or :class:`shorts` of half the :meth:`stream` size, to be played after the samples already queued.
+        Wait (without blocking other threads) until the half of the buffer it goes into has been played.
+
+        If *push* comes too late, the late halves play old samples again: their number is added to :attr:`lost` and
+        *data* is played as soon as possible.
+
+        """
+        self.lost+=_dac_stream_push(self._stream,data)
+
     def stop(self):
         """
 .. method:: stop()
@@ -115,6 +162,9 @@ The DAC class
         dac is stopped and low level configuration disabled.
 
         """
+        if self._stream is not None:
+            _dac_stream_stop(self._stream)
+            self._stream = None
         self.drv.__ctl__(_DACDRIVER_STOP,self.pin)
 
     def lock(self):
@@ -470,6 +470,13 @@ Constructors
    where ``*`` can match any single character.
 
 
+.. function:: fromtimestamp(t, tz=None)
+
+   Return the :class:`datetime` corresponding to the POSIX timestamp *t*
+   (seconds from 1970-01-01 00:00:00 UTC), converted to the timezone *tz*,
+   or naive and in UTC if *tz* is ``None``.
+
+
 .. function:: fromordinal(n)
 
    Return the :class:`datetime` corresponding to the proleptic Gregorian
@@ -601,6 +608,21 @@ Class methods
    ``YYYY-MM-DDTHH:MM:SS+HH:MM``.
 
 
+.. method:: strftime(fmt)
+
+   Return a string representing the date and time, controlled by the format
+   string *fmt*, as ``time.strftime`` does with the C locale. The supported
+   directives are ``%a %A %b %B %d %e %F %H %I %j %m %M %p %S %T %u %w %y
+   %Y %z %Z %%``, any other is copied as it is. ``%z`` and ``%Z`` are empty
+   for naive objects.
+
+
+.. method:: timestamp()
+
+   Return the POSIX timestamp of the datetime: the seconds from 1970-01-01
+   00:00:00 UTC. Naive objects are taken as UTC.
+
+
 .. method:: date()
 
    Return a :class:`datetime` instance whose date and time zone components
@@ -647,48 +669,49 @@ Examples of working with :class:`datetime` objects::
 
 """
 
-# The following functions were (stolen and) adapted from Python's datetime.
+@native_c("_dt_ord",["csrc/datetime/datetime.c"])
+def _dt_ord(year,month,day,hour,minute,second):
+    pass
+
+@native_c("_dt_split",["csrc/datetime/datetime.c"])
+def _dt_split(ordinal,seconds):
+    pass
+
+@native_c("_dt_add",["csrc/datetime/datetime.c"])
+def _dt_add(ordinal,seconds,delta):
+    pass
+
+@native_c("_dt_isoformat",["csrc/datetime/datetime.c"])
+def _dt_isoformat(ordinal,seconds,sep,offset):
+    pass
+
+@native_c("_dt_fromisoformat",["csrc/datetime/datetime.c"])
+def _dt_fromisoformat(s):
+    pass
+
+@native_c("_dt_strftime",["csrc/datetime/datetime.c"])
+def _dt_strftime(fmt,ordinal,seconds,offset,tzname):
+    pass
+
+# ordinal of 1970-01-01
+_EPOCH_ORD = 719163
+
 def _is_leap(year):
     return year % 4 == 0 and (year % 100 != 0 or year % 400 == 0)
 
-def _days_before_year(year):
-    # year -> number of days before January 1st of year.
-    y = year - 1
-    return y*365 + y//4 - y//100 + y//400
-
 def _days_in_month(year, month):
     # year, month -> number of days in that month in that year.
     if month == 2 and _is_leap(year):
         return 29
     return (0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31)[month]
 
-def _days_before_month(year, month):
-    # year, month -> number of days in year preceding first day of month.
-    return (0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334)[month]\
-         + (month > 2 and _is_leap(year))
-
 def _ymd2ord(year, month, day):
     # year, month, day -> ordinal, considering 01-Jan-0001 as day 1.
-    return _days_before_year(year) + _days_before_month(year, month) + day
+    return _dt_ord(year, month, day, 0, 0, 0)
 
 def _ord2ymd(n):
     # ordinal -> (year, month, day), considering 01-Jan-0001 as day 1.
-    n -= 1
-    n400, n = divmod(n, 146097)
-    year = n400 * 400 + 1
-    n100, n = divmod(n, 36524)
-    n4, n = divmod(n, 1461)
-    n1, n = divmod(n, 365)
-    year += n100 * 100 + n4 * 4 + n1
-    if n1 == 4 or n100 == 4:
-        return year-1, 12, 31
-    month = (n + 50) >> 5
-    preceding = _days_before_month(year, month)
-    if preceding > n:
-        month -= 1
-        preceding -= _days_in_month(year, month)
-    n -= preceding
-    return year, month, n+1
+    return _dt_split(n, 0)[:3]
 
 
 class timedelta:
@@ -821,39 +844,14 @@ class datetime:
     def __init__(self, year, month, day, hour=0, minute=0, second=0, tzinfo=None):
         if year == 0 and month == 0 and day > 0:
             self._ord = day
-        elif self.MINYEAR <= year <= self.MAXYEAR\
-        and  1 <= month  <= 12\
-        and  1 <= day    <= _days_in_month(year, month)\
-        and  0 <= hour   <  24\
-        and  0 <= minute <  60\
-        and  0 <= second <  60:
-            self._ord = _ymd2ord(year, month, day)
         else:
-            raise ValueError
+            self._ord = _dt_ord(year, month, day, hour, minute, second)
         self._time = timedelta(hour, minute, second)
         self._tz = tzinfo
 
     def add(self, other):
-        time = self._time.add(other)
-        sign, days, hour, minute, second = time.tuple()
-        if sign == '-':
-            days -= 1
-            time = time.add(timedelta(days=-days))
-        year, month, day, hour, minute, second, tz\
-                = self._tuple(self._ord, time, self._tz)[:7]
-        day += days
-        if day > _days_in_month(year, month):
-          day = 1
-          month += 1
-          if month > 12:
-            month = 1
-            year +=1
-        elif day < 1:
-          month -= 1
-          if month < 1:
-            year -= 1
-          day = _days_in_month(year, month)
-        return datetime(year, month, day, hour, minute, second, tz)
+        ordinal, secs = _dt_add(self._ord, self._time._s, other._s)
+        return datetime(0, 0, ordinal, 0, 0, secs, self._tz)
 
     def sub(self, other):
         if isinstance(other, timedelta):
@@ -926,10 +924,15 @@ class datetime:
         return self.isoformat()[11:19]
 
     def isoformat(self, sep='T'):
-        dt = ('%04d-%02d-%02d'+sep+'%02d:%02d:%02d') % self.tuple()[:6]
-        if self._tz == None:
-            return dt
-        return dt + self._tz.isoformat(self, utc=False)
+        return _dt_isoformat(self._ord, self._time._s, sep, self._offset())
+
+    def strftime(self, fmt):
+        return _dt_strftime(fmt, self._ord, self._time._s, self._offset(), self.tzname())
+
+    def timestamp(self):
+        ts = (self._ord - _EPOCH_ORD) * 86400 + self._time._s
+        off = self._offset()
+        return ts if off is None else ts - off
 
     def toordinal(self):
         return self._ord
@@ -938,7 +941,13 @@ class datetime:
         return self._ord % 7 or 7
 
     def tuple(self):
-        return self._tuple(self._ord, self._time, self._tz)[:-2]
+        return _dt_split(self._ord, self._time._s) + (self._tz,)
+
+    def _offset(self):
+        # utc offset in seconds, None for naive objects
+        if self._tz is None:
+            return None
+        return self._tz.utcoffset(self).total_seconds()
 
     def _sub(self, other):
         # Subtract two datetime instances.
@@ -968,85 +977,17 @@ class datetime:
 
         return 0
 
-    def _tuple(self, ordinal, time, tz):
-        # Split a datetime to its components.
-        year, month, day = _ord2ymd(ordinal)
-        sign, days, hour, minute, second = time.tuple()
-        return year, month, day, hour, minute, second, tz, days, sign
-
 def fromisoformat(s):
-    l = len(s)
-    if l < 10 or s[4] != '-' or s[7] != '-':
-        raise ValueError
-    # parse date
-    year = int(s[0:4])
-    month = int(s[5:7])
-    day = int(s[8:10])
-    hour = 0
-    minute = 0
-    second = 0
-    microsecond = 0
-    tz_sign = ''
-    tz_hour = 0
-    tz_minute = 0
-    tz_second = 0
-    tz_microsecond = 0
-    i = 10
-    if l > i and s[i] != '+':
-        # parse time
-        if l - i < 3:
-            raise ValueError
-        i += 3
-        hour = int(s[i-2:i])
-        if l > i and s[i] == ':':
-            i += 3
-            if l - i < 0:
-                raise ValueError
-            minute = int(s[i-2:i])
-            if l > i and s[i] == ':':
-                i += 3
-                if l - i < 0:
-                    raise ValueError
-                second = int(s[i-2:i])
-                if l > i and s[i] == '.':
-                    i += 4
-                    if l - i < 0:
-                        raise ValueError
-                    microsecond = 1000*int(s[i-3:i])
-                    if l > i and s[i] != '+':
-                        i += 3
-                        if l - i < 0:
-                            raise ValueError
-                        microsecond += int(s[i-3:i])
-    if l > i:
-        if s[i] not in '+-':
-            raise ValueError
-        tz_sign = s[i]
-        i += 6
-        if l - i < 0:
-            raise ValueError
-        tz_hour = int(s[i-5:i-3])
-        tz_minute = int(s[i-2:i])
-        if l > i and s[i] == ':':
-            i += 3
-            if l - i < 0:
-                raise ValueError
-            tz_second = int(s[i-2:i])
-            if l > i and s[i] == '.':
-                i += 7
-                if l - i < 0:
-                    raise ValueError
-                tz_microsecond = int(s[i-6:i])
-    if l != i:
-        raise ValueError
-    if tz_sign:
-        td = timedelta(tz_hour, tz_minute, tz_second)
-        if tz_sign == '-':
-            td = td.neg()
-        tz = timezone(td)
-    else:
-        tz = None
-    return datetime(year, month, day, hour, minute, second, tz)
+    ordinal, secs, off = _dt_fromisoformat(s)
+    tz = None if off is None else timezone(timedelta(seconds=off))
+    return datetime(0, 0, ordinal, 0, 0, secs, tz)
+
+def fromtimestamp(t, tz=None):
+    t = int(t)
+    if tz is not None:
+        t += tz.utcoffset(None).total_seconds()
+    ordinal, secs = _dt_add(_EPOCH_ORD, 0, t)
+    return datetime(0, 0, ordinal, 0, 0, secs, tz)
 
 def fromordinal(n):
     if not 1 <= n <= 3652059:
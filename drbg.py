@@ -0,0 +1,57 @@
+"""
+.. module:: drbg
+
+***********************
+System Random Generator
+***********************
+
+This module gives access to the system random generator, a Hash_DRBG (NIST SP 800-90A, based on SHA-256) seeded from
+the hardware random number generator of the board. The same generator is used by TLS, by :mod:`x509` and by the key
+generation functions of :mod:`crypto.ecc`: the hardware generator, slow on many microcontrollers, is read only a word
+at a time while the DRBG output is consumed, and the DRBG is reseeded every 256 bits collected.
+
+Its output is suitable for keys, nonces and tokens, given a hardware random number generator of cryptographic quality.
+
+    """
+
+@native_c("zdrbg_urandom",[
+    "csrc/drbg/*",
+    "#crypto/hash/csrc/cifra/src/drbg.c",
+    "#crypto/hash/csrc/cifra/src/sha256.c",
+    "#crypto/hash/csrc/cifra/src/hmac.c",
+    "#crypto/hash/csrc/cifra/src/chash.c",
+    "#crypto/hash/csrc/cifra/src/blockwise.c",
+    ],[],["-I#crypto/hash/csrc/cifra/src/ext"])
+def urandom(n):
+    """
+.. function:: urandom(n)
+
+    Return a bytes object of *n* random bytes.
+
+    """
+    pass
+
+@native_c("zdrbg_reseed_now",["csrc/drbg/*"])
+def reseed():
+    """
+.. function:: reseed()
+
+    Reseed the generator with 256 fresh bits from the hardware random number generator, waiting for them. It is never
+    required, since reseeding happens continuously, but can be called after events that should not be predictable from
+    the previous state, for example after waking up from deep sleep.
+
+    """
+    pass
+
+def randint(a,b):
+    """
+.. function:: randint(a,b)
+
+    Return a random integer in the range [a,b], with *b - a* less than 2^30.
+
+    """
+    n = b-a+1
+    if n<=0:
+        raise ValueError
+    rb = urandom(4)
+    return a+(((rb[0]&0x3f)<<24)|(rb[1]<<16)|(rb[2]<<8)|rb[3])%n
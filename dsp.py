@@ -0,0 +1,170 @@
+"""
+.. module:: dsp
+
+**********************
+Digital Signal Process
+**********************
+
+This module implements fixed point signal processing kernels that run natively over buffers of samples, in place, without
+allocating memory.
+
+Buffers are :class:`shortarray` of signed 16 bits samples, or :class:`bytearray` read as 16 bits samples in native byte order:
+the buffers filled by :func:`adc.read_into` and :meth:`adc.Stream.read_into` can be processed as they are. Adc values up to 15 bits
+are positive samples; subtract the offset (for example with :func:`fir` or :func:`biquad` highpass filters) as needed.
+Since shortarray items are unsigned in Python, a negative sample *v* is stored as ``v&0xffff`` and read back with :func:`signed`.
+
+Filter coefficients are fixed point integers: FIR taps are Q15 (32767 is about 1.0), biquad coefficients Q14 (16384 is 1.0).
+Results saturate to the 16 bits range. On microcontrollers with DSP instructions the filter products use them.
+
+The following functions are available: :func:`stats`, :func:`fir`, :func:`biquad`, :func:`decimate`, :func:`fft`, :func:`magnitude`.
+
+    """
+
+def signed(v):
+    """
+.. function:: signed(v)
+
+    Return the signed value of the item *v* of a shortarray.
+
+    """
+    return v-65536 if v>32767 else v
+
+def _shorts(values):
+    return shortarray([v&0xffff for v in values])
+
+@native_c("_dsp_stats",["csrc/dsp/*"])
+def stats(buf):
+    """
+.. function:: stats(buf)
+
+    Return a tuple (min, max, mean, rms) of the samples in *buf*. *mean* and *rms* are floats.
+
+    """
+    pass
+
+@native_c("_dsp_fir",["csrc/dsp/*"])
+def _dsp_fir(buf,taps,state):
+    pass
+
+@native_c("_dsp_biquad",["csrc/dsp/*"])
+def _dsp_biquad(buf,coeffs,state):
+    pass
+
+@native_c("_dsp_decimate",["csrc/dsp/*"])
+def decimate(buf,factor):
+    """
+.. function:: decimate(buf,factor)
+
+    Replace each group of *factor* samples of *buf* with their mean, moving the means to the start of *buf*.
+    Return the number of means. Averaging is a crude lowpass: filter with :func:`fir` first when aliasing matters.
+
+    """
+    pass
+
+@native_c("_dsp_fft",["csrc/dsp/*"])
+def fft(re,im):
+    """
+.. function:: fft(re,im)
+
+    Compute in place the Fourier transform of the complex signal *re* + j* *im*, with Q15 samples.
+    Both buffers must hold the same power of two number of samples, at most 4096. For a real signal fill *im* with zeros.
+
+    The result is divided by the number of samples, so it never overflows: for a sine of amplitude A its bin holds A/2.
+
+    """
+    pass
+
+@native_c("_dsp_magnitude",["csrc/dsp/*"])
+def _dsp_magnitude(re,im,out):
+    pass
+
+def magnitude(re,im,out=None):
+    """
+.. function:: magnitude(re,im,out=None)
+
+    Store the magnitude sqrt(re**2+im**2) of each point into *out*, or into *re* if not given, and return it.
+
+    """
+    if out is None:
+        out = re
+    _dsp_magnitude(re,im,out)
+    return out
+
+class Fir():
+    """
+.. class:: Fir(taps)
+
+    Create a FIR filter with the Q15 coefficients in *taps* (a list or tuple, negative values allowed).
+    The filter keeps its state between calls, so a signal can be processed in consecutive buffers.
+
+    .. method:: __call__(buf)
+
+        Filter *buf* in place.
+
+    """
+    def __init__(self,taps):
+        self.taps = _shorts(taps)
+        self.state = shortarray(len(taps))
+
+    def __call__(self,buf):
+        _dsp_fir(buf,self.taps,self.state)
+        return buf
+
+    def reset(self):
+        """
+.. method:: reset()
+
+    Clear the state of the filter.
+
+        """
+        self.state = shortarray(len(self.taps))
+
+def fir(buf,taps):
+    """
+.. function:: fir(buf,taps)
+
+    Filter *buf* in place with the Q15 coefficients in *taps*, starting from a zero state. Use :class:`Fir` for a continuous signal.
+
+    """
+    return Fir(taps)(buf)
+
+class Biquad():
+    """
+.. class:: Biquad(coeffs)
+
+    Create a cascade of second order IIR sections. *coeffs* has 5 Q14 coefficients per section, *b0, b1, b2, a1, a2*
+    of the transfer function (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2) (the convention of most filter design tools,
+    with a0 normalized to 1). The filter keeps its state between calls.
+
+    .. method:: __call__(buf)
+
+        Filter *buf* in place.
+
+    """
+    def __init__(self,coeffs):
+        if len(coeffs)%5:
+            raise ValueError
+        self.coeffs = _shorts(coeffs)
+        self.state = shortarray(4*(len(coeffs)//5))
+
+    def __call__(self,buf):
+        _dsp_biquad(buf,self.coeffs,self.state)
+        return buf
+
+    def reset(self):
+        """
+.. method:: reset()
+
+    Clear the state of the filter.
+
+        """
+        self.state = shortarray(len(self.state))
+
+def biquad(buf,coeffs):
+    """
+.. function:: biquad(buf,coeffs)
+
+    Filter *buf* in place with the biquad cascade *coeffs* (see :class:`Biquad`), starting from a zero state.
+
+    """
+    return Biquad(coeffs)(buf)
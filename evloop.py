@@ -0,0 +1,397 @@
+"""
+.. module:: evloop
+
+**********
+Event Loop
+**********
+
+This module implements a single threaded event loop: sockets, serial ports and timed calls are served by one thread,
+instead of having a :class:`threading.Thread` (and its stack) waiting on each of them.
+
+Zerynth functions can't be suspended halfway, therefore the loop runs callbacks: each one is called when the event it waits for happens,
+must not block and should return quickly. Sockets are served in non-blocking mode (see :meth:`socket.socket.setblocking`) and waited for with a single :class:`socket.Poller`. ::
+
+    import socket
+    import evloop
+
+    loop = evloop.EventLoop()
+
+    def on_data(data):
+        if type(data)==PEXCEPTION:
+            client.close()
+        elif data:
+            loop.sock_sendall(client,data)     # echo back
+            loop.sock_recv(client,64,on_data)
+        else:
+            client.close()
+
+    def on_connect(err):
+        if not err:
+            loop.sock_recv(client,64,on_data)
+
+    client = socket.socket()
+    loop.sock_connect(client,("192.168.1.10",7),on_connect)
+    loop.call_every(1000,print,"tick")
+    loop.run()
+
+    """
+
+import socket
+import timers
+import heapq
+
+
+class Handle():
+    """
+============
+Handle class
+============
+
+.. class:: Handle
+
+    Returned by the methods scheduling a call. It can be used to cancel the call.
+
+    """
+    def __init__(self,when,period,fn,arg):
+        self.when = when
+        self.period = period
+        self.fn = fn
+        self.arg = arg
+        self.cancelled = False
+
+    def cancel(self):
+        """
+.. method:: cancel()
+
+    Cancel the call, if not already executed. Periodic calls are not executed anymore.
+
+        """
+        self.cancelled = True
+
+
+class EventLoop():
+    """
+===============
+EventLoop class
+===============
+
+.. class:: EventLoop(serial_period=20)
+
+    Create an event loop. Serial ports can't be waited for like sockets: while serial readers are registered, their streams are checked
+    every *serial_period* milliseconds.
+
+    Exceptions raised by callbacks are given to :attr:`exception_handler` (called with the exception), if set, otherwise they are printed.
+    The loop keeps running in both cases.
+
+    """
+    def __init__(self,serial_period=20):
+        self._poller = socket.Poller()
+        self._readers = {}
+        self._writers = {}
+        self._sends = {}
+        self._serials = []
+        self._timed = []
+        self._seq = 0
+        self._ready = []
+        self._running = False
+        self.serial_period = serial_period
+        self.exception_handler = None
+
+    def _call(self,fn,arg):
+        try:
+            fn(arg)
+        except Exception as e:
+            if self.exception_handler is not None:
+                self.exception_handler(e)
+            else:
+                print(e)
+
+    def _schedule(self,h):
+        # heap of timed calls by deadline, same deadlines in call order: the sequence number also keeps handles from being compared
+        heapq.heappush(self._timed,(h.when,self._seq,h))
+        self._seq+=1
+        return h
+
+    ##################### timed calls
+
+    def call_soon(self,fn,arg=None):
+        """
+.. method:: call_soon(fn,arg=None)
+
+    Call *fn(arg)* at the next iteration of the loop. Returns a :class:`Handle`.
+
+        """
+        h = Handle(0,0,fn,arg)
+        self._ready.append(h)
+        return h
+
+    def call_later(self,delay,fn,arg=None):
+        """
+.. method:: call_later(delay,fn,arg=None)
+
+    Call *fn(arg)* once, after *delay* milliseconds. Returns a :class:`Handle`.
+
+        """
+        return self._schedule(Handle(timers.now()+delay,0,fn,arg))
+
+    def call_every(self,period,fn,arg=None):
+        """
+.. method:: call_every(period,fn,arg=None)
+
+    Call *fn(arg)* every *period* milliseconds, until canceled. The period is measured between deadlines, not between calls. Returns a :class:`Handle`.
+
+        """
+        return self._schedule(Handle(timers.now()+period,period,fn,arg))
+
+    ##################### readiness
+
+    def _update(self,fd):
+        events = 0
+        if fd in self._readers:
+            events = events|socket.POLLIN
+        if fd in self._writers:
+            events = events|socket.POLLOUT
+        if events:
+            self._poller.register(fd,events|socket.POLLERR)
+        else:
+            self._poller.unregister(fd)
+
+    def add_reader(self,sock,fn,arg=None):
+        """
+.. method:: add_reader(sock,fn,arg=None)
+
+    Call *fn(arg)* every time *sock* has bytes to read (or an error), until :meth:`remove_reader` is called.
+    Bytes already buffered by :meth:`socket.socket.peek` or :meth:`socket.socket.readline` are not reported.
+
+        """
+        fd = sock.fileno()
+        self._readers[fd] = (fn,arg)
+        self._update(fd)
+
+    def remove_reader(self,sock):
+        """
+.. method:: remove_reader(sock)
+
+    Stop watching *sock* for reading.
+
+        """
+        fd = sock.fileno()
+        if fd in self._readers:
+            self._readers.pop(fd)
+            self._update(fd)
+
+    def add_writer(self,sock,fn,arg=None):
+        """
+.. method:: add_writer(sock,fn,arg=None)
+
+    Call *fn(arg)* every time *sock* can be written without blocking (or has an error), until :meth:`remove_writer` is called.
+
+        """
+        fd = sock.fileno()
+        self._writers[fd] = (fn,arg)
+        self._update(fd)
+
+    def remove_writer(self,sock):
+        """
+.. method:: remove_writer(sock)
+
+    Stop watching *sock* for writing.
+
+        """
+        fd = sock.fileno()
+        if fd in self._writers:
+            self._writers.pop(fd)
+            self._update(fd)
+
+    def add_serial(self,stream,fn,arg=None):
+        """
+.. method:: add_serial(stream,fn,arg=None)
+
+    Call *fn(arg)* every time the :class:`streams.serial` *stream* has characters available, until :meth:`remove_serial` is called.
+    The callback must read them, otherwise it is called again at the next check.
+
+        """
+        self.remove_serial(stream)
+        self._serials.append((stream,fn,arg))
+
+    def remove_serial(self,stream):
+        """
+.. method:: remove_serial(stream)
+
+    Stop watching *stream*.
+
+        """
+        for i in range(len(self._serials)):
+            if self._serials[i][0] is stream:
+                self._serials.pop(i)
+                return
+
+    ##################### socket operations
+
+    def sock_connect(self,sock,address,fn,arg=None):
+        """
+.. method:: sock_connect(sock,address,fn,arg=None)
+
+    Put *sock* in non-blocking mode and connect it to *address*. When the connection is complete *fn(err)* is called,
+    where *err* is 0 on success or the error code of the socket. If *arg* is given, *fn(err,arg)* is called instead.
+
+        """
+        sock.setblocking(False)
+        try:
+            sock.connect(address)
+        except socket.WouldBlockError:
+            self.add_writer(sock,self._on_connect,(sock,fn,arg))
+            return
+        self.call_soon(self._done,(fn,0,arg))
+
+    def _on_connect(self,op):
+        sock,fn,arg = op
+        self.remove_writer(sock)
+        self._done((fn,sock.geterror(),arg))
+
+    def _done(self,op):
+        fn,res,arg = op
+        if arg is None:
+            fn(res)
+        else:
+            fn(res,arg)
+
+    def sock_recv(self,sock,size,fn,arg=None):
+        """
+.. method:: sock_recv(sock,size,fn,arg=None)
+
+    Wait for bytes on the non-blocking *sock* and call *fn(data)* with a bytearray of at most *size* of them.
+    An empty bytearray means the connection has been closed, while on error *data* is the exception raised by the socket
+    (``type(data)==PEXCEPTION``). If *arg* is given, *fn(data,arg)* is called instead.
+
+        """
+        self.add_reader(sock,self._on_recv,(sock,size,fn,arg))
+
+    def _on_recv(self,op):
+        sock,size,fn,arg = op
+        buf = bytearray(size)
+        try:
+            rd = sock.recv_into(buf,size,socket.MSG_DONTWAIT)
+        except socket.WouldBlockError:
+            return
+        except Exception as e:
+            self.remove_reader(sock)
+            self._done((fn,e,arg))
+            return
+        self.remove_reader(sock)
+        __elements_set(buf,rd)
+        self._done((fn,buf,arg))
+
+    def sock_sendall(self,sock,data,fn=None,arg=None):
+        """
+.. method:: sock_sendall(sock,data,fn=None,arg=None)
+
+    Send all *data* on the non-blocking *sock*, a piece at a time whenever the socket can be written.
+    When done, *fn(sent)* is called (if given) with the number of bytes sent, less than ``len(data)`` on error. If *arg* is given, *fn(sent,arg)* is called instead.
+    Calls made while a previous send on *sock* is pending are queued and served in order.
+
+        """
+        fd = sock.fileno()
+        if fd in self._sends:
+            self._sends[fd].append([data,0,fn,arg])
+        else:
+            self._sends[fd] = [[data,0,fn,arg]]
+            self.add_writer(sock,self._on_send,sock)
+
+    def _on_send(self,sock):
+        fd = sock.fileno()
+        queue = self._sends[fd]
+        while queue:
+            op = queue[0]
+            data,sent,fn,arg = op
+            try:
+                while sent<len(data):
+                    sent+=sock.send(data[sent:])
+            except socket.WouldBlockError:
+                op[1] = sent
+                return
+            except:
+                pass
+            queue.pop(0)
+            if fn is not None:
+                self._done((fn,sent,arg))
+        self._sends.pop(fd)
+        self.remove_writer(sock)
+
+    ##################### loop
+
+    def run_once(self,timeout=None):
+        """
+.. method:: run_once(timeout=None)
+
+    Run one iteration of the loop: wait for events at most *timeout* milliseconds (forever if None, but no longer than the next timed call)
+    and run the callbacks of the events happened.
+
+        """
+        now = timers.now()
+        if self._ready:
+            timeout = 0
+        elif self._timed:
+            wait = self._timed[0][0]-now
+            if wait<0:
+                wait = 0
+            if timeout is None or wait<timeout:
+                timeout = wait
+        if self._serials and (timeout is None or timeout>self.serial_period):
+            timeout = self.serial_period
+
+        if self._readers or self._writers:
+            events = self._poller.poll(timeout)
+        else:
+            if timeout:
+                sleep(timeout)
+            events = ()
+
+        ready = self._ready
+        self._ready = []
+        for h in ready:
+            if not h.cancelled:
+                self._call(h.fn,h.arg)
+
+        for fd,ev in events:
+            if ev&(socket.POLLIN|socket.POLLERR) and fd in self._readers:
+                cb = self._readers[fd]
+                self._call(cb[0],cb[1])
+            if ev&(socket.POLLOUT|socket.POLLERR) and fd in self._writers:
+                cb = self._writers[fd]
+                self._call(cb[0],cb[1])
+
+        for s in self._serials[:]:
+            if s[0].available():
+                self._call(s[1],s[2])
+
+        now = timers.now()
+        while self._timed and self._timed[0][0]<=now:
+            h = heapq.heappop(self._timed)[2]
+            if h.cancelled:
+                continue
+            if h.period:
+                h.when+=h.period
+                self._schedule(h)
+            self._call(h.fn,h.arg)
+
+    def run(self):
+        """
+.. method:: run()
+
+    Run the loop until :meth:`stop` is called or there is nothing left to wait for: no sockets, serial ports or scheduled calls.
+
+        """
+        self._running = True
+        while self._running and (self._ready or self._timed or self._readers or self._writers or self._serials):
+            self.run_once()
+        self._running = False
+
+    def stop(self):
+        """
+.. method:: stop()
+
+    Make :meth:`run` return after the current iteration.
+
+        """
+        self._running = False
@@ -0,0 +1,30 @@
+################################################################################
+# Bignum Calibration
+#
+# Created by Zerynth Team 2017 CC
+# Authors: G. Baldi
+################################################################################
+
+import streams
+import timers
+from bignum import bignum as bg
+
+streams.serial()
+
+print("default cutoffs:",bg.get_cutoffs())
+print("calibrating, it may take a few minutes...")
+
+# time 50 multiplications and squarings for each size up to 256 digits
+cut = bg.calibrate(50,256,8)
+
+# the measured values can be fixed at build time to skip this step
+names = ["KARATSUBA_MUL","KARATSUBA_SQR","TOOM_MUL","TOOM_SQR"]
+for i in range(4):
+    print("ZERYNTH_BIGNUM_"+names[i]+"_CUTOFF =",cut[i])
+
+# cutoffs are already applied: compare with a big multiplication
+a = bg.BigNum("0x"+"F"*1024)
+t = timers.now()
+for i in range(10):
+    b = a.mul(a)
+print("10 multiplications of 4096 bits numbers:",timers.now()-t,"ms")
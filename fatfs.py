@@ -18,11 +18,15 @@ import threading
 
 # Volume Management
 
-@native_c("__f_mount",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_mount",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_mount(path):
     pass
 
-@native_c("__update_disks_dict",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_mkfs",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __f_mkfs(path, au, fmt):
+    pass
+
+@native_c("__update_disks_dict",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __update_disks_dict(pdrv, disk_args):
     pass
 
@@ -47,11 +51,16 @@ def mount(path, args):
         * args dictionary containing disk initialization parameters::
 
             # correct format for SD Card read through SPI protocol
+            # (clock is the maximum: the card is initialized at 400kHz, then the clock is raised to the fastest
+            # the card supports up to it, switching to high-speed mode above 25MHz, and checked by reading the card back)
             args = {"drv": SPI0, "cs": D25, "clock": 1000000}
 
             # correct format for SD Card read through SD mode
             # (be careful in choosing frequency (kHz) and bits supported by your board)
             args = {"drv": SD1, "freq_khz": 20000, "bits": 1}
+
+            # correct format for a flash translation layer volume (see :mod:`ftl`)
+            args = {"ftl": ftl.Ftl(qspiflash.QSpiFlash())}
     """
     global disks_dict
     __builtins__.__default_fs = __module__
@@ -62,13 +71,62 @@ def mount(path, args):
             disks_dict = __update_disks_dict(pdrv, [0, args["drv"], args["cs"], args["clock"]])
         else:
             disks_dict = __update_disks_dict(pdrv, [1, args["drv"], args["bits"], args["freq_khz"]])
+    elif len(args) == 1 and 'ftl' in args:
+        # the bus of a spiflash volume is configured once, it must not be shared
+        args["ftl"]._bus()
+        disks_dict = __update_disks_dict(pdrv, [2, args["ftl"]._id])
     else:
         raise ValueError
     __f_mount(path)
 
+FM_FAT = 0x01
+FM_FAT32 = 0x02
+FM_EXFAT = 0x04
+FM_ANY = 0x07
+
+def mkfs(path, au=0, fmt=FM_ANY):
+    """
+.. function:: mkfs(path, au=0, fmt=FM_ANY)
+
+    Create a filesystem on the volume mounted at *path*, without a partition table. All the files of the volume are lost.
+    *au* is the size in bytes of the clusters, a power of 2 (0 picks it from the size of the volume): up to 64KB for FAT, up to 32MB for exFAT.
+
+    *fmt* selects the allowed formats, combining :samp:`FM_FAT` (FAT12/16), :samp:`FM_FAT32` and :samp:`FM_EXFAT`. With :samp:`FM_ANY`,
+    volumes of 32GB and more are formatted as exFAT (with 128KB clusters by default) and smaller ones as FAT, as SD cards come from the factory.
+    exFAT needs fewer FAT lookups with large clusters, and files written contiguously (e.g. after :func:`preallocate`) don't use the FAT at all,
+    so that writing and seeking in large log files stay fast.
+
+    Raises ``OSError`` if the volume can't be formatted, e.g. if the cluster size gives a cluster count not valid for the formats allowed.
+
+    """
+    if __f_mkfs(path, au, fmt) == -1:
+        raise OSError
+
+@native_c("__disk_bench",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __disk_bench(pdrv, sector, buffer, rewrite):
+    pass
+
+def disk_bench(path, sector, buffer, rewrite=False):
+    """
+.. function:: disk_bench(path, sector, buffer, rewrite=False)
+
+    Time a raw transfer of the volume mounted at *path*: the 512 bytes sectors starting at *sector* that fit in the bytearray *buffer*
+    are read straight from the driver (``spi_disk_read`` for SD cards on SPI), skipping FatFs and the sector cache.
+    If *rewrite* is True, the sectors are read and then written back as they are (``spi_disk_write``) and only the write is timed:
+    the content of the disk never changes, so the filesystem on it is safe.
+
+    The volume must have been accessed once since :func:`mount`, to initialize the card. Return the microseconds taken by the transfer;
+    raise ``OSError`` if the driver fails.
+
+    """
+    r = __disk_bench(int(path.split(':')[0]), sector, buffer, rewrite)
+    if r < 0:
+        raise OSError
+    return r
+
 # File Access
 
-@native_c("__f_open",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_open",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_open(path, mode, n):
     """
 ================================
@@ -83,6 +141,11 @@ and a list of low-level functions implemented in the filesystem module.
         * __f_open
         * __f_close
         * __f_read
+        * __f_readinto
+        * __f_readline
+        * __f_hash
+        * __f_sendfile
+        * __f_sink
         * __f_write
         * __f_seek
         * __f_size
@@ -95,6 +158,7 @@ and a list of low-level functions implemented in the filesystem module.
         * __f_opendir
         * __f_closedir
         * __f_readdir
+        * __f_scandir
 
     * File/Directory Management
 
@@ -116,83 +180,141 @@ and a list of low-level functions implemented in the filesystem module.
     """    
     pass
 
-@native_c("__f_close",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_close",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_close(n):
     pass
 
-@native_c("__f_read",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_read",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_read(n_bytes, mode, n):
     pass
 
-@native_c("__f_write",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_readinto",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __f_readinto(buffer, size, ofs, n):
+    pass
+
+@native_c("__f_readline",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __f_readline(kind, n):
+    pass
+
+@native_c("__f_hash",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __f_hash(hash_cctx, hash_ctx, size, n):
+    pass
+
+@native_c("__f_sendfile",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __f_sendfile(sink, offset, count, n):
+    pass
+
+@native_c("__f_sink",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __f_sink(n):
+    pass
+
+@native_c("__f_write",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_write(to_w, sync, n):
     pass
 
-@native_c("__f_seek",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_seek",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_seek(pos, n):
     pass
 
-@native_c("__f_size",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_size",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_size(n):
     pass
 
-@native_c("__f_tell",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_tell",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_tell(n):
     pass
 
-@native_c("__f_truncate",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_truncate",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_truncate(n):
     pass
 
-@native_c("__f_eof",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_expand",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __f_expand(path, size, n):
+    pass
+
+@native_c("__f_eof",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_eof(n):
     pass
 
+@native_c("__f_fastseek",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __f_fastseek(size, n):
+    pass
+
+def fast_seek(file, size=32):
+    """
+.. function:: fast_seek(file, size=32)
+
+    Switch the open :class:`os.FileIO` *file* to fast seek mode: the cluster chain of the file is read once into a
+    table held until the file is closed, and seeks find their position in the table instead of following the chain on the disk.
+    Seeking into large files becomes a constant time operation.
+
+    *size* is the initial number of items of the table: two items are needed for every fragment of the file (plus two),
+    and the table is enlarged if needed. Returns the number of fragments of the file.
+
+    Fast seek mode is meant for reading: seeks are clipped to the file size, and it is turned off by writes extending the file
+    and by :meth:`os.FileIO.truncate` (it can be enabled again afterwards).
+
+    """
+    if file.closed:
+        raise ValueError
+    res = __f_fastseek(size, file._n)
+    if res == -1:
+        raise OSError
+    return res
+
 # Directory Access
 
-@native_c("__f_opendir",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_opendir",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_opendir(path, n):
     pass
 
-@native_c("__f_closedir",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_closedir",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_closedir(n):
     pass
 
-@native_c("__f_readdir",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_readdir",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_readdir(n):
     pass
 
+@native_c("__f_scandir",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __f_scandir(n, count, pattern):
+    pass
+
 # File/Directory Management
 
-@native_c("__f_copy",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_copy",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_copy(src, dst, n_src, n_dst):
     pass
 
-@native_c("__f_unlink",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_copy_chunk",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+def __f_copy_chunk(buffer, n_src, n_dst):
+    pass
+
+@native_c("__f_unlink",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_unlink(path):
     pass
 
-@native_c("__f_rename",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_rename",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_rename(src_path, dst_path):
     pass
 
-@native_c("__f_mkdir",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_mkdir",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_mkdir(path):
     pass
 
-@native_c("__f_chdir",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_chdir",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_chdir(path):
     pass
 
-@native_c("__f_getcwd",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_getcwd",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_getcwd(max_length):
     pass
 
-@native_c("__f_exists",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_exists",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_exists(path):
     pass
 
-@native_c("__f_isdir",["csrc/fatfs/*"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
+@native_c("__f_isdir",["csrc/fatfs/*","csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI", "VHAL_SPISD", "VHAL_SDIO"])
 def __f_isdir(path):
     pass
 
@@ -222,6 +344,82 @@ def free_fd_n(fd, n):
     _open_fd[fd].remove(n)
     _open_fd_lock[fd].release()
 
+def preallocate(path, size):
+    """
+.. function:: preallocate(path, size)
+
+    Create the file *path* (replacing it if it exists) with a size of *size* bytes, allocated as a single block of contiguous clusters.
+    The content of the file is undefined.
+
+    Writing a preallocated file (opened with mode ``"r+"``) never allocates clusters nor updates the FAT, and its sectors are consecutive on the disk:
+    it is the best layout for log files that are rotated or written as a ring buffer.
+
+    Raises ``OSError`` if there is no contiguous free space of *size* bytes or no files can be opened.
+
+    """
+    n = get_available_fd_n('files')
+    if n == None:
+        raise OSError
+    res = __f_expand(path, size, n)
+    free_fd_n('files', n)
+    if res == -1:
+        raise OSError
+
+def _copy(src, dst, buffer, callback, n_src, n_dst):
+    copied = 0
+    total = 0
+    res = __f_open(src, FA_READ, n_src)
+    if res != -1:
+        total = __f_size(n_src)
+        res = __f_open(dst, FA_WRITE | FA_CREATE_ALWAYS, n_dst)
+        if res != -1:
+            while True:
+                res = __f_copy_chunk(buffer, n_src, n_dst)
+                if res <= 0:
+                    break
+                copied += res
+                if callback is not None:
+                    callback(copied, total)
+            if __f_close(n_dst) == -1:
+                res = -1
+        __f_close(n_src)
+    free_fd_n('files', n_src)
+    free_fd_n('files', n_dst)
+    if res == -1 and callback is not None:
+        callback(-1, total)
+    return res
+
+def copy(src, dst, bufsize=4096, callback=None, background=False):
+    """
+.. function:: copy(src, dst, bufsize=4096, callback=None, background=False)
+
+    Copy the contents of the file *src* to the file *dst*, *bufsize* bytes at a time (rounded up to a multiple of 512, the sector size).
+    Whole sectors are moved between the files and the disks with multiple block transfers, and the
+    other threads keep running during each transfer.
+
+    If given, *callback* is called as *callback(copied, total)* after every chunk with the bytes copied so far and the size of *src*,
+    and as *callback(-1, total)* if the copy fails.
+
+    If *background* is True, the copy is executed by a new thread, which is returned; otherwise the function returns when the copy is done and 
+    raises ``OSError`` on failure.
+
+    """
+    n_src = get_available_fd_n('files')
+    n_dst = get_available_fd_n('files')
+    if n_src == None or n_dst == None:
+        if n_src != None:
+            free_fd_n('files', n_src)
+        if n_dst != None:
+            free_fd_n('files', n_dst)
+        raise OSError
+    buffer = bytearray((bufsize+511)//512*512)
+    if background:
+        th = threading.Thread(target=_copy, args=(src, dst, buffer, callback, n_src, n_dst))
+        th.start()
+        return th
+    if _copy(src, dst, buffer, callback, n_src, n_dst) == -1:
+        raise OSError
+
 FA_READ			 = 0x01
 FA_WRITE		 = 0x02
 FA_OPEN_EXISTING = 0x00
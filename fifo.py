@@ -8,11 +8,54 @@ Fifo
 This module implements no thread-safe fifo queues.
 A fifo queue behaves in such a way that the first element inserted in the queue is also the first element to be removed (first in, first out).
 
+For streams of bytes passed from a callback (or a native driver) to a thread, :class:`ByteRing` is a native ring that is
+safe with one producer and one consumer, and lets the consumer wait for data.
+
    """
 
 new_exception(FifoFullError,Exception)
 new_exception(FifoEmptyError,Exception)
 
+@native_c("_deque_new",["csrc/collections/deque.c"])
+def _deque_new(maxlen,bytes):
+    pass
+
+@native_c("_deque_push",["csrc/collections/deque.c"])
+def _deque_push(d,obj,left,discard):
+    pass
+
+@native_c("_deque_pop",["csrc/collections/deque.c"])
+def _deque_pop(d,left,remove):
+    pass
+
+@native_c("_deque_size",["csrc/collections/deque.c"])
+def _deque_size(d):
+    pass
+
+@native_c("_deque_clear",["csrc/collections/deque.c"])
+def _deque_clear(d):
+    pass
+
+@native_c("_bytering_new",["csrc/fifo/*"])
+def _bytering_new(size):
+    pass
+
+@native_c("_bytering_put",["csrc/fifo/*"])
+def _bytering_put(r,data,ofs,size):
+    pass
+
+@native_c("_bytering_get",["csrc/fifo/*"])
+def _bytering_get(r,buf,ofs,size,timeout):
+    pass
+
+@native_c("_bytering_count",["csrc/fifo/*"])
+def _bytering_count(r):
+    pass
+
+@native_c("_bytering_clear",["csrc/fifo/*"])
+def _bytering_clear(r):
+    pass
+
 class Fifo():
     """
 ==========
@@ -24,15 +67,14 @@ Fifo class
     Create a Fifo instance with *size* "places" for items. 
     If *only_bytes* is True, the Fifo will use a bytearray to store bytes; if False it will use a list.
 
+    The fifo is a native ring (the one of :class:`collections.deque`): every operation is a single call.
+
     """
     def __init__(self,size=16,only_bytes=False):
-        if not only_bytes:
-            self._fifo = [None]*size
-        else:
-            self._fifo=bytearray(size)
+        if size<=0:
+            raise ValueError
+        self._fifo = _deque_new(size,only_bytes)
         self.l = size
-        self.head=0
-        self.elem=0
 
     def is_full(self):
         """
@@ -41,7 +83,7 @@ Fifo class
     Return True if the fifo is full
 
         """
-        return self.elem==self.l
+        return _deque_size(self._fifo)==self.l
     
     def is_empty(self):
         """
@@ -50,7 +92,7 @@ Fifo class
     Return True if the fifo is empty
 
         """
-        return self.elem==0
+        return _deque_size(self._fifo)==0
     
     def put(self,obj):
         """
@@ -59,10 +101,8 @@ Fifo class
     Insert *obj* into the fifo queue. Raise *FifoFullError* if the fifo is full.
 
         """
-        if self.elem==self.l:
+        if not _deque_push(self._fifo,obj,False,False):
             raise FifoFullError
-        self._fifo[ (self.head+self.elem)%self.l]=obj
-        self.elem+=1
     
     def get(self):
         """
@@ -71,11 +111,9 @@ Fifo class
     Get an object out of the fifo queue. Raise *FifoEmptyError* if the fifo is empty.
 
         """
-        if self.elem==0:
+        res = _deque_pop(self._fifo,True,True)
+        if res is self._fifo:
             raise FifoEmptyError
-        res = self._fifo[self.head % self.l]
-        self.elem-=1
-        self.head+=1
         return res
 
     def peek(self):
@@ -85,9 +123,10 @@ Fifo class
     Return the object at the head of the fifo queu without removing it. Raise *FifoEmptyError* if the fifo is empty.
 
         """
-        if self.elem==0:
+        res = _deque_pop(self._fifo,True,False)
+        if res is self._fifo:
             raise FifoEmptyError
-        return self._fifo[self.head % self.l]
+        return res
 
     def put_all(self,objs):
         """
@@ -106,7 +145,7 @@ Fifo class
     Return the number of items in the queue.
 
         """
-        return self.elem
+        return _deque_size(self._fifo)
 
     def clear(self):
         """
@@ -115,8 +154,104 @@ Fifo class
     Clear the fifo by removing all elements
 
         """
-        self.head=0
-        self.elem=0
-        # also clear the list to be garbage collector friendly
-        if type(self._fifo)==PLIST:
-            self._fifo = [None]*self.l
\ No newline at end of file
+        _deque_clear(self._fifo)
+
+
+class ByteRing():
+    """
+==============
+ByteRing class
+==============
+
+.. class:: ByteRing(size=64)
+
+    Create a ring of bytes able to hold at least *size* bytes (the capacity is rounded up to a power of two, at most 32768).
+
+    One thread or callback may put bytes while another one gets them, without locks: head and tail are each updated by one
+    side only. Several producers (or consumers) must be serialized by the caller. A native driver can also be the
+    producer, writing with :samp:`bytering_write` from its ISR.
+
+    """
+    def __init__(self,size=64):
+        self._ring = _bytering_new(size)
+        self.size = len(self._ring[0])-16
+
+    def put_bytes(self,data,ofs=0,size=-1):
+        """
+.. method:: put_bytes(data,ofs=0,size=-1)
+
+    Append *size* bytes of *data* starting at *ofs* (all of them if *size* is negative) and return how many fit in the ring.
+    It never waits.
+
+        """
+        return _bytering_put(self._ring,data,ofs,size)
+
+    def put(self,byte):
+        """
+.. method:: put(byte)
+
+    Append a single byte. Raise *FifoFullError* if the ring is full.
+
+        """
+        if not _bytering_put(self._ring,bytes((byte,)),0,1):
+            raise FifoFullError
+
+    def get_into(self,buf,ofs=0,size=-1,timeout=-1):
+        """
+.. method:: get_into(buf,ofs=0,size=-1,timeout=-1)
+
+    Move up to *size* bytes (enough to fill *buf* if negative) into the bytearray *buf* starting at *ofs*, and return how many were moved.
+    If the ring is empty, wait at most *timeout* milliseconds (forever if negative, not at all if zero) for data:
+    0 is returned if none arrived.
+
+        """
+        return _bytering_get(self._ring,buf,ofs,size,timeout)
+
+    def get(self,timeout=0):
+        """
+.. method:: get(timeout=0)
+
+    Remove and return a single byte, waiting at most *timeout* milliseconds (forever if negative) for one.
+    Raise *FifoEmptyError* if the ring stayed empty.
+
+        """
+        b = bytearray(1)
+        if not _bytering_get(self._ring,b,0,1,timeout):
+            raise FifoEmptyError
+        return b[0]
+
+    def elements(self):
+        """
+.. method:: elements()
+
+    Return the number of bytes in the ring.
+
+        """
+        return _bytering_count(self._ring)
+
+    def is_empty(self):
+        """
+.. method:: is_empty()
+
+    Return True if the ring is empty
+
+        """
+        return _bytering_count(self._ring)==0
+
+    def is_full(self):
+        """
+.. method:: is_full()
+
+    Return True if the ring is full
+
+        """
+        return _bytering_count(self._ring)==self.size
+
+    def clear(self):
+        """
+.. method:: clear()
+
+    Discard the bytes in the ring. Only the consumer may call it.
+
+        """
+        _bytering_clear(self._ring)
@@ -0,0 +1,146 @@
+"""
+.. module:: fixmath
+
+*****************
+Fixed Point Math
+*****************
+
+This module implements trigonometric functions and square roots in fixed point arithmetic, with interpolated tables stored in flash
+and no floating point operation: it is meant for hot control loops (like the field oriented control of a motor) on microcontrollers without FPU,
+where even the native :mod:`math` functions take several microseconds.
+
+Values are integers in two formats:
+
+* Q15: 16 bits values where 32768 is 1.0, so that results are in [-32768,32767];
+* Q31: 32 bits values where 2147483648 is 1.0.
+
+Angles are fractions of pi in the same formats: a Q15 angle of 16384 is pi/2 and -32768 is -pi. Only the low 16 (or 32) bits of an angle are used,
+so angles can be accumulated and let wrap around freely, as a phase counter does.
+
+Q15 sin and cos are within 1 lsb, Q31 ones within 2 lsb; Q15 atan2 within 1 lsb, Q31 atan2 within about 1.3e-6 radians.
+
+Vector variants transform a :class:`shortarray` (or a :class:`bytearray` read as 16 bits samples, as in the :mod:`dsp` module) with a single call.
+Since shortarray items are unsigned, negative results are stored as ``v&0xffff``: read them back with :func:`dsp.signed`.
+
+    """
+
+@native_c("_fix_trig",["csrc/math/fixed.c"])
+def _fix_trig(angle,kind,q31):
+    pass
+
+@native_c("_fix_atan2",["csrc/math/fixed.c"])
+def _fix_atan2(y,x,q31):
+    pass
+
+@native_c("_fix_sqrt",["csrc/math/fixed.c"])
+def _fix_sqrt(x,q31):
+    pass
+
+@native_c("_fix_vtrig",["csrc/math/fixed.c"])
+def _fix_vtrig(src,src2,dst,kind):
+    pass
+
+def sin(angle):
+    """
+.. function:: sin(angle)
+
+    Return the Q15 sine of the Q15 *angle*.
+    """
+    return _fix_trig(angle,0,0)
+
+def cos(angle):
+    """
+.. function:: cos(angle)
+
+    Return the Q15 cosine of the Q15 *angle*.
+    """
+    return _fix_trig(angle,1,0)
+
+def sincos(angle):
+    """
+.. function:: sincos(angle)
+
+    Return a tuple with the Q15 sine and cosine of the Q15 *angle*, as needed by Park transforms.
+    """
+    return _fix_trig(angle,2,0)
+
+def atan2(y,x):
+    """
+.. function:: atan2(y,x)
+
+    Return the Q15 angle of the vector (*x*, *y*), in [-pi,pi). *x* and *y* can be integers of any scale up to 32 bits.
+    The angle of a vector on the negative x axis is -pi, since pi is not representable.
+    """
+    return _fix_atan2(y,x,0)
+
+def sqrt(x):
+    """
+.. function:: sqrt(x)
+
+    Return the Q15 square root of the non negative Q15 value *x*.
+    """
+    return _fix_sqrt(x,0)
+
+def sin_q31(angle):
+    """
+.. function:: sin_q31(angle)
+
+    Return the Q31 sine of the Q31 *angle*.
+    """
+    return _fix_trig(angle,0,1)
+
+def cos_q31(angle):
+    """
+.. function:: cos_q31(angle)
+
+    Return the Q31 cosine of the Q31 *angle*.
+    """
+    return _fix_trig(angle,1,1)
+
+def sincos_q31(angle):
+    """
+.. function:: sincos_q31(angle)
+
+    Return a tuple with the Q31 sine and cosine of the Q31 *angle*.
+    """
+    return _fix_trig(angle,2,1)
+
+def atan2_q31(y,x):
+    """
+.. function:: atan2_q31(y,x)
+
+    Return the Q31 angle of the vector (*x*, *y*), in [-pi,pi).
+    """
+    return _fix_atan2(y,x,1)
+
+def sqrt_q31(x):
+    """
+.. function:: sqrt_q31(x)
+
+    Return the Q31 square root of the non negative Q31 value *x*.
+    """
+    return _fix_sqrt(x,1)
+
+def vsin(src,dst=None):
+    """
+.. function:: vsin(src,dst=None)
+
+    Store the Q15 sines of the Q15 angles in *src* into *dst* (*src* itself if not given) and return *dst*.
+    """
+    return _fix_vtrig(src,None,src if dst is None else dst,0)
+
+def vcos(src,dst=None):
+    """
+.. function:: vcos(src,dst=None)
+
+    Store the Q15 cosines of the Q15 angles in *src* into *dst* (*src* itself if not given) and return *dst*.
+    """
+    return _fix_vtrig(src,None,src if dst is None else dst,1)
+
+def vatan2(y,x,dst=None):
+    """
+.. function:: vatan2(y,x,dst=None)
+
+    Store the Q15 angles of the vectors (*x[i]*, *y[i]*) into *dst* (*y* itself if not given) and return *dst*.
+    """
+    return _fix_vtrig(y,x,y if dst is None else dst,2)
@@ -88,10 +88,9 @@ The FlashFileStream class
             buf[1]=(n>>8)&0xff
             buf[2]=(n>>16)&0xff
             buf[3]=(n>>24)&0xff
-        ll = min(len(buf),self.size)
-        for i in range(ll):
-            self.bb[self.curpos]=__byte_get(buf,i)
-            self.curpos+=1
+        ll = min(len(buf),self.size-self.curpos)
+        self.bb[self.curpos:self.curpos+ll]=buf[0:ll]
+        self.curpos+=ll
         return ll
     
     def read_int(self):
@@ -112,6 +111,7 @@ The FlashFileStream class
 .. method:: flush()
         
         Write the memory buffer to flash. It can be VERY slow because the sector(s) of flash interested by the write operation must be erased first.
+        To store small values that change often, use :mod:`kvstore` instead.
         
         """
         __write_flash(self.addr,self.bb)
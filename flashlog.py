@@ -0,0 +1,207 @@
+"""
+.. module:: flashlog
+
+*********
+Flash Log
+*********
+
+This module stores a circular log of records on a :class:`qspiflash.QSpiFlash`, a :class:`spiflash.SpiFlash` or the internal flash of the microcontroller.
+It is meant for data buffered while offline and replayed later, like telemetry.
+
+Every record holds a payload of bytes, a timestamp and a crc32. Appending a record only programs erased bytes, with no read-modify-write
+of the flash and no erase until an erase unit (sector) is full: then the next sector of the ring is erased, dropping the oldest records.
+A record interrupted by a power loss is skipped on replay.
+
+The timestamp of the first record of each sector is kept in RAM, so that :meth:`FlashLog.seek` finds a timestamp reading a single sector.
+Timestamps are integers between 0 and 2^31-1, chosen by the application (e.g. seconds from the RTC), and must not decrease along the log::
+
+    import flashlog
+    import qspiflash
+
+    log = flashlog.FlashLog(qspiflash.QSpiFlash())
+    log.append(sample, timestamp)
+
+    # when the link is back
+    buf = bytearray(1024)
+    while True:
+        records = log.read_records(16, buf)
+        if not records:
+            break
+        for ts, start, end in records:
+            send(ts, buf[start:end])
+
+    """
+
+_FLASHLOG_QSPI     = 0
+_FLASHLOG_SPI      = 1
+_FLASHLOG_INTERNAL = 2
+
+# 4KB sector erase command of spiflash
+_SPI_CMD_SER4K = 0x20
+
+@native_c("flashlog_attach",["csrc/flashlog/*","csrc/crc/crc32.c","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _attach(type,drv,start,size,sector_size,page_size,erase_cmd):
+    pass
+
+@native_c("flashlog_detach",["csrc/flashlog/*","csrc/crc/crc32.c","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _detach(id):
+    pass
+
+@native_c("flashlog_append",["csrc/flashlog/*","csrc/crc/crc32.c","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _append(id,data,timestamp):
+    pass
+
+@native_c("flashlog_read_records",["csrc/flashlog/*","csrc/crc/crc32.c","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _read_records(id,n,buffer,ofs):
+    pass
+
+@native_c("flashlog_seek",["csrc/flashlog/*","csrc/crc/crc32.c","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _seek(id,timestamp):
+    pass
+
+@native_c("flashlog_clear",["csrc/flashlog/*","csrc/crc/crc32.c","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _clear(id):
+    pass
+
+@native_c("flashlog_stats",["csrc/flashlog/*","csrc/crc/crc32.c","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _stats(id):
+    pass
+
+@native_c("flashlog_sink",["csrc/flashlog/*","csrc/crc/crc32.c","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _sink(id):
+    pass
+
+class FlashLog():
+    """
+==============
+FlashLog class
+==============
+
+.. class:: FlashLog(flash, start=0, size=None, sector_size=None)
+
+        Attach a log to the region of *flash* beginning at address *start* and *size* bytes long.
+
+        *flash* can be:
+
+            * a :class:`qspiflash.QSpiFlash`, erased in sectors of the size given by its geometry. If *size* is None the region ends with the memory;
+            * a :class:`spiflash.SpiFlash`, erased in 4KB sectors. *size* must be given;
+            * None, for the internal flash. *start* and *size* must be given, as well as *sector_size*, the size of its (uniform) erase units; *start* must be the address of a sector.
+
+        *start* and *size* are rounded to sectors, and at least two sectors are needed. A record must fit in a sector, along with 32 bytes of headers.
+
+        Records already in the region are kept, and the read position starts from the oldest one.
+
+    """
+    def __init__(self, flash, start=0, size=None, sector_size=None):
+        self._flash = flash
+        drv = 0
+        page_size = 256
+        if flash is None:
+            if size is None or sector_size is None:
+                raise ValueError
+            self._type = _FLASHLOG_INTERNAL
+        elif hasattr(flash,"get_geometry"):
+            flash_size, block_size, subblock_size, sector_size, page_size = flash.get_geometry()
+            if size is None:
+                size = flash_size-start
+            self._type = _FLASHLOG_QSPI
+        else:
+            if size is None:
+                raise ValueError
+            sector_size = 4096
+            page_size = flash.page_size
+            drv = flash.drvid
+            self._type = _FLASHLOG_SPI
+        if self._type != _FLASHLOG_INTERNAL:
+            end = (start+size)//sector_size*sector_size
+            start = (start+sector_size-1)//sector_size*sector_size
+            size = end-start
+        self._bus()
+        self._id = _attach(self._type,drv,start,size,sector_size,page_size,_SPI_CMD_SER4K)
+
+    def _bus(self):
+        if self._type == _FLASHLOG_SPI:
+            self._flash._bus()
+
+    def append(self, data, timestamp=0):
+        """
+.. method:: append(data, timestamp=0)
+
+        Append a record with payload *data* (bytes or bytearray) and *timestamp*, that must not be lower than the one of the previous record.
+
+        """
+        self._bus()
+        _append(self._id,data,timestamp)
+
+    def _as_sink(self):
+        # used by adc.Stream.pipe: records are appended from a native thread, the spi bus is configured once here
+        self._bus()
+        return _sink(self._id)
+
+    def read_records(self, n, buffer, offset=0):
+        """
+.. method:: read_records(n, buffer, offset=0)
+
+        Read up to *n* records from the read position, copying their payloads one after the other in the bytearray *buffer* starting at *offset*,
+        and stopping before the first record that does not fit in it. The read position moves past the records read.
+
+        Return a list of tuples *(timestamp, start, end)*, with the payload of each record in ``buffer[start:end]``. The list is empty at the end of the log.
+
+        """
+        self._bus()
+        return _read_records(self._id,n,buffer,offset)
+
+    def seek(self, timestamp):
+        """
+.. method:: seek(timestamp)
+
+        Move the read position to the first record with a timestamp not lower than *timestamp*.
+
+        """
+        self._bus()
+        _seek(self._id,timestamp)
+
+    def rewind(self):
+        """
+.. method:: rewind()
+
+        Move the read position to the oldest record.
+
+        """
+        self.seek(0)
+
+    def clear(self):
+        """
+.. method:: clear()
+
+        Erase all the records.
+
+        """
+        self._bus()
+        _clear(self._id)
+
+    def stats(self):
+        """
+.. method:: stats()
+
+        Return a tuple holding:
+
+        * *sectors*, number of sectors of the region;
+        * *used*, sectors holding records;
+        * *free*, bytes of payload that can be appended before the next sector is erased;
+        * *oldest*, timestamp of the oldest record (0 if the log is empty);
+        * *newest*, timestamp of the newest record (0 if the log is empty);
+        * *corrupted*, records skipped for a bad crc since the log was attached.
+
+        """
+        return _stats(self._id)
+
+    def close(self):
+        """
+.. method:: close()
+
+        Detach the log, freeing its RAM.
+
+        """
+        _detach(self._id)
+        self._id = -1
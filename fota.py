@@ -139,6 +139,17 @@ FOTA functions
 
     """
 
+import threading
+import queue
+
+@native_c("fdelta_new",["csrc/fota/*"])
+def _delta_new(old_addr,old_size):
+    pass
+
+@native_c("fdelta_run",["csrc/fota/*"])
+def _delta_run(state,data,ofs,out,outofs):
+    pass
+
 get_record           = __ota_get_record
 set_record           = __ota_set_record
 find_bytecode_slot   = __ota_find_bc_slot
@@ -184,3 +195,216 @@ def attempt(bcslot,vmslot):
     if not set_record((vmslot,working_vm,bcslot,working_bc)):
         raise RuntimeError
     return True
+
+
+class SlotWriter():
+    """
+Streaming slot writes
+---------------------
+
+.. class:: SlotWriter(addr, size=0, bufsize=4096, nbufs=2, hash=None)
+
+    Write a slot starting at :samp:`addr` from a stream of chunks, programming the flash in a separate thread while the next chunks are received.
+
+    Chunks passed to :meth:`write` are gathered in one of :samp:`nbufs` buffers of :samp:`bufsize` bytes; each full buffer is handed to the writer thread,
+    that calls :func:`write_slot` on it, and the next chunks go to a free buffer. The caller waits only when all the buffers are queued for programming,
+    so that an update takes about the time of the slower between the network and the flash.
+    If :samp:`size` is given, the slot is erased for :samp:`size` bytes first.
+
+    If :samp:`hash` is given (an object with ``update`` and ``digest`` methods, like ``sha2.SHA2()``), the writer thread updates it with every buffer once programmed,
+    so that the image is hashed while it is received and :meth:`digest` costs no further pass over the flash.
+
+    The writer can be used directly as the callback of :meth:`requests.Response.iter_content`: ::
+
+        w = fota.SlotWriter(fota.find_bytecode_slot(), size)
+        r = requests.get(url, stream=True)
+        r.iter_content(bytearray(1024), w.write)
+        w.close()
+        if w.checksum() != expected_md5:
+            raise ValueError
+
+    Hashing while writing, the signature of the image can be checked with :mod:`ecc` as soon as the last chunk is written: ::
+
+        w = fota.SlotWriter(fota.find_bytecode_slot(), size, hash=sha2.SHA2())
+        r.iter_content(bytearray(1024), w.write)
+        w.close()
+        if not ecc.verify(ecc.SECP256R1, w.digest(), signature, pbkey):
+            raise ValueError
+
+    """
+    def __init__(self, addr, size=0, bufsize=4096, nbufs=2, hash=None):
+        if size:
+            erase_slot(addr, size)
+        self.addr = addr
+        self.written = 0
+        self.hash = hash
+        self._bufsize = bufsize
+        self._free = queue.Queue()
+        self._full = queue.Queue()
+        for i in range(nbufs):
+            self._free.put(bytearray(bufsize))
+        self._buf = self._free.get()
+        self._pos = 0
+        self._exc = None
+        self._thread = threading.Thread(target=self._program)
+        self._thread.start()
+
+    def _program(self):
+        addr = self.addr
+        while True:
+            buf = self._full.get()
+            if buf is None:
+                break
+            if self._exc is None:
+                try:
+                    write_slot(addr, buf)
+                    if self.hash is not None:
+                        self.hash.update(buf)
+                except Exception as e:
+                    self._exc = e
+            addr += len(buf)
+            __elements_set(buf, self._bufsize)
+            self._free.put(buf)
+
+    def _queue(self):
+        if self._pos < self._bufsize:
+            __elements_set(self._buf, self._pos)
+        self._full.put(self._buf)
+        self.written += self._pos
+        self._buf = None
+        self._pos = 0
+
+    def write(self, data):
+        """
+.. method:: write(data)
+
+    Append :samp:`data` (bytes or bytearray) to the slot. Raises the exception of a failed flash write.
+
+        """
+        if self._exc is not None:
+            raise self._exc
+        n = len(data)
+        ofs = 0
+        while ofs < n:
+            if self._buf is None:
+                self._buf = self._free.get()
+            m = min(n-ofs, self._bufsize-self._pos)
+            self._buf[self._pos:self._pos+m] = data[ofs:ofs+m]
+            self._pos += m
+            ofs += m
+            if self._pos == self._bufsize:
+                self._queue()
+
+    def close(self):
+        """
+.. method:: close()
+
+    Program the data still buffered, wait for the writer thread and close the slot with :func:`close_slot`. Returns the number of bytes written.
+
+        """
+        if self._pos:
+            self._queue()
+        self._full.put(None)
+        self._thread.join()
+        close_slot(self.addr)
+        if self._exc is not None:
+            raise self._exc
+        return self.written
+
+    def checksum(self):
+        """
+.. method:: checksum()
+
+    Return the MD5 checksum of the bytes written, read back from the slot with :func:`checksum_slot`.
+
+        """
+        return checksum_slot(self.addr, self.written)
+
+    def digest(self):
+        """
+.. method:: digest()
+
+    Return the digest of the bytes written, computed by *hash* while writing. To be called after :meth:`close`.
+
+        """
+        return self.hash.digest()
+
+    def verify(self, expected):
+        """
+.. method:: verify(expected)
+
+    Return True if :meth:`digest` is equal to *expected*.
+
+        """
+        return self.hash.digest() == expected
+
+
+class DeltaPatcher():
+    """
+Delta updates
+-------------
+
+.. class:: DeltaPatcher(old_addr, old_size, callback, size=512)
+
+    Rebuild a new image from the old one at :samp:`old_addr` (e.g. the current bytecode slot, ``get_record()[6]``, or the current VM slot, ``get_record()[7]``)
+    and a delta patch given in pieces to :meth:`write`. The old image is read in place, at most :samp:`old_size` bytes of it.
+    The new image is produced in a bytearray of :samp:`size` bytes, reused for every piece and passed to :samp:`callback` (its length set to the bytes produced):
+    only the patch goes over the network, and RAM use does not depend on the size of the images.
+
+    A patch is a 12 bytes header (``ZDL1``, old size and new size as 32 bit little endian integers) followed by bsdiff records, one after the other:
+    the length of a diff block, the length of an extra block and a seek (as LEB128 varints, the seek zigzag encoded), then the diff block, whose bytes are added modulo 256
+    to the bytes of the old image at the current position, and the extra block, copied as it is. After each record the position in the old image moves by the seek.
+
+    Compressed patches can be fed through a :class:`zlib.Decompressor`: ::
+
+        w = fota.SlotWriter(fota.find_bytecode_slot(), new_size)
+        p = fota.DeltaPatcher(fota.get_record()[6], old_size, w.write)
+        d = zlib.Decompressor(callback=p.write)
+        r = requests.get(patch_url, stream=True)
+        r.iter_content(bytearray(512), d.write)
+        d.close()
+        p.close()
+        w.close()
+
+    .. attribute:: eof
+
+        True when the whole new image has been produced.
+
+    """
+    def __init__(self, old_addr, old_size, callback, size=512):
+        self._state = _delta_new(old_addr, old_size)
+        self._buf = bytearray(size)
+        self.callback = callback
+        self.eof = False
+
+    def write(self, data):
+        """
+.. method:: write(data)
+
+    Apply *data*, the next piece of the patch. Raises ``ValueError`` if the patch is not valid or does not match the old image.
+
+        """
+        size = len(self._buf)
+        ofs = 0
+        while not self.eof:
+            __elements_set(self._buf,size)
+            res = _delta_run(self._state,data,ofs,self._buf,0)
+            ofs = res[0]
+            n = res[1]
+            self.eof = res[2]
+            if n:
+                __elements_set(self._buf,n)
+                self.callback(self._buf)
+            # the buffer not filled means every byte of data has been used
+            if n<size and ofs>=len(data):
+                break
+
+    def close(self):
+        """
+.. method:: close()
+
+    Signal the end of the patch. Raises ``ValueError`` if the new image is incomplete.
+
+        """
+        if not self.eof:
+            raise ValueError
@@ -0,0 +1,292 @@
+"""
+.. module:: framebuf
+
+************
+Framebuffers
+************
+
+This module implements framebuffers for SPI displays, drawn and sent to the display natively. Two formats are supported:
+
+    * :samp:`RGB565`: 16 bits color pixels, for the panels driven with MIPI DCS commands (ST7735, ST7789, ILI9341, ILI9488 in 16 bits mode...)
+    * :samp:`MONO_VLSB`: monochrome pixels packed vertically in pages of 8 rows, for SSD1306 controllers
+
+Drawing (:meth:`FrameBuffer.fill_rect`, :meth:`FrameBuffer.blit`, :meth:`FrameBuffer.text`...) only changes the memory of the
+framebuffer and records the changed areas as dirty rectangles. :meth:`FrameBuffer.flush` sends just the dirty rectangles to the display,
+each one as a window of the controller followed by its pixels, without holding the interpreter: a label update sends a few hundred
+bytes instead of the whole frame. With :meth:`FrameBuffer.flush_async` the transfer runs in background while the next changes are drawn. ::
+
+    import spi
+    import framebuf
+
+    port = spi.Spi(D10, clock=40000000)
+    pinMode(D9, OUTPUT)
+    # ... display initialization commands, with D9 (data/command) low ...
+
+    fb = framebuf.FrameBuffer(240, 240)
+    fb.attach(port, D9)
+    fb.fill(0)
+    fb.flush()
+    while True:
+        fb.fill_rect(0, 0, 240, 16, framebuf.rgb(0,0,64))
+        fb.text(str(value), 2, 4, font, 0xffff)   # font: see below
+        fb.flush()
+
+Fonts are bytes objects, so they stay in flash: 4 header bytes (code of the first char, number of chars, width, height in pixels)
+followed by the glyphs, each of *height* rows of bits (msb first), each row starting on a new byte.
+
+The memory of the framebuffer is split in bands of at most 32 KB: a 240x240 RGB565 framebuffer takes 115 KB of RAM, a 128x64 MONO_VLSB one 1 KB.
+Bands are allocated with :func:`gc.buffer`, so on boards with external RAM the large ones are placed there.
+
+    """
+
+import gc
+
+RGB565 = 0
+MONO_VLSB = 1
+
+_MAX_BAND = 0x8000
+
+@native_c("__fb_state",["csrc/framebuf/framebuf.c"],["VHAL_SPI"])
+def _state(width,height,format,band_rows):
+    pass
+
+@native_c("__fb_fill_rect",["csrc/framebuf/framebuf.c"],["VHAL_SPI"])
+def _fill_rect(fb,x,y,w,h,color):
+    pass
+
+@native_c("__fb_pixel",["csrc/framebuf/framebuf.c"],["VHAL_SPI"])
+def _pixel(fb,x,y,color):
+    pass
+
+@native_c("__fb_blit",["csrc/framebuf/framebuf.c"],["VHAL_SPI"])
+def _blit(fb,data,x,y,w,h,key):
+    pass
+
+@native_c("__fb_text",["csrc/framebuf/framebuf.c"],["VHAL_SPI"])
+def _text(fb,font,text,x,y,fg,bg):
+    pass
+
+@native_c("__fb_mark",["csrc/framebuf/framebuf.c"],["VHAL_SPI"])
+def _mark(fb,x,y,w,h):
+    pass
+
+@native_c("__fb_take",["csrc/framebuf/framebuf.c"],["VHAL_SPI"])
+def _take(fb):
+    pass
+
+@native_c("__fb_flush",["csrc/framebuf/framebuf.c"],["VHAL_SPI"])
+def _flush(fb,rects,drvid,nss,dc,lock,xoff,yoff):
+    pass
+
+# native queues of queue.Queue, feeding the asynchronous flushes to a thread per bus
+@native_c("_queue_new",["csrc/threading/*"])
+def _queue_new(maxsize):
+    pass
+
+@native_c("_queue_put",["csrc/threading/*"])
+def _queue_put(q,obj,timeout):
+    pass
+
+@native_c("_queue_get",["csrc/threading/*"])
+def _queue_get(q,timeout,remove):
+    pass
+
+_async = {}
+
+def _async_worker(q):
+    while True:
+        fb,rects,done = _queue_get(q,-1,True)
+        try:
+            fb._send(rects)
+            fb.error = None
+        except Exception as e:
+            fb.error = e
+        if done:
+            done()
+
+
+def rgb(r, g, b):
+    """
+.. function:: rgb(r, g, b)
+
+    Return the RGB565 color of the 8 bits components *r*, *g* and *b*.
+
+    """
+    return ((r&0xf8)<<8)|((g&0xfc)<<3)|(b>>3)
+
+
+class FrameBuffer():
+    """
+=================
+FrameBuffer class
+=================
+
+.. class:: FrameBuffer(width, height, format=RGB565)
+
+    Create a framebuffer of *width* x *height* pixels in *format*, cleared to color 0 and all dirty.
+    Colors are RGB565 integers (see :func:`rgb`) or, for ``MONO_VLSB``, 0 and 1.
+
+    """
+    def __init__(self, width, height, format=RGB565):
+        self.width = width
+        self.height = height
+        self.format = format
+        self.error = None
+        self._port = None
+        stride = 2*width if format==RGB565 else width
+        rows = height if format==RGB565 else (height+7)//8
+        band = _MAX_BAND//stride
+        if band > rows:
+            band = rows
+        self._fb = [_state(width,height,format,band)]
+        for r in range(0,rows,band):
+            self._fb.append(gc.buffer(stride*min(band,rows-r)))
+        _mark(self._fb,0,0,width,height)
+
+    def fill(self, color):
+        """
+.. method:: fill(color)
+
+        Fill the framebuffer with *color*.
+
+        """
+        _fill_rect(self._fb,0,0,self.width,self.height,color)
+
+    def fill_rect(self, x, y, w, h, color):
+        """
+.. method:: fill_rect(x, y, w, h, color)
+
+        Fill the rectangle of *w* x *h* pixels at *x*, *y* with *color*. All drawing is clipped to the framebuffer.
+
+        """
+        _fill_rect(self._fb,x,y,w,h,color)
+
+    def rect(self, x, y, w, h, color):
+        """
+.. method:: rect(x, y, w, h, color)
+
+        Draw the outline of the rectangle of *w* x *h* pixels at *x*, *y* with *color*.
+
+        """
+        _fill_rect(self._fb,x,y,w,1,color)
+        _fill_rect(self._fb,x,y+h-1,w,1,color)
+        _fill_rect(self._fb,x,y,1,h,color)
+        _fill_rect(self._fb,x+w-1,y,1,h,color)
+
+    def hline(self, x, y, w, color):
+        """
+.. method:: hline(x, y, w, color)
+
+        Draw a horizontal line of *w* pixels from *x*, *y*.
+
+        """
+        _fill_rect(self._fb,x,y,w,1,color)
+
+    def vline(self, x, y, h, color):
+        """
+.. method:: vline(x, y, h, color)
+
+        Draw a vertical line of *h* pixels from *x*, *y*.
+
+        """
+        _fill_rect(self._fb,x,y,1,h,color)
+
+    def pixel(self, x, y, color=-1):
+        """
+.. method:: pixel(x, y, color=-1)
+
+        Set the pixel at *x*, *y* to *color*, or return its color if *color* is negative (-1 if out of the framebuffer).
+
+        """
+        return _pixel(self._fb,x,y,color)
+
+    def blit(self, data, x, y, w, h, key=-1):
+        """
+.. method:: blit(data, x, y, w, h, key=-1)
+
+        Copy the image *data* of *w* x *h* pixels at *x*, *y*. For ``RGB565`` framebuffers *data* holds 2 bytes per pixel,
+        high byte first; for ``MONO_VLSB`` ones it holds rows of bits, msb first, each row starting on a new byte.
+        Pixels of color *key* are not copied, if *key* is not negative. Images in bytes objects are read straight from flash.
+
+        """
+        _blit(self._fb,data,x,y,w,h,key)
+
+    def text(self, s, x, y, font, fg, bg=-1):
+        """
+.. method:: text(s, x, y, font, fg, bg=-1)
+
+        Draw the string *s* at *x*, *y* with *font* (see the module description) in color *fg*, over color *bg* or over
+        the framebuffer if *bg* is negative. Return the *x* following the text.
+
+        """
+        return _text(self._fb,font,s,x,y,fg,bg)
+
+    def invalidate(self, x=0, y=0, w=-1, h=-1):
+        """
+.. method:: invalidate(x=0, y=0, w=-1, h=-1)
+
+        Mark the rectangle dirty (the whole framebuffer with the defaults), so that the next flush sends it again.
+
+        """
+        _mark(self._fb,x,y,self.width if w<0 else w,self.height if h<0 else h)
+
+    def attach(self, port, dc, xoff=0, yoff=0):
+        """
+.. method:: attach(port, dc, xoff=0, yoff=0)
+
+        Set the display of the flushes: *port* is the :class:`spi.Spi` of the display controller (8 bits frames) and *dc* its
+        data/command pin, already set as output. *xoff* and *yoff* are the position of the framebuffer in the memory of the
+        controller, for panels smaller than it (*yoff* counts pages of 8 rows for ``MONO_VLSB``).
+
+        RGB565 rectangles are sent with the CASET, RASET and RAMWR commands; MONO_VLSB ones with the column and page address
+        commands of the SSD1306, that must be in horizontal addressing mode.
+
+        """
+        self._port = port
+        self._dc = dc
+        self._xoff = xoff
+        self._yoff = yoff
+
+    def _send(self, rects):
+        port = self._port
+        port._claim()
+        _flush(self._fb,rects,port.drvid,port.nss,self._dc,1,self._xoff,self._yoff)
+
+    def flush(self):
+        """
+.. method:: flush()
+
+        Send the dirty rectangles to the display set by :meth:`attach` and clear them.
+
+        """
+        if self._port is None:
+            raise RuntimeError
+        self._send(_take(self._fb))
+
+    def flush_async(self, done=None):
+        """
+.. method:: flush_async(done=None)
+
+        Take the dirty rectangles and queue them for a thread of this module, that sends them and calls *done* without
+        arguments, then return immediately. If the flush raised an exception, it is stored in the :attr:`error` attribute
+        before calling *done*, else :attr:`error` is set to None. At most 2 flushes per bus wait in the queue.
+
+        Drawing can go on meanwhile: pixels changed in a rectangle while it is sent may reach the display or not, but they are
+        dirty again and the next flush sends them. ::
+
+            sent = threading.Event()
+            sent.set()
+            while True:
+                draw(fb)
+                sent.wait()
+                sent.clear()
+                fb.flush_async(sent.set)
+
+        """
+        if self._port is None:
+            raise RuntimeError
+        drvid = self._port.drvid
+        if drvid not in _async:
+            _async[drvid] = _queue_new(2)
+            thread(_async_worker,_async[drvid])
+        _queue_put(_async[drvid],(self,_take(self._fb),done),-1)
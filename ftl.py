@@ -0,0 +1,196 @@
+"""
+.. module:: ftl
+
+***********************
+Flash Translation Layer
+***********************
+
+This module stores 512 bytes logical sectors on a :class:`qspiflash.QSpiFlash` or :class:`spiflash.SpiFlash` memory.
+
+Sectors are written as a log: every write programs a new copy of the sector in an already erased slot and
+obsoletes the previous one, so that writes need no erase and a write interrupted by a power loss leaves
+either the old or the new content of the sector. The map from logical sectors to flash slots is kept in RAM
+(2 bytes per sector) and rebuilt at start by reading the headers of the erase units.
+
+Erase units are reused picking the least erased one (wear levelling) and, when free units get scarce, the
+live sectors of an almost obsolete unit are moved away to free it (garbage collection).
+
+A volume can be mounted by :mod:`fatfs`, getting a FAT filesystem on flash with durable sector writes::
+
+    import fatfs
+    import ftl
+    import qspiflash
+
+    disk = ftl.Ftl(qspiflash.QSpiFlash())
+    fatfs.mount("0:", {"ftl": disk})
+    fatfs.mkfs("0:")   # first time only
+
+    """
+
+_FTL_QSPI = 0
+_FTL_SPI  = 1
+
+# 4KB sector erase command of spiflash
+_SPI_CMD_SER4K = 0x20
+
+SECTOR_SIZE = 512
+
+@native_c("ftl_attach",["csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _attach(type,drv,start,size,block_size,page_size,erase_cmd,sectors):
+    pass
+
+@native_c("ftl_detach",["csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _detach(id):
+    pass
+
+@native_c("ftl_read_sectors",["csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _read_sectors(id,sector,buffer,ofs,count):
+    pass
+
+@native_c("ftl_write_sectors",["csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _write_sectors(id,sector,data):
+    pass
+
+@native_c("ftl_trim",["csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _trim(id,sector,count):
+    pass
+
+@native_c("ftl_format",["csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _format(id):
+    pass
+
+@native_c("ftl_stats",["csrc/ftl/*","csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _stats(id):
+    pass
+
+class Ftl():
+    """
+=========
+Ftl class
+=========
+
+.. class:: Ftl(flash, start=0, size=None, sectors=0)
+
+        Attach a translation layer to the region of *flash* beginning at address *start* and *size* bytes long
+        (up to the end of the memory if *size* is None). *start* and *size* are rounded to erase units.
+
+        *flash* can be:
+
+            * a :class:`qspiflash.QSpiFlash`, whose erase unit is the sector size of its geometry;
+            * a :class:`spiflash.SpiFlash`, erased in 4KB sectors. Its *size* must be given, and its bus must not be shared with other Spi instances while the volume is mounted by :mod:`fatfs`.
+
+        *sectors* is the number of logical sectors of the volume: by default 1/8 of the erase units (3 at least) is left
+        for garbage collection, and the more room is left, the less sectors are moved by garbage collections.
+        The first slot of every erase unit holds its header, so that for 4KB units 7 sectors of 512 bytes are stored in each of them.
+
+        Attaching a region that has never held a volume is allowed: all its sectors read as 0xff.
+        The content of the region is replaced, but only as sectors are written.
+
+    """
+    def __init__(self, flash, start=0, size=None, sectors=0):
+        self._flash = flash
+        if hasattr(flash,"get_geometry"):
+            flash_size, block_size, subblock_size, erase_size, page_size = flash.get_geometry()
+            self._type = _FTL_QSPI
+            drv = 0
+        else:
+            if size is None:
+                raise ValueError
+            flash_size = start+size
+            erase_size = 4096
+            page_size = flash.page_size
+            self._type = _FTL_SPI
+            drv = flash.drvid
+        if size is None:
+            size = flash_size-start
+        end = (start+size)//erase_size*erase_size
+        start = (start+erase_size-1)//erase_size*erase_size
+        self._bus()
+        self._id = _attach(self._type,drv,start,end-start,erase_size,page_size,_SPI_CMD_SER4K,sectors)
+
+    def _bus(self):
+        if self._type == _FTL_SPI:
+            self._flash._bus()
+
+    def read(self, sector, n=1):
+        """
+.. method:: read(sector, n=1)
+
+        Return a bytearray with the *n* sectors starting at *sector*.
+
+        """
+        res = bytearray(n*SECTOR_SIZE)
+        self._bus()
+        _read_sectors(self._id,sector,res,0,n)
+        return res
+
+    def read_into(self, sector, buffer, offset=0, n=-1):
+        """
+.. method:: read_into(sector, buffer, offset=0, n=-1)
+
+        Read *n* sectors starting at *sector* into the bytearray *buffer*, starting at position *offset*.
+        If *n* is negative, the whole sectors fitting in *buffer* after *offset* are read. Returns the number of sectors read.
+
+        """
+        if n<0:
+            n = (len(buffer)-offset)//SECTOR_SIZE
+        self._bus()
+        _read_sectors(self._id,sector,buffer,offset,n)
+        return n
+
+    def write(self, sector, data):
+        """
+.. method:: write(sector, data)
+
+        Write *data*, whose length must be a multiple of 512, to the sectors starting at *sector*.
+        Each sector is durable when written: a power loss during the call leaves every sector with its old or its new content.
+
+        """
+        self._bus()
+        _write_sectors(self._id,sector,data)
+
+    def trim(self, sector, n=1):
+        """
+.. method:: trim(sector, n=1)
+
+        Discard the *n* sectors starting at *sector*: they read as 0xff, and are not moved by garbage collections, until written again.
+
+        """
+        self._bus()
+        _trim(self._id,sector,n)
+
+    def format(self):
+        """
+.. method:: format()
+
+        Erase the whole region, discarding all the sectors. Erase counts are preserved.
+
+        """
+        self._bus()
+        _format(self._id)
+
+    def stats(self):
+        """
+.. method:: stats()
+
+        Return a tuple holding:
+
+        * *sectors*, number of logical sectors of the volume;
+        * *free_units*, erase units holding no live sector;
+        * *min_erases*, lowest erase count of the units;
+        * *max_erases*, highest erase count of the units;
+        * *collections*, garbage collections since the volume was attached;
+        * *moved*, sectors moved by garbage collections since the volume was attached.
+
+        """
+        return _stats(self._id)
+
+    def close(self):
+        """
+.. method:: close()
+
+        Detach the volume, freeing its RAM. It must not be mounted by :mod:`fatfs` anymore.
+
+        """
+        _detach(self._id)
+        self._id = -1
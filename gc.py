@@ -8,11 +8,27 @@ Garbage Collector
 
 This module allows the interaction with the garbage collector from Zerynth programs.
 
+A collection stops all threads while the whole heap is scanned. Programs with timing constraints can
+disable the periodic collections and run them where a pause is harmless, with :func:`step`: ::
+
+    import gc
+    import timers
+
+    gc.disable()
+    while True:
+        t0 = timers.now()
+        control()
+        # collect only if the pause fits the rest of the 20 ms cycle
+        gc.step((20-(timers.now()-t0))*1000)
+        sleep(20-(timers.now()-t0))
+
+Collections still happen when memory runs out, regardless of :func:`disable`.
+
 
     """
 
 @native_c("__gc",["csrc/gc/*"])
-def __gc(code,timeout=0):
+def __gc(code,arg=0,arg2=0):
     pass
 
 def info():
@@ -31,13 +47,253 @@ def info():
     """
     return __gc(GC_CMD_INFO)
 
+def freemap():
+    """
+.. function:: freemap()
+
+    Returns a tuple *(histogram, largest, edge)* describing the free memory:
+
+        * *histogram* is a tuple with the number of free blocks smaller than 64, 256, 1024, 4096, 16384 bytes, and larger
+        * *largest* is the size in bytes of the largest free block: allocations bigger than this fail, even if enough memory is free
+        * *edge* is the free memory at the end of the heap, never used since the last compaction
+
+    The heap is walked with memory allocations locked, so the call takes time proportional to the number of blocks.
+    """
+    return __gc(GC_CMD_FREEMAP)
+
+_reserved = []
+
+def reserve(size,n=1):
+    """
+.. function:: reserve(size,n=1)
+
+    Allocates *n* bytearrays of *size* bytes, to be handed out by :func:`acquire` instead of allocating
+    large buffers on the fly. Call it at startup, when the heap is not fragmented yet: the reserved buffers are never collected,
+    so later the program can always obtain large buffers, however fragmented the rest of the heap becomes.
+    """
+    for i in range(n):
+        _reserved.append([bytearray(size),False])
+
+def acquire(size):
+    """
+.. function:: acquire(size)
+
+    Returns the smallest free reserved buffer of at least *size* bytes, marking it as used, or allocates a new bytearray of *size*
+    bytes with :func:`buffer` if there is none. The returned buffer can be longer than *size*.
+    """
+    best = None
+    for r in _reserved:
+        if not r[1] and len(r[0])>=size and (best is None or len(r[0])<len(best[0])):
+            best = r
+    if best is None:
+        return buffer(size)
+    best[1] = True
+    return best[0]
+
+def release(buf):
+    """
+.. function:: release(buf)
+
+    Gives back to the reserved buffers a buffer returned by :func:`acquire`. Buffers not reserved are left to the garbage collector.
+    """
+    for r in _reserved:
+        if r[0] is buf:
+            r[1] = False
+            return
+
+INT = 0
+EXT = 1
+AUTO = 2
+
+@native_c("_gc_ext_init",["csrc/gc/*"])
+def _gc_ext_init(address,size):
+    pass
+
+@native_c("_gc_ext_bytearray",["csrc/gc/*"])
+def _gc_ext_bytearray(size,region):
+    pass
+
+@native_c("_gc_ext_info",["csrc/gc/*"])
+def _gc_ext_info():
+    pass
+
+@native_c("_gc_ext_threshold",["csrc/gc/*"])
+def _gc_ext_threshold(size):
+    pass
+
+def ext_init(address,size):
+    """
+.. function:: ext_init(address,size)
+
+    Gives to the memory manager *size* bytes of external RAM (PSRAM, SDRAM) starting at *address*, to hold large bytearrays
+    out of the internal heap. Boards that set up their external memory at startup declare the region with the
+    ``GC_EXT_BASE`` and ``GC_EXT_SIZE`` defines instead; otherwise call it once the memory controller is configured,
+    before allocating external buffers.
+
+    External memory is slower than the internal one, but there is much more of it: buffers filled by peripherals or
+    sent on the network (frame buffers, capture buffers, packets) can live there, while small objects used often stay in the
+    internal heap. ::
+
+        import gc
+
+        gc.ext_init(0xC0000000,8*1024*1024)
+        frame = gc.buffer(320*40*2)          # external, being larger than the threshold
+        line = gc.buffer(64,gc.EXT)          # external anyway
+
+    External bytearrays are freed by the collections started from Python, and when the external memory is full:
+    a collection then scans the internal heap for references to them. Therefore they must be referenced by Python objects
+    (a buffer known only to C code is freed) and must keep their length: append, extend and slice assignments changing it
+    are not supported. At most 64 external buffers are live at once,
+    ``GC_EXT_MAX_BUFFERS`` changes the limit.
+    """
+    _gc_ext_init(address,size)
+
+def buffer(size,region=AUTO):
+    """
+.. function:: buffer(size,region=AUTO)
+
+    Returns a new bytearray of *size* zeroed bytes (at most 65535) placed in *region*:
+
+        * ``INT``: the internal heap, as :samp:`bytearray(size)`
+        * ``EXT``: the external memory. Raises :samp:`UnsupportedError` if there is none and :samp:`RuntimeError` if it is full
+        * ``AUTO``: the external memory if *size* is at least the threshold of :func:`ext_threshold` and it fits,
+          otherwise the internal heap
+    """
+    return _gc_ext_bytearray(size,region)
+
+def ext_threshold(size=4096):
+    """
+.. function:: ext_threshold(size=4096)
+
+    Sets the size in bytes from which :func:`buffer` places bytearrays in the external memory when *region* is ``AUTO``.
+    The default can also be set with the ``GC_EXT_THRESHOLD`` define.
+    """
+    _gc_ext_threshold(size)
+
+def ext_info():
+    """
+.. function:: ext_info()
+
+    Returns a tuple of integers about the external memory, all zero but the threshold if there is none:
+
+        0. Total memory in bytes
+        1. Free memory in bytes
+        2. Size of the largest bytearray that fits
+        3. Number of allocated buffers
+        4. Threshold of ``AUTO`` placement in bytes
+    """
+    return _gc_ext_info()
+
 def collect():
     """
 .. function:: collect()
 
-    Starts a collection
+    Runs a full collection, freeing also the unreferenced external buffers, and returns its duration in microseconds.
+    """
+    return __gc(GC_CMD_COLLECT)
+
+def step(budget,min_free=4096):
+    """
+.. function:: step(budget,min_free=4096)
+
+    Runs a collection only if it is expected to last at most *budget* microseconds, or if less than *min_free* bytes are free.
+    The expected duration follows the collections run by :func:`collect` and :func:`step`: it rises at once to a longer pause
+    and decreases slowly. Returns the duration of the collection, -1 if skipped.
+
+    The first call always collects, to learn the duration.
+    """
+    return __gc(GC_CMD_STEP,budget,min_free)
+
+def pauses():
+    """
+.. function:: pauses()
+
+    Returns a tuple of integers about the collections run by :func:`collect` and :func:`step`:
+
+        0. Duration of the last one in microseconds
+        1. Longest duration in microseconds
+        2. Expected duration in microseconds, as used by :func:`step`
+        3. Number of collections
+    """
+    return __gc(GC_CMD_PAUSES)
+
+@native_c("_gc_track",["csrc/gc/*"])
+def _gc_track(period):
+    pass
+
+@native_c("_gc_alloc_stats",["csrc/gc/*"])
+def _gc_alloc_stats(top_n):
+    pass
+
+def alloc_track(period=1):
     """
-    __gc(GC_CMD_COLLECT)
+.. function:: alloc_track(period=1)
+
+    Starts the allocation tracker, clearing its statistics, or stops it if *period* is 0.
+
+    Every *period* milliseconds the tracker charges the memory allocated since the previous sample to the Python code running
+    at the sample. Sampling is statistical: a site allocating in the same period of others is charged for them too, and a site
+    that rarely runs at a sample can be missed. Shorter periods are more precise, and cost more. Up to 32 sites are tracked.
+    """
+    _gc_track(period)
+
+def alloc_stats(top_n=10):
+    """
+.. function:: alloc_stats(top_n=10)
+
+    Returns a tuple *(sites, native)*: *sites* is a list of the *top_n* sites that allocated most since :func:`alloc_track`,
+    as tuples *(module, code, pc, count, bytes)* of decreasing *bytes*; *native* counts the bytes allocated while no Python
+    code was running. *module*, *code* and *pc* locate the bytecode as in traceback entries, and are mapped to source lines with
+    the debug information of the compiled program. *count* estimates the number of allocated objects.
+
+    Memory freed by collections is not counted, so the figures measure heap churn: run with the garbage collector enabled or
+    disabled as in production. ::
+
+        gc.alloc_track()
+        for i in range(1000):
+            hot_loop()
+        for site in gc.alloc_stats(5)[0]:
+            print(site)
+    """
+    return _gc_alloc_stats(top_n)
+
+POOL_TUPLE = 0
+POOL_BYTEARRAY = 1
+POOL_FLOAT = 2
+
+@native_c("_gc_pool_new",["csrc/gc/*"])
+def _gc_pool_new(kind,n,size):
+    pass
+
+@native_c("_gc_pool_take",["csrc/gc/*"])
+def _gc_pool_take(pool):
+    pass
+
+class Pool():
+    """
+.. class:: Pool(kind,n,size=0)
+
+    Create a pool of *n* preallocated objects of the same *kind*:
+
+        * ``POOL_TUPLE``: tuples of *size* items
+        * ``POOL_BYTEARRAY``: bytearrays of *size* bytes
+        * ``POOL_FLOAT``: floats
+
+    Objects are handed out round robin, so the object returned by a take is returned again after *n* more takes:
+    code using a pool must be done with an object (or copy it) before that. In exchange the pool memory is allocated once,
+    and reads that produce many small results do not churn and fragment the heap.
+    Drivers accept a pool where documented, for example :meth:`can.Can.receive`.
+
+    .. method:: take()
+
+        Return the next object of the pool.
+
+    """
+    def __init__(self,kind,n,size=0):
+        self.pool = _gc_pool_new(kind,n,size)
+
+    def take(self):
+        return _gc_pool_take(self.pool)
 
 def enable(period=500):
     """
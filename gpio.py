@@ -127,6 +127,64 @@ def mode(pin,pinmode):
                 return
     pinMode(pin,pinmode)
 
+@native_c("_gpio_group",["csrc/gpio/*"])
+def group(pins):
+    """
+.. function:: group(pins)
+
+    Return a group for the list or tuple *pins* of up to 32 mcu pins, to be passed to :func:`port_write`, :func:`port_read` and
+    :func:`bus_write` in place of *pins*. The pins of a group are looked up once, so the port functions run faster with it.
+    Port expander pins cannot be part of a group.
+
+    """
+    pass
+
+@native_c("_gpio_port_write",["csrc/gpio/*"])
+def _gpio_port_write(pins,value,mask):
+    pass
+
+def port_write(pins,value,mask=-1):
+    """
+.. function:: port_write(pins,value,mask=-1)
+
+    Set at once the mcu pins of *pins* (a list, tuple, or :func:`group`): the i-th pin is set to bit i of *value*.
+    Only the pins whose bit is set in *mask* are changed. Pins must already be configured as outputs with :func:`mode`. ::
+
+        lcd_bus = gpio.group([D0,D1,D2,D3,D4,D5,D6,D7])
+        gpio.port_write(lcd_bus,0xa5)
+        gpio.port_write(lcd_bus,0x0f,mask=0x03)    # only D0 and D1 are changed
+
+    """
+    _gpio_port_write(pins,value,mask)
+
+@native_c("_gpio_port_read",["csrc/gpio/*"])
+def port_read(pins):
+    """
+.. function:: port_read(pins)
+
+    Return the value of the mcu pins of *pins* (a list, tuple, or :func:`group`) as an integer, the i-th pin in bit i.
+
+    """
+    pass
+
+@native_c("_gpio_bus_write",["csrc/gpio/*"])
+def _gpio_bus_write(pins,data,strobe,active):
+    pass
+
+def bus_write(pins,data,strobe=-1,active=LOW):
+    """
+.. function:: bus_write(pins,data,strobe=-1,active=LOW)
+
+    Write the bytes of *data* (or the items of a shortarray, for buses wider than 8 pins) one after the other on the parallel bus
+    *pins* (a list, tuple, or :func:`group`), as :func:`port_write` does. If *strobe* is a pin, after each value it is driven to
+    *active* and back, latching the value into the peripheral (the WR pin of 8080 parallel displays, active low).
+    The whole *data* is written natively, without holding the interpreter. ::
+
+        gpio.bus_write(lcd_bus,pixels,strobe=D8)
+
+    """
+    _gpio_bus_write(pins,data,strobe,active)
+
 def add_expander(id, pdriver, pinmap):
     """
 .. function:: add_expander(id, pdriver, pinmap)
@@ -0,0 +1,78 @@
+"""
+.. module:: heapq
+
+*************
+Heap Queue
+*************
+
+This module implements natively the heap queue algorithm, as the :samp:`heapq` module of Python: a heap is a plain list
+where ``heap[k] <= heap[2*k+1]`` and ``heap[k] <= heap[2*k+2]``, so that ``heap[0]`` is always its smallest item.
+Pushing and popping take O(log n) comparisons in a single native call, while keeping a list sorted by insertion
+takes O(n) steps. Heaps are the priority queues of schedulers and retransmission timers. ::
+
+    import heapq
+
+    timeouts = []
+    heapq.heappush(timeouts, (deadline, seq, packet))
+    ...
+    while timeouts and timeouts[0][0] <= now:
+        deadline, seq, packet = heapq.heappop(timeouts)
+
+Items are compared natively with ``<``: they can be numbers, strings or tuples of them. Instances of Python classes can't
+be compared by the heap, so they are pushed inside tuples with a unique number before them, as *seq* above, that also keeps
+items of equal priority in order of insertion.
+
+    """
+
+@native_c("_heapq_push",["csrc/collections/heapq.c"])
+def heappush(heap, item):
+    """
+.. function:: heappush(heap, item)
+
+    Push *item* onto *heap*.
+
+    """
+    pass
+
+@native_c("_heapq_pop",["csrc/collections/heapq.c"])
+def heappop(heap):
+    """
+.. function:: heappop(heap)
+
+    Pop and return the smallest item of *heap*. Raise :samp:`IndexError` if *heap* is empty.
+
+    """
+    pass
+
+@native_c("_heapq_replace",["csrc/collections/heapq.c"])
+def _heapq_replace(heap,item,push_first):
+    pass
+
+@native_c("_heapq_heapify",["csrc/collections/heapq.c"])
+def heapify(x):
+    """
+.. function:: heapify(x)
+
+    Transform the list *x* into a heap, in place, in linear time.
+
+    """
+    pass
+
+def heappushpop(heap, item):
+    """
+.. function:: heappushpop(heap, item)
+
+    Push *item* onto *heap*, then pop and return the smallest item: faster than :func:`heappush` followed by :func:`heappop`.
+
+    """
+    return _heapq_replace(heap,item,True)
+
+def heapreplace(heap, item):
+    """
+.. function:: heapreplace(heap, item)
+
+    Pop and return the smallest item of *heap*, then push *item*: faster than :func:`heappop` followed by :func:`heappush`,
+    and the size of *heap* does not change. Raise :samp:`IndexError` if *heap* is empty.
+
+    """
+    return _heapq_replace(heap,item,False)
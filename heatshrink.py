@@ -0,0 +1,365 @@
+"""
+.. module:: heatshrink
+
+**********
+Heatshrink
+**********
+
+This module compresses and decompresses data in the `heatshrink <https://github.com/atomicobject/heatshrink>`_ format, an LZSS variant designed for
+small microcontrollers: unlike :mod:`zlib`, it compresses too, with a few hundred bytes of RAM, and it is fast enough to compress logs and payloads
+as they are produced. Text and telemetry usually shrink to 40-60% of their size.
+
+The format has two parameters, that compressor and decompressor must agree on since they are not stored in the compressed data:
+
+    * *window*, 8 to 12: matches are searched in the last 2**\ *window* bytes (256 bytes to 4KB)
+    * *lookahead*, 3 to *window* - 1: matches are at most 2**\ *lookahead* bytes long
+
+The defaults (8 and 4) match the defaults of the heatshrink command line tool, so that data compressed on a device can be decompressed with
+``heatshrink -d -w 8 -l 4`` and vice versa. The decompressor needs 2**\ *window* bytes of RAM, the compressor about 4 times as much plus 512 bytes.
+
+Both directions are streaming: data can be given in pieces of any size and the output is produced in caller chosen buffers, with no allocation
+after the compressor or decompressor is created. Records of a :class:`flashlog.FlashLog` and request bodies can be compressed one by one::
+
+    import heatshrink
+
+    log.append(heatshrink.compress(record))
+
+    r = requests.post(url,data=heatshrink.compress(payload),headers={"content-encoding":"heatshrink"})
+
+Streams can be compressed while they are written and decompressed while they are read::
+
+    f = heatshrink.CompressStream(open("/zt/log.hs","w"))
+    f.write(line)
+    f.close()
+
+    f = heatshrink.DecompressStream(open("/zt/log.hs","r"))
+    line = f.readline()
+
+    """
+
+import streams
+
+WINDOW = 8
+LOOKAHEAD = 4
+
+@native_c("hs_encoder_new",["csrc/heatshrink/*"])
+def _encoder(window,lookahead):
+    pass
+
+@native_c("hs_decoder_new",["csrc/heatshrink/*"])
+def _decoder(window,lookahead):
+    pass
+
+@native_c("hs_encode",["csrc/heatshrink/*"])
+def _encode(state,data,ofs,out,outofs,finish):
+    pass
+
+@native_c("hs_decode",["csrc/heatshrink/*"])
+def _decode(state,data,ofs,out,outofs):
+    pass
+
+
+class Compressor():
+    """
+================
+Compressor class
+================
+
+.. class:: Compressor(window=8,lookahead=4,callback=None,size=256)
+
+    Create a compressor. Its output is produced in a bytearray of *size* bytes, reused for every piece:
+    if *callback* is given it is called with the bytearray after each piece (its length set to the bytes produced), otherwise the pieces are collected and
+    returned by :meth:`write` and :meth:`flush`.
+
+    Raises ``ValueError`` if *window* or *lookahead* are out of range.
+
+    """
+    def __init__(self,window=WINDOW,lookahead=LOOKAHEAD,callback=None,size=256):
+        self._state = _encoder(window,lookahead)
+        self._params = (window,lookahead)
+        self._buf = bytearray(size)
+        self.callback = callback
+        self.done = False
+
+    def compress_into(self,data,out,ofs=0,outofs=0):
+        """
+.. method:: compress_into(data,out,ofs=0,outofs=0)
+
+    Compress the bytes of the byte sequence *data* from position *ofs*, writing the output in the bytearray *out* from position *outofs* up to its length.
+    Returns a tuple *(ofs, outofs)* with the positions reached: *ofs* is less than the length of *data* only when *out* is full, and the rest of *data*
+    must be given again after making room in *out*. Some bytes are kept by the compressor until more data or :meth:`finish_into` is given.
+
+        """
+        res = _encode(self._state,data,ofs,out,outofs,False)
+        return (res[0],res[1])
+
+    def finish_into(self,out,outofs=0):
+        """
+.. method:: finish_into(out,outofs=0)
+
+    Write the bytes kept by the compressor, ending the compressed stream, in the bytearray *out* from position *outofs*.
+    Returns the position reached in *out*, or -1 if *out* is full and :meth:`finish_into` must be called again after making room.
+    The compressor can't be used anymore after the end, until :meth:`reset`.
+
+        """
+        res = _encode(self._state,"",0,out,outofs,True)
+        self.done = res[2]
+        if not self.done:
+            return -1
+        return res[1]
+
+    def reset(self):
+        """
+.. method:: reset()
+
+    Start a new compressed stream.
+
+        """
+        self._state = _encoder(self._params[0],self._params[1])
+        self.done = False
+
+    def _run(self,data,finish):
+        out = None
+        if self.callback is None:
+            out = bytearray()
+        size = len(self._buf)
+        ofs = 0
+        while True:
+            __elements_set(self._buf,size)
+            res = _encode(self._state,data,ofs,self._buf,0,finish)
+            ofs = res[0]
+            n = res[1]
+            if n:
+                __elements_set(self._buf,n)
+                if out is None:
+                    self.callback(self._buf)
+                else:
+                    out.extend(self._buf)
+            if finish:
+                if res[2]:
+                    break
+            elif n<size and ofs>=len(data):
+                break
+        self.done = finish
+        return out
+
+    def write(self,data):
+        """
+.. method:: write(data)
+
+    Compress the byte sequence *data*. Returns None if a *callback* is set, otherwise a bytearray with the output (possibly empty).
+
+        """
+        return self._run(data,False)
+
+    def flush(self):
+        """
+.. method:: flush()
+
+    End the compressed stream, producing the bytes kept by the compressor. Returns None if a *callback* is set, otherwise a bytearray with the output.
+    The compressor is then ready for a new stream.
+
+        """
+        out = self._run("",True)
+        self.reset()
+        return out
+
+
+class Decompressor():
+    """
+==================
+Decompressor class
+==================
+
+.. class:: Decompressor(window=8,lookahead=4,callback=None,size=256)
+
+    Create a decompressor for a stream compressed with the same *window* and *lookahead*. As for :class:`Compressor`, the output is produced in a reused
+    bytearray of *size* bytes, given to *callback* or collected and returned by :meth:`write`.
+
+    Raises ``ValueError`` if *window* or *lookahead* are out of range.
+
+    """
+    def __init__(self,window=WINDOW,lookahead=LOOKAHEAD,callback=None,size=256):
+        self._state = _decoder(window,lookahead)
+        self._params = (window,lookahead)
+        self._buf = bytearray(size)
+        self.callback = callback
+
+    def decompress_into(self,data,out,ofs=0,outofs=0):
+        """
+.. method:: decompress_into(data,out,ofs=0,outofs=0)
+
+    Decompress the bytes of the byte sequence *data* from position *ofs*, writing the output in the bytearray *out* from position *outofs* up to its length.
+    Returns a tuple *(ofs, outofs)* with the positions reached: *ofs* is less than the length of *data* only when *out* is full, and the rest of *data*
+    must be given again after making room in *out*.
+
+        """
+        return _decode(self._state,data,ofs,out,outofs)
+
+    def reset(self):
+        """
+.. method:: reset()
+
+    Start decompressing a new stream.
+
+        """
+        self._state = _decoder(self._params[0],self._params[1])
+
+    def write(self,data):
+        """
+.. method:: write(data)
+
+    Decompress the byte sequence *data*, the next piece of the compressed stream. Returns None if a *callback* is set, otherwise a bytearray with the output.
+    Being a single argument method, :meth:`write` can be given as callback to :meth:`requests.Response.iter_content` or to a *stream_callback*.
+
+        """
+        out = None
+        if self.callback is None:
+            out = bytearray()
+        size = len(self._buf)
+        ofs = 0
+        while True:
+            __elements_set(self._buf,size)
+            res = _decode(self._state,data,ofs,self._buf,0)
+            ofs = res[0]
+            n = res[1]
+            if n:
+                __elements_set(self._buf,n)
+                if out is None:
+                    self.callback(self._buf)
+                else:
+                    out.extend(self._buf)
+            if n<size and ofs>=len(data):
+                break
+        return out
+
+
+def compress(data,window=WINDOW,lookahead=LOOKAHEAD):
+    """
+.. function:: compress(data,window=8,lookahead=4)
+
+    Returns a bytearray with the compressed contents of the byte sequence *data*.
+
+    """
+    c = Compressor(window,lookahead,None,len(data)//2+16)
+    out = c.write(data)
+    out.extend(c.flush())
+    return out
+
+def decompress(data,window=WINDOW,lookahead=LOOKAHEAD):
+    """
+.. function:: decompress(data,window=8,lookahead=4)
+
+    Returns a bytearray with the decompressed contents of the byte sequence *data*.
+
+    """
+    d = Decompressor(window,lookahead,None,2*len(data)+16)
+    return d.write(data)
+
+
+class CompressStream(streams.stream):
+    """
+====================
+CompressStream class
+====================
+
+.. class:: CompressStream(dest,window=8,lookahead=4,size=256)
+
+    Create a stream writing the compressed contents of what is written to it into the stream *dest* (for example a :class:`streams.FileStream` or a socket),
+    *size* bytes at a time. :meth:`close` must be called to write the end of the compressed stream: it closes *dest* too.
+
+    """
+    def __init__(self,dest,window=WINDOW,lookahead=LOOKAHEAD,size=256):
+        self.dest = dest
+        self._c = Compressor(window,lookahead,self._out,size)
+
+    def _out(self,buf):
+        self.dest.write(buf)
+
+    def _readbuf(self,buf,size=1,ofs=0):
+        raise UnsupportedError
+
+    def write(self,buf):
+        self._c.write(buf)
+        return len(buf)
+
+    def flush(self):
+        """
+.. method:: flush()
+
+    End the compressed stream, writing everything to *dest*. Data written afterwards start a new compressed stream, that can be decompressed by itself.
+
+        """
+        self._c.flush()
+
+    def close(self):
+        self._c.flush()
+        self.dest.close()
+
+
+class DecompressStream(streams.stream):
+    """
+======================
+DecompressStream class
+======================
+
+.. class:: DecompressStream(source,window=8,lookahead=4,size=256)
+
+    Create a stream reading the decompressed contents of the stream *source* (for example a :class:`streams.FileStream`, a socket or a flash region):
+    *source* can be any object with a *_readbuf* or *read* method, and is read *size* bytes at a time into a reused buffer.
+    Reading methods (:meth:`read`, :meth:`readline`...) return empty bytearrays once *source* is exhausted.
+
+    """
+    def __init__(self,source,window=WINDOW,lookahead=LOOKAHEAD,size=256):
+        self.source = source
+        self._state = _decoder(window,lookahead)
+        self._in = bytearray(size)
+        self._pos = 0
+        __elements_set(self._in,0)
+        self._size = size
+        self._readin = hasattr(source,"_readbuf")
+        self.eof = False
+
+    def _fill(self):
+        if self._readin:
+            __elements_set(self._in,self._size)
+            n = self.source._readbuf(self._in,self._size)
+            if n<0:
+                raise IOError
+            __elements_set(self._in,n)
+        else:
+            self._in = self.source.read(self._size)
+        self._pos = 0
+        if not len(self._in):
+            self.eof = True
+
+    def _readbuf(self,buf,size=1,ofs=0):
+        # the decoder fills buf up to its length: limit it to size bytes
+        blen = len(buf)
+        if ofs+size<blen:
+            __elements_set(buf,ofs+size)
+        n = 0
+        while not n:
+            if self._pos>=len(self._in) and not self.eof:
+                try:
+                    self._fill()
+                except Exception as e:
+                    __elements_set(buf,blen)
+                    raise e
+            # with no input left, the end of a pending copy is still produced
+            res = _decode(self._state,self._in,self._pos,buf,ofs)
+            self._pos = res[0]
+            n = res[1]-ofs
+            if self.eof:
+                break
+        __elements_set(buf,blen)
+        return n
+
+    def write(self,buf):
+        raise UnsupportedError
+
+    def available(self):
+        return not self.eof or self._pos<len(self._in)
+
+    def close(self):
+        self.source.close()
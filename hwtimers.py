@@ -7,7 +7,8 @@ Hardware Timers
 
 This module implements the interface to the hardware timers of the board, allowing a greater precision in time measuring or time constrained tasks.
 
-Currently, only the sleep_micros function is implemented
+Threads sleeping on the hardware timer are suspended and resumed by its interrupt, so other threads keep running meanwhile.
+At most 8 threads can sleep at the same time.
 	"""
 
 
@@ -24,7 +25,7 @@ def sleep_micros(n):
 .. function:: sleep_micros(n)
 
     Suspend the current thread for *n* microseconds by using the functionalities of an high precision
-    hardware timer. Currently, sleep_micros is not thread safe, and can't be called simultaneously by more than one thread.
+    hardware timer. Several threads can sleep at the same time.
 
     The actual amount of microseconds between the call and return of sleep_micros is usually greater than *n* due to the overhead of calling,
     returning and thread switching.
@@ -33,3 +34,34 @@ def sleep_micros(n):
 	pass
 
 
+@native_c("hwtimers_micros",["csrc/hwtimers/*"],["VHAL_HTM"])
+def micros():
+	"""
+.. function:: micros()
+
+    Return the number of microseconds since the module was imported, from a monotonic clock.
+    The value has 64 bits on VMs with 64 bits integers, otherwise it wraps around every 35 minutes
+    (:func:`sleep_until_micros` handles the wrap around).
+
+    """
+	pass
+
+
+@native_c("hwtimers_sleep_until_micros",["csrc/hwtimers/*"],["VHAL_HTM"])
+def sleep_until_micros(deadline):
+	"""
+.. function:: sleep_until_micros(deadline)
+
+    Suspend the current thread until :func:`micros` reaches *deadline*; return immediately if it is already past.
+    Sleeping to absolute deadlines keeps a sequence of waits on schedule: ::
+
+        t = hwtimers.micros()
+        for i in range(8):
+            t += 50
+            hwtimers.sleep_until_micros(t)
+            gpio.toggle(D0)
+
+    Raise :samp:`RuntimeError` if too many threads are sleeping.
+
+    """
+	pass
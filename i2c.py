@@ -47,6 +47,8 @@ __define(_I2CDRIVER_WRITE_READ,4)
 __define(_I2CDRIVER_LOCK,5)
 __define(_I2CDRIVER_UNLOCK,6)
 __define(_I2CDRIVER_SET_ADDR,7)
+__define(_I2CDRIVER_READ_REGS_INTO,8)
+__define(_I2CDRIVER_BATCH,9)
 
 
 @native_c("_vbl_i2c_init",["csrc/vbl/vbl_i2c.c"],["VHAL_I2C"])
@@ -140,6 +142,41 @@ The I2C class
             data = bytes(data)
         return self.drv.__ctl__(_I2CDRIVER_WRITE_READ,self.drvid,data,n,timeout,self.addr)
 
+    def read_regs_into(self, reg, buffer, offset=0, n=-1, timeout=-1):
+        """
+.. method:: read_regs_into(reg, buffer, offset=0, n=-1, timeout=-1)
+
+        Writes the register address *reg* and then reads *n* bytes into the bytearray *buffer* starting at *offset*, in a single call.
+        If *n* is negative, the space left in *buffer* after *offset* is filled. *reg* is an integer for one byte register
+        addresses, or a bytes-like object sent as it is.
+
+        Nothing is allocated, so registers can be polled in a loop without loading the garbage collector. Returns the number of bytes read.
+
+        """
+        return self.drv.__ctl__(_I2CDRIVER_READ_REGS_INTO,self.drvid,self.addr,reg,buffer,offset,n,timeout)
+
+    def batch(self, ops, timeout=-1, lock=True):
+        """
+.. method:: batch(ops, timeout=-1, lock=True)
+
+        Executes on the bus of this instance the list of transactions *ops*, in a single call. Each transaction is a tuple
+        ``(addr, reg, buffer, offset, n)`` that works as :meth:`read_regs_into` on the peripheral at *addr*; if *buffer* is None,
+        *reg* is just written (*offset* and *n* are ignored). If *lock* is True, the driver is locked for the whole
+        batch (do not set it if :meth:`lock` was already called).
+
+        The list can be built once and executed at every iteration, filling the same buffers: ::
+
+            imu = bytearray(12)
+            ops = [(0x68, 0x3b, imu, 0, 6), (0x69, 0x3b, imu, 6, 6)]
+            while True:
+                bus.batch(ops)
+                fuse(imu)
+
+        All transactions are checked before starting: if one is not valid, nothing is transferred. The first failing
+        transaction stops the batch and raises its exception.
+
+        """
+        self.drv.__ctl__(_I2CDRIVER_BATCH,self.drvid,ops,timeout,1 if lock else 0)
 
     def stop(self):
         """
@@ -127,3 +127,70 @@ def capture(pin,trigger,max_samples,time_window=1000,time_unit=MILLIS,pull=LOW,b
         return None;
     return _icu_drv.__ctl__(DRV_CMD_READ,pin,trigger,max_samples,time_window,time_unit,pull,bits)
 
+
+@native_c("_icu_capture_into",["csrc/vbl/vbl_icu.c"],["VHAL_ICU"])
+def _icu_capture_into(pin,trigger,time_window,time_unit,pull,buf,offset):
+    pass
+
+def capture_into(pin,trigger,buf,offset=0,time_window=1000,time_unit=MILLIS,pull=LOW):
+    """
+.. function:: capture_into(pin, trigger, buf, offset=0, time_window=1000, time_unit=MILLIS, pull=LOW)
+
+    Same as :func:`capture`, but the times are stored in the caller's *buf* starting at *offset*, and no object is created for them.
+    *max_samples* is how many times fit in *buf* after *offset*:
+
+        * if *buf* is a :class:`shortarray`, each item holds one time in microseconds, saturated to 65535;
+        * if *buf* is a :class:`bytearray`, each time takes 4 bytes, a 32 bits integer in the byte order of the mcu. *offset* is in bytes and must be a multiple of 4.
+
+    Return a tuple ``(n, firstbit)``: *n* is the number of captured times, *firstbit* is the digital value of *pin* during the first one.
+    The value during the i-th time is ``(firstbit+i)%2``.
+
+    Capturing many times in a loop this way does not load the garbage collector: ::
+
+        import icu
+
+        buf = shortarray(200)
+        while True:
+            n,bit = icu.capture_into(D3.ICU,LOW,buf,time_window=20)
+            decode(buf,n,bit)
+
+    """
+    return _icu_capture_into(pin,trigger,time_window,time_unit,pull,buf,offset)
+
+
+class Listener():
+    """
+.. class:: Listener(pin, trigger, callback, size=128, time_window=10, time_unit=MILLIS, pull=LOW)
+
+    Capture continuously on *pin*: a thread repeats :func:`capture_into` on a :class:`shortarray` of *size* items,
+    and calls *callback* with ``(buf, n, firstbit)`` after each capture.
+
+    Each capture ends when *time_window* passes after the last edge or when *buf* is full, so with a *time_window* longer than the
+    pulses and shorter than the pauses of a protocol (as for IR remotes), each call of *callback* receives a whole frame.
+    *buf* is the same at every call and is overwritten by the next capture: *callback* must consume it before returning.
+    The unit does not capture while *callback* runs, so edges in that time are missed.
+
+    .. method:: stop()
+
+        Stop capturing after the current capture.
+
+    """
+    def __init__(self,pin,trigger,callback,size=128,time_window=10,time_unit=MILLIS,pull=LOW):
+        self.pin = pin
+        self.trigger = trigger
+        self.callback = callback
+        self.buf = shortarray(size)
+        self.time_window = time_window
+        self.time_unit = time_unit
+        self.pull = pull
+        self.running = True
+        thread(self._run)
+
+    def _run(self):
+        while self.running:
+            n,bit = _icu_capture_into(self.pin,self.trigger,self.time_window,self.time_unit,self.pull,self.buf,0)
+            if n and self.running:
+                self.callback(self.buf,n,bit)
+
+    def stop(self):
+        self.running = False
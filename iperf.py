@@ -0,0 +1,397 @@
+"""
+.. module:: iperf
+
+*****
+iPerf
+*****
+
+This module measures the network stack: TCP, UDP and TLS throughput, round trip latency and connection (handshake) times.
+It is meant to tune the network driver, the TLS configuration and the socket buffers on the target, so the measuring side
+costs as little as possible: each instance allocates its buffers once, payloads are never rebuilt, UDP headers are written in place.
+
+:class:`Client` and :class:`Server` speak the protocol of iperf 2 (the ``iperf`` command, not ``iperf3``), in its default mode:
+
+    * TCP: the client streams data to ``iperf -s``; a board running :meth:`Server.tcp` is measured by ``iperf -c <board ip>``.
+    * UDP: the client sends sequence numbered datagrams at a given bandwidth to ``iperf -s -u`` and gets back its report
+      of received datagrams, losses and jitter; :meth:`Server.udp` receives from ``iperf -c <board ip> -u`` and replies
+      with the same report.
+
+Latency is measured with UDP echo round trips against :meth:`Server.echo` or any echo service (port 7).
+
+The default port is the one of iperf, 5001. Sizes are in bytes, durations in milliseconds, bandwidths in kilobits per second, times
+measured in microseconds: runs must last less than half an hour, on VMs with 32 bits integers. ::
+
+    import iperf
+
+    cli = iperf.Client("192.168.1.2")
+    print(cli.tcp(10000))           # (bytes, micros, kbps)
+    print(cli.udp(10000,2000))      # (sent, micros, kbps, server report)
+    print(cli.connect_times(10))    # (min, p50, p90, p99, max) in microseconds
+
+    """
+
+import socket
+import struct
+import timers
+
+PORT = 5001
+
+UDP_HEADER = 12             # sequence number, seconds, microseconds
+UDP_REPORT = 52             # header, flags, length, stop time, errors, out of order, datagrams, jitter
+HEADER_VERSION1 = -0x80000000
+
+def _resolve(host, port):
+    if type(host)==PSTRING:
+        ip = socket.ip_to_tuple(__builtins__.__default_net["sock"][0].gethostbyname(host))
+    else:
+        ip = host
+    return (ip[0], ip[1], ip[2], ip[3], port)
+
+def _payload(size):
+    # the pattern of iperf: its server does not take it for a header
+    buf = bytearray(size)
+    for i in range(size):
+        buf[i] = 0x30+i%10
+    return buf
+
+def _kbps(nbytes, micros):
+    ms = micros//1000
+    return (nbytes*8)//ms if ms>0 else 0
+
+def _percentiles(samples, n):
+    # shell sort in place: there is no list.sort
+    gap = n//2
+    while gap>0:
+        for i in range(gap,n):
+            x = samples[i]
+            j = i
+            while j>=gap and samples[j-gap]>x:
+                samples[j] = samples[j-gap]
+                j-=gap
+            samples[j] = x
+        gap//=2
+    if n==0:
+        return (0,0,0,0,0)
+    return (samples[0], samples[(n-1)*50//100], samples[(n-1)*90//100], samples[(n-1)*99//100], samples[n-1])
+
+
+class Client():
+    """
+============
+Client class
+============
+
+.. class:: Client(host, port=5001, bufsize=1460)
+
+    Create a client measuring the path to *host*, an ip or a name resolved by the default network interface, on *port*.
+    *bufsize* is the size of each TCP write and of the UDP datagrams, up to the MTU without fragmentation (1470 for UDP on ethernet).
+    """
+    def __init__(self, host, port=PORT, bufsize=1460):
+        self._addr = _resolve(host,port)
+        self._buf = _payload(bufsize)
+        self._rx = bytearray(UDP_REPORT if bufsize<UDP_REPORT else bufsize)
+        self._samples = None
+
+    def _connect(self, ctx):
+        if ctx is None:
+            sock = socket.socket()
+        else:
+            import ssl
+            sock = ssl.sslsocket(ctx=ctx)
+        sock.connect(self._addr)
+        return sock
+
+    def tcp(self, duration=10000, amount=0, ctx=None):
+        """
+.. method:: tcp(duration=10000, amount=0, ctx=None)
+
+        Stream data to the server for *duration* milliseconds or, if *amount* is not zero, until *amount* bytes are sent.
+        If *ctx* is a context of :func:`ssl.create_ssl_context` the stream goes over TLS (the handshake is not timed).
+
+        Return ``(bytes, micros, kbps)``: the bytes sent, the microseconds taken by the writes and the throughput in kilobits per second.
+        """
+        sock = self._connect(ctx)
+        buf = self._buf
+        n = len(buf)
+        sent = 0
+        t0 = timers.monotonic_us()
+        limit = duration*1000
+        try:
+            while True:
+                if amount:
+                    if sent>=amount:
+                        break
+                elif timers.monotonic_us()-t0>=limit:
+                    break
+                sock.sendall(buf)
+                sent+=n
+            dt = timers.monotonic_us()-t0
+        finally:
+            sock.close()
+        return (sent, dt, _kbps(sent,dt))
+
+    def udp(self, duration=10000, bandwidth=1000, timeout=500):
+        """
+.. method:: udp(duration=10000, bandwidth=1000, timeout=500)
+
+        Send datagrams for *duration* milliseconds at *bandwidth* kilobits per second, then the final datagram and wait at most
+        *timeout* milliseconds for the report of the server (sending the final datagram again up to 10 times, as iperf does).
+        When the network can't keep up, datagrams are sent as fast as it goes.
+
+        Return ``(sent, micros, kbps, report)``: the bytes sent, the microseconds taken and the sending throughput in kilobits per second.
+        *report* is ``(datagrams, lost, out_of_order, jitter)`` as received by the server, jitter in microseconds, or None if it did not come.
+        """
+        buf = self._buf
+        n = len(buf)
+        if n<UDP_HEADER:
+            raise ValueError
+        interval = n*8000//bandwidth if bandwidth>0 else 0
+        sock = socket.socket(type=socket.SOCK_DGRAM)
+        sock.settimeout(timeout)
+        report = None
+        try:
+            sock.connect(self._addr)
+            t0 = timers.monotonic_us()
+            limit = duration*1000
+            seq = 0
+            due = 0
+            while True:
+                el = timers.monotonic_us()-t0
+                if el>=limit:
+                    break
+                if due>el+1000:
+                    sleep((due-el)//1000)
+                    el = timers.monotonic_us()-t0
+                struct.pack_into(">iII",buf,0,seq,el//1000000,el%1000000)
+                sock.send(buf)
+                seq+=1
+                due+=interval
+                # do not burst to catch up after a stall
+                if due<el:
+                    due = el
+            dt = timers.monotonic_us()-t0
+            for i in range(10):
+                struct.pack_into(">iII",buf,0,-seq,dt//1000000,dt%1000000)
+                sock.send(buf)
+                try:
+                    rd = sock.recv_into(self._rx,len(self._rx))
+                except Exception:
+                    continue
+                if rd>=UDP_REPORT:
+                    r = struct.unpack_from(">10i",self._rx,UDP_HEADER)
+                    report = (r[7], r[5], r[6], r[8]*1000000+r[9])
+                    break
+        finally:
+            sock.close()
+        return (seq*n, dt, _kbps(seq*n,dt), report)
+
+    def connect_times(self, n=10, ctx=None):
+        """
+.. method:: connect_times(n=10, ctx=None)
+
+        Open and close *n* connections to the server and return ``(min, p50, p90, p99, max)``, the percentiles of the connection
+        times in microseconds. With the context *ctx* of :func:`ssl.create_ssl_context` the connections are TLS: the times
+        are those of the TCP connection plus the handshake.
+        """
+        samples = [0]*n
+        for i in range(n):
+            t0 = timers.monotonic_us()
+            sock = self._connect(ctx)
+            samples[i] = timers.monotonic_us()-t0
+            sock.close()
+        return _percentiles(samples,n)
+
+    def latency(self, n=100, size=32, timeout=1000):
+        """
+.. method:: latency(n=100, size=32, timeout=1000)
+
+        Send *n* datagrams of *size* bytes to an UDP echo server, one at a time, waiting at most *timeout* milliseconds for each echo.
+
+        Return ``(min, p50, p90, p99, max, lost)``: the percentiles of the round trip times of the echoed datagrams in microseconds
+        and the number of datagrams not echoed in time.
+        """
+        if size<4 or size>len(self._buf):
+            raise ValueError
+        if self._samples is None or len(self._samples)<n:
+            self._samples = [0]*n
+        samples = self._samples
+        buf = self._buf
+        blen = len(buf)
+        rx = self._rx
+        got = 0
+        sock = socket.socket(type=socket.SOCK_DGRAM)
+        sock.settimeout(timeout)
+        try:
+            sock.connect(self._addr)
+            for i in range(n):
+                struct.pack_into(">i",buf,0,i)
+                # the payload is trimmed in place, not copied
+                __elements_set(buf,size)
+                t0 = timers.monotonic_us()
+                try:
+                    sock.send(buf)
+                finally:
+                    __elements_set(buf,blen)
+                while True:
+                    try:
+                        rd = sock.recv_into(rx,len(rx))
+                    except Exception:
+                        break
+                    # late echoes of previous datagrams are skipped
+                    if rd>=4 and struct.unpack_from(">i",rx)[0]==i:
+                        samples[got] = timers.monotonic_us()-t0
+                        got+=1
+                        break
+        finally:
+            sock.close()
+        return _percentiles(samples,got)+(n-got,)
+
+
+class Server():
+    """
+============
+Server class
+============
+
+.. class:: Server(port=5001, bufsize=1460)
+
+    Create a server measuring what iperf clients (or :class:`Client` instances) send to *port*, reading up to *bufsize* bytes at a time.
+    Each method serves one run and returns its results; the buffer is reused across runs.
+    """
+    def __init__(self, port=PORT, bufsize=1460):
+        self.port = port
+        self._buf = bytearray(UDP_REPORT if bufsize<UDP_REPORT else bufsize)
+
+    def tcp(self):
+        """
+.. method:: tcp()
+
+        Accept one TCP connection and read it until the client closes it.
+
+        Return ``(bytes, micros, kbps)``, measured from the first byte received.
+        """
+        srv = socket.socket()
+        try:
+            srv.bind(self.port)
+            srv.listen(1)
+            sock, addr = srv.accept()
+        finally:
+            srv.close()
+        buf = self._buf
+        n = len(buf)
+        total = 0
+        t0 = None
+        try:
+            while True:
+                rd = sock.recv_into(buf,n)
+                if rd<=0:
+                    break
+                if t0 is None:
+                    t0 = timers.monotonic_us()
+                total+=rd
+        except Exception:
+            pass
+        dt = timers.monotonic_us()-t0 if t0 is not None else 0
+        sock.close()
+        return (total, dt, _kbps(total,dt))
+
+    def udp(self, timeout=10000):
+        """
+.. method:: udp(timeout=10000)
+
+        Receive the datagrams of one UDP run until its final datagram, or until no datagram comes for *timeout* milliseconds,
+        and send the report back to the client.
+
+        Return ``(datagrams, lost, out_of_order, jitter, bytes, micros)``: the datagrams the client sent as told by the sequence numbers,
+        how many were lost or came out of order, the jitter of their transit times (as in RTP, in microseconds) and the bytes received in *micros*.
+        """
+        buf = self._buf
+        n = len(buf)
+        sock = socket.socket(type=socket.SOCK_DGRAM)
+        sock.settimeout(timeout)
+        count = 0
+        total = 0
+        expected = 0
+        outorder = 0
+        j16 = 0
+        t0 = None
+        dt = 0
+        try:
+            sock.bind(self.port)
+            while True:
+                try:
+                    rd, addr = sock.recvfrom_into(buf,n)
+                except Exception:
+                    break
+                now = timers.monotonic_us()
+                if rd<UDP_HEADER:
+                    continue
+                seq, sec, usec = struct.unpack_from(">iII",buf)
+                if seq<0:
+                    if t0 is not None:
+                        self._report(sock,addr,seq,total,dt,count,expected,outorder,j16//16)
+                    break
+                if t0 is None:
+                    t0 = now
+                else:
+                    # transit times are compared by differences: the two clocks need not agree
+                    d = (now-parr)-((sec-psec)*1000000+usec-pusec)
+                    if d<0:
+                        d = -d
+                    j16+=d-(j16+8)//16
+                parr = now
+                psec = sec
+                pusec = usec
+                dt = now-t0
+                count+=1
+                total+=rd
+                if seq<expected:
+                    outorder+=1
+                else:
+                    expected = seq+1
+        finally:
+            sock.close()
+        lost = expected-count
+        return (expected, lost if lost>0 else 0, outorder, j16//16, total, dt)
+
+    def _report(self, sock, addr, seq, total, dt, count, expected, outorder, jitter):
+        lost = expected-count
+        struct.pack_into(">iII10i",self._buf,0,seq,0,0,
+            HEADER_VERSION1,0,total,dt//1000000,dt%1000000,
+            lost if lost>0 else 0,outorder,expected,jitter//1000000,jitter%1000000)
+        blen = len(self._buf)
+        __elements_set(self._buf,UDP_REPORT)
+        try:
+            sock.sendto(self._buf,addr)
+        finally:
+            __elements_set(self._buf,blen)
+
+    def echo(self, n=0, timeout=-1):
+        """
+.. method:: echo(n=0, timeout=-1)
+
+        Echo back the UDP datagrams received, *n* of them or forever if *n* is 0, for the latency measures of :meth:`Client.latency`.
+        Return the number of datagrams echoed, when *n* are echoed or no datagram comes for *timeout* milliseconds.
+        """
+        buf = self._buf
+        blen = len(buf)
+        sock = socket.socket(type=socket.SOCK_DGRAM)
+        if timeout>=0:
+            sock.settimeout(timeout)
+        count = 0
+        try:
+            sock.bind(self.port)
+            while not n or count<n:
+                try:
+                    rd, addr = sock.recvfrom_into(buf,blen)
+                except Exception:
+                    break
+                __elements_set(buf,rd)
+                try:
+                    sock.sendto(buf,addr)
+                finally:
+                    __elements_set(buf,blen)
+                count+=1
+        finally:
+            sock.close()
+        return count
@@ -13,139 +13,262 @@ The deserialization of objects is performed using a wrapped version of the aweso
 
 new_exception(JSONError,Exception)
 
-_to_escape = "\"\\\b\f\n\r\t"
-
-class _DumpCounter():
-    def __init__(self):
-        self.l = 0
-    def append(self,x):
-        self.l+=1
-    def extend(self,obj):
-        self.l+=len(obj)
-    def __setitem__(self, key, value):
-        pass
-    def __str__(self):
-        return str(self.l)
-
-class _DumpBuilder():
-    def __init__(self,n):
-        self.data = bytes(n)
-        self.pos = 0
-    def append(self,x):
-        __byte_set(self.data,self.pos,x)
-        self.pos+=1
-    def extend(self,obj):
-        for i in range(___len(obj)):
-            __byte_set(self.data,self.pos,__byte_get(obj,i))
-            self.pos+=1
-    def __setitem__(self, key, value):
-        if key==-1:
-            __byte_set(self.data,self.pos-1,value)
-
-def _dumps(obj,res):
-    t = type(obj)
-    if t==PDICT:
-        _dumps_map(obj,res)
-    elif t == PLIST or t==PTUPLE:
-        _dumps_array(obj,res)
-    elif t == PSMALLINT or t==PFLOAT or t==PINTEGER:
-        res.extend(str(obj))
-    elif t == PSTRING or t == PBYTEARRAY or t == PBYTES: 
-        lb = ___len(obj)
-        res.append(__ORD("\""))
-        for i in range(0,lb):
-            c = __byte_get(obj,i)
-            if c in _to_escape:
-                res.append(__ORD("\\"))
-                if c==__ORD('\n'):
-                    res.append(__ORD("n"))
-                elif c==__ORD('\r'):
-                    res.append(__ORD("r"))
-                elif c==__ORD('\t'):
-                    res.append(__ORD("t"))
-                elif c==__ORD('\f'):
-                    res.append(__ORD("f"))
-                elif c==__ORD('\b'):
-                    res.append(__ORD("b"))
-                else:
-                    res.append(c)                        
-            elif c<0x20 or c>0x7e:
-                res.extend("\\u00")
-                res.extend(hex(c,""))            
-            else:
-                res.append(c)
-        res.append(__ORD("\""))
-    elif t == PBOOL:
-        if obj:
-            res.extend("true")
-        else:
-            res.extend("false")
-    elif obj == None:
-        res.extend("null")
-    else:
-        raise JSONError
-
-def _dumps_array(obj,res):
-    lb = ___len(obj)
-    res.append(__ORD("["))
-    if lb:
-        _dumps(obj[0],res)
-        for i in range(1,lb):
-            res.append(__ORD(","))
-            _dumps(obj[i],res)
-    res.append(__ORD("]"))
-
-def _dumps_map(obj,res):
-    lb = ___len(obj)
-    res.append(__ORD("{"))
-    for k,v in obj.items():
-        if type(k)!=PSTRING:
-            raise JSONError
-        _dumps(k,res)
-        res.append(__ORD(":"))
-        _dumps(v,res)
-        res.append(__ORD(","))
-    if lb:
-        res[-1]=__ORD("}")
-        #__byte_set(res,___len(res)-1,__ORD("}"))
-    else:
-        res.append(__ORD("}"))
+@native_c("jsmn_dumps",["csrc/jsmn/*","csrc/misc/zfloat.c"])
+def _dumps(obj):
+    pass
 
 def dumps(obj):
     """
 .. function:: dumps(obj)
 
-    Returns a bytearray containing the JSON representation of *obj*.
+    Returns a string containing the JSON representation of *obj*.
+    The serialization is performed natively by walking *obj* once and growing a single output buffer.
+    Floats are written with the shortest digits that :func:`loads` reads back to the same value.
 
     Raises ``JSONError`` when *obj* contains non serializable objects.
 
-    """    
-    res = _DumpCounter()# bytearray()    
-    _dumps(obj,res)
-    res = _DumpBuilder(res.l)
-    _dumps(obj,res)
-    __change_type(res.data,PSTRING)
-    return res.data
+    """
+    try:
+        return _dumps(obj)
+    except:
+        raise JSONError
+
+
+@native_c("jsmn_dump_window",["csrc/jsmn/*","csrc/misc/zfloat.c"])
+def _dump_window(obj,buffer,offset,skip,state):
+    pass
+
+@native_c("jsmn_dump_state",["csrc/jsmn/*","csrc/misc/zfloat.c"])
+def _dump_state():
+    pass
+
+def dump_size(obj):
+    """
+.. function:: dump_size(obj)
+
+    Returns the length of the JSON representation of *obj*, without building it.
+
+    Raises ``JSONError`` when *obj* contains non serializable objects.
+
+    """
+    try:
+        return _dump_window(obj,None,0,0,None)
+    except:
+        raise JSONError
 
+def dump_into(obj,buffer,offset=0):
+    """
+.. function:: dump_into(obj,buffer,offset=0)
+
+    Writes the JSON representation of *obj* into the bytearray *buffer* starting at *offset*, and returns the number of bytes written.
+    No string is allocated.
+
+    Raises ``IndexError`` when the representation does not fit in *buffer* and ``JSONError`` when *obj* contains non serializable objects.
+
+    """
+    try:
+        n = _dump_window(obj,buffer,offset,0,None)
+    except IndexError:
+        raise IndexError
+    except:
+        raise JSONError
+    if n>len(buffer)-offset:
+        raise IndexError
+    return n
 
-@native_c("jsmn_loads",["csrc/jsmn/*"])
-def _loads(data):
+def dump(obj,sock,buffer=None):
+    """
+.. function:: dump(obj,sock,buffer=None)
+
+    Sends the JSON representation of *obj* with the *sendall* method of *sock*, one chunk of the size of the bytearray *buffer* at a time
+    (a new bytearray of 256 bytes if *buffer* is not given). The whole representation is never held in memory: the position reached in *obj*
+    is kept between chunks, so that each chunk goes on from where the previous one stopped. Returns the number of bytes sent.
+    *obj* must not be changed while it is being sent.
+
+    Raises ``JSONError`` when *obj* contains non serializable objects: since chunks are sent as soon as they are ready,
+    use :func:`dump_size` beforehand to check *obj* if a partial send is not acceptable.
+
+    """
+    if buffer is None:
+        buffer = bytearray(256)
+    size = len(buffer)
+    skip = 0
+    state = _dump_state()
+    while True:
+        try:
+            n = _dump_window(obj,buffer,0,skip,state)-skip
+        except:
+            raise JSONError
+        if n>size:
+            sock.sendall(buffer)
+            skip+=size
+        else:
+            __elements_set(buffer,n)
+            sock.sendall(buffer)
+            __elements_set(buffer,size)
+            return skip+n
+
+
+@native_c("jsmn_loads",["csrc/jsmn/*","csrc/misc/zfloat.c"])
+def _loads(data,intern_keys,packed):
     pass
 
-def loads(data):
+def loads(data,intern_keys=False,packed=False):
     """
-.. function:: loads(data)
+.. function:: loads(data,intern_keys=False,packed=False)
 
     Returns the object represented in JSON format inside the byte sequence *data*.
 
+    If *intern_keys* is True, objects with the same keys share the key strings instead of holding a copy each:
+    this roughly halves the memory needed by arrays of records with the same fields.
+
+    If *packed* is True, non empty arrays holding only numbers are not returned as lists but as:
+
+        * a bytearray, if all numbers are integers between 0 and 255
+        * a shortarray, if all numbers are integers between 0 and 65535
+        * a bytearray of packed 32 bit signed integers (to be read with :func:`struct.unpack`), if all numbers are other integers fitting 32 bits
+        * a bytearray of packed 32 bit floats (to be read with :func:`struct.unpack`), if all numbers are floats
+
+    Arrays mixing integers and floats, arrays with integers not fitting 32 bits and arrays too big for the resulting buffer are returned as lists,
+    so that integers are never rounded.
+
     Raises ``JSONError`` when *data* contains bad JSON.
 
     """    
     if len(data)>0:
         try:
-            obj = _loads(data)
+            obj = _loads(data,intern_keys,packed)
             return obj
         except:
             raise JSONError
     else:
         return None
+
+
+@native_c("jsmn_paths",["csrc/jsmn/*","csrc/misc/zfloat.c"])
+def _paths(paths):
+    pass
+
+@native_c("jsmn_extract",["csrc/jsmn/*","csrc/misc/zfloat.c"])
+def _extract(data,paths):
+    pass
+
+def extract(data,paths):
+    """
+.. function:: extract(data,paths)
+
+    Returns a list with the values selected by each path in *paths* from the JSON document inside the byte sequence *data*,
+    or None for the paths matching nothing. Paths have the same syntax as in :class:`JSONStream`, for example ``["a.b","c[2].d"]``.
+    If a path with ``*`` matches many values, the last one is returned.
+
+    Only the selected values are built: the rest of the document is scanned without creating objects, making :func:`extract` faster and much lighter
+    on memory than :func:`loads` when few fields of a large document are needed.
+
+    Raises ``JSONError`` when *data* contains bad JSON or *paths* are not valid.
+
+    """
+    try:
+        return _extract(data,_paths(paths))
+    except:
+        raise JSONError
+
+@native_c("jsmn_stream_new",["csrc/jsmn/*","csrc/misc/zfloat.c"])
+def _stream_new(paths):
+    pass
+
+@native_c("jsmn_stream_feed",["csrc/jsmn/*","csrc/misc/zfloat.c"])
+def _stream_feed(state,stack,paths,data,out,last):
+    pass
+
+
+class JSONStream():
+    """
+================
+JSONStream class
+================
+
+.. class:: JSONStream(path="",callback=None)
+
+    Create a resumable JSON parser. Data can be given in chunks of any size with :meth:`feed`, for example from a :class:`streams.SocketStream`
+    or as the *stream_callback* of :func:`requests.get`, and values are returned as soon as they are complete. The whole document is never kept in memory:
+    only the values being returned are built, while the rest of the document is just scanned.
+
+    *path* selects which values are returned:
+
+        * ``""``: every top level value (many values separated by whitespace are accepted)
+        * ``"a.b"``: the value of key *b* in the object at key *a*
+        * ``"items[2]"``: the third element of the array at key *items*
+        * ``"items[*]"``: every element of the array at key *items*, one at a time. ``*`` can replace keys too, as in ``"*.id"``
+
+    If *callback* is given, it is called with each completed value instead of returning the values from :meth:`feed` and :meth:`close`.
+
+    """
+    def __init__(self,path="",callback=None):
+        try:
+            self._paths = _paths([path])
+        except:
+            raise JSONError
+        self._state = _stream_new(self._paths)
+        self._stack = []
+        self._pending = None
+        self.callback = callback
+
+    def _parse(self,data,last):
+        if self._pending is not None:
+            data = self._pending+data
+        out = []
+        try:
+            n = _stream_feed(self._state,self._stack,self._paths,data,out,last)
+        except:
+            raise JSONError
+        # the last token may be cut by the end of the chunk: keep it for the next one
+        if n<len(data):
+            self._pending = data[n:]
+        else:
+            self._pending = None
+        if self.callback is not None:
+            for v in out:
+                self.callback(v)
+            return []
+        return out
+
+    def feed(self,data):
+        """
+.. method:: feed(data)
+
+    Parse the byte sequence *data*, the next chunk of the document. Returns a list of the values completed by *data*.
+
+    Raises ``JSONError`` when *data* contains bad JSON.
+
+        """
+        return self._parse(data,False)
+
+    def close(self):
+        """
+.. method:: close()
+
+    Signal the end of the document. Returns the values still pending, if any.
+
+    Raises ``JSONError`` when the document is incomplete.
+
+        """
+        out = self._parse("",True)
+        if self._pending is not None or self._stack:
+            raise JSONError
+        return out
+
+    def read_from(self,stream,size=512):
+        """
+.. method:: read_from(stream,size=512)
+
+    Read *stream* in chunks of *size* bytes until it is exhausted, parsing each chunk. Returns the list of selected values.
+
+        """
+        values = []
+        while True:
+            data = stream.read(size)
+            if not data:
+                break
+            values.extend(self.feed(data))
+        values.extend(self.close())
+        return values
@@ -16,54 +16,62 @@ This module allows handling `JSON Web Tokens <https://tools.ietf.org/html/rfc751
 
     """
 
-import base64
-from crypto.hash import sha2 as sha2
-from crypto.hash import hmac as hmac
-from crypto.ecc import ecc as ec
+import json
 
 
 HS256=0
 ES256=1
 RS256=2
 
+# The standard JWT headers already base64 encoded.
+# Equate to {"typ": "JWT", "alg": "ES256"} and {"alg": "HS256", "typ": "JWT"}
+_ES256_HEADER = "eyJ0eXAiOiJKV1QiLCJhbGciOiJFUzI1NiJ9"
+_HS256_HEADER = "eyJhbGciOiJIUzI1NiIsInR5cCI6IkpXVCJ9"
+
+@native_c("__jwt_encode",[
+    "csrc/jwt/jwt.c",
+    "#crypto/ecc/csrc/microecc/uECC.c",
+    "#csrc/drbg/zdrbg.c",
+    "#crypto/hash/csrc/cifra/src/drbg.c",
+    "#crypto/hash/csrc/cifra/src/sha256.c",
+    "#crypto/hash/csrc/cifra/src/hmac.c",
+    "#crypto/hash/csrc/cifra/src/chash.c",
+    "#crypto/hash/csrc/cifra/src/blockwise.c",
+    ],["uECC_SUPPORTS_secp160r1","uECC_SUPPORTS_secp192r1","uECC_SUPPORTS_secp224r1","uECC_SUPPORTS_secp256r1","uECC_SUPPORTS_secp256k1","uECC_FIXED_BASE","uECC_BATCH_VERIFY"],["-I#crypto/ecc/csrc/microecc","-I#crypto/hash/csrc/cifra/src","-I#crypto/hash/csrc/cifra/src/ext","-I#csrc/drbg"])
+def _encode(algo,header,payload,key,out):
+    pass
+
 def encode_es256(payload,key):
-    # The standard JWT header already base64 encoded. Equates to {"alg": "ES256", "typ": "JWT"}
-    jwt_header = "eyJ0eXAiOiJKV1QiLCJhbGciOiJFUzI1NiJ9";
-    key = ec.hex_to_bin(key)
-    jwt = jwt_header + '.' + base64.standard_b64encode(payload).strip('=')
-    ss = sha2.SHA2(hashtype=sha2.SHA256)
-    ss.update(jwt)
-    signature = ec.sign(ec.SECP256R1, ss.digest(), key, deterministic=sha2.SHA2(hashtype=sha2.SHA256))
-    jwt = jwt + '.' + base64.standard_b64encode(signature).strip('=').replace("+","-").replace("/","_")
-    return jwt
+    return _encode(ES256,_ES256_HEADER,payload,key,None)
 
 def encode_hs256(payload,key):
-    # The standard JWT header already base64 encoded. Equates to {"alg": "HS256", "typ": "JWT"}
-    jwt_header = "eyJhbGciOiJIUzI1NiIsInR5cCI6IkpXVCJ9";
-    jwt = jwt_header + '.' + base64.standard_b64encode(payload).strip('=')
-    hm = hmac.HMAC(key,sha2.SHA2())
-    hm.update(jwt)
-    jwt = jwt + '.' + base64.standard_b64encode(hm.digest()).strip('=').replace("+","-").replace("/","_")
-    return jwt
-
-def encode(payload, key, algo=ES256):
+    return _encode(HS256,_HS256_HEADER,payload,key,None)
+
+def encode(payload, key, algo=ES256, buffer=None):
     """
-.. function:: encode(payload, key, algo=ES256)
+.. function:: encode(payload, key, algo=ES256, buffer=None)
 
     Encode a JWT for target :samp:`payload` signed with :samp:`key`.
 
     Currently only HS256 and ES256 encoding algorithms are supported (ES256 using prime256v1curve)
 
-    :samp:`key` must be an ECDSA private key in hex format for ES256 or a bytes/string for HS256
+    :samp:`payload` is the JSON string of the claims, or a dict converted with :samp:`json.dumps`.
+    :samp:`key` must be an ECDSA private key in hex format (or its 32 bytes) for ES256 or a bytes/string for HS256
     If a private key is, for example, stored as a pem file, the needed hex string can be extracted from the OCTET STRING field associated value obtained from ::
 
         openssl asn1parse -in my_private.pem
         
     command (since pem is a base64 encoded, plus header, `DER <https://tools.ietf.org/html/rfc5915>`_).
+
+    Encoding, hashing and signing are done natively in one pass. The token is returned as a string or, if :samp:`buffer` is given,
+    written into the bytearray :samp:`buffer` returning its length: a device minting a token at every reconnection can reuse the same
+    buffer. An ES256 token takes the payload length times 4/3 plus 125 bytes, an HS256 one plus 82.
     """
+    if type(payload)==PDICT:
+        payload = json.dumps(payload)
     if algo==ES256:
-        return encode_es256(payload,key)
+        return _encode(ES256,_ES256_HEADER,payload,key,buffer)
     elif algo==HS256:
-        return encode_hs256(payload,key)
+        return _encode(HS256,_HS256_HEADER,payload,key,buffer)
     else:
         raise UnsupportedError
@@ -0,0 +1,155 @@
+"""
+.. module:: kvstore
+
+****************
+Key-Value Store
+****************
+
+This module stores small values by key in a region of the internal flash of the microcontroller.
+
+Updates are appended to the flash as new entries, without erasing: the newest entry of a key is found through an index in RAM,
+and whole sectors are erased only when the space is recycled (compaction), moving their live entries away.
+Every entry has a crc32, and an update interrupted by a power loss leaves the previous value of the key.
+
+It replaces the pattern of :class:`flash.FlashFileStream`, that erases and rewrites the whole region at every flush::
+
+    import kvstore
+
+    store = kvstore.KVStore(0x08060000, 0x20000, 0x10000)
+    store.set("ssid", "office")
+    store.set("interval", bytes([60]))
+    ssid = store.get("ssid")
+
+    """
+
+@native_c("kvstore_attach",["csrc/kvstore/*","csrc/crc/crc32.c"])
+def _attach(start,size,sector_size,max_keys):
+    pass
+
+@native_c("kvstore_detach",["csrc/kvstore/*","csrc/crc/crc32.c"])
+def _detach(id):
+    pass
+
+@native_c("kvstore_set",["csrc/kvstore/*","csrc/crc/crc32.c"])
+def _set(id,key,value):
+    pass
+
+@native_c("kvstore_get",["csrc/kvstore/*","csrc/crc/crc32.c"])
+def _get(id,key):
+    pass
+
+@native_c("kvstore_keys",["csrc/kvstore/*","csrc/crc/crc32.c"])
+def _keys(id):
+    pass
+
+@native_c("kvstore_clear",["csrc/kvstore/*","csrc/crc/crc32.c"])
+def _clear(id):
+    pass
+
+@native_c("kvstore_stats",["csrc/kvstore/*","csrc/crc/crc32.c"])
+def _stats(id):
+    pass
+
+class KVStore():
+    """
+=============
+KVStore class
+=============
+
+.. class:: KVStore(start, size, sector_size, max_keys=64)
+
+        Attach a store to the region of internal flash beginning at address *start* and *size* bytes long.
+        The region is made of sectors of *sector_size* bytes (at least two), and *start* must be the address of a sector.
+        Keys already in the region are kept.
+
+        *max_keys* is the number of keys the RAM index can hold (8 bytes of RAM per key, rounded up to a power of two).
+
+        A key is a string or bytes of up to 254 bytes, and a value is a string or bytes. An entry (key, value and 16 bytes of header)
+        must fit in a sector, and all the live entries must fit in one sector less than the region.
+
+    """
+    def __init__(self, start, size, sector_size, max_keys=64):
+        self._id = _attach(start,size,sector_size,max_keys)
+
+    def set(self, key, value):
+        """
+.. method:: set(key, value)
+
+        Store *value* for *key*, replacing the previous one. Raises ``RuntimeError`` if the store or its index is full.
+
+        """
+        _set(self._id,key,value)
+
+    def get(self, key, default=None):
+        """
+.. method:: get(key, default=None)
+
+        Return the value of *key* as bytes, or *default* if it is not stored.
+
+        """
+        res = _get(self._id,key)
+        if res is None:
+            return default
+        return res
+
+    def delete(self, key):
+        """
+.. method:: delete(key)
+
+        Remove *key* from the store, if present.
+
+        """
+        _set(self._id,key,None)
+
+    def keys(self):
+        """
+.. method:: keys()
+
+        Return the list of stored keys, as bytes.
+
+        """
+        return _keys(self._id)
+
+    def __getitem__(self, key):
+        res = _get(self._id,key)
+        if res is None:
+            raise KeyError
+        return res
+
+    def __setitem__(self, key, value):
+        _set(self._id,key,value)
+
+    def clear(self):
+        """
+.. method:: clear()
+
+        Erase the whole region, removing all the keys.
+
+        """
+        _clear(self._id)
+
+    def stats(self):
+        """
+.. method:: stats()
+
+        Return a tuple holding:
+
+        * *sectors*, number of sectors of the region;
+        * *live*, bytes of flash used by the current entries;
+        * *free*, bytes of flash that can still be used by entries;
+        * *keys*, index slots in use (deletions included until compacted);
+        * *max_keys*, index slots;
+        * *compactions*, sectors compacted since the store was attached.
+
+        """
+        return _stats(self._id)
+
+    def close(self):
+        """
+.. method:: close()
+
+        Detach the store, freeing its RAM.
+
+        """
+        _detach(self._id)
+        self._id = -1
@@ -0,0 +1,273 @@
+"""
+.. module:: linalg
+
+**************
+Linear Algebra
+**************
+
+This module implements natively the small fixed size linear algebra of sensor fusion filters (Madgwick, Mahony, Kalman):
+vectors, square matrices up to 4x4 and quaternions. Each operation is a single call that computes in single precision
+and allocates nothing, except for the scalar results and the buffers created when *dst* is not given.
+
+All the operands are :class:`bytearray` of single precision floats in native byte order (4 bytes each), as the array
+functions of :mod:`math`; sources can also be :class:`bytes`. Matrices are stored row major, their size is told by their
+length (4, 9 or 16 floats). Quaternions are stored as *(w, x, y, z)*. The result is stored in *dst*, that is returned and
+can be one of the operands: when it is not given the result replaces the first operand, except where noted. ::
+
+    import linalg
+
+    q = linalg.array([1, 0, 0, 0])
+    dq = linalg.zeros(4)
+    gyro = linalg.zeros(4)
+    euler = linalg.zeros(3)
+
+    while True:
+        gx, gy, gz = read_gyro()            # rad/s
+        linalg.load(gyro, (0, gx, gy, gz))
+        linalg.qmul(q, gyro, dq)            # q' = 0.5 * q * (0, w)
+        linalg.scale(dq, 0.5*dt)
+        linalg.add(q, dq)
+        linalg.normalize(q)
+        linalg.qeuler(q, euler)             # roll, pitch, yaw in radians
+
+    """
+
+_ADD = 0
+_SUB = 1
+_SCALE = 2
+_MUL = 3
+_MULV = 4
+_TRANSPOSE = 5
+_INVERSE = 6
+_DET = 7
+_DOT = 8
+_CROSS = 9
+_NORMALIZE = 10
+_IDENTITY = 11
+_LOAD = 12
+_QMUL = 13
+_QCONJ = 14
+_QROTATE = 15
+_QMAT = 16
+_QEULER = 17
+_GET = 18
+_SET = 19
+
+@native_c("__linalg",["csrc/math/atan2.c","csrc/math/asin.c","csrc/math/sqrt.c","csrc/math/scalbn.c","csrc/math/mathf.c","csrc/math/stdlib_linalg.c"])
+def _linalg(op,a,b,dst,n,k):
+    pass
+
+# size of the square matrix of a buffer
+def _size(m):
+    l = len(m)//4
+    if l==16:
+        return 4
+    if l==9:
+        return 3
+    if l==4:
+        return 2
+    if l==1:
+        return 1
+    raise ValueError
+
+
+def zeros(n):
+    """
+.. function:: zeros(n)
+
+    Return a new buffer of *n* floats set to zero.
+
+    """
+    return bytearray(4*n)
+
+def array(values):
+    """
+.. function:: array(values)
+
+    Return a new buffer with the numbers of the list or tuple *values*.
+
+    """
+    return _linalg(_LOAD,values,None,bytearray(4*len(values)),len(values),0)
+
+def load(dst, values):
+    """
+.. function:: load(dst, values)
+
+    Store the numbers of the list or tuple *values* at the start of *dst*.
+
+    """
+    return _linalg(_LOAD,values,None,dst,len(values),0)
+
+def get(a, i):
+    """
+.. function:: get(a, i)
+
+    Return the *i*-th float of *a*.
+
+    """
+    return _linalg(_GET,a,None,None,i,0)
+
+def set(a, i, x):
+    """
+.. function:: set(a, i, x)
+
+    Set the *i*-th float of *a* to *x*.
+
+    """
+    _linalg(_SET,None,None,a,i,x)
+
+def identity(n, dst=None):
+    """
+.. function:: identity(n, dst=None)
+
+    Store the *n* x *n* identity matrix in *dst* (a new buffer if not given) and return it.
+
+    """
+    return _linalg(_IDENTITY,None,None,zeros(n*n) if dst is None else dst,n,0)
+
+def add(a, b, dst=None):
+    """
+.. function:: add(a, b, dst=None)
+
+    Element wise sum of the vectors or matrices *a* and *b*.
+
+    """
+    return _linalg(_ADD,a,b,a if dst is None else dst,len(a)//4,0)
+
+def sub(a, b, dst=None):
+    """
+.. function:: sub(a, b, dst=None)
+
+    Element wise difference *a* - *b*.
+
+    """
+    return _linalg(_SUB,a,b,a if dst is None else dst,len(a)//4,0)
+
+def scale(a, k, dst=None):
+    """
+.. function:: scale(a, k, dst=None)
+
+    Multiply every element of *a* by the number *k*.
+
+    """
+    return _linalg(_SCALE,a,None,a if dst is None else dst,len(a)//4,k)
+
+def mul(a, b, dst=None):
+    """
+.. function:: mul(a, b, dst=None)
+
+    Matrix product *a* * *b* of two square matrices of the same size.
+
+    """
+    return _linalg(_MUL,a,b,a if dst is None else dst,_size(a),0)
+
+def mulv(m, v, dst=None):
+    """
+.. function:: mulv(m, v, dst=None)
+
+    Product of the square matrix *m* and the column vector *v*; the result replaces *v* if *dst* is not given.
+
+    """
+    return _linalg(_MULV,m,v,v if dst is None else dst,_size(m),0)
+
+def transpose(a, dst=None):
+    """
+.. function:: transpose(a, dst=None)
+
+    Transpose of the square matrix *a*.
+
+    """
+    return _linalg(_TRANSPOSE,a,None,a if dst is None else dst,_size(a),0)
+
+def inverse(a, dst=None):
+    """
+.. function:: inverse(a, dst=None)
+
+    Store the inverse of the square matrix *a* in *dst* (*a* itself if not given) and return True, or return False,
+    leaving *dst* untouched, if *a* is singular. The inverse is computed by Gauss-Jordan elimination with partial pivoting.
+
+    """
+    return _linalg(_INVERSE,a,None,a if dst is None else dst,_size(a),0)
+
+def det(a):
+    """
+.. function:: det(a)
+
+    Return the determinant of the square matrix *a*.
+
+    """
+    return _linalg(_DET,a,None,None,_size(a),0)
+
+def dot(a, b):
+    """
+.. function:: dot(a, b)
+
+    Return the dot product of the vectors *a* and *b*.
+
+    """
+    return _linalg(_DOT,a,b,None,len(a)//4,0)
+
+def cross(a, b, dst=None):
+    """
+.. function:: cross(a, b, dst=None)
+
+    Cross product *a* x *b* of two vectors of 3 floats.
+
+    """
+    return _linalg(_CROSS,a,b,a if dst is None else dst,3,0)
+
+def normalize(a, dst=None):
+    """
+.. function:: normalize(a, dst=None)
+
+    Divide the vector (or quaternion) *a* by its norm and return the norm. A null vector stays null.
+
+    """
+    return _linalg(_NORMALIZE,a,None,a if dst is None else dst,len(a)//4,0)
+
+def qmul(p, q, dst=None):
+    """
+.. function:: qmul(p, q, dst=None)
+
+    Hamilton product *p* * *q* of two quaternions.
+
+    """
+    return _linalg(_QMUL,p,q,p if dst is None else dst,4,0)
+
+def qconj(q, dst=None):
+    """
+.. function:: qconj(q, dst=None)
+
+    Conjugate of the quaternion *q*, the inverse rotation for unit quaternions.
+
+    """
+    return _linalg(_QCONJ,q,None,q if dst is None else dst,4,0)
+
+def qrotate(q, v, dst=None):
+    """
+.. function:: qrotate(q, v, dst=None)
+
+    Rotate the vector *v* of 3 floats by the unit quaternion *q* (*q* * *v* * conj(*q*)); the result replaces *v* if
+    *dst* is not given.
+
+    """
+    return _linalg(_QROTATE,q,v,v if dst is None else dst,4,0)
+
+def qmatrix(q, dst=None):
+    """
+.. function:: qmatrix(q, dst=None)
+
+    Store the 3x3 rotation matrix of the unit quaternion *q* in *dst* (a new buffer if not given) and return it.
+
+    """
+    return _linalg(_QMAT,q,None,zeros(9) if dst is None else dst,4,0)
+
+def qeuler(q, dst=None):
+    """
+.. function:: qeuler(q, dst=None)
+
+    Store the Euler angles *(roll, pitch, yaw)* in radians of the unit quaternion *q* (aerospace sequence, z-y'-x'') in *dst*
+    (a new buffer if not given) and return it.
+
+    """
+    return _linalg(_QEULER,q,None,zeros(3) if dst is None else dst,4,0)
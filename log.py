@@ -0,0 +1,174 @@
+"""
+.. module:: log
+
+***
+Log
+***
+
+This module records log messages in a fixed ring in RAM instead of writing them out: logging a message only copies the
+id of its template, its level, a timestamp and its raw arguments in the ring, with no formatting, no allocation and no wait
+for the serial port. A low priority thread started by :func:`start` takes the records out, formats them and writes them to a stream
+(the serial console, a file, a socket).
+
+Messages are given by the id of a format registered once with :func:`register`, as a :class:`template.Template`.
+Arguments can be integers, floats, booleans, None, strings and bytes, copied up to 48 bytes; other objects are converted with ``str()``.
+When the ring is full new records are dropped and counted, never blocking the caller: see :func:`stats`.
+
+Levels are the ones of the C debug macros: ``LVL0`` (the most important) to ``LVL3``, and ``ERROR``, always recorded.
+When the VM is built with ``ZERYNTH_DEBUG`` and ``ZERYNTH_DEBUG_LOG``, the ``DEBUG`` and ``ERROR`` macros of the C libraries
+write to the same ring, keeping only the pointer to their format, so that C and Python messages come out in order::
+
+    import log
+
+    SAMPLE = log.register("adc %d: %d samples, mean %.3f")
+    log.start()
+
+    # in the hot loop
+    log.log(log.LVL1, SAMPLE, ch, n, mean)
+
+Lines are written as ``[millis] [DBG]:level:tag | text`` (``[ERR]::tag | text`` for errors), where tag is the one of C messages.
+
+    """
+
+import template
+
+ERROR = -1
+LVL0 = 0
+LVL1 = 1
+LVL2 = 2
+LVL3 = 3
+
+@native_c("_log_put",["csrc/log/zlog.c","csrc/misc/snprintf.c"])
+def _log_put(level,id,args):
+    pass
+
+@native_c("_log_get",["csrc/log/zlog.c","csrc/misc/snprintf.c"])
+def _log_get(timeout):
+    pass
+
+@native_c("_log_level",["csrc/log/zlog.c","csrc/misc/snprintf.c"])
+def _log_level(level):
+    pass
+
+@native_c("_log_stats",["csrc/log/zlog.c","csrc/misc/snprintf.c"])
+def _log_stats():
+    pass
+
+_templates = []
+_prefix = template.Template("[%d] [%s]:%s:%s | ")
+_buf = bytearray(256)
+_stream = None
+
+def register(fmt, style=template.PERCENT):
+    """
+.. function:: register(fmt, style=template.PERCENT)
+
+    Register the format *fmt*, in :mod:`template` *style*, and return its id, to be passed to :func:`log`.
+    Formats are meant to be registered once, at startup.
+    """
+    _templates.append(template.Template(fmt,style))
+    return len(_templates)-1
+
+# objects recorded natively: int, float, bool, str, bytes, bytearray and None
+def _plain(args):
+    res = []
+    for a in args:
+        t = type(a)
+        if t<=PBYTEARRAY or t==PNONE:
+            res.append(a)
+        else:
+            res.append(str(a))
+    return res
+
+def log(level, id, *args):
+    """
+.. function:: log(level, id, *args)
+
+    Record a message of *level* with the template *id* and the arguments *args*, unless *level* is above the one set with :func:`level`.
+    """
+    try:
+        _log_put(level,id,args)
+    except TypeError:
+        _log_put(level,id,_plain(args))
+
+def error(id, *args):
+    """
+.. function:: error(id, *args)
+
+    Record an ``ERROR`` message with the template *id* and the arguments *args*.
+    """
+    try:
+        _log_put(ERROR,id,args)
+    except TypeError:
+        _log_put(ERROR,id,_plain(args))
+
+def level(lvl):
+    """
+.. function:: level(lvl)
+
+    Record from now on only messages with a level up to *lvl*, errors only if *lvl* is ``ERROR``. Applies to C messages too.
+    Returns the previous level, ``LVL3`` at startup.
+    """
+    return _log_level(lvl)
+
+def stats():
+    """
+.. function:: stats()
+
+    Return a tuple with the bytes used in the ring, its size and the number of records dropped because the ring was full.
+    """
+    return _log_stats()
+
+def _write(rec, stream):
+    at, lvl, id, args, truncated = rec
+    if id<0:
+        tag = args[0]
+        text = args[1]
+    else:
+        tag = ""
+        try:
+            text = _templates[id].render(*args)
+        except Exception:
+            # missing arguments of a truncated record
+            text = _templates[id].format if id<len(_templates) else ""
+    n = _prefix.render_into(_buf,at,"ERR" if lvl<0 else "DBG","" if lvl<0 else lvl,tag)
+    stream.write(_buf[:n])
+    stream.write(text)
+    stream.write("...\n" if truncated else "\n")
+
+def flush(stream=None):
+    """
+.. function:: flush(stream=None)
+
+    Format and write the records in the ring to *stream* (the one given to :func:`start`, or ``__default_stream``, if None), in the calling thread.
+    Returns the number of records written.
+    """
+    if not stream:
+        stream = _stream if _stream else __default_stream
+    n = 0
+    while True:
+        rec = _log_get(0)
+        if rec is None:
+            return n
+        if stream:
+            _write(rec,stream)
+        n+=1
+
+def _run():
+    while True:
+        rec = _log_get(-1)
+        if rec is not None and _stream:
+            _write(rec,_stream)
+
+def start(stream=None, prio=PRIO_LOWEST, size=-1):
+    """
+.. function:: start(stream=None, prio=PRIO_LOWEST, size=-1)
+
+    Start the thread that writes the records to *stream*, an object with a ``write`` method (``__default_stream`` if None),
+    with priority *prio* and stack *size*. Calling start again only changes the stream.
+    """
+    global _stream
+    running = _stream is not None
+    _stream = stream if stream else __default_stream
+    if not running:
+        thread(_run,prio=prio,size=size)
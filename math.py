@@ -10,6 +10,10 @@ This module implements various mathematical functions.
 
 Except when explicitly noted otherwise, all return values are floats. The underlying implementations works on double precision floats that are converted back to single precision if the VM does not support double precision.
 
+On VMs with single precision floats, or when the VM is compiled with the ``ZERYNTH_MATH_FLOAT32`` option, trigonometric, exponential and power functions
+use single precision kernels instead, several times faster on microcontrollers whose FPU handles only single precision (like Cortex-M4F and M33).
+They are accurate to a few units in the last place of a float, except :func:`pow` whose error grows with the magnitude of ``y*log(x)``.
+
 No exceptions are raised: in case of error, the return value can be infinite or NaN. Such cases can be checked with the provided functions.
 
 The following constants are defined:
@@ -25,7 +29,7 @@ e =  2.71828182
 
 ##### TRIGONOMETRY
 
-@native_c("__tan",["csrc/math/trig.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c"])
+@native_c("__tan",["csrc/math/trig.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c","csrc/math/mathf.c"])
 def tan(rad):
     """
 .. function:: tan(x)
@@ -34,7 +38,7 @@ def tan(rad):
     """
     pass
 
-@native_c("__cos",["csrc/math/trig.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c"])
+@native_c("__cos",["csrc/math/trig.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c","csrc/math/mathf.c"])
 def cos(rad):
     """
 .. function:: cos(x)
@@ -43,7 +47,7 @@ def cos(rad):
     """
     pass
 
-@native_c("__sin",["csrc/math/trig.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c"])
+@native_c("__sin",["csrc/math/trig.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c","csrc/math/mathf.c"])
 def sin(rad):
     """
 .. function:: sin(x)
@@ -52,7 +56,7 @@ def sin(rad):
     """
     pass
 
-@native_c("__atan2",["csrc/math/atan2.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c"])
+@native_c("__atan2",["csrc/math/atan2.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c","csrc/math/mathf.c"])
 def atan2(y,x):
     """
 .. function:: atan2(y, x)
@@ -66,7 +70,7 @@ def atan2(y,x):
     """
     pass
 
-@native_c("__atan",["csrc/math/atan.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c"])
+@native_c("__atan",["csrc/math/atan.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c","csrc/math/mathf.c"])
 def atan(x):
     """
 .. function:: atan(x)
@@ -75,7 +79,7 @@ def atan(x):
     """
     pass
 
-@native_c("__acos",["csrc/math/acos.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c"])
+@native_c("__acos",["csrc/math/acos.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c","csrc/math/mathf.c"])
 def acos(x):
     """
 .. function:: acos(x)
@@ -85,7 +89,7 @@ def acos(x):
     """
     pass
 
-@native_c("__asin",["csrc/math/asin.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c"])
+@native_c("__asin",["csrc/math/asin.c","csrc/math/scalbn.c","csrc/math/stdlib_trig.c","csrc/math/mathf.c"])
 def asin(x):
     """
 .. function:: asin(x)
@@ -115,7 +119,7 @@ def radians(degree):
 
 ##### EXPONENTS
 
-@native_c("__expn",["csrc/math/exp.c","csrc/math/stdlib_exp.c"])
+@native_c("__expn",["csrc/math/exp.c","csrc/math/stdlib_exp.c","csrc/math/mathf.c"])
 def exp(x):
     """
 .. function:: exp(x)
@@ -124,7 +128,7 @@ def exp(x):
     """
     pass
 
-@native_c("__logn",["csrc/math/log.c","csrc/math/stdlib_exp.c"])
+@native_c("__logn",["csrc/math/log.c","csrc/math/stdlib_exp.c","csrc/math/mathf.c"])
 def log(x,base=-1):
     """
 .. function:: log(x[, base])
@@ -137,7 +141,7 @@ def log(x,base=-1):
     """
     pass
 
-@native_c("__pow",["csrc/math/pow.c","csrc/math/stdlib_pow.c"])
+@native_c("__pow",["csrc/math/pow.c","csrc/math/stdlib_pow.c","csrc/math/mathf.c"])
 def pow(x,y):
     """
 .. function:: pow(x, y)
@@ -150,7 +154,7 @@ def pow(x,y):
     """
     pass
 
-@native_c("__sqrt",["csrc/math/sqrt.c","csrc/math/stdlib_pow.c"])
+@native_c("__sqrt",["csrc/math/sqrt.c","csrc/math/stdlib_pow.c","csrc/math/mathf.c"])
 def sqrt(x):
     """
 .. function:: sqrt(x)
@@ -200,3 +204,85 @@ def ceil(x):
     pass
 
 
+
+##### ARRAYS
+
+@native_c("__vmath",["csrc/math/trig.c","csrc/math/atan.c","csrc/math/atan2.c","csrc/math/exp.c","csrc/math/log.c","csrc/math/pow.c","csrc/math/sqrt.c","csrc/math/scalbn.c","csrc/math/copysign.c","csrc/math/fabs.c","csrc/math/floor.c","csrc/math/mathf.c","csrc/math/stdlib_vec.c"])
+def _vmath(op,src,src2,dst,a,b):
+    pass
+
+def vsin(src,dst=None):
+    """
+.. function:: vsin(src,dst=None)
+
+   Compute the sine of every element of the buffer *src* into the buffer *dst* (*src* itself if not given) and return *dst*.
+
+   The array functions :func:`vsin`, :func:`vcos`, :func:`vexp`, :func:`vlog`, :func:`vsqrt`, :func:`vpow`, :func:`vatan2` and :func:`vscale`
+   transform a whole buffer with a single call, without allocating a float per element. Buffers can be:
+
+   * a :class:`bytearray` of single precision floats in native byte order (4 bytes each, as packed by :mod:`struct` with ``"f"``);
+   * a :class:`shortarray` of Q15 fixed point samples, the signed values in [-1,1) multiplied by 32768 and used by the :mod:`dsp` module.
+     Angles are normalized to pi: :func:`vsin` and :func:`vcos` take ``x*pi`` radians and :func:`vatan2` returns radians divided by pi.
+     Results are rounded and saturated to the Q15 range.
+
+   *src* can also be :class:`bytes` or :class:`shorts`; *dst* must be of the same kind and at least as long as *src*.
+   Unlike the scalar functions, a ``TypeError`` is raised for buffers of the wrong kind and an ``IndexError`` if *dst* is too short.
+    """
+    return _vmath(0,src,None,src if dst is None else dst,0,0)
+
+def vcos(src,dst=None):
+    """
+.. function:: vcos(src,dst=None)
+
+   Compute the cosine of every element of *src* into *dst* (*src* itself if not given) and return *dst*.
+    """
+    return _vmath(1,src,None,src if dst is None else dst,0,0)
+
+def vexp(src,dst=None):
+    """
+.. function:: vexp(src,dst=None)
+
+   Compute ``e**x`` for every element *x* of *src* into *dst* (*src* itself if not given) and return *dst*.
+    """
+    return _vmath(2,src,None,src if dst is None else dst,0,0)
+
+def vlog(src,dst=None):
+    """
+.. function:: vlog(src,dst=None)
+
+   Compute the natural logarithm of every element of *src* into *dst* (*src* itself if not given) and return *dst*.
+    """
+    return _vmath(3,src,None,src if dst is None else dst,0,0)
+
+def vsqrt(src,dst=None):
+    """
+.. function:: vsqrt(src,dst=None)
+
+   Compute the square root of every element of *src* into *dst* (*src* itself if not given) and return *dst*.
+    """
+    return _vmath(4,src,None,src if dst is None else dst,0,0)
+
+def vpow(src,y,dst=None):
+    """
+.. function:: vpow(src,y,dst=None)
+
+   Raise every element of *src* to the power *y*, storing the results into *dst* (*src* itself if not given), and return *dst*.
+    """
+    return _vmath(5,src,None,src if dst is None else dst,y,0)
+
+def vatan2(y,x,dst=None):
+    """
+.. function:: vatan2(y,x,dst=None)
+
+   Compute ``atan2(y[i],x[i])`` for every pair of elements of the buffers *y* and *x* into *dst* (*y* itself if not given) and return *dst*.
+    """
+    return _vmath(6,y,x,y if dst is None else dst,0,0)
+
+def vscale(src,k,offset=0,dst=None):
+    """
+.. function:: vscale(src,k,offset=0,dst=None)
+
+   Compute ``x*k+offset`` for every element *x* of *src* into *dst* (*src* itself if not given) and return *dst*.
+   For Q15 buffers *offset* is a value in [-1,1) and the product uses integer arithmetic.
+    """
+    return _vmath(7,src,None,src if dst is None else dst,k,offset)
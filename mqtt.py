@@ -0,0 +1,485 @@
+"""
+.. module:: mqtt
+
+****
+MQTT
+****
+
+This module implements an MQTT client, protocol versions 3.1.1 and 5, over TCP or TLS sockets.
+
+Packets are encoded and decoded natively: a packet to send is encoded into a transmit buffer allocated once per :class:`Client`
+and sent with its payload by a single :meth:`socket.socket.sendmsg`, so that publishing does not concatenate the payload to the header;
+received packets are read by :meth:`socket.socket.read_mqtt` through the receive buffer of the socket, and the payload of a message is
+handed to the callbacks in the receive buffer of the client itself. Topic filters, with the ``+`` and ``#`` wildcards, are matched natively
+and the messages published with QoS 1 waiting for their acknowledgement are tracked in a fixed table of *inflight* slots.
+
+The module supports QoS 0 and 1. QoS 2 is not supported: subscriptions are made with QoS 0 or 1, so the broker never sends QoS 2 messages to the client.
+Version 5 packets are sent without properties, except the session expiry interval of CONNECT, and the properties of received packets are skipped.
+
+A client is driven by :meth:`Client.loop`, that reads and dispatches the incoming packets, sends the keepalive pings and retransmits
+unacknowledged messages. :meth:`Client.publish` can be called from any thread, while :meth:`Client.loop`, :meth:`Client.subscribe`
+and :meth:`Client.unsubscribe` must be called from the same one.
+
+Exceptions raised:
+
+    * :exc:`MQTTConnectionError` when the broker refuses the connection, does not answer the keepalive pings or closes the connection;
+    * :exc:`MQTTInflightError` when a QoS 1 message is published while all the inflight slots are taken;
+    * :exc:`MQTTError` when a subscription is refused or a packet is malformed.
+
+    """
+
+import socket
+import ssl
+import timers
+import threading
+
+new_exception(MQTTError,Exception)
+new_exception(MQTTConnectionError,MQTTError)
+new_exception(MQTTInflightError,MQTTError)
+
+PORT = 1883
+TLS_PORT = 8883
+
+# protocol versions
+MQTT_311 = 4
+MQTT_5 = 5
+
+# milliseconds before an unacknowledged QoS 1 message is sent again
+RETRANSMIT_TIMEOUT = 10000
+# milliseconds to wait for CONNACK, SUBACK and UNSUBACK
+ACK_TIMEOUT = 10000
+
+# packet types, high nibble of the first byte
+_CONNACK = 0x20
+_PUBLISH = 0x30
+_PUBACK = 0x40
+_SUBACK = 0x90
+_UNSUBACK = 0xb0
+_DISCONNECT = 0xe0
+
+_PINGREQ_PACKET = b"\xc0\x00"
+_DISCONNECT_PACKET = b"\xe0\x00"
+
+# at most one bit per filter in the match mask
+_MAX_FILTERS = 30
+
+
+@native_c("_mqtt_connect",["csrc/mqtt/mqtt.c"])
+def _mqtt_connect(buf,version,client_id,keepalive,clean,user,password,will_topic,will_message,will_qos,will_retain,session_expiry):
+    pass
+
+@native_c("_mqtt_publish",["csrc/mqtt/mqtt.c"])
+def _mqtt_publish(buf,topic,pid,flags,plen,version):
+    pass
+
+@native_c("_mqtt_subscribe",["csrc/mqtt/mqtt.c"])
+def _mqtt_subscribe(buf,pid,filters,qos,version):
+    pass
+
+@native_c("_mqtt_publish_parse",["csrc/mqtt/mqtt.c"])
+def _mqtt_publish_parse(buf,n,flags,version):
+    pass
+
+@native_c("_mqtt_matches",["csrc/mqtt/mqtt.c"])
+def _mqtt_matches(filters,topic):
+    pass
+
+@native_c("_mqtt_inflight_new",["csrc/mqtt/mqtt.c"])
+def _mqtt_inflight_new(size):
+    pass
+
+@native_c("_mqtt_inflight_add",["csrc/mqtt/mqtt.c"])
+def _mqtt_inflight_add(table,now):
+    pass
+
+@native_c("_mqtt_inflight_ack",["csrc/mqtt/mqtt.c"])
+def _mqtt_inflight_ack(table,pid):
+    pass
+
+@native_c("_mqtt_inflight_due",["csrc/mqtt/mqtt.c"])
+def _mqtt_inflight_due(table,now,timeout):
+    pass
+
+@native_c("_mqtt_inflight_count",["csrc/mqtt/mqtt.c"])
+def _mqtt_inflight_count(table):
+    pass
+
+
+class Client():
+    """
+============
+Client class
+============
+
+.. class:: Client(client_id, version=MQTT_311, keepalive=60, clean=True, bufsize=1024, inflight=8, session_expiry=0)
+
+    Create an MQTT client identified by *client_id*, speaking the protocol *version* (:data:`MQTT_311` or :data:`MQTT_5`).
+
+    *keepalive* is the keepalive interval in seconds, 0 to disable it; *clean* asks the broker for a clean session at each connection.
+    With version 5, *session_expiry* is the session expiry interval in seconds sent with CONNECT.
+
+    *bufsize* is the size of the transmit and of the receive buffer: the transmit buffer holds control packets and the headers of published
+    messages, the receive buffer holds a received message. Messages longer than *bufsize* are acknowledged but not dispatched, and counted in
+    the attribute ``dropped``.
+
+    *inflight* is the number of QoS 1 messages, subscriptions and unsubscriptions that can wait for their acknowledgement at the same time (at most 64).
+
+    """
+    def __init__(self,client_id,version=MQTT_311,keepalive=60,clean=True,bufsize=1024,inflight=8,session_expiry=0):
+        if version!=MQTT_311 and version!=MQTT_5:
+            raise ValueError
+        self.client_id = client_id
+        self.version = version
+        self.keepalive = keepalive
+        self.clean = clean
+        self.session_expiry = session_expiry
+        self.retransmit = RETRANSMIT_TIMEOUT
+        self.dropped = 0
+        self.reason = 0
+        self._bufsize = bufsize
+        self._tx = bytearray(bufsize)
+        self._rx = bytearray(bufsize)
+        self._ack = bytearray(4)
+        self._lock = threading.Lock()
+        self._inflight = _mqtt_inflight_new(inflight)
+        # the QoS 1 message of each inflight slot as (topic, payload, flags, packet id), None for subscriptions
+        self._pending = [None]*inflight
+        self._filters = []
+        self._callbacks = []
+        self._sock = None
+        self._last_tx = 0
+        self._last_rx = 0
+        self._ping = False
+
+    def connect(self,host,port=None,ctx=None,user=None,password=None,will=None,conn_ifc=None):
+        """
+.. method:: connect(host, port=None, ctx=None, user=None, password=None, will=None, conn_ifc=None)
+
+    Connect to the broker at *host* (a name or an ip address) and *port*, reached through the net driver *conn_ifc* (the default one if None).
+    If *ctx* is given the connection is made over TLS with the ssl context *ctx* (see :mod:`ssl`); *port* defaults to :data:`PORT`
+    or :data:`TLS_PORT` accordingly.
+
+    *user* and *password* are sent if not None. *will* is a tuple (topic, message, qos, retain) with the message the broker
+    publishes if the connection is lost.
+
+    QoS 1 messages still waiting for their acknowledgement are sent again when the broker resumes the session; they are dropped otherwise.
+    Subscriptions are not restored by the client: the broker keeps them in a resumed session, and they must be made again in a new one.
+
+    Returns True if the broker resumed a previous session. Raises :exc:`MQTTConnectionError` if the broker refuses the connection,
+    setting the attribute ``reason`` to the return code of CONNACK.
+
+        """
+        if self._sock is not None:
+            self._close()
+        if port is None:
+            port = PORT if ctx is None else TLS_PORT
+        conn = conn_ifc if conn_ifc is not None else __builtins__.__default_net["sock"][0]
+        ip = conn.gethostbyname(host)
+        if ctx is None:
+            sock = socket.socket(socket.AF_INET,socket.SOCK_STREAM)
+        else:
+            sock = ssl.sslsocket(ctx=ctx)
+        try:
+            sock.connect((ip,port))
+        except Exception as e:
+            sock.close()
+            raise e
+        self._sock = sock
+        if will is None:
+            will = (None,None,0,False)
+        try:
+            n = _mqtt_connect(self._tx,self.version,self.client_id,self.keepalive,self.clean,user,password,will[0],will[1],will[2],will[3],self.session_expiry)
+            self._send(self._tx,n)
+            sock.settimeout(ACK_TIMEOUT)
+            r = sock.read_mqtt(self._rx)
+            if r[0]&0xf0!=_CONNACK or r[1]<2:
+                raise MQTTConnectionError
+            self.reason = self._rx[1]
+            if self.reason!=0:
+                raise MQTTConnectionError
+            resumed = (self._rx[0]&1)==1
+        except Exception as e:
+            self._close()
+            raise e
+        self._last_rx = timers.monotonic_ms()
+        self._ping = False
+        if resumed:
+            self._resend()
+        else:
+            self._inflight = _mqtt_inflight_new(len(self._pending))
+            self._pending = [None]*len(self._pending)
+        return resumed
+
+    def _close(self):
+        try:
+            self._sock.close()
+        except Exception as e:
+            pass
+        self._sock = None
+
+    def _send(self,buf,n=-1):
+        # buf, or the first n bytes of the transmit buffer
+        self._lock.acquire()
+        try:
+            if n<0:
+                self._sock.sendall(buf)
+            else:
+                __elements_set(buf,n)
+                try:
+                    self._sock.sendall(buf)
+                finally:
+                    __elements_set(buf,self._bufsize)
+        finally:
+            self._lock.release()
+        self._last_tx = timers.monotonic_ms()
+
+    def _send_publish(self,topic,payload,pid,flags):
+        # header in the transmit buffer, payload sent after it by the same call
+        self._lock.acquire()
+        try:
+            n = _mqtt_publish(self._tx,topic,pid,flags,len(payload),self.version)
+            __elements_set(self._tx,n)
+            self._sock.sendmsg((self._tx,payload))
+        finally:
+            __elements_set(self._tx,self._bufsize)
+            self._lock.release()
+        self._last_tx = timers.monotonic_ms()
+
+    def _resend(self):
+        # messages of a resumed session, in order of packet id
+        for slot in range(len(self._pending)):
+            p = self._pending[slot]
+            if p is not None:
+                self._send_publish(p[0],p[1],p[3],0x0a|p[2])
+
+    def publish(self,topic,payload,qos=0,retain=False):
+        """
+.. method:: publish(topic, payload, qos=0, retain=False)
+
+    Publish *payload* (a string, bytes or bytearray) on *topic* with *qos* 0 or 1.
+
+    A QoS 1 message takes an inflight slot until the broker acknowledges it, and is sent again with the DUP flag
+    by :meth:`loop` every ``retransmit`` milliseconds (:data:`RETRANSMIT_TIMEOUT` by default) until then: *payload* must not be changed in the meantime.
+    Raises :exc:`MQTTInflightError` if all the slots are taken.
+
+    Returns the packet id of a QoS 1 message, 0 for QoS 0.
+
+        """
+        if self._sock is None:
+            raise MQTTConnectionError
+        flags = 1 if retain else 0
+        if qos==0:
+            self._send_publish(topic,payload,0,flags)
+            return 0
+        if qos!=1:
+            raise ValueError
+        r = _mqtt_inflight_add(self._inflight,timers.monotonic_ms())
+        if r<0:
+            raise MQTTInflightError
+        pid = r&0xffff
+        self._pending[r>>16] = (topic,payload,flags,pid)
+        self._send_publish(topic,payload,pid,0x02|flags)
+        return pid
+
+    def inflight(self):
+        """
+.. method:: inflight()
+
+    Return the number of messages and subscriptions waiting for their acknowledgement.
+
+        """
+        return _mqtt_inflight_count(self._inflight)
+
+    def _wait_ack(self,type,pid):
+        # reads packets, dispatching messages, until the ack of type for pid
+        deadline = timers.monotonic_ms()+ACK_TIMEOUT
+        while True:
+            left = deadline-timers.monotonic_ms()
+            if left<=0:
+                raise TimeoutError
+            r = self._read(left)
+            if r is None:
+                continue
+            if r[0]==type and r[1]>=2 and ((self._rx[0]<<8)|self._rx[1])==pid:
+                return r[1]
+
+    def _control(self,filters,qos):
+        # subscribe or, with qos -1, unsubscribe: returns the length of the ack in the receive buffer
+        if self._sock is None:
+            raise MQTTConnectionError
+        r = _mqtt_inflight_add(self._inflight,timers.monotonic_ms())
+        if r<0:
+            raise MQTTInflightError
+        pid = r&0xffff
+        try:
+            n = _mqtt_subscribe(self._tx,pid,filters,qos,self.version)
+            self._send(self._tx,n)
+            return self._wait_ack(_SUBACK if qos>=0 else _UNSUBACK,pid)
+        finally:
+            _mqtt_inflight_ack(self._inflight,pid)
+
+    def subscribe(self,topic,callback,qos=0):
+        """
+.. method:: subscribe(topic, callback, qos=0)
+
+    Subscribe to the topic filter *topic*, with the maximum QoS *qos* (0 or 1), and wait for the broker to accept the subscription.
+
+    *callback* is called by :meth:`loop` as *callback(topic, payload)* for every message whose topic matches *topic*;
+    *payload* is the receive buffer of the client, valid only during the call: a callback keeping it must copy it.
+    At most 30 topic filters can be subscribed at a time.
+
+    Raises :exc:`MQTTError` if the broker refuses the subscription.
+
+        """
+        if qos!=0 and qos!=1:
+            raise ValueError
+        if topic not in self._filters and len(self._filters)>=_MAX_FILTERS:
+            raise MQTTError
+        n = self._control((topic,),qos)
+        # return code after packet id and, for version 5, the properties
+        if self._rx[n-1]>=0x80:
+            raise MQTTError
+        if topic in self._filters:
+            self._callbacks[self._filters.index(topic)] = callback
+        else:
+            self._filters.append(topic)
+            self._callbacks.append(callback)
+
+    def unsubscribe(self,topic):
+        """
+.. method:: unsubscribe(topic)
+
+    Unsubscribe from the topic filter *topic* and wait for the broker to confirm it.
+
+        """
+        self._control((topic,),-1)
+        if topic in self._filters:
+            i = self._filters.index(topic)
+            self._filters.pop(i)
+            self._callbacks.pop(i)
+
+    def _read(self,timeout):
+        # reads and handles one packet: returns (type, length) of acks and pings, None on timeout or for messages
+        self._sock.settimeout(timeout)
+        try:
+            r = self._sock.read_mqtt(self._rx)
+        except TimeoutError:
+            return None
+        except IOError:
+            # also a packet started but not completed in time: the stream can't be parsed anymore
+            self._close()
+            raise MQTTConnectionError
+        hdr = r[0]
+        n = r[1]
+        if hdr<0:
+            self._close()
+            raise MQTTConnectionError
+        self._last_rx = timers.monotonic_ms()
+        self._ping = False
+        type = hdr&0xf0
+        if type==_PUBLISH:
+            self._message(hdr&0x0f,n)
+            return None
+        if type==_PUBACK:
+            if n>=2:
+                slot = _mqtt_inflight_ack(self._inflight,(self._rx[0]<<8)|self._rx[1])
+                if slot>=0:
+                    self._pending[slot] = None
+            return None
+        if type==_DISCONNECT:
+            self._close()
+            raise MQTTConnectionError
+        return (type,n)
+
+    def _message(self,flags,n):
+        qos = (flags>>1)&3
+        if n>self._bufsize:
+            self.dropped+=1
+            n = self._bufsize
+            if qos==0:
+                return
+            dispatch = False
+        else:
+            dispatch = True
+        r = _mqtt_publish_parse(self._rx,n,flags,self.version)
+        if dispatch:
+            topic = r[0]
+            mask = _mqtt_matches(self._filters,topic)
+            callbacks = self._callbacks
+            __elements_set(self._rx,r[2])
+            try:
+                i = 0
+                while mask:
+                    if mask&1:
+                        callbacks[i](topic,self._rx)
+                    mask = mask>>1
+                    i+=1
+            finally:
+                __elements_set(self._rx,self._bufsize)
+        if qos==1:
+            # acked after the callbacks: a message is delivered at least once
+            pid = r[1]
+            self._ack[0] = _PUBACK
+            self._ack[1] = 2
+            self._ack[2] = pid>>8
+            self._ack[3] = pid&0xff
+            self._send(self._ack)
+
+    def loop(self,timeout=1000):
+        """
+.. method:: loop(timeout=1000)
+
+    Wait up to *timeout* milliseconds for a packet from the broker and handle it, calling the callbacks of a message;
+    send a ping if nothing has been sent for the keepalive interval and the QoS 1 messages due for retransmission.
+
+    Raises :exc:`MQTTConnectionError` if the connection is closed or the broker does not answer a ping within half the keepalive interval.
+
+        """
+        if self._sock is None:
+            raise MQTTConnectionError
+        now = timers.monotonic_ms()
+        while True:
+            r = _mqtt_inflight_due(self._inflight,now,self.retransmit)
+            if r<0:
+                break
+            p = self._pending[r>>16]
+            if p is not None:
+                self._send_publish(p[0],p[1],p[3],0x0a|p[2])
+        if self.keepalive:
+            ka = self.keepalive*1000
+            if self._ping and now-self._last_rx>=ka+ka//2:
+                self._close()
+                raise MQTTConnectionError
+            if not self._ping and now-self._last_tx>=ka:
+                self._send(_PINGREQ_PACKET)
+                self._ping = True
+            left = self._last_tx+ka-now
+            if left>0 and left<timeout:
+                timeout = left
+        if timeout<1:
+            timeout = 1
+        self._read(timeout)
+
+    def loop_forever(self):
+        """
+.. method:: loop_forever()
+
+    Call :meth:`loop` until the connection is lost, then raise :exc:`MQTTConnectionError`.
+
+        """
+        while True:
+            self.loop()
+
+    def disconnect(self):
+        """
+.. method:: disconnect()
+
+    Send DISCONNECT to the broker and close the connection. QoS 1 messages waiting for acknowledgement are kept for a resumed session.
+
+        """
+        if self._sock is None:
+            return
+        try:
+            self._sock.sendall(_DISCONNECT_PACKET)
+        finally:
+            self._close()
@@ -8,6 +8,7 @@ MsgPack
 This module define functions to serialize and unserialize objects to and from `msgpack <http://msgpack.org>`_ format.
 
 Objects serialized with msgpack are usually smaller than their equivalent json representation.
+Packing and unpacking are performed natively; the Python implementation is kept as a fallback.
 
 The supported formats are shown in the table below.
 
@@ -32,31 +33,64 @@ The supported formats are shown in the table below.
 +-----------------+----------------------------+-------------------------+
 | bin 16          | 11000101                   | 0xc5                    |
 +-----------------+----------------------------+-------------------------+
+| bin 32          | 11000110                   | 0xc6                    |
++-----------------+----------------------------+-------------------------+
+| ext 8           | 11000111                   | 0xc7                    |
++-----------------+----------------------------+-------------------------+
+| ext 16          | 11001000                   | 0xc8                    |
++-----------------+----------------------------+-------------------------+
+| ext 32          | 11001001                   | 0xc9                    |
++-----------------+----------------------------+-------------------------+
 | float 32        | 11001010                   | 0xca                    |
 +-----------------+----------------------------+-------------------------+
+| float 64        | 11001011                   | 0xcb                    |
++-----------------+----------------------------+-------------------------+
 | uint 8          | 11001100                   | 0xcc                    |
 +-----------------+----------------------------+-------------------------+
 | uint 16         | 11001101                   | 0xcd                    |
 +-----------------+----------------------------+-------------------------+
 | uint 32         | 11001110                   | 0xce                    |
 +-----------------+----------------------------+-------------------------+
+| uint 64         | 11001111                   | 0xcf                    |
++-----------------+----------------------------+-------------------------+
 | int 8           | 11010000                   | 0xd0                    |
 +-----------------+----------------------------+-------------------------+
 | int 16          | 11010001                   | 0xd1                    |
 +-----------------+----------------------------+-------------------------+
 | int 32          | 11010010                   | 0xd2                    |
 +-----------------+----------------------------+-------------------------+
+| int 64          | 11010011                   | 0xd3                    |
++-----------------+----------------------------+-------------------------+
+| fixext 1        | 11010100                   | 0xd4                    |
++-----------------+----------------------------+-------------------------+
+| fixext 2        | 11010101                   | 0xd5                    |
++-----------------+----------------------------+-------------------------+
+| fixext 4        | 11010110                   | 0xd6                    |
++-----------------+----------------------------+-------------------------+
+| fixext 8        | 11010111                   | 0xd7                    |
++-----------------+----------------------------+-------------------------+
+| fixext 16       | 11011000                   | 0xd8                    |
++-----------------+----------------------------+-------------------------+
 | str 8           | 11011001                   | 0xd9                    |
 +-----------------+----------------------------+-------------------------+
 | str 16          | 11011010                   | 0xda                    |
 +-----------------+----------------------------+-------------------------+
+| str 32          | 11011011                   | 0xdb                    |
++-----------------+----------------------------+-------------------------+
 | array 16        | 11011100                   | 0xdc                    |
 +-----------------+----------------------------+-------------------------+
+| array 32        | 11011101                   | 0xdd                    |
++-----------------+----------------------------+-------------------------+
 | map 16          | 11011110                   | 0xde                    |
 +-----------------+----------------------------+-------------------------+
+| map 32          | 11011111                   | 0xdf                    |
++-----------------+----------------------------+-------------------------+
 | negative fixint | 111xxxxx                   | 0xe0 - 0xff             |
 +-----------------+----------------------------+-------------------------+
 
+Floats are packed as float 32 when that represents them exactly, as float 64 otherwise.
+Ext types are represented by instances of :class:`ExtType`.
+
     """
 
 import struct
@@ -64,6 +98,9 @@ import struct
 new_exception(ZMsgPackError, Exception)
 new_exception(MsgUnpackError, Exception)
 
+# the native library is set up by the first pack or unpack, not at import
+_ready = False
+
 def _pack(obj, res):
     t = type(obj)
     if t == PDICT:
@@ -80,9 +117,12 @@ def _pack(obj, res):
             elif obj <= 0xffff:
                 res.append(0xcd)
                 res.extend(struct.pack('>H', obj))
-            else:
+            elif obj <= 0xffffffff:
                 res.append(0xce)
                 res.extend(struct.pack('>I', obj))
+            else:
+                res.append(0xcf)
+                res.extend(struct.pack('>Q', obj))
         else:
             if obj >= -32:
                 res.extend(struct.pack('b', obj))
@@ -92,9 +132,12 @@ def _pack(obj, res):
             elif obj >= -32768:
                 res.append(0xd1)
                 res.extend(struct.pack('>h', obj))
-            else:
+            elif obj >= -2147483648:
                 res.append(0xd2)
                 res.extend(struct.pack('>i', obj))
+            else:
+                res.append(0xd3)
+                res.extend(struct.pack('>q', obj))
     elif t == PSTRING or t == PBYTEARRAY or t == PBYTES: 
         lb = ___len(obj)
         if t == PSTRING:
@@ -106,6 +149,9 @@ def _pack(obj, res):
             elif lb <= 65535:
                 res.append(0xda)
                 res.extend(struct.pack('>H', lb))
+            else:
+                res.append(0xdb)
+                res.extend(struct.pack('>I', lb))
         else:
             if lb <= 255:
                 res.append(0xc4)
@@ -113,10 +159,18 @@ def _pack(obj, res):
             elif lb <= 65535:
                 res.append(0xc5)
                 res.extend(struct.pack('>H', lb))
+            else:
+                res.append(0xc6)
+                res.extend(struct.pack('>I', lb))
         res.extend(obj)
     elif t == PFLOAT:
-        res.append(0xca)
-        res.extend(struct.pack('>f', obj))
+        f = struct.pack('>f', obj)
+        if struct.unpack('>f', f)[0] == obj:
+            res.append(0xca)
+            res.extend(f)
+        else:
+            res.append(0xcb)
+            res.extend(struct.pack('>d', obj))
     elif t == PBOOL:
         if obj:
             res.append(0xc3)
@@ -124,16 +178,37 @@ def _pack(obj, res):
             res.append(0xc2)
     elif obj == None:
         res.append(0xc0)
+    elif isinstance(obj, ExtType):
+        _pack_ext(obj, res)
     else:
         raise ZMsgPackError
 
+def _pack_ext(obj,res):
+    lb = ___len(obj.data)
+    if lb == 1 or lb == 2 or lb == 4 or lb == 8 or lb == 16:
+        res.append({1:0xd4, 2:0xd5, 4:0xd6, 8:0xd7, 16:0xd8}[lb])
+    elif lb <= 255:
+        res.append(0xc7)
+        res.append(lb)
+    elif lb <= 65535:
+        res.append(0xc8)
+        res.extend(struct.pack('>H', lb))
+    else:
+        res.append(0xc9)
+        res.extend(struct.pack('>I', lb))
+    res.extend(struct.pack('b', obj.code))
+    res.extend(obj.data)
+
 def _pack_array(obj,res):
     lb = ___len(obj)
     if lb <= 15:
         res.append(0b10010000+lb)
-    else:
+    elif lb <= 65535:
         res.append(0xdc)
         res.extend(struct.pack('>H', lb))
+    else:
+        res.append(0xdd)
+        res.extend(struct.pack('>I', lb))
     for o in obj:
         _pack(o,res)
 
@@ -141,13 +216,32 @@ def _pack_map(obj,res):
     lb = ___len(obj)
     if lb <= 15:
         res.append(0b10000000+lb)
-    else:
+    elif lb <= 65535:
         res.append(0xde)
         res.extend(struct.pack('>H',lb))
+    else:
+        res.append(0xdf)
+        res.extend(struct.pack('>I',lb))
     for k, v in obj.items():
         _pack(k,res)
         _pack(v,res)
 
+@native_c("msgpack_pack",["csrc/msgpack/*"])
+def _native_pack(obj):
+    pass
+
+@native_c("msgpack_unpack",["csrc/msgpack/*"])
+def _native_unpack(data,offs,bin_slices):
+    pass
+
+@native_c("msgpack_pack_into",["csrc/msgpack/*"])
+def _native_pack_into(buffer,offset,obj):
+    pass
+
+@native_c("msgpack_init",["csrc/msgpack/*"])
+def _native_init(extclass,codename,dataname):
+    pass
+
 def pack(obj):
     """
 .. function:: pack(obj)
@@ -156,24 +250,57 @@ def pack(obj):
 
     Raises ``MsgPackError`` when *obj* contains non serializable objects.
     """
-    res = bytearray()
-    _pack(obj,res)
-    return res
+    if not _ready:
+        _init_lib()
+    try:
+        return _native_pack(obj)
+    except:
+        # the Python encoder reports what can't be serialized
+        res = bytearray()
+        _pack(obj,res)
+        return res
+
+
+def pack_into(buffer, offset, obj):
+    """
+.. function:: pack_into(buffer,offset,obj)
+
+    Writes the msgpack representation of *obj* in the bytearray *buffer* starting from *offset*, and returns the number of bytes written.
+    A preallocated *buffer* can be reused for many messages, avoiding to allocate a new bytearray for each one.
+
+    Raises ``IndexError`` when *obj* does not fit in *buffer* and ``MsgPackError`` when *obj* contains non serializable objects.
+    """
+    if not _ready:
+        _init_lib()
+    try:
+        return _native_pack_into(buffer, offset, obj)
+    except IndexError:
+        raise IndexError
+    except:
+        raise ZMsgPackError
 
 
-def unpack(data, offs=0):
+def unpack(data, offs=0, bin_slices=False):
     """
-.. function:: unpack(data,offs=0)
+.. function:: unpack(data,offs=0,bin_slices=False)
 
     Returns an object represented in msgpack format inside the byte sequence *data* starting from offset *offs*.
 
-    Not every valid msgpack representation can be converted to python objects by *unpack*. 
-    For example, 64-bit msgpack integers and msgpack ext types. In that case, ``MsgUnpackError`` is raised.
+    Ext types are returned as :class:`ExtType` instances.
+
+    If *bin_slices* is True, bin payloads are not copied out of *data*: each one is returned as a slice selecting it inside *data*,
+    so that ``data[s]`` gives the payload. Large payloads, such as firmware chunks, can then be written where needed
+    without an intermediate copy, as long as *data* is kept.
+    Not every valid msgpack representation can be converted to python objects by *unpack*:
+    for example unsigned integers above the signed 64-bit range. In that case, ``MsgUnpackError`` is raised.
     """
     if len(data)-offs>0:
-        obj = []
-        _unpack(data, offs, obj)
-        return obj[0]
+        if not _ready:
+            _init_lib()
+        try:
+            return _native_unpack(data, offs, bin_slices)
+        except:
+            raise MsgUnpackError
     return None
 
 def _unpack(data, pos, obj):
@@ -269,3 +396,29 @@ def _unpack_map(data, pos, n, obj):
     return pos
 
 
+class ExtType():
+    """
+=============
+ExtType class
+=============
+
+.. class:: ExtType(code, data)
+
+    Create an ExtType instance, the representation of msgpack ext types. ExtType instances have two attributes: :samp:`code`,
+    the application defined type of the extension (an integer between -128 and 127), and :samp:`data`, its payload (a byte sequence).
+    An instance of this class is returned by :func:`unpack` when an ext type is found.
+
+    """
+    def __init__(self, code, data):
+        self.code = code
+        self.data = data
+    def _get_names(self):
+        return __nameof(code),__nameof(data)
+    def __str__(self):
+        return "ExtType("+str(self.code)+":"+str(self.data)+")"
+
+def _init_lib():
+    global _ready
+    codename, dataname = ExtType(0,b"")._get_names()
+    _native_init(ExtType,codename,dataname)
+    _ready = True
@@ -6,11 +6,54 @@ NTPClient Library
 ******************
     This library retrieve the current time from an NTP server.
     A method to convert the timestamp from ntc to a human readable format is available in the examples.
+
+    :class:`NTPClient` makes a single query and returns the time of the server. :class:`NTPSync` instead keeps a clock
+    synchronized: it queries the server periodically from a thread, reusing the same socket and packet, and corrects the clock
+    read by :func:`now` by slewing it, so that once synchronized it does not jump nor go back.
     
+.. function:: now(micros=False)
+
+    Return the time kept by :class:`NTPSync` as a tuple of seconds and microseconds since January 1st 1970,
+    or as the microseconds since then if *micros* is True (a large integer, for VMs with 64 bits integers).
+    Before the first synchronization the clock starts from 1970 at boot.
+
+.. function:: synced()
+
+    Return True if the clock of :func:`now` has been synchronized at least once.
+
+.. function:: stats()
+
+    Return a tuple ``(synced, offset, delay, freq, slew)`` with the offset from the server and the round trip delay measured by the
+    last query, in microseconds, the frequency correction of the clock in parts per billion and the part of the last correction
+    still to be slewed, in microseconds.
+
     """
 
 import socket
 
+STEPPED = 2
+SLEWED = 1
+SAMPLE = 0
+
+@native_c("_ntp_request",["csrc/ntp/ntpclock.c"])
+def _ntp_request(pkt):
+    pass
+
+@native_c("_ntp_response",["csrc/ntp/ntpclock.c"])
+def _ntp_response(pkt,n):
+    pass
+
+@native_c("_ntp_now",["csrc/ntp/ntpclock.c"])
+def now(micros=False):
+    pass
+
+@native_c("_ntp_stats",["csrc/ntp/ntpclock.c"])
+def stats():
+    pass
+
+def synced():
+    return stats()[0]
+
 class NTPClient():
     """
 ===============
@@ -65,3 +108,139 @@ NTPClient class
                 sleep(100)
         else:
             sock.close()
+
+
+class NTPSync():
+    """
+=============
+NTPSync class
+=============
+
+.. class:: NTPSync(conn_ifc=None, server="0.pool.ntp.org", period=64000, rtc_sync=True)
+
+    Create a time synchronization service querying *server* every *period* milliseconds through *conn_ifc*
+    (the default network interface if None).
+
+    Each query gives a sample of the offset of the local clock from the server and of the round trip delay; as in NTP, among the last 8
+    samples only the one with the smallest delay, the least disturbed by network queues, corrects the clock. Offsets up to 128 ms
+    are slewed at 500 ppm at most, larger ones (the first one, usually) step the clock. Each correction also adjusts the frequency of the
+    clock, so that its drift between queries decreases over time.
+
+    The server name is resolved once, and again only after 4 queries in a row fail. Packet buffer and socket are created once and reused.
+
+    If *rtc_sync* is True, the :mod:`rtc` is kept synchronized too: it is set when the clock steps or when it drifts away from
+    the clock by more than *rtc_error* microseconds (5000 by default). Since the rtc drivers have no trimming, its drift is only
+    measured between settings, in :attr:`rtc_drift` (parts per million).
+    """
+    def __init__(self, conn_ifc=None, server="0.pool.ntp.org", period=64000, rtc_sync=True):
+        self._conn = conn_ifc if conn_ifc is not None else __builtins__.__default_net["sock"][0]
+        self._server = server
+        self._addr = None
+        self._sock = None
+        self._pkt = bytearray(48)
+        self._fails = 0
+        self.period = period
+        self.timeout = 1000
+        self.rtc_error = 5000
+        self.rtc_drift = 0
+        self._rtc = None
+        self._rtc_at = None
+        if rtc_sync:
+            try:
+                import rtc
+                self._rtc = rtc
+            except Exception:
+                pass
+
+    def _open(self):
+        if self._addr is None:
+            ip = socket.ip_to_tuple(self._conn.gethostbyname(self._server))
+            self._addr = (ip[0], ip[1], ip[2], ip[3], 123)
+        if self._sock is None:
+            self._sock = socket.socket(type=socket.SOCK_DGRAM)
+            self._sock.settimeout(self.timeout)
+            # replies from other addresses are dropped by the driver
+            self._sock.connect(self._addr)
+
+    def _close(self):
+        if self._sock is not None:
+            try:
+                self._sock.close()
+            except Exception:
+                pass
+        self._sock = None
+
+    def sync(self):
+        """
+.. method:: sync()
+
+        Make a single query in the calling thread and return ``STEPPED`` or ``SLEWED`` if the clock was corrected, ``SAMPLE`` if the sample
+        was only kept by the filter. Exceptions of the network, or ``ValueError`` for a reply that is not valid, are raised.
+        """
+        try:
+            self._open()
+            _ntp_request(self._pkt)
+            self._sock.send(self._pkt)
+            while True:
+                n = self._sock.recv_into(self._pkt,48)
+                try:
+                    res = _ntp_response(self._pkt,n)
+                    break
+                except ValueError:
+                    # late reply to a previous query: wait for this one
+                    pass
+        except Exception as e:
+            self._fails+=1
+            if self._fails>=4:
+                self._fails = 0
+                self._addr = None
+                self._close()
+            raise e
+        self._fails = 0
+        if self._rtc is not None:
+            self._discipline(res==STEPPED)
+        return res
+
+    def _discipline(self, force):
+        try:
+            s, us = self._rtc.get_utc(1)
+            t = now()
+            # microseconds are kept apart, integers of the VM may be 32 bits
+            err = (t[0]-s)*1000000+t[1]-us
+            if self._rtc_at is not None and not force and t[0]>self._rtc_at:
+                # error accumulated since the last setting, in microseconds per second
+                self.rtc_drift = err//(t[0]-self._rtc_at)
+            if force or err>self.rtc_error or err<-self.rtc_error or self._rtc_at is None:
+                t = now()
+                self._rtc.set_utc(t[0],t[1])
+                self._rtc_at = t[0]
+        except Exception:
+            # no rtc
+            self._rtc = None
+
+    def _run(self):
+        while self._running:
+            try:
+                self.sync()
+                sleep(self.period)
+            except Exception:
+                sleep(min(self.period,2000) if not synced() else self.period//4)
+        self._close()
+
+    def start(self, prio=PRIO_LOW, size=-1):
+        """
+.. method:: start(prio=PRIO_LOW, size=-1)
+
+        Start the thread that queries the server periodically, with priority *prio* and stack *size*.
+        Until the first synchronization, failed queries are retried every 2 seconds at most.
+        """
+        self._running = True
+        thread(self._run,prio=prio,size=size)
+
+    def stop(self):
+        """
+.. method:: stop()
+
+        Stop the synchronization thread after its current query.
+        """
+        self._running = False
@@ -143,6 +143,42 @@ def listdir(path):
     __default_fs.free_fd_n('dirs', n)
     return dir_list
 
+def scandir(path, pattern = None, batch = 16):
+    """
+.. function:: scandir(path, pattern = None, batch = 16)
+
+    Return a list with an entry for each item of the directory given by path, in arbitrary order. Each entry is a tuple (name, size, attrib, mtime), where:
+
+        * *name* is the name of the item
+        * *size* is the size in bytes (0 for directories)
+        * *attrib* are the attribute bits of the item: 0x01 read only, 0x02 hidden, 0x04 system, 0x10 directory, 0x20 archive
+        * *mtime* is the last modification time, in seconds since 1970-01-01 (in the time zone used to write the disk)
+
+    If *pattern* is given, only the items whose name matches it are listed: ``?`` matches any character and ``*`` any sequence of characters (e.g. ``"*.log"``).
+
+    The directory is read in a single pass, *batch* items per call to the filesystem driver.
+
+    """
+    n = __default_fs.get_available_fd_n('dirs')
+    if n == None:
+        raise OSError
+    if __default_fs.__f_opendir(path, n) == -1:
+        __default_fs.free_fd_n('dirs', n)
+        raise OSError
+    entries = []
+    while True:
+        res = __default_fs.__f_scandir(n, batch, pattern)
+        if res == -1:
+            break
+        entries.extend(res)
+        if len(res) < batch:
+            break
+    __default_fs.__f_closedir(n)
+    __default_fs.free_fd_n('dirs', n)
+    if res == -1:
+        raise OSError
+    return entries
+
 # should be shutil
 
 def copyfile(src, dst):
@@ -180,6 +216,12 @@ The FileIO class
             * 'a' 	open for writing, appending to the end of the file if it exists
             * 'b' 	binary mode
             * '+' 	open a disk file for updating (reading and writing)
+
+    Iterating over a file returns its lines, as :meth:`readline`::
+
+        for line in os.open("config.csv", "r"):
+            print(line)
+
     """
     def __init__(self, path, mode = 'r'):
         self.closed = False
@@ -216,9 +258,52 @@ The FileIO class
         if self.closed:
             raise ValueError
         if n_bytes == -1:
-            n_bytes = self.size()
+            n_bytes = self.size() - self.tell()
         return __default_fs.__f_read(n_bytes, self._read_mode, self._n)
 
+    def readinto(self, buffer, size = -1, ofs = 0):
+        """
+.. method:: readinto(buffer, size = -1, ofs = 0)
+
+        Read up to *size* bytes from the object directly into the bytearray *buffer*, starting at position *ofs*, and return the number of bytes read.
+        If *size* is -1 or doesn't fit in *buffer*, bytes are read up to the end of *buffer*. Nothing is allocated.
+
+        0 indicates end of file.
+
+        """
+        if self.closed:
+            raise ValueError
+        res = __default_fs.__f_readinto(buffer, size, ofs, self._n)
+        if res == -1:
+            raise OSError
+        return res
+
+    def _hash_into(self, hash_cctx, hash_ctx, size = -1):
+        # used by crypto.hash.hashio: hashes the file natively, from the current position
+        if self.closed:
+            raise ValueError
+        res = __default_fs.__f_hash(hash_cctx, hash_ctx, size, self._n)
+        if res == -1:
+            raise OSError
+        return res
+
+    def _send_into(self, sink, offset = -1, count = -1):
+        # used by socket.sendfile: sends the file natively to the socket of sink
+        if self.closed:
+            raise ValueError
+        res = __default_fs.__f_sendfile(sink, offset, count, self._n)
+        if res == -1:
+            raise OSError
+        if res == -2:
+            raise IOError
+        return res
+
+    def _as_sink(self):
+        # used by adc.Stream.pipe: writes to the file from a native thread, at the current position
+        if self.closed:
+            raise ValueError
+        return __default_fs.__f_sink(self._n)
+
     def write(self, to_w, sync = False):
         """
 .. method:: write(to_w, sync = False)
@@ -306,18 +391,53 @@ The FileIO class
         """
 .. method:: readline()
 
-        Read until newline or EOF and return a single str.
+        Read until newline or EOF and return a single line, newline included, as a string or bytes depending on chosen mode.
         If the stream is already at EOF, an empty string is returned.
+
+        The file is read a sector at a time and scanned natively for the newline, so that a line costs a single call to the filesystem driver.
+        The other methods take the bytes read ahead into account: reading, writing and seeking can be mixed freely with :meth:`readline`.
         """
-        if self.closed or self._read_mode == 'b':
+        if self.closed:
             raise ValueError
-        res = ""
-        n_chr = None
-        while n_chr != '\n' and n_chr != '':
-            n_chr = self.read(1)
-            res += n_chr
+        res = __default_fs.__f_readline(self._read_mode, self._n)
+        if res == -1:
+            raise OSError
         return res
 
+    def _readline_bytearray(self):
+        # used by streams.FileStream.readline
+        if self.closed:
+            raise ValueError
+        res = __default_fs.__f_readline(2, self._n)
+        if res == -1:
+            raise OSError
+        return res
+
+    def readlines(self, hint = -1):
+        """
+.. method:: readlines(hint = -1)
+
+        Read and return a list of lines from the stream, stopping when the lines read so far total more than *hint* bytes, if *hint* is positive.
+        """
+        lines = []
+        total = 0
+        while hint <= 0 or total <= hint:
+            line = self.readline()
+            if not line:
+                break
+            lines.append(line)
+            total += len(line)
+        return lines
+
+    def __iter__(self):
+        return self
+
+    def __next__(self):
+        line = self.readline()
+        if not line:
+            raise StopIteration
+        return line
+
     def __eof(self):
         if self.closed:
             raise ValueError
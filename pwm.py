@@ -101,3 +101,30 @@ def write(pin,period,pulse,time_unit=MILLIS,npulses=0):
         return None;
     _pwm_drv.__ctl__(DRV_CMD_WRITE,pin,period,pulse,time_unit,npulses)
 
+
+@native_c("_pwm_sequence",["csrc/vbl/vbl_pwm.c"],["VHAL_PWM"])
+def _pwm_sequence(pin,period,pulses,step,repeat,time_unit):
+    pass
+
+def write_sequence(pin,period,pulses,step,repeat=1,time_unit=MILLIS):
+    """
+.. function:: write_sequence(pin, period, pulses, step, repeat=1, time_unit=MILLIS)
+
+    Play on *pin* a pwm wave of period *period* whose pulse changes over time: the pulses in the :class:`shortarray` *pulses*
+    (expressed in *time_unit* like *period*) are applied one after the other, each for *step* microseconds, and the
+    whole sequence is played *repeat* times. Pwm is disabled on return, as for :func:`write` with *npulses*.
+
+    The function blocks the calling thread until the sequence ends, but the duty cycle is updated natively without holding the
+    interpreter, so other threads keep running and Python code is not involved in the timing: ::
+
+        import pwm
+
+        # fade in and out a led in one second, three times
+        ramp = shortarray([i*10 for i in range(100)] + [1000-i*10 for i in range(100)])
+        pwm.write_sequence(D5.PWM,1000,ramp,5000,repeat=3,time_unit=MICROS)
+
+    Updates happen at the precision of the system timers, some tens of microseconds at best: the function suits fades, servo sweeps and
+    slow waveforms, not protocols that change the pulse at every period.
+
+    """
+    return _pwm_sequence(pin,period,pulses,step,repeat,time_unit)
@@ -59,6 +59,8 @@ The following constants are defined:
     If zero or negative, no timeout is enabled and the only way to exit low power mode is to configure an asynchronous interrupt.
     The time to enter (and exit) a low power mode is platform dependent and can be significative.
     Return the time in milliseconds spent in low power mode.
+    The hooks registered with :func:`add_sleep_hook` are called just before and after the low power mode.
+    While a deep sleep blocker is held (see :func:`block_deep_sleep`), STOP and STANDBY are replaced by SLEEP.
     
 
 .. function:: wakeup_reason()
@@ -166,9 +168,61 @@ PWR_INTERRUPT = 1
 PWR_TIMEOUT   = 2
 PWR_WATCHDOG  = 3
 
+import timers
+
+
+_sleep_hooks = []
+
+# time in each low power mode (SLEEP, STOP, STANDBY) as [count, ms], wakeups by reason, running time since the last
+# reset_stats, and the deep sleep blockers by name as [held since or -1, times held, ms held, sleeps downgraded]
+_slept = [[0,0],[0,0],[0,0]]
+_wakeups = [0,0,0,0]
+_since = timers.now()
+_blockers = {}
+
+def go_to_sleep(timeout, mode):
+    if mode != PWR_SLEEP:
+        for b in _blockers.values():
+            if b[0]>=0:
+                mode = PWR_SLEEP
+                b[3]+=1
+    # hooks are called in order before sleeping and in reverse order after waking up
+    n = len(_sleep_hooks)
+    for i in range(n):
+        _sleep_hooks[i](True, timeout, mode)
+    try:
+        ms = __pwr_go_to_sleep(timeout, mode)
+        st = _slept[0 if mode==PWR_SLEEP else (1 if mode==PWR_STOP else 2)]
+        st[0]+=1
+        st[1]+=ms
+        r = __pwr_wakeup_reason()
+        if r>=0 and r<4:
+            _wakeups[r]+=1
+        return ms
+    finally:
+        for i in range(n-1, -1, -1):
+            _sleep_hooks[i](False, timeout, mode)
+
+def add_sleep_hook(fn):
+    """
+.. function:: add_sleep_hook(fn)
+
+    Register *fn* to be called as *fn(entering, timeout, mode)* by :func:`go_to_sleep`, with *entering* True just before entering the low power mode
+    and False just after exiting it, with the same *timeout* and *mode*. Drivers use hooks to put their peripherals in a matching low power state
+    (e.g. :func:`wifi.set_power_save` keeps the radio associated in its lowest power mode while the microcontroller sleeps).
+    Hooks are called in order of registration before sleeping and in reverse order after. They are not called on exit from STANDBY, that restarts the VM.
+    """
+    if fn not in _sleep_hooks:
+        _sleep_hooks.append(fn)
 
+def remove_sleep_hook(fn):
+    """
+.. function:: remove_sleep_hook(fn)
 
-go_to_sleep = __pwr_go_to_sleep
+    Unregister a hook added by :func:`add_sleep_hook`.
+    """
+    if fn in _sleep_hooks:
+        _sleep_hooks.remove(fn)
 
 wakeup_reason = __pwr_wakeup_reason
 
@@ -177,3 +231,83 @@ set_status_byte = __pwr_set_status_byte
 get_status_byte = __pwr_get_status_byte
 
 get_status_size = __pwr_get_status_size
+
+
+def block_deep_sleep(name):
+    """
+.. function:: block_deep_sleep(name)
+
+    Prevent STOP and STANDBY modes until :func:`unblock_deep_sleep` is called with the same *name* (a string): meanwhile
+    :func:`go_to_sleep` enters SLEEP mode instead, keeping peripherals and clocks running. A thread sending data or a driver waiting
+    for a peripheral holds a blocker with its own name, and :func:`stats` shows how long each one kept the microcontroller out of deep sleep.
+    Blocking an already blocked *name* does nothing.
+    """
+    b = _blockers.get(name)
+    if b is None:
+        b = [-1,0,0,0]
+        _blockers[name] = b
+    if b[0]<0:
+        b[0] = timers.now()
+        b[1]+=1
+
+def unblock_deep_sleep(name):
+    """
+.. function:: unblock_deep_sleep(name)
+
+    Release the blocker *name* taken by :func:`block_deep_sleep`.
+    """
+    b = _blockers.get(name)
+    if b is not None and b[0]>=0:
+        b[2]+=timers.now()-b[0]
+        b[0] = -1
+
+def stats():
+    """
+.. function:: stats()
+
+    Return a tuple describing how the microcontroller spent its time since the start of the program or the last :func:`reset_stats`:
+
+        0. milliseconds spent running, the VM clock not counting low power modes
+        1. a tuple of *(count, milliseconds)* for each low power mode entered by :func:`go_to_sleep`, in order SLEEP, STOP, STANDBY
+        2. a tuple with the number of wakeups by reason, indexed by :samp:`PWR_RESET`, :samp:`PWR_INTERRUPT` (GPIO and peripheral events),
+           :samp:`PWR_TIMEOUT` (the timeout of :func:`go_to_sleep`) and :samp:`PWR_WATCHDOG`
+        3. a list of *(name, times, milliseconds, downgraded, held)* for each deep sleep blocker: the times it was taken, for how long in total,
+           the deep sleeps replaced by SLEEP because of it, and whether it is held now
+
+    The fraction of time in low power modes is then the sum of the milliseconds of element 1 over the same sum plus element 0. ::
+
+        run, modes, wakeups, blockers = pwr.stats()
+        slept = modes[0][1]+modes[1][1]+modes[2][1]
+        print("asleep", slept*100//(run+slept), "% woken by timeout", wakeups[pwr.PWR_TIMEOUT], "times")
+
+    Only :func:`go_to_sleep` is measured: the idle time of the tickless scheduler is spent inside the VM and is counted as running.
+    Statistics do not survive STANDBY, that restarts the VM.
+    """
+    now = timers.now()
+    bl = []
+    for name, b in _blockers.items():
+        held = b[0]>=0
+        bl.append((name,b[1],b[2]+(now-b[0] if held else 0),b[3],held))
+    return (now-_since,((_slept[0][0],_slept[0][1]),(_slept[1][0],_slept[1][1]),(_slept[2][0],_slept[2][1])),
+        (_wakeups[0],_wakeups[1],_wakeups[2],_wakeups[3]),bl)
+
+def reset_stats():
+    """
+.. function:: reset_stats()
+
+    Clear the statistics returned by :func:`stats`. Blockers held stay held, and are accounted from now on.
+    """
+    global _since
+    now = timers.now()
+    _since = now
+    for i in range(3):
+        _slept[i][0] = 0
+        _slept[i][1] = 0
+    for i in range(4):
+        _wakeups[i] = 0
+    for b in _blockers.values():
+        b[1] = 1 if b[0]>=0 else 0
+        b[2] = 0
+        b[3] = 0
+        if b[0]>=0:
+            b[0] = now
@@ -1,3 +1,4 @@
+import threading
 
 def _auto_init():
     if __defined(BOARD, "polaris_3g"):
@@ -20,6 +21,10 @@ def _get_geometry():
 def _read_data(addr,n=1):
     pass
 
+@c_native("qspiflash_read_into",[],[])
+def _read_into(addr,buffer,ofs,n):
+    pass
+
 @c_native("qspiflash_write_data",[],[])
 def _write_data(addr, data):
     pass
@@ -88,6 +93,7 @@ QSpiFlash class
 
     """
     def __init__(self, d0=None, d1=None, d2=None, d3=None, clk=None, cs=None, flash_size=None, block_size=None, subblock_size=None, sector_size=None, page_size=None, dummy_cycles_read=None, dummy_cycles_read_dual=None, dummy_cycles_read_quad=None, dummy_cycles_2read=None, dummy_cycles_4read=None, alt_bytes_pe_mode=None, alt_bytes_no_pe_mode=None, sr_wip=None, sr_wel=None, sr_bp=None, sr_srwd=None, sr1_qe=None, sr1_sus=None):
+        self._erase_exc = None
         if d0 is None:
             _auto_init()
         else:
@@ -136,6 +142,8 @@ QSpiFlash class
         Erase a whole sector passing the *addr* address of any byte contained in it.
         All sector bytes set to 0xff.
 
+        Other threads keep running while waiting for the erase.
+
         """
         _erase_sector(addr)
 
@@ -149,6 +157,54 @@ QSpiFlash class
         """
         _erase_block(addr)
 
+    def erase_async(self, addr, size, event=None):
+        """
+.. method:: erase_async(addr, size, event=None)
+
+        Start erasing the sectors holding the *size* bytes from address *addr* in a background thread, and return immediately.
+        Return a :class:`threading.Event`, *event* if given, set when the erase is complete: its :meth:`~threading.Event.is_set` polls for completion.
+
+        Sectors are erased one at a time, and the calling thread and the others keep running meanwhile:
+        reads and writes of other sectors are served between two sector erases, waiting at most the erase time of a sector,
+        so that e.g. a flash translation layer can reclaim its sectors in the background.
+        If an erase fails, the exception is raised by the next call to :meth:`erase_wait`.
+
+        """
+        if event is None:
+            event = threading.Event()
+        sector_size = _get_geometry()[3]
+        start = addr//sector_size*sector_size
+        th = threading.Thread(target=self._erase_run,args=(start,addr+size,sector_size,event))
+        th.start()
+        return event
+
+    def _erase_run(self, addr, end, step, event):
+        try:
+            if step == 0:
+                _erase_chip()
+            else:
+                while addr < end:
+                    _erase_sector(addr)
+                    addr += step
+        except Exception as e:
+            self._erase_exc = e
+        event.set()
+
+    def erase_wait(self, event, timeout=-1):
+        """
+.. method:: erase_wait(event, timeout=-1)
+
+        Wait at most *timeout* milliseconds (forever if negative) for the erase of :meth:`erase_async` or :meth:`chip_erase` that returned *event*.
+        Return True if the erase is complete, and raise the exception of a failed erase, if any.
+
+        """
+        done = event.wait(timeout)
+        if self._erase_exc is not None:
+            e = self._erase_exc
+            self._erase_exc = None
+            raise e
+        return done
+
     def read_data(self, addr, n=1):
         """
 .. method:: read_data(addr, n=1)
@@ -162,15 +218,38 @@ QSpiFlash class
         """
         return _read_data(addr, n)
 
-    def chip_erase(self):
+    def read_into(self, addr, buffer, offset=0, n=-1):
+        """
+.. method:: read_into(addr, buffer, offset=0, n=-1)
+
+        Read *n* bytes of data starting from address *addr* into the bytearray *buffer*, starting at position *offset*.
+        If *n* is negative, the rest of *buffer* after *offset* is filled. Returns the number of bytes read.
+
+        Useful to stream large contents with a single buffer, creating no temporary objects.
+
         """
-.. method:: chip_erase()
+        if n<0:
+            n = len(buffer)-offset
+        return _read_into(addr, buffer, offset, n)
+
+    def chip_erase(self, wait=True):
+        """
+.. method:: chip_erase(wait=True)
 
         Erase the whole memory.
         All memory bytes set to 0xff.
 
+        Other threads keep running during the erase, that takes seconds. If *wait* is False, the erase runs in a background thread
+        and a :class:`threading.Event` set on completion is returned, as in :meth:`erase_async`: accesses to the flash wait for the end of the erase.
+
         """
-        _erase_chip()
+        if wait:
+            _erase_chip()
+            return
+        event = threading.Event()
+        th = threading.Thread(target=self._erase_run,args=(0,0,0,event))
+        th.start()
+        return event
 
     def done(self):
         """
@@ -10,11 +10,29 @@ The queue module implements multi-producer, multi-consumer queues. It is especia
 
    """
 
-import threading
-
 new_exception(QueueFull,Exception,"Queue is full")
 new_exception(QueueEmpty,Exception,"Queue is empty")
 
+@native_c("_queue_new",["csrc/threading/*"])
+def _queue_new(maxsize):
+    pass
+
+@native_c("_queue_put",["csrc/threading/*"])
+def _queue_put(q,obj,timeout):
+    pass
+
+@native_c("_queue_get",["csrc/threading/*"])
+def _queue_get(q,timeout,remove):
+    pass
+
+@native_c("_queue_size",["csrc/threading/*"])
+def _queue_size(q):
+    pass
+
+@native_c("_queue_clear",["csrc/threading/*"])
+def _queue_clear(q):
+    pass
+
 class Queue():
     """
 ==========
@@ -28,13 +46,13 @@ Queue class
     block once this size has been reached, until queue items are consumed.  If
     *maxsize* is less than or equal to zero, the queue size is infinite.
 
+    The queue is native: items are kept in a circular buffer (allocated once if *maxsize* is given, at most 65535) and
+    every :meth:`put` and :meth:`get` is a single call, waiting for free slots or items without holding the VM.
+
     """
     def __init__(self,maxsize=0):
         self.maxsize=maxsize
-        self.mutex = threading.Lock()
-        self.not_empty = threading.Condition(self.mutex)
-        self.not_full = threading.Condition(self.mutex)
-        self.q=[]
+        self.q=_queue_new(maxsize)
     
     def qsize(self):
         """
@@ -45,10 +63,7 @@ Queue class
     guarantee that put() will not block.
 
         """
-        self.mutex.acquire()
-        res = len(self.q)
-        self.mutex.release()
-        return res
+        return _queue_size(self.q)
 
     def full(self):
         """
@@ -59,10 +74,7 @@ Queue class
     will not block.  Similarly, if full() returns ``False`` it doesn't
     guarantee that a subsequent call to put() will not block.        
         """
-        self.mutex.acquire()
-        res = self.maxsize > 0 and len(self.q)>=self.maxsize
-        self.mutex.release()
-        return res
+        return self.maxsize > 0 and _queue_size(self.q)>=self.maxsize
     
     def empty(self):
         """
@@ -74,10 +86,7 @@ Queue class
     guarantee that a subsequent call to get() will not block.
 
         """
-        self.mutex.acquire()
-        res = len(self.q)==0
-        self.mutex.release()
-        return res
+        return _queue_size(self.q)==0
     
     def put(self,obj,block=True,timeout=-1):
         """
@@ -87,16 +96,12 @@ Queue class
     If *timeout* is greater than zero, waits for the specified amount of milliseconds before raising QueueFull exception.
 
         """
-        self.not_full.acquire()
-        while self.maxsize > 0 and len(self.q)>=self.maxsize:
-            if block:
-                block = self.not_full.wait(timeout)
-            if not block:
-                self.not_full.release()
-                raise QueueFull
-        self.q.append(obj)
-        self.not_empty.notify()
-        self.not_full.release()
+        if not block:
+            timeout = 0
+        elif timeout==0:
+            timeout = -1
+        if not _queue_put(self.q,obj,timeout):
+            raise QueueFull
     
     def get(self,timeout=-1):
         """
@@ -107,16 +112,11 @@ Queue class
     Remove and return an object out of the queue. If the queue is empty, block until an item is available or timeout occurred.
 
         """
-        self.not_empty.acquire()
-        while len(self.q)==0:
-            block = self.not_empty.wait(timeout)
-            if not block:
-                self.not_empty.release()
-                raise QueueEmpty
-        res = self.q[0]
-        self.q=self.q[1:]
-        self.not_full.notify()
-        self.not_empty.release()
+        if timeout==0:
+            timeout = -1
+        res = _queue_get(self.q,timeout,True)
+        if res is self.q:
+            raise QueueEmpty
         return res
 
     def peek(self):
@@ -126,12 +126,7 @@ Queue class
     Return the object at the head of the queue without removing it. If the queue is empty, wait until an item is available.
 
         """
-        self.not_empty.acquire()
-        while len(self.q)==0:
-            self.not_empty.wait()
-        res = self.q[0]
-        self.not_empty.release()
-        return res
+        return _queue_get(self.q,-1,False)
 
     def clear(self):
         """
@@ -140,7 +135,4 @@ Queue class
     Clear the queue by removing all elements. 
 
         """
-        self.mutex.acquire()
-        self.q = []
-        self.not_full.notify()
-        self.mutex.release()
+        _queue_clear(self.q)
@@ -12,9 +12,10 @@ To use *requests* a net driver must have been properly configured and started.
 
 import urlparse
 import socket
-import streams
 import json as json_encoder
 import ssl
+import timers
+import bufpool
 
 new_exception(HTTPError,Exception)
 new_exception(HTTPConnectionError,HTTPError)
@@ -31,15 +32,16 @@ def get_pdata(data,json):
         else:
             pdata = [data,""]
     elif json is not None:
-        pdata = [json_encoder.dumps(json),"application/json"]
+        # the body is serialized while sending: keep the object and the body length
+        pdata = [json,"application/json",json_encoder.dump_size(json)]
 
     return pdata
 
 
 
-def get(url,params=None,headers=None, connection=None,ctx=None,stream_callback=None,stream_chunk=512):
+def get(url,params=None,headers=None, connection=None,ctx=None,stream_callback=None,stream_chunk=512,stream=False):
     """
-.. function:: get(url,params=None,headers=None,connection=None,stream_callback=None,stream_chunk=512)    
+.. function:: get(url,params=None,headers=None,connection=None,stream_callback=None,stream_chunk=512,stream=False)    
 
     Implements the GET method of the HTTP protocol. A tcp connection is made to the host:port given in the url using the default net driver.
     
@@ -58,9 +60,11 @@ def get(url,params=None,headers=None, connection=None,ctx=None,stream_callback=N
 
     If the parameter *stream_callback* is given, the HTTP body data will be retrieved in chunk s of *stream_chunk* size and passed as arguments to *stream_callback* one by one. If *stream_callback* is used, the content of :class:`Response` instance is the last chunk.
 
+    If *stream* is True, *get* returns as soon as the headers are received, leaving the body to be read with :meth:`Response.read_into` or :meth:`Response.iter_content`.
+
 
     """
-    return _verb(url,None,params,headers,connection,"GET",ctx, stream_callback,stream_chunk)
+    return _verb(url,None,params,headers,connection,"GET",ctx, stream_callback,stream_chunk,None,False,stream)
 
 
 def post(url,data=None,json=None,headers=None,ctx=None):
@@ -197,11 +201,16 @@ def options(url,headers=None,ctx=None):
     return _verb(url,None,None,headers,None,"OPTIONS",ctx)
 
 
-def upload(url,fd,ctx=None,mime_type="application/octet-stream",method="POST"):
+def upload(url,fd,ctx=None,mime_type="application/octet-stream",method="POST",chunk=1460,chunked=False):
     """
-.. function:: upload(url,fd,ctx=None,mime_type="application/octet-stream",method="POST")
+.. function:: upload(url,fd,ctx=None,mime_type="application/octet-stream",method="POST",chunk=1460,chunked=False)
+
+    Upload the contents of the stream *fd* to *url*. *fd* can be any stream (a :class:`streams.stream` subclass, a file, a flash region...) or object providing
+    a *read* method, and is read until it is exhausted. The body is read and sent *chunk* bytes at a time through a single reused buffer, using *_readbuf* when *fd* provides it:
+    matching *chunk* to the TCP MSS (1460 bytes on ethernet) or to the TLS record size minimizes the packets sent.
 
-    Upload a file identified by *fd* to *url*. *fd* must provide methods read and size.
+    If *fd* provides a *size* method the body is sent with a Content-Length header; otherwise, or if *chunked* is True, it is sent with chunked transfer encoding,
+    so that the size of the contents doesn't need to be known in advance.
 
     A tcp connection is made to the host:port given in the url using the default net driver.
 
@@ -213,7 +222,10 @@ def upload(url,fd,ctx=None,mime_type="application/octet-stream",method="POST"):
 
 
     """
-    return _verb(url,None,None,{"content-type":mime_type},None,method,ctx,None,0,fd)
+    size = -1
+    if not chunked and hasattr(fd,"size"):
+        size = fd.size()
+    return _verb(url,None,None,{"content-type":mime_type},None,method,ctx,None,0,(fd,size,chunk))
 
 
 
@@ -249,34 +261,27 @@ def _connect(host,port,scheme,ctx):
         raise e
 
 
-def _readline(ssock,buffer,ofs,size):
+def _readline(sock,buffer,ofs,size):
     try:
-        msg = ssock.readline(buffer=buffer,ofs=ofs,size=size)
+        msg = sock.readline(buffer=buffer,ofs=ofs,size=size)
         if len(msg)==0:
             raise ConnectionError
         return msg
     except Exception as e:
-        ssock.close()
+        sock.close()
         raise e
 
 BUFFER_LEN = 2048
 
-def add_to_buffer(buffer,what,pos):
-    l =len(what)
-    npos = pos+l
-    if l>0 and npos<BUFFER_LEN:
-        npos = pos+l
-        l=0
-        #TODO: use buffer[pos:npos]=what
-        while pos<npos:
-            buffer[pos]=__byte_get(what,l)
-            l+=1
-            pos+=1
-        return npos
-    return pos 
-
-
-def _verb(url,data=None,params=None,headers=None,connection=None,verb=None,ctx=None,stream_callback=None,stream_chunk=512,fd=None):
+RESPONSE_HEADERS = ["content-length","transfer-encoding","connection","content-type"]
+"""
+.. data:: RESPONSE_HEADERS
+
+    The list of the (lowercase) response headers stored in :attr:`Response.headers`: the others are skipped while parsing.
+    Names can be appended to keep more headers, but ``content-length``, ``transfer-encoding`` and ``connection`` are needed to read the body and must not be removed.
+"""
+
+def _verb(url,data=None,params=None,headers=None,connection=None,verb=None,ctx=None,stream_callback=None,stream_chunk=512,fd=None,keepalive=False,stream=False):
     urlp = urlparse.parse(url)
     netl = urlparse.parse_netloc(urlp[1])
     host = netl[2]
@@ -285,56 +290,36 @@ def _verb(url,data=None,params=None,headers=None,connection=None,verb=None,ctx=N
         sock = connection
     else:
         sock = _connect(host,netl[3],urlp[0],ctx)
+    _send(sock,urlp,netl,data,params,headers,verb,fd,keepalive)
+    return _response(sock,verb,keepalive,stream,stream_callback,stream_chunk)
 
+def _send(sock,urlp,netl,data,params,headers,verb,fd,keepalive):
+    host = netl[2]
     # print("CREATED SOCKET",sock.channel)
-    #Generate and send Request Line
-    msg = bytearray(BUFFER_LEN)
-    p = 0
+    #Generate Request Line
     endline = "\r\n"
-    p = add_to_buffer(msg,verb,p)
-    p = add_to_buffer(msg," ",p)
-
+    head = [verb," "]
     if not urlp[2]:
-        p = add_to_buffer(msg,"/",p)
+        head.append("/")
     else:
-        p = add_to_buffer(msg,urlp[2],p)
+        head.append(urlp[2])
     if (verb in zverbs) and (urlp[-2] or params):
-        p = add_to_buffer(msg,"?",p)
+        head.append("?")
         if urlp[-2]:
-            p = add_to_buffer(msg,urlp[-2],p)
+            head.append(urlp[-2])
             if params:
-                p = add_to_buffer(msg,"&",p)
+                head.append("&")
         if params:
-            p = add_to_buffer(msg,urlparse.urlencode(params),p)
-
-    if msg[p-1]!=__ORD(" "):
-        p = add_to_buffer(msg," ",p)
-    p = add_to_buffer(msg,"HTTP/1.1",p)
-    p = add_to_buffer(msg,endline,p)
-    __elements_set(msg,p) #clamp buffer
-    #send cmd
-    try:
-        # print(">>",msg)
-        sock.sendall(msg)
-    except Exception as e:
-        sock.close()
-        raise HTTPConnectionError
+            head.append(urlparse.urlencode(params))
+    head.append(" HTTP/1.1\r\n")
 
-    __elements_set(msg,BUFFER_LEN)
-    p = 0
-    #Generated and send Request headers
-    p = add_to_buffer(msg,"Host: ",p)
-    p = add_to_buffer(msg,host,p)
+    #Generate Request headers
+    head.append("Host: ")
+    head.append(host)
     if netl[3]:
-        p = add_to_buffer(msg,":",p)
-        p = add_to_buffer(msg,netl[3],p)
-            
-    p = add_to_buffer(msg,endline,p)
-    __elements_set(msg,p)
-    # print(">>",msg)
-    sock.sendall(msg)
-    __elements_set(msg,BUFFER_LEN)
-    p = 0
+        head.append(":")
+        head.append(netl[3])
+    head.append(endline)
 
     rh = {}
     if headers:
@@ -342,175 +327,112 @@ def _verb(url,data=None,params=None,headers=None,connection=None,verb=None,ctx=N
             rh[k.lower()]=headers[k]
     
     if "connection" not in rh:
-        rh["connection"]="close"    
+        if keepalive:
+            rh["connection"]="keep-alive"
+        else:
+            rh["connection"]="close"
 
     if data is not None:
-        rh["content-length"] = str(len(data[0])) #data[0] is actual data
+        if len(data)>2:
+            rh["content-length"] = str(data[2]) #data[2] is the length of the json body
+        else:
+            rh["content-length"] = str(len(data[0])) #data[0] is actual data
         if data[1]:
             rh["content-type"] = data[1]             #data[1] is data type header
     if fd is not None:
-        rh["content-length"] = str(fd.size())
+        # fd is (stream, size or -1 for chunked, chunk)
+        if fd[1]<0:
+            rh["transfer-encoding"] = "chunked"
+        else:
+            rh["content-length"] = str(fd[1])
 
+    for k,v in rh.items():
+        head.append(k)
+        head.append(": ")
+        head.append(v)
+        head.append(endline)
+    head.append(endline)
 
+    #Generate Body
+    if data is not None and len(data)<=2:
+        head.append(data[0])
 
-    for k,v in rh.items():
-        p = add_to_buffer(msg,k,p)
-        p = add_to_buffer(msg,": ",p)
-        p = add_to_buffer(msg,v,p)
-        p = add_to_buffer(msg,endline,p)
-        __elements_set(msg,p)
-        # print(">>",msg)
-        sock.sendall(msg)
-        __elements_set(msg,BUFFER_LEN)
-        p = 0
-
-    # Generate and send Body
-    p = add_to_buffer(msg,endline,p)
+    #send request line, headers and body at once
+    try:
+        # print(">>",head)
+        sock.sendmsg(head)
+    except Exception as e:
+        sock.close()
+        raise HTTPConnectionError
 
-    if data is not None:
-        p = add_to_buffer(msg,data[0],p)
-    
-    __elements_set(msg,p)
-    # print(">>",msg)
-    sock.sendall(msg)
-    __elements_set(msg,BUFFER_LEN)
+    if data is not None and len(data)>2:
+        # json body: serialized straight into msg, one chunk at a time
+        msg = bufpool.acquire(BUFFER_LEN)
+        json_encoder.dump(data[0],sock,msg)
+        bufpool.release(msg)
     # stream body
     if fd is not None:
-        while True:
-            rd = fd.read(512)
-            if len(rd)>0:
-                sock.sendall(rd)
-            else:
-                break
-    p = 0
-
+        _send_stream(sock,fd[0],fd[1],fd[2])
+
+def _send_stream(sock,fd,size,chunk):
+    buf = bufpool.acquire(chunk)
+    readbuf = hasattr(fd,"_readbuf")
+    sent = 0
+    while size<0 or sent<size:
+        want = chunk
+        if size>=0 and size-sent<want:
+            want = size-sent
+        if readbuf:
+            __elements_set(buf,chunk)
+            n = fd._readbuf(buf,want)
+            if n<0:
+                sock.close()
+                raise IOError
+            __elements_set(buf,n)
+            data = buf
+        else:
+            data = fd.read(want)
+            n = len(data)
+        if not n:
+            break
+        if size<0:
+            sock.sendmsg((hex(n,""),"\r\n",data,"\r\n"))
+        else:
+            sock.sendall(data)
+        sent+=n
+    bufpool.release(buf)
+    if size<0:
+        sock.sendall("0\r\n\r\n")
 
+def _response(sock,verb,keepalive,stream,stream_callback,stream_chunk):
     #Parse Response
     rr = Response()
 
-    ssock = streams.SocketStream(sock)
-    buffer = msg
-    msg = _readline(ssock,buffer,0,BUFFER_LEN)
-    # print("<<",msg)
-    
-    if msg.startswith("HTTP/1."):
-        rr.status = int(msg[9:12])
-
-    __elements_set(msg,BUFFER_LEN)
-    msg = _readline(ssock,buffer,0,BUFFER_LEN)
-    # print("<<",msg)
-    #print(msg)
-
-    #print(">[",msg,"]",msg=="\n",msg==endline)
-    while not (msg==endline or msg=="\n"):
-        idx_cl = msg.find(__ORD(":"))
-        if idx_cl<0:
-            sock.close()
-            raise HTTPResponseError
-        rr.headers[str(msg[0:idx_cl].lower())]=str(msg[idx_cl+1:-2].strip(endline))
-        __elements_set(msg,BUFFER_LEN)
-        msg = _readline(ssock,buffer,0,BUFFER_LEN)
-        # print("<<",msg)
-        # print(msg)
-        #print(">[",msg,"]",msg=="\n",msg==endline)
-   
-    #print(rr.headers)
-    rr.connection=sock
-
-    if verb != "HEAD":
-        # read response body
-        if "content-length" in rr.headers:
-            bodysize=int(rr.headers["content-length"])
-            #print("bodysize",bodysize)
-            contentsize = bodysize
-            reset_content = False
-            if stream_callback is not None:
-                reset_content = True
-                contentsize = stream_chunk
-
-            rr.content = bytearray(contentsize)
-            tmp = 0
-            rdr = 0
-            while bodysize>0:
-                if reset_content:
-                    ofs=0
-                else:
-                    ofs=tmp
-                rdr = sock.recv_into(rr.content,min(bodysize,contentsize),ofs=ofs)
-                if rdr and stream_callback:
-                    __elements_set(rr.content,rdr)
-                    stream_callback(rr.content)
-                #print(rdr,rr.content[tmp:tmp+rdr])
-                tmp+=rdr
-                bodysize-=rdr
-                if not rdr:
-                    break
-            #print("CLOSED SOCKET A",sock.channel,rdr,tmp,bodysize)
-        elif "transfer-encoding" in rr.headers:
-            if stream_callback:
-                chbuf = bytearray(stream_chunk)
-            last_term = False
-            while True:
-                __elements_set(msg,BUFFER_LEN)
-                msg = _readline(ssock,buffer,0,BUFFER_LEN)
-                # print(">>",msg,len(msg),[hex(x) for x in msg])
-                if len(msg)==0:
-                    # print("breaking out of loop")
-                    break
-                if msg=="\r\n":
-                    # print("received terminator",last_term)
-                    if last_term:
-                        break
-                    else:
-                        continue
-                chsize = int(msg,16)
-                # print("chsize",chsize)
-                if chsize:
-                    if stream_callback:
-                        while chsize>0:
-                            rdr = sock.recv_into(chbuf,min(chsize,stream_chunk),ofs=0)
-                            chsize-=rdr
-                            # print("rdr",rdr,chsize)
-                            __elements_set(chbuf,rdr)
-                            stream_callback(chbuf)
-                            __elements_set(chbuf,stream_chunk)
-                    else:
-                        chbuf = sock.recv(chsize)
-                        # print(msg)
-                        # if msg:
-                        rr.content.extend(chbuf)
-                        # else:
-                            # break
-                        # __elements_set(buffer,BUFFER_LEN)
-                        # msg = _readline(ssock,buffer,0,BUFFER_LEN)
-                else:
-                    last_term=True
-                # else:
-                #     print("Read terminator")
-                #     __elements_set(buffer,BUFFER_LEN)
-                #     msg = _readline(ssock,buffer,0,2) #terminator
-                    # break
-            #print("CLOSED SOCKET B",sock.channel)
-        else:
-            while True:
-                tmp = sock.recv(32)
-                if tmp:
-                    rr.content.extend(tmp)
-                    #print(tmp)
-                else:
-                    break
-            #print("CLOSED SOCKET C",sock.channel)
-
-    # handle connection close or keep-alive
-    if "connection" in rr.headers and rr.headers["connection"] == "keep-alive":
-        rr.connection = sock
-    else:
+    try:
+        rr.status = sock.read_http_head(RESPONSE_HEADERS,rr.headers)
+    except ValueError:
+        sock.close()
+        raise HTTPResponseError
+    except Exception as e:
+        sock.close()
+        raise e
+    if rr.status<0:
         sock.close()
-        rr.connection = None
+        raise ConnectionError
 
+    #print(rr.headers)
+    rr._start(sock,verb,keepalive)
+    if not stream:
+        rr._read_all(stream_callback,stream_chunk)
     return rr
 
 
+# how the end of the response body is known
+_BODY_DONE = 0
+_BODY_LENGTH = 1
+_BODY_CHUNKED = 2
+_BODY_CLOSE = 3
+
 class Response():
     """
 .. class:: Response
@@ -529,18 +451,166 @@ class Response():
 
     .. attribute:: headers
 
-        A dictionary with all the response headers
+        A dictionary with the response headers listed in :data:`RESPONSE_HEADERS`, keyed by their lowercase name
 
     .. attribute:: connection
 
         the connection used to communicate with the server, or None if it has been closed.
 
+    When the request is made with *stream* set to True, the body is not in *content* but must be read with :meth:`read_into` or :meth:`iter_content`,
+    whatever its transfer encoding (identity, chunked or delimited by the connection close), and *connection* is set only once the whole body has been read.
+
     """
     def __init__(self):
         self.status = 0
         self.content = bytearray()
         self.headers = {}
         self.connection = None
+        self._sock = None
+        self._mode = _BODY_DONE
+        self._left = 0
+        self._keep = False
+        self._pool = None
+
+    def _start(self,sock,verb,keepalive):
+        self._sock = sock
+        rconn = ""
+        if "connection" in self.headers:
+            rconn = self.headers["connection"].lower()
+        self._keep = rconn=="keep-alive" or (keepalive and rconn!="close")
+        if verb == "HEAD" or self.status<200 or self.status==204 or self.status==304:
+            self._finish(True)
+        elif "content-length" in self.headers:
+            self._mode = _BODY_LENGTH
+            self._left = int(self.headers["content-length"])
+            if not self._left:
+                self._finish(True)
+        elif "transfer-encoding" in self.headers:
+            # _left is the size still to read of the current chunk, -1 before the first one
+            self._mode = _BODY_CHUNKED
+            self._left = -1
+        else:
+            self._mode = _BODY_CLOSE
+
+    def _finish(self,reusable):
+        # the connection can be reused only if the end of the body is known
+        self._mode = _BODY_DONE
+        sock = self._sock
+        self._sock = None
+        if reusable and self._keep:
+            if self._pool is not None:
+                self._pool[0]._release(self._pool[1],sock)
+            else:
+                self.connection = sock
+        else:
+            sock.close()
+            self.connection = None
+
+    def _next_chunk(self):
+        line = bytearray(32)
+        if self._left==0:
+            # CRLF closing the previous chunk
+            _readline(self._sock,line,0,32)
+            __elements_set(line,32)
+        msg = _readline(self._sock,line,0,32)
+        idx = msg.find(__ORD(";"))
+        if idx>=0:
+            msg = msg[:idx]
+        self._left = int(msg,16)
+        if not self._left:
+            # skip the trailers up to the empty line
+            while True:
+                __elements_set(line,32)
+                msg = _readline(self._sock,line,0,32)
+                if msg=="\r\n" or msg=="\n":
+                    break
+            self._finish(True)
+
+    def read_into(self,buffer,ofs=0):
+        """
+.. method:: read_into(buffer,ofs=0)
+
+    Reads the next bytes of the body of a streamed response into the bytearray *buffer*, starting at *ofs*, until *buffer* is full or the body ends.
+    Returns the number of bytes read: 0 means the whole body has been read.
+        """
+        size = len(buffer)
+        start = ofs
+        while ofs<size and self._mode!=_BODY_DONE:
+            if self._mode==_BODY_CHUNKED and self._left<=0:
+                self._next_chunk()
+                continue
+            want = size-ofs
+            if self._mode!=_BODY_CLOSE and want>self._left:
+                want = self._left
+            rd = self._sock.recv_into(buffer,want,ofs=ofs)
+            ofs+=rd
+            if self._mode!=_BODY_CLOSE:
+                self._left-=rd
+                if self._mode==_BODY_LENGTH and not self._left:
+                    self._finish(True)
+            if rd<want:
+                # connection closed: complete only if delimited by the close
+                self._finish(self._mode==_BODY_CLOSE)
+        return ofs-start
+
+    def iter_content(self,buffer,callback):
+        """
+.. method:: iter_content(buffer,callback)
+
+    Reads the whole body of a streamed response a piece at a time in the bytearray *buffer*, calling *callback* with *buffer* after each piece
+    (its length set to the bytes read). No other memory is allocated, so the body can be much larger than the available RAM. Returns the size of the body. ::
+
+        r = requests.get(url,stream=True)
+        buf = bytearray(1024)
+        f = fatfs.open("/zt/log.txt","w")
+        r.iter_content(buf,f.write)
+
+        """
+        size = len(buffer)
+        total = 0
+        while True:
+            __elements_set(buffer,size)
+            n = self.read_into(buffer)
+            if not n:
+                break
+            __elements_set(buffer,n)
+            callback(buffer)
+            total+=n
+        return total
+
+    def close(self):
+        """
+.. method:: close()
+
+    Discards the unread body of a streamed response, closing its connection.
+        """
+        if self._mode!=_BODY_DONE:
+            self._finish(False)
+
+    def _read_all(self,stream_callback,stream_chunk):
+        if self._mode==_BODY_LENGTH and stream_callback is None:
+            self.content = bytearray(self._left)
+            __elements_set(self.content,self.read_into(self.content))
+            return
+        if stream_callback is None:
+            # the chunk is only a staging buffer for content
+            stream_chunk = BUFFER_LEN
+            chunk = bufpool.acquire(stream_chunk)
+        else:
+            chunk = bytearray(stream_chunk)
+        while True:
+            __elements_set(chunk,stream_chunk)
+            n = self.read_into(chunk)
+            if not n:
+                break
+            __elements_set(chunk,n)
+            if stream_callback is not None:
+                stream_callback(chunk)
+                self.content = chunk
+            else:
+                self.content.extend(chunk)
+        if stream_callback is None:
+            bufpool.release(chunk)
     def text(self):
         """
 .. method:: text()
@@ -551,3 +621,218 @@ class Response():
     
     def json(self):
         return json_encoder.loads(self.content)
+
+
+class Session():
+    """
+.. class:: Session(idle_timeout=30000,max_connections=2)
+
+    This class keeps a pool of connections to the HTTP servers it talks to, reusing them across requests instead of opening a new one each time:
+    for HTTPS the TLS handshake, by far the slowest part of a request, is done only once per connection.
+
+    Requests are sent with a "Connection: keep-alive" header (unless *headers* says otherwise) and, when the server agrees and the end of the response body is known
+    (from "Content-Length" or chunked encoding), the connection goes back to the pool of its scheme, host and port.
+    At most *max_connections* idle connections are kept for each of them, and connections idle for more than *idle_timeout* milliseconds are closed instead of being reused.
+
+    If a pooled connection turns out to be closed by the server, the request is sent again on a new connection.
+    The *ctx* of a request is used only when a new connection is opened.
+
+    A session must not be used by many threads at once. ::
+
+        s = requests.Session()
+        while True:
+            r = s.get("https://example.com/status")
+            print(r.status)
+            sleep(5000)
+
+    """
+    def __init__(self,idle_timeout=30000,max_connections=2):
+        self.idle_timeout = idle_timeout
+        self.max_connections = max_connections
+        self._pool = {}
+
+    def _acquire(self,key):
+        if key in self._pool:
+            conns = self._pool[key]
+            now = timers.now()
+            while conns:
+                sock,last = conns.pop()
+                if now-last<self.idle_timeout:
+                    return sock
+                sock.close()
+        return None
+
+    def _release(self,key,sock):
+        if key not in self._pool:
+            self._pool[key] = []
+        conns = self._pool[key]
+        if len(conns)<self.max_connections:
+            conns.append((sock,timers.now()))
+        else:
+            sock.close()
+
+    def request(self,verb,url,params=None,data=None,json=None,headers=None,ctx=None,stream_callback=None,stream_chunk=512,stream=False):
+        """
+.. method:: request(verb,url,params=None,data=None,json=None,headers=None,ctx=None,stream_callback=None,stream_chunk=512,stream=False)
+
+    Implements the HTTP method *verb* (e.g. "GET") reusing a pooled connection when possible. The other parameters have the same meaning as in :func:`get` and :func:`post`.
+
+    Returns a :class:`Response` instance. Its *connection* is always None, since a reusable connection is given back to the pool
+    (for a streamed response, when its body has been read).
+        """
+        urlp = urlparse.parse(url)
+        netl = urlparse.parse_netloc(urlp[1])
+        key = urlp[0]+"://"+netl[2]+":"+netl[3]
+        pdata = get_pdata(data,json)
+        rr = None
+        sock = self._acquire(key)
+        if sock is not None:
+            # the server may have closed the idle connection: in that case retry on a new one
+            try:
+                rr = _verb(url,pdata,params,headers,sock,verb,ctx,stream_callback,stream_chunk,None,True,stream)
+            except HTTPConnectionError:
+                pass
+            except ConnectionError:
+                pass
+            except IOError:
+                sock.close()
+        if rr is None:
+            rr = _verb(url,pdata,params,headers,None,verb,ctx,stream_callback,stream_chunk,None,True,stream)
+        if rr._mode!=_BODY_DONE:
+            rr._pool = (self,key)
+        elif rr.connection is not None:
+            self._release(key,rr.connection)
+            rr.connection = None
+        return rr
+
+    def pipeline(self,reqs,depth=4,ctx=None):
+        """
+.. method:: pipeline(reqs,depth=4,ctx=None)
+
+    Sends the requests in the list *reqs* on one keep-alive connection, without waiting for each response before sending the next one:
+    up to *depth* requests are in flight at once, so that the latency of many small requests (e.g. telemetry uploads) overlaps instead of adding up.
+
+    Each request is a tuple ``(verb,url)``, ``(verb,url,data)``, ``(verb,url,data,json)`` or ``(verb,url,data,json,headers)``, with the same meaning as
+    the parameters of :meth:`request`. All the urls must have the same scheme, host and port, otherwise ``ValueError`` is raised.
+
+    Returns the list of the :class:`Response` instances, in the same order as *reqs*.
+
+    If the server closes the connection before answering all the requests (for example when it limits the requests per connection),
+    the requests not answered yet are sent again on a new connection: pipeline only requests that can be safely repeated.
+        """
+        key = None
+        parsed = []
+        for r in reqs:
+            urlp = urlparse.parse(r[1])
+            netl = urlparse.parse_netloc(urlp[1])
+            k = urlp[0]+"://"+netl[2]+":"+netl[3]
+            if key is None:
+                key = k
+            elif k!=key:
+                raise ValueError
+            data = None
+            json = None
+            headers = None
+            if len(r)>2:
+                data = r[2]
+            if len(r)>3:
+                json = r[3]
+            if len(r)>4:
+                headers = r[4]
+            parsed.append((r[0],urlp,netl,get_pdata(data,json),headers))
+
+        res = []
+        sock = self._acquire(key)
+        while len(res)<len(parsed):
+            # a pooled connection may have been closed by the server: only a new one that answers nothing is an error
+            fresh = sock is None
+            if fresh:
+                p = parsed[len(res)]
+                sock = _connect(p[2][2],p[2][3],p[1][0],ctx)
+            answered = len(res)
+            sent = answered
+            alive = False
+            try:
+                while len(res)<len(parsed):
+                    while sent<len(parsed) and sent-len(res)<depth:
+                        p = parsed[sent]
+                        _send(sock,p[1],p[2],p[3],None,p[4],p[0],None,True)
+                        sent+=1
+                    rr = _response(sock,parsed[len(res)][0],True,False,None,512)
+                    res.append(rr)
+                    alive = rr.connection is not None
+                    rr.connection = None
+                    if not alive:
+                        break
+            except HTTPConnectionError as e:
+                if fresh and len(res)==answered:
+                    raise e
+            except ConnectionError as e:
+                if fresh and len(res)==answered:
+                    raise e
+            except Exception as e:
+                sock.close()
+                raise e
+            if alive and len(res)==len(parsed):
+                self._release(key,sock)
+            sock = None
+        return res
+
+    def get(self,url,params=None,headers=None,ctx=None,stream_callback=None,stream_chunk=512,stream=False):
+        """
+.. method:: get(url,params=None,headers=None,ctx=None,stream_callback=None,stream_chunk=512,stream=False)
+
+    Same as :func:`get`, on a pooled connection.
+        """
+        return self.request("GET",url,params,None,None,headers,ctx,stream_callback,stream_chunk,stream)
+
+    def post(self,url,data=None,json=None,headers=None,ctx=None):
+        """
+.. method:: post(url,data=None,json=None,headers=None,ctx=None)
+
+    Same as :func:`post`, on a pooled connection.
+        """
+        return self.request("POST",url,None,data,json,headers,ctx)
+
+    def put(self,url,data=None,json=None,headers=None,ctx=None):
+        """
+.. method:: put(url,data=None,json=None,headers=None,ctx=None)
+
+    Same as :func:`put`, on a pooled connection.
+        """
+        return self.request("PUT",url,None,data,json,headers,ctx)
+
+    def patch(self,url,data=None,json=None,headers=None,ctx=None):
+        """
+.. method:: patch(url,data=None,json=None,headers=None,ctx=None)
+
+    Same as :func:`patch`, on a pooled connection.
+        """
+        return self.request("PATCH",url,None,data,json,headers,ctx)
+
+    def delete(self,url,headers=None,ctx=None):
+        """
+.. method:: delete(url,headers=None,ctx=None)
+
+    Same as :func:`delete`, on a pooled connection.
+        """
+        return self.request("DELETE",url,None,None,None,headers,ctx)
+
+    def head(self,url,headers=None,ctx=None):
+        """
+.. method:: head(url,headers=None,ctx=None)
+
+    Same as :func:`head`, on a pooled connection.
+        """
+        return self.request("HEAD",url,None,None,None,headers,ctx)
+
+    def close(self):
+        """
+.. method:: close()
+
+    Closes all the pooled connections.
+        """
+        for key in self._pool:
+            for sock,last in self._pool[key]:
+                sock.close()
+        self._pool = {}
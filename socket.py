@@ -12,7 +12,10 @@ The following constants are defined:
 
     * For socket families: AF_INET, AF_INET6, AF_CAN
     * For socket types: SOCK_STREAM, SOCK_DGRAM, SOCK_RAW 
-    * For socket options: SOL_SOCKET, SO_RCVTIMEO, SO_REUSEADDR
+    * For socket options: SOL_SOCKET, SO_RCVTIMEO, SO_REUSEADDR, SO_KEEPALIVE
+    * For TCP options (level IPPROTO_TCP): TCP_NODELAY, TCP_KEEPIDLE, TCP_KEEPINTVL, TCP_KEEPCNT
+    * For recv flags: MSG_PEEK, MSG_DONTWAIT
+    * For :class:`Poller` events: POLLIN, POLLOUT, POLLERR
 
 IPv4 addresses can be passed to functions and methods in the following forms:
 
@@ -25,6 +28,8 @@ if a port is required but not given, it is set to zero.
 
     """
 
+import bufpool
+import timers
 
 AF_INET = 0
 AF_INET6 = 1
@@ -40,13 +45,29 @@ SO_RCVTIMEO = 1
 SO_REUSEADDR= 4
 SO_KEEPALIVE = 8
 
+TCP_NODELAY=0x01
 TCP_KEEPIDLE=0x03
 TCP_KEEPINTVL=0x04
-TCP_KEEPCNT=0x05 
+TCP_KEEPCNT=0x05
 
 IPPROTO_TCP=6
 IPPROTO_UDP=17
 
+MSG_PEEK = 0x01
+MSG_DONTWAIT = 0x08
+
+RX_BUFFER_LEN = 512
+MQTT_PACKET_TIMEOUTS = 4
+
+POLLIN = 1
+POLLOUT = 4
+POLLERR = 8
+
+new_exception(WouldBlockError,IOError)
+
+# called before connecting and sending by network interfaces that put the radio to sleep (see wifi.set_power_save)
+_wakeup = None
+
 
 # def _address_to_address(address):
 #     if type(address)==PSTRING:
@@ -69,6 +90,53 @@ def ip_to_tuple(ip):
     ipt = ip.split(".")
     return (int(ipt[0]),int(ipt[1]),int(ipt[2]),int(ipt[3]))
 
+def dns_prewarm(hosts):
+    """
+.. function:: dns_prewarm(hosts)
+
+        Resolve each host name in the list *hosts* with the default net driver, so that later connections to them do not wait for the DNS.
+        Names that can't be resolved are skipped.
+
+        Returns the number of names resolved.
+
+        Drivers based on the Zerynth Sockets keep the last resolved names in a small cache: *dns_prewarm* fills it ahead of time, for example right after linking to the network.
+    """
+    n = 0
+    for host in hosts:
+        try:
+            __default_net["sock"][AF_INET].gethostbyname(host)
+            n+=1
+        except Exception:
+            pass
+    return n
+
+def dns_flush():
+    """
+.. function:: dns_flush()
+
+        Forget all the cached host names. It should be called when the network changes (e.g. after linking to a different access point).
+        Net drivers not based on the Zerynth Sockets have no such cache and nothing is done.
+    """
+    if _native_net():
+        _dns_flush()
+
+def dns_config(ttl=300000,negative_ttl=10000):
+    """
+.. function:: dns_config(ttl=300000,negative_ttl=10000)
+
+        Set for how many milliseconds resolved host names (*ttl*) and names that failed to resolve (*negative_ttl*) are kept in the cache.
+        A value of 0 disables caching of the corresponding names. The cache is flushed.
+
+        Raises ``UnsupportedError`` if the default net driver is not based on the Zerynth Sockets.
+    """
+    if not _native_net():
+        raise UnsupportedError
+    _dns_config(ttl,negative_ttl)
+
+def _native_net():
+    # the default net driver is based on the Zerynth Sockets (see socket.__init__)
+    return hasattr(__default_net["sock"][AF_INET],"zsockets")
+
 #TODO: implement for INET6 and CAN
 
 class socket():
@@ -112,7 +180,13 @@ The socket class
     def __init__(self,family=AF_INET, type=SOCK_STREAM, proto=IPPROTO_TCP, fileno=None):
         self.family = family
         self.netdrv = __default_net["sock"][family]
+        # the natives of this module handle the sockets of net drivers built on Zerynth Sockets only
+        self._native = hasattr(self.netdrv,"zsockets")
+        # times of the last receive and send, tracked natively by the Zerynth Sockets
+        self._last = None if self._native else [timers.now(),timers.now()]
         self.timeout=None
+        self._rcvtimeo=None
+        self._rx = None
         if fileno is None:
             if type==SOCK_STREAM:
                 self.type = SOCK_STREAM
@@ -143,7 +217,10 @@ The socket class
         
         """
         #address = _address_to_address(address)
-        self.netdrv.connect(self.channel,address)
+        if _wakeup is not None:
+            _wakeup()
+        if self.netdrv.connect(self.channel,address)==-1:
+            raise WouldBlockError
 
     def close(self):
         """
@@ -152,6 +229,7 @@ The socket class
         Closes the underlying socket. No more input/output operations are possible.
         """        
         self.netdrv.close(self.channel)
+        self._rx = None
 
 
     def recv(self,bufsize,flags=0):
@@ -160,10 +238,10 @@ The socket class
 
         Reads at most *bufsize* bytes from the underlying socket. It blocks until *bufsize* bytes are received or an error occurs.
 
-        Returns a bytearray containing the received bytes.
+        Returns a bytearray containing the received bytes. The bytearray is taken from :mod:`bufpool`, and can be given back with :func:`bufpool.release` when done.
         """
-        buf = bytearray(bufsize)
-        rd = self.netdrv.recv_into(self.channel,buf,bufsize,flags)
+        buf = bufpool.acquire(bufsize)
+        rd = self.recv_into(buf,bufsize,flags)
         __elements_set(buf,rd)
         return buf
 
@@ -173,13 +251,226 @@ The socket class
 
         Reads at most *bufsize* bytes from the underlying socket into *buffer*. It blocks until *bufsize* bytes are received or an error occurs.
 
-        Returns the number of received bytes.
+        *flags* can be:
+
+            * :samp:`MSG_PEEK`: the bytes are returned but not consumed. Not supported by tls sockets
+            * :samp:`MSG_DONTWAIT`: only the bytes already received are returned, without blocking
+
+        With either flag, or in non-blocking mode, the bytes received so far are returned as soon as they are available.
+
+        Returns the number of received bytes. Raises ``WouldBlockError`` if no bytes are available and the socket is in non-blocking mode or *flags* has :samp:`MSG_DONTWAIT`.
         """
         if bufsize<0:
             bufsize=len(buffer)
-        rd = self.netdrv.recv_into(self.channel,buffer,bufsize,flags,ofs)
-        return rd
+        rb = 0
+        if self._rx is not None:
+            # bytes buffered by peek, readline or read_until come first
+            if self._native:
+                return _rx_recv_into(self.channel,buffer,bufsize,flags,ofs,self._rx)
+            if self._rx:
+                rb = len(self._rx) if len(self._rx)<bufsize else bufsize
+                buffer[ofs:ofs+rb] = self._rx[0:rb]
+                if not (flags&MSG_PEEK):
+                    self._rx = self._rx[rb:]
+                if rb==bufsize or flags:
+                    return rb
+        rd = self.netdrv.recv_into(self.channel,buffer,bufsize-rb,flags,ofs+rb)
+        if rd==-1:
+            if rb:
+                return rb
+            raise WouldBlockError
+        if rd and self._last is not None:
+            self._last[0] = timers.now()
+        return rb+rd
+
+    def peek(self,size=1):
+        """
+.. method:: peek(size=1)
+
+        Returns a bytearray with at most *size* of the next bytes received by the underlying socket, without consuming them.
+        It blocks only if no bytes are already buffered. An empty bytearray means the connection has been closed.
+        """
+        if not self._native:
+            if self._rx is None:
+                self._rx = bytearray(0)
+            if not self._rx and size:
+                buf = bytearray(1)
+                __elements_set(buf,self._rx_until(None,buf,0))
+                self._rx = buf
+            return self._rx[0:size]
+        if self._rx is None:
+            self._rx = _rx_new(RX_BUFFER_LEN)
+        return _rx_peek(self.channel,self._rx,size)
+
+    def read_until(self,pattern,buffer=None,size=0,ofs=0):
+        """
+.. method:: read_until(pattern,buffer=None,size=0,ofs=0)
+
+        Reads bytes from the underlying socket until the byte sequence *pattern* is received.
+
+        Returns the bytes read as a bytearray with *pattern* included.
+
+        If *buffer* is given (as a bytearray), *buffer* is used to store the bytes up to *size* bytes, starting at offset *ofs*.
+
+        If *read_until* returns an empty bytearray the connection has been closed.
+
+        The first time this method, :meth:`.readline` or :meth:`.peek` is called, a receive buffer of :data:`RX_BUFFER_LEN` bytes is attached to the socket:
+        from then on the socket is read in large chunks and the search for *pattern* is done natively, while the bytes following *pattern* are kept
+        for the next reads (:meth:`.recv` and :meth:`.recv_into` included). Buffered bytes are not reported by :class:`Poller`.
+        With net drivers not based on the Zerynth Sockets, the socket is read one byte at a time instead.
+        """
+        if self._rx is None:
+            self._rx = _rx_new(RX_BUFFER_LEN) if self._native else bytearray(0)
+        if buffer is not None:
+            __elements_set(buffer,size)
+            if self._native:
+                n = _rx_read_until(self.channel,self._rx,pattern,buffer,ofs)
+            else:
+                n = self._rx_until(pattern,buffer,ofs)
+            __elements_set(buffer,n)
+            return buffer
+        line = bytearray(64)
+        pos = 0
+        plen = len(pattern)
+        while True:
+            if self._native:
+                pos = _rx_read_until(self.channel,self._rx,pattern,line,pos)
+            else:
+                pos = self._rx_until(pattern,line,pos)
+            if pos<len(line) or line[pos-plen:pos]==pattern:
+                __elements_set(line,pos)
+                return line
+            line.extend(bytearray(64))
+
+    def _rx_until(self,pattern,buffer,pos):
+        # read_until for net drivers not based on the Zerynth Sockets: bytes are taken one at a time, peeked ones first,
+        # until buffer is full, ends with pattern (a single byte if None) or the connection is closed
+        plen = len(pattern) if pattern is not None else 0
+        size = len(buffer)
+        while pos<size:
+            if self._rx:
+                buffer[pos] = self._rx[0]
+                self._rx = self._rx[1:]
+            else:
+                rd = self.netdrv.recv_into(self.channel,buffer,1,0,pos)
+                if rd==-1:
+                    raise TimeoutError
+                if not rd:
+                    break
+                self._last[0] = timers.now()
+            pos+=1
+            if pattern is None:
+                break
+            if pos>=plen and buffer[pos-1]==__byte_get(pattern,plen-1) and buffer[pos-plen:pos]==pattern:
+                break
+        return pos
+
+    def readline(self,sep="\n",buffer=None,size=0,ofs=0):
+        """
+.. method:: readline(sep="\\n",buffer=None,size=0,ofs=0)
+
+        Reads bytes from the underlying socket until *sep* is encountered. Same as :meth:`.read_until` with *sep* as pattern.
+        """
+        return self.read_until(sep,buffer,size,ofs)
+
+
+    def read_http_head(self,names,headers):
+        """
+.. method:: read_http_head(names,headers)
 
+        Reads the head of an HTTP/1.x response, from the status line to the empty line ending the headers, natively in one pass over the receive buffer
+        (attached as in :meth:`.read_until`). The body is left buffered for the next reads.
+
+        Only the headers whose name is in *names*, a tuple or list of lowercase strings, are stored in the dict *headers*, keyed by the lowercase name;
+        the others are skipped without creating objects. Values are stripped of surrounding whitespace and truncated to 128 bytes.
+
+        Returns the status code, or -1 if the connection is closed before the end of the head. Raises ``ValueError`` if the head is malformed.
+        """
+        if not self._native:
+            return self._http_head(names,headers)
+        if self._rx is None:
+            self._rx = _rx_new(RX_BUFFER_LEN)
+        return _rx_http_head(self.channel,self._rx,names,headers)
+
+    def _http_head(self,names,headers):
+        # read_http_head for net drivers not based on the Zerynth Sockets, a line at a time
+        status = -1
+        while True:
+            line = self.read_until("\n")
+            if not line or line[len(line)-1]!=10:
+                return -1
+            n = len(line)-1
+            if n and line[n-1]==13:
+                n-=1
+            if status<0:
+                if n<12 or not line.startswith("HTTP/1.") or line[8]!=32:
+                    raise ValueError
+                status = int(line[9:12])
+                continue
+            if not n:
+                return status
+            idx = line.find(":")
+            if idx<0 or idx>n:
+                raise ValueError
+            name = str(line[0:idx].lower())
+            if name in names:
+                headers[name] = str(line[idx+1:n].strip())[0:128]
+
+    def read_mqtt(self,buffer):
+        """
+.. method:: read_mqtt(buffer)
+
+        Reads one MQTT control packet natively through the receive buffer (attached as in :meth:`.read_until`):
+        the fixed header is decoded and the body of the packet is stored at the start of the bytearray *buffer*.
+        Bodies longer than *buffer* are consumed, keeping only the bytes that fit.
+
+        Waiting for the start of a packet raises ``TimeoutError`` as :meth:`.recv` does; once a packet has started, the rest of it is waited for
+        up to ``MQTT_PACKET_TIMEOUTS`` times the timeout of the socket. Past that ``IOError`` is raised: the stream is left in the middle of a packet and the connection must be closed.
+
+        Returns a tuple with the first byte of the packet and its remaining length; the first byte is -1 if the connection has been closed.
+        """
+        wait = MQTT_PACKET_TIMEOUTS*self.timeout if self.timeout else -1
+        if not self._native:
+            if self._rx is None:
+                self._rx = bytearray(0)
+            return self._mqtt_packet(buffer,wait)
+        if self._rx is None:
+            self._rx = _rx_new(RX_BUFFER_LEN)
+        return _rx_mqtt(self.channel,self._rx,buffer,wait)
+
+    def _mqtt_packet(self,buffer,wait):
+        # read_mqtt for net drivers not based on the Zerynth Sockets, a byte at a time
+        b = bytearray(1)
+        if not self._rx_until(None,b,0):
+            return (-1,0)
+        hdr = b[0]
+        start = timers.now()
+        n = 0
+        shift = 0
+        size = len(buffer)
+        pos = -1    # reading the remaining length
+        while pos<n:
+            try:
+                rd = self._rx_until(None,b,0)
+            except TimeoutError:
+                if wait>=0 and timers.now()-start>=wait:
+                    raise IOError
+                continue
+            if not rd:
+                return (-1,0)
+            if pos>=0:
+                if pos<size:
+                    buffer[pos] = b[0]
+                pos+=1
+                continue
+            n |= (b[0]&0x7f)<<shift
+            shift+=7
+            if b[0]&0x80:
+                if shift>=28:
+                    raise ValueError
+            else:
+                pos = 0
+        return (hdr,n)
 
     def recvfrom(self,bufsize,flags=0):
         """
@@ -188,9 +479,12 @@ The socket class
         Reads at most *bufsize* bytes from the underlying udp socket. It blocks until a datagram is received.
 
         Returns a tuple (*data*, *address*) where *data* is a bytearray containing the received bytes and *address* is the net address of the sender.
+        *data* is taken from :mod:`bufpool`, as in :meth:`recv`.
         """
-        buf = bytearray(bufsize)
+        buf = bufpool.acquire(bufsize)
         rd,address = self.netdrv.recvfrom_into(self.channel,buf,bufsize,flags)
+        if self._last is not None:
+            self._last[0] = timers.now()
         __elements_set(buf,rd)
         return (buf,address)
 
@@ -205,8 +499,59 @@ The socket class
         if bufsize<0:
             bufsize=len(buffer)
         rd,address = self.netdrv.recvfrom_into(self.channel,buffer,bufsize,flags)
+        if self._last is not None:
+            self._last[0] = timers.now()
         return (rd,address)
 
+    def recvfrom_many(self,buffer,slot_size,max_count=0,timeout=None,meta=None):
+        """
+.. method:: recvfrom_many(buffer,slot_size,max_count=0,timeout=None,meta=None)
+
+        Receives many datagrams from the underlying udp socket with a single call, waiting at most *timeout* milliseconds for the first one
+        (as the other receive methods if None) and then taking only the datagrams already queued, up to *max_count* (as many as fit in *buffer* if 0).
+
+        The *i*-th datagram is stored in the bytearray *buffer* at offset ``i*slot_size`` and truncated to *slot_size* bytes.
+        Its length and sender are stored in the bytearray *meta* at offset ``i*8``: the length and the port as 16 bit little endian integers,
+        followed by the 4 bytes of the ip. If *meta* is None, a new bytearray is created. :func:`datagram_info` decodes them.
+
+        Returns a tuple (*count*, *meta*) where *count* is the number of datagrams received, 0 on timeout.
+        With net drivers not based on the Zerynth Sockets, at most one datagram is received per call.
+        """
+        if max_count<=0:
+            max_count = len(buffer)//slot_size
+        if meta is None:
+            meta = bytearray(8*max_count)
+        if not self._native:
+            return (self._recvfrom_one(buffer,slot_size,timeout,meta),meta)
+        return (_recvfrom_many(self.channel,buffer,slot_size,max_count,timeout,meta),meta)
+
+    def _recvfrom_one(self,buffer,slot_size,timeout,meta):
+        # recvfrom_many for net drivers not based on the Zerynth Sockets: they can't tell whether more datagrams are queued
+        prev = self.timeout
+        if timeout is not None:
+            self.settimeout(timeout if timeout>0 else 1)
+        try:
+            rd,address = self.recvfrom_into(buffer,slot_size)
+        except TimeoutError:
+            rd = -1
+        if timeout is not None:
+            self.settimeout(prev)
+        if rd<0:
+            return 0
+        if len(address)==2:
+            ip = ip_to_tuple(address[0])
+            port = address[1]
+        else:
+            ip = address
+            port = address[4]
+        meta[0] = rd&0xff
+        meta[1] = rd>>8
+        meta[2] = port&0xff
+        meta[3] = port>>8
+        for i in range(4):
+            meta[4+i] = ip[i]
+        return 1
+
 
     def send(self,buffer,flags=0):
         """
@@ -215,8 +560,16 @@ The socket class
         Send data to the socket. The socket must be connected to a remote socket. 
 
         Returns the number of bytes sent. Applications are responsible for checking that all data has been sent; if only some of the data was transmitted, the application needs to attempt delivery of the remaining data.
+        Raises ``WouldBlockError`` if the socket is in non-blocking mode and no data can be sent now.
         """
-        return self.netdrv.send(self.channel,buffer,flags)
+        if _wakeup is not None:
+            _wakeup()
+        snt = self.netdrv.send(self.channel,buffer,flags)
+        if snt==-1:
+            raise WouldBlockError
+        if self._last is not None:
+            self._last[1] = timers.now()
+        return snt
 
     def sendall(self,buffer,flags=0):
         """
@@ -227,7 +580,36 @@ The socket class
         Unlike send(), this method continues to send data from bytes until either all data has been sent or an error occurs. 
         *None* is returned on success. On error, an exception is raised, and there is no way to determine how much data, if any, was successfully sent.
         """
+        if _wakeup is not None:
+            _wakeup()
         self.netdrv.sendall(self.channel,buffer,flags)
+        if self._last is not None:
+            self._last[1] = timers.now()
+
+    def sendmsg(self,buffers):
+        """
+.. method:: sendmsg(buffers)
+
+        Send all the data in *buffers*, a list or tuple of strings, bytes or bytearrays, in order. The socket must be connected to a remote socket.
+
+        Equivalent to calling :meth:`.sendall` on each buffer, but with net drivers based on the Zerynth Sockets the whole list is sent by a single native call
+        and small consecutive buffers are written to the network together: sending a message made of many small pieces (e.g. protocol headers) is much faster.
+        Returns the number of bytes sent. On error an exception is raised.
+        """
+        if _wakeup is not None:
+            _wakeup()
+        if self._native:
+            return _sendmsg(self.channel,buffers)
+        n = 0
+        for buf in buffers:
+            self.netdrv.sendall(self.channel,buf,0)
+            n+=len(buf)
+        self._last[1] = timers.now()
+        return n
+
+    def _as_sink(self):
+        # used by adc.Stream.pipe: sendall from a native thread
+        return _sink(self.channel)
 
     def sendto(self,buffer,address,flags=0):
         """
@@ -237,7 +619,12 @@ The socket class
         Return the number of bytes sent
         """
         #address = _address_to_address(address)
-        return self.netdrv.sendto(self.channel,buffer,address,flags)
+        if _wakeup is not None:
+            _wakeup()
+        snt = self.netdrv.sendto(self.channel,buffer,address,flags)
+        if self._last is not None:
+            self._last[1] = timers.now()
+        return snt
 
     def settimeout(self,timeout):
         """
@@ -245,15 +632,103 @@ The socket class
         
         Set a timeout on blocking socket operations. The *timeout* argument can be a nonnegative integer number expressing milliseconds, or *None*. 
         If a non-zero value is given, subsequent socket operations will raise a timeout exception if the timeout period value has elapsed before the operation has completed. 
-        If zero is given, the socket is put in non-blocking mode. 
+        If zero is given, the socket is put in non-blocking mode (see :meth:`.setblocking`).
         If None is given, the socket is put in blocking mode.        
         """
+        if timeout==0:
+            self.setblocking(False)
+            return
+        if self.timeout==0 and self._native:
+            _setblocking(self.channel,1)
         self.netdrv.setsockopt(self.channel,SOL_SOCKET,SO_RCVTIMEO,timeout)
         self.timeout = timeout
+        self._rcvtimeo = timeout
+
+    def setblocking(self,flag):
+        """
+.. method:: setblocking(flag)
+
+        Set the socket in blocking mode if *flag* is True, in non-blocking mode otherwise.
+        Going back to blocking mode restores the timeout last set with :meth:`.settimeout`, if any.
+
+        In non-blocking mode operations never wait: :meth:`.recv`, :meth:`.recv_into` and :meth:`.send` raise ``WouldBlockError`` (a subclass of ``IOError``)
+        when they can't proceed, while :meth:`.peek`, :meth:`.readline` and :meth:`.read_until` raise ``TimeoutError``.
+        :meth:`.connect` raises ``WouldBlockError`` while the connection is in progress: a :class:`Poller` reports the socket as :data:`POLLOUT` when it is complete
+        and :meth:`.geterror` tells if it succeeded. Tls sockets do the handshake inside :meth:`.connect`, always blocking.
+
+        With many sockets in non-blocking mode and a single :class:`Poller`, one thread can serve many connections.
+        Raises ``UnsupportedError`` if the net driver does not support non-blocking sockets, as the drivers not based on the Zerynth Sockets.
+        """
+        if flag:
+            if self._native:
+                _setblocking(self.channel,1)
+            # O_NONBLOCK does not touch SO_RCVTIMEO: the timeout of settimeout is in force again
+            self.timeout = self._rcvtimeo
+        else:
+            if not self._native:
+                raise UnsupportedError
+            _setblocking(self.channel,0)
+            self.timeout = 0
+
+    def geterror(self):
+        """
+.. method:: geterror()
+
+        Returns and clears the pending error code of the socket, 0 if there is none. After a non-blocking :meth:`.connect`, 0 means the connection has been established.
+        With net drivers not based on the Zerynth Sockets, connections are always established by :meth:`.connect` and 0 is returned.
+        """
+        if not self._native:
+            return 0
+        return _sockerror(self.channel)
 
     def setsockopt(self,level,optname,value):
+        """
+.. method:: setsockopt(level,optname,value)
+
+        Sets the integer option *optname* of *level* to *value*. Options supported by the TCP/IP stack are:
+
+            * level ``SOL_SOCKET``: ``SO_RCVTIMEO`` (milliseconds, see :meth:`.settimeout`), ``SO_REUSEADDR``, ``SO_KEEPALIVE`` (0 or 1);
+            * level ``IPPROTO_TCP``: ``TCP_NODELAY`` (1 sends small segments at once instead of coalescing them while an ack is pending),
+              ``TCP_KEEPIDLE`` (seconds of idle time before the first keepalive probe), ``TCP_KEEPINTVL`` (seconds between probes),
+              ``TCP_KEEPCNT`` (unanswered probes before the connection is dropped).
+
+        TCP keepalive options need keepalive support in the TCP/IP stack of the net driver: if it is missing an exception is raised.
+        """
         return self.netdrv.setsockopt(self.channel,level,optname,value)
 
+    def keepalive(self,idle,interval=None,count=None):
+        """
+.. method:: keepalive(idle,interval=None,count=None)
+
+        Enables TCP keepalive: after *idle* seconds without traffic a probe is sent every *interval* seconds, and the connection is dropped
+        after *count* unanswered probes, making blocked reads fail. Unset values are left to the TCP/IP stack defaults (usually hours).
+        An *idle* of 0 disables keepalive.
+
+        Probes are answered by the peer TCP stack, so they detect dead peers and broken paths but not a stuck application: see :class:`Heartbeat`.
+        """
+        if not idle:
+            self.setsockopt(SOL_SOCKET,SO_KEEPALIVE,0)
+            return
+        self.setsockopt(SOL_SOCKET,SO_KEEPALIVE,1)
+        self.setsockopt(IPPROTO_TCP,TCP_KEEPIDLE,idle)
+        if interval is not None:
+            self.setsockopt(IPPROTO_TCP,TCP_KEEPINTVL,interval)
+        if count is not None:
+            self.setsockopt(IPPROTO_TCP,TCP_KEEPCNT,count)
+
+    def idle(self):
+        """
+.. method:: idle()
+
+        Returns a tuple with the milliseconds elapsed since data was last received and since data was last sent on the socket,
+        both counted from the creation of the socket until the first transfer. They are tracked natively at every receive and send
+        with net drivers based on the Zerynth Sockets, by the methods of the socket with the other drivers.
+        """
+        if self._last is not None:
+            now = timers.now()
+            return (now-self._last[0],now-self._last[1])
+        return _idle(self.channel)
+
     def bind(self,address):
         """
 .. method:: bind(address)
@@ -326,3 +801,316 @@ The socket class
         return (socket(type=SOCK_STREAM,fileno=sock),address)
 
 
+def sendfile(sock,source,offset=0,count=-1,chunk=1024):
+    """
+.. function:: sendfile(sock,source,offset=0,count=-1,chunk=1024)
+
+    Send *count* bytes of *source* (up to its end if negative) starting at *offset*, to the connected socket *sock*, and return the number of bytes sent.
+    *source* can be:
+
+        * a file opened with :func:`os.open`: it is read and sent in a single native call, with the GIL released, through TLS too for secure sockets.
+          A negative *offset* sends from the current position, and the file is left after the last byte sent
+        * a region of memory mapped flash, as a tuple *(address, size)* or a :class:`flash.FlashFileStream`: it is sent straight from flash in a single native call
+        * any other stream with a :samp:`readinto(buffer,size)` or :samp:`read(size)` method, read *chunk* bytes at a time (and moved to *offset* with :samp:`seek`, if positive)
+
+    Serving a file this way is much faster than reading it in Python and sending the pieces: throughput is close to the slower of the storage and the network.
+    With net drivers not based on the Zerynth Sockets every source is read in Python and sent *chunk* bytes at a time.
+    Raises ``OSError`` if *source* can't be read and ``IOError`` if the socket fails.
+
+    """
+    if _wakeup is not None:
+        _wakeup()
+    # the native paths write to the socket through the Zerynth Sockets: with other drivers the source is read in Python
+    if hasattr(source,"_send_into"):
+        if sock._native:
+            return source._send_into(_sink(sock.channel),offset,count)
+        if offset>=0:
+            source.seek(offset)
+            offset = 0
+    elif type(source)==PTUPLE or hasattr(source,"addr"):
+        if type(source)==PTUPLE:
+            addr = source[0]
+            size = source[1]
+        else:
+            addr = source.addr
+            size = source.size
+        if offset<0 or offset>size:
+            offset = size
+        if count<0 or count>size-offset:
+            count = size-offset
+        if sock._native:
+            return _sendmem(sock.channel,addr+offset,count)
+        total = 0
+        while total<count:
+            n = chunk if count-total>chunk else count-total
+            sock.sendall(__read_flash(addr+offset+total,n))
+            total+=n
+        return total
+    if offset>0:
+        source.seek(offset)
+    total = 0
+    if hasattr(source,"readinto"):
+        buf = bytearray(chunk)
+        while count<0 or total<count:
+            __elements_set(buf,chunk)
+            n = source.readinto(buf,chunk if count<0 or count-total>chunk else count-total)
+            if n<=0:
+                break
+            __elements_set(buf,n)
+            sock.sendall(buf)
+            total+=n
+        return total
+    while count<0 or total<count:
+        data = source.read(chunk if count<0 or count-total>chunk else count-total)
+        if not data:
+            break
+        sock.sendall(data)
+        total+=len(data)
+    return total
+
+
+def datagram_info(meta,i):
+    """
+.. function:: datagram_info(meta,i)
+
+    Returns a tuple (*length*, *address*) for the *i*-th datagram received by :meth:`socket.recvfrom_many`, where *meta* is its metadata bytearray
+    and *address* is a tuple (ip0,ip1,ip2,ip3,port), accepted by :meth:`socket.sendto`.
+    """
+    p = 8*i
+    return (meta[p]|(meta[p+1]<<8),(meta[p+4],meta[p+5],meta[p+6],meta[p+7],meta[p+2]|(meta[p+3]<<8)))
+
+
+# natives compiled with zsocket_pynative.c by the net drivers
+@native_c("py_net_recvfrom_many",[])
+def _recvfrom_many(sock,buffer,slot_size,max_count,timeout,meta):
+    pass
+
+@native_c("py_net_setblocking",[])
+def _setblocking(sock,blocking):
+    pass
+
+@native_c("py_net_sockerror",[])
+def _sockerror(sock):
+    pass
+
+@native_c("py_net_idle",[])
+def _idle(sock):
+    pass
+
+@native_c("py_net_sendmsg",[])
+def _sendmsg(sock,buffers):
+    pass
+
+@native_c("py_net_sink",[])
+def _sink(sock):
+    pass
+
+@native_c("py_net_sendmem",[])
+def _sendmem(sock,addr,size):
+    pass
+
+@native_c("py_net_dns_flush",[])
+def _dns_flush():
+    pass
+
+@native_c("py_net_dns_config",[])
+def _dns_config(ttl,negative_ttl):
+    pass
+
+@native_c("py_net_rx_new",[])
+def _rx_new(size):
+    pass
+
+@native_c("py_net_rx_peek",[])
+def _rx_peek(sock,state,size):
+    pass
+
+@native_c("py_net_rx_read_until",[])
+def _rx_read_until(sock,state,pattern,buffer,ofs):
+    pass
+
+@native_c("py_net_rx_recv_into",[])
+def _rx_recv_into(sock,buffer,size,flags,ofs,state):
+    pass
+
+@native_c("py_net_rx_http_head",[])
+def _rx_http_head(sock,state,names,headers):
+    pass
+
+@native_c("py_net_rx_mqtt",[])
+def _rx_mqtt(sock,state,buffer,wait):
+    pass
+
+@native_c("py_net_poller_new",[])
+def _poller_new():
+    pass
+
+@native_c("py_net_poller_ctl",[])
+def _poller_ctl(state,fd,events):
+    pass
+
+@native_c("py_net_poll",[])
+def _poll(state,timeout):
+    pass
+
+
+class Heartbeat():
+    """
+===================
+The Heartbeat class
+===================
+
+.. class:: Heartbeat(sock,interval=30000,timeout=10000,ping=None)
+
+        Application level heartbeat of the connected socket *sock*, plain or secure. It keeps long-lived connections and the NAT mappings
+        along their path warm, and detects a dead connection within *interval* plus *timeout* milliseconds, also when the peer TCP stack
+        answers keepalive probes but the application does not.
+
+        When nothing has been received on *sock* for *interval* milliseconds, *ping* is sent once: either bytes, or a function called with *sock*
+        sending the ping of the protocol in use (a MQTT PINGREQ, a WebSocket ping, ...). The peer must answer pings, or send data regularly:
+        the connection is considered dead when nothing has been received for *interval* plus *timeout* milliseconds.
+
+        Traffic is timed at every receive and send (see :meth:`socket.socket.idle`), natively with net drivers based on the Zerynth Sockets, so the heartbeat costs nothing on the data path.
+        It can be driven by the application loop with :meth:`.check` or by a thread of its own with :meth:`.start`::
+
+            # a line protocol whose server answers PING with PONG
+            hb = socket.Heartbeat(sock,20000,5000,ping="PING\\n")
+            hb.start()
+
+        When pings are sent from the heartbeat thread while other threads send on *sock*, *ping* must be a function serialized with them.
+    """
+    def __init__(self,sock,interval=30000,timeout=10000,ping=None):
+        self.sock = sock
+        self.interval = interval
+        self.timeout = timeout
+        self.ping = ping
+        self._pinged = False
+        self._running = False
+
+    def check(self):
+        """
+.. method:: check()
+
+        Sends the ping if due and returns False if the connection is dead, True otherwise.
+        """
+        rx = self.sock.idle()[0]
+        if rx<self.interval:
+            self._pinged = False
+            return True
+        if rx>=self.interval+self.timeout:
+            return False
+        if not self._pinged and self.ping is not None:
+            self._pinged = True
+            t = type(self.ping)
+            if t==PBYTES or t==PBYTEARRAY or t==PSTRING:
+                self.sock.sendall(self.ping)
+            else:
+                self.ping(self.sock)
+        return True
+
+    def start(self,period=1000,on_dead=None):
+        """
+.. method:: start(period=1000,on_dead=None)
+
+        Calls :meth:`.check` every *period* milliseconds from a new thread, until :meth:`.stop` is called or the connection is found dead.
+        Then *on_dead* is called with the socket, if given, else the socket is closed, so that blocked reads and writes fail at once.
+        """
+        self._running = True
+        thread(self._run,period,on_dead)
+
+    def stop(self):
+        """
+.. method:: stop()
+
+        Stops the thread started by :meth:`.start`.
+        """
+        self._running = False
+
+    def _run(self,period,on_dead):
+        while self._running:
+            sleep(period)
+            if not self._running:
+                break
+            try:
+                alive = self.check()
+            except Exception as e:
+                alive = False
+            if not alive:
+                self._running = False
+                if on_dead is not None:
+                    on_dead(self.sock)
+                else:
+                    self.sock.close()
+
+
+class Poller():
+    """
+================
+The Poller class
+================
+
+.. class:: Poller()
+
+        This class waits for events on many sockets at once. Unlike building the socket lists for a select at every iteration,
+        the set of watched sockets is kept by the poller between calls to :meth:`.poll` and only the ready sockets are returned.
+
+        Sockets can be watched like this::
+
+            poller = socket.Poller()
+            poller.register(server,socket.POLLIN)
+            while True:
+                for fd,events in poller.poll(1000):
+                    if fd==server.fileno():
+                        client,addr = server.accept()
+                        poller.register(client,socket.POLLIN)
+                    ...
+
+    """
+    def __init__(self):
+        self._state = _poller_new()
+
+    def register(self,sock,events=POLLIN):
+        """
+.. method:: register(sock,events=POLLIN)
+
+        Start watching *sock* (a socket or an integer returned by :meth:`socket.fileno`) for *events*, a combination of POLLIN, POLLOUT and POLLERR.
+        Registering an already watched socket replaces its events.
+
+        Raises ``UnsupportedError`` if *sock* does not come from a net driver based on the Zerynth Sockets (for an integer, if the default net driver is not).
+        """
+        if type(sock)!=PSMALLINT:
+            if not sock._native:
+                raise UnsupportedError
+            sock = sock.fileno()
+        elif not _native_net():
+            raise UnsupportedError
+        _poller_ctl(self._state,sock,events)
+
+    def modify(self,sock,events):
+        """
+.. method:: modify(sock,events)
+
+        Change the *events* watched for *sock*.
+        """
+        self.register(sock,events)
+
+    def unregister(self,sock):
+        """
+.. method:: unregister(sock)
+
+        Stop watching *sock*.
+        """
+        if type(sock)!=PSMALLINT:
+            sock = sock.fileno()
+        _poller_ctl(self._state,sock,0)
+
+    def poll(self,timeout=None):
+        """
+.. method:: poll(timeout=None)
+
+        Wait until at least one of the watched sockets is ready or *timeout* milliseconds are elapsed (forever if *timeout* is None).
+
+        Returns a tuple of (*fd*, *events*) pairs, one for each ready socket, where *events* tells which of the registered events happened.
+        On timeout the tuple is empty.
+        """
+        return _poll(self._state,timeout)
@@ -92,6 +92,13 @@ __define(_SPIDRIVER_WRITE,8)
 __define(_SPIDRIVER_EXCHANGE,9)
 __define(_SPIDRIVER_READ_INTO,10)
 __define(_SPIDRIVER_EXCHANGE_INTO,11)
+__define(_SPIDRIVER_TRANSACTION,12)
+
+# segments of Spi.transaction
+SKIP=7
+WRITE=8
+READ_INTO=10
+EXCHANGE_INTO=11
 
 SPI_MODE_LOW_FIRST=0
 SPI_MODE_LOW_SECOND=1
@@ -112,6 +119,32 @@ _vbl_spi_init();
 # global container for spi instances
 _ispi = {}
 
+# native queues of queue.Queue, feeding the asynchronous transactions to a thread per bus
+@native_c("_queue_new",["csrc/threading/*"])
+def _queue_new(maxsize):
+    pass
+
+@native_c("_queue_put",["csrc/threading/*"])
+def _queue_put(q,obj,timeout):
+    pass
+
+@native_c("_queue_get",["csrc/threading/*"])
+def _queue_get(q,timeout,remove):
+    pass
+
+_async = {}
+
+def _async_worker(q):
+    while True:
+        spi,segments,done,lock = _queue_get(q,-1,True)
+        try:
+            spi.transaction(segments,lock)
+            spi.error = None
+        except Exception as e:
+            spi.error = e
+        if done:
+            done()
+
 class Spi():
     """
 ================
@@ -165,6 +198,7 @@ The Spi class
         self.drv = __driver(drvname)
         self.drvid = drvname&0xff
         self.mode = mode
+        self.error = None
         if type(nss)==PSMALLINT:
             self.nss = nss
         else:
@@ -248,6 +282,80 @@ The Spi class
             raise ValueError
         return self.drv.__ctl__(_SPIDRIVER_EXCHANGE_INTO,self.drvid,wdata,rdata)
 
+    def transaction(self, segments, lock=True):
+        """
+.. method:: transaction(segments, lock=True)
+
+        Execute the sequence *segments* in a single call: the slave is selected, the segments are transferred one after the
+        other and the slave is unselected. If *lock* is True, the driver is locked for the whole transaction (do not set it if
+        :meth:`lock` was already called). Each segment is a tuple:
+
+            * ``(data, WRITE)``: write the bytes of *data*
+            * ``(n, SKIP)``: skip *n* frames
+            * ``(n, READ_INTO, buf)``: read *n* frames into the bytearray *buf*, as many as fit in *buf* if *n* is negative
+            * ``(data, EXCHANGE_INTO, buf)``: write *data* and read as many frames into *buf*
+
+        The list of segments can be built once and executed many times, a display refresh becomes: ::
+
+            refresh = [(cmd, spi.WRITE), (frame, spi.WRITE)]
+            while True:
+                draw(frame)
+                my_spi.transaction(refresh)
+
+        All segments are checked before starting: if one is not valid, nothing is transferred.
+
+        """
+        self._claim()
+        self.drv.__ctl__(_SPIDRIVER_TRANSACTION,self.drvid,self.nss,1 if lock else 0,segments)
+
+    def transaction_async(self, segments, done=None, lock=True):
+        """
+.. method:: transaction_async(segments, done=None, lock=True)
+
+        Queue the transaction *segments* (see :meth:`transaction`) and return immediately. The transactions of a bus are
+        executed in order by a thread of this module, that calls *done* without arguments at the end of each one.
+        Waiting on a :class:`threading.Event` only needs its ``set`` as *done*. If the transaction raised an exception,
+        it is stored in the :attr:`error` attribute before calling *done*, else :attr:`error` is set to None.
+
+        At most 2 transactions per bus wait in the queue, further calls block until one starts.
+        The buffers of *segments* must not be changed until *done* is called. The transfer runs without holding
+        the interpreter, so the next frame can be drawn meanwhile: ::
+
+            import threading
+
+            sent = threading.Event()
+            sent.set()
+            frame = 0
+            while True:
+                draw(frames[frame])
+                sent.wait()
+                sent.clear()
+                my_spi.transaction_async([(cmd, spi.WRITE), (frames[frame], spi.WRITE)], sent.set)
+                frame = 1-frame
+
+        """
+        if self.drvid not in _async:
+            _async[self.drvid] = _queue_new(2)
+            thread(_async_worker,_async[self.drvid])
+        _queue_put(_async[self.drvid],(self,segments,done,lock),-1)
+
+    def write_async(self, data, done=None):
+        """
+.. method:: write_async(data, done=None)
+
+        Select the slave, write *data* and unselect it without waiting: same as ``transaction_async([(data, WRITE)], done)``.
+
+        """
+        self.transaction_async([(data,WRITE)],done)
+
+    # configures the bus for this instance and unselects all the slaves, for natives driving nss themselves
+    def _claim(self):
+        if self != _ispi[self.drvid][1]:
+            self._stop()   # stops the spi bus
+            self._start()  # and reconfigures it with current parameters
+        for x in _ispi[self.drvid][0]:
+            digitalWrite(x.nss,HIGH);
+
     def _stop(self):
         _ispi[self.drvid][0].discard(self)
         _ispi[self.drvid][1]=None
@@ -263,11 +371,7 @@ The Spi class
         If necessary the spi bus is configured and started.
 
         """
-        if self != _ispi[self.drvid][1]:
-            self._stop()   # stops the spi bus
-            self._start()  # and reconfigures it with current parameters
-        for x in _ispi[self.drvid][0]:
-            digitalWrite(x.nss,HIGH);
+        self._claim()
         digitalWrite(self.nss,LOW);
 
     def unselect(self):
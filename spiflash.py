@@ -6,6 +6,9 @@ SpiFlash
 ********
 
 This modules handles operations on a generic Spi Flash Memory.
+Commands are executed by a native driver: data is read with the fast read command in a single transfer,
+written page by page and the busy state is polled without holding the VM lock, so that other threads keep running
+during long erase and program cycles.
 The following operations are allowed:
 
     * read/write data;
@@ -28,6 +31,23 @@ SERIAL_FLASH_CMD_EWSR  = 0x06
 SERIAL_FLASH_CMD_WRSR  = 0x01
 SERIAL_FLASH_CMD_SER   = 0xD8
 
+# milliseconds to wait for the end of page program, sector erase and chip erase
+_PAGE_TIMEOUT  = 100
+_SER_TIMEOUT   = 3000
+_ERASE_TIMEOUT = 400000
+
+@native_c("spiflash_read",["csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _read(drvid,addr,buffer,ofs,n):
+    pass
+
+@native_c("spiflash_write",["csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _write(drvid,addr,data,page_size,timeout):
+    pass
+
+@native_c("spiflash_erase",["csrc/spiflash/spiflash.c"],["VHAL_SPI"])
+def _erase(drvid,cmd,addr,timeout):
+    pass
+
 def _parse_addr(addr,n):
     if type(addr) == PBYTEARRAY:
         return addr
@@ -49,20 +69,22 @@ class SpiFlash(spi.Spi):
 SpiFlash class
 ==============
 
-.. class:: SpiFlash(drvname, cs, clock=1000000)
+.. class:: SpiFlash(drvname, cs, clock=1000000, page_size=256)
 
         Initialize an external Flash memory specifying its:
 
             * MCU SPI circuitry *drvname* (one of SPI0, SPI1, ... check pinmap for details);
             * chip select pin *cs*;
-            * clock *clock*, default at 1MHz.
+            * clock *clock*, default at 1MHz;
+            * program page size *page_size* in bytes, a power of two (256 for most chips).
 
     """
 
-    def __init__(self, drvname, cs, clock=1000000):
+    def __init__(self, drvname, cs, clock=1000000, page_size=256):
         spi.Spi.__init__(self, cs, drvname, clock=clock)
 
         self._cs = cs
+        self.page_size = page_size
 
         self._init_flash()
 
@@ -73,6 +95,11 @@ SpiFlash class
 
         self.write_enable()
 
+    def _bus(self):
+        # configure the bus for this instance, leaving the chip select to the native driver
+        self.select()
+        self.unselect()
+
     def _write_and_wait(self, pkt):
         self.select()
         self.write(pkt)
@@ -128,6 +155,7 @@ SpiFlash class
 
         Write data *data* starting from address *addr*.
         *data* can be a bytearray or a list of integers less than 256.
+        Data crossing a page boundary is split in multiple program commands.
 
         :meth:`erase_sector` MUST be called before writing data in a sector.
 
@@ -136,19 +164,12 @@ SpiFlash class
             my_flash[addr] = data
 
         """
-        self.write_enable()
-
-        pkt = bytearray()
-        pkt.append(SERIAL_FLASH_CMD_WRITE)
-        pkt.extend(_parse_addr(addr,3))
-        if type(data) in (PBYTES, PBYTEARRAY):
-            pkt.extend(data)
-        elif type(data) == PLIST:
-            for el in data:
-                pkt.append(el)
-        else:
-            pkt.append(data)
-        self._write_and_wait(pkt)
+        if type(data) == PLIST:
+            data = bytearray(data)
+        elif type(data) not in (PBYTES, PBYTEARRAY):
+            data = bytearray([data])
+        self._bus()
+        _write(self.drvid,_to_addr(_parse_addr(addr,3)),data,self.page_size,_PAGE_TIMEOUT)
 
     def erase_sector(self,addr):
         """
@@ -158,12 +179,8 @@ SpiFlash class
         All sector bytes set to 0xff.
 
         """
-        self.write_enable()
-
-        pkt = bytearray()
-        pkt.append(SERIAL_FLASH_CMD_SER)
-        pkt.extend(_parse_addr(addr,3))
-        self._write_and_wait(pkt)
+        self._bus()
+        _erase(self.drvid,SERIAL_FLASH_CMD_SER,_to_addr(_parse_addr(addr,3)),_SER_TIMEOUT)
 
     def read_data(self,addr,n=1):
         """
@@ -176,14 +193,25 @@ SpiFlash class
             my_data = my_flash[addr:addr+n]
 
         """
-        pkt = bytearray()
-        pkt.append(SERIAL_FLASH_CMD_READ)
-        pkt.extend(_parse_addr(addr,3))
-        pkt.extend(b'\xff'*n)
-        self.select()
-        res = self.exchange(pkt)
-        self.unselect()
-        return res[4:]
+        res = bytearray(n)
+        self._bus()
+        _read(self.drvid,_to_addr(_parse_addr(addr,3)),res,0,n)
+        return res
+
+    def read_into(self,addr,buffer,offset=0,n=-1):
+        """
+.. method:: read_into(addr, buffer, offset=0, n=-1)
+
+        Read *n* bytes of data starting from address *addr* into the bytearray *buffer*, starting at position *offset*.
+        If *n* is negative, the rest of *buffer* after *offset* is filled. Returns the number of bytes read.
+
+        Useful to stream large contents with a single buffer, creating no temporary objects.
+
+        """
+        if n<0:
+            n = len(buffer)-offset
+        self._bus()
+        return _read(self.drvid,_to_addr(_parse_addr(addr,3)),buffer,offset,n)
 
     def chip_erase(self):
         """
@@ -193,11 +221,8 @@ SpiFlash class
         All memory bytes set to 0xff.
 
         """
-        self.write_enable()
-
-        pkt = bytearray(1)
-        pkt[0] = SERIAL_FLASH_CMD_ERASE
-        self._write_and_wait(pkt)
+        self._bus()
+        _erase(self.drvid,SERIAL_FLASH_CMD_ERASE,-1,_ERASE_TIMEOUT)
 
     def chip_id(self,n):
         """
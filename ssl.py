@@ -314,6 +314,20 @@ The sslsocket class
             # send something on the socket!
             sock.sendall("Hello World!")
 
+        With *type* ``SOCK_DGRAM`` the socket uses DTLS 1.2 over UDP, client side only: :meth:`connect` performs the handshake,
+        retransmitting its lost messages, then :meth:`send` and :meth:`recv` exchange one datagram per record. DTLS is compiled in the TLS stack
+        by setting ``ZERYNTH_SSL_DTLS`` in ``project.yml``; without it, creating the socket raises :samp:`IOError`. ::
+
+            ctx = ssl.create_ssl_context(cacert=cacert,hostname="coap.example.com",options=ssl.CERT_REQUIRED|ssl.SERVER_AUTH|ssl.SESSION_RESUME,max_fragment_len=1024)
+            sock = ssl.sslsocket(type=socket.SOCK_DGRAM,ctx=ctx)
+            sock.connect((ip,5684))
+            sock.send(msg)
+
+        The connection ID extension (RFC 9146) is not supported by the bundled TLS stack: when a NAT rebinding changes the address of the client,
+        the server drops its records and the socket must be closed and connected again. With :samp:`ssl.SESSION_RESUME` the new handshake is abbreviated,
+        a single round trip without key exchange nor certificates. Records are not split to fit the path MTU: a **max_fragment_len** of 512 or 1024
+        keeps them within a datagram.
+
     """
 
     def __init__(self, family=socket.AF_INET, type=socket.SOCK_STREAM, proto=socket.IPPROTO_TCP, ctx=()):
@@ -326,13 +340,71 @@ CERT_OPTIONAL = 2
 CERT_REQUIRED = 4
 CLIENT_AUTH = 8
 SERVER_AUTH = 16
+SESSION_RESUME = 32
+CIPHERS_AUTO = 2048
+
+TLS_RSA_WITH_AES_128_CBC_SHA256 = 0x003C
+TLS_RSA_WITH_AES_128_GCM_SHA256 = 0x009C
+TLS_ECDHE_ECDSA_WITH_AES_128_CBC_SHA256 = 0xC023
+TLS_ECDHE_RSA_WITH_AES_128_CBC_SHA256 = 0xC027
+TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256 = 0xC02B
+TLS_ECDHE_ECDSA_WITH_AES_256_GCM_SHA384 = 0xC02C
+TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256 = 0xC02F
+TLS_ECDHE_RSA_WITH_AES_256_GCM_SHA384 = 0xC030
+TLS_ECDHE_ECDSA_WITH_AES_128_CCM = 0xC0AC
+TLS_ECDHE_ECDSA_WITH_AES_128_CCM_8 = 0xC0AE
+TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256 = 0xCCA8
+TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256 = 0xCCA9
+
+
+@native_c("py_ssl_pool_stats",[])
+def pool_stats():
+    """
+.. function:: pool_stats()
 
+    Returns the usage of the memory pool reserved to the TLS stack, available when the VM is compiled with ``ZERYNTH_SSL_STATIC_BUFFERS``:
+    a tuple with a (*size*, *blocks*, *used*, *high*, *fallbacks*) tuple for each size class of blocks, where *high* is the highest number of blocks used at once
+    and *fallbacks* is the number of requests served by the VM heap because the class was exhausted.
+    The last class holds the TLS record buffers: they are never taken from the heap, so its *fallbacks* count the refused requests, each of which fails a handshake.
 
-def create_ssl_context(cacert="",clicert="",pkey="",hostname="",options=17):
+    Returns an empty tuple if the pool is not available. It can be used to tune the ``ZERYNTH_SSL_POOL_CLASSn_SIZE`` and ``ZERYNTH_SSL_POOL_CLASSn_NUM`` options.
+    """
+    pass
+
+
+@native_c("py_ssl_ecdhe_stats",[])
+def ecdhe_stats():
+    """
+.. function:: ecdhe_stats()
+
+    Returns the usage of the ECDHE key pairs precomputed while the device is idle, available when the VM is compiled with ``ZERYNTH_SSL_ECDHE_POOL``:
+    a tuple (*ready*, *taken*, *misses*) with the P-256 key pairs ready now, the handshakes that used one and the handshakes that had to generate it because none was ready.
+
+    Returns an empty tuple if the precomputation is not available.
+    """
+    pass
+
+
+_mfl_codes = {512:1,1024:2,2048:3,4096:4}
+
+def _ctx_bytes(src):
+    if type(src)!=PINSTANCE:
+        return src
+    if hasattr(src,"_store"):
+        #x509.CertStore, already parsed: passed by id
+        return src._store
+    if hasattr(src,"addr"):
+        #resource or view in memory mapped flash: passed by address
+        return (src.addr,len(src))
+    #read from stream
+    sz = src.size()
+    return src.read(sz)
+
+def create_ssl_context(cacert="",clicert="",pkey="",hostname="",options=17,max_fragment_len=0,ciphersuites=None):
     """
 .. _stdlib.ssl.create_ssl_context
 
-.. function:: create_ssl_context(cacert="",clicert="",pkey="",hostname="",options=ssl.CERT_NONE|ssl.SERVER_AUTH)
+.. function:: create_ssl_context(cacert="",clicert="",pkey="",hostname="",options=ssl.CERT_NONE|ssl.SERVER_AUTH,max_fragment_len=0,ciphersuites=None)
 
     This function generates an SSL context with the following data:
 
@@ -354,26 +426,40 @@ def create_ssl_context(cacert="",clicert="",pkey="",hostname="",options=17):
             * :samp:`ssl.CERT_REQUIRED`: certificate verification is mandatory. If verification fails, :samp:`ConnectionAborted` is raised during TLS handshake.
             * :samp:`ssl.SERVER_AUTH`: indicates that the context may be used to authenticate servers therefore, it will be used to create client-side sockets (default).
             * :samp:`ssl.CLIENT_AUTH`: indicates that the context may be used to authenticate clients therefore, it will be used to create server-side sockets.
+            * :samp:`ssl.SESSION_RESUME`: client-side sockets keep the TLS session negotiated with the server (by **hostname**, or by address if not given) and offer it, or its session ticket, on the next connection.
+              If the server accepts, the abbreviated handshake skips the key exchange and the certificate verification, reconnecting in a fraction of the time of a full handshake.
+            * :samp:`ssl.CIPHERS_AUTO`: offer first the cipher suites that are cheapest on the device: AES-GCM suites if the hardware crypto interface registered an AES-GCM engine,
+              suites with 128 bit keys otherwise. Ignored if **ciphersuites** is given.
+
+        * **max_fragment_len** can be 512, 1024, 2048 or 4096 to ask the server, by the Maximum Fragment Length extension (RFC 6066), to send records of at most that size.
+          Since the TLS record buffers are allocated with the size given by ``ZERYNTH_SSL_MAX_CONTENT_LEN`` at compile time, this allows to lower it and save RAM on every TLS socket, as long as
+          the servers support the extension. If 0 (default) the extension is not sent.
+        * **ciphersuites** is a list of cipher suite ids (such as :samp:`ssl.TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256`) to offer, in order of preference. Suites not compiled in the TLS stack are skipped:
+          the ChaCha20-Poly1305 suites, for example, are only available with network drivers running their own TLS stack. If None (default) the order of the TLS stack is used.
 
     Returns a tuple to be passed as parameter during secure socket creation.
 
-.. note:: **cacert**, **clicert** and **pkey** can be bytes, bytearray, strings or instances of classes that have a **size** and **read** method, allowing to pass as parameters open files or resources.
+.. note:: **cacert**, **clicert** and **pkey** can be bytes, bytearray, strings or instances of classes that have a **size** and **read** method, allowing to pass as parameters open files.
+          Resources (:class:`streams.ResourceStream`) and their views (:class:`streams.FlashView`) are not read: the TLS stack parses them in place in flash, without loading them in RAM.
 
 .. note:: **cacert**, **clicert** and **pkey** must be in PEM format and null-terminated (they must end with a 0 byte).
 
+.. note:: **cacert** can also be a :class:`x509.CertStore`: its certificates, parsed once, are shared by all the sockets created with the context instead of being parsed at each connection.
+
     """
-    if type(cacert)==PINSTANCE:
-        #read CA certificate from stream
-        sz = cacert.size()
-        cacert = cacert.read(sz)
-    if type(clicert)==PINSTANCE:
-        #read client certificate from stream
-        sz = clicert.size()
-        clicert = clicert.read(sz)
-    if type(pkey)==PINSTANCE:
-        #read client pkey from stream
-        sz = pkey.size()
-        pkey = pkey.read(sz)
+    cacert = _ctx_bytes(cacert)
+    clicert = _ctx_bytes(clicert)
+    pkey = _ctx_bytes(pkey)
+    if max_fragment_len:
+        if max_fragment_len not in _mfl_codes:
+            raise ValueError
+        options = options | (_mfl_codes[max_fragment_len]<<8)
+    if ciphersuites:
+        suites = bytearray(2*len(ciphersuites))
+        for i,cs in enumerate(ciphersuites):
+            suites[2*i] = (cs>>8)&0xff
+            suites[2*i+1] = cs&0xff
+        return (cacert,clicert,pkey,hostname,options,suites)
 
     return (cacert,clicert,pkey,hostname,options)
 
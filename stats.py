@@ -0,0 +1,264 @@
+"""
+.. module:: stats
+
+*********************
+Streaming Statistics
+*********************
+
+This module implements natively accumulators of statistics over streams of samples, in constant memory: samples are
+added as they come and then forgotten, so there is no need to keep lists of samples to call :func:`sum`, :func:`max` or
+sort them later.
+
+    * :class:`Stats`: count, mean and variance (Welford algorithm), minimum, maximum and exponential moving average
+    * :class:`Histogram`: counts of the samples in equal buckets
+    * :class:`Percentile`: estimate of a percentile, such as the median or the 95th, with the P-square algorithm
+
+Samples are added one at a time with :meth:`update`, or all at once from a buffer with :meth:`update_from`: buffers are
+:class:`shortarray` of signed 16 bits samples or :class:`bytearray` read as 16 bits samples in native byte order, as in the :mod:`dsp`
+module, so the buffers filled by :func:`adc.read_into` and :meth:`adc.Stream.read_into` are consumed as they are, without
+creating a Python object per sample. ::
+
+    import adc
+    import stats
+
+    buf = shortarray(100)
+    st = stats.Stats()
+    p95 = stats.Percentile(0.95)
+    while True:
+        for i in range(600):
+            adc.read_into(A0,buf)
+            st.update_from(buf)
+            p95.update_from(buf)
+            sleep(100)
+        print(st.mean(), st.stddev(), st.min(), st.max(), p95.value())
+        st.reset()
+        p95.reset()
+
+    """
+
+import math
+
+_MOMENTS = 0
+_HISTOGRAM = 1
+_QUANTILE = 2
+
+@native_c("_stats_new",["csrc/stats/*"])
+def _stats_new(kind,a,b,buckets):
+    pass
+
+@native_c("_stats_update",["csrc/stats/*"])
+def _stats_update(st,x):
+    pass
+
+@native_c("_stats_update_from",["csrc/stats/*"])
+def _stats_update_from(st,buf,offset,step,samples):
+    pass
+
+@native_c("_stats_get",["csrc/stats/*"])
+def _stats_get(st,what):
+    pass
+
+@native_c("_stats_reset",["csrc/stats/*"])
+def _stats_reset(st):
+    pass
+
+
+class _Accumulator():
+    """
+==============
+Common methods
+==============
+
+The accumulators of this module share the following methods.
+
+    """
+
+    def update(self, x):
+        """
+.. method:: update(x)
+
+        Add the number *x*.
+
+        """
+        _stats_update(self._st,x)
+
+    def update_from(self, buf, offset=0, step=1, samples=-1):
+        """
+.. method:: update_from(buf, offset=0, step=1, samples=-1)
+
+        Add *samples* samples of *buf*, starting from index *offset* and taking one every *step*; all the samples left
+        if *samples* is negative. Return the number of samples added.
+
+        The samples of several pins captured together by :func:`adc.read_into` are interleaved: the samples of the
+        j-th of *npins* pins are added with ``update_from(buf, j, npins)``.
+
+        """
+        return _stats_update_from(self._st,buf,offset,step,samples)
+
+    def count(self):
+        """
+.. method:: count()
+
+        Return the number of samples added.
+
+        """
+        return _stats_get(self._st,0)
+
+    def reset(self):
+        """
+.. method:: reset()
+
+        Forget all the samples added.
+
+        """
+        _stats_reset(self._st)
+
+
+class Stats(_Accumulator):
+    """
+===========
+Stats class
+===========
+
+.. class:: Stats(alpha=0.1)
+
+    Create an accumulator of the mean, variance, minimum, maximum and exponential moving average of the samples.
+    The moving average starts from the first sample and moves towards each following sample by *alpha*
+    (between 0 and 1): the greater *alpha*, the faster it follows the signal.
+
+    Mean and variance are computed with the numerically stable Welford algorithm, in double precision; samples added
+    by :meth:`update_from` are summed in integers and merged to the others, without a division per sample.
+
+    The methods returning a statistic return None if no sample was added, except :meth:`variance` and :meth:`stddev`.
+
+    """
+    def __init__(self, alpha=0.1):
+        self._st = _stats_new(_MOMENTS,alpha,0,0)
+
+    def mean(self):
+        """
+.. method:: mean()
+
+        Return the mean of the samples.
+
+        """
+        return _stats_get(self._st,1)
+
+    def variance(self):
+        """
+.. method:: variance()
+
+        Return the sample variance (divided by the count less one), 0 with less than 2 samples.
+
+        """
+        return _stats_get(self._st,2)
+
+    def stddev(self):
+        """
+.. method:: stddev()
+
+        Return the sample standard deviation, the square root of :meth:`variance`.
+
+        """
+        return math.sqrt(_stats_get(self._st,2))
+
+    def min(self):
+        """
+.. method:: min()
+
+        Return the smallest sample.
+
+        """
+        return _stats_get(self._st,3)
+
+    def max(self):
+        """
+.. method:: max()
+
+        Return the greatest sample.
+
+        """
+        return _stats_get(self._st,4)
+
+    def ewma(self):
+        """
+.. method:: ewma()
+
+        Return the exponential moving average of the samples.
+
+        """
+        return _stats_get(self._st,5)
+
+
+class Histogram(_Accumulator):
+    """
+===============
+Histogram class
+===============
+
+.. class:: Histogram(lo, hi, buckets)
+
+    Create a histogram of *buckets* equal buckets (at most 4096) between *lo* and *hi*: the i-th bucket counts the samples
+    from ``lo+i*(hi-lo)/buckets`` included to ``lo+(i+1)*(hi-lo)/buckets`` excluded. Samples below *lo* are counted by
+    :meth:`underflow`, samples from *hi* up by :meth:`overflow`. Counts take 4 bytes per bucket.
+
+    """
+    def __init__(self, lo, hi, buckets):
+        self.lo = lo
+        self.hi = hi
+        self._st = _stats_new(_HISTOGRAM,lo,hi,buckets)
+
+    def counts(self):
+        """
+.. method:: counts()
+
+        Return a tuple with the count of each bucket.
+
+        """
+        return _stats_get(self._st,3)
+
+    def underflow(self):
+        """
+.. method:: underflow()
+
+        Return the number of samples below *lo*.
+
+        """
+        return _stats_get(self._st,1)
+
+    def overflow(self):
+        """
+.. method:: overflow()
+
+        Return the number of samples from *hi* up.
+
+        """
+        return _stats_get(self._st,2)
+
+
+class Percentile(_Accumulator):
+    """
+================
+Percentile class
+================
+
+.. class:: Percentile(p)
+
+    Create an estimator of the *p* quantile of the samples, with *p* between 0 and 1 excluded: 0.5 for the median,
+    0.95 for the 95th percentile. The P-square algorithm keeps 5 markers only, adjusted at each sample by parabolic
+    interpolation: the estimate gets close to the true percentile after a few hundred samples, for smooth distributions.
+
+    """
+    def __init__(self, p):
+        self.p = p
+        self._st = _stats_new(_QUANTILE,p,0,0)
+
+    def value(self):
+        """
+.. method:: value()
+
+        Return the estimate of the percentile, None if no sample was added. With less than 5 samples it is the
+        nearest sample by rank.
+
+        """
+        return _stats_get(self._st,1)
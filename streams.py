@@ -21,8 +21,11 @@ Every stream instance implements the following methods:
     * :class:`streams.SocketStream`
     * :class:`streams.FileStream`
     * :class:`streams.ResourceStream`
+    * :class:`streams.FlashView`, not a stream but a read-only view of a resource
+    * :class:`streams.BufferedStream`
 """
 
+import bufpool
 
 __builtins__.__default_stream_provider = __module__
 
@@ -73,8 +76,10 @@ The stream class
         *read* blocks if no bytes are available in the stream. 
 
         If *read* returns an empty bytearray the underlying stream can be considered disconnected.        
+
+        The bytearray is taken from :mod:`bufpool`, and can be given back with :func:`bufpool.release` when done.
         """ 
-        buf = bytearray(size)
+        buf = bufpool.acquire(size)
         n = self._readbuf(buf,size)
         if n<0:
             raise IOError
@@ -171,6 +176,7 @@ The serial class
         stream.__init__(self)
         self.channel = __driver(drvname)
         self.hidx = drvname&0xff
+        self.baud = baud
         try:
             # some boards throw erros on custom buffers...
             self.channel.__ctl__(DRV_CMD_INIT,self.hidx,baud,parity,stopbits,bitsize,rxsize,txsize)
@@ -181,6 +187,22 @@ The serial class
         if set_default:
             __builtins__.__default_stream = self
 
+    def read_frame(self,buffer,ofs=0,timeout=-1,gap=-1):
+        """
+.. method:: read_frame(buffer,ofs=0,timeout=-1,gap=-1)
+
+        Reads a whole burst of bytes (a modbus RTU frame, a block of GNSS sentences...) into the bytearray *buffer* starting at *ofs*:
+        waits at most *timeout* milliseconds (forever if negative) for the first byte, then reads without returning to Python until the
+        line stays idle for *gap* microseconds or *buffer* is full. If *gap* is negative it is the time of 3.5 characters at the
+        baud rate of the port (the modbus RTU frame gap), but at least 1000: the idle time is measured by the system timers,
+        whose resolution is usually a millisecond.
+
+        Returns the number of bytes read, 0 on timeout. Nothing is allocated. Use a :samp:`rxsize` large enough to hold a burst,
+        since the driver buffers the bytes received while Python processes the previous one.
+
+        """
+        return _serial_read_frame(self.hidx,None,buffer,ofs,timeout,_frame_gap(self.baud,gap))-ofs
+
     def available(self):
         """
 .. method:: available()        
@@ -257,13 +279,46 @@ The FileStream class
         This class implements a stream that has a file as a source of data.
         It inherits all of its methods from :class:`stream`.
 
-        It is just a stub at the moment. It is used by :class:`ResourceStream` only.
+        If *name* is a file opened with :func:`os.open`, the stream reads and writes it: bytes are read directly into the stream buffers
+        with :meth:`os.FileIO.readinto`, without intermediate copies. Otherwise it is just a stub, used by :class:`ResourceStream`.
 
     """
     def __init__(self,name,mode="rb"):
         stream.__init__(self)
         self.name = name
         self.curpos=0
+        self.file = None
+        if hasattr(name,"readinto"):
+            self.file = name
+            self.size = name.size()
+
+    def _readbuf(self,buf,size=1,ofs=0):
+        n = self.file.readinto(buf,size,ofs)
+        self.curpos+=n
+        return n
+
+    def write(self,buf):
+        n = self.file.write(buf)
+        self.curpos+=n
+        if self.curpos>self.size:
+            self.size = self.curpos
+        return n
+
+    def available(self):
+        return self.size-self.curpos
+
+    def readline(self,sep="\n",buffer=None,size=0,ofs=0):
+        """
+.. method:: readline(sep="\\\\n",buffer=None,size=0,ofs=0)
+
+        As :meth:`stream.readline`. Lines of a file opened with :func:`os.open`, ending with the default *sep* and without a *buffer*,
+        are read by the buffered :meth:`os.FileIO.readline`.
+        """
+        if self.file is None or sep!="\n" or buffer is not None:
+            return stream.readline(self,sep,buffer,size,ofs)
+        line = self.file._readline_bytearray()
+        self.curpos+=len(line)
+        return line
 
     def seek(self,offset,whence=SEEK_SET):
         """
@@ -288,6 +343,26 @@ The FileStream class
             self.curpos=0
         elif self.curpos>self.size:
             self.curpos=self.size
+        if self.file is not None:
+            self.file.seek(self.curpos)
+
+    def close(self):
+        """
+.. method:: close()
+
+        Close the file, if any.
+
+        """
+        if self.file is not None:
+            self.file.close()
+
+@native_c("_vbl_flash_readinto",["csrc/vbl/vbl_flash.c"],[])
+def _flash_readinto(addr,buf,ofs,size):
+    pass
+
+@native_c("_vbl_flash_byte",["csrc/vbl/vbl_flash.c"],[])
+def _flash_byte(addr):
+    pass
 
 class ResourceStream(FileStream):
     """
@@ -300,6 +375,9 @@ The ResourceStream class
         This class implements a stream that has a flash saved resource as a source of data.
         It inherits all of its methods from :class:`FileStream`.
 
+        Resources live in memory mapped flash: reads copy their bytes straight into the caller buffers,
+        and :meth:`view` gives access to them with no copies at all.
+
     """
     def __init__(self,name):
         FileStream.__init__(self,name)
@@ -311,19 +389,32 @@ The ResourceStream class
                 raise UnsupportedError
             return __read_flash(self.addr+key[0],key[1]-key[0])
         elif type(key)==PSMALLINT:
-            buf = __read_flash(self.addr+key,1)
-            return buf[0]
+            if key<0 or key>=self.size:
+                raise IndexError
+            return _flash_byte(self.addr+key)
         raise IndexError
 
     def _readbuf(self,buf,size=1,ofs=0):
         if self.curpos>=self.size: #eof
             return 0
         size = min(self.size-self.curpos,size)
-        bb = __read_flash(self.addr+self.curpos,size)
-        buf[ofs:ofs+size]=bb
+        _flash_readinto(self.addr+self.curpos,buf,ofs,size)
         self.curpos+=size
         return size
 
+    def view(self,start=0,end=None):
+        """
+.. method:: view(start=0,end=None)
+
+        Return a :class:`FlashView` of the bytes of the resource from *start* to *end* (the end of the resource if None).
+
+        """
+        if end is None or end>self.size:
+            end = self.size
+        if start<0 or start>end:
+            raise IndexError
+        return FlashView(self.addr+start,end-start)
+
     def __len__(self):
         return self.size
 
@@ -333,3 +424,217 @@ The ResourceStream class
     def write(self,buf):
         raise UnsupportedError
 
+
+class FlashView():
+    """
+=================
+The FlashView class
+=================
+
+.. class:: FlashView(addr,size)
+
+        A read-only view of *size* bytes of memory mapped flash starting at *addr*, usually obtained with :meth:`ResourceStream.view`.
+        No byte is copied to RAM: lookup tables and fonts are indexed in place, and :func:`ssl.create_ssl_context` passes
+        certificates and keys given as views to the TLS stack by address, so that even large CA bundles are never loaded in RAM::
+
+            cacert = streams.ResourceStream("cabundle.pem").view()
+            ctx = ssl.create_ssl_context(cacert=cacert,options=ssl.CERT_REQUIRED|ssl.SERVER_AUTH)
+
+        Indexing with an integer returns the byte at that position. Slicing and :meth:`readinto` copy bytes, and are meant for small pieces.
+
+    """
+    def __init__(self,addr,size):
+        self.addr = addr
+        self.size = size
+
+    def __len__(self):
+        return self.size
+
+    def __getitem__(self, key):
+        if type(key)==PSLICE:
+            if key[2]!=1:
+                raise UnsupportedError
+            start = max(0,key[0])
+            end = min(self.size,key[1])
+            if start>=end:
+                return bytes()
+            return __read_flash(self.addr+start,end-start)
+        elif type(key)==PSMALLINT:
+            if key<0:
+                key+=self.size
+            if key<0 or key>=self.size:
+                raise IndexError
+            return _flash_byte(self.addr+key)
+        raise IndexError
+
+    def readinto(self,buf,start=0,size=-1,ofs=0):
+        """
+.. method:: readinto(buf,start=0,size=-1,ofs=0)
+
+        Copy *size* bytes of the view (up to its end if negative) from position *start* into the bytearray *buf* from *ofs*. Return the number of bytes copied.
+
+        """
+        if start<0 or start>self.size:
+            raise IndexError
+        if size<0 or size>self.size-start:
+            size = self.size-start
+        return _flash_readinto(self.addr+start,buf,ofs,size)
+
+
+
+@native_c("_vbl_serial_buf_new",["csrc/vbl/vbl_serial.c"],[])
+def _serial_buf_new(size):
+    pass
+
+@native_c("_vbl_serial_read_until",["csrc/vbl/vbl_serial.c"],[])
+def _serial_read_until(ser,state,end,buffer,ofs,timeout):
+    pass
+
+@native_c("_vbl_serial_buffered",["csrc/vbl/vbl_serial.c"],[])
+def _serial_buffered(state):
+    pass
+
+@native_c("_vbl_serial_read_frame",["csrc/vbl/vbl_serial.c"],[])
+def _serial_read_frame(ser,state,buffer,ofs,timeout,gap):
+    pass
+
+def _frame_gap(baud,gap):
+    if gap>0:
+        return gap
+    # 3.5 characters of 10 bits
+    gap = 35000000//baud
+    return gap if gap>1000 else 1000
+
+
+class BufferedStream(stream):
+    """
+==========================
+The BufferedStream class
+==========================
+
+.. class:: BufferedStream(source,size=256,timeout=-1)
+
+        This class wraps the stream *source* adding a read-ahead buffer of *size* bytes, allocated once: reads with a caller given buffer
+        (:meth:`readinto`, :meth:`readline` and :meth:`read_until` with *buffer*) allocate nothing.
+
+        If *source* is a :class:`serial` stream, bytes are moved natively from the driver in blocks: whatever has already been received is taken at once,
+        and lines are waited for by the driver itself, so that fast serial links (e.g. NMEA or modbus at 921600 baud) can be read without losing bytes.
+        Reads wait at most *timeout* milliseconds for new bytes (forever if negative) and return what has been read so far when it expires.
+
+        If *source* is a socket or a :class:`SocketStream`, the native receive buffer of the socket (see :meth:`socket.socket.read_until`) is used.
+        Other streams are read through their own methods.
+
+    """
+    def __init__(self,source,size=256,timeout=-1):
+        stream.__init__(self)
+        self.source = source
+        self.timeout = timeout
+        self._state = None
+        self._sock = None
+        if isinstance(source,serial):
+            self._state = _serial_buf_new(size)
+            self._ser = source.hidx
+        elif isinstance(source,SocketStream):
+            self._sock = source.socket
+        elif hasattr(source,"read_until"):
+            self._sock = source
+
+    def _readbuf(self,buf,size=1,ofs=0):
+        if self._state is None:
+            if self._sock is not None:
+                return self._sock.recv_into(buf,size,0,ofs)
+            return self.source._readbuf(buf,size,ofs)
+        # read at most size bytes
+        blen = len(buf)
+        if ofs+size<blen:
+            __elements_set(buf,ofs+size)
+        n = _serial_read_until(self._ser,self._state,-1,buf,ofs,self.timeout)
+        __elements_set(buf,blen)
+        return n-ofs
+
+    def read_frame(self,buffer,ofs=0,gap=-1):
+        """
+.. method:: read_frame(buffer,ofs=0,gap=-1)
+
+        Same as :meth:`serial.read_frame` with the timeout of this stream, and the buffered bytes first. Only for :class:`serial` sources.
+
+        """
+        if self._state is None:
+            raise UnsupportedError
+        return _serial_read_frame(self._ser,self._state,buffer,ofs,self.timeout,_frame_gap(self.source.baud,gap))-ofs
+
+    def readinto(self,buffer,size=-1,ofs=0):
+        """
+.. method:: readinto(buffer,size=-1,ofs=0)
+
+        Reads at most *size* bytes (up to the end of *buffer* if negative) into the bytearray *buffer*, starting at *ofs*.
+        It blocks only if no bytes are buffered or already received. Returns the number of bytes read, 0 on timeout.
+
+        """
+        if size<0:
+            size = len(buffer)-ofs
+        return self._readbuf(buffer,size,ofs)
+
+    def read_until(self,sep,buffer=None,size=0,ofs=0):
+        """
+.. method:: read_until(sep,buffer=None,size=0,ofs=0)
+
+        Reads bytes until *sep* is read, returning them as a bytearray with *sep* included. On serial streams *sep* must be a single byte.
+
+        If *buffer* is given (as a bytearray), *buffer* is used to store the bytes up to *size* bytes, starting at offset *ofs*, and nothing is allocated.
+
+        The returned bytearray is shorter or doesn't end with *sep* if *buffer* is full, the timeout expires or the underlying connection is lost.
+
+        """
+        if self._state is None:
+            if self._sock is not None:
+                return self._sock.read_until(sep,buffer,size,ofs)
+            return self.source.readline(sep,buffer,size,ofs)
+        if len(sep)!=1:
+            raise ValueError
+        end = ord(sep)
+        if buffer is not None:
+            __elements_set(buffer,size)
+            n = _serial_read_until(self._ser,self._state,end,buffer,ofs,self.timeout)
+            __elements_set(buffer,n)
+            return buffer
+        line = bytearray(64)
+        pos = 0
+        while True:
+            pos = _serial_read_until(self._ser,self._state,end,line,pos,self.timeout)
+            if pos<len(line) or line[pos-1]==end:
+                __elements_set(line,pos)
+                return line
+            line.extend(bytearray(64))
+
+    def readline(self,sep="\n",buffer=None,size=0,ofs=0):
+        """
+.. method:: readline(sep="\\n",buffer=None,size=0,ofs=0)
+
+        Same as :meth:`read_until`, with *sep* defaulting to the end of line.
+
+        """
+        return self.read_until(sep,buffer,size,ofs)
+
+    def write(self,buf):
+        """
+.. method:: write(buffer)
+
+        Writes *buffer* to the underlying stream.
+
+        """
+        return self.source.write(buf)
+
+    def available(self):
+        """
+.. method:: available()
+
+        Returns the number of bytes that can be read without blocking, buffered ones included.
+
+        """
+        n = 0
+        if self._state is not None:
+            n = _serial_buffered(self._state)
+        if self._sock is not None:
+            return n
+        return n+self.source.available()
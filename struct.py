@@ -68,11 +68,70 @@ The module defines the following exception and functions:
    the size required by the format, as reflected by :func:`calcsize`.
 
 
+.. function:: iter_unpack(fmt, buffer)
+
+   Return an iterator over the records packed according to the format string
+   *fmt* in *buffer*, yielding a tuple for each record. The size of *buffer* must be
+   a multiple of the size required by the format, as reflected by :func:`calcsize`.
+   The format is parsed only once for the whole buffer.
+
+
+.. function:: unpack_array(fmt, buffer, count, offset=0)
+
+   Unpack *count* consecutive records packed according to the format string *fmt*
+   from *buffer* starting at position *offset*, and return a tuple with a column
+   for each item of the format. The column of an item contains its value in every
+   record, and it is a bytearray for ``B`` and ``c`` items, a shortarray for ``H`` items
+   and a list for the other items. All records are decoded in a single native call,
+   and ``B``, ``c`` and ``H`` columns are filled without creating an object per value::
+
+      >>> unpack_array('<BH', b'\x01\x02\x00\x03\x04\x00', 2)
+      (bytearray(b'\x01\x03'), shortarray([2, 4]))
+
+   The size of *buffer*, minus *offset*, must be at least *count* times the size
+   required by the format.
+
+
 .. function:: calcsize(fmt)
 
    Return the size of the struct (and hence of the bytes object produced by
    ``pack(fmt, ...)``) corresponding to the format string *fmt*.
 
+
+Classes
+-------
+
+.. class:: Struct(fmt)
+
+   Return a new Struct object which writes and reads binary data according to
+   the format string *fmt*.  The format string is parsed only once, when the
+   Struct is created: calling its methods is faster than calling the module
+   functions with the same format, which parse it at every call.
+
+   .. method:: pack(v1, v2, ...)
+
+      Identical to the :func:`pack` function, using the compiled format.
+
+   .. method:: pack_into(buffer, offset, v1, v2, ...)
+
+      Identical to the :func:`pack_into` function, using the compiled format.
+
+   .. method:: unpack(buffer)
+
+      Identical to the :func:`unpack` function, using the compiled format.
+
+   .. method:: unpack_from(buffer, offset=0)
+
+      Identical to the :func:`unpack_from` function, using the compiled format.
+
+   .. attribute:: format
+
+      The format string used to construct this Struct object.
+
+   .. attribute:: size
+
+      The calculated size of the struct, corresponding to :attr:`format`.
+
 .. _struct-format-strings:
 
 Format Strings
@@ -354,13 +413,21 @@ def __pack(fmt,buffer, offset, args):
     pass
 
 @native_c("__struct_unpack",["csrc/struct/*"])
-def __unpack(fmt,buffer, offset):
+def __unpack(fmt,buffer, offset, exact):
     pass
 
 @native_c("__struct_calcsize",["csrc/struct/*"])
 def __calcsize(fmt):
     pass
 
+@native_c("__struct_compile",["csrc/struct/*"])
+def __compile(fmt):
+    pass
+
+@native_c("__struct_unpack_array",["csrc/struct/*"])
+def __unpack_array(fmt,buffer,offset,count):
+    pass
+
 def pack(fmt, *args):
     r = __pack(fmt, None, 0, args)
     if r is None:
@@ -375,13 +442,23 @@ def pack_into(fmt, buffer, offset, *args):
     return r
 
 def unpack(fmt,buffer):
-    r = __unpack(fmt,buffer,0);
+    r = __unpack(fmt,buffer,0,True);
     if r is None:
         raise StructError
     return r
 
-def unpack_from(fmt,buffer,offset):
-    r = __unpack(fmt,buffer,offset);
+def unpack_from(fmt,buffer,offset=0):
+    r = __unpack(fmt,buffer,offset,False);
+    if r is None:
+        raise StructError
+    return r
+
+
+def iter_unpack(fmt,buffer):
+    return _Records(fmt,buffer)
+
+def unpack_array(fmt,buffer,count,offset=0):
+    r = __unpack_array(fmt,buffer,offset,count)
     if r is None:
         raise StructError
     return r
@@ -392,3 +469,60 @@ def calcsize(fmt):
     if r is None:
         raise StructError
     return r
+
+
+class Struct():
+    def __init__(self, fmt):
+        self._fmt = __compile(fmt)
+        if self._fmt is None:
+            raise StructError
+        self.format = fmt
+        self.size = __calcsize(self._fmt)
+
+    def pack(self, *args):
+        r = __pack(self._fmt, None, 0, args)
+        if r is None:
+            raise StructError
+        return r
+
+    def pack_into(self, buffer, offset, *args):
+        r = __pack(self._fmt, buffer, offset, args)
+        if r is None:
+            raise StructError
+        return r
+
+    def unpack(self, buffer):
+        r = __unpack(self._fmt,buffer,0,True)
+        if r is None:
+            raise StructError
+        return r
+
+    def unpack_from(self, buffer, offset=0):
+        r = __unpack(self._fmt,buffer,offset,False)
+        if r is None:
+            raise StructError
+        return r
+
+
+class _Records():
+    def __init__(self, fmt, buffer):
+        self._fmt = __compile(fmt)
+        if self._fmt is None:
+            raise StructError
+        self._size = __calcsize(self._fmt)
+        if self._size<=0 or len(buffer)%self._size:
+            raise StructError
+        self._buffer = buffer
+        self._offset = 0
+
+    def __iter__(self):
+        return self
+
+    def __next__(self):
+        if self._offset>=len(self._buffer):
+            raise StopIteration
+        r = __unpack(self._fmt,self._buffer,self._offset,False)
+        if r is None:
+            raise StructError
+        self._offset+=self._size
+        return r
@@ -0,0 +1,103 @@
+"""
+.. module:: template
+
+*********
+Templates
+*********
+
+This module renders format strings that are parsed only once. The ``%`` operator and ``str.format`` parse their format at every call:
+a :class:`Template` parses it when created and keeps the result in native form, so that rendering a log line or a protocol message
+just walks the parsed fields and writes each value directly into the result, or into an existing bytearray with :meth:`Template.render_into`.
+
+Both styles of format are supported:
+
+* ``PERCENT``: printf style, as the ``%`` operator: ``"%(name)s=%-8.3f %5d %x %%"``, with ``*`` widths and precisions;
+* ``BRACES``: as ``str.format``: ``"{}={:<8.3f} {0:>5d} {name:#x} {{}}"``, with fill, alignment, sign, ``#``, ``0``, width, precision and type.
+
+Named fields are looked up in a dictionary passed as the last argument. Strings and bytes are copied as they are, integers of any size,
+floats, booleans and None are formatted natively; any other object is converted with ``str()``. Floats without a type are written as ``str()`` does,
+with the shortest digits that read back to the same value; ``g`` and ``e`` round those digits to the requested precision. Thousands separators
+are not supported, and ``r`` and ``a`` conversions are rendered as ``s``.
+
+::
+
+    import template
+
+    line = template.Template("%s: %d samples, mean %.3f")
+    msg = line.render("adc0", 128, 3.14159)     # "adc0: 128 samples, mean 3.142"
+
+    buf = bytearray(64)
+    n = line.render_into(buf, "adc1", 64, 2.5)  # buf[:n] holds the line, no string allocated
+
+    """
+
+PERCENT = 0
+BRACES = 1
+
+@native_c("_tpl_compile",["csrc/template/template.c","csrc/misc/zfloat.c","csrc/misc/snprintf.c"])
+def _tpl_compile(fmt,style):
+    pass
+
+@native_c("_tpl_render",["csrc/template/template.c","csrc/misc/zfloat.c","csrc/misc/snprintf.c"])
+def _tpl_render(spec,names,args,dst,ofs):
+    pass
+
+# objects rendered natively: int, float, bool, str, bytes, bytearray, dict and None
+def _plain(args):
+    res = []
+    for a in args:
+        t = type(a)
+        if t<=PBYTEARRAY or t==PDICT or t==PNONE:
+            res.append(a)
+        else:
+            res.append(str(a))
+    return res
+
+class Template():
+    """
+==============
+Template class
+==============
+
+.. class:: Template(fmt, style=PERCENT)
+
+    Parses the format string *fmt*, in ``PERCENT`` or ``BRACES`` *style*. Raises ``ValueError`` if *fmt* is malformed.
+
+    The attribute *format* holds *fmt*.
+    """
+    def __init__(self, fmt, style=PERCENT):
+        self._spec, self._names = _tpl_compile(fmt,style)
+        self.format = fmt
+
+    def render(self, *args):
+        """
+.. method:: render(*args)
+
+        Returns the string obtained by formatting *args*, as ``fmt % args`` or ``fmt.format(*args)`` would.
+        Raises ``IndexError`` for missing arguments, ``KeyError`` for missing names and ``TypeError`` for arguments of the wrong type.
+        """
+        try:
+            return _tpl_render(self._spec,self._names,args,None,0)
+        except TypeError:
+            return _tpl_render(self._spec,self._names,_plain(args),None,0)
+
+    def render_into(self, buf, *args):
+        """
+.. method:: render_into(buf, *args)
+
+        Formats *args* as :meth:`render` does, writing the result at the start of the bytearray *buf* instead of allocating a string.
+        Returns the number of bytes written. Raises ``IndexError`` if the result does not fit in *buf*.
+        """
+        return self.render_at(buf,0,args)
+
+    def render_at(self, buf, ofs, args):
+        """
+.. method:: render_at(buf, ofs, args)
+
+        Formats the tuple or list *args*, writing the result in the bytearray *buf* starting at *ofs*, to append several renderings to the same buffer.
+        Returns the number of bytes written. Raises ``IndexError`` if the result does not fit in *buf*.
+        """
+        try:
+            return _tpl_render(self._spec,self._names,args,buf,ofs)
+        except TypeError:
+            return _tpl_render(self._spec,self._names,_plain(args),buf,ofs)
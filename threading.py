@@ -12,9 +12,11 @@ such primitives to make them easy to use:
 
     * :class:`Thread`
     * :class:`Lock`
+    * :class:`RLock`
     * :class:`Semaphore`
     * :class:`Event`
     * :class:`Condition`
+    * :class:`ThreadPool`
 
     """
 
@@ -39,6 +41,67 @@ __define(RTOS__SEM_SIGNALCAP,14)
 def __rtos_do(code,*args):
     pass
 
+@native_c("__rtos_sem_acquire",["csrc/threading/*"])
+def _sem_acquire(sem,blocking,timeout):
+    pass
+
+@native_c("__rtos_sem_release",["csrc/threading/*"])
+def _sem_release(sem,cap):
+    pass
+
+@native_c("__rtos_thread_id",["csrc/threading/*"])
+def _thread_id():
+    pass
+
+@native_c("__rtos_sem_signal_n",["csrc/threading/*"])
+def _sem_signal_n(sem,n):
+    pass
+
+@native_c("__rtos_cond_wait",["csrc/threading/*"])
+def _cond_wait(lock,q,timeout):
+    pass
+
+# native queues of queue.Queue, used here as work queue
+@native_c("_queue_new",["csrc/threading/*"])
+def _queue_new(maxsize):
+    pass
+
+@native_c("_queue_put",["csrc/threading/*"])
+def _queue_put(q,obj,timeout):
+    pass
+
+@native_c("_queue_get",["csrc/threading/*"])
+def _queue_get(q,timeout,remove):
+    pass
+
+@native_c("__rtos_stack_paint",["csrc/threading/*"])
+def _stack_paint(size):
+    pass
+
+@native_c("__rtos_stack_unused",["csrc/threading/*"])
+def _stack_unused(bottom,size):
+    pass
+
+@native_c("__rtos_millis",["csrc/threading/*"])
+def _millis():
+    pass
+
+@native_c("__rtos_evt_wait",["csrc/threading/*"])
+def _evt_wait(evt,timeout):
+    pass
+
+@native_c("__rtos_evt_set",["csrc/threading/*"])
+def _evt_set(evt):
+    pass
+
+@native_c("__rtos_evt_clear",["csrc/threading/*"])
+def _evt_clear(evt):
+    pass
+
+@native_c("__rtos_evt_is_set",["csrc/threading/*"])
+def _evt_is_set(evt):
+    pass
+
 
 def __looper(fun,*args):
   while True:
@@ -111,9 +174,13 @@ Thread class
         self.name=name
         self.ident=None
         self.exc = None
-    def start(self,prio = PRIO_NORMAL, size=512):
+        self._size = 0
+        self._paint = -1
+        self._started = 0
+        self._ended = 0
+    def start(self,prio = PRIO_NORMAL, size=512, stats=False):
         """
-.. method:: start(prio = PRIO_NORMAL, size=512)
+.. method:: start(prio = PRIO_NORMAL, size=512, stats=False)
 
       Start the thread's activity.
 
@@ -125,13 +192,20 @@ Thread class
       on the same thread object.
 
       *prio* and *size* are used to set the thread priority and the stack size.
+
+      If *stats* is ``True``, the thread fills its stack with a pattern as soon as it starts, so that :meth:`stats` can measure the stack used.
         """
         if self.running:
             raise RuntimeError
+        if stats:
+            self._size = size
         __rtos_do(RTOS__SEM_WAIT,self._jq)
         thread(self._run,prio=prio,size=size)
 
     def _run(self):
+        if self._size>0:
+            self._paint = _stack_paint(self._size)
+        self._started = _millis()
         self.ident = __rtos_do(RTOS__THD_CURRENT)
         if self.name is None:
             self.name="Thread-"+str(self.ident)
@@ -140,6 +214,7 @@ Thread class
             self.run()
         except Exception as e:
             self.exc = e
+        self._ended = _millis()
         self.running=False
         __rtos_do(RTOS__SEM_SIGNAL_ALL,self._jq)
 
@@ -181,6 +256,28 @@ Thread class
         if self.running:
             __rtos_do(RTOS__SEM_SIGNAL_WAIT,self._jq,timeout)
 
+    def stats(self):
+        """
+.. method:: stats()
+
+      Return a tuple holding:
+
+      * *stack_used*, the most bytes of stack the thread has used so far, or -1 if it was not started with *stats* (or its stack is too small).
+        The stack the thread used before filling it is assumed to be 256 bytes (``STACK_PAINT_RESERVE`` at compile time), so the value is an upper bound:
+        a thread using less than *size* minus *stack_used* bytes can be given a smaller stack safely;
+      * *run_time*, the milliseconds the thread has been running (till now, if still alive).
+
+      CPU time, context switches and GIL hold times are accounted by the RTOS and the VM and are not available.
+        """
+        if self._paint==-1:
+            used = -1
+        else:
+            used = self._size-_stack_unused(self._paint,self._size)
+        if self._started==0:
+            return (used,0)
+        end = self._ended if self._ended else _millis()
+        return (used,end-self._started)
+
     def is_alive(self):
         """
 .. method:: is_alive()
@@ -283,10 +380,7 @@ Lock class
     The return value is ``True`` if the lock is acquired successfully,
     ``False`` if not (for example if the *timeout* expired).        
         """
-        if blocking:
-            return __rtos_do(RTOS__SEM_WAIT,self.lck,timeout)>=0
-        else:
-            return __rtos_do(RTOS__SEM_TRYLOCK,self.lck)>=0
+        return _sem_acquire(self.lck,blocking,timeout)
 
     def release(self):
         """
@@ -299,7 +393,57 @@ Lock class
       are blocked waiting for the lock to become unlocked, allow exactly one of them
       to proceed.
         """
-        __rtos_do(RTOS__SEM_SIGNALCAP,self.lck)
+        _sem_release(self.lck,1)
+
+
+class RLock():
+    """
+===========
+RLock class
+===========
+
+.. class:: RLock()
+
+    A reentrant lock: like a :class:`Lock`, but the thread that holds it can acquire it again without blocking.
+    The lock is released when :meth:`release` has been called once for every :meth:`acquire`.
+
+    """
+    def __init__(self):
+        self.lck = __rtos_do(RTOS__SEM_CREATE,1)
+        self._owner = -1
+        self._count = 0
+
+    def acquire(self,blocking=True,timeout=-1):
+        """
+.. method:: acquire(blocking=True,timeout=-1)
+
+    Acquire the lock, as :meth:`Lock.acquire`. If the calling thread already holds it, increment the recursion level and return ``True`` immediately.
+
+        """
+        me = _thread_id()
+        if self._owner==me:
+            self._count+=1
+            return True
+        if not _sem_acquire(self.lck,blocking,timeout):
+            return False
+        self._owner = me
+        self._count = 1
+        return True
+
+    def release(self):
+        """
+.. method:: release()
+
+    Decrement the recursion level, releasing the lock when it reaches zero. Only the thread that holds the lock can release it,
+    otherwise :exc:`RuntimeError` is raised.
+
+        """
+        if self._owner!=_thread_id():
+            raise RuntimeError
+        self._count-=1
+        if self._count==0:
+            self._owner = -1
+            _sem_release(self.lck,1)
 
 
 class Semaphore():
@@ -347,10 +491,7 @@ Semaphore class
       that interval, return false.  Return true otherwise.
 
         """        
-        if blocking:
-            return __rtos_do(RTOS__SEM_WAIT,self.lck,timeout)>=0
-        else:
-            return __rtos_do(RTOS__SEM_TRYLOCK,self.lck)>=0 
+        return _sem_acquire(self.lck,blocking,timeout)
     def release(self):
         """
 .. method:: release()
@@ -359,7 +500,7 @@ Semaphore class
     was zero on entry and another thread is waiting for it to become larger
     than zero again, wake up that thread.
         """
-        __rtos_do(RTOS__SEM_SIGNAL,self.lck)
+        _sem_release(self.lck,0)
 
 class Event():
     """
@@ -384,15 +525,14 @@ Event class
       are awakened. Threads that call :meth:`wait` once the flag is true will
       not block at all.
         """
-        __rtos_do(RTOS__EVT_SET,self.evt)
+        _evt_set(self.evt)
     def is_set(self):
         """
 .. method:: is_set()
 
       Return true if and only if the internal flag is true.
         """        
-        # return self.flag
-        return __rtos_do(RTOS__EVT_GETFLAG,self.evt)
+        return _evt_is_set(self.evt)
     def clear(self):
         """
 .. method:: clear()
@@ -401,7 +541,7 @@ Event class
       :meth:`wait` will block until :meth:`.set` is called to set the internal
       flag to true again.
         """
-        __rtos_do(RTOS__EVT_CLEAR,self.evt)
+        _evt_clear(self.evt)
     def wait(self,timeout=-1):
         """
 .. method:: wait(timeout=-1)
@@ -418,8 +558,7 @@ Event class
       always return ``True`` except if a timeout is given and the operation
       times out.
         """
-        ret = __rtos_do(RTOS__EVT_WAIT,self.evt,timeout)
-        return ret
+        return _evt_wait(self.evt,timeout)
 
         
 
@@ -514,6 +653,8 @@ Condition class
         else:
             self._lock = lock.lck
         self._q = __rtos_do(RTOS__SEM_CREATE,0)
+        # threads in wait, not yet notified: changed only with the lock held
+        self._waiters = 0
         self.th=-1
     def acquire(self,blocking=True,timeout=-1):
         """
@@ -523,12 +664,9 @@ Condition class
       the underlying lock; the return value is whatever that method returns.
 
         """
-        if blocking:
-            ret=__rtos_do(RTOS__SEM_WAIT,self._lock,timeout)>=0
-        else:
-            ret= __rtos_do(RTOS__SEM_TRYLOCK,self._lock)>=0
+        ret = _sem_acquire(self._lock,blocking,timeout)
         if ret:
-            self.th=__rtos_do(RTOS__THD_CURRENT)
+            self.th=_thread_id()
         return ret
     def release(self):
         """
@@ -538,7 +676,7 @@ Condition class
       the underlying lock; there is no return value.
         """
         self.th=-1
-        __rtos_do(RTOS__SEM_SIGNAL,self._lock)
+        _sem_release(self._lock,0)
 
     def wait(self, timeout=-1):
         """
@@ -552,6 +690,8 @@ Condition class
       awakened by a :meth:`notify` or :meth:`notify_all` call for the same
       condition variable in another thread, or until the optional timeout
       occurs.  Once awakened or timed out, it re-acquires the lock and returns.
+      Notifications are counted for the threads in wait, so that none is lost between the release of the lock
+      and the start of the wait.
 
       When the *timeout* argument is present and not less than zero, it should be a
       integer number specifying a timeout for the operation in milliseconds.
@@ -560,9 +700,16 @@ Condition class
       case it is ``False``.
         """
         self._is_owned()
-        self.release()
-        ret = __rtos_do(RTOS__SEM_WAIT,self._q,timeout)!=-1
-        self.acquire()
+        self._waiters+=1
+        self.th=-1
+        ret = _cond_wait(self._lock,self._q,timeout)
+        self.th=_thread_id()
+        if not ret:
+            # timed out: leave the waiters, or take the signal of a notify that counted us out meanwhile
+            if self._waiters>0:
+                self._waiters-=1
+            else:
+                ret = _sem_acquire(self._q,False,0)
         return ret
     def wait_for(self, predicate, timeout=-1):
         """
@@ -610,9 +757,11 @@ Condition class
       release the lock, its caller should.
         """
         self._is_owned()
-        while n>0:
-            __rtos_do(RTOS__SEM_SIGNAL_IF_WAITING,self._q)
-            n=n-1
+        if n>self._waiters:
+            n = self._waiters
+        if n>0:
+            self._waiters-=n
+            _sem_signal_n(self._q,n)
     def notify_all(self):
         """
 .. method:: notify_all()
@@ -623,10 +772,139 @@ Condition class
       :exc:`RuntimeError` is raised.
         """
         self._is_owned()
-        __rtos_do(RTOS__SEM_SIGNAL_ALL,self._q)
+        self.notify(self._waiters)
 
     def _is_owned(self):
-        if self.th>=0 and self.th!=__rtos_do(RTOS__THD_CURRENT):
+        if self.th>=0 and self.th!=_thread_id():
+            raise RuntimeError
+
+
+class Future():
+    """
+============
+Future class
+============
+
+.. class:: Future
+
+    The pending result of a job submitted to a :class:`ThreadPool`, returned by :meth:`ThreadPool.submit`.
+
+    """
+    def __init__(self,fn,args):
+        self._fn = fn
+        self._args = args
+        self._evt = __rtos_do(RTOS__EVT_CREATE)
+        self._res = None
+        self._exc = None
+
+    def _run(self):
+        try:
+            self._res = self._fn(*self._args)
+        except Exception as e:
+            self._exc = e
+        self._fn = None
+        self._args = None
+        _evt_set(self._evt)
+
+    def done(self):
+        """
+.. method:: done()
+
+    Return ``True`` if the job has completed.
+
+        """
+        return _evt_is_set(self._evt)
+
+    def result(self,timeout=-1):
+        """
+.. method:: result(timeout=-1)
+
+    Wait at most *timeout* milliseconds (forever if negative) for the job to complete and return its result.
+    Raise :exc:`TimeoutError` if the job is not complete in time, and the exception raised by the job if it failed.
+
+        """
+        if not _evt_wait(self._evt,timeout):
+            raise TimeoutError
+        if self._exc is not None:
+            raise self._exc
+        return self._res
+
+
+class ThreadPool():
+    """
+================
+ThreadPool class
+================
+
+.. class:: ThreadPool(n, stack_size=512, prio=PRIO_NORMAL, maxjobs=0)
+
+    Start *n* worker threads, each with a stack of *stack_size* bytes and priority *prio*, running the jobs submitted to the pool.
+    Workers are created once and reused, so a job costs no thread creation and the stack memory of the pool is bounded to *n* times *stack_size*.
+
+    Jobs wait in a native FIFO queue of at most *maxjobs* jobs (unbounded if not positive)::
+
+        pool = threading.ThreadPool(2, 1024)
+        f = pool.submit(read_sensor, 3)
+        value = f.result(1000)
+
+    """
+    def __init__(self,n,stack_size=512,prio=PRIO_NORMAL,maxjobs=0):
+        if n<=0:
+            raise ValueError
+        self._q = _queue_new(maxjobs)
+        self._n = n
+        # signaled by every worker that ends
+        self._ended = __rtos_do(RTOS__SEM_CREATE,0)
+        for i in range(n):
+            thread(self._worker,prio=prio,size=stack_size)
+
+    def _worker(self):
+        while True:
+            job = _queue_get(self._q,-1,True)
+            if job is None:
+                break
+            job._run()
+        _sem_release(self._ended,0)
+
+    def submit(self,fn,*args):
+        """
+.. method:: submit(fn, *args)
+
+    Queue the job ``fn(*args)`` and return its :class:`Future`. If the queue is full, wait for a free place.
+
+        """
+        if self._q is None:
             raise RuntimeError
+        f = Future(fn,args)
+        _queue_put(self._q,f,-1)
+        return f
+
+    def map(self,fn,items):
+        """
+.. method:: map(fn, items)
+
+    Submit ``fn(item)`` for every item of *items* and return the list of their results, in order.
 
+        """
+        res = [self.submit(fn,item) for item in items]
+        for i in range(len(res)):
+            res[i] = res[i].result()
+        return res
 
+    def shutdown(self,wait=True):
+        """
+.. method:: shutdown(wait=True)
+
+    Stop the workers after the jobs already submitted. If *wait* is ``True``, return when all the workers have ended.
+    No job can be submitted afterwards.
+
+        """
+        q = self._q
+        if q is None:
+            return
+        self._q = None
+        for i in range(self._n):
+            _queue_put(q,None,-1)
+        if wait:
+            for i in range(self._n):
+                _sem_acquire(self._ended,True,-1)
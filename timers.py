@@ -7,31 +7,110 @@ Software Timers
 
 This module contain the :class:`timer` to handle time and timed events
 
+Timers share a single timer wheel, ticking every :samp:`TICK` milliseconds: a program can keep many timers armed while
+using only one system timer. Deadlines are absolute, so an interval timer does not drift by the running time of its
+callback. Expired timers call their functions, in order of expiration, from a dedicated thread started with the first timer.
+
 
 .. function:: now()
 
-    Return the number of milliseconds since the start of the program.
+    Return the number of milliseconds since the start of the program, as :func:`monotonic_ms`.
 
 """
 
-now = __timer_get
+TICK = 1
+
+@native_c("_clk_ms",["csrc/timers/*"])
+def monotonic_ms():
+    """
+.. function:: monotonic_ms()
 
-def recurring_timer(instance,period,fn,arg=None):
-    fn(arg)
-    if instance.tm:
-        __timer_set(instance.tm,period,recurring_timer,instance,period,fn,arg)
+    Return the milliseconds since the start of the program, from a clock that never goes back nor wraps around
+    (on VMs with 32 bits integers, values wrap around as the integers do, after 24 days).
+    """
+    pass
+
+@native_c("_clk_us",["csrc/timers/*"])
+def monotonic_us():
+    """
+.. function:: monotonic_us()
+
+    Return the microseconds since the start of the program, from a clock that never goes back nor wraps around
+    (on VMs with 32 bits integers, values wrap around as the integers do, after 35 minutes).
+    Cheap enough to timestamp each sample of a high rate acquisition.
+    """
+    pass
+
+now = monotonic_ms
+
+@native_c("_tw_init",["csrc/timers/*"])
+def _tw_init(tick):
+    pass
+
+@native_c("_tw_arm",["csrc/timers/*"])
+def _tw_arm(id,delay,period):
+    pass
+
+@native_c("_tw_cancel",["csrc/timers/*"])
+def _tw_cancel(id,release):
+    pass
+
+@native_c("_tw_fired",["csrc/timers/*"])
+def _tw_fired(timeout):
+    pass
+
+# armed timers, by wheel entry
+_armed = None
+
+def _dispatcher():
+    while True:
+        calls = []
+        for id in _tw_fired(-1):
+            tm = _armed[id]
+            if tm is None or tm.tm!=id:
+                continue
+            if not tm._period:
+                # one shot: give the entry back before the callback can arm the timer again
+                _tw_cancel(id,True)
+                _armed[id] = None
+                tm.tm = -1
+            calls.append(tm._fn)
+            calls.append(tm._arg)
+        for i in range(0,len(calls),2):
+            try:
+                calls[i](calls[i+1])
+            except Exception as e:
+                print(e)
+
+def _start():
+    global _armed
+    if _armed is None:
+        _armed = [None]*_tw_init(TICK)
+        thread(_dispatcher,prio=PRIO_HIGH)
 
 
 class timer():
     """
 .. class:: timer()
 
-    Creates a new timer.
+    Creates a new timer. It takes an entry of the timer wheel only while armed: arming raises :samp:`RuntimeError`
+    if all the entries (64 unless the project defines :samp:`TW_TIMERS`) are in use.
     """
     def __init__(self):
-        self.tm = __new_timer()
+        self.tm = -1
         self.time = None
-    
+        self._fn = None
+        self._arg = None
+        self._period = 0
+
+    def _arm(self,delay,period,fn,arg):
+        _start()
+        self._fn = fn
+        self._arg = arg
+        self._period = period
+        self.tm = _tw_arm(self.tm,delay,period)
+        _armed[self.tm] = self
+
     def one_shot(self,delay,fn,arg=None):
         """
 .. method:: one_shot(delay,fun,arg=None)
@@ -39,15 +118,20 @@ class timer():
     Activates the timer in one shot mode. Function *fun(arg)* is executed only once after *delay* milliseconds.
 
         """
-        __timer_set(self.tm,delay,fn,arg)
+        self._arm(delay,0,fn,arg)
+
     def interval(self,period,fn,arg=None):
         """
 .. method:: interval(period,fun,arg=None)
     
-    Activates the timer in interval mode. Function *fun(arg)* is executed every *period* milliseconds.
+    Activates the timer in interval mode. Function *fun(arg)* is executed every *period* milliseconds, the first time
+    *period* milliseconds after the call. If a callback runs late, the following ones stay on the original schedule and
+    deadlines already passed are skipped.
 
         """
-        __timer_set(self.tm,period,recurring_timer,self,period,fn,arg)
+        if period<=0:
+            raise ValueError
+        self._arm(period,period,fn,arg)
 
     def clear(self):
         """
@@ -56,7 +140,10 @@ class timer():
     Disable the timer.
 
         """
-        __timer_set(self.tm,-1,None)
+        if self.tm>=0:
+            _tw_cancel(self.tm,True)
+            _armed[self.tm] = None
+            self.tm = -1
 
     def destroy(self):
         """
@@ -65,8 +152,7 @@ class timer():
     Disable the timer and kills it.
 
         """
-        __timer_set(self.tm,-1,None)
-        self.tm=None
+        self.clear()
 
     def start(self):
         """
@@ -75,7 +161,7 @@ class timer():
     Start the timer. A started timer begins counting the number of passing milliseconds. Such number can be read by calling
     :ref:`timer.get()`.
         """
-        self.time = __timer_get()
+        self.time = monotonic_ms()
     
     def reset(self):
         """
@@ -85,12 +171,8 @@ class timer():
 
     Returns the number of milliseconds passed since the start or the last reset.
         """
-        now = __timer_get()
-        ret = self.get()
-        # if now>=self.time:
+        now = monotonic_ms()
         ret = now-self.time
-        # else:
-        #     ret = 0x3fffffff-self.time+now
         self.time = now
         return ret
 
@@ -100,9 +182,4 @@ class timer():
     
     Return the number of milliseconds passed since the start or the last reset.
         """
-        now = __timer_get()
-        # if now>=self.time:
-        ret = now-self.time
-        # else:
-        #     ret = 0x3fffffff-self.time+now
-        return ret
+        return monotonic_ms()-self.time
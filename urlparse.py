@@ -36,52 +36,21 @@ def parse(url):
    a path component.
 
     """
-    idx_scheme = url.find("://")
-    if idx_scheme >=0:
-        idx_netloc = url.find(__ORD("/"),idx_scheme+3)
-    else:
-        idx_netloc = url.find(__ORD("/"))
-    idx_query = url.find(__ORD("?"))
-    idx_frag = url.find(__ORD("#"))
-
-    if idx_scheme>=0:
-        scheme = url[0:idx_scheme]
-        idx_scheme+=3
-    else:
-        scheme = ""
-        idx_scheme=0
-
-    if idx_netloc>=0:
-        netloc = url[idx_scheme:idx_netloc]        
-    else:
-        if idx_query<0 and idx_frag<0:
-            netloc = url[idx_scheme:]
-            idx_netloc = len(url)
-        elif idx_query>=0:
-            netloc = url[idx_scheme:idx_query]
-            idx_netloc = idx_query
-        elif idx_frag>=0:
-            netloc = url[idx_scheme:idx_frag]
-            idx_netloc = idx_frag
-        else:
-            netloc=""
-            idx_netloc = idx_scheme
-
-    if idx_frag>=0:
-        fragment=url[idx_frag+1:]
-    else:
-        fragment=""
-        idx_frag = len(url)
-
-    if idx_query>=0:
-        query = url[idx_query+1:idx_frag]
-    else:
-        query = ""        
-        idx_query = idx_frag
-
-    path = url[idx_netloc:idx_query]
-
-    return (scheme,netloc,path,query,fragment)
+    sp = _split(url,0)
+    return (url[sp[0]],url[sp[1]],url[sp[2]],url[sp[3]],url[sp[4]])
+
+
+def split(url):
+    """
+.. function:: split(url)
+
+    Returns a tuple of slices (*scheme*, *netloc*, *path*, *query*, *fragment*, *user*, *password*, *host*, *port*) selecting the components of *url*,
+    as given by :func:`parse` and :func:`parse_netloc`: for example ``url[split(url)[7]]`` is the host.
+
+    *url* is scanned natively once and no component is copied: only the ones needed can then be extracted.
+
+    """
+    return _split(url,0)
 
 
 def parse_netloc(netloc):
@@ -89,48 +58,27 @@ def parse_netloc(netloc):
 .. function:: parse_netloc(netloc)
 
     Given *netloc* as parsed by :func:`.parse`, breaks it in its component returning a tuple (*user*, *password*, *host*, *port*).
-    Each component of the returned tuple is a string.
-
-    """
-    idx_at = netloc.find(__ORD("@"))
-    if idx_at>=0:
-        idx2=idx_at+1
-        idx_cl = netloc.find(__ORD(":"))
-        if idx_cl<0:
-            username=""
-            password=""
-        else:
-            username=netloc[0:idx_cl]
-            password=netloc[idx_cl+1:idx_at]
-    else:
-        username = ""
-        password = ""
-        idx2 = 0
-    idx_cl = netloc.find(__ORD(":"),idx2)
-    if idx_cl>=0:
-        host = netloc[idx2:idx_cl]
-        port = netloc[idx_cl+1:]
-    else:
-        host = netloc[idx2:]
-        port =""
-
-    return (username,password,host,port)
-
-safesymbols = bytes("$-_.+!*'()")
-safesymbols_noplus = bytes("$-_.!*'()")
-
-def _quote(s, sfsymbols=safesymbols_noplus):
-    res=bytearray()
-    ss = bytes(s)
-    for x in ss:
-        if (x>=__ORD("a") and x<=__ORD("z")) or (x>=__ORD("A") and x<=__ORD("Z")) or (x>=__ORD("0") and x<=__ORD("9")) or (x in sfsymbols):
-            res.append(x)
-        else:
-            res.append(__ORD("%"))
-            h = hex(x,prefix="")
-            res.append(ord(h[0]))
-            res.append(ord(h[1]))
-    return str(res)
+    Each component of the returned tuple is a string. The brackets around IPv6 hosts (as in ``[fe80::1]:80``) are removed.
+
+    """
+    sp = _split(netloc,1)
+    return (netloc[sp[0]],netloc[sp[1]],netloc[sp[2]],netloc[sp[3]])
+
+@native_c("urlparse_split",["csrc/urlparse/*"])
+def _split(url,netloc_only):
+    pass
+
+@native_c("urlparse_quote",["csrc/urlparse/*"])
+def _quote(s,plus):
+    pass
+
+@native_c("urlparse_unquote",["csrc/urlparse/*"])
+def _unquote(s):
+    pass
+
+@native_c("urlparse_urlencode",["csrc/urlparse/*"])
+def _urlencode(items,plus):
+    pass
 
 def quote(s):
     """
@@ -148,7 +96,7 @@ def quote(s):
         * the following symbols: $-_.+!*'()
 
     """
-    return _quote(s, safesymbols)
+    return _quote(s,1)
 
 def quote_plus(s):
     """
@@ -156,7 +104,7 @@ def quote_plus(s):
 
     Like :func:`quote`, but also escapes :code:`+` symbol.
     """
-    return _quote(s)
+    return _quote(s,0)
 
 
 def unquote(s):
@@ -166,23 +114,7 @@ def unquote(s):
     If *s* is urlencoded, returns *s* with every ``+`` substituted with a space and every ``%xx`` substituted with the corresponding character.
 
     """
-    res = bytearray()
-    i=0
-    l=len(s)
-    while i<l:
-        c= s[i]
-        if c=="%":
-            z = int(s[i+1:i+3],16)
-            res.append(z)
-            i+=3
-            continue
-        if c=="+":
-            res.append(ord(" "))
-        else:
-            res.append(ord(c))
-        i+=1
-    #return res.decode("utf-8")
-    return str(res)
+    return _unquote(s)
 
 def parse_qs(qs, unquote_key = False):
     """
@@ -214,10 +146,21 @@ def urlencode(data, quote_via=quote_plus):
     An alternate function that can be passed as quote_via is :func:`quote`.
     
     """
-    res = ""
+    if quote_via!=quote_plus and quote_via!=quote:
+        res = ""
+        for k,v in data.items():
+            res+=quote(str(k))+"="+quote_via(str(v))+"&"
+        return res[:-1]
+    # the whole query string is built natively in one pass
+    items = []
     for k,v in data.items():
-        res+=quote(str(k))+"="+quote_via(str(v))+"&"
-    return res[:-1]
+        if type(k)!=PSTRING:
+            k = str(k)
+        if type(v)!=PSTRING:
+            v = str(v)
+        items.append(k)
+        items.append(v)
+    return _urlencode(items,quote_via==quote)
 
 #######################################
 # TEST
@@ -107,3 +107,204 @@ def trace(msg):
 def tracebin(msg):
     return __vmctrl(VM_TRACE,1,0,msg)
 
+
+
+@native_c("__gilprof_stats",["csrc/gilprof/*"])
+def __gilprof_stats():
+    pass
+
+@native_c("__gilprof_holds",["csrc/gilprof/*"])
+def __gilprof_holds(which):
+    pass
+
+@native_c("__gilprof_reset",["csrc/gilprof/*"])
+def __gilprof_reset():
+    pass
+
+def gil_stats():
+    """
+.. function:: gil_stats()
+
+    Return how long C natives kept the GIL (hence blocked every other Python thread) since the last :func:`gil_reset`.
+    The result is a list with a tuple for every native that has run:
+
+    * the native name (string)
+    * the number of GIL holds
+    * the total hold time in microseconds
+    * the longest hold in microseconds
+    * a tuple of 12 counters: holds shorter than 16us, 32us, 64us... up to 32ms, and longer ones
+
+    A native that releases the GIL while waiting counts one hold for each part run with the GIL.
+    Times have millisecond resolution on microcontrollers without a cycle counter.
+
+    The list is empty unless the project is compiled with :samp:`ZERYNTH_GIL_PROFILE` defined.
+
+    """
+    return __gilprof_stats()
+
+def gil_top():
+    """
+.. function:: gil_top()
+
+    Return the 8 longest GIL holds, longest first, as tuples (native name, microseconds, thread id, millis at the end of the hold).
+    Useful to spot the native that caused a latency spike in another thread.
+
+    """
+    return __gilprof_holds(0)
+
+def gil_history():
+    """
+.. function:: gil_history()
+
+    Return the latest 32 GIL holds, oldest first, as tuples like the ones of :func:`gil_top`.
+
+    """
+    return __gilprof_holds(1)
+
+def gil_reset():
+    """
+.. function:: gil_reset()
+
+    Clear the statistics collected by the GIL profiler.
+
+    """
+    __gilprof_reset()
+
+@native_c("__gilprio_stats",["csrc/gilprof/*","csrc/misc/zgilprio.c"])
+def __gilprio_stats():
+    pass
+
+def gil_handoffs():
+    """
+.. function:: gil_handoffs()
+
+    Return a tuple *(handoffs, waiting)* about the GIL handoff to threads of higher priority: *handoffs* counts the
+    times a long native gave the GIL to a waiting thread of higher priority, *waiting* is a tuple with the number of threads
+    waiting for the GIL at each priority, from :samp:`PRIO_IDLE` (0) to :samp:`PRIO_HIGHEST` (7).
+
+    With :samp:`ZERYNTH_GIL_HANDOFF` defined, natives that hold the GIL for long (decompression, bulk statistics)
+    check between chunks of work whether a thread of higher priority waits for the GIL, as a control thread woken by a
+    queue or a hardware timer, and let it run first. Only threads waiting from a native are seen: a thread resuming after
+    :func:`sleep` still waits for the running thread to reach a switch point of the VM.
+
+    Returns None unless the project is compiled with :samp:`ZERYNTH_GIL_HANDOFF` defined.
+
+    """
+    return __gilprio_stats()
+
+@native_c("__vmprof_start",["csrc/vmprof/*"])
+def __vmprof_start(period):
+    pass
+
+@native_c("__vmprof_stats",["csrc/vmprof/*"])
+def __vmprof_stats(top_n):
+    pass
+
+def profile_start(period=1000):
+    """
+.. function:: profile_start(period=1000)
+
+    Start the sampling profiler, clearing its table: every *period* microseconds a timer interrupt counts a hit for the bytecode running
+    in the interrupted thread, identified as in traceback entries by module, code object and pc. The code objects with most hits
+    are the hot Python functions, and their pcs the hot spots inside them.
+
+    Time spent waiting in a native call is charged to the bytecode that called it, so blocking calls show up too: look at the thread
+    to tell them apart. Ticks with no Python code running (idle, system threads) are only counted.
+    Up to 128 sites are recorded, with exact counts; hits of sites beyond those are counted as dropped.
+
+    """
+    __vmprof_start(period)
+
+def profile_stop():
+    """
+.. function:: profile_stop()
+
+    Stop the sampling profiler, keeping its table for :func:`profile_stats` and :func:`profile_dump`.
+
+    """
+    __vmprof_start(0)
+
+def profile_stats(top_n=20):
+    """
+.. function:: profile_stats(top_n=20)
+
+    Return a tuple *(sites, samples, idle, dropped)*: *sites* is a list of the *top_n* sites with most hits, as tuples *(thread, module, code, pc, hits)*;
+    *samples* is the number of ticks, *idle* the ticks with no Python code running and *dropped* the hits of sites not recorded.
+    Can be called while the profiler runs.
+
+    """
+    return __vmprof_stats(top_n)
+
+def profile_dump(stream=None, top_n=20):
+    """
+.. function:: profile_dump(stream=None, top_n=20)
+
+    Write the profile to *stream* (``__default_stream`` if None), as text lines to be mapped to source lines with the debug information
+    of the compiled program: first the totals, then the *top_n* code objects with most hits (summing all their pcs and threads),
+    then the *top_n* sites. Each line has the fields separated by spaces::
+
+        samples <samples> idle <idle> dropped <dropped>
+        code <module> <code> <hits> <percent>
+        site <thread> <module> <code> <pc> <hits> <percent>
+
+    """
+    if not stream:
+        stream = __default_stream
+    sites, samples, idle, dropped = __vmprof_stats(-1)
+    total = samples if samples else 1
+    stream.write("samples "+str(samples)+" idle "+str(idle)+" dropped "+str(dropped)+"\n")
+    codes = {}
+    for th, module, code, pc, hits in sites:
+        key = (module,code)
+        codes[key] = codes.get(key,0)+hits
+    for i in range(min(top_n,len(codes))):
+        best = None
+        for key,hits in codes.items():
+            if best is None or hits>codes[best]:
+                best = key
+        hits = codes.pop(best)
+        stream.write("code "+str(best[0])+" "+str(best[1])+" "+str(hits)+" "+str(hits*100//total)+"\n")
+    for th, module, code, pc, hits in sites[:top_n]:
+        stream.write("site "+str(th)+" "+str(module)+" "+str(code)+" "+str(pc)+" "+str(hits)+" "+str(hits*100//total)+"\n")
+
+@native_c("__natprof_stats",["csrc/natprof/*"])
+def __natprof_stats():
+    pass
+
+@native_c("__natprof_reset",["csrc/natprof/*"])
+def __natprof_reset():
+    pass
+
+def native_stats():
+    """
+.. function:: native_stats()
+
+    Return how long the calls to C natives lasted since the last :func:`native_reset`, from entry to return, waits included.
+    The result is a tuple *(natives, lost)*: *natives* is a list with a tuple for every native called
+
+    * the native name (string)
+    * the number of calls
+    * the number of calls that raised an exception
+    * the total duration in microseconds
+    * the longest call in microseconds
+    * a tuple of 16 counters: calls shorter than 16us, 32us, 64us... up to 256ms, and longer ones
+
+    and *lost* counts the calls of natives that did not fit in the table (48 natives).
+    The time a native spends with the GIL is measured by :func:`gil_stats`; :func:`native_stats` also counts waits for
+    the network, the disk or the peripherals, to catch slow natives and regressions in their latency.
+    Times have millisecond resolution on microcontrollers without a cycle counter.
+
+    The list is empty unless the project is compiled with :samp:`ZERYNTH_NATIVE_PROFILE` defined: only natives written
+    with ``C_NATIVE`` in the libraries are measured, not the ones built into the VM.
+
+    """
+    return __natprof_stats()
+
+def native_reset():
+    """
+.. function:: native_reset()
+
+    Clear the statistics collected by the native call profiler.
+
+    """
+    __natprof_reset()
@@ -114,9 +114,13 @@ ADV_SCAN_UND = 2
 ADV_UNCN_UND = 3
 ADV_SCAN_RSP = 4
 
-def gap(name, appearance=0, security=(1,1), connection=(400,650,0,4000)):
+PHY_1M = 1
+PHY_2M = 2
+PHY_CODED = 4
+
+def gap(name, appearance=0, security=(1,1), connection=(400,650,0,4000), phy=PHY_1M, data_length=0, mtu=0):
     """
-.. function:: gap(name,appearance=0,security=(SECURITY_MODE_1,SECURITY_LEVEL_1),connection=(400,650,0,4000))
+.. function:: gap(name,appearance=0,security=(SECURITY_MODE_1,SECURITY_LEVEL_1),connection=(400,650,0,4000),phy=PHY_1M,data_length=0,mtu=0)
 
         Set parameters for the the Generic Access Profile:
 
@@ -124,6 +128,13 @@ def gap(name, appearance=0, security=(1,1), connection=(400,650,0,4000)):
         * :samp:`appearance` is a 16-bit number encoding the BLE `appearance <https://www.bluetooth.com/specifications/gatt/viewer?attributeXmlFile=org.bluetooth.characteristic.gap.appearance.xml&u=org.bluetooth.characteristic.gap.appearance.xml>`_
         * :samp:`security` is a tuple of integers. The first element is the security mode, the second is the security level. More info `here <https://www.safaribooksonline.com/library/view/getting-started-with/9781491900550/ch04.html>`_ . Constants :samp:`SECURITY_MODE_1` and :samp:`SECURITY_MODE_2` can be used for mode, :samp:`SECURITY_LEVEL_1`, :samp:`SECURITY_LEVEL_2`, :samp:`SECURITY_LEVEL_3` and :samp:`SECURITY_LEVEL_4` for level.
         * :samp:`connection` is a tuple of integers representing connections parameters. The first element specifies the Minimum Connection Interval in milliseconds; the second element specifies the Maximum Connection Interval in milliseconds; the third element specifies the slave latency and it represents the number of times that the peripheral can avoid answering to a central; the fourth element is the maximum time in milliseconds after which a connection is declared lost if no data has been exchanged.
+        * :samp:`phy` is the preferred PHY of connections, one or more of :samp:`PHY_1M`, :samp:`PHY_2M` and :samp:`PHY_CODED` ORed. With :samp:`PHY_2M` the radio transmits at 2 Mbps when the central supports it.
+        * :samp:`data_length` is the Data Length Extension to request on connection, the payload in bytes of link layer packets, up to 251 (0 keeps the default of 27).
+        * :samp:`mtu` is the ATT MTU to request on connection, up to 247 (0 keeps the default of 23). A notification carries up to :samp:`mtu` - 3 bytes.
+
+    For throughput, ask for short connection intervals (7.5 ms is the shortest allowed: connection intervals can be given as floats), :samp:`PHY_2M`,
+    :samp:`data_length=251` and :samp:`mtu=247`, so that each notification fits a single link layer packet, and stream with :meth:`Characteristic.stream`.
+    The central decides in the end: :func:`link_info` returns what was negotiated.
 
     Security features can be not completely supported by the underlying BLE driver. When supported, the security features are selectable as follows:
 
@@ -140,7 +151,36 @@ def gap(name, appearance=0, security=(1,1), connection=(400,650,0,4000)):
         * Level 2 - Authenticated pairing with data signing
 
     """
-    __default_net["ble"].gap(name,security[0],security[1],appearance,connection[0],connection[1],connection[2],connection[3])
+    if data_length<0 or data_length>251 or mtu<0 or mtu>247 or not phy or phy&~(PHY_1M|PHY_2M|PHY_CODED):
+        raise ValueError
+    drv = __default_net["ble"]
+    drv.gap(name,security[0],security[1],appearance,connection[0],connection[1],connection[2],connection[3])
+    if phy!=PHY_1M or data_length or mtu:
+        drv.link_options(phy,data_length,mtu)
+
+def update_connection(min_interval, max_interval, latency=0, timeout=4000):
+    """
+.. function:: update_connection(min_interval,max_interval,latency=0,timeout=4000)
+
+    Ask the central to change the parameters of the current connection, as in the :samp:`connection` tuple of :func:`gap`.
+    The central may refuse or pick different values.
+
+    .. note:: Not guaranteed to be supported by every BLE driver!
+
+    """
+    __default_net["ble"].update_connection(min_interval,max_interval,latency,timeout)
+
+def link_info():
+    """
+.. function:: link_info()
+
+    Return a tuple ``(mtu, phy, data_length, interval)`` with the parameters negotiated for the current connection: ATT MTU,
+    PHY (one of the :samp:`PHY_` constants), link layer payload in bytes and connection interval in milliseconds.
+
+    .. note:: Not guaranteed to be supported by every BLE driver!
+
+    """
+    return __default_net["ble"].link_info()
 
 
 CAP_DISPLAY_ONLY = 0
@@ -358,6 +398,170 @@ def stop_scanning():
 
 
 
+@native_c("__blescan_config",["csrc/ble/blescan.c"])
+def _scan_config(rssi,addrs,uuids,mfrs,dedup,enable):
+    pass
+
+@native_c("__blescan_feed",["csrc/ble/blescan.c"])
+def _scan_feed(type,addr_type,rssi,packet,addr):
+    pass
+
+@native_c("__blescan_read",["csrc/ble/blescan.c"])
+def _scan_read(buffer,timeout):
+    pass
+
+@native_c("__blescan_stats",["csrc/ble/blescan.c"])
+def scan_stats():
+    """
+.. function:: scan_stats()
+
+    Return a tuple ``(seen, passed, duplicates, dropped)`` with the number of scan reports received since :func:`scan_filter`,
+    queued for :func:`scan_read`, dropped as duplicates and dropped because :func:`scan_read` was not keeping up.
+
+    """
+    pass
+
+_scan_user_cb = None
+
+def _scan_report(rep):
+    # drivers without the native path still call Python: filter and queue each report with one native call
+    _scan_feed(rep[0],rep[1],rep[2],rep[3],rep[4])
+
+def scan_filter(rssi=-128,addrs=(),uuids=(),manufacturers=(),dedup=1000,batching=True):
+    """
+.. function:: scan_filter(rssi=-128,addrs=(),uuids=(),manufacturers=(),dedup=1000,batching=True)
+
+    Filter scan reports natively and deliver them in batches with :func:`scan_read`, instead of one :samp:`EVT_SCAN_REPORT` callback each.
+    In dense environments only the interesting advertisements reach Python, and in a few calls.
+
+    A report passes if its rssi is at least *rssi* and, if any of the following lists is not empty, it matches at least one of their elements:
+
+    * *addrs*, device addresses as 6 bytes, as in the reports
+    * *uuids*, service UUIDs as integers (16 bits) or 16 bytes (big endian, as written), advertised in the service lists or as service data
+    * *manufacturers*, company identifiers of the manufacturer specific data (e.g. 0x004C for iBeacons)
+
+    Up to 8 elements per list are accepted. A report equal to one passed from the same address less than *dedup* milliseconds before is dropped
+    (0 keeps all). Reports whose data changed pass anyway.
+
+    With *batching* False, filtering stops and the :samp:`EVT_SCAN_REPORT` callback is restored.
+
+    Drivers supporting it filter the reports in C, as they come (see ``csrc/ble/blescan.h``); for the others, each report still costs one call
+    into Python, but just to queue it.
+
+    """
+    global _scan_user_cb
+    _scan_config(rssi,addrs,uuids,manufacturers,dedup,batching)
+    cb = callbacks[EVT_SCAN_REPORT] if EVT_SCAN_REPORT in callbacks else None
+    if batching:
+        if cb!=_scan_report:
+            _scan_user_cb = cb
+            callbacks[EVT_SCAN_REPORT] = _scan_report
+    elif cb==_scan_report:
+        if _scan_user_cb is None:
+            callbacks.pop(EVT_SCAN_REPORT)
+        else:
+            callbacks[EVT_SCAN_REPORT] = _scan_user_cb
+        _scan_user_cb = None
+
+def scan_read(buffer,timeout=-1):
+    """
+.. function:: scan_read(buffer,timeout=-1)
+
+    Move the reports passed by :func:`scan_filter` into the bytearray *buffer*, as many as fit, waiting at most *timeout* milliseconds
+    (forever if negative) for the first one. *buffer* is reused by the caller and must hold at least 41 bytes.
+    Return the number of bytes moved, 0 on timeout.
+
+    Reports are packed one after the other as: size of the report (10 bytes plus the packet), SCAN_TYPE, ADDR_TYPE, RSSI (a signed byte), the 6 bytes of ADDR
+    and PACKET, as in the tuples of :samp:`EVT_SCAN_REPORT`. :func:`scan_report` unpacks one. ::
+
+        buf = bytearray(512)
+        ble.scan_filter(rssi=-80,manufacturers=(0x004C,))
+        ble.start_scanning(60000)
+        while True:
+            n = ble.scan_read(buf)
+            ofs = 0
+            while ofs<n:
+                print(ble.scan_report(buf,ofs))
+                ofs+=buf[ofs]
+
+    """
+    return _scan_read(buffer,timeout)
+
+def scan_report(buffer,ofs=0):
+    """
+.. function:: scan_report(buffer,ofs=0)
+
+    Unpack the report at *ofs* in a *buffer* filled by :func:`scan_read` into a tuple (SCAN_TYPE, ADDR_TYPE, RSSI, PACKET, ADDR), as for :samp:`EVT_SCAN_REPORT`.
+
+    """
+    rssi = buffer[ofs+3]
+    if rssi>127:
+        rssi-=256
+    return (buffer[ofs+1], buffer[ofs+2], rssi, buffer[ofs+10:ofs+buffer[ofs]], buffer[ofs+4:ofs+10])
+
+
+@native_c("__blenotify_open",["csrc/ble/blenotify.c"])
+def _notify_open(service,uuid,chunk):
+    pass
+
+@native_c("__blenotify_native",["csrc/ble/blenotify.c"])
+def _notify_native():
+    pass
+
+@native_c("__blenotify_write",["csrc/ble/blenotify.c"])
+def _notify_write(q,data,timeout):
+    pass
+
+@native_c("__blenotify_flush",["csrc/ble/blenotify.c"])
+def _notify_flush(q,timeout):
+    pass
+
+@native_c("__blenotify_clear",["csrc/ble/blenotify.c"])
+def _notify_clear(q):
+    pass
+
+@native_c("__blenotify_pull",["csrc/ble/blenotify.c"])
+def _notify_pull(buffer,timeout):
+    pass
+
+@native_c("__blenotify_stats",["csrc/ble/blenotify.c"])
+def _notify_stats(q):
+    pass
+
+_notify_drainer = False
+
+def _notify_drain():
+    # drivers not draining the queues in C: one set_value per notification, at most one MTU each
+    buf = bytearray(244)
+    size = 20
+    while True:
+        __elements_set(buf,size)
+        r = _notify_pull(buf,0)
+        if r is None:
+            # idle: the MTU may change before the next burst
+            r = _notify_pull(buf,-1)
+            try:
+                size = link_info()[0]-3
+            except Exception:
+                size = 20
+            if size<20 or size>244:
+                size = 20
+        __elements_set(buf,r[2])
+        try:
+            __default_net["ble"].set_value(r[0],r[1],buf)
+        except Exception:
+            pass
+        __elements_set(buf,244)
+
+def _notify_queue(ch,chunk):
+    global _notify_drainer
+    q = _notify_open(ch.service,ch.uuid,chunk)
+    if not _notify_drainer and not _notify_native():
+        _notify_drainer = True
+        thread(_notify_drain)
+    return q
+
+
 def start():
     """
 .. function:: start()
@@ -469,6 +673,7 @@ Characteristic class
         self.descriptor = descriptor
         self.type=type
         self.fn = None
+        self._nq = None
 
     def set_value(self,value):
         """
@@ -539,6 +744,62 @@ Characteristic class
         """
         self.fn = fn
 
+    def stream(self,data,timeout=-1,chunk=0):
+        """
+.. method:: stream(data,timeout=-1,chunk=0)
+
+        Queue the bytes of :samp:`data` to be notified to the central, waiting at most :samp:`timeout` milliseconds (forever if negative)
+        for room in the queue, and return how many were queued. The queue is sent in notifications of at most :samp:`chunk` bytes
+        (0 for as many as the MTU allows) at the pace of the link, with no Python in between when the driver supports it (see ``csrc/ble/blenotify.h``):
+        feed it with large buffers, not a notification at a time. ::
+
+            c = ble.Characteristic(0xA002,ble.NOTIFY,244,"Samples",ble.BYTES)
+            ...
+            while True:
+                sensor.read_into(buf)
+                c.stream(buf)
+
+        :samp:`chunk` is bound on the first call. At most 2 characteristics can be streamed. Unlike :meth:`set_value`, the value
+        read by the central is not updated.
+
+        """
+        if self._nq is None:
+            self._nq = _notify_queue(self,chunk)
+        return _notify_write(self._nq,data,timeout)
+
+    def stream_flush(self,timeout=-1):
+        """
+.. method:: stream_flush(timeout=-1)
+
+        Wait at most :samp:`timeout` milliseconds (forever if negative) for the bytes queued by :meth:`stream` to be sent. Return True if all were.
+
+        """
+        if self._nq is None:
+            return True
+        return _notify_flush(self._nq,timeout)
+
+    def stream_clear(self):
+        """
+.. method:: stream_clear()
+
+        Discard the bytes queued by :meth:`stream` and not sent yet (e.g. on :samp:`EVT_DISCONNECTED`) and return how many.
+
+        """
+        if self._nq is None:
+            return 0
+        return _notify_clear(self._nq)
+
+    def stream_stats(self):
+        """
+.. method:: stream_stats()
+
+        Return a tuple ``(queued, sent, pending)``: bytes queued by :meth:`stream`, notifications sent and bytes not sent yet.
+
+        """
+        if self._nq is None:
+            return (0,0,0)
+        return _notify_stats(self._nq)
+
     def _get_ch(self):
         return (self.uuid,self.descriptor,self.permission,self.size)
 
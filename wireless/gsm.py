@@ -48,9 +48,9 @@ AUTH_DETECT = 3
 AUTH_PAP    = 1
 AUTH_CHAP   = 2
 
-def attach(apn, username = "", psw = "", auth = AUTH_NONE, timeout=120000):
+def attach(apn, username = "", psw = "", auth = AUTH_NONE, timeout=120000, ppp=False):
     """
-.. function:: attach(apn, username = "", psw = "", auth = AUTH_NONE, timeout=120000)
+.. function:: attach(apn, username = "", psw = "", auth = AUTH_NONE, timeout=120000, ppp=False)
 
         Try to establish a link with the chosen Access Point Name *apn*.
         *auth* must be one of AUTH_NONE (default), AUTH_PAP, AUTH_CHAP, AUTH_DETECT.
@@ -59,7 +59,16 @@ def attach(apn, username = "", psw = "", auth = AUTH_NONE, timeout=120000):
 
         An exception can be raised if the connection is not successful.
 
+        With *ppp* True the modem is switched to PPP data mode instead: the serial line is multiplexed (3GPP 27.010 CMUX),
+        AT commands keep their own channel and the data channel carries PPP, terminated by the lwIP stack of the device.
+        Sockets, :func:`select`, secure sockets and everything built on them then run over lwIP at the line rate of the modem,
+        instead of one AT command per socket operation.
+
+        .. note:: Not guaranteed to be supported by every gsm driver! Drivers supporting it are built on ``csrc/gsm/cmux.h``.
+
     """
+    if ppp:
+        return __default_net["gsm"].attach_ppp(apn, username, psw, auth,timeout)
     return __default_net["gsm"].attach(apn, username, psw, auth,timeout)
 
 def detach():
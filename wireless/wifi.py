@@ -22,14 +22,34 @@ This module defines the following constants:
     * `WIFI_WPA`  = 2; Wifi Network secured with WPA
     * `WIFI_WPA2`  = 3; Wifi Network secured with WPA2
 
+and the power save modes of :func:`set_power_save`:
+
+    * `WIFI_PS_NONE` = 0; the radio is always on
+    * `WIFI_PS_MODEM` = 1; modem sleep: the radio sleeps between the beacons it listens to
+    * `WIFI_PS_LIGHT` = 2; light sleep: as modem sleep, and the driver also stops the clocks it can between beacons
+
 
     """
 
+import socket
+import timers
+import pwr
+
 WIFI_OPEN = 0
 WIFI_WEP = 1
 WIFI_WPA = 2
 WIFI_WPA2 = 3
 
+WIFI_PS_NONE = 0
+WIFI_PS_MODEM = 1
+WIFI_PS_LIGHT = 2
+
+_ps_mode = WIFI_PS_NONE
+_ps_interval = 3
+_ps_wake_time = 200
+_ps_awake_until = None      # set while power save is suspended by wake
+_ps_timer = None
+
 
 def gethostbyname(hostname):
     """
@@ -84,17 +104,27 @@ def scan(duration=5000):
     """
     return __default_net["wifi"].scan(duration)
             
-def link(ssid,security,password=""):
+def link(ssid,security,password="",power_save=None,listen_interval=3):
     """
-.. function:: link(ssid,security,password="")        
+.. function:: link(ssid,security,password="",power_save=None,listen_interval=3)
 
         Try to establish a link with the Access Point handling the wifi network identified by *ssid*. *security* must be one
         of the WIFI_ constants, and *password* is needed if *security* is different from WIFI_OPEN
 
+        If *power_save* is one of the WIFI_PS_ constants, the link is made in that power save mode, as by :func:`set_power_save`;
+        if None, the mode already set is kept.
+
         An exception can be raised if the link is not successful.
 
     """
+    if power_save is not None:
+        set_power_save(power_save,listen_interval)
+    # the listen interval is announced to the access point when associating
+    if _ps_mode!=WIFI_PS_NONE:
+        __default_net["wifi"].set_power_save(_ps_mode,_ps_interval)
     __default_net["wifi"].link(ssid,security,password)
+    if _ps_mode!=WIFI_PS_NONE:
+        _ps_apply()
 
 def try_link(ssid,password,sec=WIFI_WPA2, attempts=5,delay=2000):
     """
@@ -108,9 +138,13 @@ def try_link(ssid,password,sec=WIFI_WPA2, attempts=5,delay=2000):
 
     """
     exc = None
+    if _ps_mode!=WIFI_PS_NONE:
+        __default_net["wifi"].set_power_save(_ps_mode,_ps_interval)
     for _ in range(attempts):
         try:
             __default_net["wifi"].link(ssid, sec, password)
+            if _ps_mode!=WIFI_PS_NONE:
+                _ps_apply()
             break
         except Exception as e:
             exc = e
@@ -118,6 +152,136 @@ def try_link(ssid,password,sec=WIFI_WPA2, attempts=5,delay=2000):
     else:
         raise exc
 
+_FAST_LEN = 60
+_fast_ram = None
+
+def _fast_hash(ssid,password):
+    # fnv-1a: the record is valid only for the same network and password
+    h = 0x811c
+    for i in range(len(ssid)):
+        h = ((h^__byte_get(ssid,i))*0x193)&0xffff
+    h = (h*0x193)&0xffff
+    for i in range(len(password)):
+        h = ((h^__byte_get(password,i))*0x193)&0xffff
+    return h
+
+def _fast_encode(ssid,password,params,info):
+    bssid, channel, pmk = params
+    rec = bytearray(_FAST_LEN)
+    h = _fast_hash(ssid,password)
+    rec[0] = 0x57
+    rec[1] = h>>8
+    rec[2] = h&0xff
+    rec[3] = channel
+    for i in range(6):
+        rec[4+i] = bssid[i]
+    rec[10] = len(pmk)
+    for i in range(len(pmk)):
+        rec[11+i] = pmk[i]
+    for j in range(4):
+        ip = socket.ip_to_tuple(info[j])
+        for i in range(4):
+            rec[43+j*4+i] = ip[i]
+    for i in range(_FAST_LEN-1):
+        rec[_FAST_LEN-1]^=rec[i]
+    return rec
+
+def _fast_decode(rec,ssid,password):
+    if rec is None or len(rec)<_FAST_LEN or rec[0]!=0x57 or rec[10]>32:
+        return None
+    x = 0
+    for i in range(_FAST_LEN):
+        x^=rec[i]
+    if x or ((rec[1]<<8)|rec[2])!=_fast_hash(ssid,password):
+        return None
+    info = []
+    for j in range(4):
+        o = 43+j*4
+        info.append(str(rec[o])+"."+str(rec[o+1])+"."+str(rec[o+2])+"."+str(rec[o+3]))
+    return (rec[4:10], rec[3], rec[11:11+rec[10]], info)
+
+def _fast_load(store,key):
+    if store is not None:
+        return store.get(key)
+    try:
+        if pwr.get_status_size()>=_FAST_LEN:
+            rec = bytearray(_FAST_LEN)
+            for i in range(_FAST_LEN):
+                rec[i] = pwr.get_status_byte(i)
+            return rec
+    except Exception:
+        pass
+    return _fast_ram
+
+def _fast_save(store,key,rec):
+    global _fast_ram
+    if store is not None:
+        if rec is None:
+            store.delete(key)
+        else:
+            store.set(key,rec)
+        return
+    _fast_ram = rec
+    try:
+        if pwr.get_status_size()>=_FAST_LEN:
+            for i in range(_FAST_LEN):
+                pwr.set_status_byte(i,rec[i] if rec is not None else 0)
+    except Exception:
+        pass
+
+def link_fast(ssid,security,password="",store=None,key="wifi"):
+    """
+.. function:: link_fast(ssid,security,password="",store=None,key="wifi")
+
+        Link as :func:`link`, reusing what the last link learned: the BSSID and channel of the access point, the key derived from
+        the password (PMK) and the addresses assigned by DHCP. Scan, key derivation and DHCP are skipped, the link takes just the
+        association and the handshake: duty cycled devices reconnect in a fraction of the time.
+
+        The first time, or when the cached link fails (the access point changed, the network is different), a full link is made,
+        with DHCP, and its parameters are cached for the next one. The addresses are reused as static ones: if the DHCP server may assign them
+        to others in the meantime, call :func:`link_fast_clear` from time to time to renew them.
+
+        The cache is kept in *store* under *key* if *store* is a :class:`kvstore.KVStore`, to survive resets and power losses. Otherwise it is
+        kept in the special purpose memory of :mod:`pwr`, preserved in STANDBY mode, when it is large enough (60 bytes), or in RAM.
+
+        Return True if the cached link succeeded, False if a full link was made. An exception is raised if the full link fails too.
+
+.. note:: Without support in the wifi driver, only the addresses are reused, saving DHCP.
+
+    """
+    drv = __default_net["wifi"]
+    cached = _fast_decode(_fast_load(store,key),ssid,password)
+    if cached is not None:
+        bssid, channel, pmk, info = cached
+        try:
+            drv.set_link_info(info[0],info[1],info[2],info[3])
+            try:
+                drv.link_fast(ssid,security,password,bssid,channel,pmk)
+                if _ps_mode!=WIFI_PS_NONE:
+                    _ps_apply()
+            except UnsupportedError:
+                link(ssid,security,password)
+            return True
+        except Exception:
+            pass
+        drv.set_link_info("0.0.0.0","0.0.0.0","0.0.0.0","0.0.0.0")
+    link(ssid,security,password)
+    try:
+        params = drv.link_params()
+    except Exception:
+        params = (bytes(6),0,b"")
+    _fast_save(store,key,_fast_encode(ssid,password,params,link_info()))
+    return False
+
+def link_fast_clear(store=None,key="wifi"):
+    """
+.. function:: link_fast_clear(store=None,key="wifi")
+
+        Drop the cache of :func:`link_fast` kept in *store* under *key*, or in the special purpose memory or RAM, so that the next link is a full one.
+
+    """
+    _fast_save(store,key,None)
+
 def unlink():
     """
 .. function:: unlink()        
@@ -261,3 +425,110 @@ def station_off():
 
     """        
     return __default_net["wifi"].station_off()
+
+
+def _ps_apply():
+    if _ps_awake_until is None:
+        __default_net["wifi"].set_power_save(_ps_mode,_ps_interval)
+    else:
+        __default_net["wifi"].set_power_save(WIFI_PS_NONE,_ps_interval)
+
+def _ps_expire(arg):
+    global _ps_awake_until
+    # traffic after the timer was armed moved the deadline on
+    left = _ps_awake_until-timers.now() if _ps_awake_until is not None else 0
+    if left>0:
+        _ps_timer.one_shot(left,_ps_expire)
+        return
+    _ps_awake_until = None
+    try:
+        _ps_apply()
+    except Exception:
+        pass
+
+def _ps_wakeup():
+    wake()
+
+def _ps_sleep_hook(entering, timeout, mode):
+    if mode==pwr.PWR_STANDBY:
+        return
+    try:
+        if entering:
+            # stay associated with the radio in its lowest power mode while the mcu sleeps
+            __default_net["wifi"].set_power_save(WIFI_PS_LIGHT,_ps_interval)
+        else:
+            _ps_apply()
+    except Exception:
+        pass
+
+def set_power_save(mode,listen_interval=3,wake_time=200):
+    """
+.. function:: set_power_save(mode,listen_interval=3,wake_time=200)
+
+        Set the power save mode of the link to one of the WIFI_PS_ constants. In power save the radio wakes up only to receive
+        one beacon every *listen_interval* DTIM periods of the access point: frames for the device are buffered by the access point until then.
+        The link is kept, no reconnection is needed to send, but replies may be delayed up to the listen interval.
+
+        To avoid that, sockets wake the radio on demand: connecting or sending turns power save off, and it is turned on again
+        *wake_time* milliseconds after the last of them, enough for the replies of usual request/response exchanges. :func:`wake` does
+        the same explicitly.
+
+        While :func:`pwr.go_to_sleep` puts the microcontroller in SLEEP or STOP mode, the radio is kept in light sleep.
+
+        The listen interval is announced to the access point when linking: a new one may be applied at the next :func:`link` only.
+
+        An exception can be raised if the driver does not support the mode.
+
+.. note:: Not guaranteed to be supported by every wifi driver!
+
+    """
+    global _ps_mode, _ps_interval, _ps_wake_time, _ps_awake_until
+    if mode<WIFI_PS_NONE or mode>WIFI_PS_LIGHT or listen_interval<1:
+        raise ValueError
+    __default_net["wifi"].set_power_save(mode,listen_interval)
+    _ps_mode = mode
+    _ps_interval = listen_interval
+    _ps_wake_time = wake_time
+    _ps_awake_until = None
+    if mode==WIFI_PS_NONE:
+        socket._wakeup = None
+        pwr.remove_sleep_hook(_ps_sleep_hook)
+        if _ps_timer is not None:
+            _ps_timer.clear()
+    else:
+        socket._wakeup = _ps_wakeup
+        pwr.add_sleep_hook(_ps_sleep_hook)
+
+def get_power_save():
+    """
+.. function:: get_power_save()
+
+        Return a tuple ``(mode, listen_interval, wake_time)`` with the power save settings of :func:`set_power_save`.
+
+    """
+    return (_ps_mode,_ps_interval,_ps_wake_time)
+
+def wake(duration=-1):
+    """
+.. function:: wake(duration=-1)
+
+        Turn power save off for *duration* milliseconds (the *wake_time* of :func:`set_power_save` if negative), or for longer if
+        called again before the end. Sockets call it before connecting and sending. Nothing is done if power save is off.
+
+    """
+    global _ps_awake_until, _ps_timer
+    if _ps_mode==WIFI_PS_NONE:
+        return
+    if duration<0:
+        duration = _ps_wake_time
+    until = timers.now()+duration
+    if _ps_awake_until is not None:
+        # already awake: the timer checks the deadline when it fires
+        if until>_ps_awake_until:
+            _ps_awake_until = until
+        return
+    _ps_awake_until = until
+    __default_net["wifi"].set_power_save(WIFI_PS_NONE,_ps_interval)
+    if _ps_timer is None:
+        _ps_timer = timers.timer()
+    _ps_timer.one_shot(duration,_ps_expire)
@@ -25,6 +25,12 @@ This module allows to perform useful operations involving `x509 certificates <x5
         "csrc/x509/x509_ifc.c",
         "#csrc/misc/zstdlib.c",
         "#csrc/hwcrypto/*",
+        "#csrc/drbg/zdrbg.c",
+        "#crypto/hash/csrc/cifra/src/drbg.c",
+        "#crypto/hash/csrc/cifra/src/sha256.c",
+        "#crypto/hash/csrc/cifra/src/hmac.c",
+        "#crypto/hash/csrc/cifra/src/chash.c",
+        "#crypto/hash/csrc/cifra/src/blockwise.c",
 #-if !HAS_BUILTIN_MBEDTLS
         # compile whole mbedtls library except for net_sockets.c since socks are not needed
         "#csrc/tls/mbedtls/library/pk_wrap.c",
@@ -106,6 +112,8 @@ This module allows to perform useful operations involving `x509 certificates <x5
     ],
     [
         "-I#csrc/hwcrypto",
+        "-I#csrc/drbg",
+        "-I#crypto/hash/csrc/cifra/src/ext",
 #-if !HAS_BUILTIN_MBEDTLS
         "-I#csrc/tls/mbedtls/include"
 #-endif
@@ -137,3 +145,86 @@ For example, with an ``ATECC508A`` (:ref:`ATECCx08A interface <lib.microchip.ate
 
     """
     pass
+
+
+@native_c("py_ssl_certstore_new",[])
+def _store_new():
+    pass
+
+@native_c("py_ssl_certstore_add",[])
+def _store_add(id,cert):
+    pass
+
+@native_c("py_ssl_certstore_free",[])
+def _store_free(id):
+    pass
+
+@native_c("py_ssl_certstore_info",[])
+def _store_info(id):
+    pass
+
+
+class CertStore():
+    """
+.. class:: CertStore(certs=())
+
+    A set of CA certificates parsed once and shared by every TLS socket created with a context referencing it, in place of
+    parsing **cacert** again at each connection: ::
+
+        import x509
+        import ssl
+
+        store = x509.CertStore([ca1, ca2])
+        ctx = ssl.create_ssl_context(cacert=store, hostname="example.com", options=ssl.CERT_REQUIRED|ssl.SERVER_AUTH)
+
+    **certs** is a list of certificates, each as accepted by :meth:`add`.
+    The parsed certificates stay in RAM until :meth:`close` is called and the last socket using them is closed.
+    At most ``ZERYNTH_SSL_CERTSTORES`` stores (2 by default) can be open at the same time: :samp:`RuntimeError` is raised if none is free.
+
+.. note:: Only available with network drivers using the TLS stack of the VM (``ZERYNTH_SSL``); :samp:`UnsupportedError` is raised otherwise.
+
+    """
+    def __init__(self,certs=()):
+        self._store = _store_new()
+        for cert in certs:
+            self.add(cert)
+
+    def add(self,cert):
+        """
+.. method:: add(cert)
+
+        Parses **cert** and adds its certificates to the store. It can be bytes, bytearray or a string, either in PEM format (null-terminated)
+        or in DER format, which skips the PEM decoding, a resource (:class:`streams.ResourceStream`) or its view (:class:`streams.FlashView`), parsed in place
+        in flash, or an object with a **size** and **read** method.
+
+        Returns the number of certificates in the store. Raises :samp:`ValueError` if **cert** can't be parsed and :samp:`RuntimeError` if
+        sockets are using the store.
+
+        """
+        if type(cert)==PINSTANCE:
+            if hasattr(cert,"addr"):
+                cert = (cert.addr,len(cert))
+            else:
+                cert = cert.read(cert.size())
+        return _store_add(self._store,cert)
+
+    def info(self):
+        """
+.. method:: info()
+
+        Returns a tuple (*certs*, *refs*) with the number of certificates in the store and of its references: one for the store itself and one for each
+        socket using it.
+
+        """
+        return _store_info(self._store)
+
+    def close(self):
+        """
+.. method:: close()
+
+        Releases the store. Sockets using it keep it until they are closed.
+
+        """
+        if self._store is not None:
+            _store_free(self._store)
+            self._store = None
@@ -0,0 +1,216 @@
+"""
+.. module:: zlib
+
+****
+Zlib
+****
+
+This module decompresses data in the deflate format (`RFC 1951 <https://tools.ietf.org/html/rfc1951>`_), raw or wrapped in the
+zlib (`RFC 1950 <https://tools.ietf.org/html/rfc1950>`_) and gzip (`RFC 1952 <https://tools.ietf.org/html/rfc1952>`_) formats.
+
+Decompression is streaming: data can be given in pieces of any size and the output is produced in pieces of a caller chosen size,
+so that documents and firmware much larger than the available RAM can be received compressed. The only large allocation is the window
+of the decoder, whose size is set by *wbits* with the same convention as CPython ``zlib``:
+
+    * 8 to 15: zlib format, with a window of 2**\ *wbits* bytes
+    * -8 to -15: raw deflate
+    * 24 to 31 (16 + 8..15): gzip format
+    * 40 to 47 (32 + 8..15): zlib or gzip format, detected from the header
+
+The window must be as large as the one used by the compressor: 32KB (*wbits* 15) by default, but compressing with a smaller window
+(e.g. ``gzip`` can't, ``zlib.compressobj(wbits=10)`` in CPython can) allows decompressing with 1KB of RAM.
+
+Compressed HTTP responses can be decompressed while they are received::
+
+    import requests
+    import zlib
+
+    f = open("/zt/data.json","w")
+    r = requests.get(url,headers={"accept-encoding":"gzip"},stream=True)
+    d = zlib.Decompressor(callback=f.write)
+    r.iter_content(bytearray(512),d.write)
+    d.close()
+
+    """
+
+import streams
+
+MAX_WBITS = 15
+
+new_exception(ZlibError,ValueError)
+
+@native_c("zinflate_new",["csrc/zlib/*","csrc/crc/crc32.c"])
+def _new(wbits):
+    pass
+
+@native_c("zinflate_run",["csrc/zlib/*","csrc/crc/crc32.c"])
+def _run(state,data,ofs,out,outofs):
+    pass
+
+def _state(wbits):
+    try:
+        return _new(wbits)
+    except ValueError:
+        raise ZlibError
+
+
+class Decompressor():
+    """
+==================
+Decompressor class
+==================
+
+.. class:: Decompressor(wbits=47,callback=None,size=512)
+
+    Create a decompressor for a stream in the format selected by *wbits*. The output is produced in a bytearray of *size* bytes, reused for every piece:
+    if *callback* is given it is called with the bytearray after each piece (its length set to the bytes produced), otherwise the pieces are collected and
+    returned by :meth:`write`.
+
+    .. attribute:: eof
+
+        True when the end of the compressed stream has been reached.
+
+    .. attribute:: unused_data
+
+        The bytes given after the end of the compressed stream, or None.
+
+    """
+    def __init__(self,wbits=47,callback=None,size=512):
+        self._state = _state(wbits)
+        self._buf = bytearray(size)
+        self.callback = callback
+        self.eof = False
+        self.unused_data = None
+
+    def write(self,data):
+        """
+.. method:: write(data)
+
+    Decompress the byte sequence *data*, the next piece of the compressed stream. Returns None if a *callback* is set, otherwise a bytearray with the output.
+    Being a single argument method, :meth:`write` can be given as callback to :meth:`requests.Response.iter_content` or to a *stream_callback*.
+
+    Raises ``ZlibError`` when *data* is not valid compressed data.
+
+        """
+        out = None
+        if self.callback is None:
+            out = bytearray()
+        size = len(self._buf)
+        ofs = 0
+        while not self.eof:
+            __elements_set(self._buf,size)
+            try:
+                res = _run(self._state,data,ofs,self._buf,0)
+            except:
+                raise ZlibError
+            ofs = res[0]
+            n = res[1]
+            self.eof = res[2]
+            if n:
+                __elements_set(self._buf,n)
+                if out is None:
+                    self.callback(self._buf)
+                else:
+                    out.extend(self._buf)
+            # the buffer not filled means every byte of data has been used
+            if n<size and ofs>=len(data):
+                break
+        if self.eof and ofs<len(data):
+            self.unused_data = data[ofs:]
+        return out
+
+    def close(self):
+        """
+.. method:: close()
+
+    Signal the end of the compressed data. Raises ``ZlibError`` if the compressed stream is incomplete.
+
+        """
+        if not self.eof:
+            raise ZlibError
+
+
+def decompress(data,wbits=47):
+    """
+.. function:: decompress(data,wbits=47)
+
+    Returns a bytearray with the decompressed contents of the byte sequence *data*.
+
+    Raises ``ZlibError`` when *data* is not valid or complete compressed data.
+
+    """
+    d = Decompressor(wbits,None,1024)
+    out = d.write(data)
+    d.close()
+    return out
+
+
+class InflateStream(streams.stream):
+    """
+===================
+InflateStream class
+===================
+
+.. class:: InflateStream(source,wbits=47,size=512)
+
+    Create a stream reading the decompressed contents of the stream *source* (for example a :class:`streams.FileStream`, a socket or a flash region):
+    *source* can be any object with a *_readbuf* or *read* method, and is read *size* bytes at a time into a reused buffer.
+
+    Reading methods (:meth:`read`, :meth:`readline`...) raise ``ZlibError`` if *source* ends before the end of the compressed stream or holds invalid data,
+    and return empty bytearrays once the decompressed contents are exhausted.
+
+    """
+    def __init__(self,source,wbits=47,size=512):
+        self.source = source
+        self._state = _state(wbits)
+        self._in = bytearray(size)
+        self._pos = 0
+        __elements_set(self._in,0)
+        self._size = size
+        self._readin = hasattr(source,"_readbuf")
+        self.eof = False
+
+    def _fill(self):
+        if self._readin:
+            __elements_set(self._in,self._size)
+            n = self.source._readbuf(self._in,self._size)
+            if n<0:
+                raise IOError
+            __elements_set(self._in,n)
+        else:
+            self._in = self.source.read(self._size)
+        self._pos = 0
+        if not len(self._in):
+            raise ZlibError
+
+    def _readbuf(self,buf,size=1,ofs=0):
+        if self.eof:
+            return 0
+        # the decoder fills buf up to its length: limit it to size bytes
+        blen = len(buf)
+        if ofs+size<blen:
+            __elements_set(buf,ofs+size)
+        n = 0
+        while not self.eof and not n:
+            if self._pos>=len(self._in):
+                try:
+                    self._fill()
+                except Exception as e:
+                    __elements_set(buf,blen)
+                    raise e
+            try:
+                res = _run(self._state,self._in,self._pos,buf,ofs)
+            except:
+                __elements_set(buf,blen)
+                raise ZlibError
+            self._pos = res[0]
+            n = res[1]-ofs
+            self.eof = res[2]
+        __elements_set(buf,blen)
+        return n
+
+    def write(self,buf):
+        raise UnsupportedError
+
+    def available(self):
+        return not self.eof